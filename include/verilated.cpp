@@ -54,6 +54,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cerrno>
 #include <cstdlib>
 #include <iostream>
@@ -77,6 +78,9 @@
 # include <sys/resource.h>
 # define _VL_HAVE_GETRLIMIT
 #endif
+#ifdef __linux
+# include <sys/mman.h>  // mmap, madvise
+#endif
 
 #include "verilated_threads.h"
 // clang-format on
@@ -284,14 +288,24 @@ void VL_DBG_MSGF(const char* formatp, ...) VL_MT_SAFE {
     VL_PRINTF("-V{t%u,%" PRIu64 "}%s", VL_THREAD_ID(), _vl_dbg_sequence_number(), result.c_str());
 }
 
+static void _vl_print_mt(const std::string& output) VL_MT_SAFE {
+    // Outside of an mtask print immediately; this is the common case, so avoid
+    // constructing a message that VerilatedThreadMsgQueue::post would just run
+    if (Verilated::mtaskId() == 0) {
+        VL_PRINTF("%s", output.c_str());
+        return;
+    }
+    VerilatedThreadMsgQueue::post(VerilatedMsg{[=]() {  //
+        VL_PRINTF("%s", output.c_str());
+    }});
+}
+
 void VL_PRINTF_MT(const char* formatp, ...) VL_MT_SAFE {
     va_list ap;
     va_start(ap, formatp);
     const std::string result = _vl_string_vprintf(formatp, ap);
     va_end(ap);
-    VerilatedThreadMsgQueue::post(VerilatedMsg{[=]() {  //
-        VL_PRINTF("%s", result.c_str());
-    }});
+    _vl_print_mt(result);
 }
 
 //===========================================================================
@@ -316,6 +330,19 @@ uint64_t VlRNG::rand64() VL_MT_UNSAFE {
     m_state[1] = (m_state[1] << 36) | (m_state[1] >> 28);
     return result;
 }
+void VlRNG::fill(EData* wordsp, int words) VL_MT_UNSAFE {
+    // Xoroshiro128+ algorithm, as in rand64()
+    uint64_t s0 = m_state[0];
+    uint64_t s1 = m_state[1];
+    for (int i = 0; i < words; ++i) {
+        wordsp[i] = static_cast<EData>(s0 + s1);
+        s1 ^= s0;
+        s0 = ((s0 << 55) | (s0 >> 9)) ^ s1 ^ (s1 << 14);
+        s1 = (s1 << 36) | (s1 >> 28);
+    }
+    m_state[0] = s0;
+    m_state[1] = s1;
+}
 uint64_t VlRNG::vl_thread_rng_rand64() VL_MT_SAFE {
     VlRNG& fromr = vl_thread_rng();
     const uint64_t result = fromr.m_state[0] + fromr.m_state[1];
@@ -325,6 +352,9 @@ uint64_t VlRNG::vl_thread_rng_rand64() VL_MT_SAFE {
     fromr.m_state[1] = (fromr.m_state[1] << 36) | (fromr.m_state[1] >> 28);
     return result;
 }
+void VlRNG::vl_thread_rng_fill(EData* wordsp, int words) VL_MT_SAFE {
+    vl_thread_rng().fill(wordsp, words);
+}
 void VlRNG::srandom(uint64_t n) VL_MT_UNSAFE {
     m_state[0] = n;
     m_state[1] = m_state[0];
@@ -389,13 +419,13 @@ VlRNG& VlRNG::vl_thread_rng() VL_MT_SAFE {
 }
 
 WDataOutP VL_RANDOM_W(int obits, WDataOutP outwp) VL_MT_SAFE {
-    for (int i = 0; i < VL_WORDS_I(obits); ++i) outwp[i] = vl_rand64();
+    VlRNG::vl_thread_rng_fill(outwp, VL_WORDS_I(obits));
     // Last word is unclean
     return outwp;
 }
 
 WDataOutP VL_RANDOM_RNG_W(VlRNG& rngr, int obits, WDataOutP outwp) VL_MT_UNSAFE {
-    for (int i = 0; i < VL_WORDS_I(obits); ++i) outwp[i] = rngr.rand64();
+    rngr.fill(outwp, VL_WORDS_I(obits));
     // Last word is unclean
     return outwp;
 }
@@ -438,8 +468,8 @@ WDataOutP VL_SCOPED_RAND_RESET_W(int obits, WDataOutP outwp, uint64_t scopeHash,
                                  uint64_t salt) VL_MT_UNSAFE {
     if (Verilated::threadContextp()->randReset() != 2) { return VL_RAND_RESET_W(obits, outwp); }
     VlRNG rng{Verilated::threadContextp()->randSeed() ^ scopeHash ^ salt};
-    for (int i = 0; i < VL_WORDS_I(obits) - 1; ++i) outwp[i] = rng.rand64();
-    outwp[VL_WORDS_I(obits) - 1] = rng.rand64() & VL_MASK_E(obits);
+    rng.fill(outwp, VL_WORDS_I(obits));
+    outwp[VL_WORDS_I(obits) - 1] &= VL_MASK_E(obits);
     return outwp;
 }
 
@@ -458,8 +488,8 @@ QData VL_SCOPED_RAND_RESET_ASSIGN_Q(int obits, uint64_t scopeHash, uint64_t salt
 WDataOutP VL_SCOPED_RAND_RESET_ASSIGN_W(int obits, WDataOutP outwp, uint64_t scopeHash,
                                         uint64_t salt) VL_MT_UNSAFE {
     VlRNG rng{Verilated::threadContextp()->randSeed() ^ scopeHash ^ salt};
-    for (int i = 0; i < VL_WORDS_I(obits) - 1; ++i) outwp[i] = rng.rand64();
-    outwp[VL_WORDS_I(obits) - 1] = rng.rand64() & VL_MASK_E(obits);
+    rng.fill(outwp, VL_WORDS_I(obits));
+    outwp[VL_WORDS_I(obits) - 1] &= VL_MASK_E(obits);
     return outwp;
 }
 
@@ -484,8 +514,15 @@ QData VL_RAND_RESET_Q(int obits) VL_MT_SAFE {
 }
 
 WDataOutP VL_RAND_RESET_W(int obits, WDataOutP outwp) VL_MT_SAFE {
-    for (int i = 0; i < VL_WORDS_I(obits) - 1; ++i) outwp[i] = VL_RAND_RESET_I(32);
-    outwp[VL_WORDS_I(obits) - 1] = VL_RAND_RESET_I(32) & VL_MASK_E(obits);
+    // Same values as VL_RAND_RESET_I(32) per word, checking the reset mode once
+    const int randReset = Verilated::threadContextp()->randReset();
+    if (randReset == 0) return VL_ZERO_W(obits, outwp);
+    if (randReset == 1) {
+        for (int i = 0; i < VL_WORDS_I(obits); ++i) outwp[i] = ~0;
+    } else {
+        VlRNG::vl_thread_rng_fill(outwp, VL_WORDS_I(obits));
+    }
+    outwp[VL_WORDS_I(obits) - 1] &= VL_MASK_E(obits);
     return outwp;
 }
 WDataOutP VL_ZERO_RESET_W(int obits, WDataOutP outwp) VL_MT_SAFE {
@@ -871,7 +908,7 @@ std::string _vl_vsformat_time(char* tmp, T ld, int timeunit, bool left, size_t w
 // Do a va_arg returning a quad, assuming input argument is anything less than wide
 #define VL_VA_ARG_Q_(ap, bits) (((bits) <= VL_IDATASIZE) ? va_arg(ap, IData) : va_arg(ap, QData))
 
-void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL_MT_SAFE {
+void _vl_vsformat(std::string& output, const VlFormat& format, va_list ap) VL_MT_SAFE {
     // Format a Verilog $write style format into the output list
     // The format must be pre-processed (and lower cased) by Verilator
     // Arguments are in "width, arg-value (or WDataIn* if wide)" form
@@ -880,12 +917,12 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
     // Note also assumes variables < 64 are not wide, this assumption is
     // sometimes not true in low-level routines written here in verilated.cpp
     static thread_local char t_tmp[VL_VALUE_STRING_MAX_WIDTH];
-    std::string::const_iterator pctit = format.end();  // Most recent %##.##g format
+    const char* pctit = format.end();  // Most recent %##.##g format
     bool inPct = false;
     bool widthSet = false;
     bool left = false;
     size_t width = 0;
-    for (std::string::const_iterator pos = format.cbegin(); pos != format.cend(); ++pos) {
+    for (const char* pos = format.begin(); pos != format.end(); ++pos) {
         if (!inPct && pos[0] == '%') {
             pctit = pos;
             inPct = true;
@@ -893,7 +930,7 @@ void _vl_vsformat(std::string& output, const std::string& format, va_list ap) VL
             width = 0;
         } else if (!inPct) {  // Normal text
             // Fast-forward to next escape and add to output
-            std::string::const_iterator ep = pos;
+            const char* ep = pos;
             while (ep != format.end() && ep[0] != '%') ++ep;
             if (ep != pos) {
                 output.append(pos, ep);
@@ -1598,7 +1635,7 @@ void VL_FCLOSE_I(IData fdi) VL_MT_SAFE {
     Verilated::threadContextp()->impp()->fdClose(fdi);
 }
 
-void VL_SFORMAT_NX(int obits, CData& destr, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, CData& destr, const VlFormat& format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
     t_output = "";
     va_list ap;
@@ -1609,7 +1646,7 @@ void VL_SFORMAT_NX(int obits, CData& destr, const std::string& format, int argc,
     _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits, SData& destr, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, SData& destr, const VlFormat& format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
     t_output = "";
     va_list ap;
@@ -1620,7 +1657,7 @@ void VL_SFORMAT_NX(int obits, SData& destr, const std::string& format, int argc,
     _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits, IData& destr, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, IData& destr, const VlFormat& format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
     t_output = "";
     va_list ap;
@@ -1631,7 +1668,7 @@ void VL_SFORMAT_NX(int obits, IData& destr, const std::string& format, int argc,
     _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits, QData& destr, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, QData& destr, const VlFormat& format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
     t_output = "";
     va_list ap;
@@ -1642,7 +1679,7 @@ void VL_SFORMAT_NX(int obits, QData& destr, const std::string& format, int argc,
     _vl_string_to_vint(obits, &destr, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits, void* destp, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_SFORMAT_NX(int obits, void* destp, const VlFormat& format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
     t_output = "";
     va_list ap;
@@ -1653,7 +1690,7 @@ void VL_SFORMAT_NX(int obits, void* destp, const std::string& format, int argc,
     _vl_string_to_vint(obits, destp, t_output.length(), t_output.c_str());
 }
 
-void VL_SFORMAT_NX(int obits_ignored, std::string& output, const std::string& format, int argc,
+void VL_SFORMAT_NX(int obits_ignored, std::string& output, const VlFormat& format, int argc,
                    ...) VL_MT_SAFE {
     (void)obits_ignored;  // So VL_SFORMAT_NNX function signatures all match
     std::string temp_output;
@@ -1664,7 +1701,7 @@ void VL_SFORMAT_NX(int obits_ignored, std::string& output, const std::string& fo
     output = temp_output;
 }
 
-std::string VL_SFORMATF_N_NX(const std::string& format, int argc, ...) VL_MT_SAFE {
+std::string VL_SFORMATF_N_NX(const VlFormat& format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
     t_output = "";
     va_list ap;
@@ -1675,7 +1712,7 @@ std::string VL_SFORMATF_N_NX(const std::string& format, int argc, ...) VL_MT_SAF
     return t_output;
 }
 
-void VL_WRITEF_NX(const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_WRITEF_NX(const VlFormat& format, int argc, ...) VL_MT_SAFE {
     static thread_local std::string t_output;  // static only for speed
     t_output = "";
     va_list ap;
@@ -1683,10 +1720,10 @@ void VL_WRITEF_NX(const std::string& format, int argc, ...) VL_MT_SAFE {
     _vl_vsformat(t_output, format, ap);
     va_end(ap);
 
-    VL_PRINTF_MT("%s", t_output.c_str());
+    _vl_print_mt(t_output);
 }
 
-void VL_FWRITEF_NX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE {
+void VL_FWRITEF_NX(IData fpi, const VlFormat& format, int argc, ...) VL_MT_SAFE {
     // While threadsafe, each thread can only access different file handles
     static thread_local std::string t_output;  // static only for speed
     t_output = "";
@@ -2154,6 +2191,7 @@ VlReadMem::VlReadMem(bool hex, int bits, const std::string& filename, QData star
         // cppcheck-has-bug-suppress resourceLeak  // m_fp is nullptr
         return;
     }
+    m_buf.resize(64 * 1024);
 }
 VlReadMem::~VlReadMem() {
     if (m_fp) {
@@ -2171,10 +2209,10 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
     bool readingAddress = false;
     int lastCh = ' ';
     // Read the data
-    // We process a character at a time, as then we don't need to deal
-    // with changing buffer sizes dynamically, etc.
+    // We process a character at a time from m_buf, as then we don't need to
+    // deal with values spanning buffer refills, etc.
     while (true) {
-        int c = std::fgetc(m_fp);
+        int c = getChar();
         if (VL_UNLIKELY(c == EOF)) break;
         const bool chIs4StateBin
             = c == '0' || c == '1' || c == 'x' || c == 'X' || c == 'z' || c == 'Z';
@@ -2186,7 +2224,7 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
         if (c == '_') continue;  // Ignore _ e.g. inside a number
         if (inData && !chIs4StateHex) {
             // printf("Got data @%lx = %s\n", m_addr, valuer.c_str());
-            ungetc(c, m_fp);
+            ungetChar();
             addrr = m_addr;
             ++m_addr;
             return true;
@@ -2246,37 +2284,38 @@ bool VlReadMem::get(QData& addrr, std::string& valuer) {
 }
 void VlReadMem::setData(void* valuep, const std::string& rhs) {
     const QData shift = m_hex ? 4ULL : 1ULL;
-    bool innum = false;
-    // Shift value in
-    for (const auto& i : rhs) {
-        const char c = std::tolower(i);
-        const int value = (c == 'x' || c == 'z') ? VL_RAND_RESET_I(m_hex ? 4 : 1)
-                          : (c >= 'a')           ? (c - 'a' + 10)
-                                                 : (c - '0');
+    if (m_bits <= VL_QUADSIZE) {
+        // Accumulate the digits in a word and store once; masking at the end
+        // is the same as masking after each digit
+        QData data = 0;
+        for (const auto& i : rhs) {
+            const char c = std::tolower(i);
+            const int value = (c == 'x' || c == 'z') ? VL_RAND_RESET_I(m_hex ? 4 : 1)
+                              : (c >= 'a')           ? (c - 'a' + 10)
+                                                     : (c - '0');
+            data = (data << shift) + static_cast<QData>(value);
+        }
         if (m_bits <= 8) {
-            CData* const datap = reinterpret_cast<CData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
+            *reinterpret_cast<CData*>(valuep) = static_cast<CData>(data & VL_MASK_I(m_bits));
         } else if (m_bits <= 16) {
-            SData* const datap = reinterpret_cast<SData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
+            *reinterpret_cast<SData*>(valuep) = static_cast<SData>(data & VL_MASK_I(m_bits));
         } else if (m_bits <= VL_IDATASIZE) {
-            IData* const datap = reinterpret_cast<IData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << shift) + value) & VL_MASK_I(m_bits);
-        } else if (m_bits <= VL_QUADSIZE) {
-            QData* const datap = reinterpret_cast<QData*>(valuep);
-            if (!innum) *datap = 0;
-            *datap = ((*datap << static_cast<QData>(shift)) + static_cast<QData>(value))
-                     & VL_MASK_Q(m_bits);
+            *reinterpret_cast<IData*>(valuep) = static_cast<IData>(data & VL_MASK_I(m_bits));
         } else {
-            WDataOutP datap = reinterpret_cast<WDataOutP>(valuep);
-            if (!innum) VL_ZERO_W(m_bits, datap);
-            _vl_shiftl_inplace_w(m_bits, datap, static_cast<IData>(shift));
-            datap[0] |= value;
+            *reinterpret_cast<QData*>(valuep) = data & VL_MASK_Q(m_bits);
         }
-        innum = true;
+        return;
+    }
+    // Wide, shift value in
+    WDataOutP datap = reinterpret_cast<WDataOutP>(valuep);
+    VL_ZERO_W(m_bits, datap);
+    for (const auto& i : rhs) {
+        const char c = std::tolower(i);
+        const int value = (c == 'x' || c == 'z') ? VL_RAND_RESET_I(m_hex ? 4 : 1)
+                          : (c >= 'a')           ? (c - 'a' + 10)
+                                                 : (c - '0');
+        _vl_shiftl_inplace_w(m_bits, datap, static_cast<IData>(shift));
+        datap[0] |= value;
     }
 }
 
@@ -2587,6 +2626,7 @@ VerilatedContext::VerilatedContext()
     m_ns.m_coverageFilename = "coverage.dat";
     m_ns.m_profExecFilename = "profile_exec.dat";
     m_ns.m_profVltFilename = "profile.vlt";
+    m_ns.m_profBlocksFilename = "profile_blocks.dat";
     m_ns.m_solverProgram = VlOs::getenvStr("VERILATOR_SOLVER", VL_SOLVER_DEFAULT);
     m_fdps.resize(31);
     std::fill(m_fdps.begin(), m_fdps.end(), static_cast<FILE*>(nullptr));
@@ -2660,6 +2700,14 @@ void VerilatedContext::calcUnusedSigs(bool flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_s.m_calcUnusedSigs = flag;
 }
+void VerilatedContext::coverageBinary(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_coverageBinary = flag;
+}
+bool VerilatedContext::coverageBinary() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_coverageBinary;
+}
 void VerilatedContext::coverageFilename(const std::string& flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_ns.m_coverageFilename = flag;
@@ -2720,6 +2768,10 @@ void VerilatedContext::profExecWindow(uint64_t flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_ns.m_profExecWindow = flag;
 }
+void VerilatedContext::profExecCounters(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_profExecCounters = flag;
+}
 void VerilatedContext::profExecFilename(const std::string& flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_ns.m_profExecFilename = flag;
@@ -2736,6 +2788,14 @@ std::string VerilatedContext::profVltFilename() const VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     return m_ns.m_profVltFilename;
 }
+void VerilatedContext::profBlocksFilename(const std::string& flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_profBlocksFilename = flag;
+}
+std::string VerilatedContext::profBlocksFilename() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_profBlocksFilename;
+}
 void VerilatedContext::solverProgram(const std::string& flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_ns.m_solverProgram = flag;
@@ -2744,6 +2804,14 @@ std::string VerilatedContext::solverProgram() const VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     return m_ns.m_solverProgram;
 }
+void VerilatedContext::solverBatch(uint32_t flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_solverBatch = flag;
+}
+void VerilatedContext::hugePages(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_s.m_hugePages = flag;
+}
 void VerilatedContext::quiet(bool flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_s.m_quiet = flag;
@@ -2781,6 +2849,36 @@ void VerilatedContext::threads(unsigned n) {
     }
 }
 
+void VerilatedContext::threadPoolShare(VerilatedContext& other) {
+    if (m_threadPool) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "%Error: Cannot share a thread pool after the thread pool has been created.");
+    }
+    m_threads = other.m_threads;
+    if (VlThreadPool* const poolp = static_cast<VlThreadPool*>(other.threadPoolp())) {
+        poolp->shared(true);
+        m_threadPool = other.m_threadPool;
+    }
+}
+
+void VerilatedContext::threadsPark(bool flag) {
+    if (m_threadPool) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "%Error: Cannot set simulation thread parking after the thread pool has been "
+                    "created.");
+    }
+    m_threadsPark = flag;
+}
+
+void VerilatedContext::threadsSteal(bool flag) {
+    if (m_threadPool) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "%Error: Cannot set simulation thread stealing after the thread pool has been "
+                    "created.");
+    }
+    m_threadsSteal = flag;
+}
+
 void VerilatedContext::commandArgs(int argc, const char** argv) VL_MT_SAFE_EXCLUDES(m_argMutex) {
     // Not locking m_argMutex here, it is done in impp()->commandArgsAddGuts
     // m_argMutex here is the same as in impp()->commandArgsAddGuts;
@@ -2849,11 +2947,14 @@ VerilatedVirtualBase* VerilatedContext::threadPoolp() {
     return m_threadPool.get();
 }
 
-void VerilatedContext::prepareClone() { delete m_threadPool.release(); }
+void VerilatedContext::prepareClone() { m_threadPool.reset(); }
 
 VerilatedVirtualBase* VerilatedContext::threadPoolpOnClone() {
-    if (VL_UNLIKELY(m_threadPool)) m_threadPool.release();
-    m_threadPool = std::unique_ptr<VlThreadPool>(new VlThreadPool{this, m_threads - 1});
+    if (VL_UNLIKELY(m_threadPool)) {
+        // The pool's threads do not exist in the clone, so leak it rather than join them
+        new std::shared_ptr<VerilatedVirtualBase>{std::move(m_threadPool)};
+    }
+    m_threadPool.reset(new VlThreadPool{this, m_threads - 1});
     return m_threadPool.get();
 }
 
@@ -2937,7 +3038,9 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
     if (0 == std::strncmp(arg.c_str(), "+verilator+", std::strlen("+verilator+"))) {
         std::string str;
         uint64_t u64;
-        if (commandArgVlString(arg, "+verilator+coverage+file+", str)) {
+        if (arg == "+verilator+coverage+binary") {
+            coverageBinary(true);
+        } else if (commandArgVlString(arg, "+verilator+coverage+file+", str)) {
             coverageFilename(str);
         } else if (arg == "+verilator+debug") {
             Verilated::debug(4);
@@ -2952,8 +3055,14 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
             VL_PRINTF_MT("For help, please see 'verilator --help'\n");
             VL_FATAL_MT("COMMAND_LINE", 0, "",
                         "Exiting due to command line argument (not an error)");
+        } else if (arg == "+verilator+hugepages") {
+            hugePages(true);
         } else if (arg == "+verilator+noassert") {
             assertOn(false);
+        } else if (commandArgVlString(arg, "+verilator+prof+blocks+file+", str)) {
+            profBlocksFilename(str);
+        } else if (arg == "+verilator+prof+exec+counters") {
+            profExecCounters(true);
         } else if (commandArgVlUint64(arg, "+verilator+prof+exec+start+", u64)) {
             profExecStart(u64);
         } else if (commandArgVlUint64(arg, "+verilator+prof+exec+window+", u64, 1)) {
@@ -2969,6 +3078,15 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
         } else if (commandArgVlUint64(arg, "+verilator+seed+", u64, 1,
                                       std::numeric_limits<int>::max())) {
             randSeed(static_cast<int>(u64));
+        } else if (commandArgVlUint64(arg, "+verilator+solver+batch+", u64, 1, 1024)) {
+            solverBatch(static_cast<uint32_t>(u64));
+        } else if (arg == "+verilator+threads+park") {
+            threadsPark(true);
+        } else if (commandArgVlUint64(arg, "+verilator+threads+rebalance+", u64, 0,
+                                      std::numeric_limits<uint32_t>::max())) {
+            threadsRebalance(static_cast<uint32_t>(u64));
+        } else if (arg == "+verilator+threads+steal") {
+            threadsSteal(true);
         } else if (arg == "+verilator+V") {
             VerilatedImp::versionDump();  // Someday more info too
             VL_FATAL_MT("COMMAND_LINE", 0, "",
@@ -3073,6 +3191,40 @@ void VerilatedContext::statsPrintSummary() VL_MT_UNSAFE {
               threadsInModels(), modelMB);
 }
 
+//======================================================================
+// VerilatedPerfStats/VerilatedPerfCounters:: Methods
+
+const char* VerilatedPerfStats::regionName(Region region) VL_PURE {
+    static const char* const names[REGIONS] = {"ico", "act", "nba", "obs", "react"};
+    return names[region];
+}
+
+uint64_t VerilatedPerfCounters::nowNs() VL_MT_SAFE {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+VerilatedPerfStats VerilatedPerfCounters::snapshot() const VL_MT_SAFE {
+    const auto load = [](const std::atomic<uint64_t>& counter) {
+        return counter.load(std::memory_order_relaxed);
+    };
+    VerilatedPerfStats stats;
+    stats.m_evals = load(m_evals);
+    stats.m_evalNs = load(m_evalNs);
+    for (size_t i = 0; i < VerilatedPerfStats::REGIONS; ++i) {
+        stats.m_regions[i].m_loops = load(m_regions[i].m_loops);
+        stats.m_regions[i].m_iterations = load(m_regions[i].m_iterations);
+        stats.m_regions[i].m_triggered = load(m_regions[i].m_triggered);
+        stats.m_regions[i].m_ns = load(m_regions[i].m_ns);
+    }
+    stats.m_delayQueueDepth = load(m_delayQueueDepth);
+    stats.m_delayQueueMaxDepth = load(m_delayQueueMaxDepth);
+    stats.m_traceBytes = load(m_traceBytes);
+    stats.m_threadIdleNs = load(m_threadIdleNs);
+    return stats;
+}
+
 //======================================================================
 // VerilatedContext:: Methods - scopes
 
@@ -3086,11 +3238,14 @@ void VerilatedContext::scopesDump() const VL_MT_SAFE {
     VL_PRINTF_MT("\n");
 }
 
+static std::atomic<uint64_t> s_scopeGeneration{0};  // See scopeGeneration()
+
 void VerilatedContextImp::scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at construction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
     if (it == m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+    ++s_scopeGeneration;
 }
 void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at destruction
@@ -3098,7 +3253,9 @@ void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     VerilatedImp::userEraseScope(scopep);
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
     if (it != m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.erase(it);
+    ++s_scopeGeneration;
 }
+uint64_t VerilatedContextImp::scopeGeneration() VL_MT_SAFE { return s_scopeGeneration; }
 const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT_SAFE {
     // Thread save only assuming this is called only after model construction completed
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
@@ -3157,6 +3314,59 @@ VerilatedSyms::~VerilatedSyms() {
     delete __Vm_evalMsgQp;
 }
 
+// Each allocation is preceded by the raw pointer to release, and the length
+// of the mapping, or 0 if the raw pointer came from calloc.
+static constexpr size_t VL_ALLOC_HEADER_BYTES = 2 * sizeof(void*);
+static constexpr size_t VL_HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+static void* vlAllocHeader(void* rawp, size_t mapLen, uintptr_t addr) {
+    reinterpret_cast<void**>(addr)[-1] = rawp;
+    reinterpret_cast<size_t*>(addr)[-2] = mapLen;
+    return reinterpret_cast<void*>(addr);
+}
+
+void* VerilatedSyms::allocZeroed(size_t size, VerilatedContext* contextp) {
+#ifdef __linux
+    // Large models spend much time in TLB misses, so back the state with
+    // transparent huge pages, aligned so the first huge page is usable.
+    // Objects smaller than a huge page gain nothing.
+    if (contextp && contextp->hugePages() && size >= VL_HUGE_PAGE_BYTES) {
+        const size_t mapLen = size + VL_HUGE_PAGE_BYTES + VL_ALLOC_HEADER_BYTES;
+        void* const rawp
+            = mmap(nullptr, mapLen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (rawp != MAP_FAILED) {
+            uintptr_t addr = reinterpret_cast<uintptr_t>(rawp) + VL_ALLOC_HEADER_BYTES;
+            addr = (addr + VL_HUGE_PAGE_BYTES - 1) & ~static_cast<uintptr_t>(VL_HUGE_PAGE_BYTES - 1);
+            const size_t adviseLen = (size + VL_HUGE_PAGE_BYTES - 1) & ~(VL_HUGE_PAGE_BYTES - 1);
+            // Advice only, so failure (e.g. THP disabled) is not an error
+            (void)madvise(reinterpret_cast<void*>(addr), adviseLen, MADV_HUGEPAGE);
+            return vlAllocHeader(rawp, mapLen, addr);
+        }
+    }
+#else
+    (void)contextp;
+#endif
+    // Large calloc's are satisfied with lazily zeroed pages from the OS, so
+    // state never written costs nothing.
+    void* const rawp = std::calloc(1, size + VL_CACHE_LINE_BYTES + VL_ALLOC_HEADER_BYTES);
+    if (VL_UNLIKELY(!rawp)) throw std::bad_alloc{};
+    uintptr_t addr = reinterpret_cast<uintptr_t>(rawp) + VL_ALLOC_HEADER_BYTES;
+    addr = (addr + VL_CACHE_LINE_BYTES - 1) & ~static_cast<uintptr_t>(VL_CACHE_LINE_BYTES - 1);
+    return vlAllocHeader(rawp, 0, addr);
+}
+
+void VerilatedSyms::freeZeroed(void* ptr) VL_MT_SAFE {
+    if (!ptr) return;
+    void* const rawp = reinterpret_cast<void**>(ptr)[-1];
+#ifdef __linux
+    if (const size_t mapLen = reinterpret_cast<size_t*>(ptr)[-2]) {
+        munmap(rawp, mapLen);
+        return;
+    }
+#endif
+    std::free(rawp);
+}
+
 //===========================================================================
 // Verilated:: Methods
 
@@ -3514,6 +3724,30 @@ void VerilatedScope::varInsert(int finalize, const char* namep, void* datap, boo
     m_varsp->emplace(namep, var);
 }
 
+void VerilatedScope::varsInsert(int finalize, const VerilatedVarDecl* declsp,
+                                void* const* datapp, size_t count) VL_MT_UNSAFE {
+    if (!finalize) return;
+
+    if (!m_varsp) m_varsp = new VerilatedVarNameMap;
+    m_varsp->reserve(m_varsp->size() + count);
+    for (size_t i = 0; i < count; ++i) {
+        const VerilatedVarDecl& decl = declsp[i];
+        VerilatedVar var(decl.m_namep, datapp[i], decl.m_vltype,
+                         static_cast<VerilatedVarFlags>(decl.m_vlflags), decl.m_udims,
+                         decl.m_pdims, decl.m_isParam);
+        const int* rangep = decl.m_rangesp;
+        for (int d = 0; d < decl.m_udims; ++d, rangep += 2) {
+            var.m_unpacked[d].m_left = rangep[0];
+            var.m_unpacked[d].m_right = rangep[1];
+        }
+        for (int d = 0; d < decl.m_pdims; ++d, rangep += 2) {
+            var.m_packed[d].m_left = rangep[0];
+            var.m_packed[d].m_right = rangep[1];
+        }
+        m_varsp->emplace(decl.m_namep, std::move(var));
+    }
+}
+
 // cppcheck-suppress unusedFunction  // Used by applications
 VerilatedVar* VerilatedScope::varFind(const char* namep) const VL_MT_SAFE_POSTINIT {
     if (VL_LIKELY(m_varsp)) {
@@ -353,6 +353,101 @@ public:
     virtual ~VerilatedVirtualBase() = default;
 };
 
+//===========================================================================
+/// Verilator runtime performance statistics
+///
+/// A snapshot of the counters a VerilatedContext accumulates while its
+/// models evaluate, as returned by VerilatedContext::perfStats(). The
+/// counters are only updated when the model was Verilated with
+/// --perf-stats, otherwise they all read as zero.
+
+struct VerilatedPerfStats final {
+    /// Scheduling regions with their own evaluation loop
+    enum Region : uint8_t { REGION_ICO, REGION_ACT, REGION_NBA, REGION_OBS, REGION_REACT };
+    static constexpr size_t REGIONS = 5;  // Number of Region values
+
+    struct RegionStats final {
+        uint64_t m_loops = 0;  // Times the region's loop was entered
+        uint64_t m_iterations = 0;  // Iterations of the loop, until convergence
+        uint64_t m_triggered = 0;  // Iterations that found triggers set and ran logic
+        uint64_t m_ns = 0;  // Wall time in the loop, including nested regions' loops
+    };
+
+    uint64_t m_evals = 0;  // Calls to the models' eval()
+    uint64_t m_evalNs = 0;  // Wall time in eval()
+    RegionStats m_regions[REGIONS];  // Per region statistics, indexed by Region
+    uint64_t m_delayQueueDepth = 0;  // Processes pending in the timing delay queue
+    uint64_t m_delayQueueMaxDepth = 0;  // Maximum of m_delayQueueDepth
+    uint64_t m_traceBytes = 0;  // Bytes written to VCD trace files
+    uint64_t m_threadIdleNs = 0;  // Wall time thread pool workers waited for tasks
+
+    /// Return name of a region, e.g. "nba"
+    static const char* regionName(Region region) VL_PURE;
+};
+
+//===========================================================================
+// Internal: Counters behind VerilatedContext::perfStats(). Updated by the
+// Verilated model's eval loops and the runtime library when compiled with
+// VL_PERF_STATS; each is a relaxed atomic, as besides the evaluating thread
+// only thread pool workers and trace writer threads update them.
+
+class VerilatedPerfCounters final {
+    // TYPES
+    struct RegionCounters final {
+        std::atomic<uint64_t> m_loops{0};
+        std::atomic<uint64_t> m_iterations{0};
+        std::atomic<uint64_t> m_triggered{0};
+        std::atomic<uint64_t> m_ns{0};
+    };
+
+    // MEMBERS
+    std::atomic<uint64_t> m_evals{0};
+    std::atomic<uint64_t> m_evalNs{0};
+    RegionCounters m_regions[VerilatedPerfStats::REGIONS];
+    std::atomic<uint64_t> m_delayQueueDepth{0};
+    std::atomic<uint64_t> m_delayQueueMaxDepth{0};
+    std::atomic<uint64_t> m_traceBytes{0};
+    std::atomic<uint64_t> m_threadIdleNs{0};
+
+    static void add(std::atomic<uint64_t>& counter, uint64_t value) VL_MT_SAFE {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    VL_UNCOPYABLE(VerilatedPerfCounters);
+
+public:
+    // CONSTRUCTORS
+    VerilatedPerfCounters() = default;
+    ~VerilatedPerfCounters() = default;
+
+    // METHODS
+    // Monotonic wall time, in nanoseconds
+    static uint64_t nowNs() VL_MT_SAFE;
+    void evalDone(uint64_t startNs) VL_MT_SAFE {
+        add(m_evals, 1);
+        add(m_evalNs, nowNs() - startNs);
+    }
+    void regionTriggered(VerilatedPerfStats::Region region) VL_MT_SAFE {
+        add(m_regions[region].m_triggered, 1);
+    }
+    void regionDone(VerilatedPerfStats::Region region, uint32_t iterations,
+                    uint64_t startNs) VL_MT_SAFE {
+        RegionCounters& counters = m_regions[region];
+        add(counters.m_loops, 1);
+        add(counters.m_iterations, iterations);
+        add(counters.m_ns, nowNs() - startNs);
+    }
+    void delayQueueDepth(uint64_t depth) VL_MT_SAFE {
+        m_delayQueueDepth.store(depth, std::memory_order_relaxed);
+        if (depth > m_delayQueueMaxDepth.load(std::memory_order_relaxed)) {
+            m_delayQueueMaxDepth.store(depth, std::memory_order_relaxed);
+        }
+    }
+    void traceBytes(uint64_t bytes) VL_MT_SAFE { add(m_traceBytes, bytes); }
+    void threadIdle(uint64_t ns) VL_MT_SAFE { add(m_threadIdleNs, ns); }
+    VerilatedPerfStats snapshot() const VL_MT_SAFE;
+};
+
 //===========================================================================
 /// Verilator simulation context
 ///
@@ -403,6 +498,7 @@ protected:
         bool m_fatalOnVpiError = true;  // Fatal on vpi error/unsupported
         bool m_gotError = false;  // A $finish statement executed
         bool m_gotFinish = false;  // A $finish or $stop statement executed
+        bool m_hugePages = false;  // Allocate model state from huge pages
         bool m_quiet = false;  // Quiet, no summary report
         // Slow path
         int8_t m_timeunit;  // Time unit as 0..15
@@ -429,10 +525,14 @@ protected:
         // Fast path
         uint64_t m_profExecStart = 1;  // +prof+exec+start time
         uint32_t m_profExecWindow = 2;  // +prof+exec+window size
+        uint32_t m_solverBatch = 1;  // +solver+batch solutions per solver query
         // Slow path
+        bool m_coverageBinary = false;  // +coverage+binary
+        bool m_profExecCounters = false;  // +prof+exec+counters
         std::string m_coverageFilename;  // +coverage+file filename
         std::string m_profExecFilename;  // +prof+exec+file filename
         std::string m_profVltFilename;  // +prof+vlt filename
+        std::string m_profBlocksFilename;  // +prof+blocks filename
         std::string m_solverProgram;  // SMT solver program
         VlOs::DeltaCpuTime m_cpuTimeStart{false};  // CPU time, starts when create first model
         VlOs::DeltaWallTime m_wallTimeStart{false};  // Wall time, starts when create first model
@@ -454,12 +554,20 @@ protected:
     unsigned m_threads = std::thread::hardware_concurrency();
     // Number of threads in added models
     unsigned m_threadsInModels = 0;
-    // The thread pool shared by all models added to this context
-    std::unique_ptr<VerilatedVirtualBase> m_threadPool;
+    // Idle thread pool workers steal tasks from busy workers
+    bool m_threadsSteal = false;
+    // Threads waiting on mtask dependencies sleep instead of yielding
+    bool m_threadsPark = false;
+    // Evaluations between re-partitioning mtasks, with --threads-rebalance, 0 is never
+    std::atomic<uint32_t> m_threadsRebalance{1000};
+    // The thread pool shared by all models added to this context, and possibly other contexts
+    std::shared_ptr<VerilatedVirtualBase> m_threadPool;
     // The execution profiler shared by all models added to this context
     std::unique_ptr<VerilatedVirtualBase> m_executionProfiler;
     // Coverage access
     std::unique_ptr<VerilatedVirtualBase> m_coveragep;  // Pointer for coveragep()
+    // Runtime performance counters, updated with --perf-stats
+    VerilatedPerfCounters m_perfCounters;
 
     // File I/O
     // Not serialized
@@ -546,6 +654,11 @@ public:
     bool gotFinish() const VL_MT_SAFE { return m_s.m_gotFinish; }
     /// Set if got a $finish or $stop/error
     void gotFinish(bool flag) VL_MT_SAFE;
+    /// Return if huge page allocation of model state enabled
+    bool hugePages() const VL_MT_SAFE { return m_s.m_hugePages; }
+    /// Enable allocating the state of models created afterwards from
+    /// transparent huge pages, where supported by the operating system
+    void hugePages(bool flag) VL_MT_SAFE;
     /// Return if quiet enabled
     bool quiet() const VL_MT_SAFE { return m_s.m_quiet; }
     /// Enable quiet (also prevents need for OS calls to get CPU time)
@@ -568,6 +681,9 @@ public:
     double statWallTimeSinceStart() const VL_MT_SAFE_EXCLUDES(m_mutex);
     /// Print statistics summary (if not quiet)
     void statsPrintSummary() VL_MT_UNSAFE;
+    /// Return snapshot of runtime performance counters, for models Verilated with
+    /// --perf-stats. Cheap enough to poll periodically, e.g. from a metrics exporter.
+    VerilatedPerfStats perfStats() const VL_MT_SAFE { return m_perfCounters.snapshot(); }
 
     // Time handling
     /// Returns current simulation time in units of timeprecision().
@@ -617,6 +733,32 @@ public:
     /// Set number of threads used for simulation (including the main thread)
     /// Can only be called before the thread pool is created (before first model is added).
     void threads(unsigned n);
+    /// Get if idle simulation threads may steal scheduled work from busy threads
+    bool threadsSteal() const { return m_threadsSteal; }
+    /// Set if idle simulation threads may steal scheduled work from busy threads.
+    /// Can only be called before the thread pool is created (before first model is added).
+    void threadsSteal(bool flag);
+    /// Get if simulation threads sleep in the OS when waiting for other threads
+    bool threadsPark() const { return m_threadsPark; }
+    /// Set if simulation threads, after spinning for a while, sleep in the OS when waiting
+    /// for other threads, instead of repeatedly yielding. This is better when the host is
+    /// oversubscribed. Can only be called before the thread pool is created.
+    void threadsPark(bool flag);
+    /// Get evaluations between re-partitioning mtasks among threads (with --threads-rebalance)
+    uint32_t threadsRebalance() const VL_MT_SAFE {
+        return m_threadsRebalance.load(std::memory_order_relaxed);
+    }
+    /// Set evaluations between re-partitioning mtasks among threads using their measured
+    /// costs, for models Verilated with --threads-rebalance. Zero keeps the Verilated schedule.
+    void threadsRebalance(uint32_t evals) VL_MT_SAFE {
+        m_threadsRebalance.store(evals, std::memory_order_relaxed);
+    }
+    /// Use the thread pool of another context, instead of creating a thread pool for this
+    /// context. Models in all contexts sharing the pool take turns to use the pool threads,
+    /// in a first come first served order, which avoids oversubscribing the host when running
+    /// many models. Also sets threads() to match the other context.
+    /// Can only be called before the thread pool is created (before first model is added).
+    void threadPoolShare(VerilatedContext& other);
 
     /// Trace signals in models within the context; called by application code
     void trace(VerilatedTraceBaseC* tfp, int levels, int options = 0);
@@ -652,6 +794,8 @@ public:
     enableExecutionProfiler(VerilatedVirtualBase* (*construct)(VerilatedContext&));
 
     // Internal: coverage
+    bool coverageBinary() const VL_MT_SAFE;
+    void coverageBinary(bool flag) VL_MT_SAFE;
     std::string coverageFilename() const VL_MT_SAFE;
     void coverageFilename(const std::string& flag) VL_MT_SAFE;
 
@@ -667,12 +811,22 @@ public:
     void profExecWindow(uint64_t flag) VL_MT_SAFE;
     std::string profExecFilename() const VL_MT_SAFE;
     void profExecFilename(const std::string& flag) VL_MT_SAFE;
+    bool profExecCounters() const VL_MT_SAFE { return m_ns.m_profExecCounters; }
+    void profExecCounters(bool flag) VL_MT_SAFE;
     std::string profVltFilename() const VL_MT_SAFE;
     void profVltFilename(const std::string& flag) VL_MT_SAFE;
+    std::string profBlocksFilename() const VL_MT_SAFE;
+    void profBlocksFilename(const std::string& flag) VL_MT_SAFE;
+
+    // Internal: --perf-stats counters
+    VerilatedPerfCounters& perfCounters() VL_MT_SAFE { return m_perfCounters; }
 
     // Internal: SMT solver program
     std::string solverProgram() const VL_MT_SAFE;
     void solverProgram(const std::string& flag) VL_MT_SAFE;
+    // Internal: Solutions to solve ahead per solver query
+    uint32_t solverBatch() const VL_MT_SAFE { return m_ns.m_solverBatch; }
+    void solverBatch(uint32_t flag) VL_MT_SAFE;
 
     // Internal: Find scope
     const VerilatedScope* scopeFind(const char* namep) const VL_MT_SAFE;
@@ -703,6 +857,24 @@ public:  // But for internal use only
     explicit VerilatedSyms(VerilatedContext* contextp);  // Pass null for default context
     ~VerilatedSyms();
     VL_UNCOPYABLE(VerilatedSyms);
+    // Zeroed, cache line aligned allocation of the Syms class, from huge
+    // pages if contextp->hugePages()
+    static void* allocZeroed(size_t size, VerilatedContext* contextp);
+    static void freeZeroed(void* ptr) VL_MT_SAFE;
+};
+
+//===========================================================================
+// Static description of a public variable, as emitted by Verilator into
+// constant tables that VerilatedScope::varsInsert() reads
+
+struct VerilatedVarDecl final {
+    const char* m_namep;  // Name
+    VerilatedVarType m_vltype;  // Data type
+    int m_vlflags;  // Direction and flags (VerilatedVarFlags)
+    bool m_isParam;  // Is a parameter
+    int m_udims;  // Number of unpacked dimensions
+    int m_pdims;  // Number of packed dimensions
+    const int* m_rangesp;  // Left and right of each unpacked, then packed dimension
 };
 
 //===========================================================================
@@ -738,6 +910,9 @@ public:  // But internals only - called from VerilatedModule's
     void exportInsert(int finalize, const char* namep, void* cb) VL_MT_UNSAFE;
     void varInsert(int finalize, const char* namep, void* datap, bool isParam,
                    VerilatedVarType vltype, int vlflags, int udims, int pdims, ...) VL_MT_UNSAFE;
+    // Insert 'count' variables from a constant table, best sorted by name
+    void varsInsert(int finalize, const VerilatedVarDecl* declsp, void* const* datapp,
+                    size_t count) VL_MT_UNSAFE;
     // ACCESSORS
     const char* name() const VL_MT_SAFE_POSTINIT { return m_namep; }
     const char* identifier() const VL_MT_SAFE_POSTINIT { return m_identifierp; }
@@ -792,6 +967,7 @@ class Verilated final {
         // Fast path
         VerilatedContext* t_contextp = nullptr;  // Thread's context
         uint32_t t_mtaskId = 0;  // mtask# executing on this thread
+        uint32_t t_workerIndex = 0;  // Thread pool worker index + 1, 0 if not a worker
         // Messages maybe pending on thread, needs end-of-eval calls
         uint32_t t_endOfEvalReqd = 0;
         const VerilatedScope* t_dpiScopep = nullptr;  // DPI context scope
@@ -1008,6 +1184,9 @@ public:
     // Per thread, so no need to be in VerilatedContext
     static uint32_t mtaskId() VL_MT_SAFE { return t_s.t_mtaskId; }
     static void mtaskId(uint32_t id) VL_MT_SAFE { t_s.t_mtaskId = id; }
+    // Internal: Thread pool worker index + 1, or 0 if not a worker, set when the worker starts
+    static uint32_t workerIndex() VL_MT_SAFE { return t_s.t_workerIndex; }
+    static void workerIndex(uint32_t index) VL_MT_SAFE { t_s.t_workerIndex = index; }
     static void endOfEvalReqdInc() VL_MT_SAFE { ++t_s.t_endOfEvalReqd; }
     static void endOfEvalReqdDec() VL_MT_SAFE { --t_s.t_endOfEvalReqd; }
 
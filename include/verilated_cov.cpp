@@ -28,10 +28,13 @@
 #include "verilated.h"
 #include "verilated_cov_key.h"
 
+#include <algorithm>
 #include <deque>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 //=============================================================================
 // VerilatedCovConst
@@ -63,6 +66,7 @@ public:  // But only local to this file
     virtual ~VerilatedCovImpItem() = default;
     virtual uint64_t count() const = 0;
     virtual void zero() const = 0;
+    virtual void add(uint64_t value) const = 0;
 };
 
 //=============================================================================
@@ -81,6 +85,7 @@ public:
     // cppcheck-suppress truncLongCastReturn
     uint64_t count() const override { return *m_countp; }
     void zero() const override { *m_countp = 0; }
+    void add(uint64_t value) const override { *m_countp += static_cast<T>(value); }
     // CONSTRUCTORS
     // cppcheck-suppress noExplicitConstructor
     explicit VerilatedCoverItemSpec(T* countp)
@@ -101,22 +106,21 @@ public:
 class VerilatedCovImp final : public VerilatedCovContext {
 private:
     // TYPES
-    using ValueIndexMap = std::map<const std::string, int>;
-    using IndexValueMap = std::map<int, std::string>;
+    using ValueIndexMap = std::unordered_map<std::string, int>;
+    using IndexValueMap = std::vector<std::string>;
     using ItemList = std::deque<VerilatedCovImpItem*>;
 
     // MEMBERS
     VerilatedContext* const m_contextp;  // Context VerilatedCovImp is pointed-to by
     mutable VerilatedMutex m_mutex;  // Protects all members
     ValueIndexMap m_valueIndexes VL_GUARDED_BY(m_mutex);  // Unique arbitrary value for values
-    IndexValueMap m_indexValues VL_GUARDED_BY(m_mutex);  // Unique arbitrary value for keys
+    IndexValueMap m_indexValues VL_GUARDED_BY(m_mutex);  // Value of each index
     ItemList m_items VL_GUARDED_BY(m_mutex);  // List of all items
     int m_nextIndex VL_GUARDED_BY(m_mutex)
         = (VerilatedCovConst::KEY_UNDEF + 1);  // Next insert value
+    std::vector<VlCoverShadow*> m_shadows VL_GUARDED_BY(m_mutex);  // Per-thread counters
+    std::vector<uint64_t> m_snapshot VL_GUARDED_BY(m_mutex);  // Bit per item hit at snapshot()
 
-    VerilatedCovImpItem* m_insertp VL_GUARDED_BY(m_mutex) = nullptr;  // Item about to insert
-    const char* m_insertFilenamep VL_GUARDED_BY(m_mutex) = nullptr;  // Filename about to insert
-    int m_insertLineno VL_GUARDED_BY(m_mutex) = 0;  // Line number about to insert
     bool m_forcePerInstance VL_GUARDED_BY(m_mutex) = false;  // Force per_instance
 
 public:
@@ -137,9 +141,17 @@ private:
         ++m_nextIndex;
         assert(m_nextIndex > 0);  // Didn't rollover
         m_valueIndexes.emplace(value, m_nextIndex);
-        m_indexValues.emplace(m_nextIndex, value);
+        if (m_indexValues.size() <= static_cast<size_t>(m_nextIndex)) {
+            m_indexValues.resize(m_nextIndex + 1);
+        }
+        m_indexValues[m_nextIndex] = value;
         return m_nextIndex;
     }
+    const std::string& indexValue(int index) const VL_REQUIRES(m_mutex) {
+        static const std::string s_empty;
+        if (VL_UNLIKELY(static_cast<size_t>(index) >= m_indexValues.size())) return s_empty;
+        return m_indexValues[index];
+    }
     static std::string dequote(const std::string& text) VL_PURE {
         // Quote any special characters
         std::string rtn;
@@ -221,7 +233,7 @@ private:
         for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
             if (itemp->m_keys[i] != VerilatedCovConst::KEY_UNDEF) {
                 // We don't compare keys, only values
-                const std::string val = m_indexValues[itemp->m_vals[i]];
+                const std::string& val = indexValue(itemp->m_vals[i]);
                 if (std::string::npos != val.find(match)) {  // Found
                     return true;
                 }
@@ -245,9 +257,13 @@ private:
         SELF_CHECK(combineHier("1.2.3.a", "9.8.7.a"), "*.a");
 #undef SELF_CHECK
     }
+    void reduceShadows() VL_REQUIRES(m_mutex) {
+        for (VlCoverShadow* const shadowp : m_shadows) shadowp->reduce();
+    }
     void clearGuts() VL_REQUIRES(m_mutex) {
         for (const auto& itemp : m_items) VL_DO_DANGLING(delete itemp, itemp);
         m_items.clear();
+        m_snapshot.clear();
         m_indexValues.clear();
         m_valueIndexes.clear();
         m_nextIndex = VerilatedCovConst::KEY_UNDEF + 1;
@@ -279,37 +295,122 @@ public:
                 }
             }
             m_items = newlist;
+            m_snapshot.clear();
         }
     }
     void zero() VL_MT_SAFE_EXCLUDES(m_mutex) {
         Verilated::quiesce();
         const VerilatedLockGuard lock{m_mutex};
+        reduceShadows();
         for (const auto& itemp : m_items) itemp->zero();
     }
-
-    // We assume there's always call to i/f/p in that order
-    void inserti(VerilatedCovImpItem* itemp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    void snapshot() VL_MT_SAFE_EXCLUDES(m_mutex) {
         const VerilatedLockGuard lock{m_mutex};
-        assert(!m_insertp);
-        m_insertp = itemp;
+        reduceShadows();
+        m_snapshot.assign((m_items.size() + 63) / 64, 0);
+        for (size_t i = 0; i < m_items.size(); ++i) {
+            if (m_items[i]->count()) m_snapshot[i / 64] |= 1ULL << (i % 64);
+        }
     }
-    void insertf(const char* const filenamep, const int lineno) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    uint64_t newPointsHit() VL_MT_SAFE_EXCLUDES(m_mutex) {
         const VerilatedLockGuard lock{m_mutex};
-        m_insertFilenamep = filenamep;
-        m_insertLineno = lineno;
+        reduceShadows();
+        uint64_t hit = 0;
+        for (size_t i = 0; i < m_items.size(); ++i) {
+            if (i / 64 < m_snapshot.size() && (m_snapshot[i / 64] >> (i % 64)) & 1) continue;
+            if (m_items[i]->count()) ++hit;
+        }
+        return hit;
+    }
+    // Return string identifying an item across contexts
+    std::string itemKey(const VerilatedCovImpItem* itemp) const VL_REQUIRES(m_mutex) {
+        std::string key;
+        for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
+            if (itemp->m_keys[i] == VerilatedCovConst::KEY_UNDEF) continue;
+            key += indexValue(itemp->m_keys[i]);
+            key += '\001';
+            key += indexValue(itemp->m_vals[i]);
+            key += '\002';
+        }
+        return key;
+    }
+    // Return key and count of each item hit, for merge()
+    std::vector<std::pair<std::string, uint64_t>> hitItems() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        reduceShadows();
+        std::vector<std::pair<std::string, uint64_t>> result;
+        for (const auto& itemp : m_items) {
+            if (const uint64_t count = itemp->count()) result.emplace_back(itemKey(itemp), count);
+        }
+        return result;
+    }
+    void merge(VerilatedCovImp* fromp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        if (fromp == this) return;
+        // Take each lock in turn, so merges in both directions can't deadlock
+        const std::vector<std::pair<std::string, uint64_t>> hits = fromp->hitItems();
+        if (hits.empty()) return;
+        const VerilatedLockGuard lock{m_mutex};
+        reduceShadows();
+        std::unordered_map<std::string, VerilatedCovImpItem*> itemps;
+        itemps.reserve(m_items.size());
+        for (const auto& itemp : m_items) itemps.emplace(itemKey(itemp), itemp);
+        for (const auto& hit : hits) {
+            const auto it = itemps.find(hit.first);
+            if (it != itemps.end()) it->second->add(hit.second);
+        }
+    }
+    void counts(std::vector<uint64_t>& countsr) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        reduceShadows();
+        countsr.resize(m_items.size());
+        for (size_t i = 0; i < m_items.size(); ++i) countsr[i] = m_items[i]->count();
+    }
+    void insertShadow(VlCoverShadow* shadowp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        m_shadows.push_back(shadowp);
+    }
+    void removeShadow(VlCoverShadow* shadowp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        m_shadows.erase(std::remove(m_shadows.begin(), m_shadows.end(), shadowp),
+                        m_shadows.end());
+    }
+
+    // Item being inserted by this thread.  Only insertp() needs the lock, so
+    // models constructed in parallel only serialize when indexing the values.
+    struct InsertState final {
+        VerilatedCovImpItem* m_itemp = nullptr;  // Item about to insert
+        const char* m_filenamep = nullptr;  // Filename about to insert
+        int m_lineno = 0;  // Line number about to insert
+    };
+    static InsertState& insertState() VL_MT_SAFE {
+        static thread_local InsertState t_state;
+        return t_state;
+    }
+
+    // We assume there's always call to i/f/p in that order
+    void inserti(VerilatedCovImpItem* itemp) VL_MT_SAFE {
+        InsertState& state = insertState();
+        assert(!state.m_itemp);
+        state.m_itemp = itemp;
+    }
+    void insertf(const char* const filenamep, const int lineno) VL_MT_SAFE {
+        InsertState& state = insertState();
+        state.m_filenamep = filenamep;
+        state.m_lineno = lineno;
     }
     void insertp(const char* ckeyps[VerilatedCovConst::MAX_KEYS],
                  const char* valps[VerilatedCovConst::MAX_KEYS]) VL_MT_SAFE_EXCLUDES(m_mutex) {
-        const VerilatedLockGuard lock{m_mutex};
-        assert(m_insertp);
+        InsertState& state = insertState();
+        VerilatedCovImpItem* const insertp = state.m_itemp;
+        assert(insertp);
         // First two key/vals are filename
         ckeyps[0] = "filename";
-        valps[0] = m_insertFilenamep;
-        const std::string linestr = std::to_string(m_insertLineno);
+        valps[0] = state.m_filenamep;
+        const std::string linestr = std::to_string(state.m_lineno);
         ckeyps[1] = "lineno";
         valps[1] = linestr.c_str();
         // Default page if not specified
-        const char* fnstartp = m_insertFilenamep;
+        const char* fnstartp = state.m_filenamep;
         while (const char* foundp = std::strchr(fnstartp, '/')) fnstartp = foundp + 1;
         const char* fnendp = fnstartp;
         for (; *fnendp && *fnendp != '.'; ++fnendp) {}
@@ -334,34 +435,44 @@ public:
                 }
             }
         }
+        for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
+            if (VL_UNCOVERABLE(!keys[i].empty() && !legalKey(keys[i]))) {
+                const std::string msg
+                    = ("%Error: Coverage keys of one character, or letter+digit are illegal: "
+                       + keys[i]);  // LCOV_EXCL_LINE
+                VL_FATAL_MT("", 0, "", msg.c_str());
+            }
+        }
         // Insert the values
+        const VerilatedLockGuard lock{m_mutex};
         int addKeynum = 0;
         for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
-            const std::string key = keys[i];
             if (!keys[i].empty()) {
-                const std::string val = valps[i];
-                // std::cout << "   " << __FUNCTION__ << "  " << key << " = " << val << "\n";
-                m_insertp->m_keys[addKeynum] = valueIndex(key);
-                m_insertp->m_vals[addKeynum] = valueIndex(val);
+                insertp->m_keys[addKeynum] = valueIndex(keys[i]);
+                insertp->m_vals[addKeynum] = valueIndex(valps[i]);
                 ++addKeynum;
-                if (VL_UNCOVERABLE(!legalKey(key))) {
-                    const std::string msg
-                        = ("%Error: Coverage keys of one character, or letter+digit are illegal: "
-                           + key);  // LCOV_EXCL_LINE
-                    VL_FATAL_MT("", 0, "", msg.c_str());
-                }
             }
         }
-        m_items.push_back(m_insertp);
+        m_items.push_back(insertp);
         // Prepare for next
-        m_insertp = nullptr;
+        state.m_itemp = nullptr;
     }
 
     void write(const std::string& filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
         Verilated::quiesce();
         const VerilatedLockGuard lock{m_mutex};
         selftest();
+        reduceShadows();
 
+        if (m_contextp->coverageBinary()) {
+            writeBinary(filename);
+        } else {
+            writeText(filename);
+        }
+    }
+
+private:
+    void writeText(const std::string& filename) VL_REQUIRES(m_mutex) {
         std::ofstream os{filename};
         if (os.fail()) {
             const std::string msg = "%Error: Can't write '"s + filename + "'";
@@ -381,8 +492,8 @@ public:
             for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
                 if (itemp->m_keys[i] != VerilatedCovConst::KEY_UNDEF) {
                     const std::string key
-                        = VerilatedCovKey::shortKey(m_indexValues[itemp->m_keys[i]]);
-                    const std::string val = m_indexValues[itemp->m_vals[i]];
+                        = VerilatedCovKey::shortKey(indexValue(itemp->m_keys[i]));
+                    const std::string& val = indexValue(itemp->m_vals[i]);
                     if (key == VL_CIK_PER_INSTANCE) {
                         if (val != "0") per_instance = true;
                     }
@@ -428,6 +539,120 @@ public:
             os << '\n';
         }
     }
+
+    // Binary format, all integers in host byte order:
+    //   VL_COV_BINARY_MAGIC
+    //   uint64_t number of strings, then per string: uint32_t length, characters
+    //   uint64_t number of points, then per point: uint32_t number of strings,
+    //            uint32_t index of each string, uint64_t count
+    // Each string is one formatted key/value pair, so a point's name, as written
+    // by writeText, is the concatenation of its strings.
+    void writeBinary(const std::string& filename) VL_REQUIRES(m_mutex) {
+        // Formatted key/value pair strings, and index for each
+        std::vector<std::string> strings;
+        std::unordered_map<std::string, uint32_t> stringIndexes;
+        const auto stringIndex = [&](const std::string& key, const std::string& val) {
+            std::string str = keyValueFormatter(key, val);
+            const auto pair = stringIndexes.emplace(str, static_cast<uint32_t>(strings.size()));
+            if (pair.second) strings.emplace_back(std::move(str));
+            return pair.first->second;
+        };
+        // What each key/value pair contributes to a point, formatted once per pair
+        struct PairInfo final {
+            uint32_t m_typeIndex;  // String index of type, if a page, else NO_INDEX
+            uint32_t m_index;  // String index, unless is hier
+            bool m_hier;  // Is hier
+            bool m_perInstance;  // Is per_instance and not 0
+        };
+        constexpr uint32_t NO_INDEX = ~0U;
+        std::map<std::pair<int, int>, PairInfo> pairInfos;
+        const auto pairInfo = [&](int keyIndex, int valIndex) -> const PairInfo& {
+            const auto it = pairInfos.find({keyIndex, valIndex});
+            if (it != pairInfos.end()) return it->second;
+            const std::string key = VerilatedCovKey::shortKey(indexValue(keyIndex));
+            const std::string& val = indexValue(valIndex);
+            PairInfo info{NO_INDEX, NO_INDEX, key == VL_CIK_HIER,
+                          key == VL_CIK_PER_INSTANCE && val != "0"};
+            if (!info.m_hier) {
+                if (key == "page") {
+                    info.m_typeIndex
+                        = stringIndex(VL_CIK_TYPE, val.substr(2, val.find('/') - 2));
+                }
+                info.m_index = stringIndex(key, val);
+            }
+            return pairInfos.emplace(std::make_pair(keyIndex, valIndex), info).first->second;
+        };
+
+        // Build list of events; totalize if collapsing hierarchy, as writeText does
+        std::map<std::vector<uint32_t>, std::pair<std::string, uint64_t>> eventCounts;
+        std::vector<uint32_t> name;
+        for (const auto& itemp : m_items) {
+            name.clear();
+            int hierIndex = VerilatedCovConst::KEY_UNDEF;
+            bool per_instance = m_forcePerInstance;
+            for (int i = 0; i < VerilatedCovConst::MAX_KEYS; ++i) {
+                if (itemp->m_keys[i] == VerilatedCovConst::KEY_UNDEF) continue;
+                const PairInfo& info = pairInfo(itemp->m_keys[i], itemp->m_vals[i]);
+                if (info.m_perInstance) per_instance = true;
+                if (info.m_hier) {
+                    hierIndex = itemp->m_vals[i];
+                } else {
+                    if (info.m_typeIndex != NO_INDEX) name.push_back(info.m_typeIndex);
+                    name.push_back(info.m_index);
+                }
+            }
+            const std::string hier = hierIndex == VerilatedCovConst::KEY_UNDEF
+                                         ? ""
+                                         : indexValue(hierIndex);
+            if (per_instance) name.push_back(stringIndex(VL_CIK_HIER, hier));
+            const auto cit = eventCounts.find(name);
+            if (cit != eventCounts.end()) {
+                cit->second.second += itemp->count();
+                if (!per_instance) cit->second.first = combineHier(cit->second.first, hier);
+            } else {
+                eventCounts.emplace(name, std::make_pair(per_instance ? "" : hier,
+                                                         itemp->count()));
+            }
+        }
+        // Combined hierarchies become strings too
+        std::vector<uint32_t> hierIndexes;
+        hierIndexes.reserve(eventCounts.size());
+        for (const auto& i : eventCounts) {
+            hierIndexes.push_back(i.second.first.empty() ? NO_INDEX
+                                                         : stringIndex(VL_CIK_HIER,
+                                                                       i.second.first));
+        }
+
+        // Serialize to memory, then write with a single call
+        std::string buf{VL_COV_BINARY_MAGIC};
+        const auto put32 = [&](uint32_t value) {
+            buf.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+        const auto put64 = [&](uint64_t value) {
+            buf.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+        put64(strings.size());
+        for (const std::string& str : strings) {
+            put32(static_cast<uint32_t>(str.size()));
+            buf += str;
+        }
+        put64(eventCounts.size());
+        auto hierIt = hierIndexes.cbegin();
+        for (const auto& i : eventCounts) {
+            const uint32_t hierIndex = *hierIt++;
+            put32(static_cast<uint32_t>(i.first.size() + (hierIndex != NO_INDEX ? 1 : 0)));
+            for (const uint32_t index : i.first) put32(index);
+            if (hierIndex != NO_INDEX) put32(hierIndex);
+            put64(i.second.second);
+        }
+
+        std::ofstream os{filename, std::ios::binary};
+        if (!os.fail()) os.write(buf.data(), buf.size());
+        if (os.fail()) {
+            const std::string msg = "%Error: Can't write '"s + filename + "'";
+            VL_FATAL_MT("", 0, "", msg.c_str());
+        }
+    }
 };
 
 //=============================================================================
@@ -442,6 +667,14 @@ void VerilatedCovContext::clearNonMatch(const char* matchp) VL_MT_SAFE {
     impp()->clearNonMatch(matchp);
 }
 void VerilatedCovContext::zero() VL_MT_SAFE { impp()->zero(); }
+void VerilatedCovContext::snapshot() VL_MT_SAFE { impp()->snapshot(); }
+uint64_t VerilatedCovContext::newPointsHit() VL_MT_SAFE { return impp()->newPointsHit(); }
+void VerilatedCovContext::merge(VerilatedCovContext* fromp) VL_MT_SAFE {
+    impp()->merge(fromp->impp());
+}
+void VerilatedCovContext::counts(std::vector<uint64_t>& countsr) VL_MT_SAFE {
+    impp()->counts(countsr);
+}
 void VerilatedCovContext::write(const std::string& filename) VL_MT_SAFE {
     impp()->write(filename);
 }
@@ -454,6 +687,12 @@ void VerilatedCovContext::_inserti(uint64_t* itemp) VL_MT_SAFE {
 void VerilatedCovContext::_insertf(const char* filename, int lineno) VL_MT_SAFE {
     impp()->insertf(filename, lineno);
 }
+void VerilatedCovContext::_insertShadow(VlCoverShadow* shadowp) VL_MT_SAFE {
+    impp()->insertShadow(shadowp);
+}
+void VerilatedCovContext::_removeShadow(VlCoverShadow* shadowp) VL_MT_SAFE {
+    impp()->removeShadow(shadowp);
+}
 
 #ifndef DOXYGEN
 #define K(n) const char* key##n
@@ -507,6 +746,38 @@ void VerilatedCovContext::_insertp(A(0), A(1), K(2), int val2, K(3), int val3, K
 
 #endif  // DOXYGEN
 
+//=============================================================================
+// VlCoverShadow
+
+VlCoverShadow::VlCoverShadow(VerilatedCovContext* covp, uint32_t* countsp, size_t bins,
+                             size_t copies) VL_MT_SAFE
+    : m_covp{covp}
+    , m_countsp{countsp}
+    , m_bins{bins}
+    , m_stride{(bins + PER_LINE - 1) / PER_LINE * PER_LINE}
+    , m_copies{copies} {
+    m_storagep = new uint32_t[m_stride * m_copies + PER_LINE]();
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(m_storagep);
+    const uintptr_t skew = addr % VL_CACHE_LINE_BYTES;
+    m_copiesp = m_storagep + (skew ? (VL_CACHE_LINE_BYTES - skew) / sizeof(uint32_t) : 0);
+    m_covp->_insertShadow(this);
+}
+
+VlCoverShadow::~VlCoverShadow() VL_MT_SAFE {
+    m_covp->_removeShadow(this);
+    delete[] m_storagep;
+}
+
+void VlCoverShadow::reduce() VL_MT_UNSAFE {
+    for (size_t copy = 0; copy < m_copies; ++copy) {
+        uint32_t* const copyp = m_copiesp + copy * m_stride;
+        for (size_t bin = 0; bin < m_bins; ++bin) {
+            m_countsp[bin] += copyp[bin];
+            copyp[bin] = 0;
+        }
+    }
+}
+
 //=============================================================================
 // VerilatedCov
 
@@ -32,8 +32,10 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 class VerilatedCovImp;
+class VlCoverShadow;
 
 //=============================================================================
 /// Insert an item for coverage analysis.
@@ -75,57 +77,72 @@ class VerilatedCovImp;
         ccontextp->_insertp("hier", name, __VA_ARGS__); \
     } while (false)
 
+// Internal: Lowest set bit number in a non-zero value
+static inline int vlCovLowestSetBit(QData bits) VL_PURE {
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS)
+    return __builtin_ctzll(bits);
+#else
+    int n = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+// Internal: Increment the counter of each set bit in 'changed'.  Only the
+// changed bits are visited, so a word with a single toggle is one increment.
+static inline void vlCovToggleBits(uint32_t* covp, QData changed) {
+    while (changed) {
+        ++covp[vlCovLowestSetBit(changed)];
+        changed &= changed - 1;  // Clear lowest set bit
+    }
+}
+static inline void vlCovToggleBits(std::atomic<uint32_t>* covp, QData changed) VL_MT_SAFE {
+    while (changed) {
+        covp[vlCovLowestSetBit(changed)].fetch_add(1, std::memory_order_relaxed);
+        changed &= changed - 1;  // Clear lowest set bit
+    }
+}
+
 static inline void VL_COV_TOGGLE_CHG_ST_I(const int width, uint32_t* covp, const IData newData,
                                           const IData oldData) {
-    for (int i = 0; i < width; ++i) *(covp + i) += ((newData ^ oldData) >> i) & 1;
+    vlCovToggleBits(covp, (newData ^ oldData) & VL_MASK_I(width));
 }
 
-static inline void VL_COV_TOGGLE_CHG_ST_Q(const int width, uint32_t* covp, const IData newData,
-                                          const IData oldData) {
-    for (int i = 0; i < width; ++i) *(covp + i) += ((newData ^ oldData) >> i) & 1;
+static inline void VL_COV_TOGGLE_CHG_ST_Q(const int width, uint32_t* covp, const QData newData,
+                                          const QData oldData) {
+    vlCovToggleBits(covp, (newData ^ oldData) & VL_MASK_Q(width));
 }
 
 static inline void VL_COV_TOGGLE_CHG_ST_W(const int width, uint32_t* covp, WDataInP newData,
                                           WDataInP oldData) {
-    for (int i = 0; i < VL_WORDS_I(width); ++i) {
-        const EData changed = newData[i] ^ oldData[i];
-        if (changed) {
-            for (int j = 0; j < width - i * VL_EDATASIZE; ++j) {
-                *(covp + i * VL_EDATASIZE + j) += (changed >> j) & 1;
-            }
-        }
+    const int words = VL_WORDS_I(width);
+    for (int i = 0; i < words; ++i) {
+        EData changed = newData[i] ^ oldData[i];
+        if (i == words - 1) changed &= VL_MASK_E(width);
+        vlCovToggleBits(covp + i * VL_EDATASIZE, changed);
     }
 }
 
 static inline void VL_COV_TOGGLE_CHG_MT_I(const int width, std::atomic<uint32_t>* covp,
                                           const IData newData, const IData oldData) VL_MT_SAFE {
-    for (int i = 0; i < width; ++i) {
-        if (VL_BITISSET_I((newData ^ oldData), i)) {
-            (covp + i)->fetch_add(1, std::memory_order_relaxed);
-        }
-    }
+    vlCovToggleBits(covp, (newData ^ oldData) & VL_MASK_I(width));
 }
 
 static inline void VL_COV_TOGGLE_CHG_MT_Q(const int width, std::atomic<uint32_t>* covp,
-                                          const IData newData, const IData oldData) VL_MT_SAFE {
-    for (int i = 0; i < width; ++i) {
-        if (VL_BITISSET_Q((newData ^ oldData), i)) {
-            (covp + i)->fetch_add(1, std::memory_order_relaxed);
-        }
-    }
+                                          const QData newData, const QData oldData) VL_MT_SAFE {
+    vlCovToggleBits(covp, (newData ^ oldData) & VL_MASK_Q(width));
 }
 
 static inline void VL_COV_TOGGLE_CHG_MT_W(const int width, std::atomic<uint32_t>* covp,
                                           WDataInP newData, WDataInP oldData) VL_MT_SAFE {
-    for (int i = 0; i < VL_WORDS_I(width); ++i) {
-        const EData changed = newData[i] ^ oldData[i];
-        if (changed) {
-            for (int j = 0; j < width - i * VL_EDATASIZE; ++j) {
-                if (VL_BITISSET_E(changed, j)) {
-                    (covp + i * VL_EDATASIZE + j)->fetch_add(1, std::memory_order_relaxed);
-                }
-            }
-        }
+    const int words = VL_WORDS_I(width);
+    for (int i = 0; i < words; ++i) {
+        EData changed = newData[i] ^ oldData[i];
+        if (i == words - 1) changed &= VL_MASK_E(width);
+        vlCovToggleBits(covp + i * VL_EDATASIZE, changed);
     }
 }
 
@@ -155,6 +172,17 @@ public:
     void clearNonMatch(const char* matchp) VL_MT_SAFE;
     /// Zero coverage points
     void zero() VL_MT_SAFE;
+    /// Remember which coverage points have been hit, for newPointsHit()
+    void snapshot() VL_MT_SAFE;
+    /// Return number of coverage points hit since the last snapshot(), or
+    /// hit at all if no snapshot was taken
+    uint64_t newPointsHit() VL_MT_SAFE;
+    /// Add the counts of another context's coverage points into the same
+    /// points of this context, without writing files.  Points are matched by
+    /// their keys, e.g. hierarchy and line; points this context lacks are ignored.
+    void merge(VerilatedCovContext* fromp) VL_MT_SAFE;
+    /// Set countsr to the count of each coverage point, in insertion order
+    void counts(std::vector<uint64_t>& countsr) VL_MT_SAFE;
 
     // METHODS - public but Internal use only
 
@@ -167,6 +195,9 @@ public:
     void _inserti(uint64_t* itemp) VL_MT_SAFE;
     // _insert2: Set default filename and line number
     void _insertf(const char* filename, int lineno) VL_MT_SAFE;
+    // Register per-thread counter copies, to be summed before use, see VlCoverShadow
+    void _insertShadow(VlCoverShadow* shadowp) VL_MT_SAFE;
+    void _removeShadow(VlCoverShadow* shadowp) VL_MT_SAFE;
     // _insert3: Set parameters
     // We could have just the maximum argument version, but this compiles
     // much slower (nearly 2x) than having smaller versions also.  However
@@ -202,6 +233,45 @@ protected:
     VerilatedCovImp* impp() VL_MT_SAFE { return reinterpret_cast<VerilatedCovImp*>(this); }
 };
 
+//=============================================================================
+//  VlCoverShadow
+/// Per-thread copies of a model's coverage counters, for --coverage-per-thread.
+/// Each thread increments only its own copy, which starts on its own cache
+/// line, so counting needs no atomics.  Before coverage is written or
+/// zeroed, VerilatedCovContext adds the copies into the counters the points
+/// were inserted with.
+
+class VlCoverShadow final {
+    // CONSTANTS
+    static constexpr size_t PER_LINE = VL_CACHE_LINE_BYTES / sizeof(uint32_t);
+
+    // MEMBERS
+    VerilatedCovContext* const m_covp;  // Coverage context registered with
+    uint32_t* const m_countsp;  // Counters the points were inserted with
+    const size_t m_bins;  // Number of counters
+    const size_t m_stride;  // Counters per copy, rounded up to whole cache lines
+    const size_t m_copies;  // Number of copies
+    uint32_t* m_storagep;  // Allocated storage for copies
+    uint32_t* m_copiesp;  // First copy, aligned in m_storagep
+
+    VL_UNCOPYABLE(VlCoverShadow);
+
+public:
+    // CONSTRUCTORS
+    // 'copies' must be more than the largest Verilated::workerIndex() that may count
+    VlCoverShadow(VerilatedCovContext* covp, uint32_t* countsp, size_t bins,
+                  size_t copies) VL_MT_SAFE;
+    ~VlCoverShadow() VL_MT_SAFE;
+
+    // METHODS
+    /// Return the calling thread's copy of the counters
+    uint32_t* countsp() const VL_MT_SAFE {
+        return m_copiesp + Verilated::workerIndex() * m_stride;
+    }
+    // Internal: Add copies into the counters and zero the copies, when not counting
+    void reduce() VL_MT_UNSAFE;
+};
+
 //=============================================================================
 //  VerilatedCov
 /// Coverage global class.
@@ -58,6 +58,9 @@ VLCOVGEN_ITEM("'name':'weight',      'short':'w',  'group':0, 'default':None, 'd
 #define VL_CIK_WEIGHT "w"
 // VLCOVGEN_CIK_AUTO_EDIT_END
 
+// Magic starting a binary coverage file, see +verilator+coverage+binary
+#define VL_COV_BINARY_MAGIC "VLCOVB01"
+
 //=============================================================================
 // VerilatedCovKey
 // Namespace-style static class for \internal use.
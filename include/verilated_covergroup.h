@@ -0,0 +1,255 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+///
+/// \file
+/// \brief Verilated functional coverage bins
+///
+/// This file is for inclusion by user wrapper code that collects functional
+/// coverage of a Verilated model, e.g. by sampling model outputs each clock.
+/// VlCoverpoint counts values into bins described by value ranges, and
+/// VlCoverCross counts combinations of coverpoint bins.
+///
+/// The ranges of a coverpoint are compiled into a sorted table of disjoint
+/// segments, so a sample is one binary search plus one increment per bin
+/// hit, and the counters of all bins are contiguous.  Samples may also be
+/// deferred and counted in batches, e.g. once per many clock cycles, where
+/// repeated values are looked up only once.
+///
+//*************************************************************************
+
+#ifndef VERILATOR_VERILATED_COVERGROUP_H_
+#define VERILATOR_VERILATED_COVERGROUP_H_
+
+#include "verilatedos.h"
+
+#include "verilated_cov.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//=============================================================================
+// VlCoverpoint
+/// Bins of one coverpoint over integral T_Value.  A value increments every
+/// bin with a range containing it, as with overlapping SystemVerilog bins.
+
+template <class T_Value>
+class VlCoverpoint final {
+    static_assert(std::is_integral<T_Value>::value, "VlCoverpoint values must be integral");
+
+    // TYPES
+    struct Range final {
+        T_Value m_lo;  // Lowest value, inclusive
+        T_Value m_hi;  // Highest value, inclusive
+        uint32_t m_bin;  // Bin the range counts into
+    };
+
+    // MEMBERS
+    std::vector<std::string> m_binNames;  // Name of each bin
+    std::vector<uint32_t> m_counts;  // Hit count of each bin
+    std::vector<Range> m_ranges;  // Ranges as added
+    std::vector<T_Value> m_segLo;  // Sorted first value of each disjoint segment
+    std::vector<T_Value> m_segHi;  // Last value of each segment
+    std::vector<uint32_t> m_segBinsStart;  // Index of first m_segBins entry of each segment
+    std::vector<uint32_t> m_segBins;  // Bins of each segment, concatenated
+    std::vector<T_Value> m_pending;  // Deferred samples not yet counted
+    bool m_needBuild = false;  // Ranges changed since segments were built
+
+public:
+    // CONSTRUCTORS
+    VlCoverpoint() = default;
+    VL_UNCOPYABLE(VlCoverpoint);
+
+private:
+    // PRIVATE METHODS
+    void build() {
+        // Segment boundaries are the start of each range and the value after its end
+        std::vector<T_Value> starts;
+        starts.reserve(m_ranges.size() * 2);
+        for (const Range& range : m_ranges) {
+            starts.push_back(range.m_lo);
+            if (range.m_hi != std::numeric_limits<T_Value>::max()) {
+                starts.push_back(static_cast<T_Value>(range.m_hi + 1));
+            }
+        }
+        std::sort(starts.begin(), starts.end());
+        starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+        m_segLo.clear();
+        m_segHi.clear();
+        m_segBinsStart.clear();
+        m_segBins.clear();
+        for (size_t i = 0; i < starts.size(); ++i) {
+            const T_Value lo = starts[i];
+            const T_Value hi = (i + 1 < starts.size()) ? static_cast<T_Value>(starts[i + 1] - 1)
+                                                       : std::numeric_limits<T_Value>::max();
+            const size_t first = m_segBins.size();
+            for (const Range& range : m_ranges) {
+                if (range.m_lo <= lo && lo <= range.m_hi) m_segBins.push_back(range.m_bin);
+            }
+            if (m_segBins.size() == first) continue;  // Hole between bins
+            m_segLo.push_back(lo);
+            m_segHi.push_back(hi);
+            m_segBinsStart.push_back(static_cast<uint32_t>(first));
+        }
+        m_segBinsStart.push_back(static_cast<uint32_t>(m_segBins.size()));
+        m_needBuild = false;
+    }
+    // Return segment containing the value, or -1 if none
+    int segment(T_Value value) {
+        if (VL_UNLIKELY(m_needBuild)) build();
+        const auto it = std::upper_bound(m_segLo.begin(), m_segLo.end(), value);
+        if (it == m_segLo.begin()) return -1;
+        const int seg = static_cast<int>(it - m_segLo.begin()) - 1;
+        return value <= m_segHi[seg] ? seg : -1;
+    }
+    void countSegment(int seg, uint32_t times) {
+        for (uint32_t i = m_segBinsStart[seg]; i < m_segBinsStart[seg + 1]; ++i) {
+            m_counts[m_segBins[i]] += times;
+        }
+    }
+
+public:
+    // METHODS
+    /// Add a bin counting values from 'lo' to 'hi' inclusive, and return its index
+    uint32_t addBin(const std::string& name, T_Value lo, T_Value hi) {
+        const uint32_t bin = static_cast<uint32_t>(m_binNames.size());
+        m_binNames.push_back(name);
+        m_counts.push_back(0);
+        addRange(bin, lo, hi);
+        return bin;
+    }
+    /// Add a bin counting a single value, and return its index
+    uint32_t addBin(const std::string& name, T_Value value) { return addBin(name, value, value); }
+    /// Add another range of values counted by an existing bin
+    void addRange(uint32_t bin, T_Value lo, T_Value hi) {
+        if (hi < lo) std::swap(lo, hi);
+        m_ranges.push_back(Range{lo, hi, bin});
+        m_needBuild = true;
+    }
+    /// Count a value, and return the number of bins it hit
+    uint32_t sample(T_Value value) {
+        const int seg = segment(value);
+        if (seg < 0) return 0;
+        countSegment(seg, 1);
+        return m_segBinsStart[seg + 1] - m_segBinsStart[seg];
+    }
+    /// Call 'f(bin)' for each bin the value falls in, without counting it
+    template <typename T_Func>
+    void foreachBin(T_Value value, T_Func f) {
+        const int seg = segment(value);
+        if (seg < 0) return;
+        for (uint32_t i = m_segBinsStart[seg]; i < m_segBinsStart[seg + 1]; ++i) f(m_segBins[i]);
+    }
+    /// Remember a value to count at the next flush()
+    void defer(T_Value value) { m_pending.push_back(value); }
+    /// Count all deferred values
+    void flush() {
+        if (m_pending.empty()) return;
+        std::sort(m_pending.begin(), m_pending.end());
+        for (size_t i = 0; i < m_pending.size();) {
+            size_t j = i + 1;
+            while (j < m_pending.size() && m_pending[j] == m_pending[i]) ++j;
+            const int seg = segment(m_pending[i]);
+            if (seg >= 0) countSegment(seg, static_cast<uint32_t>(j - i));
+            i = j;
+        }
+        m_pending.clear();
+    }
+    /// Number of bins
+    uint32_t bins() const { return static_cast<uint32_t>(m_binNames.size()); }
+    /// Name of a bin
+    const std::string& binName(uint32_t bin) const { return m_binNames[bin]; }
+    /// Hit count of a bin
+    uint32_t count(uint32_t bin) const { return m_counts[bin]; }
+    /// Number of bins hit at least once
+    uint32_t binsHit() const {
+        uint32_t hit = 0;
+        for (const uint32_t count : m_counts) hit += count != 0;
+        return hit;
+    }
+    /// Percentage of bins hit, as by get_coverage()
+    double coverage() const { return bins() ? 100.0 * binsHit() / bins() : 0.0; }
+    /// Zero all counts
+    void zero() { std::fill(m_counts.begin(), m_counts.end(), 0); }
+    /// Add each bin to the coverage database as a point, so coverage.dat
+    /// includes it.  Call after all bins are added, as adding a bin may move
+    /// the counters.  Counts from earlier samples are kept.
+    void insertCoverage(VerilatedCovContext* covp, const char* hierp, const char* namep,
+                        const char* filenamep = "", int lineno = 0) {
+        flush();
+        const std::string page = std::string{"v_covergroup/"} + namep;
+        for (uint32_t bin = 0; bin < bins(); ++bin) {
+            const std::string comment = std::string{namep} + "." + m_binNames[bin];
+            covp->_inserti(&m_counts[bin]);
+            covp->_insertf(filenamep, lineno);
+            covp->_insertp("hier", hierp, "page", page.c_str(), "comment", comment.c_str());
+        }
+    }
+};
+
+//=============================================================================
+// VlCoverCross
+/// Cross of coverpoint bins.  Only combinations that have been hit are
+/// stored, so large crosses cost memory proportional to what is sampled.
+
+class VlCoverCross final {
+    // MEMBERS
+    std::vector<uint32_t> m_dims;  // Number of bins of each crossed coverpoint
+    std::unordered_map<uint64_t, uint32_t> m_counts;  // Hit count of each combination hit
+
+public:
+    // CONSTRUCTORS
+    /// Create a cross of coverpoints with the given numbers of bins
+    explicit VlCoverCross(std::vector<uint32_t> dims)
+        : m_dims{std::move(dims)} {}
+    VL_UNCOPYABLE(VlCoverCross);
+
+private:
+    // PRIVATE METHODS
+    uint64_t key(const uint32_t* binps) const {
+        uint64_t result = 0;
+        for (size_t i = 0; i < m_dims.size(); ++i) result = result * m_dims[i] + binps[i];
+        return result;
+    }
+
+public:
+    // METHODS
+    /// Count a combination, given one bin index per crossed coverpoint
+    void sample(const uint32_t* binps) { ++m_counts[key(binps)]; }
+    void sample(std::initializer_list<uint32_t> bins) { sample(bins.begin()); }
+    /// Hit count of a combination
+    uint32_t count(const uint32_t* binps) const {
+        const auto it = m_counts.find(key(binps));
+        return it == m_counts.end() ? 0 : it->second;
+    }
+    uint32_t count(std::initializer_list<uint32_t> bins) const { return count(bins.begin()); }
+    /// Number of possible combinations
+    uint64_t bins() const {
+        uint64_t total = 1;
+        for (const uint32_t dim : m_dims) total *= dim;
+        return total;
+    }
+    /// Number of combinations hit at least once
+    uint64_t binsHit() const { return m_counts.size(); }
+    /// Percentage of combinations hit, as by get_coverage()
+    double coverage() const { return bins() ? 100.0 * binsHit() / bins() : 0.0; }
+    /// Zero all counts
+    void zero() { m_counts.clear(); }
+};
+
+#endif  // Guard
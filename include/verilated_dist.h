@@ -0,0 +1,150 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+///
+/// \file
+/// \brief Verilated distributed simulation boundary channels
+///
+/// This file is for inclusion by user wrapper code that splits a design
+/// into partitions simulated by separate processes, typically hierarchy
+/// blocks Verilated with --lib-create or --hierarchical.  Each
+/// VlDistChannel carries the boundary signals driven by one partition to
+/// another, one frame per cycle, through POSIX shared memory.
+///
+/// When the boundary signals are registered, a partition may run ahead of
+/// its consumers by the register latency without affecting the results
+/// (conservative lookahead).  The channel depth sets this lookahead: send()
+/// only blocks once 'depth' frames are unconsumed, and the consumer must be
+/// primed with 'depth' frames holding the registers' initial values.
+///
+//*************************************************************************
+
+#ifndef VERILATOR_VERILATED_DIST_H_
+#define VERILATOR_VERILATED_DIST_H_
+
+#include "verilatedos.h"
+
+#include "verilated.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+//=============================================================================
+// VlDistChannel
+/// Single producer, single consumer channel of T_Frame boundary values
+/// between two processes.  T_Frame is a plain struct of the boundary
+/// signals, which must be trivially copyable.
+
+template <class T_Frame>
+class VlDistChannel final {
+    static_assert(std::is_trivially_copyable<T_Frame>::value,
+                  "VlDistChannel frames must be trivially copyable");
+
+    // TYPES
+    struct Shared final {
+        alignas(VL_CACHE_LINE_BYTES) std::atomic<uint64_t> m_head;  // Frames sent
+        alignas(VL_CACHE_LINE_BYTES) std::atomic<uint64_t> m_tail;  // Frames received
+        alignas(VL_CACHE_LINE_BYTES) T_Frame m_frames[1];  // 'depth' frames follow
+    };
+
+    // MEMBERS
+    const std::string m_name;  // Shared memory object name
+    const size_t m_depth;  // Frames in flight, i.e. cycles of lookahead
+    size_t m_bytes = 0;  // Size of mapping
+    Shared* m_sharedp = nullptr;  // Mapped shared state
+    pid_t m_ownerPid = 0;  // Process that created the channel, or 0 if opened
+
+public:
+    // CONSTRUCTORS
+    /// Create (if 'create') or open the channel named 'name', e.g. "/soc_core0_to_l2".
+    /// Both ends must use the same depth.  Creating a channel replaces any
+    /// stale one of the same name, so start the creating process first.
+    VlDistChannel(const std::string& name, size_t depth, bool create)
+        : m_name{name}
+        , m_depth{depth ? depth : 1} {
+        m_bytes = sizeof(Shared) + (m_depth - 1) * sizeof(T_Frame);
+        int fd;
+        if (create) {
+            shm_unlink(m_name.c_str());
+            fd = shm_open(m_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd >= 0 && ftruncate(fd, static_cast<off_t>(m_bytes)) != 0) {
+                close(fd);
+                fd = -1;
+            }
+            m_ownerPid = getpid();
+        } else {
+            // The creator may not have started yet
+            while ((fd = shm_open(m_name.c_str(), O_RDWR, 0600)) < 0 && errno == ENOENT) {
+                usleep(1000);
+            }
+        }
+        if (VL_UNLIKELY(fd < 0)) {
+            const std::string msg = "%Error: Cannot open distributed simulation channel " + m_name;
+            VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+            return;
+        }
+        void* const mapp = mmap(nullptr, m_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (VL_UNLIKELY(mapp == MAP_FAILED)) {
+            const std::string msg = "%Error: Cannot map distributed simulation channel " + m_name;
+            VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+            return;
+        }
+        // A new object is zero filled, so both counts start at 0
+        m_sharedp = static_cast<Shared*>(mapp);
+    }
+    ~VlDistChannel() {
+        if (m_sharedp) munmap(m_sharedp, m_bytes);
+        // Children forked after creation share the object, but do not own its name
+        if (m_ownerPid == getpid()) shm_unlink(m_name.c_str());
+    }
+    VL_UNCOPYABLE(VlDistChannel);
+
+    // METHODS
+    /// Cycles the producer may run ahead of the consumer
+    size_t depth() const { return m_depth; }
+    /// Frames sent and not yet received
+    size_t pending() const {
+        return m_sharedp->m_head.load(std::memory_order_acquire)
+               - m_sharedp->m_tail.load(std::memory_order_acquire);
+    }
+    /// Send the frame of the next cycle, waiting while 'depth' frames are unconsumed
+    void send(const T_Frame& frame) {
+        const uint64_t head = m_sharedp->m_head.load(std::memory_order_relaxed);
+        while (head - m_sharedp->m_tail.load(std::memory_order_acquire) >= m_depth) {
+            VL_CPU_RELAX();
+        }
+        std::memcpy(&m_sharedp->m_frames[head % m_depth], &frame, sizeof(T_Frame));
+        m_sharedp->m_head.store(head + 1, std::memory_order_release);
+    }
+    /// Receive the frame of the next cycle, waiting until it has been sent
+    void receive(T_Frame& frame) {
+        const uint64_t tail = m_sharedp->m_tail.load(std::memory_order_relaxed);
+        while (m_sharedp->m_head.load(std::memory_order_acquire) == tail) VL_CPU_RELAX();
+        std::memcpy(&frame, &m_sharedp->m_frames[tail % m_depth], sizeof(T_Frame));
+        m_sharedp->m_tail.store(tail + 1, std::memory_order_release);
+    }
+    /// Send 'depth' copies of the initial frame, so the consumer can start
+    /// while the producer computes its first cycles
+    void prime(const T_Frame& frame) {
+        for (size_t i = 0; i < m_depth; ++i) send(frame);
+    }
+};
+
+#endif  // Guard
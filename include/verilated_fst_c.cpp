@@ -39,7 +39,6 @@
 
 #include <algorithm>
 #include <iterator>
-#include <sstream>
 #include <type_traits>
 
 #if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
@@ -79,7 +78,11 @@ VerilatedFst::~VerilatedFst() {
 void VerilatedFst::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     m_fst = fstWriterCreate(filename, 1);
-    fstWriterSetPackType(m_fst, FST_WR_PT_LZ4);
+    switch (m_packType) {
+    case VerilatedFstPackType::LZ4: fstWriterSetPackType(m_fst, FST_WR_PT_LZ4); break;
+    case VerilatedFstPackType::FASTLZ: fstWriterSetPackType(m_fst, FST_WR_PT_FASTLZ); break;
+    case VerilatedFstPackType::ZLIB: fstWriterSetPackType(m_fst, FST_WR_PT_ZLIB); break;
+    }
     fstWriterSetTimescaleFromString(m_fst, timeResStr().c_str());  // lintok-begin-on-ref
     if (m_useFstWriterThread) fstWriterSetParallelMode(m_fst, 1);
     constDump(true);  // First dump must contain the const signals
@@ -90,14 +93,26 @@ void VerilatedFst::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     // convert m_code2symbol into an array for fast lookup
     if (!m_symbolp) {
         m_symbolp = new fstHandle[nextCode()]{0};
-        for (const auto& i : m_code2symbol) m_symbolp[i.first] = i.second;
+        std::copy(m_code2symbol.begin(), m_code2symbol.end(), m_symbolp);
     }
     m_code2symbol.clear();
+    m_code2symbol.shrink_to_fit();
 
     // Allocate string buffer for arrays
     if (!m_strbufp) m_strbufp = new char[maxBits() + 32];
 }
 
+void VerilatedFst::packType(VerilatedFstPackType type) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    m_packType = type;
+}
+
+void VerilatedFst::writerThread(bool flag) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    m_useFstWriterThread = flag;
+    m_writerThreadSet = true;
+}
+
 void VerilatedFst::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     Super::closeBase();
@@ -198,11 +213,20 @@ void VerilatedFst::declare(uint32_t code, const char* name, int dtypenum,
     if (!enabled) return;
 
     assert(hierarchicalName.rfind(' ') != std::string::npos);
-    std::stringstream name_ss;
-    name_ss << lastWord(hierarchicalName);
-    if (array) name_ss << "[" << arraynum << "]";
-    if (bussed) name_ss << " [" << msb << ":" << lsb << "]";
-    const std::string name_str = name_ss.str();
+    // Called for every signal, so build the name without a stringstream
+    std::string name_str = lastWord(hierarchicalName);
+    if (array) {
+        name_str += '[';
+        name_str += std::to_string(arraynum);
+        name_str += ']';
+    }
+    if (bussed) {
+        name_str += " [";
+        name_str += std::to_string(msb);
+        name_str += ':';
+        name_str += std::to_string(lsb);
+        name_str += ']';
+    }
 
     if (dtypenum > 0) fstWriterEmitEnumTableRef(m_fst, m_local2fstdtype[dtypenum]);
 
@@ -244,12 +268,13 @@ void VerilatedFst::declare(uint32_t code, const char* name, int dtypenum,
     else { assert(0); /* Unreachable */ }
     // clang-format on
 
-    const auto it = vlstd::as_const(m_code2symbol).find(code);
-    if (it == m_code2symbol.end()) {  // New
-        m_code2symbol[code]
-            = fstWriterCreateVar(m_fst, varType, varDir, bits, name_str.c_str(), 0);
+    // Codes are allocated densely, so index by code rather than searching a map
+    if (code >= m_code2symbol.size()) m_code2symbol.resize(code + 1, 0);
+    vlFstHandle& symbolr = m_code2symbol[code];
+    if (!symbolr) {  // New
+        symbolr = fstWriterCreateVar(m_fst, varType, varDir, bits, name_str.c_str(), 0);
     } else {  // Alias
-        fstWriterCreateVar(m_fst, varType, varDir, bits, name_str.c_str(), it->second);
+        fstWriterCreateVar(m_fst, varType, varDir, bits, name_str.c_str(), symbolr);
     }
 }
 
@@ -310,8 +335,9 @@ void VerilatedFst::commitTraceBuffer(VerilatedFst::Buffer* bufp) {
 // Configure
 
 void VerilatedFst::configure(const VerilatedTraceConfig& config) {
-    // If at least one model requests the FST writer thread, then use it
-    m_useFstWriterThread |= config.m_useFstWriterThread;
+    // If at least one model requests the FST writer thread, then use it,
+    // unless the user chose explicitly
+    if (!m_writerThreadSet) m_useFstWriterThread |= config.m_useFstWriterThread;
 }
 
 //=============================================================================
@@ -36,6 +36,13 @@ class VerilatedFstBuffer;
 
 struct fstWriterContext;
 
+/// Compression codec for FST value change blocks
+enum class VerilatedFstPackType : uint8_t {
+    LZ4,  // Default, fastest
+    FASTLZ,  // Fast, usually smaller than LZ4
+    ZLIB  // Slowest, smallest files
+};
+
 //=============================================================================
 // VerilatedFst
 // Base class to create a Verilator FST dump
@@ -52,13 +59,15 @@ private:
     // FST-specific internals
 
     fstWriterContext* m_fst = nullptr;
-    std::map<uint32_t, vlFstHandle> m_code2symbol;
+    std::vector<vlFstHandle> m_code2symbol;  // Symbol of each code during open, 0 = none
     std::map<int, vlFstEnumHandle> m_local2fstdtype;
     vlFstHandle* m_symbolp = nullptr;  // same as m_code2symbol, but as an array
     char* m_strbufp = nullptr;  // String buffer long enough to hold maxBits() chars
     uint64_t m_timeui = 0;  // Time to emit, 0 = not needed
 
     bool m_useFstWriterThread = false;  // Whether to use the separate FST writer thread
+    bool m_writerThreadSet = false;  // writerThread() was called, overriding the model config
+    VerilatedFstPackType m_packType = VerilatedFstPackType::LZ4;  // Value change compression
 
     // Prefixes to add to signal names/scope types
     std::vector<std::pair<std::string, VerilatedTracePrefixType>> m_prefixStack{
@@ -106,6 +115,10 @@ public:
     void flush() VL_MT_SAFE_EXCLUDES(m_mutex);
     // Return if file is open
     bool isOpen() const VL_MT_SAFE { return m_fst != nullptr; }
+    // Set compression of value change blocks, takes effect on next open()
+    void packType(VerilatedFstPackType type) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Set whether to compress and write blocks on a separate thread, takes effect on next open()
+    void writerThread(bool flag) VL_MT_SAFE_EXCLUDES(m_mutex);
 
     //=========================================================================
     // Internal interface to Verilator generated code
@@ -150,6 +163,8 @@ template <>
 void VerilatedFst::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedFst::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedFst::Super::enableScope(const std::string& hier, bool enable);
 #endif
 
 //=============================================================================
@@ -222,6 +237,11 @@ public:
     }
     /// Flush dump
     void flush() VL_MT_SAFE { m_sptrace.flush(); }
+    /// Set compression codec of value change blocks; call before open()
+    void packType(VerilatedFstPackType type) VL_MT_SAFE { m_sptrace.packType(type); }
+    /// Compress and write value change blocks on a separate thread; call
+    /// before open().  Defaults on when Verilated with --trace-threads 2.
+    void writerThread(bool flag) VL_MT_SAFE { m_sptrace.writerThread(flag); }
     /// Write one cycle of dump data
     /// Call with the current context's time just after eval'ed,
     /// e.g. ->dump(contextp->time())
@@ -254,6 +274,18 @@ public:
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
         m_sptrace.dumpvars(level, hier);
     }
+    // Pause or resume tracing of a scope and those under it, e.g. "top.cpu".
+    // May be called while tracing, skipping the work of tracing the scope.
+    void enableScope(const std::string& hier, bool enable) VL_MT_SAFE {
+        m_sptrace.enableScope(hier, enable);
+    }
+    // Only dump on every n-th call to dump(), for sampling slowly changing
+    // signals; each dump shows the values at that time
+    void dumpDecimate(uint32_t n) VL_MT_SAFE { m_sptrace.dumpDecimate(n); }
+    // Only dump when cb(userp) returns true, nullptr = always
+    void dumpTrigger(bool (*cb)(void*), void* userp) VL_MT_SAFE {
+        m_sptrace.dumpTrigger(cb, userp);
+    }
 
     // Internal class access
     VerilatedFst* spTrace() { return &m_sptrace; }
@@ -28,6 +28,8 @@
 #error "verilated_funcs.h should only be included by verilated.h"
 #endif
 
+#include "verilated_intrinsics.h"
+
 #include <string>
 
 //=========================================================================
@@ -148,8 +150,8 @@ extern void VL_FCLOSE_I(IData fdi) VL_MT_SAFE;
 extern IData VL_FREAD_I(int width, int array_lsb, int array_size, void* memp, IData fpi,
                         IData start, IData count) VL_MT_SAFE;
 
-extern void VL_WRITEF_NX(const std::string& format, int argc, ...) VL_MT_SAFE;
-extern void VL_FWRITEF_NX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE;
+extern void VL_WRITEF_NX(const VlFormat& format, int argc, ...) VL_MT_SAFE;
+extern void VL_FWRITEF_NX(IData fpi, const VlFormat& format, int argc, ...) VL_MT_SAFE;
 
 extern IData VL_FSCANF_INX(IData fpi, const std::string& format, int argc, ...) VL_MT_SAFE;
 extern IData VL_SSCANF_IINX(int lbits, IData ld, const std::string& format, int argc,
@@ -159,15 +161,15 @@ extern IData VL_SSCANF_IQNX(int lbits, QData ld, const std::string& format, int
 extern IData VL_SSCANF_IWNX(int lbits, WDataInP const lwp, const std::string& format, int argc,
                             ...) VL_MT_SAFE;
 
-extern void VL_SFORMAT_NX(int obits, CData& destr, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, CData& destr, const VlFormat& format, int argc,
                           ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits, SData& destr, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, SData& destr, const VlFormat& format, int argc,
                           ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits, IData& destr, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, IData& destr, const VlFormat& format, int argc,
                           ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits, QData& destr, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, QData& destr, const VlFormat& format, int argc,
                           ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits, void* destp, const std::string& format, int argc,
+extern void VL_SFORMAT_NX(int obits, void* destp, const VlFormat& format, int argc,
                           ...) VL_MT_SAFE;
 
 extern void VL_STACKTRACE() VL_MT_SAFE;
@@ -208,6 +210,15 @@ extern const char* vl_mc_scan_plusargs(const char* prefixp) VL_MT_SAFE;  // PLIi
      | (static_cast<QData>((lwp)[1]) << (static_cast<QData>(VL_EDATASIZE))))
 #define VL_SET_QII(ld, rd) ((static_cast<QData>(ld) << 32ULL) | static_cast<QData>(rd))
 
+// Atomically OR bits into a quadword, e.g. packed trace activity flags set from mtasks
+static inline void VL_ATOMIC_OR_Q(QData& lhs, QData rhs) VL_MT_SAFE {
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_fetch_or(&lhs, rhs, __ATOMIC_RELAXED);
+#else
+    reinterpret_cast<std::atomic<QData>&>(lhs).fetch_or(rhs, std::memory_order_relaxed);
+#endif
+}
+
 // Return FILE* from IData
 extern FILE* VL_CVT_I_FP(IData lhs) VL_MT_SAFE;
 
@@ -298,6 +309,67 @@ static inline QData VL_EXTENDSIGN_Q(int lbits, QData lhs) VL_PURE {
 // Debugging prints
 extern void _vl_debug_print_w(int lbits, WDataInP const iwp) VL_MT_SAFE;
 
+//=========================================================================
+// Vector kernels for wide operations
+// VlWideVec operates on VL_WIDE_VEC_WORDS EData words at a time using the best
+// instruction set enabled at compile time (see verilated_intrinsics.h). Wide
+// operations process whole vectors with it, then finish remaining words with
+// scalar code. Loads and stores are unaligned, and owp may equal lwp or rwp.
+
+// clang-format off
+#if defined(VL_HAVE_AVX512)
+# define VL_WIDE_VEC_WORDS 16
+struct VlWideVec final {
+    using V = __m512i;
+    static V load(const EData* p) { return _mm512_loadu_si512(p); }
+    static void store(EData* p, V v) { _mm512_storeu_si512(p, v); }
+    static V zero() { return _mm512_setzero_si512(); }
+    static V vand(V a, V b) { return _mm512_and_si512(a, b); }
+    static V vor(V a, V b) { return _mm512_or_si512(a, b); }
+    static V vxor(V a, V b) { return _mm512_xor_si512(a, b); }
+    static V vnot(V a) { return _mm512_ternarylogic_epi32(a, a, a, 0x55); }
+    static bool isZero(V a) { return _mm512_test_epi32_mask(a, a) == 0; }
+};
+#elif defined(VL_HAVE_AVX2)
+# define VL_WIDE_VEC_WORDS 8
+struct VlWideVec final {
+    using V = __m256i;
+    static V load(const EData* p) { return _mm256_loadu_si256(reinterpret_cast<const V*>(p)); }
+    static void store(EData* p, V v) { _mm256_storeu_si256(reinterpret_cast<V*>(p), v); }
+    static V zero() { return _mm256_setzero_si256(); }
+    static V vand(V a, V b) { return _mm256_and_si256(a, b); }
+    static V vor(V a, V b) { return _mm256_or_si256(a, b); }
+    static V vxor(V a, V b) { return _mm256_xor_si256(a, b); }
+    static V vnot(V a) { return _mm256_xor_si256(a, _mm256_set1_epi32(-1)); }
+    static bool isZero(V a) { return _mm256_testz_si256(a, a); }
+};
+#elif defined(VL_HAVE_NEON)
+# define VL_WIDE_VEC_WORDS 4
+struct VlWideVec final {
+    using V = uint32x4_t;
+    static V load(const EData* p) { return vld1q_u32(p); }
+    static void store(EData* p, V v) { vst1q_u32(p, v); }
+    static V zero() { return vdupq_n_u32(0); }
+    static V vand(V a, V b) { return vandq_u32(a, b); }
+    static V vor(V a, V b) { return vorrq_u32(a, b); }
+    static V vxor(V a, V b) { return veorq_u32(a, b); }
+    static V vnot(V a) { return vmvnq_u32(a); }
+    static bool isZero(V a) { return vmaxvq_u32(a) == 0; }
+};
+#endif
+// clang-format on
+
+#ifdef VL_WIDE_VEC_WORDS
+// Fold the lanes of a vector into one word with OR or XOR
+static inline EData _vl_wide_vec_fold(VlWideVec::V v, bool isXor) VL_PURE {
+    EData lanes[VL_WIDE_VEC_WORDS];
+    VlWideVec::store(lanes, v);
+    EData r = 0;
+    for (int i = 0; i < VL_WIDE_VEC_WORDS; ++i) r = isXor ? (r ^ lanes[i]) : (r | lanes[i]);
+    return r;
+}
+#endif
+
 //=========================================================================
 // Time handling
 
@@ -459,7 +531,8 @@ static inline void VL_ASSIGNBIT_WO(int bit, WDataOutP owp) VL_MT_SAFE {
 //===================================================================
 // SYSTEMC OPERATORS
 // Copying verilog format to systemc integers, doubles, and bit vectors.
-// Get a SystemC variable
+// Get a SystemC variable.  Wide reads bind a reference to the value returned
+// by read() rather than copying it, so no temporary is allocated per eval.
 
 #define VL_ASSIGN_DSD(obits, vvar, svar) \
     { (vvar) = (svar).read(); }
@@ -472,14 +545,15 @@ static inline void VL_ASSIGNBIT_WO(int bit, WDataOutP owp) VL_MT_SAFE {
     { (od) = ((svar).read().get_word(0)) & VL_MASK_I(obits); }
 #define VL_ASSIGN_QSW(obits, od, svar) \
     { \
-        (od) = ((static_cast<QData>((svar).read().get_word(1))) << VL_IDATASIZE \
-                | (svar).read().get_word(0)) \
+        const auto& _bvref = (svar).read(); \
+        (od) = ((static_cast<QData>(_bvref.get_word(1))) << VL_IDATASIZE | _bvref.get_word(0)) \
                & VL_MASK_Q(obits); \
     }
 #define VL_ASSIGN_WSW(obits, owp, svar) \
     { \
         const int words = VL_WORDS_I(obits); \
-        for (int i = 0; i < words; ++i) (owp)[i] = (svar).read().get_word(i); \
+        const auto& _bvref = (svar).read(); \
+        for (int i = 0; i < words; ++i) (owp)[i] = _bvref.get_word(i); \
         (owp)[words - 1] &= VL_MASK_E(obits); \
     }
 
@@ -490,8 +564,8 @@ static inline void VL_ASSIGNBIT_WO(int bit, WDataOutP owp) VL_MT_SAFE {
 #define VL_ASSIGN_WSB(obits, owp, svar) \
     { \
         const int words = VL_WORDS_I(obits); \
-        sc_dt::sc_biguint<(obits)> _butemp = (svar).read(); \
-        uint32_t* chunkp = _butemp.get_raw(); \
+        const sc_dt::sc_biguint<(obits)>& _buref = (svar).read(); \
+        const uint32_t* chunkp = _buref.get_raw(); \
         int32_t lsb = 0; \
         while (lsb < obits - BITS_PER_DIGIT) { \
             const uint32_t data = *chunkp; \
@@ -507,7 +581,8 @@ static inline void VL_ASSIGNBIT_WO(int bit, WDataOutP owp) VL_MT_SAFE {
     }
 
 // Copying verilog format from systemc integers, doubles, and bit vectors.
-// Set a SystemC variable
+// Set a SystemC variable.  Wide writes stage through a per-thread temporary
+// that is constructed once, as sc_bv/sc_biguint construction allocates.
 
 #define VL_ASSIGN_SDD(obits, svar, vvar) \
     { (svar).write(vvar); }
@@ -518,20 +593,20 @@ static inline void VL_ASSIGNBIT_WO(int bit, WDataOutP owp) VL_MT_SAFE {
 
 #define VL_ASSIGN_SWI(obits, svar, rd) \
     { \
-        sc_dt::sc_bv<(obits)> _bvtemp; \
+        static thread_local sc_dt::sc_bv<(obits)> _bvtemp; \
         _bvtemp.set_word(0, (rd)); \
         (svar).write(_bvtemp); \
     }
 #define VL_ASSIGN_SWQ(obits, svar, rd) \
     { \
-        sc_dt::sc_bv<(obits)> _bvtemp; \
+        static thread_local sc_dt::sc_bv<(obits)> _bvtemp; \
         _bvtemp.set_word(0, static_cast<IData>(rd)); \
         _bvtemp.set_word(1, static_cast<IData>((rd) >> VL_IDATASIZE)); \
         (svar).write(_bvtemp); \
     }
 #define VL_ASSIGN_SWW(obits, svar, rwp) \
     { \
-        sc_dt::sc_bv<(obits)> _bvtemp; \
+        static thread_local sc_dt::sc_bv<(obits)> _bvtemp; \
         for (int i = 0; i < VL_WORDS_I(obits); ++i) _bvtemp.set_word(i, (rwp)[i]); \
         (svar).write(_bvtemp); \
     }
@@ -546,7 +621,7 @@ static inline void VL_ASSIGNBIT_WO(int bit, WDataOutP owp) VL_MT_SAFE {
     { (svar).write(rd); }
 #define VL_ASSIGN_SBW(obits, svar, rwp) \
     { \
-        sc_dt::sc_biguint<(obits)> _butemp; \
+        static thread_local sc_dt::sc_biguint<(obits)> _butemp; \
         int32_t lsb = 0; \
         uint32_t* chunkp = _butemp.get_raw(); \
         while (lsb + BITS_PER_DIGIT < (obits)) { \
@@ -661,9 +736,25 @@ static inline IData VL_REDAND_IW(int lbits, WDataInP const lwp) VL_PURE {
 #define VL_REDOR_Q(lhs) ((lhs) != 0)
 static inline IData VL_REDOR_W(int words, WDataInP const lwp) VL_PURE {
     EData equal = 0;
-    for (int i = 0; i < words; ++i) equal |= lwp[i];
+    int i = 0;
+#ifdef VL_WIDE_VEC_WORDS
+    if (words >= VL_WIDE_VEC_WORDS) {
+        VlWideVec::V acc = VlWideVec::zero();
+        for (; i + VL_WIDE_VEC_WORDS <= words; i += VL_WIDE_VEC_WORDS) {
+            acc = VlWideVec::vor(acc, VlWideVec::load(lwp + i));
+        }
+        if (!VlWideVec::isZero(acc)) return 1;
+    }
+#endif
+    for (; i < words; ++i) equal |= lwp[i];
     return (equal != 0);
 }
+// Templated on word count, emitted by Verilator as the width is always known, so the
+// compiler sees a constant loop bound and can fully unroll narrow operations
+template <int N_Words>
+static VL_ATTR_ALWINLINE IData VL_REDOR_W(WDataInP const lwp) VL_PURE {
+    return VL_REDOR_W(N_Words, lwp);
+}
 
 // EMIT_RULE: VL_REDXOR:  oclean=dirty; obits=1;
 static inline IData VL_REDXOR_2(IData r) VL_PURE {
@@ -728,21 +819,44 @@ static inline IData VL_REDXOR_64(QData r) VL_PURE {
 }
 static inline IData VL_REDXOR_W(int words, WDataInP const lwp) VL_PURE {
     EData r = lwp[0];
-    for (int i = 1; i < words; ++i) r ^= lwp[i];
+    int i = 1;
+#ifdef VL_WIDE_VEC_WORDS
+    if (words >= VL_WIDE_VEC_WORDS) {
+        VlWideVec::V acc = VlWideVec::zero();
+        for (i = 0; i + VL_WIDE_VEC_WORDS <= words; i += VL_WIDE_VEC_WORDS) {
+            acc = VlWideVec::vxor(acc, VlWideVec::load(lwp + i));
+        }
+        r = _vl_wide_vec_fold(acc, true);
+    }
+#endif
+    for (; i < words; ++i) r ^= lwp[i];
     return VL_REDXOR_32(r);
 }
+template <int N_Words>
+static VL_ATTR_ALWINLINE IData VL_REDXOR_W(WDataInP const lwp) VL_PURE {
+    return VL_REDXOR_W(N_Words, lwp);
+}
 
 // EMIT_RULE: VL_COUNTONES_II:  oclean = false; lhs clean
 static inline IData VL_COUNTONES_I(IData lhs) VL_PURE {
-    // This is faster than __builtin_popcountl
+#if defined(__GNUC__) && defined(__POPCNT__) && !defined(VL_NO_BUILTINS)
+    // Single instruction when the target has one
+    return __builtin_popcount(lhs);
+#else
+    // This is faster than __builtin_popcountl without a popcount instruction
     IData r = lhs - ((lhs >> 1) & 033333333333) - ((lhs >> 2) & 011111111111);
     r = (r + (r >> 3)) & 030707070707;
     r = (r + (r >> 6));
     r = (r + (r >> 12) + (r >> 24)) & 077;
     return r;
+#endif
 }
 static inline IData VL_COUNTONES_Q(QData lhs) VL_PURE {
+#if defined(__GNUC__) && defined(__POPCNT__) && !defined(VL_NO_BUILTINS)
+    return __builtin_popcountll(lhs);
+#else
     return VL_COUNTONES_I(static_cast<IData>(lhs)) + VL_COUNTONES_I(static_cast<IData>(lhs >> 32));
+#endif
 }
 #define VL_COUNTONES_E VL_COUNTONES_I
 static inline IData VL_COUNTONES_W(int words, WDataInP const lwp) VL_PURE {
@@ -844,15 +958,51 @@ static inline IData VL_CLOG2_W(int words, WDataInP const lwp) VL_PURE {
     return 0;
 }
 
-static inline IData VL_MOSTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
+// EMIT_RULE: VL_MOSTSETBITP1:  oclean = true; lhs clean
+static inline IData VL_MOSTSETBITP1_I(IData lhs) VL_PURE {
     // MSB set bit plus one; similar to FLS.  0=value is zero
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS)
+    return lhs ? 32 - __builtin_clz(lhs) : 0;
+#else
+    IData r = 0;
+    for (; lhs; lhs >>= 1) ++r;
+    return r;
+#endif
+}
+static inline IData VL_MOSTSETBITP1_Q(QData lhs) VL_PURE {
+    const IData hi = static_cast<IData>(lhs >> 32);
+    return hi ? 32 + VL_MOSTSETBITP1_I(hi) : VL_MOSTSETBITP1_I(static_cast<IData>(lhs));
+}
+#define VL_MOSTSETBITP1_E VL_MOSTSETBITP1_I
+static inline IData VL_MOSTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
     for (int i = words - 1; i >= 0; --i) {
-        if (VL_UNLIKELY(lwp[i])) {  // Shorter worst case if predict not taken
-            for (int bit = VL_EDATASIZE - 1; bit >= 0; --bit) {
-                if (VL_UNLIKELY(VL_BITISSET_E(lwp[i], bit))) return i * VL_EDATASIZE + bit + 1;
-            }
-            // Can't get here - one bit must be set
-        }
+        if (lwp[i]) return i * VL_EDATASIZE + VL_MOSTSETBITP1_E(lwp[i]);
+    }
+    return 0;
+}
+
+// EMIT_RULE: VL_LEASTSETBITP1:  oclean = true; lhs clean
+static inline IData VL_LEASTSETBITP1_I(IData lhs) VL_PURE {
+    // LSB set bit plus one; similar to FFS.  0=value is zero
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS)
+    return lhs ? __builtin_ctz(lhs) + 1 : 0;
+#else
+    if (!lhs) return 0;
+    IData r = 1;
+    for (; !(lhs & 1); lhs >>= 1) ++r;
+    return r;
+#endif
+}
+static inline IData VL_LEASTSETBITP1_Q(QData lhs) VL_PURE {
+    const IData lo = static_cast<IData>(lhs);
+    if (lo) return VL_LEASTSETBITP1_I(lo);
+    const IData hi = static_cast<IData>(lhs >> 32);
+    return hi ? 32 + VL_LEASTSETBITP1_I(hi) : 0;
+}
+#define VL_LEASTSETBITP1_E VL_LEASTSETBITP1_I
+static inline IData VL_LEASTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
+    for (int i = 0; i < words; ++i) {
+        if (lwp[i]) return i * VL_EDATASIZE + VL_LEASTSETBITP1_E(lwp[i]);
     }
     return 0;
 }
@@ -863,33 +1013,91 @@ static inline IData VL_MOSTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
 // EMIT_RULE: VL_AND:  oclean=lclean||rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_AND_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
+    int i = 0;
+#ifdef VL_WIDE_VEC_WORDS
+    for (; i + VL_WIDE_VEC_WORDS <= words; i += VL_WIDE_VEC_WORDS) {
+        const VlWideVec::V lv = VlWideVec::load(lwp + i);
+        VlWideVec::store(owp + i, VlWideVec::vand(lv, VlWideVec::load(rwp + i)));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_OR:   oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_OR_W(int words, WDataOutP owp, WDataInP const lwp,
                                 WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
+    int i = 0;
+#ifdef VL_WIDE_VEC_WORDS
+    for (; i + VL_WIDE_VEC_WORDS <= words; i += VL_WIDE_VEC_WORDS) {
+        const VlWideVec::V lv = VlWideVec::load(lwp + i);
+        VlWideVec::store(owp + i, VlWideVec::vor(lv, VlWideVec::load(rwp + i)));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_CHANGEXOR:  oclean=1; obits=32; lbits==rbits;
 static inline IData VL_CHANGEXOR_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
     IData od = 0;
-    for (int i = 0; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
+    int i = 0;
+#ifdef VL_WIDE_VEC_WORDS
+    if (words >= VL_WIDE_VEC_WORDS) {
+        VlWideVec::V acc = VlWideVec::zero();
+        for (; i + VL_WIDE_VEC_WORDS <= words; i += VL_WIDE_VEC_WORDS) {
+            const VlWideVec::V lv = VlWideVec::load(lwp + i);
+            acc = VlWideVec::vor(acc, VlWideVec::vxor(lv, VlWideVec::load(rwp + i)));
+        }
+        od = _vl_wide_vec_fold(acc, false);
+    }
+#endif
+    for (; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
     return od;
 }
 // EMIT_RULE: VL_XOR:  oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_XOR_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    int i = 0;
+#ifdef VL_WIDE_VEC_WORDS
+    for (; i + VL_WIDE_VEC_WORDS <= words; i += VL_WIDE_VEC_WORDS) {
+        const VlWideVec::V lv = VlWideVec::load(lwp + i);
+        VlWideVec::store(owp + i, VlWideVec::vxor(lv, VlWideVec::load(rwp + i)));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_NOT:  oclean=dirty; obits=lbits;
 static inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
-    for (int i = 0; i < words; ++i) owp[i] = ~(lwp[i]);
+    int i = 0;
+#ifdef VL_WIDE_VEC_WORDS
+    for (; i + VL_WIDE_VEC_WORDS <= words; i += VL_WIDE_VEC_WORDS) {
+        VlWideVec::store(owp + i, VlWideVec::vnot(VlWideVec::load(lwp + i)));
+    }
+#endif
+    for (; i < words; ++i) owp[i] = ~(lwp[i]);
     return owp;
 }
 
+template <int N_Words>
+static VL_ATTR_ALWINLINE WDataOutP VL_AND_W(WDataOutP owp, WDataInP const lwp,
+                                            WDataInP const rwp) VL_MT_SAFE {
+    return VL_AND_W(N_Words, owp, lwp, rwp);
+}
+template <int N_Words>
+static VL_ATTR_ALWINLINE WDataOutP VL_OR_W(WDataOutP owp, WDataInP const lwp,
+                                           WDataInP const rwp) VL_MT_SAFE {
+    return VL_OR_W(N_Words, owp, lwp, rwp);
+}
+template <int N_Words>
+static VL_ATTR_ALWINLINE WDataOutP VL_XOR_W(WDataOutP owp, WDataInP const lwp,
+                                            WDataInP const rwp) VL_MT_SAFE {
+    return VL_XOR_W(N_Words, owp, lwp, rwp);
+}
+template <int N_Words>
+static VL_ATTR_ALWINLINE WDataOutP VL_NOT_W(WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
+    return VL_NOT_W(N_Words, owp, lwp);
+}
+
 //=========================================================================
 // Logical comparisons
 
@@ -899,7 +1107,6 @@ static inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) V
 // EMIT_RULE: VL_GT:  oclean=clean; lclean==clean; rclean==clean; obits=1; lbits==rbits;
 // EMIT_RULE: VL_GTE: oclean=clean; lclean==clean; rclean==clean; obits=1; lbits==rbits;
 // EMIT_RULE: VL_LTE: oclean=clean; lclean==clean; rclean==clean; obits=1; lbits==rbits;
-#define VL_NEQ_W(words, lwp, rwp) (!VL_EQ_W(words, lwp, rwp))
 #define VL_LT_W(words, lwp, rwp) (_vl_cmp_w(words, lwp, rwp) < 0)
 #define VL_LTE_W(words, lwp, rwp) (_vl_cmp_w(words, lwp, rwp) <= 0)
 #define VL_GT_W(words, lwp, rwp) (_vl_cmp_w(words, lwp, rwp) > 0)
@@ -908,9 +1115,31 @@ static inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) V
 // Output clean, <lhs> AND <rhs> MUST BE CLEAN
 static inline IData VL_EQ_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
     EData nequal = 0;
-    for (int i = 0; (i < words); ++i) nequal |= (lwp[i] ^ rwp[i]);
+    int i = 0;
+#ifdef VL_WIDE_VEC_WORDS
+    if (words >= VL_WIDE_VEC_WORDS) {
+        VlWideVec::V acc = VlWideVec::zero();
+        for (; i + VL_WIDE_VEC_WORDS <= words; i += VL_WIDE_VEC_WORDS) {
+            const VlWideVec::V lv = VlWideVec::load(lwp + i);
+            acc = VlWideVec::vor(acc, VlWideVec::vxor(lv, VlWideVec::load(rwp + i)));
+        }
+        if (!VlWideVec::isZero(acc)) return 0;
+    }
+#endif
+    for (; (i < words); ++i) nequal |= (lwp[i] ^ rwp[i]);
     return (nequal == 0);
 }
+static inline IData VL_NEQ_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return !VL_EQ_W(words, lwp, rwp);
+}
+template <int N_Words>
+static VL_ATTR_ALWINLINE IData VL_EQ_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return VL_EQ_W(N_Words, lwp, rwp);
+}
+template <int N_Words>
+static VL_ATTR_ALWINLINE IData VL_NEQ_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return !VL_EQ_W(N_Words, lwp, rwp);
+}
 
 // Internal usage
 static inline int _vl_cmp_w(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
@@ -1025,11 +1254,49 @@ static inline QData VL_MODDIV_QQQ(int lbits, QData lhs, QData rhs) {
     return (rhs == 0) ? 0 : lhs % rhs;
 }
 #define VL_MODDIV_WWW(lbits, owp, lwp, rwp) (_vl_moddiv_w(lbits, owp, lwp, rwp, 1))
+// Wide division by a single word divisor.  Verilator only uses these with constant
+// divisors, so once inlined the C++ compiler reduces each word's division to a multiply.
+static VL_ATTR_ALWINLINE WDataOutP VL_DIV_WWI(int lbits, WDataOutP owp, WDataInP const lwp,
+                                              IData rhs) VL_MT_SAFE {
+    const int words = VL_WORDS_I(lbits);
+    if (VL_UNLIKELY(rhs == 0)) return VL_ZERO_W(lbits, owp);
+    uint64_t k = 0;
+    for (int j = words - 1; j >= 0; --j) {
+        const uint64_t unw64 = (k << 32ULL) | static_cast<uint64_t>(lwp[j]);
+        owp[j] = static_cast<EData>(unw64 / rhs);
+        k = unw64 % rhs;
+    }
+    return owp;
+}
+static VL_ATTR_ALWINLINE WDataOutP VL_MODDIV_WWI(int lbits, WDataOutP owp, WDataInP const lwp,
+                                                 IData rhs) VL_MT_SAFE {
+    const int words = VL_WORDS_I(lbits);
+    if (VL_UNLIKELY(rhs == 0)) return VL_ZERO_W(lbits, owp);
+    uint64_t k = 0;
+    for (int j = words - 1; j >= 0; --j) {
+        k = ((k << 32ULL) | static_cast<uint64_t>(lwp[j])) % rhs;
+    }
+    owp[0] = static_cast<EData>(k);
+    for (int i = 1; i < words; ++i) owp[i] = 0;
+    return owp;
+}
 
 static inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
     QData carry = 0;
-    for (int i = 0; i < words; ++i) {
+    int i = 0;
+#if defined(VL_HAVE_AVX2) && defined(__x86_64__)
+    // Add 64 bits at a time using the carry flag (ADC)
+    unsigned char c = 0;
+    for (; i + 2 <= words; i += 2) {
+        unsigned long long sum;
+        c = _addcarry_u64(c, VL_SET_QW(lwp + i), VL_SET_QW(rwp + i), &sum);
+        owp[i] = static_cast<EData>(sum);
+        owp[i + 1] = static_cast<EData>(sum >> 32ULL);
+    }
+    carry = c;
+#endif
+    for (; i < words; ++i) {
         carry = carry + static_cast<QData>(lwp[i]) + static_cast<QData>(rwp[i]);
         owp[i] = (carry & 0xffffffffULL);
         carry = (carry >> 32ULL) & 0xffffffffULL;
@@ -1051,6 +1318,16 @@ static inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
     // Last output word is dirty
     return owp;
 }
+template <int N_Words>
+static VL_ATTR_ALWINLINE WDataOutP VL_ADD_W(WDataOutP owp, WDataInP const lwp,
+                                            WDataInP const rwp) VL_MT_SAFE {
+    return VL_ADD_W(N_Words, owp, lwp, rwp);
+}
+template <int N_Words>
+static VL_ATTR_ALWINLINE WDataOutP VL_SUB_W(WDataOutP owp, WDataInP const lwp,
+                                            WDataInP const rwp) VL_MT_SAFE {
+    return VL_SUB_W(N_Words, owp, lwp, rwp);
+}
 
 static inline WDataOutP VL_MUL_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
@@ -2958,6 +3235,26 @@ inline std::string VL_CVT_PACK_STR_NI(IData lhs) VL_PURE {
 inline std::string VL_CONCATN_NNN(const std::string& lhs, const std::string& rhs) VL_PURE {
     return lhs + rhs;
 }
+// Concatenate any number of strings, allocating the result once
+inline size_t _vl_concatn_size() VL_PURE { return 0; }
+template <typename... T_Rest>
+inline size_t _vl_concatn_size(const std::string& first, const T_Rest&... rest) VL_PURE {
+    return first.size() + _vl_concatn_size(rest...);
+}
+inline void _vl_concatn_append(std::string&) VL_PURE {}
+template <typename... T_Rest>
+inline void _vl_concatn_append(std::string& out, const std::string& first,
+                               const T_Rest&... rest) VL_PURE {
+    out += first;
+    _vl_concatn_append(out, rest...);
+}
+template <typename... T_Strings>
+inline std::string VL_CONCATN_MULTI(const T_Strings&... strs) VL_PURE {
+    std::string result;
+    result.reserve(_vl_concatn_size(strs...));
+    _vl_concatn_append(result, strs...);
+    return result;
+}
 inline std::string VL_REPLICATEN_NNQ(const std::string& lhs, IData rep) VL_PURE {
     std::string result;
     result.reserve(lhs.length() * rep);
@@ -2982,11 +3279,54 @@ extern void VL_READMEM_N(bool hex, int bits, QData depth, int array_lsb,
 extern void VL_WRITEMEM_N(bool hex, int bits, QData depth, int array_lsb,
                           const std::string& filename, const void* memp, QData start,
                           QData end) VL_MT_SAFE;
+// Sparse unpacked arrays, see VlSparseUnpacked
+template <typename T_Value, std::size_t N_Depth>
+void VL_READMEM_N(bool hex, int bits, QData depth, int array_lsb, const std::string& filename,
+                  VlSparseUnpacked<T_Value, N_Depth>& obj, QData start, QData end) VL_MT_SAFE {
+    if (start < static_cast<QData>(array_lsb)) start = array_lsb;
+    VlReadMem rmem{hex, bits, filename, start, end};
+    if (VL_UNLIKELY(!rmem.isOpen())) return;
+    while (true) {
+        QData addr = 0;
+        std::string value;
+        if (rmem.get(addr /*ref*/, value /*ref*/)) {
+            if (VL_UNLIKELY(addr < static_cast<QData>(array_lsb)
+                            || addr >= static_cast<QData>(array_lsb + depth))) {
+                VL_FATAL_MT(filename.c_str(), rmem.linenum(), "",
+                            "$readmem file address beyond bounds of array");
+            } else {
+                rmem.setData(&(obj[addr - array_lsb]), value);
+            }
+        } else {
+            break;
+        }
+    }
+}
+
+template <typename T_Value, std::size_t N_Depth>
+void VL_WRITEMEM_N(bool hex, int bits, QData depth, int array_lsb, const std::string& filename,
+                   const VlSparseUnpacked<T_Value, N_Depth>& obj, QData start,
+                   QData end) VL_MT_SAFE {
+    const QData addr_max = array_lsb + depth - 1;
+    if (start < static_cast<QData>(array_lsb)) start = array_lsb;
+    if (end > addr_max) end = addr_max;
+    VlWriteMem wmem{hex, bits, filename, start, end};
+    if (VL_UNLIKELY(!wmem.isOpen())) return;
+    // Only elements in allocated pages are written, with address stamps, as for VlAssocArray
+    for (const std::size_t pageNum : obj.pageNums()) {
+        const T_Value* const datap = obj.pageData(pageNum);
+        for (std::size_t i = 0; i < obj.PAGE_ELEMENTS; ++i) {
+            const QData addr = array_lsb + pageNum * obj.PAGE_ELEMENTS + i;
+            if (addr >= start && addr <= end) wmem.print(addr, true, &(datap[i]));
+        }
+    }
+}
+
 extern IData VL_SSCANF_INNX(int lbits, const std::string& ld, const std::string& format, int argc,
                             ...) VL_MT_SAFE;
-extern void VL_SFORMAT_NX(int obits_ignored, std::string& output, const std::string& format,
+extern void VL_SFORMAT_NX(int obits_ignored, std::string& output, const VlFormat& format,
                           int argc, ...) VL_MT_SAFE;
-extern std::string VL_SFORMATF_N_NX(const std::string& format, int argc, ...) VL_MT_SAFE;
+extern std::string VL_SFORMATF_N_NX(const VlFormat& format, int argc, ...) VL_MT_SAFE;
 extern void VL_TIMEFORMAT_IINI(bool hasUnits, int units, bool hasPrecision, int precision,
                                bool hasSuffix, const std::string& suffix, bool hasWidth, int width,
                                VerilatedContext* contextp) VL_MT_SAFE;
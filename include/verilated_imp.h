@@ -269,6 +269,8 @@ public:  // But only for verilated*.cpp
     // METHODS - scope name - INTERNAL only for verilated*.cpp
     void scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE;
     void scopeErase(const VerilatedScope* scopep) VL_MT_SAFE;
+    // Number changed whenever a scope of any context is inserted or erased
+    static uint64_t scopeGeneration() VL_MT_SAFE;
 
     // METHODS - file IO - INTERNAL only for verilated*.cpp
 
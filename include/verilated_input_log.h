@@ -0,0 +1,183 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+///
+/// \file
+/// \brief Verilated model input record and replay
+///
+/// This file is included by models Verilated with --input-log.  The model
+/// uses VerilatedInputLog to record the values of its top-level inputs at
+/// each eval(), and to replay a recorded log without the testbench.
+///
+/// The log starts with the number and sizes of the inputs, so a log can
+/// only be replayed into the same model.  Each record then holds the time
+/// of an eval(), a bit per input that changed since the previous record,
+/// and the new values of the changed inputs.
+///
+//*************************************************************************
+
+#ifndef VERILATOR_VERILATED_INPUT_LOG_H_
+#define VERILATOR_VERILATED_INPUT_LOG_H_
+
+#include "verilatedos.h"
+
+#include "verilated.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+//=============================================================================
+// VerilatedInputLog
+/// Record or replay of the inputs of one model.
+///
+/// This class is not thread safe, it must be called by a single thread
+
+class VerilatedInputLog final {
+    // TYPES
+    struct Input final {
+        void* m_datap;  // Input storage in the model
+        size_t m_bytes;  // Size of input storage
+        size_t m_offset;  // Offset of previous value in m_prev
+    };
+
+    // MEMBERS
+    std::FILE* m_fp = nullptr;  // Log file
+    const bool m_replay;  // Replaying, else recording
+    bool m_started = false;  // Header written or checked
+    std::vector<Input> m_inputs;  // Inputs, in log order
+    std::vector<uint8_t> m_prev;  // Input values of previous record
+    std::vector<uint8_t> m_changed;  // Bit per input that changed
+    uint64_t m_pendingTime = 0;  // Time of record read ahead by replaySkip()
+    bool m_pending = false;  // Record read ahead by replaySkip() not yet returned
+
+    static constexpr size_t MAGIC_BYTES = 8;
+    static const char* magic() { return "vltinlg1"; }
+
+public:
+    // CONSTRUCTORS
+    /// Open log for recording, or for replay if 'replay'; check isOpen() for errors
+    VerilatedInputLog(const char* filenamep, bool replay)
+        : m_replay{replay} {
+        m_fp = std::fopen(filenamep, replay ? "rb" : "wb");
+    }
+    ~VerilatedInputLog() {
+        if (m_fp) std::fclose(m_fp);
+    }
+    VL_UNCOPYABLE(VerilatedInputLog);
+
+private:
+    // PRIVATE METHODS
+    bool readBytes(void* datap, size_t bytes) {
+        if (VL_UNLIKELY(!m_fp)) return false;
+        return std::fread(datap, 1, bytes, m_fp) == bytes;
+    }
+    void writeBytes(const void* datap, size_t bytes) {
+        if (VL_UNLIKELY(!m_fp)) return;
+        if (VL_UNLIKELY(std::fwrite(datap, 1, bytes, m_fp) != bytes)) {
+            VL_FATAL_MT(__FILE__, __LINE__, "", "Cannot write input log");
+        }
+    }
+    // Write, or read and check, the input count and sizes
+    bool start() {
+        m_started = true;
+        m_changed.resize((m_inputs.size() + 7) / 8);
+        std::vector<uint64_t> sizes;
+        sizes.push_back(m_inputs.size());
+        for (const Input& input : m_inputs) sizes.push_back(input.m_bytes);
+        if (!m_replay) {
+            writeBytes(magic(), MAGIC_BYTES);
+            writeBytes(sizes.data(), sizes.size() * sizeof(uint64_t));
+            return true;
+        }
+        char gotMagic[MAGIC_BYTES];
+        std::vector<uint64_t> gotSizes(sizes.size());
+        if (!readBytes(gotMagic, MAGIC_BYTES) || std::memcmp(gotMagic, magic(), MAGIC_BYTES)
+            || !readBytes(gotSizes.data(), gotSizes.size() * sizeof(uint64_t))
+            || gotSizes != sizes) {
+            VL_FATAL_MT(__FILE__, __LINE__, "", "Input log does not match the model");
+            return false;
+        }
+        return true;
+    }
+    bool replayRead(uint64_t& time) {
+        if (VL_UNLIKELY(!m_started) && !start()) return false;
+        if (!readBytes(&time, sizeof(time))) return false;
+        if (!readBytes(m_changed.data(), m_changed.size())) return false;
+        for (size_t i = 0; i < m_inputs.size(); ++i) {
+            if (!(m_changed[i / 8] & (1 << (i % 8)))) continue;
+            const Input& input = m_inputs[i];
+            if (!readBytes(input.m_datap, input.m_bytes)) return false;
+        }
+        return true;
+    }
+
+public:
+    // METHODS
+    /// Return true if the log file is open
+    bool isOpen() const { return m_fp != nullptr; }
+    /// Return true if replaying
+    bool replaying() const { return m_replay; }
+    /// Add an input, before the first record
+    void addInput(void* datap, size_t bytes) {
+        m_inputs.push_back(Input{datap, bytes, m_prev.size()});
+        // Start from all ones, so the first record holds every input
+        m_prev.resize(m_prev.size() + bytes, 0xff);
+    }
+    /// Record the inputs of an eval() at the given time
+    void record(uint64_t time) {
+        if (VL_UNLIKELY(!m_started)) start();
+        std::fill(m_changed.begin(), m_changed.end(), 0);
+        for (size_t i = 0; i < m_inputs.size(); ++i) {
+            const Input& input = m_inputs[i];
+            if (std::memcmp(&m_prev[input.m_offset], input.m_datap, input.m_bytes)) {
+                m_changed[i / 8] |= 1 << (i % 8);
+            }
+        }
+        writeBytes(&time, sizeof(time));
+        writeBytes(m_changed.data(), m_changed.size());
+        for (size_t i = 0; i < m_inputs.size(); ++i) {
+            if (!(m_changed[i / 8] & (1 << (i % 8)))) continue;
+            const Input& input = m_inputs[i];
+            writeBytes(input.m_datap, input.m_bytes);
+            std::memcpy(&m_prev[input.m_offset], input.m_datap, input.m_bytes);
+        }
+    }
+    /// Read the next record into the inputs, and set 'time' to its time.
+    /// Return false at the end of the log.
+    bool replay(uint64_t& time) {
+        if (m_pending) {
+            m_pending = false;
+            time = m_pendingTime;
+            return true;
+        }
+        return replayRead(time);
+    }
+    /// Apply the inputs of records before the given time without returning
+    /// them, e.g. to resume a replay from a restored checkpoint
+    void replaySkip(uint64_t beforeTime) {
+        uint64_t time;
+        while (!m_pending && replayRead(time)) {
+            if (time >= beforeTime) {
+                m_pending = true;
+                m_pendingTime = time;
+            }
+        }
+    }
+    /// Flush recorded data to the file
+    void flush() {
+        if (m_fp) std::fflush(m_fp);
+    }
+};
+
+#endif  // Guard
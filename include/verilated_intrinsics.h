@@ -38,6 +38,13 @@
 #  define VL_HAVE_AVX2 1
 #  include <immintrin.h>
 # endif
+# if defined(__AVX512F__) && defined(VL_HAVE_AVX2) && !defined(VL_DISABLE_AVX512)
+#  define VL_HAVE_AVX512 1
+# endif
+# if defined(__ARM_NEON) && defined(__aarch64__) && !defined(VL_DISABLE_NEON)
+#  define VL_HAVE_NEON 1
+#  include <arm_neon.h>
+# endif
 #endif
 
 // clang-format on
@@ -0,0 +1,99 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+///
+/// \file
+/// \brief Verilated batch simulation of independent model lanes
+///
+/// This file is for inclusion by user wrapper code that runs many short,
+/// independent simulations of the same Verilated model.  Each lane is a
+/// separate model instance with its own VerilatedContext, so each has its
+/// own time, plusargs and $finish state.  VlLanes::eval() advances all
+/// lanes that have not yet finished, back to back, so the lanes share the
+/// model's code in the instruction cache.
+///
+//*************************************************************************
+
+#ifndef VERILATOR_VERILATED_LANES_H_
+#define VERILATOR_VERILATED_LANES_H_
+
+#include "verilatedos.h"
+
+#include "verilated.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+//=============================================================================
+// VlLanes
+/// Set of independent lanes of the Verilated model T_Model.
+/// Lanes that have reached $finish are masked out of eval() and timeInc().
+
+template <class T_Model>
+class VlLanes final {
+    // MEMBERS
+    std::vector<std::unique_ptr<VerilatedContext>> m_contexts;  // Per lane context
+    std::vector<std::unique_ptr<T_Model>> m_models;  // Per lane model, destroyed before contexts
+
+public:
+    // CONSTRUCTORS
+    /// Create 'lanes' model instances named "<name>_<lane>".  Set per lane
+    /// arguments with context(lane).commandArgs() before the first eval().
+    explicit VlLanes(size_t lanes, const char* name = "TOP") {
+        m_contexts.reserve(lanes);
+        m_models.reserve(lanes);
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            m_contexts.emplace_back(new VerilatedContext);
+            const std::string laneName = std::string{name} + "_" + std::to_string(lane);
+            m_models.emplace_back(new T_Model{m_contexts.back().get(), laneName.c_str()});
+        }
+    }
+    VL_UNCOPYABLE(VlLanes);
+
+    // METHODS
+    /// Number of lanes
+    size_t lanes() const { return m_models.size(); }
+    /// Model of the given lane, to set inputs and read outputs
+    T_Model& operator[](size_t lane) { return *m_models[lane]; }
+    const T_Model& operator[](size_t lane) const { return *m_models[lane]; }
+    /// Context of the given lane
+    VerilatedContext& context(size_t lane) { return *m_contexts[lane]; }
+    /// Return if the given lane has finished
+    bool gotFinish(size_t lane) const { return m_contexts[lane]->gotFinish(); }
+    /// Return number of lanes that have not finished
+    size_t active() const {
+        size_t count = 0;
+        for (const auto& contextp : m_contexts) count += !contextp->gotFinish();
+        return count;
+    }
+    /// Return if all lanes have finished
+    bool gotFinish() const { return active() == 0; }
+    /// Evaluate all lanes that have not finished
+    void eval() {
+        for (size_t lane = 0; lane < m_models.size(); ++lane) {
+            if (!m_contexts[lane]->gotFinish()) m_models[lane]->eval();
+        }
+    }
+    /// Advance time of all lanes that have not finished
+    void timeInc(uint64_t add) {
+        for (const auto& contextp : m_contexts) {
+            if (!contextp->gotFinish()) contextp->timeInc(add);
+        }
+    }
+    /// Call final() on all lanes
+    void final() {
+        for (const auto& modelp : m_models) modelp->final();
+    }
+};
+
+#endif  // Guard
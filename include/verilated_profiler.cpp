@@ -22,15 +22,26 @@
 
 #include "verilated_threads.h"
 
+#include <cerrno>
+#include <cstring>
 #include <fstream>
 #include <string>
 
+#ifdef __linux
+# include <linux/perf_event.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
 //=============================================================================
 // Globals
 
 // Internal note: Globals may multi-construct, see verilated.cpp top.
 
 thread_local VlExecutionProfiler::ExecutionTrace VlExecutionProfiler::t_trace;
+thread_local int VlExecutionProfiler::t_counterFd = -1;
+thread_local VlExecutionProfiler::CountersTrace VlExecutionProfiler::t_counterBegins;
+thread_local VlExecutionProfiler::CountersTrace VlExecutionProfiler::t_counters;
 
 constexpr const char* const VlExecutionRecord::s_ascii[];
 
@@ -51,6 +62,11 @@ VlExecutionProfiler::VlExecutionProfiler(VerilatedContext& context)
 }
 
 void VlExecutionProfiler::configure() {
+    // Collect continuously for an in-process consumer
+    if (VL_UNLIKELY(m_consumerp)) {
+        m_enabled = true;
+        return;
+    }
 
     if (VL_UNLIKELY(m_enabled)) {
         --m_windowCount;
@@ -108,17 +124,77 @@ void VlExecutionProfiler::setupThread(uint32_t threadId) {
     // Reserve some space in the thread-local profiling buffer, in order to try to avoid malloc
     // while profiling.
     t_trace.reserve(RESERVED_TRACE_CAPACITY);
+    if (m_context.profExecCounters()) {
+        countersOpen();
+        t_counterBegins.reserve(RESERVED_TRACE_CAPACITY);
+        t_counters.reserve(RESERVED_TRACE_CAPACITY);
+    }
     // Register thread-local buffer in list of all buffers
     bool exists;
     {
         const VerilatedLockGuard lock{m_mutex};
         exists = !m_traceps.emplace(threadId, &t_trace).second;
+        m_counterps.emplace(threadId, &t_counters);
     }
     if (VL_UNLIKELY(exists)) {
         VL_FATAL_MT(__FILE__, __LINE__, "", "multiple initialization of profiler on some thread");
     }
 }
 
+void VlExecutionProfiler::countersOpen() {
+#ifdef __linux
+    static const uint64_t s_configs[NUM_COUNTERS]
+        = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+           PERF_COUNT_HW_BRANCH_MISSES};
+    int fds[NUM_COUNTERS];
+    for (size_t i = 0; i < NUM_COUNTERS; ++i) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = s_configs[i];
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        // Count this thread on any CPU, all in the group of the first counter
+        fds[i] = static_cast<int>(
+            syscall(__NR_perf_event_open, &attr, 0, -1, i ? fds[0] : -1, 0));
+        if (VL_UNLIKELY(fds[i] < 0)) {
+            for (size_t j = 0; j < i; ++j) close(fds[j]);
+            static std::atomic<bool> s_warned{false};
+            if (!s_warned.exchange(true)) {
+                VL_PRINTF_MT("%%Warning: +verilator+prof+exec+counters: Cannot open hardware "
+                             "performance counters (%s), not recording them\n",
+                             std::strerror(errno));
+            }
+            return;
+        }
+    }
+    // Only the group leader is read; the others stay open for the thread's lifetime
+    t_counterFd = fds[0];
+#else
+    static std::atomic<bool> s_warned{false};
+    if (!s_warned.exchange(true)) {
+        VL_PRINTF_MT("%%Warning: +verilator+prof+exec+counters: Hardware performance "
+                     "counters are only supported on Linux\n");
+    }
+#endif
+}
+
+void VlExecutionProfiler::countersRead(Counters& counts) {
+#ifdef __linux
+    struct {
+        uint64_t m_nr;  // Number of counters
+        uint64_t m_values[NUM_COUNTERS];  // Counter values, in opening order
+    } data;
+    if (VL_LIKELY(read(t_counterFd, &data, sizeof(data)) == sizeof(data))) {
+        for (size_t i = 0; i < NUM_COUNTERS; ++i) counts[i] = data.m_values[i];
+        return;
+    }
+#endif
+    counts.fill(0);
+}
+
 void VlExecutionProfiler::clear() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     for (const auto& pair : m_traceps) {
@@ -127,6 +203,27 @@ void VlExecutionProfiler::clear() VL_MT_SAFE_EXCLUDES(m_mutex) {
         tracep->clear();
         tracep->reserve(reserve);
     }
+    for (const auto& pair : m_counterps) pair.second->clear();
+}
+
+void VlExecutionProfiler::consumer(VlExecutionConsumer* consumerp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    clear();
+    const VerilatedLockGuard lock{m_mutex};
+    m_consumerp = consumerp;
+    // Abandon any +verilator+prof+exec window in progress
+    m_enabled = false;
+    m_windowCount = 0;
+}
+
+void VlExecutionProfiler::poll() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (!m_consumerp) return;
+    for (const auto& pair : m_traceps) {
+        ExecutionTrace* const tracep = pair.second;
+        for (const VlExecutionRecord& er : *tracep) m_consumerp->record(pair.first, er);
+        tracep->clear();  // Keeps the capacity, so no malloc while recording
+    }
+    for (const auto& pair : m_counterps) pair.second->clear();
 }
 
 void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
@@ -139,7 +236,7 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
 
     // TODO Perhaps merge with verilated_coverage output format, so can
     // have a common merging and reporting tool, etc.
-    fprintf(fp, "VLPROFVERSION 2.2 # Verilator execution profile version 2.2\n");
+    fprintf(fp, "VLPROFVERSION 2.3 # Verilator execution profile version 2.3\n");
     fprintf(fp, "VLPROF arg +verilator+prof+exec+start+%" PRIu64 "\n",
             Verilated::threadContextp()->profExecStart());
     fprintf(fp, "VLPROF arg +verilator+prof+exec+window+%u\n",
@@ -159,6 +256,8 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
     }
     fprintf(fp, "VLPROF stat threads %u\n", threads);
     fprintf(fp, "VLPROF stat yields %" PRIu64 "\n", VlMTaskVertex::yields());
+    fprintf(fp, "VLPROF stat parks %" PRIu64 "\n", VlMTaskVertex::parks());
+    fprintf(fp, "VLPROF stat steals %" PRIu64 "\n", VlWorkerThread::steals());
 
     // Copy /proc/cpuinfo into this output so verilator_gantt can be run on
     // a different machine
@@ -175,6 +274,17 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
         ExecutionTrace* const tracep = pair.second;
         if (tracep->empty()) continue;
         fprintf(fp, "VLPROFTHREAD %" PRIu32 "\n", threadId);
+        const CountersTrace& counters = *m_counterps[threadId];
+        size_t countersIndex = 0;
+        // With +verilator+prof+exec+counters, append the counts of each section or mtask
+        const auto printCounters = [&]() {
+            if (countersIndex >= counters.size()) return;
+            const Counters& counts = counters[countersIndex++];
+            fprintf(fp,
+                    " cycles %" PRIu64 " instrs %" PRIu64 " llcMisses %" PRIu64
+                    " branchMisses %" PRIu64,
+                    counts[0], counts[1], counts[2], counts[3]);
+        };
 
         for (const VlExecutionRecord& er : *tracep) {
             const char* const name = VlExecutionRecord::s_ascii[static_cast<uint8_t>(er.m_type)];
@@ -183,6 +293,9 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
 
             switch (er.m_type) {
             case VlExecutionRecord::Type::SECTION_POP:
+                printCounters();
+                fprintf(fp, "\n");
+                break;
             case VlExecutionRecord::Type::EXEC_GRAPH_BEGIN:
             case VlExecutionRecord::Type::EXEC_GRAPH_END:
                 // No payload
@@ -201,7 +314,9 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
             }
             case VlExecutionRecord::Type::MTASK_END: {
                 const auto& payload = er.m_payload.mtaskEnd;
-                fprintf(fp, " predictCost %u\n", payload.m_predictCost);
+                fprintf(fp, " predictCost %u", payload.m_predictCost);
+                printCounters();
+                fprintf(fp, "\n");
                 break;
             }
             case VlExecutionRecord::Type::THREAD_SCHEDULE_WAIT_BEGIN:
@@ -14,8 +14,9 @@
 /// \file
 /// \brief Verilated run-time profiling header
 ///
-/// This file is not part of the Verilated public-facing API.
-/// It is only for internal use by Verilated library routines.
+/// This file is not part of the Verilated public-facing API, except for
+/// VlExecutionConsumer and VlExecutionProfiler::get/consumer/poll, which
+/// user code may use to consume --prof-exec records in-process.
 ///
 //=============================================================================
 
@@ -26,6 +27,7 @@
 
 #include "verilated.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cassert>
@@ -71,6 +73,7 @@ VL_ATTR_ALWINLINE QData VL_CPU_TICK() {
 class VlExecutionRecord final {
     friend class VlExecutionProfiler;
 
+public:
     // TYPES
     enum class Type : uint8_t {
 #define VL_FOREACH_MACRO(id, name) id,
@@ -78,6 +81,7 @@ class VlExecutionRecord final {
 #undef VL_FOREACH_MACRO
     };
 
+private:
     static constexpr const char* const s_ascii[] = {
 #define VL_FOREACH_MACRO(id, name) name,
         FOREACH_VlExecutionRecord_TYPE(VL_FOREACH_MACRO)
@@ -115,22 +119,11 @@ public:
     VlExecutionRecord() = default;
 
     // METHODS
-    void sectionPush(const char* name) {
-        m_payload.sectionPush.m_name = name;
-        m_type = Type::SECTION_PUSH;
-    }
-    void sectionPop() { m_type = Type::SECTION_POP; }
-    void mtaskBegin(uint32_t id, uint32_t predictStart, const char* hierBlock = "") {
-        m_payload.mtaskBegin.m_id = id;
-        m_payload.mtaskBegin.m_predictStart = predictStart;
-        m_payload.mtaskBegin.m_cpu = VlOs::getcpu();
-        m_payload.mtaskBegin.m_hierBlock = hierBlock;
-        m_type = Type::MTASK_BEGIN;
-    }
-    void mtaskEnd(uint32_t predictCost) {
-        m_payload.mtaskEnd.m_predictCost = predictCost;
-        m_type = Type::MTASK_END;
-    }
+    // Defined after VlExecutionProfiler, as they sample its hardware counters
+    inline void sectionPush(const char* name);
+    inline void sectionPop();
+    inline void mtaskBegin(uint32_t id, uint32_t predictStart, const char* hierBlock = "");
+    inline void mtaskEnd(uint32_t predictCost);
     void threadScheduleWaitBegin() {
         m_payload.threadScheduleWait.m_cpu = VlOs::getcpu();
         m_type = Type::THREAD_SCHEDULE_WAIT_BEGIN;
@@ -141,15 +134,48 @@ public:
     }
     void execGraphBegin() { m_type = Type::EXEC_GRAPH_BEGIN; }
     void execGraphEnd() { m_type = Type::EXEC_GRAPH_END; }
+
+    // ACCESSORS - for VlExecutionConsumer
+    Type type() const { return m_type; }
+    const char* typeName() const { return s_ascii[static_cast<uint8_t>(m_type)]; }
+    uint64_t tick() const { return m_tick; }  // CPU tick counter when recorded
+    // SECTION_PUSH only
+    const char* sectionName() const { return m_payload.sectionPush.m_name; }
+    // MTASK_BEGIN only
+    uint32_t mtaskId() const { return m_payload.mtaskBegin.m_id; }
+    uint32_t mtaskPredictStart() const { return m_payload.mtaskBegin.m_predictStart; }
+    const char* mtaskHierBlock() const { return m_payload.mtaskBegin.m_hierBlock; }
+    // MTASK_END only
+    uint32_t mtaskPredictCost() const { return m_payload.mtaskEnd.m_predictCost; }
+    // MTASK_BEGIN, THREAD_SCHEDULE_WAIT_BEGIN and THREAD_SCHEDULE_WAIT_END only
+    uint32_t cpu() const {
+        return m_type == Type::MTASK_BEGIN ? m_payload.mtaskBegin.m_cpu
+                                           : m_payload.threadScheduleWait.m_cpu;
+    }
 };
 
 static_assert(std::is_trivially_destructible<VlExecutionRecord>::value,
               "VlExecutionRecord should be trivially destructible for fast buffer clearing");
 
+//=============================================================================
+// VlExecutionConsumer receives execution records in-process, see VlExecutionProfiler::poll
+
+class VlExecutionConsumer VL_NOT_FINAL {
+public:
+    virtual ~VlExecutionConsumer() = default;
+    // Called for each record, in recording order within each thread.  Sections
+    // ("eval", "loop <region>", "trig <region>" and so on) nest with SECTION_PUSH and
+    // SECTION_POP, so each "trig <region>" inside a "loop <region>" is one iteration of
+    // that region's convergence loop.
+    virtual void record(uint32_t threadId, const VlExecutionRecord& rec) = 0;
+};
+
 //=============================================================================
 // VlExecutionProfiler is for collecting profiling data about model execution
 
 class VlExecutionProfiler final : public VerilatedVirtualBase {
+    friend class VlExecutionRecord;
+
     // CONSTANTS
 
     // In order to try to avoid dynamic memory allocations during the actual profiling phase,
@@ -166,19 +192,55 @@ class VlExecutionProfiler final : public VerilatedVirtualBase {
     // verilated.cpp top.
     using ExecutionTrace = std::vector<VlExecutionRecord>;
 
+public:
+    // Hardware counters sampled with +verilator+prof+exec+counters: cycles,
+    // instructions, last level cache misses and branch misses
+    static constexpr size_t NUM_COUNTERS = 4;
+    using Counters = std::array<uint64_t, NUM_COUNTERS>;
+
+private:
+    // Counts between begin and end of each SECTION_POP and MTASK_END record, in order
+    using CountersTrace = std::vector<Counters>;
+
     // STATE
     VerilatedContext& m_context;  // The context this profiler is under
     static thread_local ExecutionTrace t_trace;  // thread-local trace buffers
+    static thread_local int t_counterFd;  // perf_event group of this thread, or -1 if none
+    static thread_local CountersTrace t_counterBegins;  // Counts at each open begin record
+    static thread_local CountersTrace t_counters;  // thread-local counter buffers
     mutable VerilatedMutex m_mutex;
     // Map from thread id to &t_trace of given thread
     std::map<uint32_t, ExecutionTrace*> m_traceps VL_GUARDED_BY(m_mutex);
+    // Map from thread id to &t_counters of given thread
+    std::map<uint32_t, CountersTrace*> m_counterps VL_GUARDED_BY(m_mutex);
 
     bool m_enabled = false;  // Is profiling currently enabled
+    VlExecutionConsumer* m_consumerp = nullptr;  // In-process consumer, if any
 
     uint64_t m_tickBegin = 0;  // Sample time (rdtsc() on x86) at beginning of collection
     uint64_t m_lastStartReq = 0;  // Last requested profiling start (in simulation time)
     uint32_t m_windowCount = 0;  // Track our position in the cache warmup and profile window
 
+    // Open the hardware counters of the current thread
+    static void countersOpen();
+    // Read the hardware counters of the current thread
+    static void countersRead(Counters& counts);
+    static void countersBegin() {
+        t_counterBegins.emplace_back();
+        countersRead(t_counterBegins.back());
+    }
+    static void countersEnd() {
+        t_counters.emplace_back();
+        Counters& counts = t_counters.back();
+        countersRead(counts);
+        if (VL_LIKELY(!t_counterBegins.empty())) {
+            for (size_t i = 0; i < NUM_COUNTERS; ++i) counts[i] -= t_counterBegins.back()[i];
+            t_counterBegins.pop_back();
+        } else {  // Began before counting started
+            counts.fill(0);
+        }
+    }
+
 public:
     // CONSTRUCTOR
     explicit VlExecutionProfiler(VerilatedContext& context);
@@ -202,14 +264,50 @@ public:
     // Write profiling data into file
     void dump(const char* filenamep, uint64_t tickEnd) VL_MT_SAFE_EXCLUDES(m_mutex);
 
+    // Attach an in-process consumer, or detach with nullptr.  While attached, records are
+    // collected continuously from the next 'eval', and are only passed to the consumer by
+    // poll(), not written to the +verilator+prof+exec+file.  Call between 'eval's only.
+    void consumer(VlExecutionConsumer* consumerp) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Pass all records collected since the last poll to the consumer, then drop them.
+    // Call between 'eval's only, typically after each 'eval' so the buffers stay small.
+    void poll() VL_MT_SAFE_EXCLUDES(m_mutex);
+
     // Passed to VerilatedContext to create the VlExecutionProfiler profiler instance
     static VerilatedVirtualBase* construct(VerilatedContext& context);
+    // Return the profiler of the given context, creating it if needed.  Records are only
+    // produced by models Verilated with --prof-exec.
+    static VlExecutionProfiler* get(VerilatedContext& context) {
+        return static_cast<VlExecutionProfiler*>(context.enableExecutionProfiler(&construct));
+    }
 };
 
+void VlExecutionRecord::sectionPush(const char* name) {
+    m_payload.sectionPush.m_name = name;
+    m_type = Type::SECTION_PUSH;
+    if (VL_UNLIKELY(VlExecutionProfiler::t_counterFd >= 0)) VlExecutionProfiler::countersBegin();
+}
+void VlExecutionRecord::sectionPop() {
+    m_type = Type::SECTION_POP;
+    if (VL_UNLIKELY(VlExecutionProfiler::t_counterFd >= 0)) VlExecutionProfiler::countersEnd();
+}
+void VlExecutionRecord::mtaskBegin(uint32_t id, uint32_t predictStart, const char* hierBlock) {
+    m_payload.mtaskBegin.m_id = id;
+    m_payload.mtaskBegin.m_predictStart = predictStart;
+    m_payload.mtaskBegin.m_cpu = VlOs::getcpu();
+    m_payload.mtaskBegin.m_hierBlock = hierBlock;
+    m_type = Type::MTASK_BEGIN;
+    if (VL_UNLIKELY(VlExecutionProfiler::t_counterFd >= 0)) VlExecutionProfiler::countersBegin();
+}
+void VlExecutionRecord::mtaskEnd(uint32_t predictCost) {
+    m_payload.mtaskEnd.m_predictCost = predictCost;
+    m_type = Type::MTASK_END;
+    if (VL_UNLIKELY(VlExecutionProfiler::t_counterFd >= 0)) VlExecutionProfiler::countersEnd();
+}
+
 //=============================================================================
 // VlPgoProfiler is for collecting profiling data for PGO
 
-template <std::size_t N_Entries>
+template <std::size_t N_Entries, std::size_t N_Branches = 0>
 class VlPgoProfiler final {
     // TYPES
     struct Record final {
@@ -220,6 +318,10 @@ class VlPgoProfiler final {
     // Counters are stored packed, all together to reduce cache effects
     std::array<uint64_t, N_Entries> m_counters{};  // Time spent on this record
     std::vector<Record> m_records;  // Record information
+    // Branch counters, {count, taken} per branch.  Branches shared by several
+    // instances may be counted from several threads, so counts are approximate.
+    std::array<uint64_t, 2 * N_Branches> m_branchCounts{};
+    std::vector<Record> m_branchRecords;  // Branch record information
 
 public:
     // METHODS
@@ -236,11 +338,20 @@ public:
         m_counters[counter] -= VL_CPU_TICK();
     }
     void stopCounter(size_t counter) { m_counters[counter] += VL_CPU_TICK(); }
+    void addBranch(size_t counter, const std::string& name) {
+        VL_DEBUG_IF(assert(counter < N_Branches););
+        m_branchRecords.emplace_back(Record{name, counter});
+    }
+    // Count one execution of a branch
+    void branch(size_t counter, bool taken) {
+        ++m_branchCounts[2 * counter];
+        m_branchCounts[2 * counter + 1] += taken;
+    }
 };
 
-template <std::size_t N_Entries>
-void VlPgoProfiler<N_Entries>::write(const char* modelp, const std::string& filename,
-                                     bool firstHierCall) VL_MT_SAFE {
+template <std::size_t N_Entries, std::size_t N_Branches>
+void VlPgoProfiler<N_Entries, N_Branches>::write(const char* modelp, const std::string& filename,
+                                                 bool firstHierCall) VL_MT_SAFE {
     static VerilatedMutex s_mutex;
     const VerilatedLockGuard lock{s_mutex};
 
@@ -271,6 +382,86 @@ void VlPgoProfiler<N_Entries>::write(const char* modelp, const std::string& file
         fprintf(fp, "profile_data -model \"%s\" -mtask \"%s\" -cost 64'd%" PRIu64 "\n", modelp,
                 rec.m_name.c_str(), m_counters[rec.m_counterNumber]);
     }
+    for (const Record& rec : m_branchRecords) {
+        const uint64_t count = m_branchCounts[2 * rec.m_counterNumber];
+        if (!count) continue;
+        fprintf(fp,
+                "profile_data -model \"%s\" -branch \"%s\" -taken 64'd%" PRIu64
+                " -cost 64'd%" PRIu64 "\n",
+                modelp, rec.m_name.c_str(), m_branchCounts[2 * rec.m_counterNumber + 1], count);
+    }
+
+    std::fclose(fp);
+}
+
+//=============================================================================
+// VlBlockProfiler is for collecting time spent per source block, see --prof-blocks
+
+template <std::size_t N_Entries>
+class VlBlockProfiler final {
+    // TYPES
+    struct Record final {
+        const std::string m_name;  // Source file and line of block
+        const size_t m_counterNumber = 0;  // Which counter has data
+    };
+
+    // Counters are stored packed, all together to reduce cache effects
+    std::array<uint64_t, N_Entries> m_ticks{};  // Time spent in this block
+    std::array<uint64_t, N_Entries> m_calls{};  // Times this block was executed
+    std::vector<Record> m_records;  // Record information
+
+public:
+    // METHODS
+    VlBlockProfiler() = default;
+    ~VlBlockProfiler() = default;
+    void write(const char* modelp, const std::string& filename, bool firstHierCall) VL_MT_SAFE;
+    void addCounter(size_t counter, const std::string& name) {
+        VL_DEBUG_IF(assert(counter < N_Entries););
+        m_records.emplace_back(Record{name, counter});
+    }
+    void startCounter(size_t counter) {
+        // -= so when we add end time in stopCounter, the net effect is adding the difference,
+        // without needing to hold onto a temporary
+        m_ticks[counter] -= VL_CPU_TICK();
+        ++m_calls[counter];
+    }
+    void stopCounter(size_t counter) { m_ticks[counter] += VL_CPU_TICK(); }
+};
+
+template <std::size_t N_Entries>
+void VlBlockProfiler<N_Entries>::write(const char* modelp, const std::string& filename,
+                                       bool firstHierCall) VL_MT_SAFE {
+    static VerilatedMutex s_mutex;
+    const VerilatedLockGuard lock{s_mutex};
+
+    // As with VlPgoProfiler, the first call creates the file, later models append
+    static bool s_firstCall = firstHierCall;
+
+    VL_DEBUG_IF(VL_DBG_MSGF("+prof+blocks+file writing to '%s'\n", filename.c_str()););
+
+    FILE* const fp = std::fopen(filename.c_str(), s_firstCall ? "w" : "a");
+    if (VL_UNLIKELY(!fp)) {
+        VL_FATAL_MT(filename.c_str(), 0, "", "+prof+blocks+file file not writable");
+    }
+    if (s_firstCall) {
+        fprintf(fp, "# Verilated model per source block profile, hottest first\n");
+        fprintf(fp, "# model ticks percent calls block\n");
+    }
+    s_firstCall = false;
+
+    uint64_t total = 0;
+    for (const uint64_t ticks : m_ticks) total += ticks;
+    std::vector<const Record*> recordps;
+    for (const Record& rec : m_records) recordps.push_back(&rec);
+    std::stable_sort(recordps.begin(), recordps.end(), [this](const Record* ap, const Record* bp) {
+        return m_ticks[ap->m_counterNumber] > m_ticks[bp->m_counterNumber];
+    });
+    for (const Record* const recp : recordps) {
+        const uint64_t ticks = m_ticks[recp->m_counterNumber];
+        const double percent = total ? (100.0 * ticks / total) : 0.0;
+        fprintf(fp, "VLPROFBLOCK %s %" PRIu64 " %.2f %" PRIu64 " %s\n", modelp, ticks, percent,
+                m_calls[recp->m_counterNumber], recp->m_name.c_str());
+    }
 
     std::fclose(fp);
 }
@@ -22,6 +22,7 @@
 
 #include "verilated_random.h"
 
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -43,6 +44,10 @@
 #if defined(_WIN32) || defined(__MINGW32__)
 # include <io.h>  // open, read, write, close
 #endif
+
+#ifdef VL_SOLVER_LIBZ3
+# include <z3.h>
+#endif
 // clang-format on
 
 class Process final : private std::streambuf, public std::iostream {
@@ -104,6 +109,11 @@ public:
         , m_cmd{cmd} {
         open(cmd);
     }
+    ~Process() override {
+        // Closing its input ends the subprocess
+        closeFds();
+        wait_report();
+    }
 
     void wait_report() {
         if (m_pidExited) return;
@@ -212,14 +222,72 @@ public:
     }
 };
 
-static Process& getSolver() {
-    static Process s_solver;
-    static bool s_done = false;
+#ifdef VL_SOLVER_LIBZ3
+// Solver evaluating SMT-LIB2 commands in the linked Z3 library.  Commands are
+// buffered until a response is read, so there is no subprocess or pipe.
+class LibZ3Solver final : private std::streambuf, public std::iostream {
+    Z3_context m_ctx = nullptr;  // Z3 context, holds the assertions between commands
+    std::string m_commands;  // Commands written but not yet evaluated
+    std::string m_response;  // Response of the last evaluated commands
+
+public:
+    typedef std::streambuf::traits_type traits_type;
+
+protected:
+    int overflow(int c = traits_type::eof()) override {
+        if (c != traits_type::eof()) m_commands += static_cast<char>(c);
+        return traits_type::not_eof(c);
+    }
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        m_commands.append(s, n);
+        return n;
+    }
+    int underflow() override {
+        if (m_commands.empty()) return traits_type::eof();
+        const char* const responsep = Z3_eval_smtlib2_string(m_ctx, m_commands.c_str());
+        m_commands.clear();
+        if (Z3_get_error_code(m_ctx) != Z3_OK) {
+            const std::string msg
+                = std::string{"Z3 error: "} + Z3_get_error_msg(m_ctx, Z3_get_error_code(m_ctx));
+            VL_WARN_MT("", 0, "randomize", msg.c_str());
+            return traits_type::eof();
+        }
+        m_response = responsep;  // Z3 owns responsep only until the next call
+        if (m_response.empty()) return traits_type::eof();
+        setg(&m_response[0], &m_response[0], &m_response[0] + m_response.size());
+        return traits_type::to_int_type(m_response[0]);
+    }
+
+public:
+    LibZ3Solver()
+        : std::streambuf{}
+        , std::iostream{this} {
+        const Z3_config cfg = Z3_mk_config();
+        m_ctx = Z3_mk_context(cfg);
+        Z3_del_config(cfg);
+        // Report errors by error code, rather than the default of exiting
+        Z3_set_error_handler(m_ctx, nullptr);
+    }
+    ~LibZ3Solver() override { Z3_del_context(m_ctx); }
+};
+
+// Each thread has its own solver, so threads randomize concurrently
+static std::iostream& getSolver() {
+    static thread_local LibZ3Solver s_solver;
+    return s_solver;
+}
+#else
+// Each thread has its own solver subprocess, so threads randomize concurrently
+static std::iostream& getSolver() {
+    // Arguments first, so they are destroyed after the solver that refers to them
+    static thread_local std::vector<const char*> s_argv;
+    static thread_local std::string s_program;
+    static thread_local Process s_solver;
+    static thread_local bool s_done = false;
     if (s_done) return s_solver;
     s_done = true;
 
-    static std::vector<const char*> s_argv;
-    static std::string s_program = Verilated::threadContextp()->solverProgram();
+    s_program = Verilated::threadContextp()->solverProgram();
     s_argv.emplace_back(&s_program[0]);
     for (char* arg = &s_program[0]; *arg; ++arg) {
         if (*arg == ' ') {
@@ -250,6 +318,7 @@ static Process& getSolver() {
     while (getline(s_solver, s)) {}
     return s_solver;
 }
+#endif
 
 std::string readUntilBalanced(std::istream& stream) {
     std::string result;
@@ -370,42 +439,135 @@ bool VlRandomizer::next(VlRNG& rngr) {
     std::iostream& f = getSolver();
     if (!f) return false;
 
-    f << "(set-option :produce-models true)\n";
-    f << "(set-logic QF_ABV)\n";
-    f << "(define-fun __Vbv ((b Bool)) (_ BitVec 1) (ite b #b1 #b0))\n";
-    f << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
+    // The solver keeps the declarations at the outer level, and the
+    // constraints pushed above them, between calls.  So repeated randomize()
+    // calls with the same variables only resend the constraints if they
+    // changed, and calls with the same constraints only send the random
+    // constraints, which are pushed and popped.
+    // These are per thread, as is the solver
+    static thread_local std::string s_declarations;  // Declarations in the solver
+    static thread_local std::string s_constraints;  // Constraints pushed above declarations
+    static thread_local bool s_constraintsPushed = false;  // If s_constraints are in the solver
+    // Solutions solved ahead for the constraints in the solver, with +verilator+solver+batch
+    static thread_local std::deque<Solution> s_solutions;
+
+    std::ostringstream os;
+    os << "(set-option :produce-models true)\n";
+    os << "(set-logic QF_ABV)\n";
+    os << "(define-fun __Vbv ((b Bool)) (_ BitVec 1) (ite b #b1 #b0))\n";
+    os << "(define-fun __Vbool ((v (_ BitVec 1))) Bool (= #b1 v))\n";
+    std::shared_ptr<const ArrayInfoMap> arrVarsp;  // Shared by all array variables
     for (const auto& var : m_vars) {
         if (var.second->dimension() > 0) {
-            auto arrVarsp = std::make_shared<const ArrayInfoMap>(m_arr_vars);
+            if (!arrVarsp) arrVarsp = std::make_shared<const ArrayInfoMap>(m_arr_vars);
             var.second->setArrayInfo(arrVarsp);
         }
-        f << "(declare-fun " << var.first << " () ";
-        var.second->emitType(f);
-        f << ")\n";
+        os << "(declare-fun " << var.first << " () ";
+        var.second->emitType(os);
+        os << ")\n";
     }
+    std::string declarations = os.str();
+    if (declarations != s_declarations) {
+        if (!s_declarations.empty()) f << "(reset)\n";
+        f << declarations;
+        s_declarations = std::move(declarations);
+        s_constraintsPushed = false;
+        s_solutions.clear();
+    }
+
+    os.str("");
     for (const std::string& constraint : m_constraints) {
-        f << "(assert (= #b1 " << constraint << "))\n";
+        os << "(assert (= #b1 " << constraint << "))\n";
     }
+    std::string constraints = os.str();
+    if (!s_constraintsPushed || constraints != s_constraints) {
+        if (s_constraintsPushed) f << "(pop 1)\n";
+        f << "(push 1)\n";
+        f << constraints;
+        s_constraints = std::move(constraints);
+        s_constraintsPushed = true;
+        s_solutions.clear();
+    }
+    if (!s_solutions.empty()) {
+        applySolution(s_solutions.front());
+        s_solutions.pop_front();
+        return true;
+    }
+    // Array elements are named by select expressions, so are not batched
+    const uint32_t batch = m_arr_vars.empty() ? Verilated::threadContextp()->solverBatch() : 1;
+    Solution solution;
     f << "(check-sat)\n";
 
-    bool sat = parseSolution(f);
+    bool sat = parseSolution(f, batch > 1 ? &solution : nullptr);
     if (!sat) {
         f << "(reset)\n";
+        s_declarations.clear();
+        s_constraintsPushed = false;
         return false;
     }
-    for (int i = 0; i < _VL_SOLVER_HASH_LEN_TOTAL && sat; ++i) {
+    if (batch <= 1) {
+        f << "(push 1)\n";
+        for (int i = 0; i < _VL_SOLVER_HASH_LEN_TOTAL && sat; ++i) {
+            f << "(assert ";
+            randomConstraint(f, rngr, _VL_SOLVER_HASH_LEN);
+            f << ")\n";
+            f << "\n(check-sat)\n";
+            sat = parseSolution(f);
+        }
+        f << "(pop 1)\n";
+        return true;
+    }
+    // With batching, narrow to a random cell of the solutions by the same random
+    // constraints, keeping only those that leave it satisfiable.  Then list distinct
+    // solutions in that cell, each costing a single query, and hand them out in random order.
+    f << "(push 1)\n";
+    int pushed = 1;
+    for (int i = 0; i < _VL_SOLVER_HASH_LEN_TOTAL; ++i) {
+        f << "(push 1)\n";
+        ++pushed;
         f << "(assert ";
         randomConstraint(f, rngr, _VL_SOLVER_HASH_LEN);
         f << ")\n";
         f << "\n(check-sat)\n";
-        sat = parseSolution(f);
+        if (!parseSolution(f, &solution)) {
+            f << "(pop 1)\n";
+            --pushed;
+            break;
+        }
     }
-
-    f << "(reset)\n";
+    while (true) {
+        s_solutions.push_back(solution);
+        if (s_solutions.size() >= batch) break;
+        f << "(assert (not (and true";
+        for (const auto& nameValue : solution) {
+            f << " (= " << nameValue.first << ' ' << nameValue.second << ')';
+        }
+        f << ")))\n";
+        f << "(check-sat)\n";
+        if (!parseSolution(f, &solution)) break;  // No more solutions in the cell
+    }
+    for (int i = 0; i < pushed; ++i) f << "(pop 1)\n";
+    for (size_t i = s_solutions.size() - 1; i > 0; --i) {
+        std::swap(s_solutions[i], s_solutions[VL_RANDOM_RNG_I(rngr) % (i + 1)]);
+    }
+    applySolution(s_solutions.front());
+    s_solutions.pop_front();
     return true;
 }
 
-bool VlRandomizer::parseSolution(std::iostream& f) {
+void VlRandomizer::applySolution(const Solution& solution) const {
+    for (const auto& nameValue : solution) {
+        const auto it = m_vars.find(nameValue.first);
+        if (it == m_vars.end()) continue;
+        const VlRandomVar& varr = *it->second;
+        if (m_randmode && !varr.randModeIdxNone()) {
+            if (!(m_randmode->at(varr.randModeIdx()))) continue;
+        }
+        varr.set("", nameValue.second);
+    }
+}
+
+bool VlRandomizer::parseSolution(std::iostream& f, Solution* solutionp) {
     std::string sat;
     do { std::getline(f, sat); } while (sat == "");
 
@@ -417,15 +579,11 @@ bool VlRandomizer::parseSolution(std::iostream& f) {
         VL_WARN_MT(__FILE__, __LINE__, "randomize", str.c_str());
         return false;
     }
+    if (solutionp) solutionp->clear();
 
     f << "(get-value (";
-    for (const auto& var : m_vars) {
-        if (var.second->dimension() > 0) {
-            auto arrVarsp = std::make_shared<const ArrayInfoMap>(m_arr_vars);
-            var.second->setArrayInfo(arrVarsp);
-        }
-        var.second->emitGetValue(f);
-    }
+    // Array information was set by next()
+    for (const auto& var : m_vars) var.second->emitGetValue(f);
     f << "))\n";
     // Quasi-parse S-expression of the form ((x #xVALUE) (y #bVALUE) (z #xVALUE))
     char c;
@@ -452,6 +610,7 @@ bool VlRandomizer::parseSolution(std::iostream& f) {
             name = parseNestedSelect(selectExpr, indices);
         }
         std::getline(f, value, ')');
+        if (solutionp) solutionp->emplace_back(name, value);
         const auto it = m_vars.find(name);
         if (it == m_vars.end()) continue;
         const VlRandomVar& varr = *it->second;
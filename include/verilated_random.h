@@ -203,9 +203,13 @@ class VlRandomizer final {
     const VlQueue<CData>* m_randmode;  // rand_mode state;
     int m_index = 0;  // Internal counter for key generation
 
+    // TYPES
+    using Solution = std::vector<std::pair<std::string, std::string>>;  // Name and SMT value
+
     // PRIVATE METHODS
     void randomConstraint(std::ostream& os, VlRNG& rngr, int bits);
-    bool parseSolution(std::iostream& file);
+    bool parseSolution(std::iostream& file, Solution* solutionp = nullptr);
+    void applySolution(const Solution& solution) const;
 
 public:
     // CONSTRUCTORS
@@ -59,74 +59,16 @@
 #undef VL_SUB_T
 #undef VL_BUF_T
 
-//=============================================================================
-// VerilatedSaifActivityBit
-
-class VerilatedSaifActivityBit final {
-    // MEMBERS
-    bool m_lastVal = false;  // Last emitted activity bit value
-    uint64_t m_highTime = 0;  // Total time when bit was high
-    size_t m_transitions = 0;  // Total number of bit transitions
-
-public:
-    // METHODS
-    VL_ATTR_ALWINLINE
-    void aggregateVal(uint64_t dt, bool newVal) {
-        m_transitions += newVal != m_lastVal ? 1 : 0;
-        m_highTime += m_lastVal ? dt : 0;
-        m_lastVal = newVal;
-    }
-
-    // ACCESSORS
-    VL_ATTR_ALWINLINE bool bitValue() const { return m_lastVal; }
-    VL_ATTR_ALWINLINE uint64_t highTime() const { return m_highTime; }
-    VL_ATTR_ALWINLINE uint64_t toggleCount() const { return m_transitions; }
-};
-
 //=============================================================================
 // VerilatedSaifActivityVar
+// Location of a variable's activity in a VerilatedSaifActivityAccumulator
 
 class VerilatedSaifActivityVar final {
-    // MEMBERS
-    uint64_t m_lastTime = 0;  // Last time when variable value was updated
-    VerilatedSaifActivityBit* m_bits;  // Pointer to variable bits objects
-    uint32_t m_width;  // Width of variable (in bits)
-
 public:
-    // CONSTRUCTORS
-    VerilatedSaifActivityVar(uint32_t width, VerilatedSaifActivityBit* bits)
-        : m_bits{bits}
-        , m_width{width} {}
-
-    VerilatedSaifActivityVar(VerilatedSaifActivityVar&&) = default;
-    VerilatedSaifActivityVar& operator=(VerilatedSaifActivityVar&&) = default;
-
-    // METHODS
-    VL_ATTR_ALWINLINE void emitBit(uint64_t time, CData newval);
-
-    template <typename DataType>
-    VL_ATTR_ALWINLINE void emitData(uint64_t time, DataType newval, uint32_t bits) {
-        static_assert(std::is_integral<DataType>::value,
-                      "The emitted value must be of integral type");
-
-        const uint64_t dt = time - m_lastTime;
-        for (size_t i = 0; i < std::min(m_width, bits); ++i) {
-            m_bits[i].aggregateVal(dt, (newval >> i) & 1);
-        }
-        updateLastTime(time);
-    }
-
-    VL_ATTR_ALWINLINE void emitWData(uint64_t time, const WData* newvalp, uint32_t bits);
-    VL_ATTR_ALWINLINE void updateLastTime(uint64_t val) { m_lastTime = val; }
-
-    // ACCESSORS
-    VL_ATTR_ALWINLINE uint32_t width() const { return m_width; }
-    VL_ATTR_ALWINLINE VerilatedSaifActivityBit& bit(std::size_t index);
-    VL_ATTR_ALWINLINE uint64_t lastUpdateTime() const { return m_lastTime; }
-
-private:
-    // CONSTRUCTORS
-    VL_UNCOPYABLE(VerilatedSaifActivityVar);
+    // MEMBERS
+    size_t m_bitIndex = 0;  // Index of bit 0 in the per bit arrays
+    size_t m_wordIndex = 0;  // Index of word 0 in the last values
+    uint32_t m_width = 0;  // Width of variable (in bits), 0 if not declared
 };
 
 //=============================================================================
@@ -195,16 +137,54 @@ class VerilatedSaifActivityAccumulator final {
     // Map of scopes paths to codes of activities inside
     std::unordered_map<std::string, std::vector<std::pair<uint32_t, std::string>>>
         m_scopeToActivities;
-    // Map of variables codes mapped to their activity objects
-    std::unordered_map<uint32_t, VerilatedSaifActivityVar> m_activity;
-    // Memory pool for signals bits objects
-    std::vector<std::vector<VerilatedSaifActivityBit>> m_activityArena;
+    // Variables, indexed by trace code
+    std::vector<VerilatedSaifActivityVar> m_vars;
+    // Last emitted value of each variable, packed in words
+    std::vector<EData> m_lastVals;
+    // Per bit time high, as the sum of fall times minus the sum of rise times
+    std::vector<uint64_t> m_highTimes;
+    // Per bit number of transitions
+    std::vector<uint64_t> m_toggles;
+
+    // METHODS
+    static int lowestSetBit(EData bits) {
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS)
+        return __builtin_ctz(bits);
+#else
+        int n = 0;
+        while (!(bits & 1)) {
+            bits >>= 1;
+            ++n;
+        }
+        return n;
+#endif
+    }
 
 public:
     // METHODS
     void declare(uint32_t code, const std::string& absoluteScopePath, std::string variableName,
                  int bits, bool array, int arraynum);
 
+    VL_ATTR_ALWINLINE const VerilatedSaifActivityVar& var(uint32_t code) const {
+        assert(code < m_vars.size() && m_vars[code].m_width
+               && "Activity must be declared earlier");
+        return m_vars[code];
+    }
+    VL_ATTR_ALWINLINE void emitWord(uint64_t time, const VerilatedSaifActivityVar& var,
+                                    uint32_t word, EData newval);
+    VL_ATTR_ALWINLINE void emitWData(uint64_t time, const VerilatedSaifActivityVar& var,
+                                     const WData* newvalp);
+
+    // ACCESSORS
+    // Total time the bit was high, up to the given time
+    uint64_t highTime(const VerilatedSaifActivityVar& var, uint32_t bit, uint64_t time) const {
+        const EData lastVal = m_lastVals[var.m_wordIndex + VL_BITWORD_E(bit)];
+        return m_highTimes[var.m_bitIndex + bit] + (VL_BITISSET_E(lastVal, bit) ? time : 0);
+    }
+    uint64_t toggleCount(const VerilatedSaifActivityVar& var, uint32_t bit) const {
+        return m_toggles[var.m_bitIndex + bit];
+    }
+
     // CONSTRUCTORS
     VerilatedSaifActivityAccumulator() = default;
 
@@ -218,58 +198,58 @@ private:
 //=============================================================================
 //=============================================================================
 //=============================================================================
-// VerilatedSaifActivityVar implementation
+// VerilatedSaifActivityAccumulator implementation
 
 VL_ATTR_ALWINLINE
-void VerilatedSaifActivityVar::emitBit(const uint64_t time, const CData newval) {
-    assert(m_lastTime <= time);
-    m_bits[0].aggregateVal(time - m_lastTime, newval);
-    updateLastTime(time);
+void VerilatedSaifActivityAccumulator::emitWord(const uint64_t time,
+                                               const VerilatedSaifActivityVar& var,
+                                               const uint32_t word, const EData newval) {
+    EData& lastVal = m_lastVals[var.m_wordIndex + word];
+    EData changed = lastVal ^ newval;
+    if (VL_LIKELY(!changed)) return;
+    lastVal = newval;
+    uint64_t* const highTimesp = m_highTimes.data() + var.m_bitIndex + word * VL_EDATASIZE;
+    uint64_t* const togglesp = m_toggles.data() + var.m_bitIndex + word * VL_EDATASIZE;
+    // Only visit the changed bits; as the time high is the sum of (fall - rise)
+    // times, a change is a single add, without tracking when each bit last changed
+    do {
+        const int bit = lowestSetBit(changed);
+        changed &= changed - 1;
+        ++togglesp[bit];
+        highTimesp[bit] += VL_BITISSET_E(newval, bit) ? (0 - time) : time;
+    } while (changed);
 }
 
 VL_ATTR_ALWINLINE
-void VerilatedSaifActivityVar::emitWData(const uint64_t time, const WData* newvalp,
-                                         const uint32_t bits) {
-    assert(m_lastTime <= time);
-    const uint64_t dt = time - m_lastTime;
-    for (std::size_t i = 0; i < std::min(m_width, bits); ++i) {
-        const size_t wordIndex = i / VL_EDATASIZE;
-        m_bits[i].aggregateVal(dt, (newvalp[wordIndex] >> VL_BITBIT_E(i)) & 1);
-    }
-
-    updateLastTime(time);
+void VerilatedSaifActivityAccumulator::emitWData(const uint64_t time,
+                                                const VerilatedSaifActivityVar& var,
+                                                const WData* newvalp) {
+    const uint32_t lastWord = VL_WORDS_I(var.m_width) - 1;
+    for (uint32_t word = 0; word < lastWord; ++word) emitWord(time, var, word, newvalp[word]);
+    emitWord(time, var, lastWord, newvalp[lastWord] & VL_MASK_E(var.m_width));
 }
 
-VerilatedSaifActivityBit& VerilatedSaifActivityVar::bit(const std::size_t index) {
-    assert(index < m_width);
-    return m_bits[index];
-}
-
-//=============================================================================
-//=============================================================================
-//=============================================================================
-// VerilatedSaifActivityAccumulator implementation
-
 void VerilatedSaifActivityAccumulator::declare(uint32_t code, const std::string& absoluteScopePath,
                                                std::string variableName, int bits, bool array,
                                                int arraynum) {
-    const size_t block_size = 1024;
-    if (m_activityArena.empty()
-        || m_activityArena.back().size() + bits > m_activityArena.back().capacity()) {
-        m_activityArena.emplace_back();
-        m_activityArena.back().reserve(block_size);
-    }
-    const size_t bitsIdx = m_activityArena.back().size();
-    m_activityArena.back().resize(m_activityArena.back().size() + bits);
-
     if (array) {
         variableName += '[';
         variableName += std::to_string(arraynum);
         variableName += ']';
     }
     m_scopeToActivities[absoluteScopePath].emplace_back(code, variableName);
-    m_activity.emplace(code, VerilatedSaifActivityVar{static_cast<uint32_t>(bits),
-                                                      m_activityArena.back().data() + bitsIdx});
+
+    if (code >= m_vars.size()) m_vars.resize(code + 1);
+    VerilatedSaifActivityVar& var = m_vars[code];
+    if (var.m_width) return;  // Alias of an already declared signal
+    var.m_bitIndex = m_highTimes.size();
+    var.m_wordIndex = m_lastVals.size();
+    var.m_width = static_cast<uint32_t>(bits);
+    // Values start on a word boundary so words are compared whole; as the
+    // unused bits are masked out, they need no per bit counters
+    m_lastVals.resize(m_lastVals.size() + VL_WORDS_I(bits), 0);
+    m_highTimes.resize(m_highTimes.size() + bits, 0);
+    m_toggles.resize(m_toggles.size() + bits, 0);
 }
 
 //=============================================================================
@@ -376,9 +356,8 @@ bool VerilatedSaif::printScopeActivitiesFromAccumulatorIfPresent(
     if (accumulator.m_scopeToActivities.count(absoluteScopePath) == 0) return false;
 
     for (const auto& childSignal : accumulator.m_scopeToActivities.at(absoluteScopePath)) {
-        VerilatedSaifActivityVar& activityVariable = accumulator.m_activity.at(childSignal.first);
-        anyNetWritten
-            = printActivityStats(activityVariable, childSignal.second.c_str(), anyNetWritten);
+        anyNetWritten = printActivityStats(accumulator, accumulator.var(childSignal.first),
+                                           childSignal.second, anyNetWritten);
     }
 
     return anyNetWritten;
@@ -396,12 +375,11 @@ void VerilatedSaif::closeNetScope() {
     printStr(")\n");  // NET
 }
 
-bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
+bool VerilatedSaif::printActivityStats(const VerilatedSaifActivityAccumulator& accumulator,
+                                       const VerilatedSaifActivityVar& activity,
                                        const std::string& activityName, bool anyNetWritten) {
-    for (size_t i = 0; i < activity.width(); ++i) {
-        VerilatedSaifActivityBit& bit = activity.bit(i);
-
-        bit.aggregateVal(currentTime() - activity.lastUpdateTime(), bit.bitValue());
+    for (uint32_t i = 0; i < activity.m_width; ++i) {
+        const uint64_t highTime = accumulator.highTime(activity, i, currentTime());
 
         if (!anyNetWritten) {
             openNetScope();
@@ -411,7 +389,7 @@ bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
         printIndent();
         printStr("(");
         printStr(activityName);
-        if (activity.width() > 1) {
+        if (activity.m_width > 1) {
             printStr("\\[");
             printStr(std::to_string(i));
             printStr("\\]");
@@ -419,16 +397,14 @@ bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
 
         // We only have two-value logic so TZ, TX and TB will always be 0
         printStr(" (T0 ");
-        printStr(std::to_string(currentTime() - bit.highTime()));
+        printStr(std::to_string(currentTime() - highTime));
         printStr(") (T1 ");
-        printStr(std::to_string(bit.highTime()));
+        printStr(std::to_string(highTime));
         printStr(") (TZ 0) (TX 0) (TB 0) (TC ");
-        printStr(std::to_string(bit.toggleCount()));
+        printStr(std::to_string(accumulator.toggleCount(activity, i)));
         printStr("))\n");
     }
 
-    activity.updateLastTime(currentTime());
-
     return anyNetWritten;
 }
 
@@ -610,56 +586,49 @@ void VerilatedSaifBuffer::emitEvent(const uint32_t code) {
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitBit(const uint32_t code, const CData newval) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitBit(m_owner.currentTime(), newval);
+    VerilatedSaifActivityAccumulator& accumulator = *m_owner.m_activityAccumulators[m_fidx];
+    accumulator.emitWord(m_owner.currentTime(), accumulator.var(code), 0, newval & 1);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitCData(const uint32_t code, const CData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitData<CData>(m_owner.currentTime(), newval, bits);
+    VerilatedSaifActivityAccumulator& accumulator = *m_owner.m_activityAccumulators[m_fidx];
+    const VerilatedSaifActivityVar& var = accumulator.var(code);
+    accumulator.emitWord(m_owner.currentTime(), var, 0, newval & VL_MASK_E(var.m_width));
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitSData(const uint32_t code, const SData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitData<SData>(m_owner.currentTime(), newval, bits);
+    VerilatedSaifActivityAccumulator& accumulator = *m_owner.m_activityAccumulators[m_fidx];
+    const VerilatedSaifActivityVar& var = accumulator.var(code);
+    accumulator.emitWord(m_owner.currentTime(), var, 0, newval & VL_MASK_E(var.m_width));
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitIData(const uint32_t code, const IData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitData<IData>(m_owner.currentTime(), newval, bits);
+    VerilatedSaifActivityAccumulator& accumulator = *m_owner.m_activityAccumulators[m_fidx];
+    const VerilatedSaifActivityVar& var = accumulator.var(code);
+    accumulator.emitWord(m_owner.currentTime(), var, 0, newval & VL_MASK_E(var.m_width));
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitQData(const uint32_t code, const QData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitData<QData>(m_owner.currentTime(), newval, bits);
+    VerilatedSaifActivityAccumulator& accumulator = *m_owner.m_activityAccumulators[m_fidx];
+    const VerilatedSaifActivityVar& var = accumulator.var(code);
+    if (var.m_width <= VL_EDATASIZE) {
+        accumulator.emitWord(m_owner.currentTime(), var, 0,
+                             static_cast<EData>(newval) & VL_MASK_E(var.m_width));
+        return;
+    }
+    accumulator.emitWord(m_owner.currentTime(), var, 0, static_cast<EData>(newval));
+    accumulator.emitWord(m_owner.currentTime(), var, 1,
+                         static_cast<EData>(newval >> VL_EDATASIZE) & VL_MASK_E(var.m_width));
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitWData(const uint32_t code, const WData* newvalp, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitWData(m_owner.currentTime(), newvalp, bits);
+    VerilatedSaifActivityAccumulator& accumulator = *m_owner.m_activityAccumulators[m_fidx];
+    accumulator.emitWData(m_owner.currentTime(), accumulator.var(code), newvalp);
 }
 
 VL_ATTR_ALWINLINE
@@ -32,7 +32,6 @@ class VerilatedSaifBuffer;
 class VerilatedSaifActivityAccumulator;
 class VerilatedSaifActivityScope;
 class VerilatedSaifActivityVar;
-class VerilatedSaifActivityBit;
 
 //=============================================================================
 // VerilatedSaif
@@ -85,8 +84,9 @@ private:
                                                  bool anyNetWritten);
     void openNetScope();
     void closeNetScope();
-    bool printActivityStats(VerilatedSaifActivityVar& activity, const std::string& activityName,
-                            bool anyNetWritten);
+    bool printActivityStats(const VerilatedSaifActivityAccumulator& accumulator,
+                            const VerilatedSaifActivityVar& activity,
+                            const std::string& activityName, bool anyNetWritten);
 
     void incrementIndent();
     void decrementIndent();
@@ -180,6 +180,8 @@ template <>
 void VerilatedSaif::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedSaif::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedSaif::Super::enableScope(const std::string& hier, bool enable);
 #endif  // DOXYGEN
 
 //=============================================================================
@@ -284,6 +286,11 @@ public:
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
         m_sptrace.dumpvars(level, hier);
     }
+    // Pause or resume tracing of a scope and those under it, e.g. "top.cpu".
+    // May be called while tracing, skipping the work of tracing the scope.
+    void enableScope(const std::string& hier, bool enable) VL_MT_SAFE {
+        m_sptrace.enableScope(hier, enable);
+    }
 
     // Internal class access
     VerilatedSaif* spTrace() { return &m_sptrace; }
@@ -34,12 +34,22 @@
 #include <fcntl.h>
 
 // clang-format off
+#ifdef VL_SAVE_ZLIB
+# include <zlib.h>
+#endif
+
 #if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
 # include <io.h>
 #else
 # include <unistd.h>
 #endif
 
+#if !defined(_WIN32) && !defined(VL_SAVE_ZLIB)
+# include <sys/mman.h>
+# include <sys/stat.h>
+# define VL_SAVE_MMAP  // Restore by mapping the file
+#endif
+
 #ifndef O_LARGEFILE  // WIN32 headers omit this
 # define O_LARGEFILE 0
 #endif
@@ -71,6 +81,22 @@ bool VerilatedDeserialize::readDiffers(const void* __restrict datap,
     return (miss != 0);
 }
 
+void VerilatedDeserialize::readFromMemory(uint8_t* __restrict dp, size_t size) VL_MT_UNSAFE_ONE {
+    // Large arrays copy straight from the source, after what is already buffered
+    const size_t buffered = std::min<size_t>(size, m_endp - m_cp);
+    std::memcpy(dp, m_cp, buffered);
+    m_cp += buffered;
+    dp += buffered;
+    size -= buffered;
+    const size_t blk = std::min<size_t>(size, m_srcEndp - m_srcp);
+    std::memcpy(dp, m_srcp, blk);
+    m_srcp += blk;
+    dp += blk;
+    size -= blk;
+    // Past the end of data reads NULLs, as with fill()
+    std::memset(dp, 0, size);
+}
+
 VerilatedDeserialize& VerilatedDeserialize::readAssert(const void* __restrict datap,
                                                        size_t size) VL_MT_UNSAFE_ONE {
     if (VL_UNLIKELY(readDiffers(datap, size))) {
@@ -140,6 +166,15 @@ void VerilatedSave::open(const char* filenamep) VL_MT_UNSAFE_ONE {
             m_isOpen = false;
             return;
         }
+#ifdef VL_SAVE_ZLIB
+        // Favor speed over size, as saves are often made during simulation
+        m_gzp = gzdopen(m_fd, "wb1");
+        if (VL_UNLIKELY(!m_gzp)) {
+            ::close(m_fd);
+            m_isOpen = false;
+            return;
+        }
+#endif
     }
     m_isOpen = true;
     m_filename = filenamep;
@@ -162,6 +197,29 @@ void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
             m_isOpen = false;
             return;
         }
+#ifdef VL_SAVE_ZLIB
+        // Also reads files that are not compressed
+        m_gzp = gzdopen(m_fd, "rb");
+        if (VL_UNLIKELY(!m_gzp)) {
+            ::close(m_fd);
+            m_isOpen = false;
+            return;
+        }
+#endif
+#ifdef VL_SAVE_MMAP
+        // Read through a mapping when possible, so large arrays are copied
+        // straight from the page cache; otherwise fall back to read()
+        struct stat st;
+        if (::fstat(m_fd, &st) == 0 && st.st_size > 0) {
+            void* const mapp = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+            if (mapp != MAP_FAILED) {
+                m_mapp = mapp;
+                m_mapSize = st.st_size;
+                m_srcp = static_cast<const uint8_t*>(mapp);
+                m_srcEndp = m_srcp + m_mapSize;
+            }
+        }
+#endif
     }
     m_isOpen = true;
     m_filename = filenamep;
@@ -175,7 +233,12 @@ void VerilatedSave::closeImp() VL_MT_UNSAFE_ONE {
     trailer();
     flushImp();
     m_isOpen = false;
+#ifdef VL_SAVE_ZLIB
+    gzclose(static_cast<gzFile>(m_gzp));  // Also closes m_fd; may get error, just ignore it
+    m_gzp = nullptr;
+#else
     ::close(m_fd);  // May get error, just ignore it
+#endif
 }
 
 void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
@@ -183,7 +246,54 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
     trailer();
     flushImp();
     m_isOpen = false;
+#ifdef VL_SAVE_MMAP
+    if (m_mapp) ::munmap(m_mapp, m_mapSize);
+    m_mapp = nullptr;
+    m_srcp = m_srcEndp = nullptr;
+#endif
+#ifdef VL_SAVE_ZLIB
+    gzclose(static_cast<gzFile>(m_gzp));  // Also closes m_fd; may get error, just ignore it
+    m_gzp = nullptr;
+#else
     ::close(m_fd);  // May get error, just ignore it
+#endif
+}
+
+void VerilatedSaveMem::open() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen()) return;
+    m_data.clear();
+    m_isOpen = true;
+    m_filename = "<memory>";
+    m_cp = m_bufp;
+    header();
+}
+
+void VerilatedRestoreMem::open(const std::vector<uint8_t>& data) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen()) return;
+    m_srcp = data.data();
+    m_srcEndp = m_srcp + data.size();
+    m_isOpen = true;
+    m_filename = "<memory>";
+    m_cp = m_bufp;
+    m_endp = m_bufp;
+    header();
+}
+
+void VerilatedSaveMem::closeImp() VL_MT_UNSAFE_ONE {
+    if (!isOpen()) return;
+    trailer();
+    flushImp();
+    m_isOpen = false;
+}
+
+void VerilatedRestoreMem::closeImp() VL_MT_UNSAFE_ONE {
+    if (!isOpen()) return;
+    trailer();
+    flushImp();
+    m_isOpen = false;
+    m_srcp = m_srcEndp = nullptr;
 }
 
 //=============================================================================
@@ -193,6 +303,21 @@ void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (VL_UNLIKELY(!isOpen())) return;
     const uint8_t* wp = m_bufp;
+#ifdef VL_SAVE_ZLIB
+    if (m_cp > wp) {
+        const int got = gzwrite(static_cast<gzFile>(m_gzp), wp, m_cp - wp);
+        if (VL_UNCOVERABLE(got <= 0)) {
+            // LCOV_EXCL_START
+            int errnum = 0;
+            const char* const errp = gzerror(static_cast<gzFile>(m_gzp), &errnum);
+            const std::string msg = std::string{__FUNCTION__} + ": " + errp;
+            VL_FATAL_MT("", 0, "", msg.c_str());
+            // LCOV_EXCL_STOP
+        }
+    }
+    m_cp = m_bufp;  // Reset buffer
+    return;
+#endif
     while (true) {
         const ssize_t remaining = (m_cp - wp);
         if (remaining == 0) break;
@@ -218,6 +343,10 @@ void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
 void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (VL_UNLIKELY(!isOpen())) return;
+    if (m_mapp) {
+        fillFromMemory();
+        return;
+    }
     // Move remaining characters down to start of buffer.  (No memcpy, overlaps allowed)
     uint8_t* rp = m_bufp;
     for (uint8_t* sp = m_cp; sp < m_endp; *rp++ = *sp++) {}  // Overlaps
@@ -228,7 +357,11 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
         const ssize_t remaining = (m_bufp + bufferSize() - m_endp);
         if (remaining == 0) break;
         errno = 0;
+#ifdef VL_SAVE_ZLIB
+        const ssize_t got = gzread(static_cast<gzFile>(m_gzp), m_endp, remaining);
+#else
         const ssize_t got = ::read(m_fd, m_endp, remaining);
+#endif
         if (got > 0) {
             m_endp += got;
         } else if (VL_UNCOVERABLE(got < 0)) {
@@ -250,6 +383,37 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     }
 }
 
+void VerilatedSaveMem::flushImp() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (VL_UNLIKELY(!isOpen())) return;
+    m_data.insert(m_data.end(), m_bufp, m_cp);
+    m_cp = m_bufp;  // Reset buffer
+}
+
+void VerilatedRestoreMem::fill() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (VL_UNLIKELY(!isOpen())) return;
+    fillFromMemory();
+}
+
+void VerilatedDeserialize::fillFromMemory() VL_MT_UNSAFE_ONE {
+    // Move remaining characters down to start of buffer, may overlap
+    const size_t remaining = m_endp - m_cp;
+    std::memmove(m_bufp, m_cp, remaining);
+    m_endp = m_bufp + remaining;
+    m_cp = m_bufp;  // Reset buffer
+    const size_t blk = std::min<size_t>(m_bufp + bufferSize() - m_endp, m_srcEndp - m_srcp);
+    std::memcpy(m_endp, m_srcp, blk);
+    m_endp += blk;
+    m_srcp += blk;
+    // At end of data, fill buffer from here to end with NULLs so reader's
+    // don't need to check eof each character.
+    if (m_srcp == m_srcEndp) {
+        std::memset(m_endp, 0, m_bufp + bufferSize() - m_endp);
+        m_endp = m_bufp + bufferSize();
+    }
+}
+
 //=============================================================================
 // Serialization of types
 
@@ -26,7 +26,10 @@
 
 #include "verilated.h"
 
+#include <algorithm>
+#include <cstring>
 #include <string>
+#include <vector>
 
 //=============================================================================
 // VerilatedSerialize
@@ -81,10 +84,11 @@ public:
         const uint8_t* __restrict dp = static_cast<const uint8_t* __restrict>(datap);
         while (size) {
             bufferCheck();
-            size_t blk = size;
-            if (blk > bufferInsertSize()) blk = bufferInsertSize();
-            const uint8_t* __restrict maxp = dp + blk;
-            for (; dp < maxp; *m_cp++ = *dp++) {}
+            // Fill all space left in the buffer, so large arrays need few flushes
+            const size_t blk = std::min<size_t>(size, m_bufp + bufferSize() - m_cp);
+            std::memcpy(m_cp, dp, blk);
+            m_cp += blk;
+            dp += blk;
             size -= blk;
         }
         return *this;  // For function chaining
@@ -115,6 +119,8 @@ protected:
     uint8_t* m_cp;  // Current pointer into m_bufp buffer
     uint8_t* m_bufp;  // Output buffer
     uint8_t* m_endp = nullptr;  // Last valid byte in m_bufp buffer
+    const uint8_t* m_srcp = nullptr;  // Next data to fill from, if whole source is in memory
+    const uint8_t* m_srcEndp = nullptr;  // End of data to fill from, if in memory
     bool m_isOpen = false;  // True indicates open file/stream
     std::string m_filename;  // Filename, for error messages
     VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
@@ -123,6 +129,7 @@ protected:
     static constexpr size_t bufferInsertSize() { return 16 * 1024; }
 
     virtual void fill() = 0;
+    void fillFromMemory() VL_MT_UNSAFE_ONE;
     void header() VL_MT_UNSAFE_ONE;
     void trailer() VL_MT_UNSAFE_ONE;
 
@@ -152,12 +159,17 @@ public:
     /// Read data from stream
     VerilatedDeserialize& read(void* __restrict datap, size_t size) VL_MT_UNSAFE_ONE {
         uint8_t* __restrict dp = static_cast<uint8_t* __restrict>(datap);
+        if (VL_UNLIKELY(size > bufferSize() && m_srcp)) {
+            readFromMemory(dp, size);
+            return *this;
+        }
         while (size) {
             bufferCheck();
-            size_t blk = size;
-            if (blk > bufferInsertSize()) blk = bufferInsertSize();
-            const uint8_t* __restrict maxp = dp + blk;
-            for (; dp < maxp; *dp++ = *m_cp++) {}
+            // Take all data left in the buffer, so large arrays need few fills
+            const size_t blk = std::min<size_t>(size, m_endp - m_cp);
+            std::memcpy(dp, m_cp, blk);
+            m_cp += blk;
+            dp += blk;
             size -= blk;
         }
         return *this;  // For function chaining
@@ -171,6 +183,7 @@ public:
     }
 
 private:
+    void readFromMemory(uint8_t* __restrict dp, size_t size) VL_MT_UNSAFE_ONE;
     bool readDiffers(const void* __restrict datap, size_t size) VL_MT_UNSAFE_ONE;
     VerilatedDeserialize& bufferCheck() VL_MT_UNSAFE_ONE {
         // Flush the write buffer if there's not enough space left for new information
@@ -189,6 +202,7 @@ private:
 class VerilatedSave final : public VerilatedSerialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
+    void* m_gzp = nullptr;  // zlib gzFile compressing to m_fd, if VL_SAVE_ZLIB
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE;
@@ -219,6 +233,9 @@ public:
 class VerilatedRestore final : public VerilatedDeserialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
+    void* m_gzp = nullptr;  // zlib gzFile decompressing m_fd, if VL_SAVE_ZLIB
+    void* m_mapp = nullptr;  // Memory mapping of the whole file, if not compressed
+    size_t m_mapSize = 0;  // Size of m_mapp
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE {}
@@ -241,6 +258,66 @@ public:
     void fill() override VL_MT_UNSAFE_ONE;
 };
 
+//=============================================================================
+// VerilatedSaveMem
+/// Stream-like object that serializes Verilated model to memory.
+///
+/// Restoring a snapshot with VerilatedRestoreMem avoids file I/O, so the
+/// same state may be cheaply restored many times.
+///
+/// This class is not thread safe, it must be called by a single thread
+
+class VerilatedSaveMem final : public VerilatedSerialize {
+private:
+    std::vector<uint8_t> m_data;  // Serialized data flushed so far
+
+    void closeImp() VL_MT_UNSAFE_ONE;
+    void flushImp() VL_MT_UNSAFE_ONE;
+
+public:
+    // CONSTRUCTORS
+    /// Construct new object
+    VerilatedSaveMem() = default;
+    /// Flush, close and destruct
+    ~VerilatedSaveMem() override { closeImp(); }
+    // METHODS
+    /// Open, discarding any previous contents
+    void open() VL_MT_UNSAFE_ONE;
+    /// Flush and close
+    void close() override VL_MT_UNSAFE_ONE { closeImp(); }
+    /// Flush data to memory
+    void flush() override VL_MT_UNSAFE_ONE { flushImp(); }
+    /// Return serialized data, complete once closed
+    const std::vector<uint8_t>& data() const { return m_data; }
+};
+
+//=============================================================================
+// VerilatedRestoreMem
+/// Stream-like object that serializes Verilated model from memory.
+///
+/// This class is not thread safe, it must be called by a single thread
+
+class VerilatedRestoreMem final : public VerilatedDeserialize {
+private:
+    void closeImp() VL_MT_UNSAFE_ONE;
+    void flushImp() VL_MT_UNSAFE_ONE {}
+
+public:
+    // CONSTRUCTORS
+    /// Construct new object
+    VerilatedRestoreMem() = default;
+    /// Close and destruct
+    ~VerilatedRestoreMem() override { closeImp(); }
+
+    // METHODS
+    /// Open data from a closed VerilatedSaveMem, which must not change until close
+    void open(const std::vector<uint8_t>& data) VL_MT_UNSAFE_ONE;
+    /// Close
+    void close() override VL_MT_UNSAFE_ONE { closeImp(); }
+    void flush() override VL_MT_UNSAFE_ONE { flushImp(); }
+    void fill() override VL_MT_UNSAFE_ONE;
+};
+
 //=============================================================================
 
 inline VerilatedSerialize& operator<<(VerilatedSerialize& os, const uint64_t& rhs) {
@@ -300,6 +377,34 @@ inline VerilatedDeserialize& operator>>(VerilatedDeserialize& os, std::string& r
 VerilatedSerialize& operator<<(VerilatedSerialize& os, VerilatedContext* rhsp);
 VerilatedDeserialize& operator>>(VerilatedDeserialize& os, VerilatedContext* rhsp);
 
+template <typename T_Value, std::size_t N_Depth>
+VerilatedSerialize& operator<<(VerilatedSerialize& os, VlSparseUnpacked<T_Value, N_Depth>& rhs) {
+    // Elements are integral, so pages are saved as blocks
+    os.write(&rhs.atDefault(), sizeof(T_Value));
+    const std::vector<std::size_t> pageNums = rhs.pageNums();
+    const uint32_t len = pageNums.size();
+    os << len;
+    for (const std::size_t pageNum : pageNums) {
+        const uint64_t num = pageNum;
+        os << num;
+        os.write(rhs.pageData(pageNum), rhs.PAGE_ELEMENTS * sizeof(T_Value));
+    }
+    return os;
+}
+template <typename T_Value, std::size_t N_Depth>
+VerilatedDeserialize& operator>>(VerilatedDeserialize& os,
+                                 VlSparseUnpacked<T_Value, N_Depth>& rhs) {
+    rhs.clear();
+    os.read(&rhs.atDefault(), sizeof(T_Value));
+    uint32_t len = 0;
+    os >> len;
+    for (uint32_t i = 0; i < len; ++i) {
+        uint64_t num = 0;
+        os >> num;
+        os.read(rhs.pageData(num), rhs.PAGE_ELEMENTS * sizeof(T_Value));
+    }
+    return os;
+}
 template <typename T_Key, typename T_Value>
 VerilatedSerialize& operator<<(VerilatedSerialize& os, VlAssocArray<T_Key, T_Value>& rhs) {
     os << rhs.atDefault();
@@ -327,5 +432,34 @@ VerilatedDeserialize& operator>>(VerilatedDeserialize& os, VlAssocArray<T_Key, T
     }
     return os;
 }
+template <typename T_Key, typename T_Value>
+VerilatedSerialize& operator<<(VerilatedSerialize& os,
+                               VlUnorderedAssocArray<T_Key, T_Value>& rhs) {
+    os << rhs.atDefault();
+    const uint32_t len = rhs.size();
+    os << len;
+    for (const auto& i : rhs) {
+        const T_Key index = i.first;  // Copy to get around const_iterator
+        const T_Value value = i.second;
+        os << index << value;
+    }
+    return os;
+}
+template <typename T_Key, typename T_Value>
+VerilatedDeserialize& operator>>(VerilatedDeserialize& os,
+                                 VlUnorderedAssocArray<T_Key, T_Value>& rhs) {
+    os >> rhs.atDefault();
+    uint32_t len = 0;
+    os >> len;
+    rhs.clear();
+    for (uint32_t i = 0; i < len; ++i) {
+        T_Key index;
+        T_Value value;
+        os >> index;
+        os >> value;
+        rhs.at(index) = value;
+    }
+    return os;
+}
 
 #endif  // Guard
@@ -29,6 +29,10 @@
 // verilator lint_off TIMESCALEMOD
 // verilator lint_off UNUSEDSIGNAL
 package std;
+   // Blocking methods re-check their condition after each wakeup, as all
+   // waiters are woken and another process may have taken the message or
+   // keys first.  Waiters are not queued per process, as a waiter that is
+   // killed or disabled would then block every later one.
    class mailbox #(type T);
       protected int m_bound;
       protected T m_queue[$];
@@ -50,7 +54,7 @@ package std;
       endtask
 
       function int try_put(T message);
-         if (m_bound == 0 || num() < m_bound) begin
+         if (m_bound == 0 || m_queue.size() < m_bound) begin
             m_queue.push_back(message);
             return 1;
          end
@@ -67,7 +71,7 @@ package std;
       endtask
 
       function int try_get(ref T message);
-         if (num() > 0) begin
+         if (m_queue.size() != 0) begin
             message = m_queue.pop_front();
             return 1;
          end
@@ -84,7 +88,7 @@ package std;
       endtask
 
       function int try_peek(ref T message);
-         if (num() > 0) begin
+         if (m_queue.size() != 0) begin
             message = m_queue[0];
             return 1;
          end
@@ -34,6 +34,8 @@
 #include "verilated.h"
 #include "verilated_sym_props.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <unordered_map>
 #include <vector>
@@ -57,10 +59,68 @@ public:
 
 // Map of sorted variable names to find associated variable class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
-class VerilatedVarNameMap final : public std::map<const char*, VerilatedVar, VerilatedCStrCmp> {
+// Variables are kept in a vector sorted by name, as Verilator emits them in
+// order, so building the map is a single allocation rather than one per variable.
+class VerilatedVarNameMap final {
 public:
+    // TYPES
+    using value_type = std::pair<const char*, VerilatedVar>;
+    using const_iterator = std::vector<value_type>::const_iterator;
+    using iterator = std::vector<value_type>::iterator;
+
+private:
+    // MEMBERS
+    std::vector<value_type> m_vars;  // Variables, sorted by name
+
+    iterator lowerBound(const char* namep) {
+        return std::lower_bound(m_vars.begin(), m_vars.end(), namep,
+                                [](const value_type& var, const char* keyp) {
+                                    return std::strcmp(var.first, keyp) < 0;
+                                });
+    }
+
+public:
+    // CONSTRUCTORS
     VerilatedVarNameMap() = default;
     ~VerilatedVarNameMap() = default;
+    // METHODS
+    iterator begin() { return m_vars.begin(); }
+    iterator end() { return m_vars.end(); }
+    const_iterator begin() const { return m_vars.begin(); }
+    const_iterator end() const { return m_vars.end(); }
+    size_t size() const { return m_vars.size(); }
+    bool empty() const { return m_vars.empty(); }
+    void reserve(size_t size) { m_vars.reserve(size); }
+    iterator find(const char* namep) {
+        const iterator it = lowerBound(namep);
+        if (it != m_vars.end() && !std::strcmp(it->first, namep)) return it;
+        return m_vars.end();
+    }
+    const_iterator find(const char* namep) const {
+        return const_cast<VerilatedVarNameMap*>(this)->find(namep);
+    }
+    // Insert unless already present, like std::map::emplace
+    std::pair<iterator, bool> emplace(const char* namep, VerilatedVar&& var) {
+        // Fast path, appending in sorted order
+        if (m_vars.empty() || std::strcmp(m_vars.back().first, namep) < 0) {
+            m_vars.emplace_back(namep, std::move(var));
+            return {m_vars.end() - 1, true};
+        }
+        const iterator it = lowerBound(namep);
+        if (!std::strcmp(it->first, namep)) return {it, false};
+        // Out of order, rebuild as the elements are not assignable
+        const size_t pos = it - m_vars.begin();
+        std::vector<value_type> vars;
+        vars.reserve(m_vars.size() + 1);
+        for (size_t i = 0; i < pos; ++i) vars.emplace_back(std::move(m_vars[i]));
+        vars.emplace_back(namep, std::move(var));
+        for (size_t i = pos; i < m_vars.size(); ++i) vars.emplace_back(std::move(m_vars[i]));
+        m_vars.swap(vars);
+        return {m_vars.begin() + pos, true};
+    }
+    std::pair<iterator, bool> emplace(const char* namep, const VerilatedVar& var) {
+        return emplace(namep, VerilatedVar{var});
+    }
 };
 
 // Map of parent scope to vector of children scopes
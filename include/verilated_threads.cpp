@@ -25,6 +25,7 @@
 
 #include "verilated_threads.h"
 
+#include <climits>
 #include <cstdio>
 #include <fstream>
 #include <iostream>
@@ -34,6 +35,11 @@
 #ifdef __FreeBSD__
 #include <pthread_np.h>
 #endif
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 //=============================================================================
 // Globals
@@ -41,6 +47,9 @@
 // Internal note: Globals may multi-construct, see verilated.cpp top.
 
 std::atomic<uint64_t> VlMTaskVertex::s_yields;
+std::atomic<uint64_t> VlMTaskVertex::s_parks;
+std::atomic<uint64_t> VlWorkerThread::s_steals;
+std::atomic<uint64_t> VlDynamicSchedule::s_rebalances;
 
 //=============================================================================
 // VlMTaskVertex
@@ -49,17 +58,65 @@ VlMTaskVertex::VlMTaskVertex(uint32_t upstreamDepCount)
     : m_upstreamDepsDone{0}
     , m_upstreamDepCount{upstreamDepCount} {
     assert(atomic_is_lock_free(&m_upstreamDepsDone));
+    assert(upstreamDepCount < WAITER_BIT);
+}
+
+// Block while 'word' contains 'value', or until woken. Might return spuriously.
+static void vlAddressWait(std::atomic<uint32_t>& word, uint32_t value) {
+#if defined(__linux__)
+    static_assert(sizeof(word) == sizeof(uint32_t), "futex requires 32-bit word");
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, value, nullptr,
+            nullptr, 0);
+#elif defined(__cpp_lib_atomic_wait)
+    // WaitOnAddress on Windows, __ulock_wait on macOS
+    word.wait(value, std::memory_order_acquire);
+#else
+    if (word.load(std::memory_order_acquire) == value) std::this_thread::yield();
+#endif
+}
+static void vlAddressWakeAll(std::atomic<uint32_t>& word) {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr,
+            nullptr, 0);
+#elif defined(__cpp_lib_atomic_wait)
+    word.notify_all();
+#else
+    (void)word;
+#endif
+}
+
+void VlMTaskVertex::parkUntilUpstreamDone(bool evenCycle) {
+    const uint32_t target = evenCycle ? m_upstreamDepCount : 0;
+    while (true) {
+        // Register as waiter, then sleep only if still not done. If an upstream
+        // signal changes the value in between, the wait returns immediately.
+        const uint32_t value
+            = m_upstreamDepsDone.fetch_or(WAITER_BIT, std::memory_order_acq_rel) | WAITER_BIT;
+        if ((value & ~WAITER_BIT) == target) break;
+        ++s_parks;  // Statistics
+        vlAddressWait(m_upstreamDepsDone, value);
+        if (areUpstreamDepsDone(evenCycle)) break;
+    }
+    // The final signaler normally clears the bit, but not if we registered after it
+    m_upstreamDepsDone.fetch_and(~WAITER_BIT, std::memory_order_acq_rel);
+}
+
+void VlMTaskVertex::wakeWaiters() {
+    m_upstreamDepsDone.fetch_and(~WAITER_BIT, std::memory_order_acq_rel);
+    vlAddressWakeAll(m_upstreamDepsDone);
 }
 
 //=============================================================================
 // VlWorkerThread
 
-VlWorkerThread::VlWorkerThread(VerilatedContext* contextp)
-    : m_ready_size{0}
-    , m_cthread{startWorker, this, contextp} {}
+VlWorkerThread::VlWorkerThread(VlThreadPool* poolp, VerilatedContext* contextp, bool steal,
+                               unsigned index)
+    : m_poolp{poolp}
+    , m_steal{steal}
+    , m_cthread{startWorker, this, contextp, index} {}
 
 VlWorkerThread::~VlWorkerThread() {
-    shutdown();
+    if (!m_shutdown) shutdown();
     // The thread should exit; join it.
     m_cthread.join();
 }
@@ -68,7 +125,10 @@ static void shutdownTask(void*, bool) {  // LCOV_EXCL_LINE
     // Deliberately empty, we use the address of this function as a magic number
 }
 
-void VlWorkerThread::shutdown() { addTask(shutdownTask, nullptr); }
+void VlWorkerThread::shutdown() {
+    m_shutdown = true;
+    addTask(shutdownTask, nullptr);
+}
 
 void VlWorkerThread::wait() {
     // Enqueue a task that sets this flag. Execution is in-order so this ensures completion.
@@ -81,6 +141,30 @@ void VlWorkerThread::wait() {
     }
     // Yield wait
     while (!flag.load()) std::this_thread::yield();
+    // Tasks stolen from this worker might still be running elsewhere
+    while (m_stolenInFlight.load()) std::this_thread::yield();
+}
+
+bool VlWorkerThread::stealWork(ExecRec* workp) VL_MT_SAFE {
+    const int nThreads = m_poolp->numThreads();
+    // Start at a different victim on each call, to spread out contention
+    static thread_local int t_next = 0;
+    for (int n = 0; n < nThreads; ++n) {
+        if (++t_next >= nThreads) t_next = 0;
+        VlWorkerThread* const victimp = m_poolp->workerp(t_next);
+        if (victimp == this || victimp->m_ready.empty()) continue;
+        // Count before taking, as wait() on the victim must see it
+        ++victimp->m_stolenInFlight;
+        VlWorkDeque::Rec rec;
+        if (victimp->m_ready.take(rec, true)) {
+            ++s_steals;  // Statistics
+            *workp = ExecRec{rec};
+            workp->m_stolenFromp = victimp;
+            return true;
+        }
+        --victimp->m_stolenInFlight;
+    }
+    return false;
 }
 
 void VlWorkerThread::workerLoop() {
@@ -91,33 +175,69 @@ void VlWorkerThread::workerLoop() {
 
     while (true) {
         if (VL_UNLIKELY(work.m_fnp == shutdownTask)) break;
+        // Model tasks on a shared pool should see the context of the model
+        if (VL_UNLIKELY(m_poolp->shared())) {
+            if (VerilatedContext* const contextp = m_poolp->leaseContextp()) {
+                Verilated::threadContextp(contextp);
+            }
+        }
         work.m_fnp(work.m_selfp, work.m_evenCycle);
+        if (VL_UNLIKELY(work.m_stolenFromp)) --work.m_stolenFromp->m_stolenInFlight;
+#ifdef VL_PERF_STATS
+        VerilatedContext* const contextp = Verilated::threadContextp();
+        const uint64_t idleStartNs = VerilatedPerfCounters::nowNs();
+#endif
         // Wait for next task with spinning.
         dequeWork</* SpinWait: */ true>(&work);
+#ifdef VL_PERF_STATS
+        contextp->perfCounters().threadIdle(VerilatedPerfCounters::nowNs() - idleStartNs);
+#endif
     }
 }
 
-void VlWorkerThread::startWorker(VlWorkerThread* workerp, VerilatedContext* contextp) {
+void VlWorkerThread::startWorker(VlWorkerThread* workerp, VerilatedContext* contextp,
+                                 unsigned index) {
     Verilated::threadContextp(contextp);
+    Verilated::workerIndex(index + 1);
     workerp->workerLoop();
 }
 
 //=============================================================================
 // VlThreadPool
 
-VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads) {
+VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads)
+    : m_steal{contextp->threadsSteal() && nThreads > 1}
+    , m_park{contextp->threadsPark()} {
+    // Workers only look for others to steal from after receiving work, by
+    // which time this vector is complete
+    m_workers.reserve(nThreads);
     for (unsigned i = 0; i < nThreads; ++i) {
-        m_workers.push_back(new VlWorkerThread{contextp});
+        m_workers.push_back(new VlWorkerThread{this, contextp, m_steal, i});
         m_unassignedWorkers.push(i);
     }
     m_numaStatus = numaAssign();
 }
 
 VlThreadPool::~VlThreadPool() {
+    // Stop all workers before deleting any, as others may be stealing from them
+    for (auto& i : m_workers) i->shutdown();
     // Each ~WorkerThread will wait for its thread to exit.
     for (auto& i : m_workers) delete i;
 }
 
+void VlThreadPool::leaseAcquireShared(VerilatedContext* contextp) {
+    const uint64_t ticket = m_leaseNext.fetch_add(1, std::memory_order_relaxed);
+    unsigned ct = 0;
+    while (m_leaseServing.load(std::memory_order_acquire) != ticket) {
+        VL_CPU_RELAX();
+        if (VL_UNLIKELY(++ct > VL_LOCK_SPINS)) {
+            ct = 0;
+            std::this_thread::yield();
+        }
+    }
+    m_leaseContextp.store(contextp, std::memory_order_release);
+}
+
 bool VlThreadPool::isNumactlRunning() {
     // We assume if current thread is CPU-masked, then under numactl, otherwise not.
     // This shows that numactl is visible through the affinity mask
@@ -147,32 +267,40 @@ std::string VlThreadPool::numaAssign() {
     // Uncertain if any modern system has gaps in the processor id (Solaris
     // did), but just in case use vectors instead of processor number math.
     //
-    // Currently ignoring socket number "physical id".
-    // If processor numbers are sequential on sockets, algorithm works out ok.
-    // If processor numbers are strided on sockets, algorithm also works out ok.
+    // Processors are ordered by socket number "physical id", so that threads
+    // with adjacent indexes land on the same socket, whether processor
+    // numbers are sequential or strided on sockets. Verilation with
+    // --threads-numa-nodes places mtasks sharing state on adjacent threads.
     std::ifstream is{"/proc/cpuinfo"};
     if (VL_UNLIKELY(!is)) return "%Warning: no /proc/cpuinfo";
 
     std::vector<int> unassigned_processors;  // Processors to assign in sorted order
     std::map<int, int> processor_core;
+    std::map<int, int> processor_socket;
     std::multimap<int, int> core_processors;
     std::set<int> cores;
     {
         int processor = -1;
+        int socket = 0;
         while (!is.eof()) {
             std::string line;
             std::getline(is, line);
-            static std::string::size_type pos = line.find(":");
+            const std::string::size_type pos = line.find(":");
             int number = -1;
             if (pos != std::string::npos) number = atoi(line.c_str() + pos + 1);
             if (line.compare(0, std::strlen("processor"), "processor") == 0) {
                 processor = number;
+                socket = 0;
+            } else if (line.compare(0, std::strlen("physical id"), "physical id") == 0) {
+                socket = number;
             } else if (line.compare(0, std::strlen("core id"), "core id") == 0) {
-                const int core = number;
+                // Core numbers restart on each socket
+                const int core = (socket << 16) + number;
                 // std::cout << "p" << processor << " socket " << socket << " c" << core <<
                 // std::endl;
                 cores.emplace(core);
                 processor_core[processor] = core;
+                processor_socket[processor] = socket;
                 core_processors.emplace(core, processor);
                 unassigned_processors.push_back(processor);
             }
@@ -183,7 +311,12 @@ std::string VlThreadPool::numaAssign() {
     // This will help to land on the same socket as current CPU, and also
     // help make sure that different processes have different masks (when
     // num_threads is not a common-factor of the processor count).
-    std::sort(unassigned_processors.begin(), unassigned_processors.end());
+    std::sort(unassigned_processors.begin(), unassigned_processors.end(),
+              [&](int a, int b) {
+                  if (processor_socket[a] != processor_socket[b])
+                      return processor_socket[a] < processor_socket[b];
+                  return a < b;
+              });
     {
         const int on_cpu = sched_getcpu();  // TODO: this is a system call. Not exactly cheap.
         bool hit = false;
@@ -257,3 +390,135 @@ std::string VlThreadPool::numaAssign() {
     return "non-supported host OS";
 #endif
 }
+
+//=============================================================================
+// VlDynamicSchedule
+
+uint32_t VlDynamicSchedule::addMTask(VlExecFnp fnp, uint32_t thread,
+                                     std::initializer_list<uint32_t> predecessors) {
+    const uint32_t index = static_cast<uint32_t>(m_mtasks.size());
+    assert(thread < m_threads.size());
+    m_mtasks.emplace_back();
+    MTask& mtask = m_mtasks.back();
+    mtask.m_fnp = fnp;
+    mtask.m_predecessors = predecessors;
+    mtask.m_thread = thread;
+    if (predecessors.size()) {
+        mtask.m_vertexp.reset(new VlMTaskVertex{static_cast<uint32_t>(predecessors.size())});
+    }
+    for (const uint32_t pred : predecessors) {
+        assert(pred < index);
+        m_mtasks[pred].m_successors.push_back(index);
+    }
+    m_threads[thread].push_back(index);
+    return index;
+}
+
+void VlDynamicSchedule::execute(VlThreadPool* poolp, VlSelfP selfp, bool evenCycle,
+                                uint32_t interval) {
+    if (VL_UNLIKELY(!m_donep)) {
+        assert(m_threads.size() <= static_cast<size_t>(poolp->numThreads()) + 1);
+        for (uint32_t thread = 1; thread < m_threads.size(); ++thread) {
+            m_runners.push_back(Runner{this, thread, nullptr});
+        }
+        m_donep.reset(new VlMTaskVertex{static_cast<uint32_t>(m_runners.size())});
+        m_park = poolp->park();
+    }
+    if (interval && ++m_evals >= interval) {
+        m_evals = 0;
+        rebalance();
+    }
+    for (size_t i = 0; i < m_runners.size(); ++i) {
+        m_runners[i].m_selfp = selfp;
+        poolp->workerp(static_cast<int>(i))->addTask(&runWorker, &m_runners[i], evenCycle);
+    }
+    runThread(0, selfp, evenCycle);
+    m_donep->waitUntilUpstreamDone(evenCycle, m_park);
+}
+
+void VlDynamicSchedule::runThread(uint32_t thread, VlSelfP selfp, bool evenCycle) {
+    for (const uint32_t index : m_threads[thread]) {
+        MTask& mtask = m_mtasks[index];
+        if (mtask.m_vertexp) mtask.m_vertexp->waitUntilUpstreamDone(evenCycle, m_park);
+        uint64_t startTick;
+        VL_GET_CPU_TICK(startTick);
+        mtask.m_fnp(selfp, evenCycle);
+        uint64_t endTick;
+        VL_GET_CPU_TICK(endTick);
+        mtask.m_cost += endTick - startTick;
+        for (const uint32_t succ : mtask.m_successors) {
+            m_mtasks[succ].m_vertexp->signalUpstreamDone(evenCycle);
+        }
+    }
+}
+
+void VlDynamicSchedule::runWorker(VlSelfP runnerp, bool evenCycle) {
+    const Runner* const rp = static_cast<const Runner*>(runnerp);
+    rp->m_schedp->runThread(rp->m_thread, rp->m_selfp, evenCycle);
+    rp->m_schedp->m_donep->signalUpstreamDone(evenCycle);
+}
+
+uint64_t VlDynamicSchedule::predictEnd(const std::vector<uint32_t>& threadOf) const {
+    std::vector<uint64_t> threadEnd(m_threads.size(), 0);
+    std::vector<uint64_t> mtaskEnd(m_mtasks.size(), 0);
+    uint64_t end = 0;
+    for (size_t index = 0; index < m_mtasks.size(); ++index) {
+        const MTask& mtask = m_mtasks[index];
+        const uint32_t thread = threadOf[index];
+        uint64_t start = threadEnd[thread];
+        for (const uint32_t pred : mtask.m_predecessors) {
+            const uint64_t cross = threadOf[pred] != thread ? CROSS_THREAD_COST : 0;
+            start = std::max(start, mtaskEnd[pred] + cross);
+        }
+        mtaskEnd[index] = start + mtask.m_cost;
+        threadEnd[thread] = mtaskEnd[index];
+        end = std::max(end, mtaskEnd[index]);
+    }
+    return end;
+}
+
+std::vector<uint32_t> VlDynamicSchedule::partition() const {
+    std::vector<uint32_t> threadOf(m_mtasks.size(), 0);
+    std::vector<uint64_t> threadEnd(m_threads.size(), 0);
+    std::vector<uint64_t> mtaskEnd(m_mtasks.size(), 0);
+    for (size_t index = 0; index < m_mtasks.size(); ++index) {
+        const MTask& mtask = m_mtasks[index];
+        uint32_t bestThread = 0;
+        uint64_t bestStart = std::numeric_limits<uint64_t>::max();
+        for (uint32_t thread = 0; thread < m_threads.size(); ++thread) {
+            uint64_t start = threadEnd[thread];
+            for (const uint32_t pred : mtask.m_predecessors) {
+                const uint64_t cross = threadOf[pred] != thread ? CROSS_THREAD_COST : 0;
+                start = std::max(start, mtaskEnd[pred] + cross);
+            }
+            if (start < bestStart) {
+                bestStart = start;
+                bestThread = thread;
+            }
+        }
+        threadOf[index] = bestThread;
+        mtaskEnd[index] = bestStart + mtask.m_cost;
+        threadEnd[bestThread] = mtaskEnd[index];
+    }
+    return threadOf;
+}
+
+void VlDynamicSchedule::rebalance() {
+    // All threads are idle here, so the mtask costs and lists can be accessed
+    std::vector<uint32_t> current;
+    current.reserve(m_mtasks.size());
+    for (const MTask& mtask : m_mtasks) current.push_back(mtask.m_thread);
+    const std::vector<uint32_t> proposed = partition();
+    // Only switch if predicted to be at least 5% better, to avoid thrashing on noise
+    const uint64_t currentEnd = predictEnd(current);
+    if (predictEnd(proposed) * 20 < currentEnd * 19) {
+        ++s_rebalances;  // Statistics
+        for (std::vector<uint32_t>& list : m_threads) list.clear();
+        for (uint32_t index = 0; index < m_mtasks.size(); ++index) {
+            m_mtasks[index].m_thread = proposed[index];
+            m_threads[proposed[index]].push_back(index);
+        }
+    }
+    // Decay the costs, so the schedule follows changes in design activity
+    for (MTask& mtask : m_mtasks) mtask.m_cost /= 2;
+}
@@ -28,7 +28,10 @@
 #include "verilated.h"  // for VerilatedMutex and clang annotations
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <initializer_list>
+#include <memory>
 #include <set>
 #include <stack>
 #include <thread>
@@ -48,6 +51,7 @@ using VlExecFnp = void (*)(VlSelfP, bool);
 class VlMTaskVertex final {
     // MEMBERS
     static std::atomic<uint64_t> s_yields;  // Statistics
+    static std::atomic<uint64_t> s_parks;  // Statistics
 
     // On even cycles, _upstreamDepsDone increases as upstream
     // dependencies complete. When it reaches _upstreamDepCount,
@@ -65,6 +69,11 @@ class VlMTaskVertex final {
     // during done-notification. Nobody's quantified that cost though.
     // If we were really serious about shrinking this class, we could
     // use 16-bit types here...)
+    //
+    // WAITER_BIT is set in m_upstreamDepsDone while a thread is parked on it
+    // (see waitUntilUpstreamDone with 'park'), so signalUpstreamDone only
+    // needs the expensive wakeup system call when somebody is waiting.
+    static constexpr uint32_t WAITER_BIT = 1U << 31;
     std::atomic<uint32_t> m_upstreamDepsDone;
     const uint32_t m_upstreamDepCount;
 
@@ -78,6 +87,7 @@ public:
     ~VlMTaskVertex() = default;
 
     static uint64_t yields() { return s_yields; }
+    static uint64_t parks() { return s_parks; }
     static void yieldThread() {
         ++s_yields;  // Statistics
         std::this_thread::yield();
@@ -90,18 +100,22 @@ public:
         if (evenCycle) {
             const uint32_t upstreamDepsDone
                 = 1 + m_upstreamDepsDone.fetch_add(1, std::memory_order_release);
-            assert(upstreamDepsDone <= m_upstreamDepCount);
-            return (upstreamDepsDone == m_upstreamDepCount);
+            assert((upstreamDepsDone & ~WAITER_BIT) <= m_upstreamDepCount);
+            if ((upstreamDepsDone & ~WAITER_BIT) != m_upstreamDepCount) return false;
+            if (VL_UNLIKELY(upstreamDepsDone & WAITER_BIT)) wakeWaiters();
+            return true;
         } else {
             const uint32_t upstreamDepsDone_prev
                 = m_upstreamDepsDone.fetch_sub(1, std::memory_order_release);
-            assert(upstreamDepsDone_prev > 0);
-            return (upstreamDepsDone_prev == 1);
+            assert((upstreamDepsDone_prev & ~WAITER_BIT) > 0);
+            if ((upstreamDepsDone_prev & ~WAITER_BIT) != 1) return false;
+            if (VL_UNLIKELY(upstreamDepsDone_prev & WAITER_BIT)) wakeWaiters();
+            return true;
         }
     }
     bool areUpstreamDepsDone(bool evenCycle) const {
         const uint32_t target = evenCycle ? m_upstreamDepCount : 0;
-        return m_upstreamDepsDone.load(std::memory_order_acquire) == target;
+        return (m_upstreamDepsDone.load(std::memory_order_acquire) & ~WAITER_BIT) == target;
     }
     void waitUntilUpstreamDone(bool evenCycle) const {
         unsigned ct = 0;
@@ -114,6 +128,103 @@ public:
             }
         }
     }
+    // As above, but if 'park', after spinning for a while put the thread to
+    // sleep until the final upstream dependency signals, instead of yielding.
+    void waitUntilUpstreamDone(bool evenCycle, bool park) {
+        if (!park) return waitUntilUpstreamDone(evenCycle);
+        for (unsigned ct = 0; ct < VL_LOCK_SPINS; ++ct) {
+            if (VL_LIKELY(areUpstreamDepsDone(evenCycle))) return;
+            VL_CPU_RELAX();
+        }
+        parkUntilUpstreamDone(evenCycle);
+    }
+
+private:
+    void parkUntilUpstreamDone(bool evenCycle);
+    void wakeWaiters();
+};
+
+// Bounded lock-free queue of tasks for a single VlWorkerThread, after
+// Chase & Lev, "Dynamic Circular Work-Stealing Deque" (SPAA 2005). Tasks are
+// pushed at the bottom by the dispatching thread(s), and are taken in FIFO
+// order from the top, either by the owning worker, or by an idle worker
+// stealing work. Pushes must be serialized by the caller.
+class VlWorkDeque final {
+public:
+    // TYPES
+    struct Rec final {
+        VlExecFnp m_fnp = nullptr;  // Function to execute
+        VlSelfP m_selfp = nullptr;  // Symbol table to execute
+        bool m_evenCycle = false;  // Even/odd for flag alternation
+        bool m_stealable = false;  // Can be executed by other worker threads
+    };
+
+private:
+    // Entries are accessed atomically as a thief might read a slot that is
+    // being overwritten, in which case its compare-exchange of m_top fails.
+    struct Slot final {
+        std::atomic<VlExecFnp> m_fnp{nullptr};
+        std::atomic<VlSelfP> m_selfp{nullptr};
+        std::atomic<uint8_t> m_flags{0};
+    };
+    enum : uint8_t { FLAG_EVEN_CYCLE = 1, FLAG_STEALABLE = 2 };
+    // Typical queues hold 0, 1 or 2 entries, the dispatcher waits when full
+    static constexpr size_t CAPACITY = 256;  // Must be power of 2
+
+    // MEMBERS
+    alignas(VL_CACHE_LINE_BYTES) std::atomic<size_t> m_top{0};  // Next entry to take
+    alignas(VL_CACHE_LINE_BYTES) std::atomic<size_t> m_bottom{0};  // Next entry to push
+    Slot m_slots[CAPACITY];
+
+public:
+    // METHODS
+    size_t size() const {
+        const size_t t = m_top.load(std::memory_order_acquire);
+        const size_t b = m_bottom.load(std::memory_order_acquire);
+        return b - t;
+    }
+    bool empty() const { return size() == 0; }
+    // Add entry at bottom, return false if no room
+    bool push(const Rec& rec) {
+        const size_t b = m_bottom.load(std::memory_order_relaxed);
+        const size_t t = m_top.load(std::memory_order_acquire);
+        if (VL_UNLIKELY(b - t >= CAPACITY)) return false;
+        Slot& slot = m_slots[b & (CAPACITY - 1)];
+        slot.m_fnp.store(rec.m_fnp, std::memory_order_relaxed);
+        slot.m_selfp.store(rec.m_selfp, std::memory_order_relaxed);
+        slot.m_flags.store((rec.m_evenCycle ? FLAG_EVEN_CYCLE : 0)
+                               | (rec.m_stealable ? FLAG_STEALABLE : 0),
+                           std::memory_order_relaxed);
+        // Sequentially consistent, pairs with VlWorkerThread::m_waiting
+        m_bottom.store(b + 1, std::memory_order_seq_cst);
+        return true;
+    }
+    // Remove entry from top, return false if empty, or if 'stealOnly' and
+    // the top entry is not stealable.
+    bool take(Rec& rec, bool stealOnly) {
+        size_t t = m_top.load(std::memory_order_seq_cst);
+        while (true) {
+            const size_t b = m_bottom.load(std::memory_order_seq_cst);
+            if (t >= b) return false;
+            const Slot& slot = m_slots[t & (CAPACITY - 1)];
+            const uint8_t flags = slot.m_flags.load(std::memory_order_relaxed);
+            rec.m_fnp = slot.m_fnp.load(std::memory_order_relaxed);
+            rec.m_selfp = slot.m_selfp.load(std::memory_order_relaxed);
+            rec.m_evenCycle = flags & FLAG_EVEN_CYCLE;
+            rec.m_stealable = flags & FLAG_STEALABLE;
+            if (stealOnly && !rec.m_stealable) {
+                // Re-check in case the entry read was stale
+                if (m_top.load(std::memory_order_seq_cst) == t) return false;
+                t = m_top.load(std::memory_order_seq_cst);
+                continue;
+            }
+            // On failure 't' is updated with the current top, so retry
+            if (m_top.compare_exchange_weak(t, t + 1, std::memory_order_seq_cst,
+                                            std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
 };
 
 class VlWorkerThread final {
@@ -123,25 +234,31 @@ private:
         VlExecFnp m_fnp = nullptr;  // Function to execute
         VlSelfP m_selfp = nullptr;  // Symbol table to execute
         bool m_evenCycle = false;  // Even/odd for flag alternation
+        VlWorkerThread* m_stolenFromp = nullptr;  // Worker the task was stolen from, if any
         ExecRec() = default;
-        ExecRec(VlExecFnp fnp, VlSelfP selfp, bool evenCycle)
-            : m_fnp{fnp}
-            , m_selfp{selfp}
-            , m_evenCycle{evenCycle} {}
+        explicit ExecRec(const VlWorkDeque::Rec& rec)
+            : m_fnp{rec.m_fnp}
+            , m_selfp{rec.m_selfp}
+            , m_evenCycle{rec.m_evenCycle} {}
     };
 
     // MEMBERS
-    mutable VerilatedMutex m_mutex;
+    static std::atomic<uint64_t> s_steals;  // Statistics
+
+    VlThreadPool* const m_poolp;  // Pool this worker belongs to
+    const bool m_steal;  // Steal work from other workers when idle
+    bool m_shutdown = false;  // Shutdown task was added
+
+    mutable VerilatedMutex m_mutex;  // Guards sleeping on m_cv
+    mutable VerilatedMutex m_pushMutex;  // Serializes pushes into m_ready
     std::condition_variable_any m_cv;
-    // Only notify the condition_variable if the worker is waiting
-    bool m_waiting VL_GUARDED_BY(m_mutex) = false;
+    // Only notify the condition_variable if the worker is waiting.
+    // Sequentially consistent, pairs with VlWorkDeque::m_bottom
+    std::atomic<bool> m_waiting{false};
 
-    // Why a vector? We expect the pending list to be very short, typically
-    // 0 or 1 or 2, so popping from the front shouldn't be
-    // expensive. Revisit if we ever have longer queues...
-    std::vector<ExecRec> m_ready VL_GUARDED_BY(m_mutex);
-    // Store the size atomically, so we can spin wait
-    std::atomic<size_t> m_ready_size;
+    VlWorkDeque m_ready;  // Tasks pending execution
+    // Number of tasks stolen from this worker that are still executing
+    std::atomic<uint32_t> m_stolenInFlight{0};
 
     std::thread m_cthread;  // Underlying C++ thread record
 
@@ -153,48 +270,77 @@ protected:
 
 public:
     // CONSTRUCTORS
-    explicit VlWorkerThread(VerilatedContext* contextp);
+    VlWorkerThread(VlThreadPool* poolp, VerilatedContext* contextp, bool steal, unsigned index);
     ~VlWorkerThread();
 
     // METHODS
+    static uint64_t steals() { return s_steals; }
+
     template <bool N_SpinWait>
     void dequeWork(ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        VlWorkDeque::Rec rec;
         // Spin for a while, waiting for new data
         if VL_CONSTEXPR_CXX17 (N_SpinWait) {
             for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
-                if (VL_LIKELY(m_ready_size.load(std::memory_order_relaxed))) break;
+                if (VL_LIKELY(m_ready.take(rec, false))) {
+                    *workp = ExecRec{rec};
+                    return;
+                }
+                if (m_steal && stealWork(workp)) return;
                 VL_CPU_RELAX();
             }
         }
         VerilatedLockGuard lock{m_mutex};
-        while (m_ready.empty()) {
-            m_waiting = true;
-            m_cv.wait(m_mutex);
+        m_waiting.store(true, std::memory_order_seq_cst);
+        while (!m_ready.take(rec, false)) {
+            if (m_steal) {
+                // Wake up periodically to look for work other workers are behind on
+                if (N_SpinWait && stealWork(workp)) {
+                    m_waiting.store(false, std::memory_order_relaxed);
+                    return;
+                }
+                m_cv.wait_for(m_mutex, std::chrono::milliseconds{1});
+            } else {
+                m_cv.wait(m_mutex);
+            }
         }
-        m_waiting = false;
-        // As noted above this is inefficient if our ready list is ever
-        // long (but it shouldn't be)
-        *workp = m_ready.front();
-        m_ready.erase(m_ready.begin());
-        m_ready_size.fetch_sub(1, std::memory_order_relaxed);
+        m_waiting.store(false, std::memory_order_relaxed);
+        *workp = ExecRec{rec};
     }
     void addTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false)
-        VL_MT_SAFE_EXCLUDES(m_mutex) {
-        bool notify;
-        {
-            const VerilatedLockGuard lock{m_mutex};
-            m_ready.emplace_back(fnp, selfp, evenCycle);
-            m_ready_size.fetch_add(1, std::memory_order_relaxed);
-            notify = m_waiting;
-        }
-        if (notify) m_cv.notify_one();
+        VL_MT_SAFE_EXCLUDES(m_mutex) VL_EXCLUDES(m_pushMutex) {
+        pushTask(fnp, selfp, evenCycle, false);
+    }
+    // Add a task that may be executed by another, idle worker, if this
+    // worker is still busy. The task must not depend on running on this
+    // particular thread.
+    void addStealableTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle)
+        VL_MT_SAFE_EXCLUDES(m_mutex) VL_EXCLUDES(m_pushMutex) {
+        pushTask(fnp, selfp, evenCycle, true);
     }
 
     void shutdown();  // Finish current tasks, then terminate thread
     void wait();  // Blocks calling thread until all tasks complete in this thread
 
     void workerLoop();
-    static void startWorker(VlWorkerThread* workerp, VerilatedContext* contextp);
+    static void startWorker(VlWorkerThread* workerp, VerilatedContext* contextp, unsigned index);
+
+private:
+    void pushTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle, bool stealable)
+        VL_MT_SAFE_EXCLUDES(m_mutex) VL_EXCLUDES(m_pushMutex) {
+        const VlWorkDeque::Rec rec{fnp, selfp, evenCycle, stealable};
+        {
+            const VerilatedLockGuard lock{m_pushMutex};
+            while (VL_UNLIKELY(!m_ready.push(rec))) std::this_thread::yield();
+        }
+        if (m_waiting.load(std::memory_order_seq_cst)) {
+            // Synchronize with the worker entering the wait
+            { const VerilatedLockGuard lock{m_mutex}; }
+            m_cv.notify_one();
+        }
+    }
+    // Try to take a stealable task from another worker
+    bool stealWork(ExecRec* workp) VL_MT_SAFE;
 };
 
 class VlThreadPool final : public VerilatedVirtualBase {
@@ -207,6 +353,14 @@ class VlThreadPool final : public VerilatedVirtualBase {
     // For sequentially generating task IDs to avoid shadowing
     std::atomic<unsigned> m_assignedTasks{0};
     std::string m_numaStatus;  // Status of NUMA assignment
+    // Pool is used by multiple VerilatedContexts, see VerilatedContext::threadPoolShare
+    std::atomic<bool> m_shared{false};
+    // Ticket lock giving execution graphs of different models turns on a shared pool
+    alignas(VL_CACHE_LINE_BYTES) std::atomic<uint64_t> m_leaseNext{0};  // Next ticket to issue
+    std::atomic<uint64_t> m_leaseServing{0};  // Ticket currently using the pool
+    std::atomic<VerilatedContext*> m_leaseContextp{nullptr};  // Context of lease holder
+    const bool m_steal;  // Workers steal from each other
+    const bool m_park;  // Sleep instead of yield when waiting for mtasks
 
 public:
     // CONSTRUCTORS
@@ -232,6 +386,24 @@ public:
     unsigned assignTaskIndex() { return m_assignedTasks++; }
     int numThreads() const { return static_cast<int>(m_workers.size()); }
     std::string numaStatus() const { return m_numaStatus; }
+    bool steal() const { return m_steal; }
+    bool park() const { return m_park; }
+    bool shared() const { return m_shared.load(std::memory_order_relaxed); }
+    void shared(bool flag) { m_shared.store(flag); }
+    VerilatedContext* leaseContextp() const {
+        return m_leaseContextp.load(std::memory_order_acquire);
+    }
+    // Must be called around running an execution graph on the pool. When the
+    // pool is shared, gives exclusive use of the workers to one model at a
+    // time, in first come first served order, otherwise does nothing.
+    void leaseAcquire(VerilatedContext* contextp) {
+        if (VL_LIKELY(!shared())) return;
+        leaseAcquireShared(contextp);
+    }
+    void leaseRelease() {
+        if (VL_LIKELY(!shared())) return;
+        m_leaseServing.fetch_add(1, std::memory_order_release);
+    }
     VlWorkerThread* workerp(int index) {
         assert(index >= 0);
         assert(index < static_cast<int>(m_workers.size()));
@@ -241,9 +413,90 @@ public:
 private:
     VL_UNCOPYABLE(VlThreadPool);
 
+    void leaseAcquireShared(VerilatedContext* contextp);
+
     // cppcheck-suppress unusedPrivateFunction
     static bool isNumactlRunning();
     std::string numaAssign();
 };
 
+// Executes the mtasks of one thread schedule of a model Verilated with
+// --threads-rebalance. Execution starts with the assignment of mtasks to
+// threads computed by V3ExecGraph. The cost of each mtask is measured as it
+// runs, and every VerilatedContext::threadsRebalance() evaluations the mtasks
+// are re-partitioned among the threads by list scheduling on these costs.
+// Mtasks are kept in a single topological order, and each thread executes
+// its mtasks in that order, so any partition is free of deadlocks.
+class VlDynamicSchedule final {
+    // CONSTANTS
+    // Estimated cost, in CPU ticks, of waiting on an mtask run by another thread
+    static constexpr uint64_t CROSS_THREAD_COST = 200;
+
+    // TYPES
+    struct MTask final {
+        VlExecFnp m_fnp;  // Function implementing the mtask
+        std::vector<uint32_t> m_predecessors;  // Indices of upstream mtasks
+        std::vector<uint32_t> m_successors;  // Indices of downstream mtasks
+        std::unique_ptr<VlMTaskVertex> m_vertexp;  // Upstream dependencies, if any
+        uint64_t m_cost = 0;  // Measured cost in CPU ticks, decays on each rebalance
+        uint32_t m_thread;  // Thread currently executing this mtask
+    };
+    struct Runner final {
+        VlDynamicSchedule* m_schedp;  // Schedule the runner belongs to
+        uint32_t m_thread;  // Thread executed by the runner
+        VlSelfP m_selfp;  // Symbol table to execute
+    };
+
+    // MEMBERS
+    static std::atomic<uint64_t> s_rebalances;  // Statistics
+
+    std::vector<MTask> m_mtasks;  // All mtasks, in topological order
+    std::vector<std::vector<uint32_t>> m_threads;  // Indices of mtasks to run by each thread
+    std::vector<Runner> m_runners;  // Thread pool task arguments, for threads after the first
+    std::unique_ptr<VlMTaskVertex> m_donep;  // Signaled as each runner completes
+    bool m_park = false;  // Park threads waiting for mtasks, see VlThreadPool::park
+    uint32_t m_evals = 0;  // Evaluations since the last rebalance
+
+public:
+    // CONSTRUCTORS
+    VlDynamicSchedule() = default;
+    ~VlDynamicSchedule() = default;
+
+    // METHODS
+    static uint64_t rebalances() { return s_rebalances; }
+    bool empty() const { return m_mtasks.empty(); }
+    // Set number of threads, including the thread calling execute()
+    void threads(uint32_t n) { m_threads.resize(n); }
+    // Add the next mtask in topological order, initially executed on 'thread'.
+    // 'predecessors' are the return values of addMTask for all upstream mtasks.
+    uint32_t addMTask(VlExecFnp fnp, uint32_t thread,
+                      std::initializer_list<uint32_t> predecessors);
+    // Execute all mtasks, using the first threads()-1 workers of the pool,
+    // and the calling thread, possibly first re-partitioning the mtasks.
+    void execute(VlThreadPool* poolp, VlSelfP selfp, bool evenCycle, uint32_t interval);
+
+private:
+    VL_UNCOPYABLE(VlDynamicSchedule);
+
+    void runThread(uint32_t thread, VlSelfP selfp, bool evenCycle);
+    static void runWorker(VlSelfP runnerp, bool evenCycle);
+    // Predicted time of executing all mtasks, if executed by 'threadOf'
+    uint64_t predictEnd(const std::vector<uint32_t>& threadOf) const;
+    // Greedily assign each mtask to the thread where it is predicted to start soonest
+    std::vector<uint32_t> partition() const;
+    void rebalance();
+};
+
+// The dynamic schedules of a model, see VlDynamicSchedule
+class VlDynamicScheduler final {
+    std::vector<std::unique_ptr<VlDynamicSchedule>> m_schedules;
+
+public:
+    VlDynamicSchedule& schedule(size_t index) {
+        if (VL_UNLIKELY(index >= m_schedules.size())) m_schedules.resize(index + 1);
+        if (VL_UNLIKELY(!m_schedules[index])) m_schedules[index].reset(new VlDynamicSchedule);
+        return *m_schedules[index];
+    }
+};
+
 #endif
@@ -58,14 +58,31 @@ void VlDelayScheduler::resume() {
     VL_DEBUG_IF(dump(); VL_DBG_MSGF("         Resuming delayed processes\n"););
 #endif
     bool resumed = false;
+    const uint64_t now = m_context.time();
 
-    while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
+    // Move the wheel's window to start now, unless still holding an earlier (missed) time
+    if (m_wheelNext >= now) m_wheelBase = now;
+
+    // Coroutines in the tree for this time were scheduled before those in the wheel
+    while (!m_queue.empty() && (m_queue.cbegin()->first == now)) {
         VlCoroutineHandle handle = std::move(m_queue.begin()->second);
         m_queue.erase(m_queue.begin());
         handle.resume();
         resumed = true;
     }
 
+    if (m_wheelNext == now) {
+        // Resumed coroutines schedule later times only, so never into this slot; still
+        // swap the slot out, with a buffer kept from earlier, as others may be reallocated
+        const size_t slot = now % WHEEL_SLOTS;
+        m_wheelResumed.swap(m_wheel[slot]);
+        m_wheelUsed[slot / 64] &= ~(1ULL << (slot % 64));
+        m_wheelNext = wheelFindNext();
+        for (auto&& handle : m_wheelResumed) handle.resume();
+        m_wheelResumed.clear();
+        resumed = true;
+    }
+
     if (!m_zeroDelayed.empty()) {
         // First, we need to move the coroutines out of the queue, as a resumed coroutine can
         // suspend on #0 again, adding itself to the queue, which can result in reallocating the
@@ -84,10 +101,48 @@ void VlDelayScheduler::resume() {
                     "%Error: Encountered process that should've been resumed at an "
                     "earlier simulation time. Missed a time slot?\n");
     }
+#ifdef VL_PERF_STATS
+    m_context.perfCounters().delayQueueDepth(pending());
+#endif
+}
+
+size_t VlDelayScheduler::pending() const {
+    size_t count = m_queue.size() + m_zeroDelayed.size();
+    for (size_t word = 0; word < WHEEL_WORDS; ++word) {
+        if (!m_wheelUsed[word]) continue;
+        for (size_t bit = 0; bit < 64; ++bit) {
+            if (m_wheelUsed[word] & (1ULL << bit)) count += m_wheel[word * 64 + bit].size();
+        }
+    }
+    return count;
+}
+
+uint64_t VlDelayScheduler::wheelFindNext() const {
+    // Search the bitmap from m_wheelBase's slot, wrapping around to the slots before it
+    const size_t start = m_wheelBase % WHEEL_SLOTS;
+    for (size_t n = 0; n <= WHEEL_WORDS; ++n) {
+        const size_t word = (start / 64 + n) % WHEEL_WORDS;
+        uint64_t bits = m_wheelUsed[word];
+        if (n == 0) bits &= ~0ULL << (start % 64);
+        if (n == WHEEL_WORDS) bits &= ~(~0ULL << (start % 64));
+        if (bits) {
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS)
+            const size_t bit = __builtin_ctzll(bits);
+#else
+            size_t bit = 0;
+            while (!((bits >> bit) & 1)) ++bit;
+#endif
+            const size_t slot = word * 64 + bit;
+            return m_wheelBase + (slot + WHEEL_SLOTS - start) % WHEEL_SLOTS;
+        }
+    }
+    return TIME_NONE;
 }
 
 uint64_t VlDelayScheduler::nextTimeSlot() const {
-    if (!m_queue.empty()) return m_queue.cbegin()->first;
+    if (!m_queue.empty() || m_wheelNext != TIME_NONE) {
+        return std::min(m_wheelNext, m_queue.empty() ? TIME_NONE : m_queue.cbegin()->first);
+    }
     if (m_zeroDelayed.empty())
         VL_FATAL_MT(__FILE__, __LINE__, "", "There is no next time slot scheduled");
     return m_context.time();
@@ -95,7 +150,7 @@ uint64_t VlDelayScheduler::nextTimeSlot() const {
 
 #ifdef VL_DEBUG
 void VlDelayScheduler::dump() const {
-    if (m_queue.empty()) {
+    if (empty()) {
         VL_DBG_MSGF("         No delayed processes:\n");
     } else {
         VL_DBG_MSGF("         Delayed processes:\n");
@@ -105,6 +160,14 @@ void VlDelayScheduler::dump() const {
                         m_context.time());
             susp.dump();
         }
+        if (m_wheelNext != TIME_NONE) {
+            for (uint64_t time = m_wheelNext; time - m_wheelBase < WHEEL_SLOTS; ++time) {
+                for (const auto& susp : m_wheel[time % WHEEL_SLOTS]) {
+                    VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", time);
+                    susp.dump();
+                }
+            }
+        }
         for (const auto& susp : m_queue) {
             VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.first);
             susp.second.dump();
@@ -139,7 +202,12 @@ void VlTriggerScheduler::commit(const char* eventDescription) {
             });
     }
 #endif
-    m_ready.reserve(m_ready.size() + m_uncommitted.size());
+    if (m_uncommitted.empty()) return;
+    if (m_ready.empty()) {
+        // Common case, as resume() empties m_ready: take the buffer rather than moving each
+        m_ready.swap(m_uncommitted);
+        return;
+    }
     m_ready.insert(m_ready.end(), std::make_move_iterator(m_uncommitted.begin()),
                    std::make_move_iterator(m_uncommitted.end()));
     m_uncommitted.clear();
@@ -150,8 +218,8 @@ void VlTriggerScheduler::dump(const char* eventDescription) const {
     if (m_ready.empty()) {
         VL_DBG_MSGF("         No ready processes waiting for %s\n", eventDescription);
     } else {
+        VL_DBG_MSGF("         Ready processes waiting for %s:\n", eventDescription);
         for (const auto& susp : m_ready) {
-            VL_DBG_MSGF("         Ready processes waiting for %s:\n", eventDescription);
             VL_DBG_MSGF("           - ");
             susp.dump();
         }
@@ -224,6 +292,84 @@ void VlForkSync::done(const char* filename, int lineno) {
     if (m_join->m_counter == 0) m_join->m_susp.resume();
 }
 
+//======================================================================
+// VlCoroutineFramePool:: Methods
+
+thread_local VlCoroutineFramePool VlCoroutineFramePool::t_pool;
+
+namespace {
+// Pools of all live threads, and counts of pools of exited threads, for statsPrint
+struct VlCoroutineFrameStats final {
+    VerilatedMutex m_mutex;
+    std::vector<const VlCoroutineFramePool*> m_pools VL_GUARDED_BY(m_mutex);
+    std::array<uint64_t, VlCoroutineFramePool::CLASSES> m_allocs VL_GUARDED_BY(m_mutex){};
+    std::array<uint64_t, VlCoroutineFramePool::CLASSES> m_news VL_GUARDED_BY(m_mutex){};
+    uint64_t m_largeAllocs VL_GUARDED_BY(m_mutex) = 0;
+};
+VlCoroutineFrameStats& frameStats() {
+    static VlCoroutineFrameStats s_stats;
+    return s_stats;
+}
+}  // namespace
+
+VlCoroutineFramePool::VlCoroutineFramePool() {
+    VlCoroutineFrameStats& stats = frameStats();
+    const VerilatedLockGuard lock{stats.m_mutex};
+    stats.m_pools.push_back(this);
+}
+
+VlCoroutineFramePool::~VlCoroutineFramePool() {
+    for (FreeFrame* freep : m_freeps) {
+        while (freep) {
+            FreeFrame* const nextp = freep->m_nextp;
+            ::operator delete(freep);
+            freep = nextp;
+        }
+    }
+    VlCoroutineFrameStats& stats = frameStats();
+    const VerilatedLockGuard lock{stats.m_mutex};
+    for (size_t i = 0; i < CLASSES; ++i) {
+        stats.m_allocs[i] += m_allocs[i];
+        stats.m_news[i] += m_news[i];
+    }
+    stats.m_largeAllocs += m_largeAllocs;
+    stats.m_pools.erase(std::find(stats.m_pools.begin(), stats.m_pools.end(), this));
+}
+
+void VlCoroutineFramePool::statsPrint() VL_MT_UNSAFE {
+    VlCoroutineFrameStats& stats = frameStats();
+    const VerilatedLockGuard lock{stats.m_mutex};
+    std::array<uint64_t, CLASSES> allocs = stats.m_allocs;
+    std::array<uint64_t, CLASSES> news = stats.m_news;
+    uint64_t largeAllocs = stats.m_largeAllocs;
+    for (const VlCoroutineFramePool* const poolp : stats.m_pools) {
+        for (size_t i = 0; i < CLASSES; ++i) {
+            allocs[i] += poolp->m_allocs[i];
+            news[i] += poolp->m_news[i];
+        }
+        largeAllocs += poolp->m_largeAllocs;
+    }
+    uint64_t totalAllocs = largeAllocs;
+    uint64_t totalNews = largeAllocs;
+    for (size_t i = 0; i < CLASSES; ++i) {
+        totalAllocs += allocs[i];
+        totalNews += news[i];
+    }
+    VL_PRINTF_MT("- Verilator: coroutine frames: %" PRIu64 " allocated, %" PRIu64
+                 " needed new memory\n",
+                 totalAllocs, totalNews);
+    for (size_t i = 0; i < CLASSES; ++i) {
+        if (!allocs[i]) continue;
+        VL_PRINTF_MT("-   up to %5zu bytes: %" PRIu64 " allocated, %" PRIu64
+                     " needed new memory\n",
+                     (i + 1) * GRANULE, allocs[i], news[i]);
+    }
+    if (largeAllocs) {
+        VL_PRINTF_MT("-   over %5zu bytes: %" PRIu64 " allocated\n", CLASSES * GRANULE,
+                     largeAllocs);
+    }
+}
+
 //======================================================================
 // VlCoroutine:: Methods
 
@@ -234,7 +380,7 @@ VlCoroutine::VlPromise::~VlPromise() {
     if (m_continuation) m_continuation.destroy();
 }
 
-std::suspend_never VlCoroutine::VlPromise::final_suspend() noexcept {
+VlCoroutine::VlPromise::FinalAwaiter VlCoroutine::VlPromise::final_suspend() noexcept {
     // Indicate to the return object that the coroutine has finished
     if (m_corop) {
         m_corop->m_promisep = nullptr;
@@ -242,10 +388,16 @@ std::suspend_never VlCoroutine::VlPromise::final_suspend() noexcept {
         // it's destroyed
         m_corop = nullptr;
     }
-    // If there is a continuation, resume it
-    if (m_continuation) {
-        m_continuation();
-        m_continuation = nullptr;
-    }
     return {};
 }
+
+std::coroutine_handle<> VlCoroutine::VlPromise::FinalAwaiter::await_suspend(
+    std::coroutine_handle<VlPromise> coro) noexcept {
+    // Take the continuation, so destroying the promise does not destroy it
+    const std::coroutine_handle<> continuation = std::exchange(coro.promise().m_continuation, {});
+    // The coroutine has finished, so clean up after itself
+    coro.destroy();
+    // Resume the continuation by symmetric transfer, instead of a nested call
+    if (continuation) return continuation;
+    return std::noop_coroutine();
+}
@@ -124,7 +124,7 @@ public:
     // Move the handle, leaving a nullptr
     // non-explicit:
     // cppcheck-suppress noExplicitConstructor
-    VlCoroutineHandle(VlCoroutineHandle&& moved)
+    VlCoroutineHandle(VlCoroutineHandle&& moved) noexcept
         : m_coro{std::exchange(moved.m_coro, nullptr)}
         , m_process{std::exchange(moved.m_process, nullptr)}
         , m_fileline{moved.m_fileline} {}
@@ -141,7 +141,7 @@ public:
     }
     // METHODS
     // Move the handle, leaving a null handle
-    auto& operator=(VlCoroutineHandle&& moved) {
+    auto& operator=(VlCoroutineHandle&& moved) noexcept {
         m_coro = std::exchange(moved.m_coro, nullptr);
         m_process = std::exchange(moved.m_process, nullptr);
         m_fileline = moved.m_fileline;
@@ -159,20 +159,57 @@ enum class VlDelayPhase : bool { ACTIVE, INACTIVE };
 //=============================================================================
 // VlDelayScheduler stores coroutines to be resumed at a certain simulation time. If the current
 // time is equal to a coroutine's resume time, the coroutine gets resumed.
+//
+// Coroutines resuming within WHEEL_SLOTS time units are kept in a timing wheel, a vector per
+// time slot, so scheduling and resuming them is O(1) and reuses the vectors' buffers.  Later
+// ones are kept in a time-sorted tree.  A resume time enters the wheel's window only after any
+// coroutines for it were put in the tree, so resuming the tree's coroutines first keeps the
+// order in which coroutines were scheduled.
 
 class VlDelayScheduler final {
     // TYPES
     // Time-sorted queue of timestamps and handles
     using VlDelayedCoroutineQueue = std::multimap<uint64_t, VlCoroutineHandle>;
 
+    // CONSTANTS
+    static constexpr uint64_t WHEEL_SLOTS = 4096;  // Time slots in wheel, power of 2
+    static constexpr size_t WHEEL_WORDS = WHEEL_SLOTS / 64;  // Words in m_wheelUsed
+    static constexpr uint64_t TIME_NONE = ~0ULL;  // No time
+
     // MEMBERS
     VerilatedContext& m_context;
-    VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored beyond the wheel's window
+    // Coroutines to be restored at times in [m_wheelBase, m_wheelBase + WHEEL_SLOTS), indexed
+    // by time modulo WHEEL_SLOTS. Empty until first used.
+    std::vector<std::vector<VlCoroutineHandle>> m_wheel;
+    std::array<uint64_t, WHEEL_WORDS> m_wheelUsed{};  // Bitmap of non-empty m_wheel slots
+    uint64_t m_wheelBase = 0;  // Earliest time the wheel may hold
+    uint64_t m_wheelNext = TIME_NONE;  // Earliest time in the wheel, TIME_NONE if empty
+    std::vector<VlCoroutineHandle> m_wheelResumed;  // Wheel slot being resumed. Kept as a
+                                                    // field to avoid reallocation.
     std::vector<VlCoroutineHandle> m_zeroDelayed;  // Coroutines waiting for #0
     std::vector<VlCoroutineHandle> m_zeroDlyResumed;  // Coroutines that waited for #0 and are
                                                       // to be resumed. Kept as a field to avoid
                                                       // reallocation.
 
+    // METHODS
+    // Add a coroutine to be resumed at the given time
+    void schedule(uint64_t time, VlCoroutineHandle&& handle) {
+        if (time >= m_wheelBase && time - m_wheelBase < WHEEL_SLOTS) {
+            if (VL_UNLIKELY(m_wheel.empty())) m_wheel.resize(WHEEL_SLOTS);
+            const size_t slot = time % WHEEL_SLOTS;
+            m_wheel[slot].emplace_back(std::move(handle));
+            m_wheelUsed[slot / 64] |= 1ULL << (slot % 64);
+            if (time < m_wheelNext) m_wheelNext = time;
+        } else {
+            m_queue.emplace(time, std::move(handle));
+        }
+    }
+    // Earliest time in the wheel, from m_wheelUsed
+    uint64_t wheelFindNext() const;
+    // Number of coroutines waiting, for --perf-stats
+    size_t pending() const;
+
 public:
     // CONSTRUCTORS
     explicit VlDelayScheduler(VerilatedContext& context)
@@ -184,10 +221,13 @@ public:
     // coroutines)
     uint64_t nextTimeSlot() const;
     // Are there no delayed coroutines awaiting?
-    bool empty() const { return m_queue.empty() && m_zeroDelayed.empty(); }
+    bool empty() const {
+        return m_queue.empty() && m_wheelNext == TIME_NONE && m_zeroDelayed.empty();
+    }
     // Are there coroutines to resume at the current simulation time?
     bool awaitingCurrentTime() const {
-        return (!m_queue.empty() && (m_queue.cbegin()->first <= m_context.time()))
+        return m_wheelNext <= m_context.time()
+               || (!m_queue.empty() && (m_queue.cbegin()->first <= m_context.time()))
                || !m_zeroDelayed.empty();
     }
 #ifdef VL_DEBUG
@@ -198,8 +238,7 @@ public:
                int lineno = 0) {
         struct Awaitable final {
             VlProcessRef process;  // Data of the suspended process, null if not needed
-            VlDelayedCoroutineQueue& queue;
-            std::vector<VlCoroutineHandle>& queueZeroDelay;
+            VlDelayScheduler& sched;
             const uint64_t delay;
             const VlDelayPhase phase;
             const VlFileLineDebug fileline;
@@ -207,9 +246,9 @@ public:
             bool await_ready() const { return false; }  // Always suspend
             void await_suspend(std::coroutine_handle<> coro) {
                 if (phase == VlDelayPhase::ACTIVE) {
-                    queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
+                    sched.schedule(delay, VlCoroutineHandle{coro, process, fileline});
                 } else {
-                    queueZeroDelay.emplace_back(VlCoroutineHandle{coro, process, fileline});
+                    sched.m_zeroDelayed.emplace_back(VlCoroutineHandle{coro, process, fileline});
                 }
             }
             void await_resume() const {}
@@ -224,9 +263,8 @@ public:
         }
 #endif
 
-        return Awaitable{process,       m_queue,
-                         m_zeroDelayed, m_context.time() + delay,
-                         phase,         VlFileLineDebug{filename, lineno}};
+        return Awaitable{process, *this, m_context.time() + delay, phase,
+                         VlFileLineDebug{filename, lineno}};
     }
 };
 
@@ -250,6 +288,8 @@ class VlTriggerScheduler final {
                                    // avoid reallocation. Resumed coroutines are moved to
                                    // m_resumeQueue to allow adding coroutines to m_ready
                                    // during resume(). Outside of resume() should always be empty.
+    // The three vectors only ever exchange buffers, so once each has grown to the number of
+    // processes waiting on the trigger, suspending and resuming them does not allocate.
 
 public:
     // METHODS
@@ -300,6 +340,10 @@ public:
 // The coroutines get resumed at trigger evaluation time, evaluate their local triggers, optionally
 // await the post update step, and if the trigger is set, await proper resumption in the 'act' eval
 // step.
+//
+// If every write of the variables a trigger reads is followed by a call to written(<group>),
+// the coroutine instead awaits evaluationDeps(<group>), and is only evaluated again once one of
+// them was written.
 
 class VlDynamicTriggerScheduler final {
     // TYPES
@@ -312,6 +356,7 @@ class VlDynamicTriggerScheduler final {
     VlCoroutineVec m_triggered;  // Coroutines whose triggers were set, and are awaiting resumption
     VlCoroutineVec m_post;  // Coroutines awaiting the post update step (only relevant for triggers
                             // with destructive post updates, e.g. named events)
+    std::vector<VlCoroutineVec> m_waiting;  // Per dependency group, coroutines awaiting a write
 
     // METHODS
     auto awaitable(VlProcessRef process, VlCoroutineVec& queue, const char* filename, int lineno) {
@@ -348,6 +393,22 @@ public:
                                 eventDescription, filename, lineno););
         return awaitable(process, m_suspended, filename, lineno);
     }
+    // Used by coroutines for co_awaiting trigger evaluation after a write to a variable of the
+    // given dependency group
+    auto evaluationDeps(uint32_t group, VlProcessRef process, const char* eventDescription,
+                        const char* filename, int lineno) {
+        VL_DEBUG_IF(VL_DBG_MSGF("         Suspending process waiting for %s at %s:%d\n",
+                                eventDescription, filename, lineno););
+        if (VL_UNLIKELY(group >= m_waiting.size())) m_waiting.resize(group + 1);
+        return awaitable(process, m_waiting[group], filename, lineno);
+    }
+    // Called after writing a variable of the given dependency group
+    void written(uint32_t group) {
+        if (group >= m_waiting.size()) return;
+        VlCoroutineVec& waiting = m_waiting[group];
+        for (VlCoroutineHandle& coro : waiting) m_suspended.emplace_back(std::move(coro));
+        waiting.clear();
+    }
     // Used by coroutines for co_awaiting the trigger post update step
     auto postUpdate(VlProcessRef process, const char* eventDescription, const char* filename,
                     int lineno) {
@@ -384,6 +445,10 @@ class VlForkSync final {
     struct VlJoin final {
         size_t m_counter = 0;  // When reaches 0, resume suspended coroutine
         VlCoroutineHandle m_susp;  // Coroutine to resume
+
+        VlJoin(size_t counter, VlProcessRef process)
+            : m_counter{counter}
+            , m_susp{process} {}
     };
 
     // The join info is shared among all forked processes
@@ -391,7 +456,9 @@ class VlForkSync final {
 
 public:
     // Create the join object and set the counter to the specified number
-    void init(size_t count, VlProcessRef process) { m_join.reset(new VlJoin{count, {process}}); }
+    void init(size_t count, VlProcessRef process) {
+        m_join = std::make_shared<VlJoin>(count, process);  // One allocation with the refcount
+    }
     // Called whenever any of the forked processes finishes. If the join counter reaches 0, the
     // main process gets resumed
     void done(const char* filename = VL_UNKNOWN, int lineno = 0);
@@ -415,6 +482,70 @@ public:
     }
 };
 
+//=============================================================================
+// VlCoroutineFramePool
+// Thread-local free lists of coroutine frames, by size class, so frames of short-lived
+// coroutines, e.g. from fork, are reused without going through the global allocator. A frame
+// freed by another thread than allocated it goes to the freeing thread's lists. Frames are
+// returned to the global allocator when the thread exits.
+
+class VlCoroutineFramePool final {
+public:
+    // CONSTANTS
+    static constexpr size_t GRANULE = 64;  // Bytes between size classes
+    static constexpr size_t CLASSES = 64;  // Number of size classes, larger frames not pooled
+
+private:
+    // TYPES
+    struct FreeFrame final {
+        FreeFrame* m_nextp;  // Next free frame of same size class
+    };
+
+    // MEMBERS
+    std::array<FreeFrame*, CLASSES> m_freeps{};  // Free list per size class
+    std::array<uint64_t, CLASSES> m_allocs{};  // Frames allocated per size class
+    std::array<uint64_t, CLASSES> m_news{};  // Frames needing new memory per size class
+    uint64_t m_largeAllocs = 0;  // Frames too large to pool
+    static thread_local VlCoroutineFramePool t_pool;  // This thread's pool
+
+    // CONSTRUCTORS
+    VlCoroutineFramePool();
+    ~VlCoroutineFramePool();
+    VL_UNCOPYABLE(VlCoroutineFramePool);
+
+public:
+    // METHODS
+    static void* allocate(size_t size) {
+        VlCoroutineFramePool& pool = t_pool;
+        const size_t index = (size - 1) / GRANULE;
+        if (VL_UNLIKELY(index >= CLASSES)) {
+            ++pool.m_largeAllocs;
+            return ::operator new(size);
+        }
+        ++pool.m_allocs[index];
+        if (FreeFrame* const framep = pool.m_freeps[index]) {
+            pool.m_freeps[index] = framep->m_nextp;
+            return framep;
+        }
+        ++pool.m_news[index];
+        return ::operator new((index + 1) * GRANULE);
+    }
+    static void deallocate(void* framep, size_t size) {
+        const size_t index = (size - 1) / GRANULE;
+        if (VL_UNLIKELY(index >= CLASSES)) {
+            ::operator delete(framep);
+            return;
+        }
+        VlCoroutineFramePool& pool = t_pool;
+        FreeFrame* const freep = static_cast<FreeFrame*>(framep);
+        freep->m_nextp = pool.m_freeps[index];
+        pool.m_freeps[index] = freep;
+    }
+    // Print frame counts by size, summed over all threads. Call only when no coroutines are
+    // being created or destroyed.
+    static void statsPrint() VL_MT_UNSAFE;
+};
+
 //=============================================================================
 // VlCoroutine
 // Return value of a coroutine. Used for chaining coroutine suspension/resumption.
@@ -433,12 +564,24 @@ private:
         // Never suspend at the start of the coroutine
         std::suspend_never initial_suspend() const { return {}; }
 
-        // Never suspend at the end of the coroutine (thanks to this, the coroutine will clean up
-        // after itself)
-        std::suspend_never final_suspend() noexcept;
+        // Awaiter of the end of the coroutine. The coroutine cleans up after itself, and
+        // transfers control directly to its continuation, so a chain of awaiting coroutines
+        // finishes without growing the stack
+        struct FinalAwaiter final {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<VlPromise> coro) noexcept;
+            void await_resume() const noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept;
 
         void unhandled_exception() const { std::abort(); }
         void return_void() const {}
+
+        // Allocate coroutine frames from the pool
+        static void* operator new(size_t size) { return VlCoroutineFramePool::allocate(size); }
+        static void operator delete(void* framep, size_t size) noexcept {
+            VlCoroutineFramePool::deallocate(framep, size);
+        }
     };
 
     // MEMBERS
@@ -25,6 +25,7 @@
 // clang-format off
 
 #include "verilated.h"
+#include "verilated_intrinsics.h"
 
 #include <bitset>
 #include <condition_variable>
@@ -214,6 +215,7 @@ public:
     using dumpCb_t = void (*)(void*, Buffer*);  // Type of dump callbacks
     using dumpOffloadCb_t = void (*)(void*, OffloadBuffer*);  // Type of offload dump callbacks
     using cleanupCb_t = void (*)(void*, T_Trace*);  // Type of cleanup callbacks
+    using dumpTriggerCb_t = bool (*)(void*);  // Type of dump trigger callbacks
 
 private:
     // Give the buffer (both base and derived) access to the private bits
@@ -276,6 +278,9 @@ protected:
     EData* m_sigs_enabledp = nullptr;  // Bit vector of enabled codes (nullptr = all on)
 private:
     std::vector<bool> m_sigs_enabledVec;  // Staging for m_sigs_enabledp
+    std::vector<std::string> m_scopeNames;  // Scopes of declared signals
+    std::vector<uint32_t> m_codeScopes;  // Index in m_scopeNames per code, ~0U if not declared
+    std::vector<std::pair<std::string, bool>> m_enableScopes;  // enableScope() entries
     std::vector<CallbackRecord> m_initCbs;  // Routines to initialize tracing
     std::vector<CallbackRecord> m_constCbs;  // Routines to perform const dump
     std::vector<CallbackRecord> m_constOffloadCbs;  // Routines to perform offloaded const dump
@@ -295,6 +300,10 @@ private:
     double m_timeUnit = 1e-0;  // Time units (ns/ms etc)
     uint64_t m_timeLastDump = 0;  // Last time we did a dump
     bool m_didSomeDump = false;  // Did at least one dump (i.e.: m_timeLastDump is valid)
+    uint32_t m_dumpDecimate = 1;  // Dump only every this many dump() calls
+    uint32_t m_dumpSkipped = 0;  // dump() calls skipped since last decimated dump
+    dumpTriggerCb_t m_dumpTriggerCb = nullptr;  // Dump only when returns true, if non-null
+    void* m_dumpTriggerUserp = nullptr;  // User pointer passed to m_dumpTriggerCb
     VerilatedContext* m_contextp = nullptr;  // The context used by the traced models
     std::set<const VerilatedModel*> m_models;  // The collection of models being traced
 
@@ -315,6 +324,11 @@ private:
 
     // Number of total offload buffers that have been allocated
     uint32_t m_numOffloadBuffers = 0;
+    // Maximum number of offload buffers to allocate before waiting on the worker
+    uint32_t m_offloadBufferLimit = 8;
+    // Number of times, and total nanoseconds, waited for the worker to return a buffer
+    uint64_t m_offloadStalls = 0;
+    uint64_t m_offloadStallNs = 0;
     // Size of offload buffers
     size_t m_offloadBufferSize = 0;
     // Buffers handed to worker for processing
@@ -367,12 +381,15 @@ protected:
 
     // Declare new signal and return true if enabled
     bool declCode(uint32_t code, const std::string& declName, uint32_t bits);
+    // Apply an enableScope() entry to m_sigs_enabledp
+    void applyEnableScope(const std::string& hierSpaced, bool enable);
 
     void closeBase();
     void flushBase();
 
     bool offload() const { return m_offload; }
     bool parallel() const { return m_parallel; }
+    VerilatedContext* contextp() const { return m_contextp; }
 
     // Return last ' ' separated word. Assumes string does not end in ' '.
     static std::string lastWord(const std::string& str) {
@@ -415,9 +432,37 @@ public:
     // Set variables to dump, using $dumpvars format
     // If level = 0, dump everything and hier is then ignored
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE;
+    // Pause or resume tracing of a scope and all scopes under it. Unlike
+    // dumpvars, this may be called at any time, but only affects signals
+    // that were declared when the trace was opened.
+    void enableScope(const std::string& hier, bool enable) VL_MT_SAFE_EXCLUDES(m_mutex);
 
     // Call
     void dump(uint64_t timeui) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Only dump on every n-th call to dump(), 1 = every call
+    void dumpDecimate(uint32_t n) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        m_dumpDecimate = n ? n : 1;
+        m_dumpSkipped = 0;
+    }
+    // Only dump when cb(userp) returns true, nullptr = always
+    void dumpTrigger(dumpTriggerCb_t cb, void* userp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        m_dumpTriggerCb = cb;
+        m_dumpTriggerUserp = userp;
+    }
+
+    // Offload tuning, only applies when Verilated with --trace-threads.
+    // Set maximum number of offload buffers in flight (minimum 2); call before open()
+    void offloadBufferLimit(uint32_t limit) VL_MT_UNSAFE {
+        m_offloadBufferLimit = limit < 2 ? 2 : limit;
+    }
+    // Number of offload buffers allocated so far
+    uint32_t offloadBuffers() const VL_MT_UNSAFE { return m_numOffloadBuffers; }
+    // Number of times dump() waited for the worker thread to free a buffer
+    uint64_t offloadStalls() const VL_MT_UNSAFE { return m_offloadStalls; }
+    // Total time dump() waited for the worker thread, in seconds
+    double offloadStallSeconds() const VL_MT_UNSAFE { return m_offloadStallNs * 1e-9; }
 
     //=========================================================================
     // Internal interface to Verilator generated code
@@ -436,6 +481,34 @@ public:
     void addCleanupCb(cleanupCb_t cb, void* userp) VL_MT_SAFE;
 };
 
+//=============================================================================
+// vlTraceWordsChanged
+
+// Return if any of 'words' words differ, for change detection of wide
+// signals.  Mostly static buses are compared in full, so compare a vector
+// at a time and OR the differences, rather than branching on every word.
+static inline bool vlTraceWordsChanged(const uint32_t* oldp, const uint32_t* newp, int words) {
+    int i = 0;
+#if defined(VL_HAVE_AVX2)
+    for (; i + 8 <= words; i += 8) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(oldp + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(newp + i));
+        const __m256i diff = _mm256_xor_si256(a, b);
+        if (!_mm256_testz_si256(diff, diff)) return true;
+    }
+#elif defined(VL_HAVE_SSE2)
+    for (; i + 4 <= words; i += 4) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(oldp + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(newp + i));
+        const __m128i same = _mm_cmpeq_epi32(a, b);
+        if (_mm_movemask_epi8(same) != 0xffff) return true;
+    }
+#endif
+    uint32_t diff = 0;
+    for (; i < words; ++i) diff |= oldp[i] ^ newp[i];
+    return diff != 0;
+}
+
 //=============================================================================
 // VerilatedTraceBuffer
 
@@ -480,6 +553,14 @@ public:
 
     VL_ATTR_ALWINLINE uint32_t* oldp(uint32_t code) { return m_sigs_oldvalp + code; }
 
+    // Return true if any of 'nCodes' codes starting at 'oldp' may be traced.
+    // Change dump functions use this to skip disabled scopes wholesale.
+    VL_ATTR_ALWINLINE bool anyEnabled(const uint32_t* oldp, uint32_t nCodes) const {
+        if (VL_LIKELY(!m_sigs_enabledp)) return true;
+        return anyEnabledSlow(oldp - m_sigs_oldvalp, nCodes);
+    }
+    bool anyEnabledSlow(uint32_t code, uint32_t nCodes) const;
+
     // Write to previous value buffer value and emit trace entry.
     void fullBit(uint32_t* oldp, CData newval);
     void fullCData(uint32_t* oldp, CData newval, int bits);
@@ -519,11 +600,8 @@ public:
         if (VL_UNLIKELY(diff)) fullQData(oldp, newval, bits);
     }
     VL_ATTR_ALWINLINE void chgWData(uint32_t* oldp, const WData* newvalp, int bits) {
-        for (int i = 0; i < (bits + 31) / 32; ++i) {
-            if (VL_UNLIKELY(oldp[i] ^ newvalp[i])) {
-                fullWData(oldp, newvalp, bits);
-                return;
-            }
+        if (VL_UNLIKELY(vlTraceWordsChanged(oldp, newvalp, (bits + 31) / 32))) {
+            fullWData(oldp, newvalp, bits);
         }
     }
     VL_ATTR_ALWINLINE void chgEvent(uint32_t* oldp, const VlEventBase* newvalp) {
@@ -27,6 +27,7 @@
 #include "verilated_intrinsics.h"
 #include "verilated_trace.h"
 #include "verilated_threads.h"
+#include <chrono>
 #include <list>
 
 #if 0
@@ -67,19 +68,21 @@ template <>
 uint32_t* VerilatedTrace<VL_SUB_T, VL_BUF_T>::getOffloadBuffer() {
     uint32_t* bufferp;
     // Some jitter is expected, so some number of alternative offload buffers are
-    // required, but don't allocate more than 8 buffers.
-    if (m_numOffloadBuffers < 8) {
-        // Allocate a new buffer if none is available
-        if (!m_offloadBuffersFromWorker.tryGet(bufferp)) {
-            ++m_numOffloadBuffers;
-            // Note: over allocate a bit so pointer comparison is well defined
-            // if we overflow only by a small amount
-            bufferp = new uint32_t[m_offloadBufferSize + 16];
-        }
-    } else {
-        // Block until a buffer becomes available
-        bufferp = m_offloadBuffersFromWorker.get();
+    // required, but don't allocate more than m_offloadBufferLimit buffers.
+    if (m_offloadBuffersFromWorker.tryGet(bufferp)) return bufferp;
+    if (m_numOffloadBuffers < m_offloadBufferLimit) {
+        // Allocate a new buffer as none is available
+        ++m_numOffloadBuffers;
+        // Note: over allocate a bit so pointer comparison is well defined
+        // if we overflow only by a small amount
+        return new uint32_t[m_offloadBufferSize + 16];
     }
+    // Block until a buffer becomes available, recording how long the worker held us up
+    const auto start = std::chrono::steady_clock::now();
+    bufferp = m_offloadBuffersFromWorker.get();
+    const auto waited = std::chrono::steady_clock::now() - start;
+    ++m_offloadStalls;
+    m_offloadStallNs += std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count();
     return bufferp;
 }
 
@@ -301,6 +304,36 @@ VerilatedTrace<VL_SUB_T, VL_BUF_T>::~VerilatedTrace() {
 //=========================================================================
 // Internals available to format-specific implementations
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::applyEnableScope(const std::string& hierSpaced,
+                                                          bool enable) {
+    if (!m_sigs_enabledp) {
+        // All declared codes were enabled
+        m_sigs_enabledp = new uint32_t[1 + VL_WORDS_I(nextCode())]{0};
+        for (uint32_t code = 0; code < nextCode(); ++code) {
+            if (m_codeScopes[code] != ~0U) {
+                m_sigs_enabledp[VL_BITWORD_I(code)] |= 1U << VL_BITBIT_I(code);
+            }
+        }
+    }
+    // Match each scope once, rather than each code
+    std::vector<bool> matches(m_scopeNames.size());
+    for (size_t i = 0; i < m_scopeNames.size(); ++i) {
+        const std::string& name = m_scopeNames[i];
+        matches[i] = name.compare(0, hierSpaced.size(), hierSpaced) == 0
+                     && (name.size() == hierSpaced.size() || name[hierSpaced.size()] == ' ');
+    }
+    for (uint32_t code = 0; code < nextCode(); ++code) {
+        const uint32_t scope = m_codeScopes[code];
+        if (scope == ~0U || !matches[scope]) continue;
+        if (enable) {
+            m_sigs_enabledp[VL_BITWORD_I(code)] |= 1U << VL_BITBIT_I(code);
+        } else {
+            m_sigs_enabledp[VL_BITWORD_I(code)] &= ~(1U << VL_BITBIT_I(code));
+        }
+    }
+}
+
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
     // Note: It is possible to re-open a trace file (VCD in particular),
@@ -311,6 +344,8 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
     m_numSignals = 0;
     m_maxBits = 0;
     m_sigs_enabledVec.clear();
+    m_scopeNames.clear();
+    m_codeScopes.clear();
 
     // Call all initialize callbacks, which will:
     // - Call decl* for each signal (these eventually call ::declCode)
@@ -342,6 +377,8 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
         }
         m_sigs_enabledVec.clear();
     }
+    m_codeScopes.resize(nextCode(), ~0U);
+    for (const auto& item : m_enableScopes) applyEnableScope(item.first, item.second);
 
     // Set callback so flush/abort will flush this file
     Verilated::addFlushCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onFlush, this);
@@ -393,6 +430,30 @@ bool VerilatedTrace<VL_SUB_T, VL_BUF_T>::declCode(uint32_t code, const std::stri
         break;
     }
 
+    if (enabled) {
+        // Remember the scope, for enableScope(). Signals of a scope are
+        // declared together, so only need to compare against the last.
+        const size_t pos = declName.rfind(' ');
+        const std::string scope = declName.substr(0, pos == std::string::npos ? 0 : pos);
+        if (m_scopeNames.empty() || m_scopeNames.back() != scope) m_scopeNames.push_back(scope);
+        if (m_codeScopes.size() <= code) m_codeScopes.resize((code + 1024) * 2, ~0U);
+        uint32_t& codeScope = m_codeScopes[code];
+        if (codeScope != ~0U && m_scopeNames[codeScope] != scope) {
+            // Aliased in another scope; use the common parent, so the code is
+            // only disabled when all its aliases are
+            const std::string& prev = m_scopeNames[codeScope];
+            size_t common = 0;
+            for (size_t i = 0;; ++i) {
+                const bool prevEnd = i == prev.size() || prev[i] == ' ';
+                const bool scopeEnd = i == scope.size() || scope[i] == ' ';
+                if (prevEnd && scopeEnd) common = i;
+                if (i == prev.size() || i == scope.size() || prev[i] != scope[i]) break;
+            }
+            m_scopeNames.push_back(scope.substr(0, common));
+        }
+        codeScope = m_scopeNames.size() - 1;
+    }
+
     int codesNeeded = VL_WORDS_I(bits);
     m_nextCode = std::max(m_nextCode, code + codesNeeded);
     ++m_numSignals;
@@ -441,6 +502,31 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpvars(int level, const std::string&
     }
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::enableScope(const std::string& hier,
+                                                     bool enable) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    // Convert Verilog . separators to trace space separators
+    std::string hierSpaced = hier;
+    for (auto& i : hierSpaced) {
+        if (i == '.') i = ' ';
+    }
+    // Only the latest entry for each scope matters, avoid growing when toggled often
+    m_enableScopes.erase(std::remove_if(m_enableScopes.begin(), m_enableScopes.end(),
+                                        [&](const std::pair<std::string, bool>& item) {
+                                            return item.first == hierSpaced;
+                                        }),
+                         m_enableScopes.end());
+    m_enableScopes.emplace_back(hierSpaced, enable);
+    // If not yet opened, will be applied by traceInit
+    if (!m_sigs_oldvalp) return;
+    // Offload worker might be reading the enables
+    if (offload()) flushBase();
+    applyEnableScope(hierSpaced, enable);
+    // Signals resumed have not been compared while paused, so dump them all
+    if (enable) m_fullDump = true;
+}
+
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::parallelWorkerTask(void* datap, bool) {
     ParallelWorkerData* const wdp = reinterpret_cast<ParallelWorkerData*>(datap);
@@ -468,9 +554,10 @@ VL_ATTR_NOINLINE void VerilatedTrace<VL_SUB_T, VL_BUF_T>::ParallelWorkerData::wa
 
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<CallbackRecord>& cbVec) {
-    if (parallel()) {
-        // If tracing in parallel, dispatch to the thread pool
-        VlThreadPool* threadPoolp = static_cast<VlThreadPool*>(m_contextp->threadPoolp());
+    // If tracing in parallel, dispatch to the thread pool
+    VlThreadPool* const threadPoolp
+        = parallel() ? static_cast<VlThreadPool*>(m_contextp->threadPoolp()) : nullptr;
+    if (threadPoolp) {
         // List of work items for thread (std::list, as ParallelWorkerData is not movable)
         std::list<ParallelWorkerData> workerData;
         // We use the whole pool + the main thread
@@ -487,7 +574,7 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<Callback
             ParallelWorkerData* const itemp = &workerData.back();
             // Enqueue task to thread pool, or main thread
             if (unsigned rem = cbr.m_fidx % threads) {
-                threadPoolp->workerp(rem - 1)->addTask(parallelWorkerTask, itemp);
+                threadPoolp->workerp(rem - 1)->addStealableTask(parallelWorkerTask, itemp, false);
             } else {
                 mainThreadWorkerData.push_back(itemp);
             }
@@ -541,6 +628,15 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
     m_timeLastDump = timeui;
     m_didSomeDump = true;
 
+    // Sampled dumps: skip the whole call, including the cleanup callbacks, so
+    // activity flags stay set and the next dump still compares all signals
+    // that changed meanwhile. A pending full dump is never skipped.
+    if (VL_UNLIKELY(m_dumpDecimate > 1 || m_dumpTriggerCb) && VL_LIKELY(!m_fullDump)) {
+        if (m_dumpTriggerCb && !m_dumpTriggerCb(m_dumpTriggerUserp)) return;
+        if (++m_dumpSkipped < m_dumpDecimate) return;
+        m_dumpSkipped = 0;
+    }
+
     Verilated::quiesce();
 
     // Call hook for format-specific behaviour
@@ -817,6 +913,20 @@ VerilatedTraceBuffer<VL_BUF_T>::VerilatedTraceBuffer(Trace& owner)
     , m_sigs_oldvalp{owner.m_sigs_oldvalp}
     , m_sigs_enabledp{owner.m_sigs_enabledp} {}
 
+template <>
+bool VerilatedTraceBuffer<VL_BUF_T>::anyEnabledSlow(uint32_t code, uint32_t nCodes) const {
+    if (!nCodes) return false;
+    const uint32_t lastCode = code + nCodes - 1;
+    const uint32_t lastWord = VL_BITWORD_I(lastCode);
+    for (uint32_t word = VL_BITWORD_I(code); word <= lastWord; ++word) {
+        EData bits = m_sigs_enabledp[word];
+        if (word == VL_BITWORD_I(code)) bits &= ~0U << VL_BITBIT_I(code);
+        if (word == lastWord) bits &= ~0U >> (VL_EDATASIZE - 1 - VL_BITBIT_I(lastCode));
+        if (bits) return true;
+    }
+    return false;
+}
+
 // These functions must write the new value back into the old value store,
 // and subsequently call the format-specific emit* implementations. Note
 // that this file must be included in the format-specific implementation, so
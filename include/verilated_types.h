@@ -31,12 +31,16 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <cstring>
 #include <deque>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 //=========================================================================
 // Debug functions
@@ -168,24 +172,50 @@ template <std::size_t N_Size>  //
 class VlTriggerVec final {
     // TODO: static assert N_Size > 0, and don't generate when empty
 
+    // CONSTANTS
+    static constexpr size_t NWORDS = roundUpToMultipleOf<64>(N_Size) / 64;
+    // Large vectors, which are typically mostly zero, keep a summary bitmap with
+    // one bit per word of flags, set iff that word is non-zero, so that
+    // any(), clear(), thisOr() and andNot() only visit the non-zero words
+    static constexpr bool HAS_SUMMARY = NWORDS > 4;
+    static constexpr size_t NSUMMARY = HAS_SUMMARY ? roundUpToMultipleOf<64>(NWORDS) / 64 : 0;
+
     // MEMBERS
-    alignas(16) std::array<uint64_t, roundUpToMultipleOf<64>(N_Size) / 64> m_flags;  // The flags
+    alignas(16) std::array<uint64_t, NWORDS> m_flags;  // The flags
+    std::array<uint64_t, NSUMMARY> m_summary;  // Non-zero words of m_flags
 
 public:
     // CONSTRUCTOR
-    VlTriggerVec() { clear(); }
+    VlTriggerVec() {
+        m_flags.fill(0);
+        m_summary.fill(0);
+    }
     ~VlTriggerVec() = default;
 
     // METHODS
 
     // Set all elements to false
-    void clear() { m_flags.fill(0); }
+    void clear() {
+        if (!HAS_SUMMARY) {
+            m_flags.fill(0);
+            return;
+        }
+        for (size_t s = 0; s < NSUMMARY; ++s) {
+            for (uint64_t bits = m_summary[s]; bits; bits &= bits - 1) {
+                m_flags[s * 64 + lowestSetBit(bits)] = 0;
+            }
+            m_summary[s] = 0;
+        }
+    }
 
     // Word at given 'wordIndex'
     uint64_t word(size_t wordIndex) const { return m_flags[wordIndex]; }
 
     // Set specified word to given value
-    void setWord(size_t wordIndex, uint64_t value) { m_flags[wordIndex] = value; }
+    void setWord(size_t wordIndex, uint64_t value) {
+        m_flags[wordIndex] = value;
+        updateSummary(wordIndex);
+    }
 
     // Set specified bit to given value
     void setBit(size_t index, bool value) {
@@ -193,10 +223,16 @@ public:
         const size_t bitIndex = index % 64;
         w &= ~(1ULL << bitIndex);
         w |= (static_cast<uint64_t>(value) << bitIndex);
+        updateSummary(index / 64);
     }
 
     // Return true iff at least one element is set
     bool any() const {
+        if (HAS_SUMMARY) {
+            for (size_t s = 0; s < NSUMMARY; ++s)
+                if (m_summary[s]) return true;
+            return false;
+        }
         for (size_t i = 0; i < m_flags.size(); ++i)
             if (m_flags[i]) return true;
         return false;
@@ -204,12 +240,64 @@ public:
 
     // Set all elements true in 'this' that are set in 'other'
     void thisOr(const VlTriggerVec<N_Size>& other) {
-        for (size_t i = 0; i < m_flags.size(); ++i) m_flags[i] |= other.m_flags[i];
+        if (!HAS_SUMMARY) {
+            for (size_t i = 0; i < m_flags.size(); ++i) m_flags[i] |= other.m_flags[i];
+            return;
+        }
+        for (size_t s = 0; s < NSUMMARY; ++s) {
+            for (uint64_t bits = other.m_summary[s]; bits; bits &= bits - 1) {
+                const size_t i = s * 64 + lowestSetBit(bits);
+                m_flags[i] |= other.m_flags[i];
+            }
+            m_summary[s] |= other.m_summary[s];
+        }
     }
 
     // Set elements of 'this' to 'a & !b' element-wise
     void andNot(const VlTriggerVec<N_Size>& a, const VlTriggerVec<N_Size>& b) {
-        for (size_t i = 0; i < m_flags.size(); ++i) m_flags[i] = a.m_flags[i] & ~b.m_flags[i];
+        if (!HAS_SUMMARY) {
+            for (size_t i = 0; i < m_flags.size(); ++i) m_flags[i] = a.m_flags[i] & ~b.m_flags[i];
+            return;
+        }
+        if (VL_UNLIKELY(this == &b)) {  // Aliased, visit all words
+            for (size_t i = 0; i < m_flags.size(); ++i) {
+                m_flags[i] = a.m_flags[i] & ~b.m_flags[i];
+                updateSummary(i);
+            }
+            return;
+        }
+        if (this != &a) clear();
+        for (size_t s = 0; s < NSUMMARY; ++s) {
+            uint64_t summary = 0;
+            for (uint64_t bits = a.m_summary[s]; bits; bits &= bits - 1) {
+                const size_t bit = lowestSetBit(bits);
+                const size_t i = s * 64 + bit;
+                m_flags[i] = a.m_flags[i] & ~b.m_flags[i];
+                summary |= static_cast<uint64_t>(m_flags[i] != 0) << bit;
+            }
+            m_summary[s] = summary;
+        }
+    }
+
+private:
+    void updateSummary(size_t wordIndex) {
+        if (!HAS_SUMMARY) return;
+        uint64_t& s = m_summary[wordIndex / 64];
+        const size_t bitIndex = wordIndex % 64;
+        s &= ~(1ULL << bitIndex);
+        s |= static_cast<uint64_t>(m_flags[wordIndex] != 0) << bitIndex;
+    }
+    static size_t lowestSetBit(uint64_t bits) {
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS)
+        return __builtin_ctzll(bits);
+#else
+        size_t n = 0;
+        while (!(bits & 1)) {
+            bits >>= 1;
+            ++n;
+        }
+        return n;
+#endif
     }
 };
 
@@ -296,8 +384,12 @@ public:
     std::string get_randstate() const VL_MT_UNSAFE;
     void set_randstate(const std::string& state) VL_MT_UNSAFE;
     uint64_t rand64() VL_MT_UNSAFE;
+    // Fill words with the same values as rand64() truncated per word, but with
+    // the state kept in registers for the whole fill
+    void fill(EData* wordsp, int words) VL_MT_UNSAFE;
     // Threadsafe, but requires use on vl_thread_rng
     static uint64_t vl_thread_rng_rand64() VL_MT_SAFE;
+    static void vl_thread_rng_fill(EData* wordsp, int words) VL_MT_SAFE;
     static VlRNG& vl_thread_rng() VL_MT_SAFE;
 };
 
@@ -369,6 +461,29 @@ inline IData VL_RANDOM_RNG_I(VlRNG& rngr) VL_MT_UNSAFE { return rngr.rand64(); }
 inline QData VL_RANDOM_RNG_Q(VlRNG& rngr) VL_MT_UNSAFE { return rngr.rand64(); }
 extern WDataOutP VL_RANDOM_RNG_W(VlRNG& rngr, int obits, WDataOutP outwp) VL_MT_UNSAFE;
 
+//===================================================================
+// Format string passed to $display-like functions
+// Constructed from the string literal Verilator emits, so no std::string is
+// built on each call; the length comes from the array so embedded NULs work.
+
+class VlFormat final {
+    const char* const m_datap;  // Format characters
+    const size_t m_size;  // Number of characters
+
+public:
+    template <size_t N_Size>
+    // cppcheck-suppress noExplicitConstructor
+    VlFormat(const char (&lit)[N_Size])
+        : m_datap{lit}
+        , m_size{N_Size - 1} {}
+    // cppcheck-suppress noExplicitConstructor
+    VlFormat(const std::string& str)
+        : m_datap{str.data()}
+        , m_size{str.size()} {}
+    const char* begin() const { return m_datap; }
+    const char* end() const { return m_datap + m_size; }
+};
+
 //===================================================================
 // Readmem/Writemem operation classes
 
@@ -381,6 +496,23 @@ class VlReadMem final {
     QData m_addr = 0;  // Next address to read
     int m_linenum = 0;  // Line number last read from file
     bool m_anyAddr = false;  // Had address directive in the file
+    std::vector<char> m_buf;  // Buffer of file contents, read in blocks
+    size_t m_bufPos = 0;  // Next character to return from m_buf
+    size_t m_bufEnd = 0;  // Number of valid characters in m_buf
+
+    // Next character of the file, or EOF. Reading through our own buffer avoids
+    // the per character locking of fgetc, which dominates loading large files.
+    int getChar() {
+        if (VL_UNLIKELY(m_bufPos == m_bufEnd)) {
+            m_bufEnd = std::fread(m_buf.data(), 1, m_buf.size(), m_fp);
+            m_bufPos = 0;
+            if (!m_bufEnd) return EOF;
+        }
+        return static_cast<unsigned char>(m_buf[m_bufPos++]);
+    }
+    // Return the last character from getChar() again on the next call
+    void ungetChar() { --m_bufPos; }
+
 public:
     VlReadMem(bool hex, int bits, const std::string& filename, QData start, QData end);
     ~VlReadMem();
@@ -474,6 +606,187 @@ std::string VL_TO_STRING(const VlWide<N_Words>& obj) {
     return VL_TO_STRING_W(N_Words, obj.data());
 }
 
+//===================================================================
+// Fixed capacity ring buffer, used as the storage of small bounded queues
+// Elements are held inline in the object, so pushing and popping at
+// either end never allocates.  Provides the subset of std::deque that
+// VlQueue uses.
+
+template <typename T_Value, size_t N_Capacity>
+class VlQueueRing final {
+    static_assert(N_Capacity > 0, "VlQueueRing must have a non-zero capacity");
+
+    // MEMBERS
+    std::array<T_Value, N_Capacity> m_data{};  // Element storage
+    size_t m_head = 0;  // Index in m_data of element 0
+    size_t m_size = 0;  // Number of elements
+
+    static size_t wrap(size_t index) {
+        return index >= N_Capacity ? index - N_Capacity : index;
+    }
+    T_Value& slot(size_t index) { return m_data[wrap(m_head + index)]; }
+    const T_Value& slot(size_t index) const { return m_data[wrap(m_head + index)]; }
+
+    // Random access iterator, addressing by index so std::sort et al. work
+    template <typename T_Ring, typename T_Ref>
+    class Iterator final {
+        friend class VlQueueRing;
+        template <typename, typename>
+        friend class Iterator;
+        T_Ring* m_ringp = nullptr;  // Ring iterated over
+        ptrdiff_t m_index = 0;  // Index of element
+        Iterator(T_Ring* ringp, ptrdiff_t index)
+            : m_ringp{ringp}
+            , m_index{index} {}
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T_Value;
+        using difference_type = ptrdiff_t;
+        using pointer = typename std::remove_reference<T_Ref>::type*;
+        using reference = T_Ref;
+
+        Iterator() = default;
+        // Allow conversion from iterator to const_iterator
+        template <typename T_OtherRing, typename T_OtherRef>
+        Iterator(const Iterator<T_OtherRing, T_OtherRef>& other)
+            : m_ringp{other.m_ringp}
+            , m_index{other.m_index} {}
+
+        reference operator*() const { return m_ringp->slot(m_index); }
+        pointer operator->() const { return &m_ringp->slot(m_index); }
+        reference operator[](difference_type n) const { return m_ringp->slot(m_index + n); }
+        Iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator tmp = *this;
+            ++m_index;
+            return tmp;
+        }
+        Iterator& operator--() {
+            --m_index;
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator tmp = *this;
+            --m_index;
+            return tmp;
+        }
+        Iterator& operator+=(difference_type n) {
+            m_index += n;
+            return *this;
+        }
+        Iterator& operator-=(difference_type n) {
+            m_index -= n;
+            return *this;
+        }
+        Iterator operator+(difference_type n) const { return Iterator{m_ringp, m_index + n}; }
+        Iterator operator-(difference_type n) const { return Iterator{m_ringp, m_index - n}; }
+        friend Iterator operator+(difference_type n, const Iterator& it) { return it + n; }
+        difference_type operator-(const Iterator& rhs) const { return m_index - rhs.m_index; }
+        bool operator==(const Iterator& rhs) const { return m_index == rhs.m_index; }
+        bool operator!=(const Iterator& rhs) const { return m_index != rhs.m_index; }
+        bool operator<(const Iterator& rhs) const { return m_index < rhs.m_index; }
+        bool operator>(const Iterator& rhs) const { return m_index > rhs.m_index; }
+        bool operator<=(const Iterator& rhs) const { return m_index <= rhs.m_index; }
+        bool operator>=(const Iterator& rhs) const { return m_index >= rhs.m_index; }
+    };
+
+public:
+    // TYPES
+    using value_type = T_Value;
+    using size_type = size_t;
+    using iterator = Iterator<VlQueueRing, T_Value&>;
+    using const_iterator = Iterator<const VlQueueRing, const T_Value&>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // CONSTRUCTORS
+    VlQueueRing() = default;
+
+    // METHODS
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    static constexpr size_t max_size() { return N_Capacity; }
+    void clear() {
+        // Release held values, e.g. class references, eagerly as std::deque does
+        for (size_t i = 0; i < m_size; ++i) slot(i) = T_Value{};
+        m_head = 0;
+        m_size = 0;
+    }
+    // Resize, silently limited to the capacity
+    void resize(size_t size, const T_Value& value) {
+        if (size > N_Capacity) size = N_Capacity;
+        while (m_size > size) pop_back();
+        while (m_size < size) push_back(value);
+    }
+    template <typename T_Iterator>
+    void assign(T_Iterator first, T_Iterator last) {
+        clear();
+        for (; first != last && m_size < N_Capacity; ++first) slot(m_size++) = *first;
+    }
+
+    T_Value& operator[](size_t index) { return slot(index); }
+    const T_Value& operator[](size_t index) const { return slot(index); }
+    T_Value& front() { return slot(0); }
+    const T_Value& front() const { return slot(0); }
+    T_Value& back() { return slot(m_size - 1); }
+    const T_Value& back() const { return slot(m_size - 1); }
+
+    // Caller (VlQueue) ensures pushes are only done when not full
+    void push_front(const T_Value& value) {
+        m_head = m_head == 0 ? N_Capacity - 1 : m_head - 1;
+        m_data[m_head] = value;
+        ++m_size;
+    }
+    void push_back(const T_Value& value) {
+        slot(m_size) = value;
+        ++m_size;
+    }
+    void pop_front() {
+        m_data[m_head] = T_Value{};
+        m_head = wrap(m_head + 1);
+        --m_size;
+    }
+    void pop_back() {
+        --m_size;
+        slot(m_size) = T_Value{};
+    }
+    // Caller (VlQueue) ensures inserts are only done when not full
+    iterator insert(const_iterator pos, const T_Value& value) {
+        const size_t index = pos.m_index;
+        const T_Value copy = value;  // Value may be an element that moves
+        ++m_size;
+        for (size_t i = m_size - 1; i > index; --i) slot(i) = slot(i - 1);
+        slot(index) = copy;
+        return iterator{this, static_cast<ptrdiff_t>(index)};
+    }
+    iterator erase(const_iterator pos) {
+        const size_t index = pos.m_index;
+        for (size_t i = index; i + 1 < m_size; ++i) slot(i) = slot(i + 1);
+        pop_back();
+        return iterator{this, static_cast<ptrdiff_t>(index)};
+    }
+
+    iterator begin() { return iterator{this, 0}; }
+    iterator end() { return iterator{this, static_cast<ptrdiff_t>(m_size)}; }
+    const_iterator begin() const { return const_iterator{this, 0}; }
+    const_iterator end() const { return const_iterator{this, static_cast<ptrdiff_t>(m_size)}; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator{end()}; }
+    reverse_iterator rend() { return reverse_iterator{begin()}; }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+    const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+
+    bool operator==(const VlQueueRing& rhs) const {
+        return m_size == rhs.m_size && std::equal(begin(), end(), rhs.begin());
+    }
+    bool operator!=(const VlQueueRing& rhs) const { return !(*this == rhs); }
+};
+
 //===================================================================
 // Verilog queue and dynamic array container
 // There are no multithreaded locks on this; the base variable must
@@ -481,11 +794,19 @@ std::string VL_TO_STRING(const VlWide<N_Words>& obj) {
 //
 // Bound here is the maximum size() allowed, e.g. 1 + SystemVerilog bound
 // For dynamic arrays it is always zero
+//
+// Bounded queues whose elements fit in VL_QUEUE_RING_MAX_BYTES are stored
+// in an inline VlQueueRing; other queues use a std::deque
+#ifndef VL_QUEUE_RING_MAX_BYTES
+#define VL_QUEUE_RING_MAX_BYTES 1024
+#endif
 template <typename T_Value, size_t N_MaxSize = 0>
 class VlQueue final {
 private:
     // TYPES
-    using Deque = std::deque<T_Value>;
+    using Deque = typename std::conditional<
+        (N_MaxSize != 0 && N_MaxSize * sizeof(T_Value) <= VL_QUEUE_RING_MAX_BYTES),
+        VlQueueRing<T_Value, N_MaxSize>, std::deque<T_Value>>::type;
 
 public:
     using const_iterator = typename Deque::const_iterator;
@@ -519,8 +840,12 @@ public:
     // Also must allow conversion from a different N_MaxSize queue
     template <size_t N_RhsMaxSize = 0>
     VlQueue operator=(const VlQueue<T_Value, N_RhsMaxSize>& rhs) {
-        m_deque = rhs.privateDeque();
-        if (VL_UNLIKELY(N_MaxSize && N_MaxSize < m_deque.size())) m_deque.resize(N_MaxSize - 1);
+        const auto& rhsDeque = rhs.privateDeque();
+        if (VL_UNLIKELY(N_MaxSize && N_MaxSize < rhsDeque.size())) {
+            m_deque.assign(rhsDeque.begin(), rhsDeque.begin() + (N_MaxSize - 1));
+        } else {
+            m_deque.assign(rhsDeque.begin(), rhsDeque.end());
+        }
         return *this;
     }
 
@@ -556,6 +881,15 @@ public:
     T_Value& atDefault() { return m_defaultValue; }
     const T_Value& atDefault() const { return m_defaultValue; }
     const Deque& privateDeque() const { return m_deque; }
+    // Copy elements to contiguous storage, for a DPI open array
+    void copyToVector(std::vector<T_Value>& to) const {
+        to.assign(m_deque.begin(), m_deque.end());
+    }
+    // Copy elements back from contiguous storage; DPI cannot resize, so sizes match
+    void copyFromVector(const std::vector<T_Value>& from) {
+        std::copy(from.begin(), from.begin() + std::min(from.size(), m_deque.size()),
+                  m_deque.begin());
+    }
 
     // Size. Verilog: function int size(), or int num()
     int size() const { return m_deque.size(); }
@@ -584,8 +918,13 @@ public:
 
     // function void q.push_front(value)
     void push_front(const T_Value& value) {
-        m_deque.push_front(value);
-        if (VL_UNLIKELY(N_MaxSize != 0 && m_deque.size() > N_MaxSize)) m_deque.pop_back();
+        if (VL_UNLIKELY(N_MaxSize != 0 && m_deque.size() >= N_MaxSize)) {
+            const T_Value copy = value;  // Value may be the element dropped
+            m_deque.pop_back();
+            m_deque.push_front(copy);
+        } else {
+            m_deque.push_front(value);
+        }
     }
     // function void q.push_back(value)
     void push_back(const T_Value& value) {
@@ -647,6 +986,13 @@ public:
     // function void q.insert(index, value);
     void insert(int32_t index, const T_Value& value) {
         if (VL_UNLIKELY(index < 0 || index > m_deque.size())) return;
+        if (VL_UNLIKELY(N_MaxSize != 0 && m_deque.size() >= N_MaxSize)) {
+            if (index == m_deque.size()) return;  // As push_back
+            const T_Value copy = value;  // Value may be the element dropped
+            m_deque.pop_back();
+            m_deque.insert(m_deque.begin() + index, copy);
+            return;
+        }
         m_deque.insert(m_deque.begin() + index, value);
     }
 
@@ -1268,6 +1614,151 @@ std::string VL_TO_STRING(const VlAssocArray<T_Key, T_Value>& obj) {
 template <typename T_Key, typename T_Value>
 struct VlContainsCustomStruct<VlAssocArray<T_Key, T_Value>> : VlContainsCustomStruct<T_Value> {};
 
+//===================================================================
+// Verilog associative array container, for arrays whose element order is
+// never observed, so may be hashed.  Verilator only uses this for arrays
+// with integral or string keys that are never iterated, except by the
+// order independent methods here.
+// There are no multithreaded locks on this; the base variable must
+// be protected by other means
+//
+template <typename T_Key, typename T_Value>
+class VlUnorderedAssocArray final {
+private:
+    // TYPES
+    using Map = std::unordered_map<T_Key, T_Value>;
+
+public:
+    using const_iterator = typename Map::const_iterator;
+
+private:
+    // MEMBERS
+    Map m_map;  // State of the assoc array
+    T_Value m_defaultValue;  // Default value
+
+    // METHODS
+    std::vector<const typename Map::value_type*> sorted() const {
+        std::vector<const typename Map::value_type*> out;
+        out.reserve(m_map.size());
+        for (const auto& i : m_map) out.push_back(&i);
+        std::sort(out.begin(), out.end(),
+                  [](const typename Map::value_type* ap, const typename Map::value_type* bp) {
+                      return ap->first < bp->first;
+                  });
+        return out;
+    }
+
+public:
+    // CONSTRUCTORS
+    // m_defaultValue isn't defaulted. Caller's constructor must do it.
+    VlUnorderedAssocArray() = default;
+    ~VlUnorderedAssocArray() = default;
+    VlUnorderedAssocArray(const VlUnorderedAssocArray&) = default;
+    VlUnorderedAssocArray(VlUnorderedAssocArray&&) = default;
+    VlUnorderedAssocArray& operator=(const VlUnorderedAssocArray&) = default;
+    VlUnorderedAssocArray& operator=(VlUnorderedAssocArray&&) = default;
+    bool operator==(const VlUnorderedAssocArray& rhs) const { return m_map == rhs.m_map; }
+    bool operator!=(const VlUnorderedAssocArray& rhs) const { return m_map != rhs.m_map; }
+    bool operator<(const VlUnorderedAssocArray& rhs) const {
+        // Same as VlAssocArray, so slow
+        const auto lhsSorted = sorted();
+        const auto rhsSorted = rhs.sorted();
+        return std::lexicographical_compare(
+            lhsSorted.begin(), lhsSorted.end(), rhsSorted.begin(), rhsSorted.end(),
+            [](const typename Map::value_type* ap, const typename Map::value_type* bp) {
+                return *ap < *bp;
+            });
+    }
+    // METHODS
+    T_Value& atDefault() { return m_defaultValue; }
+    const T_Value& atDefault() const { return m_defaultValue; }
+
+    // Size of array. Verilog: function int size(), or int num()
+    int size() const { return m_map.size(); }
+    bool empty() const { return m_map.empty(); }
+    // Clear array. Verilog: function void delete([input index])
+    void clear() { m_map.clear(); }
+    void erase(const T_Key& index) { m_map.erase(index); }
+    // Return 0/1 if element exists. Verilog: function int exists(input index)
+    int exists(const T_Key& index) const { return m_map.find(index) != m_map.end(); }
+    // Setting. Verilog: assoc[index] = v
+    T_Value& at(const T_Key& index) {
+        const auto it = m_map.find(index);
+        if (it == m_map.end()) return m_map.emplace(index, m_defaultValue).first->second;
+        return it->second;
+    }
+    // Accessing. Verilog: v = assoc[index]
+    const T_Value& at(const T_Key& index) const {
+        const auto it = m_map.find(index);
+        if (it == m_map.end()) return m_defaultValue;
+        return it->second;
+    }
+    // Setting as a chained operation
+    VlUnorderedAssocArray& set(const T_Key& index, const T_Value& value) {
+        at(index) = value;
+        return *this;
+    }
+    VlUnorderedAssocArray& setDefault(const T_Value& value) {
+        atDefault() = value;
+        return *this;
+    }
+
+    // For save/restore
+    const_iterator begin() const { return m_map.begin(); }
+    const_iterator end() const { return m_map.end(); }
+
+    // Reduction operators
+    T_Value r_sum() const {
+        T_Value out(0);  // Type must have assignment operator
+        for (const auto& i : m_map) out += i.second;
+        return out;
+    }
+    T_Value r_product() const {
+        if (m_map.empty()) return T_Value(0);  // The big three do it this way
+        T_Value out = T_Value(1);
+        for (const auto& i : m_map) out *= i.second;
+        return out;
+    }
+    T_Value r_and() const {
+        if (m_map.empty()) return T_Value(0);  // The big three do it this way
+        T_Value out = ~T_Value(0);
+        for (const auto& i : m_map) out &= i.second;
+        return out;
+    }
+    T_Value r_or() const {
+        T_Value out = T_Value(0);
+        for (const auto& i : m_map) out |= i.second;
+        return out;
+    }
+    T_Value r_xor() const {
+        T_Value out = T_Value(0);
+        for (const auto& i : m_map) out ^= i.second;
+        return out;
+    }
+
+    // Dumping. Verilog: str = $sformatf("%p", assoc)
+    std::string to_string() const {
+        if (m_map.empty()) return "'{}";  // No trailing space
+        std::string out = "'{";
+        std::string comma;
+        for (const auto* const ip : sorted()) {  // In key order, as for VlAssocArray
+            out += comma + VL_TO_STRING(ip->first) + ":" + VL_TO_STRING(ip->second);
+            comma = ", ";
+        }
+        // Default not printed - maybe random init data
+        return out + "} ";
+    }
+};
+
+template <typename T_Key, typename T_Value>
+std::string VL_TO_STRING(const VlUnorderedAssocArray<T_Key, T_Value>& obj) {
+    return obj.to_string();
+}
+
+template <typename T_Key, typename T_Value>
+struct VlContainsCustomStruct<VlUnorderedAssocArray<T_Key, T_Value>>
+    : VlContainsCustomStruct<T_Value> {};
+
 template <typename T_Key, typename T_Value>
 void VL_READMEM_N(bool hex, int bits, const std::string& filename,
                   VlAssocArray<T_Key, T_Value>& obj, QData start, QData end) VL_MT_SAFE {
@@ -1606,6 +2097,149 @@ std::string VL_TO_STRING(const VlUnpacked<T_Value, N_Depth>& obj) {
 template <typename T_Value, std::size_t N_Depth>
 struct VlContainsCustomStruct<VlUnpacked<T_Value, N_Depth>> : VlContainsCustomStruct<T_Value> {};
 
+//===================================================================
+/// Verilog unpacked array container with sparse storage
+/// Used instead of VlUnpacked for very large arrays of integral elements
+/// (see --sparse-array-depth), where only a small part of the array is
+/// expected to be used.  Storage is allocated in pages of about 4 KB on
+/// first access; elements in pages never accessed read as atDefault().
+
+template <typename T_Value, std::size_t N_Depth>
+class VlSparseUnpacked final {
+    // TYPES
+    using Page = std::vector<T_Value>;
+
+public:
+    // Number of elements in each page
+    static constexpr std::size_t PAGE_ELEMENTS
+        = sizeof(T_Value) >= 4096 ? 1 : 4096 / sizeof(T_Value);
+
+private:
+    // MEMBERS
+    std::unordered_map<std::size_t, Page> m_pages;  // Allocated pages, by page number
+    T_Value m_defaultValue{};  // Value of elements in pages not allocated
+    std::size_t m_lastPageNum = 0;  // Page number of m_lastPagep
+    T_Value* m_lastPagep = nullptr;  // Last accessed page, as accesses are often local
+
+    // METHODS
+    T_Value* pagep(std::size_t pageNum) {
+        if (VL_LIKELY(m_lastPagep && pageNum == m_lastPageNum)) return m_lastPagep;
+        auto it = m_pages.find(pageNum);
+        if (it == m_pages.end()) {
+            it = m_pages.emplace(pageNum, Page(PAGE_ELEMENTS, m_defaultValue)).first;
+        }
+        m_lastPageNum = pageNum;
+        m_lastPagep = it->second.data();
+        return m_lastPagep;
+    }
+    const T_Value& constAt(std::size_t index) const {
+        const auto it = m_pages.find(index / PAGE_ELEMENTS);
+        return it == m_pages.end() ? m_defaultValue : it->second[index % PAGE_ELEMENTS];
+    }
+
+public:
+    // CONSTRUCTORS
+    VlSparseUnpacked() = default;
+    ~VlSparseUnpacked() = default;
+    VlSparseUnpacked(const VlSparseUnpacked& that)
+        : m_pages{that.m_pages}
+        , m_defaultValue{that.m_defaultValue} {}
+
+    // OPERATOR METHODS
+    VlSparseUnpacked& operator=(const VlSparseUnpacked& that) {
+        if (this != &that) {
+            m_pages = that.m_pages;
+            m_defaultValue = that.m_defaultValue;
+            m_lastPagep = nullptr;
+        }
+        return *this;
+    }
+
+    // METHODS
+    constexpr std::size_t size() const { return N_Depth; }
+    // Value of elements never accessed
+    T_Value& atDefault() { return m_defaultValue; }
+    const T_Value& atDefault() const { return m_defaultValue; }
+    // Release all pages, making all elements read as atDefault()
+    void clear() {
+        m_pages.clear();
+        m_lastPagep = nullptr;
+    }
+    void fill(const T_Value& value) {
+        clear();
+        m_defaultValue = value;
+    }
+    // Number of pages allocated
+    std::size_t pages() const { return m_pages.size(); }
+    // Page numbers allocated, in ascending order
+    std::vector<std::size_t> pageNums() const {
+        std::vector<std::size_t> result;
+        result.reserve(m_pages.size());
+        for (const auto& it : m_pages) result.push_back(it.first);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+    // Elements of an allocated page
+    const T_Value* pageData(std::size_t pageNum) const { return m_pages.at(pageNum).data(); }
+    T_Value* pageData(std::size_t pageNum) { return pagep(pageNum); }
+
+    // Accessing an element allocates its page, unless through a const reference
+    T_Value& operator[](std::size_t index) {
+        return pagep(index / PAGE_ELEMENTS)[index % PAGE_ELEMENTS];
+    }
+    const T_Value& operator[](std::size_t index) const { return constAt(index); }
+
+    // *this != that, for change detection, as for VlUnpacked
+    bool neq(const VlSparseUnpacked& that) const {
+        std::size_t unionPages = m_pages.size();
+        for (const auto& it : m_pages) {
+            const std::size_t base = it.first * PAGE_ELEMENTS;
+            for (std::size_t i = 0; i < PAGE_ELEMENTS; ++i) {
+                if (it.second[i] != that.constAt(base + i)) return true;
+            }
+        }
+        for (const auto& it : that.m_pages) {
+            if (m_pages.count(it.first)) continue;
+            ++unionPages;
+            const std::size_t base = it.first * PAGE_ELEMENTS;
+            for (std::size_t i = 0; i < PAGE_ELEMENTS; ++i) {
+                if (it.second[i] != m_defaultValue) return true;
+            }
+        }
+        // Elements in no page of either side read as the respective defaults
+        return unionPages * PAGE_ELEMENTS < N_Depth && m_defaultValue != that.m_defaultValue;
+    }
+    void assign(const VlSparseUnpacked& that) { *this = that; }
+    bool operator==(const VlSparseUnpacked& that) const { return !neq(that); }
+    bool operator!=(const VlSparseUnpacked& that) const { return neq(that); }
+
+    // Dumping. Verilog: str = $sformatf("%p", array)
+    // As the array is huge, only elements in allocated pages are printed, with their index
+    std::string to_string() const {
+        std::string out = "'{";
+        std::string comma;
+        for (const std::size_t pageNum : pageNums()) {
+            const T_Value* const datap = pageData(pageNum);
+            for (std::size_t i = 0; i < PAGE_ELEMENTS; ++i) {
+                const std::size_t index = pageNum * PAGE_ELEMENTS + i;
+                if (index >= N_Depth) break;
+                out += comma + VL_TO_STRING(index) + ":" + VL_TO_STRING(datap[i]);
+                comma = ", ";
+            }
+        }
+        return out + "} ";
+    }
+};
+
+template <typename T_Value, std::size_t N_Depth>
+std::string VL_TO_STRING(const VlSparseUnpacked<T_Value, N_Depth>& obj) {
+    return obj.to_string();
+}
+
+template <typename T_Value, std::size_t N_Depth>
+struct VlContainsCustomStruct<VlSparseUnpacked<T_Value, N_Depth>>
+    : VlContainsCustomStruct<T_Value> {};
+
 //===================================================================
 // Helper to apply the given indices to a target expression
 
@@ -1662,13 +2296,35 @@ class VlNBACommitQueue;
 template <typename T_Target, typename T_Element, std::size_t N_Rank>
 class VlNBACommitQueue<T_Target, /* Partial: */ false, T_Element, N_Rank> final {
     // TYPES
-    struct Entry final {
-        T_Element value;
-        size_t indices[N_Rank];
-    };
+    using Indices = std::array<size_t, N_Rank>;
 
     // STATE
-    std::vector<Entry> m_pending;  // Pending updates, in program order
+    // Values and indices are kept apart, so a run of updates to consecutive elements has
+    // its values contiguous. The vectors keep their capacity when cleared on commit, so
+    // after the peak number of updates has been seen, 'enqueue' does not allocate.
+    std::vector<T_Element> m_values;  // Pending update values, in program order
+    std::vector<Indices> m_indices;  // Pending update indices, in program order
+
+    // STATIC METHODS
+
+    // Return if 'next' is the element after 'prev' in the innermost dimension
+    static bool isNext(const Indices& prev, const Indices& next) {
+        for (size_t i = 0; i + 1 < N_Rank; ++i) {
+            if (prev[i] != next[i]) return false;
+        }
+        return next[N_Rank - 1] == prev[N_Rank - 1] + 1;
+    }
+
+    // Copy 'n' values to the consecutive elements starting at 'dst'
+    template <typename T_Dst>
+    static void copyRun(T_Dst& dst, const T_Element* srcp, size_t n, std::true_type) {
+        std::memcpy(&dst, srcp, n * sizeof(T_Element));
+    }
+    template <typename T_Dst>
+    static void copyRun(T_Dst& dst, const T_Element* srcp, size_t n, std::false_type) {
+        T_Dst* const dstp = &dst;
+        for (size_t i = 0; i < n; ++i) dstp[i] = srcp[i];
+    }
 
 public:
     // CONSTRUCTOR
@@ -1678,18 +2334,36 @@ public:
     // METHODS
     template <typename... T_Args>
     void enqueue(const T_Element& value, T_Args... indices) {
-        m_pending.emplace_back(Entry{value, {indices...}});
+        m_values.emplace_back(value);
+        m_indices.emplace_back(Indices{{static_cast<size_t>(indices)...}});
     }
 
     // Note: T_Commit might be different from T_Target. Specifically, when the signal is a
     // top-level IO port, T_Commit will be a native C array, while T_Target, will be a VlUnpacked
     template <typename T_Commit>
     void commit(T_Commit& target) {
-        if (m_pending.empty()) return;
-        for (const Entry& entry : m_pending) {
-            VlApplyIndices<0, N_Rank, T_Commit>::apply(target, entry.indices) = entry.value;
+        const size_t size = m_values.size();
+        if (!size) return;
+        size_t i = 0;
+        while (i < size) {
+            // Apply a run of updates to consecutive elements at once. The elements of a run
+            // are distinct, and runs are applied in program order, so the last NBA still wins.
+            size_t end = i + 1;
+            while (end < size && isNext(m_indices[end - 1], m_indices[end])) ++end;
+            auto& dst = VlApplyIndices<0, N_Rank, T_Commit>::apply(target, m_indices[i].data());
+            if (end - i == 1) {
+                dst = m_values[i];
+            } else {
+                using T_Dst = typename std::decay<decltype(dst)>::type;
+                using Pod = std::integral_constant<bool, std::is_same<T_Dst, T_Element>::value
+                                                             && std::is_trivially_copyable<
+                                                                 T_Element>::value>;
+                copyRun(dst, &m_values[i], end - i, Pod{});
+            }
+            i = end;
         }
-        m_pending.clear();
+        m_values.clear();
+        m_indices.clear();
     }
 };
 
@@ -1708,51 +2382,20 @@ class VlNBACommitQueue<T_Target, /* Partial: */ true, T_Element, N_Rank> final {
 
     // STATIC METHODS
 
-    // Binary & | ~ for elements to use for masking in partial updates. Sorry for the templates.
+    // Set the bits of 'ref' selected by 'mask' to the same bits of 'value', in place
     template <typename T>
-    VL_ATTR_ALWINLINE static typename std::enable_if<!VlIsVlWide<T>::value, T>::type
-    bAnd(const T& a, const T& b) {
-        return a & b;
+    VL_ATTR_ALWINLINE static typename std::enable_if<!VlIsVlWide<T>::value>::type
+    bMerge(T& ref, const T& value, const T& mask) {
+        ref = (value & mask) | (ref & ~mask);
     }
 
     template <typename T>
-    VL_ATTR_ALWINLINE static typename std::enable_if<VlIsVlWide<T>::value, T>::type
-    bAnd(const T& a, const T& b) {
-        T result;
+    VL_ATTR_ALWINLINE static typename std::enable_if<VlIsVlWide<T>::value>::type
+    bMerge(T& ref, const T& value, const T& mask) {
         for (size_t i = 0; i < T::Words; ++i) {
-            result.m_storage[i] = a.m_storage[i] & b.m_storage[i];
+            ref.m_storage[i] = (value.m_storage[i] & mask.m_storage[i])
+                               | (ref.m_storage[i] & ~mask.m_storage[i]);
         }
-        return result;
-    }
-
-    template <typename T>
-    VL_ATTR_ALWINLINE static typename std::enable_if<!VlIsVlWide<T>::value, T>::type
-    bOr(const T& a, const T& b) {
-        return a | b;
-    }
-
-    template <typename T>
-    VL_ATTR_ALWINLINE static typename std::enable_if<VlIsVlWide<T>::value, T>::type  //
-    bOr(const T& a, const T& b) {
-        T result;
-        for (size_t i = 0; i < T::Words; ++i) {
-            result.m_storage[i] = a.m_storage[i] | b.m_storage[i];
-        }
-        return result;
-    }
-
-    template <typename T>
-    VL_ATTR_ALWINLINE static typename std::enable_if<!VlIsVlWide<T>::value, T>::type
-    bNot(const T& a) {
-        return ~a;
-    }
-
-    template <typename T>
-    VL_ATTR_ALWINLINE static typename std::enable_if<VlIsVlWide<T>::value, T>::type
-    bNot(const T& a) {
-        T result;
-        for (size_t i = 0; i < T::Words; ++i) result.m_storage[i] = ~a.m_storage[i];
-        return result;
     }
 
 public:
@@ -1773,9 +2416,7 @@ public:
         if (m_pending.empty()) return;
         for (const Entry& entry : m_pending) {  //
             auto& ref = VlApplyIndices<0, N_Rank, T_Commit>::apply(target, entry.indices);
-            // Maybe inefficient, but it works for now ...
-            const auto oldValue = ref;
-            ref = bOr(bAnd(entry.value, entry.mask), bAnd(oldValue, bNot(entry.mask)));
+            bMerge(ref, entry.value, entry.mask);
         }
         m_pending.clear();
     }
@@ -1827,35 +2468,42 @@ public:
 // Base class for all verilated classes. Includes a reference counter, and a pointer to the deleter
 // object that should destroy it after the counter reaches 0. This allows for easy construction of
 // VlClassRefs from 'this'.
+// T_Counter is std::atomic<size_t> (VlClass) when class objects may be shared between threads,
+// or plain size_t (VlClassLocal) for single threaded models, avoiding a locked instruction on
+// every reference copy.
 
-class VlClass VL_NOT_FINAL : public VlDeletable {
+template <typename T_Counter>
+class VlClassCounted VL_NOT_FINAL : public VlDeletable {
     // TYPES
     template <typename T_Class>
     friend class VlClassRef;  // Needed for access to the ref counter and deleter
 
     // MEMBERS
-    std::atomic<size_t> m_counter{1};  // Reference count for this object
+    T_Counter m_counter{1};  // Reference count for this object
     VlDeleter* m_deleterp = nullptr;  // The deleter that will delete this object
 
     // METHODS
-    // Atomically increments the reference counter
+    // Increments the reference counter, atomically if T_Counter is atomic
     void refCountInc() VL_MT_SAFE {
         VL_DEBUG_IFDEF(assert(m_counter););  // If zero, we might have already deleted
         ++m_counter;
     }
-    // Atomically decrements the reference counter. Assuming VlClassRef semantics are sound, it
-    // should never get called at m_counter == 0.
+    // Decrements the reference counter, atomically if T_Counter is atomic. Assuming VlClassRef
+    // semantics are sound, it should never get called at m_counter == 0.
     void refCountDec() VL_MT_SAFE {
         if (!--m_counter) m_deleterp->put(this);
     }
 
 public:
     // CONSTRUCTORS
-    VlClass() {}
-    VlClass(const VlClass& copied) {}
-    ~VlClass() override = default;
+    VlClassCounted() {}
+    VlClassCounted(const VlClassCounted& copied) {}
+    ~VlClassCounted() override = default;
 };
 
+using VlClass = VlClassCounted<std::atomic<size_t>>;
+using VlClassLocal = VlClassCounted<size_t>;
+
 //===================================================================
 // Represents the null pointer. Used for:
 // * setting VlClassRef to null instead of via nullptr_t, to prevent the implicit conversion of 0
@@ -1994,6 +2642,37 @@ public:
     };
 };
 
+//===================================================================
+// Storage in a function's frame for class objects Verilator found are only referenced through
+// one local handle (V3Class::frameAll), avoiding the heap and VlDeleter.  The frame holds a
+// reference of its own, so the count never reaches zero while the frame exists.
+
+template <typename T_Class>
+class VlClassFrame final {
+    // MEMBERS
+    alignas(T_Class) char m_storage[sizeof(T_Class)];  // Storage for the object
+    T_Class* m_objp = nullptr;  // Object constructed in m_storage, if any
+
+public:
+    // CONSTRUCTORS
+    VlClassFrame() = default;
+    ~VlClassFrame() {
+        if (m_objp) m_objp->~T_Class();
+    }
+    VL_UNCOPYABLE(VlClassFrame);
+
+    // METHODS
+    // Replace any previous object with a new one, and point the handle at it
+    template <typename... T_Args>
+    void construct(VlClassRef<T_Class>& refr, T_Args&&... args) {
+        refr = VlNull{};
+        if (m_objp) m_objp->~T_Class();
+        // () as in VlClassRef, to avoid narrowing conversion warnings
+        m_objp = new (m_storage) T_Class(std::forward<T_Args>(args)...);
+        refr = VlClassRef<T_Class>{m_objp};
+    }
+};
+
 template <typename T_Lhs, typename T_Out>
 static inline bool VL_CAST_DYNAMIC(VlClassRef<T_Lhs> in, VlClassRef<T_Out>& outr) {
     if (!in) {
@@ -2029,25 +2708,57 @@ class VlSampleQueue final {
     };
 
     // MEMBERS
-    std::deque<VlSample> m_queue;  // Queue of samples with timestamps
+    // Samples are kept in a ring buffer with power of two capacity, ordered by timestamp.
+    // The buffer only grows, so once it has reached the number of samples live within
+    // the skew window, pushing and popping no longer allocate.
+    std::vector<VlSample> m_ring;  // Sample storage
+    size_t m_head = 0;  // Index in m_ring of the oldest sample
+    size_t m_size = 0;  // Number of samples
+
+    VlSample& at(size_t index) { return m_ring[(m_head + index) & (m_ring.size() - 1)]; }
+    void grow() {
+        std::vector<VlSample> ring;
+        ring.reserve(m_ring.empty() ? 4 : m_ring.size() * 2);
+        for (size_t i = 0; i < m_size; ++i) ring.push_back(std::move(at(i)));
+        ring.resize(ring.capacity());
+        m_ring.swap(ring);
+        m_head = 0;
+    }
 
 public:
     // METHODS
     // Push a new sample with the given timestamp to the end of the queue
-    void push(uint64_t time, const T_Sampled& value) { m_queue.push_back({time, value}); }
+    void push(uint64_t time, const T_Sampled& value) {
+        // Only the last sample in a time step can ever be popped, so overwrite earlier ones
+        if (m_size && at(m_size - 1).m_timestamp == time) {
+            at(m_size - 1).m_value = value;
+            return;
+        }
+        if (VL_UNLIKELY(m_size == m_ring.size())) grow();
+        VlSample& sample = at(m_size++);
+        sample.m_timestamp = time;
+        sample.m_value = value;
+    }
     // Get the latest sample with its timestamp less than or equal to the given skew
     void pop(uint64_t time, uint64_t skew, T_Sampled& value) {
         if (time < skew) return;
-        // Find the last element not greater than (time - skew). Do a binary search, as the queue
-        // should be ordered.
-        auto it = std::lower_bound(m_queue.rbegin(), m_queue.rend(), VlSample{time - skew, {}},
-                                   [](const VlSample& sample, const VlSample& skewed) {
-                                       return sample.m_timestamp > skewed.m_timestamp;
-                                   });
-        if (it != m_queue.rend()) {
-            value = it->m_value;
-            m_queue.erase(m_queue.begin(), it.base());
+        const uint64_t skewed = time - skew;
+        if (!m_size || at(0).m_timestamp > skewed) return;
+        // Find the number of samples not greater than (time - skew). Do a binary search, as
+        // the queue is ordered.
+        size_t lo = 1;
+        size_t hi = m_size;
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (at(mid).m_timestamp <= skewed) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
         }
+        value = at(lo - 1).m_value;
+        m_head = (m_head + lo) & (m_ring.size() - 1);
+        m_size -= lo;
     }
 };
 
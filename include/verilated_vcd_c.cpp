@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <cstring>
 #include <fcntl.h>
 
 #if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
@@ -87,6 +88,162 @@ ssize_t VerilatedVcdFile::write(const char* bufp, ssize_t len) VL_MT_UNSAFE {
     return ::write(m_fd, bufp, len);
 }
 
+//=============================================================================
+//=============================================================================
+//=============================================================================
+// VerilatedVcdAsyncFile
+
+VerilatedVcdAsyncFile::VerilatedVcdAsyncFile(bool direct, size_t blockSize)
+    : m_direct{direct}
+    , m_blockSize{blockSize < ALIGNMENT ? ALIGNMENT
+                                        : (blockSize + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT} {
+    // Over-allocate so both blocks can start on an ALIGNMENT boundary
+    m_allocp = new char[2 * m_blockSize + ALIGNMENT];
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(m_allocp);
+    char* const alignedp = m_allocp + (ALIGNMENT - addr % ALIGNMENT) % ALIGNMENT;
+    m_blockps[0] = alignedp;
+    m_blockps[1] = alignedp + m_blockSize;
+}
+
+VerilatedVcdAsyncFile::~VerilatedVcdAsyncFile() {
+    close();
+    VL_DO_CLEAR(delete[] m_allocp, m_allocp = nullptr);
+}
+
+bool VerilatedVcdAsyncFile::open(const std::string& name) VL_MT_UNSAFE {
+    if (m_fd >= 0) close();
+    const int flags = O_CREAT | O_WRONLY | O_TRUNC | O_LARGEFILE | O_CLOEXEC;
+    m_isDirect = false;
+#ifdef O_DIRECT
+    if (m_direct) {
+        m_fd = ::open(name.c_str(), flags | O_DIRECT, 0666);
+        m_isDirect = m_fd >= 0;
+    }
+#endif
+    // The filesystem may not support O_DIRECT, so fall back to the page cache
+    if (!m_isDirect) m_fd = ::open(name.c_str(), flags, 0666);
+    if (m_fd < 0) return false;
+    m_errno = 0;
+    m_fillIdx = 0;
+    m_fillBytes = 0;
+    {
+        const VerilatedLockGuard lock{m_mutex};
+        m_submitp = nullptr;
+        m_exit = false;
+    }
+    m_thread = std::thread{&VerilatedVcdAsyncFile::writerThread, this};
+    return true;
+}
+
+void VerilatedVcdAsyncFile::close() VL_MT_UNSAFE {
+    if (m_fd < 0) return;
+    {
+        VerilatedLockGuard lock{m_mutex};
+        m_cv.wait(m_mutex, [this]() VL_REQUIRES(m_mutex) { return !m_submitp; });
+        m_exit = true;
+        m_cv.notify_all();
+    }
+    m_thread.join();
+    // Write the partial last block from this thread
+#ifdef O_DIRECT
+    if (m_isDirect && m_fillBytes % ALIGNMENT) {
+        // O_DIRECT can only write whole aligned blocks, so drop it for the tail
+        ::fcntl(m_fd, F_SETFL, ::fcntl(m_fd, F_GETFL) & ~O_DIRECT);
+    }
+#endif
+    if (!m_errno) writeAll(m_blockps[m_fillIdx], m_fillBytes);
+    m_fillBytes = 0;
+    ::close(m_fd);
+    m_fd = -1;
+}
+
+ssize_t VerilatedVcdAsyncFile::write(const char* bufp, ssize_t len) VL_MT_UNSAFE {
+    if (VL_UNLIKELY(m_fd < 0)) {
+        errno = EBADF;
+        return -1;
+    }
+    if (VL_UNLIKELY(m_errno)) {
+        // Report a failed write of an earlier block
+        errno = m_errno;
+        return -1;
+    }
+    size_t remaining = len;
+    while (remaining) {
+        const size_t space = m_blockSize - m_fillBytes;
+        const size_t bytes = remaining < space ? remaining : space;
+        std::memcpy(m_blockps[m_fillIdx] + m_fillBytes, bufp, bytes);
+        m_fillBytes += bytes;
+        bufp += bytes;
+        remaining -= bytes;
+        if (m_fillBytes == m_blockSize) submit(m_blockSize);
+    }
+    return len;
+}
+
+void VerilatedVcdAsyncFile::flush() VL_MT_UNSAFE {
+    if (m_fd < 0) return;
+    // With O_DIRECT the unaligned tail must stay buffered until close()
+    const size_t bytes = m_isDirect ? m_fillBytes / ALIGNMENT * ALIGNMENT : m_fillBytes;
+    if (bytes) submit(bytes);
+    waitIdle();
+}
+
+void VerilatedVcdAsyncFile::waitIdle() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    VerilatedLockGuard lock{m_mutex};
+    m_cv.wait(m_mutex, [this]() VL_REQUIRES(m_mutex) { return !m_submitp; });
+}
+
+void VerilatedVcdAsyncFile::submit(size_t bytes) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    // Hand the first 'bytes' of the fill block to the writer thread once it is
+    // done with the other block, then continue filling the other block
+    const char* const fullp = m_blockps[m_fillIdx];
+    {
+        VerilatedLockGuard lock{m_mutex};
+        m_cv.wait(m_mutex, [this]() VL_REQUIRES(m_mutex) { return !m_submitp; });
+        m_submitp = fullp;
+        m_submitBytes = bytes;
+        m_cv.notify_all();
+    }
+    // Carry over any bytes not submitted; the writer only reads the submitted part
+    const size_t tail = m_fillBytes - bytes;
+    m_fillIdx = 1 - m_fillIdx;
+    if (tail) std::memcpy(m_blockps[m_fillIdx], fullp + bytes, tail);
+    m_fillBytes = tail;
+}
+
+bool VerilatedVcdAsyncFile::writeAll(const char* bufp, size_t len) VL_MT_UNSAFE {
+    while (len) {
+        const ssize_t got = ::write(m_fd, bufp, len);
+        if (got > 0) {
+            bufp += got;
+            len -= got;
+        } else if (got < 0 && errno != EAGAIN && errno != EINTR) {
+            m_errno = errno;
+            return false;
+        }
+    }
+    return true;
+}
+
+void VerilatedVcdAsyncFile::writerThread() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    while (true) {
+        const char* bufp;
+        size_t bytes;
+        {
+            VerilatedLockGuard lock{m_mutex};
+            m_cv.wait(m_mutex, [this]() VL_REQUIRES(m_mutex) { return m_submitp || m_exit; });
+            if (!m_submitp) return;  // Exit requested, and nothing left to write
+            bufp = m_submitp;
+            bytes = m_submitBytes;
+        }
+        // Write outside the lock, so write() can keep filling the other block
+        if (!m_errno) writeAll(bufp, bytes);
+        const VerilatedLockGuard lock{m_mutex};
+        m_submitp = nullptr;
+        m_cv.notify_all();
+    }
+}
+
 //=============================================================================
 //=============================================================================
 //=============================================================================
@@ -249,6 +406,7 @@ void VerilatedVcd::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     Super::flushBase();
     bufferFlush();
+    if (isOpen()) m_filep->flush();
 }
 
 void VerilatedVcd::printStr(const char* str) {
@@ -306,6 +464,10 @@ void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
         }
     }
 
+#ifdef VL_PERF_STATS
+    if (contextp()) contextp()->perfCounters().traceBytes(m_writep - m_wrBufp);
+#endif
+
     // Reset buffer
     m_writep = m_wrBufp;
     m_wrTimeBeginp = nullptr;
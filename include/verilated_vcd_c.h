@@ -24,7 +24,10 @@
 #include "verilated.h"
 #include "verilated_trace.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <string>
+#include <thread>
 #include <vector>
 
 class VerilatedVcdBuffer;
@@ -171,6 +174,8 @@ template <>
 void VerilatedVcd::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedVcd::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedVcd::Super::enableScope(const std::string& hier, bool enable);
 #endif  // DOXYGEN
 
 //=============================================================================
@@ -246,6 +251,63 @@ public:
     virtual void close() VL_MT_UNSAFE;
     /// Write data to file (if it is open)
     virtual ssize_t write(const char* bufp, ssize_t len) VL_MT_UNSAFE;
+    /// Push any data held by the object to the file (if it is open)
+    virtual void flush() VL_MT_UNSAFE {}
+};
+
+//=============================================================================
+// VerilatedVcdAsyncFile
+/// VerilatedVcdFile that writes to the file from a separate writer thread.
+/// Data is copied into one of two blocks, and each full block is handed to
+/// the writer thread while the other is being filled, so the thread
+/// formatting the dump only waits on storage if it runs a whole block ahead.
+/// Optionally opens the file with O_DIRECT (where supported), so the dump
+/// bypasses the page cache; the unaligned tail is written at close().
+
+class VerilatedVcdAsyncFile VL_NOT_FINAL : public VerilatedVcdFile {
+    // CONSTANTS
+    static constexpr size_t ALIGNMENT = 4096;  // Block alignment required by O_DIRECT
+
+    // MEMBERS
+    const bool m_direct;  // Open with O_DIRECT
+    const size_t m_blockSize;  // Size of each block, a multiple of ALIGNMENT
+    int m_fd = -1;  // File descriptor we're writing to
+    bool m_isDirect = false;  // File was opened with O_DIRECT
+    char* m_allocp = nullptr;  // Allocation holding both blocks
+    char* m_blockps[2] = {nullptr, nullptr};  // The two aligned blocks
+    size_t m_fillIdx = 0;  // Index of block being filled by write()
+    size_t m_fillBytes = 0;  // Bytes in block being filled
+    std::thread m_thread;  // Writer thread
+    std::atomic<int> m_errno{0};  // Error from writer thread, 0 if none
+
+    mutable VerilatedMutex m_mutex;  // Protects below, shared with writer thread
+    std::condition_variable_any m_cv;  // Signals change of below
+    const char* m_submitp VL_GUARDED_BY(m_mutex) = nullptr;  // Block to write, or nullptr
+    size_t m_submitBytes VL_GUARDED_BY(m_mutex) = 0;  // Bytes of block to write
+    bool m_exit VL_GUARDED_BY(m_mutex) = false;  // Writer thread should exit
+
+    // METHODS
+    void writerThread() VL_MT_SAFE_EXCLUDES(m_mutex);
+    void waitIdle() VL_MT_SAFE_EXCLUDES(m_mutex);
+    void submit(size_t bytes) VL_MT_SAFE_EXCLUDES(m_mutex);
+    bool writeAll(const char* bufp, size_t len) VL_MT_UNSAFE;
+
+public:
+    /// Construct a (as yet) closed file, writing blocks of 'blockSize'
+    /// bytes, opened with O_DIRECT if 'direct' and supported
+    explicit VerilatedVcdAsyncFile(bool direct = false, size_t blockSize = 1024 * 1024);
+    /// Close and destruct
+    ~VerilatedVcdAsyncFile() override;
+    VL_UNCOPYABLE(VerilatedVcdAsyncFile);
+    /// Open a file with given filename
+    bool open(const std::string& name) override VL_MT_UNSAFE;
+    /// Write remaining data and close object's file
+    void close() override VL_MT_UNSAFE;
+    /// Copy data for the writer thread; only blocks if both blocks are busy
+    ssize_t write(const char* bufp, ssize_t len) override VL_MT_UNSAFE;
+    /// Wait until buffered data is written (with O_DIRECT, up to the last
+    /// aligned block)
+    void flush() override VL_MT_UNSAFE;
 };
 
 //=============================================================================
@@ -321,6 +383,18 @@ public:
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
         m_sptrace.dumpvars(level, hier);
     }
+    // Pause or resume tracing of a scope and those under it, e.g. "top.cpu".
+    // May be called while tracing, skipping the work of tracing the scope.
+    void enableScope(const std::string& hier, bool enable) VL_MT_SAFE {
+        m_sptrace.enableScope(hier, enable);
+    }
+    // Only dump on every n-th call to dump(), for sampling slowly changing
+    // signals; each dump shows the values at that time
+    void dumpDecimate(uint32_t n) VL_MT_SAFE { m_sptrace.dumpDecimate(n); }
+    // Only dump when cb(userp) returns true, nullptr = always
+    void dumpTrigger(bool (*cb)(void*), void* userp) VL_MT_SAFE {
+        m_sptrace.dumpTrigger(cb, userp);
+    }
 
     // Internal class access
     VerilatedVcd* spTrace() { return &m_sptrace; }
@@ -33,15 +33,25 @@
 
 #include "vltstd/vpi_user.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
+#include <fcntl.h>
 #include <list>
 #include <map>
-#include <set>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+// clang-format off
+#ifndef _WIN32
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+// clang-format on
+
 //======================================================================
 // Internal constants
 
@@ -88,14 +98,29 @@ public:
         static constexpr size_t CHUNK_SIZE = 256;
         if (VL_UNCOVERABLE(size > CHUNK_SIZE))
             VL_FATAL_MT(__FILE__, __LINE__, "", "increase CHUNK_SIZE");
+        // +8: 8 bytes for next
+        static constexpr size_t CHUNK_BYTES = CHUNK_SIZE + 8;
+#ifndef VL_VPI_IMMEDIATE_FREE
+        if (VL_UNLIKELY(!t_freeHeadp)) {
+            // Walking a large hierarchy holds many handles at once, so
+            // allocate chunks a slab at a time rather than one per handle
+            static constexpr size_t SLAB_CHUNKS = 64;
+            uint8_t* const slabp
+                = reinterpret_cast<uint8_t*>(::operator new(CHUNK_BYTES * SLAB_CHUNKS));
+            for (size_t i = 0; i < SLAB_CHUNKS; ++i) {
+                uint8_t* const chunkp = slabp + i * CHUNK_BYTES;
+                *(reinterpret_cast<uint8_t**>(chunkp)) = t_freeHeadp;
+                t_freeHeadp = chunkp;
+            }
+        }
+#endif
         if (VL_LIKELY(t_freeHeadp)) {
             uint8_t* const newp = t_freeHeadp;
             t_freeHeadp = *(reinterpret_cast<uint8_t**>(newp));
             *(reinterpret_cast<uint32_t*>(newp)) = activeMagic();
             return newp + 8;
         }
-        // +8: 8 bytes for next
-        uint8_t* newp = reinterpret_cast<uint8_t*>(::operator new(CHUNK_SIZE + 8));
+        uint8_t* newp = reinterpret_cast<uint8_t*>(::operator new(CHUNK_BYTES));
         *(reinterpret_cast<uint32_t*>(newp)) = activeMagic();
         return newp + 8;
     }
@@ -345,7 +370,6 @@ public:
 };
 
 class VerilatedVpioVar VL_NOT_FINAL : public VerilatedVpioVarBase {
-    uint8_t* m_prevDatap = nullptr;  // Previous value of data, for cbValueChange
     union {
         uint8_t u8[4];
         uint32_t u32;
@@ -371,14 +395,11 @@ public:
             m_entSize = varp->m_entSize;
             m_varDatap = varp->m_varDatap;
             m_index = varp->m_index;
-            // Not copying m_prevDatap, must be nullptr
         } else {
             m_mask.u32 = 0;
         }
     }
-    ~VerilatedVpioVar() override {
-        if (m_prevDatap) VL_DO_CLEAR(delete[] m_prevDatap, m_prevDatap = nullptr);
-    }
+    ~VerilatedVpioVar() override = default;
     static VerilatedVpioVar* castp(vpiHandle h) {
         return dynamic_cast<VerilatedVpioVar*>(reinterpret_cast<VerilatedVpio*>(h));
     }
@@ -424,14 +445,7 @@ public:
         for (auto idx : index()) t_out += "[" + std::to_string(idx) + "]";
         return t_out.c_str();
     }
-    void* prevDatap() const { return m_prevDatap; }
     void* varDatap() const override { return m_varDatap; }
-    void createPrevDatap() {
-        if (VL_UNLIKELY(!m_prevDatap)) {
-            m_prevDatap = new uint8_t[entSize()];
-            std::memcpy(prevDatap(), m_varDatap, entSize());
-        }
-    }
 };
 
 class VerilatedVpioVarIter final : public VerilatedVpio {
@@ -547,20 +561,21 @@ class VerilatedVpioModule final : public VerilatedVpioScope {
 public:
     explicit VerilatedVpioModule(const VerilatedScope* modulep)
         : VerilatedVpioScope{modulep} {
-        // Look for '.' not inside escaped identifier
-        const std::string scopename = m_fullname;
-        std::string::size_type pos = std::string::npos;
-        size_t i = 0;
-        while (i < scopename.length()) {
-            if (scopename[i] == '\\') {
-                while (i < scopename.length() && scopename[i] != ' ') ++i;
-                ++i;  // Proc ' ', it should always be there. Then grab '.' on next cycle
+        // Look for '.' not inside escaped identifier, without copying the
+        // name, as hierarchy walks create a handle per module
+        bool found = false;
+        const char* cp = m_fullname;
+        while (*cp && !found) {
+            if (*cp == '\\') {
+                while (*cp && *cp != ' ') ++cp;
+                if (*cp) ++cp;  // Proc ' ', it should always be there
+            } else if (*cp == '.') {
+                found = true;
             } else {
-                while (i < scopename.length() && scopename[i] != '.') ++i;
-                if (i < scopename.length()) pos = i++;
+                ++cp;
             }
         }
-        if (VL_UNLIKELY(pos == std::string::npos)) m_toplevel = true;
+        if (VL_UNLIKELY(!found)) m_toplevel = true;
     }
     static VerilatedVpioModule* castp(vpiHandle h) {
         return dynamic_cast<VerilatedVpioModule*>(reinterpret_cast<VerilatedVpio*>(h));
@@ -700,7 +715,6 @@ public:
         m_cbData.value = &m_value;
         if (varop) {
             m_cbData.obj = m_varo.castVpiHandle();
-            m_varo.createPrevDatap();
         } else {
             m_cbData.obj = nullptr;
         }
@@ -874,6 +888,29 @@ class VerilatedVpiImp final {
     // Callbacks that are past or at current timestamp
     std::array<VpioCbList, CB_ENUM_MAX_VALUE> m_cbCurrentLists;
     VpioCbList m_cbCallList;  // List of callbacks currently being called by callCbs
+    // cbValueChange callbacks grouped by the data they watch, so each value
+    // is compared once per callValueCbs, rather than once per callback
+    struct ValueWatch final {
+        const void* m_datap;  // Data being watched
+        uint32_t m_size;  // Size of data in bytes
+        std::unique_ptr<uint8_t[]> m_prevp;  // Value of data when last compared
+        std::vector<VerilatedVpiCbHolder*> m_cbps;  // Callbacks, in m_cbCurrentLists
+    };
+    std::vector<ValueWatch> m_valueWatches;
+    // Latest watch of each data and size, which new callbacks may join
+    std::map<std::pair<const void*, uint32_t>, size_t> m_valueWatchIndex;
+    std::vector<size_t> m_valueChanged;  // Changed m_valueWatches, reused by callValueCbs
+    std::vector<VerilatedVpiCbHolder*> m_valueCallps;  // Callbacks being called by callValueCbs
+    std::vector<p_cb_data> m_valueBatch;  // Data passed to m_valueBatchCb, reused
+    VerilatedVpi::ValueChangeBatchCb m_valueBatchCb = nullptr;  // See valueChangeBatch()
+    void* m_valueBatchUserp = nullptr;  // User data for m_valueBatchCb
+    bool m_valueCbsRemoved = false;  // A cbValueChange was removed, so needs cleanup
+    // Variables found by vpi_handle_by_name, valid while no scope is inserted or erased
+    using VarNameCache
+        = std::unordered_map<std::string, std::pair<const VerilatedVar*, const VerilatedScope*>>;
+    VarNameCache m_varNameCache;
+    const VerilatedContext* m_varNameCacheContextp = nullptr;  // Context of m_varNameCache
+    uint64_t m_varNameCacheGeneration = 0;  // scopeGeneration() of m_varNameCache
     VpioFutureCbs m_futureCbs;  // Time based callbacks for future timestamps
     VpioFutureCbs m_nextCbs;  // cbNextSimTime callbacks
     std::list<VerilatedVpiPutHolder> m_inertialPuts;  // Pending vpi puts due to vpiInertialDelay
@@ -900,7 +937,55 @@ public:
                                     cb_data_p->reason, id, cb_data_p->obj););
         VerilatedVpioVar* varop = nullptr;
         if (cb_data_p->reason == cbValueChange) varop = VerilatedVpioVar::castp(cb_data_p->obj);
-        s().m_cbCurrentLists[cb_data_p->reason].emplace_back(id, cb_data_p, varop);
+        VpioCbList& cbObjList = s().m_cbCurrentLists[cb_data_p->reason];
+        cbObjList.emplace_back(id, cb_data_p, varop);
+        if (varop) valueWatchAdd(&cbObjList.back());
+    }
+    static void valueWatchAdd(VerilatedVpiCbHolder* hop) {
+        const VerilatedVpioVar* const varop
+            = reinterpret_cast<VerilatedVpioVar*>(hop->cb_datap()->obj);
+        const void* const datap = varop->varDatap();
+        const uint32_t size = varop->entSize();
+        const auto key = std::make_pair(datap, size);
+        const auto it = s().m_valueWatchIndex.find(key);
+        // A callback only sees changes made after it was added, so may only
+        // join a watch whose previous value is still current
+        if (it != s().m_valueWatchIndex.end()) {
+            ValueWatch& watch = s().m_valueWatches[it->second];
+            if (std::memcmp(watch.m_prevp.get(), datap, size) == 0) {
+                watch.m_cbps.push_back(hop);
+                return;
+            }
+        }
+        s().m_valueWatchIndex[key] = s().m_valueWatches.size();
+        s().m_valueWatches.emplace_back();
+        ValueWatch& watch = s().m_valueWatches.back();
+        watch.m_datap = datap;
+        watch.m_size = size;
+        watch.m_prevp.reset(new uint8_t[size]);
+        std::memcpy(watch.m_prevp.get(), datap, size);
+        watch.m_cbps.push_back(hop);
+    }
+    static void valueWatchCleanup() {
+        // Remove callbacks invalidated by cbReasonRemove, and watches left empty
+        s().m_valueCbsRemoved = false;
+        std::vector<ValueWatch>& watches = s().m_valueWatches;
+        size_t keep = 0;
+        for (size_t i = 0; i < watches.size(); ++i) {
+            std::vector<VerilatedVpiCbHolder*>& cbps = watches[i].m_cbps;
+            const auto invalid = [](const VerilatedVpiCbHolder* hop) { return hop->invalid(); };
+            cbps.erase(std::remove_if(cbps.begin(), cbps.end(), invalid), cbps.end());
+            if (cbps.empty()) continue;
+            if (keep != i) watches[keep] = std::move(watches[i]);
+            ++keep;
+        }
+        watches.erase(watches.begin() + keep, watches.end());
+        s().m_valueWatchIndex.clear();
+        for (size_t i = 0; i < watches.size(); ++i) {
+            s().m_valueWatchIndex[std::make_pair(watches[i].m_datap, watches[i].m_size)] = i;
+        }
+        s().m_cbCurrentLists[cbValueChange].remove_if(
+            [](const VerilatedVpiCbHolder& ho) { return ho.invalid(); });
     }
     static void cbFutureAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
         // The passed cb_data_p was property of the user, so need to recreate
@@ -926,6 +1011,7 @@ public:
         for (auto& ir : s().m_cbCurrentLists[reason]) {
             if (ir.id() == id) {
                 ir.invalidate();
+                if (reason == cbValueChange) s().m_valueCbsRemoved = true;
                 return;  // Once found, it won't also be in m_cbCallList, m_futureCbs, or m_nextCbs
             }
         }
@@ -1007,45 +1093,97 @@ public:
         s().m_cbCallList.clear();
         return called;
     }
+    static bool valueDiffers(const void* ap, const void* bp, uint32_t size) {
+        // Data is aligned to its entSize, so may compare common sizes directly
+        switch (size) {
+        case 1: return *static_cast<const CData*>(ap) != *static_cast<const CData*>(bp);
+        case 2: return *static_cast<const SData*>(ap) != *static_cast<const SData*>(bp);
+        case 4: return *static_cast<const IData*>(ap) != *static_cast<const IData*>(bp);
+        case 8: return *static_cast<const QData*>(ap) != *static_cast<const QData*>(bp);
+        default: return std::memcmp(ap, bp, size) != 0;
+        }
+    }
     static bool callValueCbs() VL_MT_UNSAFE_ONE {
         assertOneCheck();
-        VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
-        bool called = false;
-        std::set<VerilatedVpioVar*> update;  // set of objects to update after callbacks
-        if (cbObjList.empty()) return called;
-        const auto last = std::prev(cbObjList.end());  // prevent looping over newly added elements
-        for (auto it = cbObjList.begin(); true;) {
-            // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
-            const bool was_last = it == last;
-            if (VL_UNLIKELY(it->invalid())) {  // Deleted earlier, cleanup
-                it = cbObjList.erase(it);
-                if (was_last) break;
-                continue;
+        if (VL_UNLIKELY(s().m_valueCbsRemoved)) valueWatchCleanup();
+        std::vector<size_t>& changed = s().m_valueChanged;
+        changed.clear();
+        for (size_t i = 0; i < s().m_valueWatches.size(); ++i) {
+            const ValueWatch& watch = s().m_valueWatches[i];
+            if (valueDiffers(watch.m_prevp.get(), watch.m_datap, watch.m_size)) {
+                changed.push_back(i);
             }
-            VerilatedVpiCbHolder& ho = *it++;
-            VerilatedVpioVar* const varop
-                = reinterpret_cast<VerilatedVpioVar*>(ho.cb_datap()->obj);
-            void* const newDatap = varop->varDatap();
-            void* const prevDatap = varop->prevDatap();  // Was malloced when we added the callback
-            VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_test %s v[0]=%d/%d %p %p\n",
-                                        varop->fullname(), *(static_cast<CData*>(newDatap)),
-                                        *(static_cast<CData*>(prevDatap)), newDatap, prevDatap););
-            if (std::memcmp(prevDatap, newDatap, varop->entSize()) != 0) {
-                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n",
-                                            ho.id(), varop->fullname(),
-                                            *(static_cast<CData*>(newDatap))););
-                update.insert(varop);
-                vpi_get_value(ho.cb_datap()->obj, ho.cb_datap()->value);
-                (ho.cb_rtnp())(ho.cb_datap());
-                called = true;
+        }
+        if (changed.empty()) return false;
+        // Gather before calling, to prevent calling newly added callbacks
+        std::vector<VerilatedVpiCbHolder*>& callps = s().m_valueCallps;
+        callps.clear();
+        for (const size_t i : changed) {
+            const ValueWatch& watch = s().m_valueWatches[i];
+            callps.insert(callps.end(), watch.m_cbps.begin(), watch.m_cbps.end());
+        }
+        // Call in order added, as ids are increasing
+        if (changed.size() > 1) {
+            std::sort(callps.begin(), callps.end(),
+                      [](const VerilatedVpiCbHolder* ap, const VerilatedVpiCbHolder* bp) {
+                          return ap->id() < bp->id();
+                      });
+        }
+        if (s().m_valueBatchCb) {
+            std::vector<p_cb_data>& batch = s().m_valueBatch;
+            batch.clear();
+            for (VerilatedVpiCbHolder* const hop : callps) {
+                if (VL_UNLIKELY(hop->invalid())) continue;
+                vpi_get_value(hop->cb_datap()->obj, hop->cb_datap()->value);
+                batch.push_back(hop->cb_datap());
             }
-            if (was_last) break;
+            // Callbacks in the batch may remove other callbacks in it, so
+            // copy the values before calling
+            for (const size_t i : changed) {
+                const ValueWatch& watch = s().m_valueWatches[i];
+                std::memcpy(watch.m_prevp.get(), watch.m_datap, watch.m_size);
+            }
+            if (batch.empty()) return false;
+            s().m_valueBatchCb(batch.size(), batch.data(), s().m_valueBatchUserp);
+            return true;
         }
-        for (const auto& ip : update) {
-            std::memcpy(ip->prevDatap(), ip->varDatap(), ip->entSize());
+        bool called = false;
+        for (VerilatedVpiCbHolder* const hop : callps) {
+            if (VL_UNLIKELY(hop->invalid())) continue;  // Removed, maybe by earlier callback
+            VL_DEBUG_IF_PLI({
+                const VerilatedVpioVar* const varop
+                    = reinterpret_cast<VerilatedVpioVar*>(hop->cb_datap()->obj);
+                VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n", hop->id(),
+                            varop->fullname(), *(static_cast<CData*>(varop->varDatap())));
+            });
+            vpi_get_value(hop->cb_datap()->obj, hop->cb_datap()->value);
+            (hop->cb_rtnp())(hop->cb_datap());
+            called = true;
+        }
+        // Callbacks may have added watches, but not moved existing ones
+        for (const size_t i : changed) {
+            const ValueWatch& watch = s().m_valueWatches[i];
+            std::memcpy(watch.m_prevp.get(), watch.m_datap, watch.m_size);
         }
         return called;
     }
+    static void valueChangeBatch(VerilatedVpi::ValueChangeBatchCb cb,
+                                 void* userp) VL_MT_UNSAFE_ONE {
+        assertOneCheck();
+        s().m_valueBatchCb = cb;
+        s().m_valueBatchUserp = userp;
+    }
+    static VarNameCache& varNameCache() VL_MT_UNSAFE_ONE {
+        const VerilatedContext* const contextp = Verilated::threadContextp();
+        const uint64_t generation = VerilatedContextImp::scopeGeneration();
+        if (VL_UNLIKELY(contextp != s().m_varNameCacheContextp
+                        || generation != s().m_varNameCacheGeneration)) {
+            s().m_varNameCache.clear();
+            s().m_varNameCacheContextp = contextp;
+            s().m_varNameCacheGeneration = generation;
+        }
+        return s().m_varNameCache;
+    }
     static void dumpCbs() VL_MT_UNSAFE_ONE;
     static VerilatedVpiError* error_info() VL_MT_UNSAFE_ONE;  // getter for vpi error info
     static bool evalNeeded() { return s().m_evalNeeded; }
@@ -1155,6 +1293,10 @@ void VerilatedVpi::callTimedCbs() VL_MT_UNSAFE_ONE { VerilatedVpiImp::callCbs(cb
 
 bool VerilatedVpi::callValueCbs() VL_MT_UNSAFE_ONE { return VerilatedVpiImp::callValueCbs(); }
 
+void VerilatedVpi::valueChangeBatch(ValueChangeBatchCb cb, void* userp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::valueChangeBatch(cb, userp);
+}
+
 QData VerilatedVpi::cbNextDeadline() VL_MT_UNSAFE_ONE { return VerilatedVpiImp::cbNextDeadline(); }
 
 void VerilatedVpi::dumpCbs() VL_MT_UNSAFE_ONE { VerilatedVpiImp::dumpCbs(); }
@@ -1170,6 +1312,178 @@ bool VerilatedVpi::evalNeeded() VL_MT_UNSAFE_ONE { return VerilatedVpiImp::evalN
 
 void VerilatedVpi::doInertialPuts() VL_MT_UNSAFE_ONE { VerilatedVpiImp::doInertialPuts(); }
 
+static const VerilatedVpioVar* vl_vpi_raw_varp(vpiHandle object) {
+    // Whole variable or unpacked array element, that getRaw may copy directly
+    const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(object);
+    if (VL_UNLIKELY(!vop || vop->indexedDim() + 1 != vop->varp()->udims())) return nullptr;
+    switch (vop->varp()->vltype()) {
+    case VLVT_UINT8:
+    case VLVT_UINT16:
+    case VLVT_UINT32:
+    case VLVT_UINT64:
+    case VLVT_WDATA:
+    case VLVT_REAL: return vop;
+    default: return nullptr;
+    }
+}
+
+size_t VerilatedVpi::rawSize(vpiHandle object) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    const VerilatedVpioVar* const vop = vl_vpi_raw_varp(object);
+    return vop ? vop->entSize() : 0;
+}
+
+bool VerilatedVpi::getRaw(size_t count, const vpiHandle* objectsp,
+                          void* datap) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    for (size_t i = 0; i < count; ++i) {
+        if (VL_UNLIKELY(!vl_vpi_raw_varp(objectsp[i]))) {
+            VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported vpiHandle (%p)", __func__,
+                          objectsp[i]);
+            return false;
+        }
+    }
+    uint8_t* outp = static_cast<uint8_t*>(datap);
+    for (size_t i = 0; i < count; ++i) {
+        const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(objectsp[i]);
+        std::memcpy(outp, vop->varDatap(), vop->entSize());
+        outp += vop->entSize();
+    }
+    return true;
+}
+
+bool VerilatedVpi::putRaw(size_t count, const vpiHandle* objectsp,
+                          const void* datap) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    for (size_t i = 0; i < count; ++i) {
+        const VerilatedVpioVar* const vop = vl_vpi_raw_varp(objectsp[i]);
+        if (VL_UNLIKELY(!vop)) {
+            VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported vpiHandle (%p)", __func__,
+                          objectsp[i]);
+            return false;
+        }
+        if (VL_UNLIKELY(!vop->varp()->isPublicRW())) {
+            VL_VPI_ERROR_(__FILE__, __LINE__,
+                          "%s was used on signal marked read-only,"
+                          " use public_flat_rw instead for %s : %s",
+                          __func__, vop->fullname(), vop->scopep()->defname());
+            return false;
+        }
+    }
+    const uint8_t* inp = static_cast<const uint8_t*>(datap);
+    for (size_t i = 0; i < count; ++i) {
+        const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(objectsp[i]);
+        void* const varDatap = vop->varDatap();
+        std::memcpy(varDatap, inp, vop->entSize());
+        inp += vop->entSize();
+        const int bits = vop->varp()->entBits();
+        switch (vop->varp()->vltype()) {
+        case VLVT_UINT8: *static_cast<CData*>(varDatap) &= VL_MASK_I(bits); break;
+        case VLVT_UINT16: *static_cast<SData*>(varDatap) &= VL_MASK_I(bits); break;
+        case VLVT_UINT32: *static_cast<IData*>(varDatap) &= VL_MASK_I(bits); break;
+        case VLVT_UINT64: *static_cast<QData*>(varDatap) &= VL_MASK_Q(bits); break;
+        case VLVT_WDATA:
+            static_cast<EData*>(varDatap)[VL_WORDS_I(bits) - 1] &= VL_MASK_E(bits);
+            break;
+        default: break;
+        }
+    }
+    if (count) VerilatedVpiImp::evalNeeded(true);
+    return true;
+}
+
+//======================================================================
+// VerilatedVpiShm implementation
+
+bool VerilatedVpiShm::open(const char* filenamep, size_t count,
+                           const vpiHandle* objectsp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    if (isOpen()) return false;
+#ifdef _WIN32
+    (void)filenamep;
+    (void)count;
+    (void)objectsp;
+    return false;
+#else
+    static constexpr size_t HEADER_WORDS = 4;  // magic, sequence, count, dataBytes
+    const auto align8 = [](size_t n) { return (n + 7) & ~size_t{7}; };
+    std::vector<const VerilatedVpioVar*> vops;
+    size_t namesBytes = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const VerilatedVpioVar* const vop = vl_vpi_raw_varp(objectsp[i]);
+        if (VL_UNLIKELY(!vop)) return false;
+        vops.push_back(vop);
+        namesBytes += std::strlen(vop->fullname()) + 1;
+    }
+    const size_t namesOffset = (HEADER_WORDS + 2 * count) * sizeof(uint64_t);
+    const size_t dataOffset = align8(namesOffset + namesBytes);
+    size_t bytes = dataOffset;
+    for (const VerilatedVpioVar* const vop : vops) {
+        m_vars.emplace_back(vop->varDatap(), vop->entSize());
+        m_offsets.push_back(bytes);
+        bytes += align8(vop->entSize());
+    }
+
+    const int fd = ::open(filenamep, O_CREAT | O_RDWR | O_TRUNC | O_CLOEXEC, 0666);
+    void* mapp = MAP_FAILED;
+    if (fd >= 0) {
+        if (::ftruncate(fd, bytes) == 0) {
+            mapp = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        ::close(fd);  // Mapping remains
+    }
+    if (VL_UNLIKELY(mapp == MAP_FAILED)) {
+        m_vars.clear();
+        m_offsets.clear();
+        return false;
+    }
+    m_basep = static_cast<uint8_t*>(mapp);
+    m_bytes = bytes;
+
+    uint64_t* const headerp = reinterpret_cast<uint64_t*>(m_basep);
+    std::memcpy(&headerp[0], "vltshm01", sizeof(uint64_t));
+    headerp[1] = 0;
+    headerp[2] = count;
+    headerp[3] = bytes - dataOffset;
+    char* namep = reinterpret_cast<char*>(m_basep + namesOffset);
+    for (size_t i = 0; i < count; ++i) {
+        headerp[HEADER_WORDS + 2 * i] = m_offsets[i];
+        headerp[HEADER_WORDS + 2 * i + 1] = m_vars[i].second;
+        const size_t len = std::strlen(vops[i]->fullname()) + 1;
+        std::memcpy(namep, vops[i]->fullname(), len);
+        namep += len;
+    }
+    update();
+    return true;
+#endif
+}
+
+void VerilatedVpiShm::close() VL_MT_UNSAFE_ONE {
+    if (!isOpen()) return;
+#ifndef _WIN32
+    ::munmap(m_basep, m_bytes);
+#endif
+    m_basep = nullptr;
+    m_bytes = 0;
+    m_vars.clear();
+    m_offsets.clear();
+}
+
+void VerilatedVpiShm::update() VL_MT_UNSAFE_ONE {
+    if (VL_UNLIKELY(!isOpen())) return;
+    uint64_t* const sequencep = reinterpret_cast<uint64_t*>(m_basep) + 1;
+    // Sequence lock: odd while writing, so readers retry
+    const uint64_t sequence = __atomic_load_n(sequencep, __ATOMIC_RELAXED);
+    __atomic_store_n(sequencep, sequence + 1, __ATOMIC_RELAXED);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < m_vars.size(); ++i) {
+        std::memcpy(m_basep + m_offsets[i], m_vars[i].first, m_vars[i].second);
+    }
+    __atomic_store_n(sequencep, sequence + 2, __ATOMIC_RELEASE);
+}
+
 //======================================================================
 // VerilatedVpiImp implementation
 
@@ -2067,7 +2381,12 @@ vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
         scopeAndName = std::string{voScopep->fullname()} + (scopeIsPackage ? "" : ".") + namep;
         namep = const_cast<PLI_BYTE8*>(scopeAndName.c_str());
     }
-    {
+    auto& cache = VerilatedVpiImp::varNameCache();
+    const auto cacheIt = cache.find(scopeAndName);
+    if (cacheIt != cache.end()) {
+        varp = cacheIt->second.first;
+        scopep = cacheIt->second.second;
+    } else {
         // This doesn't yet follow the hierarchy in the proper way
         bool isPackage = false;
         scopep = Verilated::threadContextp()->scopeFind(namep);
@@ -2119,8 +2438,9 @@ vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
             if (!scopep) return nullptr;
             varp = scopep->varFind(basename.c_str());
         }
+        if (!varp) return nullptr;
+        cache.emplace(scopeAndName, std::make_pair(varp, scopep));
     }
-    if (!varp) return nullptr;
 
     if (varp->isParam()) {
         return (new VerilatedVpioParam{varp, scopep})->castVpiHandle();
@@ -46,6 +46,14 @@ public:
     /// Call value based callbacks.
     /// User wrapper code should call this from their main loops.
     static bool callValueCbs() VL_MT_UNSAFE_ONE;
+    /// Type of callback for valueChangeBatch()
+    using ValueChangeBatchCb = void (*)(size_t count, const p_cb_data* cbDatasp, void* userp);
+    /// Have callValueCbs() call cb once, with the cb_data of every
+    /// cbValueChange callback whose object changed, values filled in,
+    /// instead of calling each callback's cb_rtn.  Lets wrappers written in
+    /// other languages cross into them once per call.  Pass nullptr to
+    /// call each callback's cb_rtn again.
+    static void valueChangeBatch(ValueChangeBatchCb cb, void* userp) VL_MT_UNSAFE_ONE;
     /// Call callbacks of arbitrary types.
     /// User wrapper code should call this from their main loops.
     static bool callCbs(uint32_t reason) VL_MT_UNSAFE_ONE;
@@ -64,9 +72,62 @@ public:
     static void clearEvalNeeded() VL_MT_UNSAFE_ONE;
     /// Perform inertially delayed puts
     static void doInertialPuts() VL_MT_UNSAFE_ONE;
+    /// Return bytes of the raw value of a variable handle, in the model's
+    /// native format, as used by getRaw() and putRaw(). Returns 0 if the
+    /// handle is not an integral or real variable, or an element of an
+    /// unpacked array of them.
+    static size_t rawSize(vpiHandle object) VL_MT_UNSAFE_ONE;
+    /// Copy raw values of count variable handles, packed one after another
+    /// into datap.  Faster than vpi_get_value for many signals per cycle.
+    /// Returns false, copying nothing, if any rawSize() is 0.
+    static bool getRaw(size_t count, const vpiHandle* objectsp, void* datap) VL_MT_UNSAFE_ONE;
+    /// Set values of count variable handles from raw values laid out as by
+    /// getRaw().  Unused upper bits are cleared.  Returns false, setting
+    /// nothing, if any rawSize() is 0 or any variable is not public_flat_rw.
+    static bool putRaw(size_t count, const vpiHandle* objectsp,
+                       const void* datap) VL_MT_UNSAFE_ONE;
 
     // Self test, for internal use only
     static void selfTest() VL_MT_UNSAFE_ONE;
 };
 
+//======================================================================
+/// Mirror of variable values in a shared memory mapped file, so other
+/// processes may read them without VPI calls.
+///
+/// The file, in native byte order, holds:
+///   uint64_t magic: "vltshm01"
+///   uint64_t sequence: Odd while update() is writing; see below
+///   uint64_t count: Number of variables
+///   uint64_t dataBytes: Bytes of values, starting after the names
+///   count entries of {uint64_t offset; uint64_t size;}: Offset of the raw
+///       value of each variable from the start of the file, and its
+///       VerilatedVpi::rawSize() bytes
+///   count NUL terminated full names, then padding to 8 bytes
+///   values, each 8 byte aligned
+///
+/// A reader copies the values between two reads of the sequence, and
+/// retries if they differ or are odd.  Not available on Windows.
+
+class VerilatedVpiShm final {
+    std::vector<std::pair<const void*, size_t>> m_vars;  // Data and size of each variable
+    std::vector<size_t> m_offsets;  // Offset of each value in m_basep
+    uint8_t* m_basep = nullptr;  // Mapped file
+    size_t m_bytes = 0;  // Size of mapped file
+
+public:
+    VerilatedVpiShm() = default;
+    ~VerilatedVpiShm() { close(); }
+    VL_UNCOPYABLE(VerilatedVpiShm);
+    /// Create the file, often under /dev/shm, to mirror count variable
+    /// handles.  Returns false if a rawSize() is 0 or the file can't be made.
+    bool open(const char* filenamep, size_t count, const vpiHandle* objectsp) VL_MT_UNSAFE_ONE;
+    /// Unmap the file (the file itself remains)
+    void close() VL_MT_UNSAFE_ONE;
+    /// Return true if open
+    bool isOpen() const { return m_basep != nullptr; }
+    /// Copy the current values into the file; call after each eval
+    void update() VL_MT_UNSAFE_ONE;
+};
+
 #endif  // Guard
@@ -0,0 +1,606 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2001-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated C++ tracing in VTC format implementation code
+///
+/// This file must be compiled and linked against all Verilated objects
+/// that use --trace-vtc.
+///
+/// Use "verilator --trace-vtc" to add this to the Makefile for the linker.
+///
+/// File layout, all integers in host (little endian) byte order:
+///
+///   "VLTVTC01"                    Magic
+///   u64 headerBytes, header       Timescale and declarations, in VCD syntax
+///   Chunks, each:
+///     u64 firstTime, u64 lastTime, u64 rawBytes, u64 zBytes, zlib data
+///   u64 chunkCount
+///   chunkCount * (u64 firstTime, u64 lastTime, u64 chunkOffset)
+///   u64 indexOffset
+///   "VLTVTCIX"                    Magic
+///
+/// Uncompressed chunk data is a sequence of 32-bit words in the
+/// VerilatedTraceOffloadCommand encoding.
+///
+/// In flight recorder mode the compressed chunk records are instead
+/// appended to a memory ring, with m_fileOffset counting the bytes ever
+/// appended, and m_index trimmed to the chunks still wholly in the ring.
+/// ringDump() then writes the same layout from the ring to the file.
+///
+//=============================================================================
+
+// clang-format off
+
+#include "verilatedos.h"
+#include "verilated.h"
+#include "verilated_vtc_c.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <zlib.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
+# include <io.h>
+#else
+# include <unistd.h>
+#endif
+#ifndef _WIN32
+# include <sys/mman.h>
+#endif
+
+#ifndef O_LARGEFILE  // WIN32 headers omit this
+# define O_LARGEFILE 0
+#endif
+#ifndef O_NONBLOCK  // WIN32 headers omit this
+# define O_NONBLOCK 0
+#endif
+#ifndef O_CLOEXEC  // WIN32 headers omit this
+# define O_CLOEXEC 0
+#endif
+
+// clang-format on
+
+constexpr char VL_TRACE_VTC_MAGIC[] = "VLTVTC01";
+constexpr char VL_TRACE_VTC_INDEX_MAGIC[] = "VLTVTCIX";
+
+//=============================================================================
+// Specialization of the generics for this trace format
+
+#define VL_SUB_T VerilatedVtc
+#define VL_BUF_T VerilatedVtcBuffer
+#include "verilated_trace_imp.h"
+#undef VL_SUB_T
+#undef VL_BUF_T
+
+//=============================================================================
+//=============================================================================
+//=============================================================================
+// Opening/Closing
+
+VerilatedVtc::VerilatedVtc(void* filep) {}
+
+VerilatedVtc::~VerilatedVtc() { close(); }
+
+void VerilatedVtc::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (isOpen()) return;
+
+    m_filename = filename;  // "" is ok, as someone may overload open
+    if (m_ringBytes) {
+        // Flight recorder, the file is only created by ringDump()
+        ringAlloc();
+        if (!m_ringp) return;  // User code can check isOpen()
+        // Keep several chunks in the ring, so the window is never empty
+        m_chunkSize = std::min(m_chunkSize, m_ringBytes / 4);
+    } else {
+        m_fd = ::open(m_filename.c_str(),
+                      O_CREAT | O_WRONLY | O_TRUNC | O_LARGEFILE | O_NONBLOCK | O_CLOEXEC, 0666);
+        if (m_fd < 0) return;  // User code can check isOpen()
+    }
+    m_isOpen = true;
+    m_fileOffset = 0;
+    m_index.clear();
+    m_ringDumped = false;
+
+    // Scope and signal definitions
+    m_header = "$timescale "s + timeResStr() + " $end\n";
+    ++m_indent;
+    Super::traceInit();
+    --m_indent;
+
+    if (!m_ringp) writeHeader();
+
+    // Chunk buffer, with room for a full dump of the design before needing to grow
+    m_chunkWords = std::max<size_t>(m_chunkSize / sizeof(uint32_t), nextCode() * 2)
+                   + 4 * m_maxSignalWords;
+    m_chunkp.reset(new uint32_t[m_chunkWords]);
+    m_writep = m_chunkp.get();
+    m_growp = m_chunkp.get() + m_chunkWords - m_maxSignalWords;
+    m_timep = nullptr;
+    m_chunkEmpty = true;
+
+    constDump(true);  // First dump must contain the const signals
+    fullDump(true);  // First dump must be full
+}
+
+void VerilatedVtc::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    // This function is on the flush() call path
+    const VerilatedLockGuard lock{m_mutex};
+    if (!isOpen()) return;
+    Super::flushBase();
+    if (m_ringp) {
+        // Passing runs discard the ring without any file I/O
+        ringDumpOnError();
+        ringFree();
+    } else {
+        chunkFlush();
+        writeIndex(m_index, m_fileOffset);
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_isOpen = false;
+    m_chunkp.reset();
+    m_writep = m_growp = m_timep = nullptr;
+    Super::closeBase();
+}
+
+void VerilatedVtc::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (!isOpen()) return;
+    Super::flushBase();
+    if (m_ringp) {
+        // Flushes are also how $stop and $fatal report, so check for errors
+        ringDumpOnError();
+        return;
+    }
+    chunkFlush();
+    // Next chunk must be decodable on its own
+    constDump(true);
+    fullDump(true);
+}
+
+void VerilatedVtc::flightDump() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (!isOpen() || !m_ringp) return;
+    Super::flushBase();
+    ringDump();
+}
+
+//=============================================================================
+// File and chunk management
+
+void VerilatedVtc::writeBytes(const void* datap, size_t len) {
+    if (m_ringp) {
+        // Overwrites the oldest data, chunkFlush() then trims m_index
+        const unsigned char* rp = static_cast<const unsigned char*>(datap);
+        size_t pos = m_fileOffset % m_ringBytes;
+        for (size_t left = len; left;) {
+            const size_t n = std::min(left, m_ringBytes - pos);
+            std::memcpy(m_ringp + pos, rp, n);
+            rp += n;
+            left -= n;
+            pos = 0;
+        }
+    } else {
+        writeFile(datap, len);
+    }
+    m_fileOffset += len;
+}
+
+void VerilatedVtc::writeFile(const void* datap, size_t len) {
+    const char* wp = static_cast<const char*>(datap);
+    const char* const endp = wp + len;
+    while (wp < endp) {
+        errno = 0;
+        const ssize_t got = ::write(m_fd, wp, endp - wp);
+        if (got > 0) {
+            wp += got;
+        } else if (VL_UNCOVERABLE(got < 0)) {
+            if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
+                // LCOV_EXCL_START
+                // write failed, presume error (perhaps out of disk space)
+                const std::string msg = "VerilatedVtc::writeFile: "s + std::strerror(errno);
+                VL_FATAL_MT("", 0, "", msg.c_str());
+                break;
+                // LCOV_EXCL_STOP
+            }
+        }
+    }
+}
+
+void VerilatedVtc::writeHeader() {
+    writeFile(VL_TRACE_VTC_MAGIC, 8);
+    writeFileU64(m_header.size());
+    writeFile(m_header.data(), m_header.size());
+    m_fileOffset = 16 + m_header.size();
+}
+
+void VerilatedVtc::writeIndex(const std::deque<IndexEntry>& index, uint64_t indexOffset) {
+    // Write the index, then the footer locating it
+    writeFileU64(index.size());
+    for (const IndexEntry& entry : index) {
+        writeFileU64(entry.m_firstTime);
+        writeFileU64(entry.m_lastTime);
+        writeFileU64(entry.m_offset);
+    }
+    writeFileU64(indexOffset);
+    writeFile(VL_TRACE_VTC_INDEX_MAGIC, 8);
+}
+
+void VerilatedVtc::chunkGrow(uint32_t*& writep) {
+    // Called from a trace buffer, whose write pointer is the live one
+    const size_t usedWords = writep - m_chunkp.get();
+    const size_t timeWords = m_timep ? m_timep - m_chunkp.get() : 0;
+    const size_t newWords = m_chunkWords * 2;
+    uint32_t* const newp = new uint32_t[newWords];
+    std::memcpy(newp, m_chunkp.get(), usedWords * sizeof(uint32_t));
+    m_chunkp.reset(newp);
+    m_chunkWords = newWords;
+    m_growp = m_chunkp.get() + m_chunkWords - m_maxSignalWords;
+    if (m_timep) m_timep = m_chunkp.get() + timeWords;
+    writep = m_chunkp.get() + usedWords;
+}
+
+void VerilatedVtc::chunkFlush() {
+    if (m_chunkEmpty) return;
+    const uLong rawBytes = static_cast<uLong>((m_writep - m_chunkp.get()) * sizeof(uint32_t));
+    uLongf zBytes = compressBound(rawBytes);
+    if (m_zbuf.size() < zBytes) m_zbuf.resize(zBytes);
+    // Favor speed, as this runs on the simulation thread
+    const int status = compress2(m_zbuf.data(), &zBytes,
+                                 reinterpret_cast<const Bytef*>(m_chunkp.get()), rawBytes,
+                                 Z_BEST_SPEED);
+    if (VL_UNCOVERABLE(status != Z_OK)) {
+        VL_FATAL_MT("", 0, "", "VerilatedVtc::chunkFlush: compression failed");  // LCOV_EXCL_LINE
+    }
+    m_index.push_back({m_firstTime, m_lastTime, m_fileOffset});
+    writeU64(m_firstTime);
+    writeU64(m_lastTime);
+    writeU64(rawBytes);
+    writeU64(zBytes);
+    writeBytes(m_zbuf.data(), zBytes);
+    if (m_ringp) {
+        // Forget chunks partly overwritten in the ring
+        while (!m_index.empty() && m_fileOffset - m_index.front().m_offset > m_ringBytes) {
+            m_index.pop_front();
+        }
+    }
+    // Reset for next chunk
+    m_writep = m_chunkp.get();
+    m_timep = nullptr;
+    m_chunkEmpty = true;
+}
+
+//=============================================================================
+// Flight recorder
+
+void VerilatedVtc::ringAlloc() {
+#ifdef _WIN32
+    m_ringp = new unsigned char[m_ringBytes];
+#else
+    // Pages are only committed once the ring first wraps over them
+    void* const mapp = ::mmap(nullptr, m_ringBytes, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    m_ringp = (mapp == MAP_FAILED) ? nullptr : static_cast<unsigned char*>(mapp);
+#endif
+}
+
+void VerilatedVtc::ringFree() {
+#ifdef _WIN32
+    delete[] m_ringp;
+#else
+    ::munmap(m_ringp, m_ringBytes);
+#endif
+    m_ringp = nullptr;
+}
+
+void VerilatedVtc::ringDumpOnError() {
+    if (m_ringDumped || !Verilated::threadContextp()->gotError()) return;
+    m_ringDumped = true;  // Later flushes during the same failure must not rewrite it
+    ringDump();
+}
+
+void VerilatedVtc::ringDump() {
+    // End the current chunk, so the window extends up to the latest time
+    chunkFlush();
+    constDump(true);
+    fullDump(true);
+
+    m_fd = ::open(m_filename.c_str(), O_CREAT | O_WRONLY | O_TRUNC | O_LARGEFILE | O_CLOEXEC,
+                  0666);
+    if (m_fd < 0) {
+        VL_PRINTF_MT("%%Warning: VerilatedVtc::flightDump: Can't open '%s'\n",
+                     m_filename.c_str());
+        return;
+    }
+    // Writing uses m_fileOffset as the file offset, so save the ring's
+    const uint64_t ringOffset = m_fileOffset;
+    writeHeader();
+    std::deque<IndexEntry> index;
+    for (size_t i = 0; i < m_index.size(); ++i) {
+        const uint64_t start = m_index[i].m_offset;
+        const uint64_t end = (i + 1 < m_index.size()) ? m_index[i + 1].m_offset : ringOffset;
+        index.push_back({m_index[i].m_firstTime, m_index[i].m_lastTime, m_fileOffset});
+        size_t pos = start % m_ringBytes;
+        for (size_t left = end - start; left;) {
+            const size_t n = std::min<size_t>(left, m_ringBytes - pos);
+            writeFile(m_ringp + pos, n);
+            m_fileOffset += n;
+            left -= n;
+            pos = 0;
+        }
+    }
+    writeIndex(index, m_fileOffset);
+    ::close(m_fd);
+    m_fd = -1;
+    m_fileOffset = ringOffset;
+}
+
+//=============================================================================
+// Dumping
+
+bool VerilatedVtc::preDump() {
+    if (!isOpen()) return false;
+    if (!m_chunkEmpty
+        && static_cast<size_t>(m_writep - m_chunkp.get()) * sizeof(uint32_t) >= m_chunkSize) {
+        chunkFlush();
+        // Each chunk starts with a full dump, so can be decoded on its own
+        constDump(true);
+        fullDump(true);
+    }
+    return true;
+}
+
+void VerilatedVtc::emitTimeChange(uint64_t timeui) {
+    // If nothing changed since the last time point, overwrite it
+    if (m_timep && m_timep + 3 == m_writep) m_writep = m_timep;
+    if (VL_UNLIKELY(m_writep > m_growp)) chunkGrow(m_writep);
+    m_timep = m_writep;
+    m_writep[0] = VerilatedTraceOffloadCommand::TIME_CHANGE;
+    m_writep[1] = static_cast<uint32_t>(timeui >> 32ULL);
+    m_writep[2] = static_cast<uint32_t>(timeui);
+    m_writep += 3;
+    if (m_timep == m_chunkp.get()) m_firstTime = timeui;
+    m_lastTime = timeui;
+    m_chunkEmpty = false;
+}
+
+//=============================================================================
+// Definitions
+
+void VerilatedVtc::printIndent(int level_change) {
+    if (level_change < 0) m_indent += level_change;
+    m_header.append(m_indent, ' ');
+    if (level_change > 0) m_indent += level_change;
+}
+
+void VerilatedVtc::pushPrefix(const std::string& name, VerilatedTracePrefixType type) {
+    assert(!m_prefixStack.empty());  // Constructor makes an empty entry
+    // Same scoping rules as VerilatedVcd, so converted files match
+    const std::string prevPrefix = m_prefixStack.back().first;
+    if ((name == "$rootio" && !prevPrefix.empty()) || name.empty()) {
+        m_prefixStack.emplace_back(prevPrefix, VerilatedTracePrefixType::ROOTIO_WRAPPER);
+        return;
+    }
+
+    const std::string newPrefix = prevPrefix + name;
+    bool properScope = false;
+    switch (type) {
+    case VerilatedTracePrefixType::SCOPE_MODULE:
+    case VerilatedTracePrefixType::SCOPE_INTERFACE:
+    case VerilatedTracePrefixType::STRUCT_PACKED:
+    case VerilatedTracePrefixType::STRUCT_UNPACKED:
+    case VerilatedTracePrefixType::UNION_PACKED: {
+        properScope = true;
+        break;
+    }
+    default: break;
+    }
+    if (properScope) {
+        printIndent(1);
+        m_header += "$scope module " + lastWord(newPrefix) + " $end\n";
+    }
+    m_prefixStack.emplace_back(newPrefix + (properScope ? " " : ""), type);
+}
+
+void VerilatedVtc::popPrefix() {
+    assert(!m_prefixStack.empty());
+    switch (m_prefixStack.back().second) {
+    case VerilatedTracePrefixType::SCOPE_MODULE:
+    case VerilatedTracePrefixType::SCOPE_INTERFACE:
+    case VerilatedTracePrefixType::STRUCT_PACKED:
+    case VerilatedTracePrefixType::STRUCT_UNPACKED:
+    case VerilatedTracePrefixType::UNION_PACKED:
+        printIndent(-1);
+        m_header += "$upscope $end\n";
+        break;
+    default: break;
+    }
+    m_prefixStack.pop_back();
+    assert(!m_prefixStack.empty());  // Always one left, the constructor's initial one
+}
+
+void VerilatedVtc::declare(uint32_t code, const char* name, const char* wirep, bool array,
+                           int arraynum, bool bussed, int msb, int lsb) {
+    const int bits = ((msb > lsb) ? (msb - lsb) : (lsb - msb)) + 1;
+
+    const std::string hierarchicalName = m_prefixStack.back().first + name;
+
+    const bool enabled = Super::declCode(code, hierarchicalName, bits);
+
+    // Keep upper bound on words a single signal can emit into the chunk
+    m_maxSignalWords = std::max<size_t>(m_maxSignalWords, 4 + VL_WORDS_I(bits));
+
+    if (!enabled) return;
+
+    // Identifier code, as would be used by VerilatedVcd
+    std::string vcdCode;
+    uint32_t codeEnc = code;
+    do {
+        vcdCode += static_cast<char>('!' + codeEnc % 94);
+        codeEnc /= 94;
+    } while (codeEnc--);
+
+    // Assemble the declaration
+    std::string decl = "$var ";
+    decl += wirep;
+    decl += ' ';
+    decl += std::to_string(bits);
+    decl += ' ';
+    decl += vcdCode;
+    decl += ' ';
+    decl += lastWord(hierarchicalName);
+    if (array) {
+        decl += '[';
+        decl += std::to_string(arraynum);
+        decl += ']';
+    }
+    if (bussed) {
+        decl += " [";
+        decl += std::to_string(msb);
+        decl += ':';
+        decl += std::to_string(lsb);
+        decl += ']';
+    }
+    decl += " $end\n";
+    printIndent(0);
+    m_header += decl;
+}
+
+void VerilatedVtc::declEvent(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                             VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                             VerilatedTraceSigType, bool array, int arraynum) {
+    declare(code, name, "event", array, arraynum, false, 0, 0);
+}
+void VerilatedVtc::declBit(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                           VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                           VerilatedTraceSigType, bool array, int arraynum) {
+    declare(code, name, "wire", array, arraynum, false, 0, 0);
+}
+void VerilatedVtc::declBus(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                           VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                           VerilatedTraceSigType, bool array, int arraynum, int msb, int lsb) {
+    declare(code, name, "wire", array, arraynum, true, msb, lsb);
+}
+void VerilatedVtc::declQuad(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                            VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                            VerilatedTraceSigType, bool array, int arraynum, int msb, int lsb) {
+    declare(code, name, "wire", array, arraynum, true, msb, lsb);
+}
+void VerilatedVtc::declArray(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                             VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                             VerilatedTraceSigType, bool array, int arraynum, int msb, int lsb) {
+    declare(code, name, "wire", array, arraynum, true, msb, lsb);
+}
+void VerilatedVtc::declDouble(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                              VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                              VerilatedTraceSigType, bool array, int arraynum) {
+    declare(code, name, "real", array, arraynum, false, 63, 0);
+}
+
+//=============================================================================
+// Get/commit trace buffer
+
+VerilatedVtc::Buffer* VerilatedVtc::getTraceBuffer(uint32_t fidx) { return new Buffer{*this}; }
+
+void VerilatedVtc::commitTraceBuffer(VerilatedVtc::Buffer* bufp) {
+    m_writep = bufp->m_writep;
+    delete bufp;
+}
+
+//=============================================================================
+//=============================================================================
+//=============================================================================
+// VerilatedVtcBuffer implementation
+
+//=============================================================================
+// emit* trace routines
+
+// Note: emit* are only ever called from one place (full* in
+// verilated_trace_imp.h, which is included in this file at the top),
+// so always inline them.
+
+VL_ATTR_ALWINLINE
+void VerilatedVtcBuffer::emitEvent(uint32_t code) {
+    checkRoom();
+    m_writep[0] = VerilatedTraceOffloadCommand::CHG_EVENT;
+    m_writep[1] = code;
+    m_writep += 2;
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVtcBuffer::emitBit(uint32_t code, CData newval) {
+    checkRoom();
+    m_writep[0] = VerilatedTraceOffloadCommand::CHG_BIT_0 | newval;
+    m_writep[1] = code;
+    m_writep += 2;
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVtcBuffer::emitCData(uint32_t code, CData newval, int bits) {
+    checkRoom();
+    m_writep[0] = (bits << 4) | VerilatedTraceOffloadCommand::CHG_CDATA;
+    m_writep[1] = code;
+    m_writep[2] = newval;
+    m_writep += 3;
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVtcBuffer::emitSData(uint32_t code, SData newval, int bits) {
+    checkRoom();
+    m_writep[0] = (bits << 4) | VerilatedTraceOffloadCommand::CHG_SDATA;
+    m_writep[1] = code;
+    m_writep[2] = newval;
+    m_writep += 3;
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVtcBuffer::emitIData(uint32_t code, IData newval, int bits) {
+    checkRoom();
+    m_writep[0] = (bits << 4) | VerilatedTraceOffloadCommand::CHG_IDATA;
+    m_writep[1] = code;
+    m_writep[2] = newval;
+    m_writep += 3;
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVtcBuffer::emitQData(uint32_t code, QData newval, int bits) {
+    checkRoom();
+    m_writep[0] = (bits << 4) | VerilatedTraceOffloadCommand::CHG_QDATA;
+    m_writep[1] = code;
+    std::memcpy(m_writep + 2, &newval, sizeof(newval));
+    m_writep += 4;
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVtcBuffer::emitWData(uint32_t code, const WData* newvalp, int bits) {
+    checkRoom();
+    const int words = VL_WORDS_I(bits);
+    m_writep[0] = (bits << 4) | VerilatedTraceOffloadCommand::CHG_WDATA;
+    m_writep[1] = code;
+    std::memcpy(m_writep + 2, newvalp, words * sizeof(EData));
+    m_writep += 2 + words;
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVtcBuffer::emitDouble(uint32_t code, double newval) {
+    checkRoom();
+    m_writep[0] = VerilatedTraceOffloadCommand::CHG_DOUBLE;
+    m_writep[1] = code;
+    std::memcpy(m_writep + 2, &newval, sizeof(newval));
+    m_writep += 4;
+}
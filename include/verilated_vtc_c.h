@@ -0,0 +1,341 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2001-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated tracing in VTC format header
+///
+/// User wrapper code should use this header when creating VTC traces.
+///
+/// VTC is a compressed, streaming, change-only trace format. Value changes
+/// are recorded in the same binary command encoding as used by the offload
+/// trace buffers, split into zlib compressed chunks covering a window of
+/// time, followed by an index from time to chunk. Each chunk starts with a
+/// full dump, so can be decoded on its own. Use verilator_vtc2vcd to
+/// convert to VCD.
+///
+/// In flight recorder mode, chunks are kept in a fixed size memory ring
+/// instead of being written, and only the most recent window is written to
+/// the file, when flightDump() is called, or on an error or $fatal.
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_VTC_C_H_
+#define VERILATOR_VERILATED_VTC_C_H_
+
+#include "verilated.h"
+#include "verilated_trace.h"
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+class VerilatedVtcBuffer;
+
+//=============================================================================
+// VerilatedVtc
+// Base class to create a Verilator VTC dump
+// This is an internally used class - see VerilatedVtcC for what to call from applications
+
+class VerilatedVtc VL_NOT_FINAL : public VerilatedTrace<VerilatedVtc, VerilatedVtcBuffer> {
+public:
+    using Super = VerilatedTrace<VerilatedVtc, VerilatedVtcBuffer>;
+
+private:
+    friend VerilatedVtcBuffer;  // Give the buffer access to the private bits
+
+    //=========================================================================
+    // VTC-specific internals
+
+    struct IndexEntry final {
+        uint64_t m_firstTime;  // First time point in chunk
+        uint64_t m_lastTime;  // Last time point in chunk
+        uint64_t m_offset;  // File (or ring stream) offset of chunk header
+    };
+
+    int m_fd = -1;  // File descriptor we're writing to
+    bool m_isOpen = false;  // True indicates open file
+    std::string m_filename;  // Filename we're writing to (if open)
+    uint64_t m_fileOffset = 0;  // Bytes written to file (or ring) so far
+    size_t m_chunkSize = 1024 * 1024;  // Uncompressed bytes after which a chunk is closed
+
+    size_t m_ringBytes = 0;  // Flight recorder ring size, 0 to write file directly
+    unsigned char* m_ringp = nullptr;  // Flight recorder ring, when open
+    bool m_ringDumped = false;  // Flight recorder written due to an error
+
+    std::string m_header;  // Declaration header, in VCD syntax
+    int m_indent = 0;  // Indentation depth of header
+    // Stack of declared scopes combined names
+    std::vector<std::pair<std::string, VerilatedTracePrefixType>> m_prefixStack{
+        {"", VerilatedTracePrefixType::SCOPE_MODULE}};
+
+    std::unique_ptr<uint32_t[]> m_chunkp;  // Current uncompressed chunk
+    size_t m_chunkWords = 0;  // Allocated size of m_chunkp
+    uint32_t* m_writep = nullptr;  // Write pointer into current chunk
+    uint32_t* m_growp = nullptr;  // Grow chunk when m_writep passes this point
+    uint32_t* m_timep = nullptr;  // Start of last TIME_CHANGE, to overwrite if no changes
+    size_t m_maxSignalWords = 4;  // Upper bound on words a single signal can emit
+    bool m_chunkEmpty = true;  // Current chunk has no time points yet
+    uint64_t m_firstTime = 0;  // First time point in current chunk
+    uint64_t m_lastTime = 0;  // Last time point in current chunk
+    std::deque<IndexEntry> m_index;  // Time to chunk index
+    std::vector<unsigned char> m_zbuf;  // Compression output buffer
+
+    // METHODS
+    void writeBytes(const void* datap, size_t len);
+    void writeFile(const void* datap, size_t len);
+    void writeU64(uint64_t value) { writeBytes(&value, sizeof(value)); }
+    void writeFileU64(uint64_t value) { writeFile(&value, sizeof(value)); }
+    void writeHeader();
+    void writeIndex(const std::deque<IndexEntry>& index, uint64_t indexOffset);
+    void chunkGrow(uint32_t*& writep);
+    void chunkFlush();
+    bool preDump();
+    void ringAlloc();
+    void ringFree();
+    void ringDump();
+    void ringDumpOnError();
+
+    void printIndent(int level_change);
+    void declare(uint32_t code, const char* name, const char* wirep, bool array, int arraynum,
+                 bool bussed, int msb, int lsb);
+
+    // CONSTRUCTORS
+    VL_UNCOPYABLE(VerilatedVtc);
+
+protected:
+    //=========================================================================
+    // Implementation of VerilatedTrace interface
+
+    // Called when the trace moves forward to a new time point
+    void emitTimeChange(uint64_t timeui) override;
+
+    // Hooks called from VerilatedTrace
+    bool preFullDump() override { return preDump(); }
+    bool preChangeDump() override { return preDump(); }
+
+    // Trace buffer management
+    Buffer* getTraceBuffer(uint32_t fidx) override;
+    void commitTraceBuffer(Buffer*) override;
+
+    // Configure sub-class
+    void configure(const VerilatedTraceConfig&) override {}
+
+public:
+    //=========================================================================
+    // External interface to client code
+
+    // CONSTRUCTOR
+    explicit VerilatedVtc(void* filep = nullptr);
+    ~VerilatedVtc();
+
+    // ACCESSORS
+    // Set size in uncompressed bytes after which a new chunk is started
+    void chunkSize(size_t size) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        m_chunkSize = size;
+    }
+    // Enable flight recorder mode, keeping only about the last 'bytes' of
+    // compressed trace in memory. Must be called before open().
+    void flightRecorder(size_t bytes) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const VerilatedLockGuard lock{m_mutex};
+        if (!isOpen()) m_ringBytes = bytes;
+    }
+
+    // METHODS - All must be thread safe
+    // Open the file; call isOpen() to see if errors
+    void open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Close the file
+    void close() VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Flush any remaining data to this file
+    void flush() VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Return if file is open
+    bool isOpen() const VL_MT_SAFE { return m_isOpen; }
+    // In flight recorder mode, write the recorded window to the file
+    void flightDump() VL_MT_SAFE_EXCLUDES(m_mutex);
+
+    //=========================================================================
+    // Internal interface to Verilator generated code
+
+    void pushPrefix(const std::string&, VerilatedTracePrefixType);
+    void popPrefix();
+
+    void declEvent(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                   VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                   bool array, int arraynum);
+    void declBit(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                 VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                 bool array, int arraynum);
+    void declBus(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                 VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                 bool array, int arraynum, int msb, int lsb);
+    void declQuad(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                  VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                  bool array, int arraynum, int msb, int lsb);
+    void declArray(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                   VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                   bool array, int arraynum, int msb, int lsb);
+    void declDouble(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                    VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                    bool array, int arraynum);
+};
+
+#ifndef DOXYGEN
+// Declare specialization here as it's used in VerilatedVtcC just below
+template <>
+void VerilatedVtc::Super::dump(uint64_t time);
+template <>
+void VerilatedVtc::Super::set_time_unit(const char* unitp);
+template <>
+void VerilatedVtc::Super::set_time_unit(const std::string& unit);
+template <>
+void VerilatedVtc::Super::set_time_resolution(const char* unitp);
+template <>
+void VerilatedVtc::Super::set_time_resolution(const std::string& unit);
+template <>
+void VerilatedVtc::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedVtc::Super::enableScope(const std::string& hier, bool enable);
+#endif  // DOXYGEN
+
+//=============================================================================
+// VerilatedVtcBuffer
+
+class VerilatedVtcBuffer VL_NOT_FINAL {
+    // Give the trace file and sub-classes access to the private bits
+    friend VerilatedVtc;
+    friend VerilatedVtc::Super;
+    friend VerilatedVtc::Buffer;
+    friend VerilatedVtc::OffloadBuffer;
+
+    VerilatedVtc& m_owner;  // Trace file owning this buffer. Required by subclasses.
+
+    // Write pointer into the owner's chunk, written back in 'commitTraceBuffer'
+    uint32_t* m_writep = m_owner.m_writep;
+
+    // CONSTRUCTORS
+    explicit VerilatedVtcBuffer(VerilatedVtc& owner)
+        : m_owner{owner} {}
+    virtual ~VerilatedVtcBuffer() = default;
+
+    // Make room for the next signal
+    VL_ATTR_ALWINLINE void checkRoom() {
+        if (VL_UNLIKELY(m_writep > m_owner.m_growp)) m_owner.chunkGrow(m_writep);
+    }
+
+    //=========================================================================
+    // Implementation of VerilatedTraceBuffer interface
+    // Implementations of duck-typed methods for VerilatedTraceBuffer. These are
+    // called from only one place (the full* methods), so always inline them.
+    VL_ATTR_ALWINLINE void emitEvent(uint32_t code);
+    VL_ATTR_ALWINLINE void emitBit(uint32_t code, CData newval);
+    VL_ATTR_ALWINLINE void emitCData(uint32_t code, CData newval, int bits);
+    VL_ATTR_ALWINLINE void emitSData(uint32_t code, SData newval, int bits);
+    VL_ATTR_ALWINLINE void emitIData(uint32_t code, IData newval, int bits);
+    VL_ATTR_ALWINLINE void emitQData(uint32_t code, QData newval, int bits);
+    VL_ATTR_ALWINLINE void emitWData(uint32_t code, const WData* newvalp, int bits);
+    VL_ATTR_ALWINLINE void emitDouble(uint32_t code, double newval);
+};
+
+//=============================================================================
+// VerilatedVtcC
+// Class representing a VTC dump file in C standalone (no SystemC)
+// simulations. Also derived for use in SystemC simulations.
+
+class VerilatedVtcC VL_NOT_FINAL : public VerilatedTraceBaseC {
+    VerilatedVtc m_sptrace;  // Trace file being created
+
+    // CONSTRUCTORS
+    VL_UNCOPYABLE(VerilatedVtcC);
+
+public:
+    // Construct the dump. Optional argument is ignored
+    explicit VerilatedVtcC(void* filep = nullptr)
+        : m_sptrace{filep} {}
+    // Destruct, flush, and close the dump
+    virtual ~VerilatedVtcC() { close(); }
+
+    // METHODS - User called
+
+    // Return if file is open
+    bool isOpen() const override VL_MT_SAFE { return m_sptrace.isOpen(); }
+    // Open a new VTC file
+    // This includes a complete header dump each time it is called,
+    // just as if this object was deleted and reconstructed.
+    virtual void open(const char* filename) VL_MT_SAFE { m_sptrace.open(filename); }
+    // Set size in uncompressed bytes after which a new chunk is started.
+    // Smaller chunks give finer grained random access, but compress less well.
+    void chunkSize(size_t size) VL_MT_SAFE { m_sptrace.chunkSize(size); }
+    // Enable flight recorder mode, must be called before open(). Only about
+    // the last 'bytes' of compressed trace are kept, in memory, and the file
+    // is only written by flightDump(), or when an error or $fatal occurs.
+    void flightRecorder(size_t bytes) VL_MT_SAFE { m_sptrace.flightRecorder(bytes); }
+    // In flight recorder mode, write the recorded window to the file,
+    // replacing any earlier flightDump()
+    void flightDump() VL_MT_SAFE { m_sptrace.flightDump(); }
+
+    // Close dump
+    void close() VL_MT_SAFE {
+        m_sptrace.close();
+        modelConnected(false);
+    }
+    // Flush dump
+    void flush() VL_MT_SAFE { m_sptrace.flush(); }
+    // Write one cycle of dump data
+    // Call with the current context's time just after eval'ed,
+    // e.g. ->dump(contextp->time())
+    void dump(uint64_t timeui) VL_MT_SAFE { m_sptrace.dump(timeui); }
+    // Write one cycle of dump data - backward compatible and to reduce
+    // conversion warnings.  It's better to use a uint64_t time instead.
+    void dump(double timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+    void dump(uint32_t timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+    void dump(int timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+
+    // METHODS - Internal/backward compatible
+    // \protectedsection
+
+    // Set time units (s/ms, defaults to ns)
+    // Users should not need to call this, as for Verilated models, these
+    // propagate from the Verilated default timeunit
+    void set_time_unit(const char* unit) VL_MT_SAFE { m_sptrace.set_time_unit(unit); }
+    void set_time_unit(const std::string& unit) VL_MT_SAFE { m_sptrace.set_time_unit(unit); }
+    // Set time resolution (s/ms, defaults to ns)
+    // Users should not need to call this, as for Verilated models, these
+    // propagate from the Verilated default timeprecision
+    void set_time_resolution(const char* unit) VL_MT_SAFE { m_sptrace.set_time_resolution(unit); }
+    void set_time_resolution(const std::string& unit) VL_MT_SAFE {
+        m_sptrace.set_time_resolution(unit);
+    }
+    // Set variables to dump, using $dumpvars format
+    // If level = 0, dump everything and hier is then ignored
+    void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
+        m_sptrace.dumpvars(level, hier);
+    }
+    // Pause or resume tracing of a scope and those under it, e.g. "top.cpu".
+    // May be called while tracing, skipping the work of tracing the scope.
+    void enableScope(const std::string& hier, bool enable) VL_MT_SAFE {
+        m_sptrace.enableScope(hier, enable);
+    }
+    // Only dump on every n-th call to dump(), for sampling slowly changing
+    // signals; each dump shows the values at that time
+    void dumpDecimate(uint32_t n) VL_MT_SAFE { m_sptrace.dumpDecimate(n); }
+    // Only dump when cb(userp) returns true, nullptr = always
+    void dumpTrigger(bool (*cb)(void*), void* userp) VL_MT_SAFE {
+        m_sptrace.dumpTrigger(cb, userp);
+    }
+
+    // Internal class access
+    VerilatedVtc* spTrace() { return &m_sptrace; }
+};
+
+#endif  // guard
@@ -0,0 +1,112 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Size class allocator for small objects
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+//
+// AstNode and DfgVertex instances are allocated here, unless VL_LEAK_CHECKS
+// is defined, as then they are tracked individually for valgrind et al.
+//
+// Objects are carved from large chunks in size classes of V3Allocator::GRANULE
+// bytes.  Freed objects are kept on a per size class free list for reuse, so
+// chunks are never returned to the system.  The free lists are per thread,
+// so no locking is needed; an object may be freed by a different thread than
+// the one that allocated it.
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3ALLOCATOR_H_
+#define VERILATOR_V3ALLOCATOR_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+//============================================================================
+
+class V3Allocator final {
+public:
+    static constexpr size_t GRANULE = 8;  // Size class step, and alignment of objects
+    static constexpr size_t MAX_SIZE = 512;  // Larger objects use ::operator new
+
+private:
+    static constexpr size_t NUM_CLASSES = MAX_SIZE / GRANULE;
+    static constexpr size_t CHUNK_SIZE = 256 * 1024;  // Bytes allocated from system at once
+
+    struct FreeItem final {
+        FreeItem* m_nextp;  // Next free object of same size class
+    };
+    // Trivial, so the thread_local needs no construction or destruction
+    struct State final {
+        FreeItem* m_freeps[NUM_CLASSES];  // Free lists, by size class
+        char* m_bumpp;  // Next unused byte in current chunk
+        char* m_endp;  // End of current chunk
+    };
+
+    static State& state() VL_MT_SAFE {
+        static thread_local State t_state{};
+        return t_state;
+    }
+    static std::atomic<size_t>& chunkBytesRef() VL_MT_SAFE {
+        static std::atomic<size_t> s_chunkBytes{0};
+        return s_chunkBytes;
+    }
+    static size_t sizeClass(size_t size) { return (size + GRANULE - 1) / GRANULE - 1; }
+    static void* allocateNewChunk(State& s, size_t bytes) {
+        // Remainder of old chunk is lost, it is less than MAX_SIZE bytes
+        chunkBytesRef() += CHUNK_SIZE;
+        s.m_bumpp = static_cast<char*>(::operator new(CHUNK_SIZE));
+        s.m_endp = s.m_bumpp + CHUNK_SIZE;
+        void* const objp = s.m_bumpp;
+        s.m_bumpp += bytes;
+        return objp;
+    }
+
+public:
+    // Bytes allocated from the system so far, including objects since freed
+    static size_t chunkBytes() VL_MT_SAFE { return chunkBytesRef().load(); }
+
+    static void* allocate(size_t size) VL_MT_SAFE {
+        if (VL_UNLIKELY(size > MAX_SIZE)) return ::operator new(size);
+        State& s = state();
+        const size_t cls = sizeClass(size);
+        if (FreeItem* const itemp = s.m_freeps[cls]) {
+            s.m_freeps[cls] = itemp->m_nextp;
+            return itemp;
+        }
+        const size_t bytes = (cls + 1) * GRANULE;
+        if (VL_UNLIKELY(static_cast<size_t>(s.m_endp - s.m_bumpp) < bytes)) {
+            return allocateNewChunk(s, bytes);
+        }
+        void* const objp = s.m_bumpp;
+        s.m_bumpp += bytes;
+        return objp;
+    }
+    static void deallocate(void* objp, size_t size) VL_MT_SAFE {
+        if (!objp) return;
+        if (VL_UNLIKELY(size > MAX_SIZE)) {
+            ::operator delete(objp);
+            return;
+        }
+        State& s = state();
+        const size_t cls = sizeClass(size);
+        FreeItem* const itemp = static_cast<FreeItem*>(objp);
+        itemp->m_nextp = s.m_freeps[cls];
+        s.m_freeps[cls] = itemp;
+    }
+};
+
+#endif  // Guard
@@ -42,12 +42,14 @@ class AssertVisitor final : public VNVisitor {
     AstVar* m_monitorNumVarp = nullptr;  // $monitor number variable
     AstVar* m_monitorOffVarp = nullptr;  // $monitoroff variable
     unsigned m_modPastNum = 0;  // Module past numbering
+    unsigned m_modSeqNum = 0;  // Module sequence numbering
     unsigned m_modStrobeNum = 0;  // Module $strobe numbering
     const AstNodeProcedure* m_procedurep = nullptr;  // Current procedure
     VDouble0 m_statCover;  // Statistic tracking
     VDouble0 m_statAsNotImm;  // Statistic tracking
     VDouble0 m_statAsImm;  // Statistic tracking
     VDouble0 m_statAsFull;  // Statistic tracking
+    VDouble0 m_statSeq;  // Statistic tracking
     bool m_inSampled = false;  // True inside a sampled expression
 
     // METHODS
@@ -481,6 +483,95 @@ class AssertVisitor final : public VNVisitor {
         VL_DO_DANGLING(pushDeletep(nodep), nodep);
     }
 
+    //========== Sequences
+    // Flatten a tree of "a ##[min:max] b" into its boolean terms and the delays between them
+    void flattenSExpr(AstNodeExpr* nodep, std::vector<AstNodeExpr*>& terms,
+                      std::vector<std::pair<int, int>>& delays) {
+        AstSExpr* const sexprp = VN_CAST(nodep, SExpr);
+        if (!sexprp) {
+            terms.push_back(nodep->unlinkFrBack());
+            return;
+        }
+        if (sexprp->preExprp()) {
+            flattenSExpr(sexprp->preExprp(), terms, delays);
+        } else {
+            // "##N b" is "1 ##N b"
+            terms.push_back(new AstConst{sexprp->fileline(), AstConst::BitTrue{}});
+        }
+        int minDelay;
+        int maxDelay;
+        if (const AstRange* const rangep = VN_CAST(sexprp->delayp(), Range)) {
+            minDelay = rangep->loConst();
+            maxDelay = rangep->hiConst();
+        } else {
+            minDelay = maxDelay = VN_AS(sexprp->delayp(), Const)->toSInt();
+        }
+        if (minDelay < 0) {
+            sexprp->delayp()->v3error("## delay must be >= 0 (IEEE 1800-2023 16.7)");
+            minDelay = maxDelay = 0;
+        }
+        delays.emplace_back(minDelay, maxDelay);
+        flattenSExpr(sexprp->exprp(), terms, delays);
+    }
+    void visit(AstSExpr* nodep) override {
+        iterateChildren(nodep);
+        if (!nodep->sentreep()) return;  // Part of a larger sequence, flattened from its root
+        ++m_statSeq;
+        // The sequence is matched by a chain of stages, one per boolean term. Each delay
+        // between stages is a shift register holding one bit per clock of the delay window,
+        // so all attempts in flight are advanced together by a single shift per clock,
+        // rather than each attempt keeping its own state.
+        FileLine* const flp = nodep->fileline();
+        std::vector<AstNodeExpr*> terms;
+        std::vector<std::pair<int, int>> delays;
+        flattenSExpr(nodep, terms, delays);
+        AstAlways* const alwaysp = new AstAlways{flp, VAlwaysKwd::ALWAYS,
+                                                 nodep->sentreep()->unlinkFrBack(), nullptr};
+        m_modp->addStmtsp(alwaysp);
+        // Expression true when the sequence up to the current stage matches this clock
+        AstNodeExpr* matchp = terms[0];
+        for (size_t i = 1; i < terms.size(); ++i) {
+            const int minDelay = delays[i - 1].first;
+            const int maxDelay = delays[i - 1].second;
+            AstNodeExpr* delayedp = nullptr;
+            if (maxDelay > 0) {
+                // Bit n of the shift register is set if the prior stage matched n+1 clocks ago
+                AstVar* const shiftp = new AstVar{
+                    flp, VVarType::MODULETEMP, "_Vseq_" + cvtToStr(m_modSeqNum++),
+                    nodep->findBitDType(maxDelay, maxDelay, VSigning::UNSIGNED)};
+                m_modp->addStmtsp(shiftp);
+                AstNodeExpr* inp
+                    = newSampledExpr(minDelay == 0 ? matchp->cloneTreePure(false) : matchp);
+                if (maxDelay > 1) {
+                    inp = new AstConcat{
+                        flp,
+                        new AstSel{flp, new AstVarRef{flp, shiftp, VAccess::READ}, 0,
+                                   maxDelay - 1},
+                        inp};
+                }
+                alwaysp->addStmtsp(
+                    new AstAssignDly{flp, new AstVarRef{flp, shiftp, VAccess::WRITE}, inp});
+                const int lsb = std::max(minDelay, 1) - 1;
+                delayedp = new AstSel{flp, new AstVarRef{flp, shiftp, VAccess::READ}, lsb,
+                                      maxDelay - lsb};
+                if (maxDelay - lsb > 1) delayedp = new AstRedOr{flp, delayedp};
+            }
+            if (minDelay == 0) {
+                if (delayedp) {
+                    delayedp = new AstLogOr{flp, matchp, delayedp};
+                    delayedp->dtypeSetBit();
+                } else {
+                    delayedp = matchp;
+                }
+            }
+            matchp = new AstLogAnd{flp, delayedp, terms[i]};
+            matchp->dtypeSetBit();
+        }
+        if (!alwaysp->stmtsp()) VL_DO_DANGLING(pushDeletep(alwaysp->unlinkFrBack()), alwaysp);
+        nodep->replaceWith(matchp);
+        VL_DO_DANGLING(pushDeletep(nodep), nodep);
+    }
+
     //========== Move $sampled down to read-only variables
     void visit(AstSampled* nodep) override {
         if (nodep->user1()) return;
@@ -690,9 +781,11 @@ class AssertVisitor final : public VNVisitor {
     void visit(AstNodeModule* nodep) override {
         VL_RESTORER(m_modp);
         VL_RESTORER(m_modPastNum);
+        VL_RESTORER(m_modSeqNum);
         VL_RESTORER(m_modStrobeNum);
         m_modp = nodep;
         m_modPastNum = 0;
+        m_modSeqNum = 0;
         m_modStrobeNum = 0;
         iterateChildren(nodep);
     }
@@ -719,6 +812,7 @@ public:
         V3Stats::addStat("Assertions, assert immediate statements", m_statAsImm);
         V3Stats::addStat("Assertions, cover statements", m_statCover);
         V3Stats::addStat("Assertions, full/parallel case", m_statAsFull);
+        V3Stats::addStat("Assertions, sequences", m_statSeq);
     }
 };
 
@@ -523,6 +523,24 @@ private:
         VL_DO_DANGLING(pushDeletep(nodep), nodep);
     }
 
+    void visit(AstSExpr* nodep) override {
+        if (nodep->sentreep()) return;  // Already processed
+        if (VN_IS(nodep->backp(), SExpr)) {
+            // Part of a larger sequence, which V3Assert flattens from its root
+            iterateChildren(nodep);
+            return;
+        }
+        if (!nodep->antecedent()) {
+            nodep->v3warn(E_UNSUPPORTED, "Unsupported: ## (in sequence expression) other than"
+                                         " as the antecedent of an implication");
+            nodep->replaceWith(nodep->exprp()->unlinkFrBack());
+            VL_DO_DANGLING(pushDeletep(nodep), nodep);
+            return;
+        }
+        iterateChildren(nodep);
+        nodep->sentreep(newSenTree(nodep));
+    }
+
     void visit(AstDefaultDisable* nodep) override {
         // Done with these
         VL_DO_DANGLING(pushDeletep(nodep->unlinkFrBack()), nodep);
@@ -0,0 +1,127 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Hash associative arrays whose order is not observed
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3AssocUnordered's Transformations:
+//
+// Associative arrays are VlAssocArray, an ordered map.  Where an array's
+// order can never be observed, it may instead be VlUnorderedAssocArray, a
+// hash map.  Arrays of the same C++ type may be assigned or passed to each
+// other, so the choice is made for each C++ type, not each variable.
+//
+// For each expression of associative array type:
+//      If it is only indexed, tested with exists(), deleted, sized,
+//      reduced without a 'with' clause, assigned, or passed to a function,
+//      the use does not observe the order.
+//      Otherwise (first/next, foreach, find, %p, randomize, etc.) it does.
+// For each associative array type, with integral or string keys:
+//      If no use of any array of the same C++ type observes the order,
+//      mark it unordered.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3AssocUnordered.h"
+
+#include "V3Stats.h"
+
+#include <unordered_set>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class AssocUnorderedVisitor final : public VNVisitorConst {
+    // STATE
+    const AstNode* m_parentp = nullptr;  // Parent of node being visited
+    std::unordered_set<std::string> m_orderedTypes;  // C++ types whose order is observed
+    VDouble0 m_statUnordered;  // Statistic tracking
+
+    // METHODS
+    static bool unorderedUse(const AstNodeExpr* nodep, const AstNode* parentp) {
+        // Return true if the parent's use of the array does not depend on its order
+        if (const AstCMethodHard* const cmethodp = VN_CAST(parentp, CMethodHard)) {
+            if (cmethodp->fromp() != nodep) return false;
+            const string& name = cmethodp->name();
+            if (name == "size" || name == "exists" || name == "erase" || name == "clear")
+                return true;
+            return !cmethodp->pinsp()
+                   && (name == "r_sum" || name == "r_product" || name == "r_and"
+                       || name == "r_or" || name == "r_xor");
+        }
+        if (const AstAssocSel* const selp = VN_CAST(parentp, AssocSel)) {
+            return selp->fromp() == nodep;
+        }
+        if (const AstSetAssoc* const setp = VN_CAST(parentp, SetAssoc)) {
+            return setp->lhsp() == nodep;
+        }
+        // Copies to or from the same type
+        return VN_IS(parentp, NodeAssign) || VN_IS(parentp, ConsAssoc)
+               || VN_IS(parentp, NodeCond) || VN_IS(parentp, NodeCCall)
+               || VN_IS(parentp, CReturn);
+    }
+    static bool hashableKey(const AstAssocArrayDType* dtypep) {
+        const AstNodeDType* const keyp = dtypep->keyDTypep()->skipRefToEnump();
+        const AstBasicDType* const basicp = VN_CAST(keyp, BasicDType);
+        if (!basicp) return false;
+        return basicp->isString() || (basicp->isIntegralOrPacked() && !keyp->isWide());
+    }
+
+    // VISITORS
+    void visit(AstNode* nodep) override {
+        if (const AstNodeExpr* const exprp = VN_CAST(nodep, NodeExpr)) {
+            const AstAssocArrayDType* const dtypep
+                = exprp->dtypep() ? VN_CAST(exprp->dtypep()->skipRefp(), AssocArrayDType)
+                                  : nullptr;
+            if (dtypep && !unorderedUse(exprp, m_parentp)) {
+                UINFO(9, "Ordered use " << m_parentp << " of " << exprp);
+                m_orderedTypes.emplace(dtypep->cType("", false, false));
+            }
+        }
+        VL_RESTORER(m_parentp);
+        m_parentp = nodep;
+        iterateChildrenConst(nodep);
+    }
+
+public:
+    // CONSTRUCTORS
+    explicit AssocUnorderedVisitor(AstNetlist* nodep) {
+        iterateConst(nodep);
+        // Compute all types before marking any, as marking changes nested types
+        std::vector<AstAssocArrayDType*> unorderedps;
+        nodep->foreach([&](AstAssocArrayDType* dtypep) {
+            if (hashableKey(dtypep) && !m_orderedTypes.count(dtypep->cType("", false, false))) {
+                unorderedps.push_back(dtypep);
+            }
+        });
+        for (AstAssocArrayDType* const dtypep : unorderedps) {
+            UINFO(4, "Unordered " << dtypep);
+            dtypep->unordered(true);
+            ++m_statUnordered;
+        }
+    }
+    ~AssocUnorderedVisitor() override {
+        V3Stats::addStat("Optimizations, Unordered associative array types", m_statUnordered);
+    }
+};
+
+//######################################################################
+// AssocUnordered class functions
+
+void V3AssocUnordered::assocUnorderedAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { AssocUnorderedVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("assocunordered", 0, dumpTreeEitherLevel() >= 3);
+}
@@ -42,6 +42,24 @@ uint32_t VNUser2InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
 uint32_t VNUser3InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
 uint32_t VNUser4InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
 
+#ifdef VL_AST_COMPACT
+std::unordered_map<const AstNode*, AstNode*>& AstNode::cloneMap() {
+    static thread_local std::unordered_map<const AstNode*, AstNode*> t_cloneMap;
+    return t_cloneMap;
+}
+void AstNode::cloneClearTree() {
+    s_cloneCntGbl++;
+    UASSERT_STATIC(s_cloneCntGbl, "Rollover");
+    std::unordered_map<const AstNode*, AstNode*>& map = cloneMap();
+    // Clearing costs the bucket count, so drop the table after a large clone
+    if (map.bucket_count() > 1024) {
+        std::unordered_map<const AstNode*, AstNode*>{}.swap(map);
+    } else {
+        map.clear();
+    }
+}
+#endif
+
 bool VNUser1InUse::s_userBusy = false;
 bool VNUser2InUse::s_userBusy = false;
 bool VNUser3InUse::s_userBusy = false;
@@ -949,6 +967,8 @@ void AstNode::deleteTree() {
 //======================================================================
 // Memory checks
 
+static_assert(alignof(AstNode) <= V3Allocator::GRANULE, "V3Allocator would misalign AstNode");
+
 #ifdef VL_LEAK_CHECKS
 void* AstNode::operator new(size_t size) {
     // Optimization note: Aligning to cache line is a loss, due to lost packing
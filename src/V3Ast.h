@@ -20,6 +20,7 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include "V3Allocator.h"
 #include "V3Broken.h"
 #include "V3Error.h"
 #include "V3FileLine.h"
@@ -36,6 +37,7 @@
 #include <map>
 #include <set>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -519,6 +521,7 @@ public:
         VAR_PUBLIC_FLAT,                // V3LinkParse moves to AstVar::sigPublic
         VAR_PUBLIC_FLAT_RD,             // V3LinkParse moves to AstVar::sigPublic
         VAR_PUBLIC_FLAT_RW,             // V3LinkParse moves to AstVar::sigPublic
+        VAR_PUBLIC_FLAT_RD_SAMPLED,     // V3LinkParse moves to AstVar::sigPublic
         VAR_ISOLATE_ASSIGNMENTS,        // V3LinkParse moves to AstVar::attrIsolateAssign
         VAR_SC_BV,                      // V3LinkParse moves to AstVar::attrScBv
         VAR_SFORMAT,                    // V3LinkParse moves to AstVar::attrSFormat
@@ -541,6 +544,7 @@ public:
             "TYPEID", "TYPENAME",
             "VAR_BASE", "VAR_CLOCK_ENABLE", "VAR_FORCEABLE", "VAR_PORT_DTYPE", "VAR_PUBLIC",
             "VAR_PUBLIC_FLAT", "VAR_PUBLIC_FLAT_RD", "VAR_PUBLIC_FLAT_RW",
+            "VAR_PUBLIC_FLAT_RD_SAMPLED",
             "VAR_ISOLATE_ASSIGNMENTS", "VAR_SC_BV", "VAR_SFORMAT", "VAR_CLOCKER",
             "VAR_NO_CLOCKER", "VAR_SPLIT_VAR"
         };
@@ -2079,7 +2083,9 @@ class AstNode VL_NOT_FINAL {
     static uint64_t s_editCntGbl;  // Global edit counter
     static uint64_t s_editCntLast;  // Last committed value of global edit counter
 
+#ifndef VL_AST_COMPACT
     AstNode* m_clonep = nullptr;  // Pointer to clone/source of node (only for *LAST* cloneTree())
+#endif
     static int s_cloneCntGbl;  // Count of which userp is set
 
     // This member ordering both allows 64 bit alignment and puts associated data together
@@ -2158,6 +2164,16 @@ protected:
     void addNOp4p(AstNode* newp) { if (newp) addOp4p(newp); }
     // clang-format on
 
+#ifdef VL_AST_COMPACT
+    // With VL_AST_COMPACT, clone pointers are held in a per-thread side table
+    // rather than in each node, as only nodes in the last cloneTree() have one
+    static std::unordered_map<const AstNode*, AstNode*>& cloneMap();
+    void clonep(AstNode* nodep) {
+        cloneMap()[this] = nodep;
+        m_cloneCnt = s_cloneCntGbl;
+    }
+    static void cloneClearTree();
+#else
     void clonep(AstNode* nodep) {
         m_clonep = nodep;
         m_cloneCnt = s_cloneCntGbl;
@@ -2166,6 +2182,7 @@ protected:
         s_cloneCntGbl++;
         UASSERT_STATIC(s_cloneCntGbl, "Rollover");
     }
+#endif
 
     // Use instead isSame(), this is for each Ast* class, and assumes node is of same type
     virtual bool sameNode(const AstNode*) const { return true; }
@@ -2185,7 +2202,16 @@ public:
     AstNode* op3p() const VL_MT_STABLE { return m_op3p; }
     AstNode* op4p() const VL_MT_STABLE { return m_op4p; }
     AstNodeDType* dtypep() const VL_MT_STABLE { return m_dtypep; }
+#ifdef VL_AST_COMPACT
+    AstNode* clonep() const {
+        if (m_cloneCnt != s_cloneCntGbl) return nullptr;
+        const auto& map = cloneMap();
+        const auto it = map.find(this);
+        return it == map.end() ? nullptr : it->second;
+    }
+#else
     AstNode* clonep() const { return ((m_cloneCnt == s_cloneCntGbl) ? m_clonep : nullptr); }
+#endif
     AstNode* firstAbovep() const {  // Returns nullptr when second or later in list
         return ((backp() && backp()->nextp() != this) ? backp() : nullptr);
     }
@@ -2211,6 +2237,9 @@ public:
 #ifdef VL_LEAK_CHECKS
     static void* operator new(size_t size);
     static void operator delete(void* obj, size_t size);
+#else
+    static void* operator new(size_t size) { return V3Allocator::allocate(size); }
+    static void operator delete(void* objp, size_t size) { V3Allocator::deallocate(objp, size); }
 #endif
 
     // CONSTANTS
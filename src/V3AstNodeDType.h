@@ -325,6 +325,7 @@ class AstAssocArrayDType final : public AstNodeDType {
     //
     // @astgen ptr := m_refDTypep : Optional[AstNodeDType]  // Elements of this type (post-width)
     // @astgen ptr := m_keyDTypep : Optional[AstNodeDType]  // Keys of this type (post-width)
+    bool m_unordered = false;  // Element order never observed, so may hash (V3AssocUnordered)
 public:
     AstAssocArrayDType(FileLine* fl, VFlagChildDType, AstNodeDType* dtp, AstNodeDType* keyDtp)
         : ASTGEN_SUPER_AssocArrayDType(fl) {
@@ -378,6 +379,8 @@ public:
         return m_keyDTypep ? m_keyDTypep : keyChildDTypep();
     }
     void keyDTypep(AstNodeDType* nodep) { m_keyDTypep = nodep; }
+    bool unordered() const { return m_unordered; }
+    void unordered(bool flag) { m_unordered = flag; }
     // METHODS
     AstBasicDType* basicp() const override VL_MT_STABLE { return nullptr; }
     int widthAlignBytes() const override { return subDTypep()->widthAlignBytes(); }
@@ -1414,6 +1417,8 @@ public:
     bool isAggregateType() const override { return true; }
     // Outer dimension comes first. The first element is this node.
     std::vector<AstUnpackArrayDType*> unpackDimensions();
+    // Uses VlSparseUnpacked storage, see --sparse-array-depth
+    bool isSparse() const VL_MT_STABLE;
     void isCompound(bool flag) { m_isCompound = flag; }
     bool isCompound() const override VL_MT_SAFE { return m_isCompound; }
     bool isIntegralOrPacked() const override { return false; }
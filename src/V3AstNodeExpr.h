@@ -1911,6 +1911,35 @@ public:
     int instrCount() const override { return widthInstrs(); }
     bool sameNode(const AstNode* /*samep*/) const override { return true; }
 };
+class AstSExpr final : public AstNodeExpr {
+    // Sequence expression with cycle delay "preExprp ##delayp exprp"
+    // Delay is AstConst, or AstRange for ##[min:max]
+    // @astgen op1 := preExprp : Optional[AstNodeExpr]
+    // @astgen op2 := delayp : AstNode
+    // @astgen op3 := exprp : AstNodeExpr
+    // @astgen op4 := sentreep : Optional[AstSenTree]
+    bool m_antecedent = false;  // Is the antecedent of an implication
+public:
+    AstSExpr(FileLine* fl, AstNodeExpr* preExprp, AstNode* delayp, AstNodeExpr* exprp)
+        : ASTGEN_SUPER_SExpr(fl) {
+        this->preExprp(preExprp);
+        this->delayp(delayp);
+        this->exprp(exprp);
+    }
+    ASTGEN_MEMBERS_AstSExpr;
+    void dump(std::ostream& str) const override;
+    void dumpJson(std::ostream& str) const override;
+    string emitVerilog() override { V3ERROR_NA_RETURN(""); }
+    string emitC() override { V3ERROR_NA_RETURN(""); }
+    string emitSimpleOperator() override { V3ERROR_NA_RETURN(""); }
+    bool cleanOut() const override { V3ERROR_NA_RETURN(""); }
+    int instrCount() const override { return widthInstrs(); }
+    bool sameNode(const AstNode* samep) const override {
+        return m_antecedent == VN_DBG_AS(samep, SExpr)->m_antecedent;
+    }
+    bool antecedent() const { return m_antecedent; }
+    void antecedent(bool flag) { m_antecedent = flag; }
+};
 class AstSFormatF final : public AstNodeExpr {
     // Convert format to string, generally under an AstDisplay or AstSFormat
     // Also used as "real" function for /*verilator sformat*/ functions
@@ -2638,7 +2667,7 @@ public:
         out.opWildEq(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f==? %r)"; }
-    string emitC() override { return "VL_EQ_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_EQ_%lq%lT(%P, %li, %ri)"; }
     string emitSMT() const override { return "(__Vbv (= %l %r))"; }
     string emitSimpleOperator() override { return "=="; }
     bool cleanOut() const override { return true; }
@@ -3262,7 +3291,7 @@ public:
         out.opWildNeq(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f!=? %r)"; }
-    string emitC() override { return "VL_NEQ_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_NEQ_%lq%lT(%P, %li, %ri)"; }
     string emitSimpleOperator() override { return "!="; }
     bool cleanOut() const override { return true; }
     bool cleanLhs() const override { return true; }
@@ -3681,7 +3710,7 @@ public:
         out.opSub(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f- %r)"; }
-    string emitC() override { return "VL_SUB_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_SUB_%lq%lT(%P, %li, %ri)"; }
     string emitSMT() const override { return "(bvsub %l %r)"; }
     string emitSimpleOperator() override { return "-"; }
     bool cleanOut() const override { return false; }
@@ -3758,7 +3787,7 @@ public:
         out.opEq(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f== %r)"; }
-    string emitC() override { return "VL_EQ_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_EQ_%lq%lT(%P, %li, %ri)"; }
     string emitSMT() const override { return "(__Vbv (= %l %r))"; }
     string emitSimpleOperator() override { return "=="; }
     bool cleanOut() const override { return true; }
@@ -3781,7 +3810,7 @@ public:
         out.opCaseEq(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f=== %r)"; }
-    string emitC() override { return "VL_EQ_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_EQ_%lq%lT(%P, %li, %ri)"; }
     string emitSimpleOperator() override { return "=="; }
     bool cleanOut() const override { return true; }
     bool cleanLhs() const override { return true; }
@@ -3900,7 +3929,7 @@ public:
         out.opNeq(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f!= %r)"; }
-    string emitC() override { return "VL_NEQ_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_NEQ_%lq%lT(%P, %li, %ri)"; }
     string emitSimpleOperator() override { return "!="; }
     string emitSMT() const override { return "(__Vbv (not (= %l %r)))"; }
     bool cleanOut() const override { return true; }
@@ -3923,7 +3952,7 @@ public:
         out.opCaseNeq(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f!== %r)"; }
-    string emitC() override { return "VL_NEQ_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_NEQ_%lq%lT(%P, %li, %ri)"; }
     string emitSimpleOperator() override { return "!="; }
     bool cleanOut() const override { return true; }
     bool cleanLhs() const override { return true; }
@@ -4019,7 +4048,7 @@ public:
         out.opAdd(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f+ %r)"; }
-    string emitC() override { return "VL_ADD_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_ADD_%lq%lT(%P, %li, %ri)"; }
     string emitSMT() const override { return "(bvadd %l %r)"; }
     string emitSimpleOperator() override { return "+"; }
     bool cleanOut() const override { return false; }
@@ -4066,7 +4095,7 @@ public:
         out.opAnd(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f& %r)"; }
-    string emitC() override { return "VL_AND_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_AND_%lq%lT(%P, %li, %ri)"; }
     string emitSMT() const override { return "(bvand %l %r)"; }
     string emitSimpleOperator() override { return "&"; }
     bool cleanOut() const override { V3ERROR_NA_RETURN(false); }
@@ -4163,7 +4192,7 @@ public:
         out.opOr(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f| %r)"; }
-    string emitC() override { return "VL_OR_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_OR_%lq%lT(%P, %li, %ri)"; }
     string emitSMT() const override { return "(bvor %l %r)"; }
     string emitSimpleOperator() override { return "|"; }
     bool cleanOut() const override { V3ERROR_NA_RETURN(false); }
@@ -4187,7 +4216,7 @@ public:
         out.opXor(lhs, rhs);
     }
     string emitVerilog() override { return "%k(%l %f^ %r)"; }
-    string emitC() override { return "VL_XOR_%lq(%lW, %P, %li, %ri)"; }
+    string emitC() override { return "VL_XOR_%lq%lT(%P, %li, %ri)"; }
     string emitSMT() const override { return "(bvxor %l %r)"; }
     string emitSimpleOperator() override { return "^"; }
     bool cleanOut() const override { return false; }  // Lclean && Rclean
@@ -5226,6 +5255,24 @@ public:
     bool cleanLhs() const override { return false; }
     bool sizeMattersLhs() const override { return false; }
 };
+class AstLeastSetBitP1 final : public AstNodeUniop {
+    // Index of least significant set bit plus one, or zero if none (priority encoder)
+public:
+    AstLeastSetBitP1(FileLine* fl, AstNodeExpr* lhsp)
+        : ASTGEN_SUPER_LeastSetBitP1(fl, lhsp) {
+        dtypeSetLogicSized(32, VSigning::UNSIGNED);
+    }
+    ASTGEN_MEMBERS_AstLeastSetBitP1;
+    void numberOperate(V3Number& out, const V3Number& lhs) override {
+        out.opLeastSetBitP1(lhs);
+    }
+    string emitVerilog() override { return "%f$_LEASTSETBITP1(%l)"; }
+    string emitC() override { return "VL_LEASTSETBITP1_%lq(%lW, %P, %li)"; }
+    bool cleanOut() const override { return true; }
+    bool cleanLhs() const override { return true; }
+    bool sizeMattersLhs() const override { return false; }
+    int instrCount() const override { return widthInstrs() * 2; }
+};
 class AstLenN final : public AstNodeUniop {
     // Length of a string
 public:
@@ -5257,6 +5304,24 @@ public:
     bool cleanLhs() const override { return true; }
     bool sizeMattersLhs() const override { return false; }
 };
+class AstMostSetBitP1 final : public AstNodeUniop {
+    // Index of most significant set bit plus one, or zero if none (priority encoder)
+public:
+    AstMostSetBitP1(FileLine* fl, AstNodeExpr* lhsp)
+        : ASTGEN_SUPER_MostSetBitP1(fl, lhsp) {
+        dtypeSetLogicSized(32, VSigning::UNSIGNED);
+    }
+    ASTGEN_MEMBERS_AstMostSetBitP1;
+    void numberOperate(V3Number& out, const V3Number& lhs) override {
+        out.opMostSetBitP1(lhs);
+    }
+    string emitVerilog() override { return "%f$_MOSTSETBITP1(%l)"; }
+    string emitC() override { return "VL_MOSTSETBITP1_%lq(%lW, %P, %li)"; }
+    bool cleanOut() const override { return true; }
+    bool cleanLhs() const override { return true; }
+    bool sizeMattersLhs() const override { return false; }
+    int instrCount() const override { return widthInstrs() * 2; }
+};
 class AstNToI final : public AstNodeUniop {
     // String to any-size integral
 public:
@@ -5314,7 +5379,7 @@ public:
     ASTGEN_MEMBERS_AstNot;
     void numberOperate(V3Number& out, const V3Number& lhs) override { out.opNot(lhs); }
     string emitVerilog() override { return "%f(~ %l)"; }
-    string emitC() override { return "VL_NOT_%lq(%lW, %P, %li)"; }
+    string emitC() override { return "VL_NOT_%lq%lT(%P, %li)"; }
     string emitSMT() const override { return "(bvnot %l)"; }
     string emitSimpleOperator() override { return "~"; }
     bool cleanOut() const override { return false; }
@@ -5444,7 +5509,7 @@ public:
     ASTGEN_MEMBERS_AstRedOr;
     void numberOperate(V3Number& out, const V3Number& lhs) override { out.opRedOr(lhs); }
     string emitVerilog() override { return "%f(| %l)"; }
-    string emitC() override { return "VL_REDOR_%lq(%lW, %P, %li)"; }
+    string emitC() override { return "VL_REDOR_%lq%lT(%P, %li)"; }
     bool cleanOut() const override { return true; }
     bool cleanLhs() const override { return true; }
     bool sizeMattersLhs() const override { return false; }
@@ -5458,7 +5523,7 @@ public:
     ASTGEN_MEMBERS_AstRedXor;
     void numberOperate(V3Number& out, const V3Number& lhs) override { out.opRedXor(lhs); }
     string emitVerilog() override { return "%f(^ %l)"; }
-    string emitC() override { return "VL_REDXOR_%lq(%lW, %P, %li)"; }
+    string emitC() override { return "VL_REDXOR_%lq%lT(%P, %li)"; }
     bool cleanOut() const override { return false; }
     bool cleanLhs() const override {
         const int w = lhsp()->width();
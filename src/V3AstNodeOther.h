@@ -73,6 +73,7 @@ class AstNodeFTask VL_NOT_FINAL : public AstNode {
     bool m_dpiExport : 1;  // DPI exported
     bool m_dpiImport : 1;  // DPI imported
     bool m_dpiContext : 1;  // DPI import context
+    bool m_dpiDirect : 1;  // DPI import passes packed arguments by value
     bool m_dpiOpenChild : 1;  // DPI import open array child wrapper
     bool m_dpiTask : 1;  // DPI import task (vs. void function)
     bool m_isConstructor : 1;  // Class constructor
@@ -81,6 +82,7 @@ class AstNodeFTask VL_NOT_FINAL : public AstNode {
     bool m_isHideLocal : 1;  // Verilog local
     bool m_isHideProtected : 1;  // Verilog protected
     bool m_dpiPure : 1;  // DPI import pure (vs. virtual pure)
+    bool m_dpiThreadSafe : 1;  // DPI import may be called concurrently
     bool m_pureVirtual : 1;  // Pure virtual
     bool m_recursive : 1;  // Recursive or part of recursion
     bool m_static : 1;  // Static method in class
@@ -102,6 +104,7 @@ protected:
         , m_dpiExport{false}
         , m_dpiImport{false}
         , m_dpiContext{false}
+        , m_dpiDirect{false}
         , m_dpiOpenChild{false}
         , m_dpiTask{false}
         , m_isConstructor{false}
@@ -110,6 +113,7 @@ protected:
         , m_isHideLocal{false}
         , m_isHideProtected{false}
         , m_dpiPure{false}
+        , m_dpiThreadSafe{false}
         , m_pureVirtual{false}
         , m_recursive{false}
         , m_static{false}
@@ -157,6 +161,8 @@ public:
     void dpiImport(bool flag) { m_dpiImport = flag; }
     bool dpiContext() const { return m_dpiContext; }
     void dpiContext(bool flag) { m_dpiContext = flag; }
+    bool dpiDirect() const { return m_dpiDirect; }
+    void dpiDirect(bool flag) { m_dpiDirect = flag; }
     bool dpiOpenChild() const { return m_dpiOpenChild; }
     void dpiOpenChild(bool flag) { m_dpiOpenChild = flag; }
     bool dpiTask() const { return m_dpiTask; }
@@ -169,6 +175,8 @@ public:
     void isHideProtected(bool flag) { m_isHideProtected = flag; }
     bool dpiPure() const { return m_dpiPure; }
     void dpiPure(bool flag) { m_dpiPure = flag; }
+    bool dpiThreadSafe() const { return m_dpiThreadSafe; }
+    void dpiThreadSafe(bool flag) { m_dpiThreadSafe = flag; }
     bool pureVirtual() const { return m_pureVirtual; }
     void pureVirtual(bool flag) { m_pureVirtual = flag; }
     bool recursive() const { return m_recursive; }
@@ -223,8 +231,8 @@ class AstNodeModule VL_NOT_FINAL : public AstNode {
     // excluding $unit package stuff
     // @astgen op1 := inlinesp : List[AstNode]
     // @astgen op2 := stmtsp : List[AstNode]
-    string m_name;  // Name of the module
-    const string m_origName;  // Name of the module, ignoring name() changes, for dot lookup
+    VNameInterned m_name;  // Name of the module
+    const VNameInterned m_origName;  // Name of the module, ignoring name() changes, for dot lookup
     string m_someInstanceName;  // Hierarchical name of some arbitrary instance of this module.
                                 // Used for user messages only.
     string m_libname;  // Work library
@@ -313,11 +321,13 @@ class AstNodeProcedure VL_NOT_FINAL : public AstNode {
     // @astgen op2 := stmtsp : List[AstNode] // Note: op1 is used in some sub-types only
     bool m_suspendable : 1;  // Is suspendable by a Delay, EventControl, etc.
     bool m_needProcess : 1;  // Uses VlProcess
+    bool m_ownFunction : 1;  // Emit into a function on its own when ordered
 protected:
     AstNodeProcedure(VNType t, FileLine* fl, AstNode* stmtsp)
         : AstNode{t, fl} {
         m_needProcess = false;
         m_suspendable = false;
+        m_ownFunction = false;
         addStmtsp(stmtsp);
     }
 
@@ -331,6 +341,8 @@ public:
     void setSuspendable() { m_suspendable = true; }
     bool needProcess() const { return m_needProcess; }
     void setNeedProcess() { m_needProcess = true; }
+    bool isOwnFunction() const { return m_ownFunction; }
+    void setOwnFunction() { m_ownFunction = true; }
 };
 class AstNodeRange VL_NOT_FINAL : public AstNode {
     // A range, sized or unsized
@@ -689,6 +701,7 @@ class AstCFunc final : public AstNode {
     bool m_isVirtual : 1;  // Virtual function
     bool m_entryPoint : 1;  // User may call into this top level function
     bool m_dpiPure : 1;  // Pure DPI function
+    bool m_dpiThreadSafe : 1;  // DPI function may be called concurrently
     bool m_dpiContext : 1;  // Declared as 'context' DPI import/export function
     bool m_dpiExportDispatcher : 1;  // This is the DPI export entry point (i.e.: called by user)
     bool m_dpiExportImpl : 1;  // DPI export implementation (called from DPI dispatcher via lookup)
@@ -720,6 +733,7 @@ public:
         m_needProcess = false;
         m_entryPoint = false;
         m_dpiPure = false;
+        m_dpiThreadSafe = false;
         m_dpiContext = false;
         m_dpiExportDispatcher = false;
         m_dpiExportImpl = false;
@@ -789,6 +803,8 @@ public:
     void entryPoint(bool flag) { m_entryPoint = flag; }
     bool dpiPure() const { return m_dpiPure; }
     void dpiPure(bool flag) { m_dpiPure = flag; }
+    bool dpiThreadSafe() const { return m_dpiThreadSafe; }
+    void dpiThreadSafe(bool flag) { m_dpiThreadSafe = flag; }
     bool dpiContext() const { return m_dpiContext; }
     void dpiContext(bool flag) { m_dpiContext = flag; }
     bool dpiExportDispatcher() const VL_MT_SAFE { return m_dpiExportDispatcher; }
@@ -859,9 +875,9 @@ class AstCell final : public AstNode {
     //
     // @astgen ptr := m_modp : Optional[AstNodeModule]  // [AfterLink] Pointer to module instanced
     FileLine* m_modNameFileline;  // Where module the cell instances token was
-    string m_name;  // Cell name
-    string m_origName;  // Original name before dot addition
-    string m_modName;  // Module the cell instances
+    VNameInterned m_name;  // Cell name
+    VNameInterned m_origName;  // Original name before dot addition
+    VNameInterned m_modName;  // Module the cell instances
     bool m_hasIfaceVar : 1;  // True if a Var has been created for this cell
     bool m_recursive : 1;  // Self-recursive module
     bool m_trace : 1;  // Trace this cell
@@ -2001,8 +2017,8 @@ class AstVar final : public AstNode {
     // @astgen ptr := m_sensIfacep : Optional[AstIface]  // Interface type to which reads from this
     //                                                      var are sensitive
 
-    string m_name;  // Name of variable
-    string m_origName;  // Original name before dot addition
+    VNameInterned m_name;  // Name of variable
+    VNameInterned m_origName;  // Original name before dot addition
     string m_tag;  // Holds the string of the verilator tag -- used in XML output.
     VVarType m_varType;  // Type of variable
     VDirection m_direction;  // Direction input/output etc
@@ -2022,6 +2038,7 @@ class AstVar final : public AstNode {
     bool m_sigModPublic : 1;  // User C code accesses this signal and module
     bool m_sigUserRdPublic : 1;  // User C code accesses this signal, read only
     bool m_sigUserRWPublic : 1;  // User C code accesses this signal, read-write
+    bool m_sigUserRdSampled : 1;  // User C code reads this signal only between evaluations
     bool m_usedClock : 1;  // Signal used as a clock
     bool m_usedParam : 1;  // Parameter is referenced (on link; later signals not setup)
     bool m_usedLoopIdx : 1;  // Variable subject of for unrolling
@@ -2043,6 +2060,7 @@ class AstVar final : public AstNode {
     bool m_isIfaceParent : 1;  // dtype is reference to interface present in this module
     bool m_isInternal : 1;  // Internal state, don't add to method pinter
     bool m_isDpiOpenArray : 1;  // DPI import open array
+    bool m_isDpiDirect : 1;  // DPI import argument passed by value, see dpiDirect
     bool m_isHideLocal : 1;  // Verilog local
     bool m_isHideProtected : 1;  // Verilog protected
     bool m_noReset : 1;  // Do not do automated reset/randomization
@@ -2057,6 +2075,9 @@ class AstVar final : public AstNode {
     bool m_ignorePostRead : 1;  // Ignore reads in 'Post' blocks during ordering
     bool m_ignorePostWrite : 1;  // Ignore writes in 'Post' blocks during ordering
     bool m_ignoreSchedWrite : 1;  // Ignore writes in scheduling (for special optimizations)
+    bool m_alignCacheLine : 1;  // Starts a cache line in the emitted module struct
+    bool m_classFrame : 1;  // Class handle whose objects are held in the function's frame
+    bool m_argConstRef : 1;  // Function input argument passed by const reference
 
     void init() {
         m_ansi = false;
@@ -2073,6 +2094,7 @@ class AstVar final : public AstNode {
         m_sigModPublic = false;
         m_sigUserRdPublic = false;
         m_sigUserRWPublic = false;
+        m_sigUserRdSampled = false;
         m_funcLocal = false;
         m_funcLocalSticky = false;
         m_funcReturn = false;
@@ -2091,6 +2113,7 @@ class AstVar final : public AstNode {
         m_isIfaceParent = false;
         m_isInternal = false;
         m_isDpiOpenArray = false;
+        m_isDpiDirect = false;
         m_isHideLocal = false;
         m_isHideProtected = false;
         m_noReset = false;
@@ -2105,6 +2128,9 @@ class AstVar final : public AstNode {
         m_ignorePostRead = false;
         m_ignorePostWrite = false;
         m_ignoreSchedWrite = false;
+        m_alignCacheLine = false;
+        m_classFrame = false;
+        m_argConstRef = false;
         m_attrClocker = VVarAttrClocker::CLOCKER_UNKNOWN;
     }
 
@@ -2187,6 +2213,8 @@ public:
     // Return Verilator internal type for argument: CData, SData, IData, WData
     string vlArgType(bool named, bool forReturn, bool forFunc, const string& namespc = "",
                      bool asRef = false) const;
+    bool isDpiOpenDynamic() const;  // DPI open array passed a dynamic array or queue
+    const AstNodeDType* vlElemDTypep() const;  // Data type described by vlPropDecl
     string vlEnumType() const;  // Return VerilatorVarType: VLVT_UINT32, etc
     string vlEnumDir() const;  // Return VerilatorVarDir: VLVD_INOUT, etc
     string vlPropDecl(const string& propName) const;  // Return VerilatorVarProps declaration
@@ -2223,6 +2251,10 @@ public:
         m_sigUserRWPublic = flag;
         if (flag) sigUserRdPublic(true);
     }
+    void sigUserRdSampled(bool flag) {
+        m_sigUserRdSampled = flag;
+        if (flag) sigUserRdPublic(true);
+    }
     void sc(bool flag) { m_sc = flag; }
     void scSensitive(bool flag) { m_scSensitive = flag; }
     void primaryIO(bool flag) { m_primaryIO = flag; }
@@ -2242,10 +2274,16 @@ public:
     bool hasStrengthAssignment() { return m_hasStrengthAssignment; }
     void isDpiOpenArray(bool flag) { m_isDpiOpenArray = flag; }
     bool isDpiOpenArray() const VL_MT_SAFE { return m_isDpiOpenArray; }
+    void isDpiDirect(bool flag) { m_isDpiDirect = flag; }
+    bool isDpiDirect() const { return m_isDpiDirect; }
     bool isHideLocal() const { return m_isHideLocal; }
     void isHideLocal(bool flag) { m_isHideLocal = flag; }
     bool isHideProtected() const { return m_isHideProtected; }
     void isHideProtected(bool flag) { m_isHideProtected = flag; }
+    void classFrame(bool flag) { m_classFrame = flag; }
+    bool classFrame() const { return m_classFrame; }
+    void argConstRef(bool flag) { m_argConstRef = flag; }
+    bool argConstRef() const { return m_argConstRef; }
     void noReset(bool flag) { m_noReset = flag; }
     bool noReset() const { return m_noReset; }
     void noSubst(bool flag) { m_noSubst = flag; }
@@ -2268,6 +2306,8 @@ public:
     void setIgnorePostWrite() { m_ignorePostWrite = true; }
     bool ignoreSchedWrite() const { return m_ignoreSchedWrite; }
     void setIgnoreSchedWrite() { m_ignoreSchedWrite = true; }
+    bool alignCacheLine() const { return m_alignCacheLine; }
+    void alignCacheLine(bool flag) { m_alignCacheLine = flag; }
 
     // METHODS
     void name(const string& name) override { m_name = name; }
@@ -2330,6 +2370,10 @@ public:
     bool isSigModPublic() const { return m_sigModPublic && !isIfaceRef(); }
     bool isSigUserRdPublic() const { return m_sigUserRdPublic && !isIfaceRef(); }
     bool isSigUserRWPublic() const { return m_sigUserRWPublic && !isIfaceRef(); }
+    // Public only to be read between evaluations, so may be optimized within an evaluation
+    bool isSigUserRdSampled() const {
+        return m_sigUserRdSampled && !isSigUserRWPublic() && !isSigModPublic() && !isIfaceRef();
+    }
     bool isTrace() const { return m_trace; }
     bool isRand() const { return m_rand.isRand(); }
     bool isRandC() const { return m_rand.isRandC(); }
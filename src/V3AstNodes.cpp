@@ -23,6 +23,7 @@
 #include "V3Graph.h"
 #include "V3Hasher.h"
 #include "V3String.h"
+#include "V3ThreadPool.h"
 
 #include "V3Ast__gen_impl.h"  // Generated by 'astgen'
 #include "V3Ast__gen_macros.h"  // Generated by 'astgen'
@@ -507,6 +508,7 @@ void AstVar::combineType(const AstVar* otherp) {
     if (otherp->isSigModPublic()) sigModPublic(true);
     if (otherp->isSigUserRdPublic()) sigUserRdPublic(true);
     if (otherp->isSigUserRWPublic()) sigUserRWPublic(true);
+    if (otherp->m_sigUserRdSampled) sigUserRdSampled(true);
     if (otherp->attrScClocked()) attrScClocked(true);
     if (otherp->varType() == VVarType::PORT) {
         varType(otherp->varType());
@@ -552,7 +554,9 @@ string AstVar::vlArgType(bool named, bool forReturn, bool forFunc, const string&
     if (isStatic() && namespc.empty()) ostatic = "static ";
 
     const bool isRef = isDpiOpenArray()
-                       || (forFunc && (isWritable() || this->isRef() || this->isConstRef()))
+                       || (forFunc
+                           && (isWritable() || this->isRef() || this->isConstRef()
+                               || argConstRef()))
                        || asRef;
 
     if (forFunc && isReadOnly() && isRef) ostatic = ostatic + "const ";
@@ -565,9 +569,23 @@ string AstVar::vlArgType(bool named, bool forReturn, bool forFunc, const string&
     return ostatic + dtypep()->cType(oname, forFunc, isRef);
 }
 
+bool AstVar::isDpiOpenDynamic() const {
+    if (!isDpiOpenArray()) return false;
+    const AstNodeDType* const dtp = dtypep()->skipRefp();
+    return VN_IS(dtp, DynArrayDType) || VN_IS(dtp, QueueDType);
+}
+
+const AstNodeDType* AstVar::vlElemDTypep() const {
+    // A dynamic array or queue passed as a DPI open array is described by
+    // its element type, with the outer dimension sized at runtime
+    if (isDpiOpenDynamic()) return dtypep()->skipRefp()->subDTypep()->skipRefp();
+    return subDTypep();
+}
+
 string AstVar::vlEnumType() const {
     string arg;
-    const AstBasicDType* const bdtypep = basicp();
+    const AstNodeDType* const dtp = vlElemDTypep();
+    const AstBasicDType* const bdtypep = dtp->basicp();
     const bool strtype = bdtypep && bdtypep->keyword() == VBasicDTypeKwd::STRING;
     if (bdtypep && bdtypep->keyword() == VBasicDTypeKwd::CHARPTR) {
         return "VLVT_PTR";
@@ -575,17 +593,17 @@ string AstVar::vlEnumType() const {
         return "VLVT_PTR";
     } else if (strtype) {
         arg += "VLVT_STRING";
-    } else if (isDouble()) {
+    } else if (dtp->isDouble()) {
         arg += "VLVT_REAL";
-    } else if (widthMin() <= 8) {
+    } else if (dtp->widthMin() <= 8) {
         arg += "VLVT_UINT8";
-    } else if (widthMin() <= 16) {
+    } else if (dtp->widthMin() <= 16) {
         arg += "VLVT_UINT16";
-    } else if (widthMin() <= VL_IDATASIZE) {
+    } else if (dtp->widthMin() <= VL_IDATASIZE) {
         arg += "VLVT_UINT32";
-    } else if (isQuad()) {
+    } else if (dtp->isQuad()) {
         arg += "VLVT_UINT64";
-    } else if (isWide()) {
+    } else if (dtp->isWide()) {
         arg += "VLVT_WDATA";
     }
     // else return "VLVT_UNKNOWN"
@@ -610,7 +628,7 @@ string AstVar::vlEnumDir() const {
         out += "|VLVF_PUB_RD";
     }
     //
-    if (const AstBasicDType* const bdtypep = basicp()) {
+    if (const AstBasicDType* const bdtypep = vlElemDTypep()->basicp()) {
         if (bdtypep->keyword().isDpiCLayout()) out += "|VLVF_DPI_CLAY";
     }
     return out;
@@ -621,9 +639,14 @@ string AstVar::vlPropDecl(const string& propName) const {
 
     std::vector<int> plims;  // Packed dimension limits
     std::vector<int> ulims;  // Unpacked dimension limits
+    const bool dynamic = isDpiOpenDynamic();  // First unpacked dimension sized at runtime
 
-    if (const AstBasicDType* const bdtypep = basicp()) {
-        for (const AstNodeDType* dtp = dtypep(); dtp;) {
+    if (dynamic) {
+        ulims.push_back(0);
+        ulims.push_back(0);  // Replaced by the runtime size below
+    }
+    if (const AstBasicDType* const bdtypep = vlElemDTypep()->basicp()) {
+        for (const AstNodeDType* dtp = vlElemDTypep(); dtp;) {
             dtp = dtp->skipRefp();  // Skip AstRefDType/AstTypedef, or return same node
             if (const AstNodeArrayDType* const adtypep = VN_CAST(dtp, NodeArrayDType)) {
                 if (VN_IS(dtp, PackArrayDType)) {
@@ -644,15 +667,21 @@ string AstVar::vlPropDecl(const string& propName) const {
         }
     }
 
+    // Dynamic arrays are described anew on each call, so are not static
+    const string ostatic = dynamic ? "" : "static ";
     if (!ulims.empty()) {
-        out += "static const int " + propName + "__ulims[";
+        out += ostatic + "const int " + propName + "__ulims[";
         out += cvtToStr(ulims.size());
         out += "] = {";
         auto it = ulims.cbegin();
         out += cvtToStr(*it);
         while (++it != ulims.cend()) {
             out += ", ";
-            out += cvtToStr(*it);
+            if (dynamic && it == ulims.cbegin() + 1) {
+                out += name() + ".size() - 1";
+            } else {
+                out += cvtToStr(*it);
+            }
         }
         out += "};\n";
     }
@@ -670,7 +699,7 @@ string AstVar::vlPropDecl(const string& propName) const {
         out += "};\n";
     }
 
-    out += "static const VerilatedVarProps ";
+    out += ostatic + "const VerilatedVarProps ";
     out += propName;
     out += "(";
     out += vlEnumType();  // VLVT_UINT32 etc
@@ -733,6 +762,9 @@ public:
     virtual string bitLogicVector(const AstVar* /*varp*/, bool isBit) const {
         return isBit ? "svBitVecVal" : "svLogicVecVal";
     }
+    virtual string direct(const AstVar* varp) const {
+        return varp->width() <= VL_IDATASIZE ? "svBitVecVal" : "uint64_t";
+    }
     virtual string primitive(const AstVar* varp) const {
         string type;
         const VBasicDTypeKwd keyword = varp->basicp()->keyword();
@@ -743,6 +775,8 @@ public:
     string convert(const AstVar* varp) const {
         if (varp->isDpiOpenArray()) {
             return openArray(varp);
+        } else if (varp->isDpiDirect()) {
+            return direct(varp);
         } else if (const AstBasicDType* const basicp = varp->basicp()) {
             if (basicp->isDpiBitVec() || basicp->isDpiLogicVec()) {
                 return bitLogicVector(varp, basicp->isDpiBitVec());
@@ -800,6 +834,9 @@ string AstVar::dpiTmpVarType(const string& varName) const {
             return dpiTypesToStringConverter::openArray(varp) + ' ' + m_name
                    + arraySuffix(varp, 0);
         }
+        string direct(const AstVar* varp) const override {
+            return dpiTypesToStringConverter::direct(varp) + ' ' + m_name;
+        }
         string bitLogicVector(const AstVar* varp, bool isBit) const override {
             string type = dpiTypesToStringConverter::bitLogicVector(varp, isBit);
             type += ' ' + m_name + arraySuffix(varp, varp->widthWords());
@@ -939,7 +976,8 @@ AstNodeDType::CTypeRecursed AstNodeDType::cTypeRecurse(bool compound, bool packe
         UASSERT_OBJ(!packed, this, "Unsupported type for packed struct or union");
         const CTypeRecursed key = adtypep->keyDTypep()->cTypeRecurse(true, false);
         const CTypeRecursed val = adtypep->subDTypep()->cTypeRecurse(true, false);
-        info.m_type = "VlAssocArray<" + key.m_type + ", " + val.m_type + ">";
+        info.m_type = (adtypep->unordered() ? "VlUnorderedAssocArray<" : "VlAssocArray<")
+                      + key.m_type + ", " + val.m_type + ">";
     } else if (const auto* const adtypep = VN_CAST(dtypep, CDType)) {
         UASSERT_OBJ(!packed, this, "Unsupported type for packed struct or union");
         info.m_type = adtypep->name();
@@ -972,7 +1010,7 @@ AstNodeDType::CTypeRecursed AstNodeDType::cTypeRecurse(bool compound, bool packe
         UASSERT_OBJ(!packed, this, "Unsupported type for packed struct or union");
         if (adtypep->isCompound()) compound = true;
         const CTypeRecursed sub = adtypep->subDTypep()->cTypeRecurse(compound, false);
-        info.m_type = "VlUnpacked<" + sub.m_type;
+        info.m_type = (adtypep->isSparse() ? "VlSparseUnpacked<" : "VlUnpacked<") + sub.m_type;
         info.m_type += ", " + cvtToStr(adtypep->declRange().elements());
         info.m_type += ">";
     } else if (const auto* const adtypep = VN_CAST(dtypep, NBACommitQueueDType)) {
@@ -1590,6 +1628,13 @@ void AstNode::dump(std::ostream& str) const {
     }
 }
 
+static bool dumpModulesJsonParallel(const AstNode* nodep) {
+    // Modules can be dumped independently, unless pointers are numbered in dump order
+    return VN_IS(nodep, NodeModule) && VN_IS(nodep->backp(), Netlist)
+           && v3Global.opt.verilateJobs() > 1 && !v3Global.opt.jsonIds()
+           && !v3Global.opt.dumpTreeAddrids() && nodep->nextp();
+}
+
 void dumpNodeListJson(std::ostream& os, const AstNode* nodep, const std::string& listName,
                       const string& indent) {
     os << ',';
@@ -1597,10 +1642,34 @@ void dumpNodeListJson(std::ostream& os, const AstNode* nodep, const std::string&
         os << '"' << listName << "\": []";
     } else {
         os << '\n' << indent + " \"" << listName << "\": [\n";
-        for (; nodep; nodep = nodep->nextp()) {
-            nodep->dumpTreeJson(os, indent + "  ");
-            if (nodep->nextp()) os << ',';
-            os << '\n';
+        const string childIndent = indent + "  ";
+        if (dumpModulesJsonParallel(nodep)) {
+            // Dump each module to its own buffer, then write them in order
+            std::vector<std::string> bufs;
+            for (const AstNode* itemp = nodep; itemp; itemp = itemp->nextp()) bufs.emplace_back();
+            {
+                V3ThreadScope threadScope;
+                size_t i = 0;
+                for (const AstNode* itemp = nodep; itemp; itemp = itemp->nextp()) {
+                    std::string& bufr = bufs[i++];
+                    threadScope.enqueue([itemp, &bufr, &childIndent]() {
+                        std::ostringstream ss;
+                        itemp->dumpTreeJson(ss, childIndent);
+                        bufr = ss.str();
+                    });
+                }
+            }
+            for (size_t i = 0; i < bufs.size(); ++i) {
+                os << bufs[i];
+                if (i + 1 < bufs.size()) os << ',';
+                os << '\n';
+            }
+        } else {
+            for (; nodep; nodep = nodep->nextp()) {
+                nodep->dumpTreeJson(os, childIndent);
+                if (nodep->nextp()) os << ',';
+                os << '\n';
+            }
         }
         os << indent << ']';
     }
@@ -2141,6 +2210,14 @@ string AstPin::prettyOperatorName() const {
                   + "port connection " + modVarp()->prettyNameQ())
                : "port connection";
 }
+void AstSExpr::dump(std::ostream& str) const {
+    this->AstNodeExpr::dump(str);
+    if (antecedent()) str << " [ANTECEDENT]";
+}
+void AstSExpr::dumpJson(std::ostream& str) const {
+    dumpJsonBoolFunc(str, antecedent);
+    dumpJsonGen(str);
+}
 void AstPrintTimeScale::dump(std::ostream& str) const {
     this->AstNodeStmt::dump(str);
     str << " " << timeunit();
@@ -2328,6 +2405,14 @@ string AstUnpackArrayDType::prettyDTypeName(bool full) const {
     os << subp->prettyDTypeName(full) << "$" << ranges;
     return os.str();
 }
+bool AstUnpackArrayDType::isSparse() const {
+    const int depth = v3Global.opt.sparseArrayDepth();
+    if (!depth || elementsConst() < depth) return false;
+    // Only arrays of integral elements, which can be copied and saved as plain memory
+    const AstNodeDType* const subp = subDTypep()->skipRefp();
+    const AstBasicDType* const basicp = subp->basicp();
+    return basicp && !basicp->isOpaque() && subp->isIntegralOrPacked();
+}
 std::vector<AstUnpackArrayDType*> AstUnpackArrayDType::unpackDimensions() {
     std::vector<AstUnpackArrayDType*> dims;
     for (AstUnpackArrayDType* unpackp = this; unpackp;) {
@@ -2507,6 +2592,7 @@ void AstTypeTable::dumpJson(std::ostream& str) const { dumpJsonGen(str); }
 void AstAssocArrayDType::dumpSmall(std::ostream& str) const {
     this->AstNodeDType::dumpSmall(str);
     str << "[assoc-" << nodeAddr(keyDTypep()) << "]";
+    if (unordered()) str << "[unordered]";
 }
 string AstAssocArrayDType::prettyDTypeName(bool full) const {
     return subDTypep()->prettyDTypeName(full) + "$[" + keyDTypep()->prettyDTypeName(full) + "]";
@@ -2667,6 +2753,7 @@ void AstVar::dump(std::ostream& str) const {
     if (isSigPublic()) str << " [P]";
     if (isSigUserRdPublic()) str << " [PRD]";
     if (isSigUserRWPublic()) str << " [PWR]";
+    if (isSigUserRdSampled()) str << " [PRDS]";
     if (isInternal()) str << " [INTERNAL]";
     if (isLatched()) str << " [LATCHED]";
     if (isUsedLoopIdx()) str << " [LOOP]";
@@ -2680,8 +2767,12 @@ void AstVar::dump(std::ostream& str) const {
         str << " [FUNC]";
     }
     if (isDpiOpenArray()) str << " [DPIOPENA]";
+    if (isDpiDirect()) str << " [DPIDIRECT]";
     if (ignorePostWrite()) str << " [IGNPWR]";
     if (ignoreSchedWrite()) str << " [IGNWR]";
+    if (alignCacheLine()) str << " [CLALIGN]";
+    if (classFrame()) str << " [FRAME]";
+    if (argConstRef()) str << " [CONSTREFARG]";
     if (!attrClocker().unknown()) str << " [" << attrClocker().ascii() << "] ";
     if (!lifetime().isNone()) str << " [" << lifetime().ascii() << "] ";
     str << " " << varType();
@@ -2710,6 +2801,7 @@ void AstVar::dumpJson(std::ostream& str) const {
     if (dtypep()) dumpJsonStr(str, "dtypeName", dtypep()->name());
     dumpJsonBoolFunc(str, isSigUserRdPublic);
     dumpJsonBoolFunc(str, isSigUserRWPublic);
+    dumpJsonBoolFunc(str, isSigUserRdSampled);
     dumpJsonBoolFunc(str, isGParam);
     dumpJsonBoolFunc(str, isParam);
     dumpJsonBoolFunc(str, attrScBv);
@@ -2850,6 +2942,8 @@ void AstNodeFTask::dump(std::ostream& str) const {
     if (classMethod()) str << " [METHOD]";
     if (dpiExport()) str << " [DPIX]";
     if (dpiImport()) str << " [DPII]";
+    if (dpiDirect()) str << " [DPIDIRECT]";
+    if (dpiThreadSafe()) str << " [DPITHREADSAFE]";
     if (dpiOpenChild()) str << " [DPIOPENCHILD]";
     if (dpiOpenParent()) str << " [DPIOPENPARENT]";
     if (isExternDef()) str << " [EXTDEF]";
@@ -3051,6 +3145,7 @@ void AstCFunc::dump(std::ostream& str) const {
     if (dpiImportPrototype()) str << " [DPIIP]";
     if (dpiImportWrapper()) str << " [DPIIW]";
     if (dpiPure()) str << " [DPIPURE]";
+    if (dpiThreadSafe()) str << " [DPITHREADSAFE]";
     if (isConstructor()) str << " [CTOR]";
     if (isDestructor()) str << " [DTOR]";
     if (isMethod()) str << " [METHOD]";
@@ -3114,6 +3209,7 @@ void AstCMethodHard::setPurity() {
                                                           {"erase", false},
                                                           {"evaluate", false},
                                                           {"evaluation", false},
+                                                          {"evaluationDeps", false},
                                                           {"exists", true},
                                                           {"fill", false},
                                                           {"find", true},
@@ -3169,6 +3265,7 @@ void AstCMethodHard::setPurity() {
                                                           {"unique_index", true},
                                                           {"word", true},
                                                           {"write_var", false},
+                                                          {"written", false},
                                                           {"basicStdRandomization", false}};
 
     if (name() == "atWriteAppend" || name() == "atWriteAppendBack") {
@@ -17,6 +17,9 @@
 //      At each IF/(IF else).
 //         Count underneath $display/$stop statements.
 //         If more on if than else, this branch is unlikely, or vice-versa.
+//         With --prof-pgo, count how often each branch is taken.
+//         With profile data, use the measured taken ratio instead.
+//         Move a large unlikely branch into a separate slow function.
 //      At each FTASKREF,
 //         Count calls into the function
 //      Then, if FTASK is called only once, add inline attribute
@@ -27,12 +30,22 @@
 
 #include "V3Branch.h"
 
+#include "V3Control.h"
+#include "V3EmitCBase.h"
+#include "V3InstrCount.h"
+#include "V3Stats.h"
+
 VL_DEFINE_DEBUG_FUNCTIONS;
 
+// Minimum profiled executions of a branch before the profile decides its prediction
+static constexpr uint64_t BRANCH_PGO_MIN_COUNT = 16;
+// Minimum instruction count of an unlikely branch before moving it out of line
+static constexpr uint32_t BRANCH_COLD_MIN_INSTRS = 20;
+
 //######################################################################
 // Branch state, as a visitor of each AstNode
 
-class BranchVisitor final : public VNVisitorConst {
+class BranchVisitor final : public VNVisitor {
     // NODE STATE
     // Entire netlist:
     //  AstFTask::user1()       -> int.  Number of references
@@ -40,10 +53,20 @@ class BranchVisitor final : public VNVisitorConst {
 
     // STATE - across all visitors
     std::vector<AstCFunc*> m_cfuncsp;  // List of all tasks
+    std::unordered_set<const AstNode*> m_pgoStmtps;  // Statements added by pgoInstrument
 
     // STATE - for current visit position (use VL_RESTORER)
     int m_likely = false;  // Excuses for branch likely taken
     int m_unlikely = false;  // Excuses for branch likely not taken
+    const AstNodeModule* m_modp = nullptr;  // Current module
+    const AstCFunc* m_cfuncp = nullptr;  // Current function
+    std::vector<AstCFunc*> m_coldFuncps;  // Cold functions to add to current module
+    int m_coldNum = 0;  // How many cold functions made under current module
+
+    // STATE - statistics
+    VDouble0 m_statPgoInstrumented;  // Branches instrumented for --prof-pgo
+    VDouble0 m_statPgoPredicted;  // Branches predicted from profile data
+    VDouble0 m_statColdOutlined;  // Unlikely branches moved to functions
 
     // METHODS
 
@@ -58,6 +81,94 @@ class BranchVisitor final : public VNVisitorConst {
         }
     }
 
+    bool pgoBranchable() const {
+        // Profile branches of the hot model functions, which have vlSymsp in scope
+        return m_cfuncp && !m_cfuncp->slow() && m_cfuncp->isLoose() && !m_cfuncp->isStatic()
+               && !VN_IS(m_modp, Class);
+    }
+    static string pgoBranchName(const AstNodeIf* nodep) {
+        const FileLine* const flp = nodep->fileline();
+        return flp->filename() + ":" + cvtToStr(flp->lineno()) + ":"
+               + cvtToStr(flp->firstColumn());
+    }
+    void pgoInstrument(AstNodeIf* nodep, const string& name) {
+        FileLine* const flp = nodep->fileline();
+        const string id = cvtToStr(v3Global.pgoBranchId(name));
+        const auto countp = [&](bool taken) {
+            AstCStmt* const stmtp
+                = new AstCStmt{flp, "vlSymsp->_vm_pgoProfiler.branch(" + id + ", "
+                                        + (taken ? "true" : "false") + ");\n"};
+            m_pgoStmtps.emplace(stmtp);
+            return stmtp;
+        };
+        // Count at the start of each branch, so a jump out of it is still counted
+        AstNode* const thensp = nodep->thensp() ? nodep->thensp()->unlinkFrBackWithNext() : nullptr;
+        nodep->addThensp(countp(true));
+        if (thensp) nodep->addThensp(thensp);
+        AstNode* const elsesp = nodep->elsesp() ? nodep->elsesp()->unlinkFrBackWithNext() : nullptr;
+        nodep->addElsesp(countp(false));
+        if (elsesp) nodep->addElsesp(elsesp);
+        ++m_statPgoInstrumented;
+    }
+
+    bool coldOutlinable() const {
+        // Only worth moving code out of hot functions; coroutines keep their frame
+        return v3Global.opt.fOutlineCold() && m_cfuncp && !m_cfuncp->slow()
+               && !m_cfuncp->isCoroutine();
+    }
+    bool coldMovable(AstNode* stmtsp) const {
+        // Return if statements have no references into the frame of the current function
+        std::unordered_set<const AstVar*> declared;
+        stmtsp->foreachAndNext([&](const AstVar* varp) { declared.emplace(varp); });
+        bool movable = true;
+        stmtsp->foreachAndNext([&](const AstNode* nodep) {
+            if (VN_IS(nodep, JumpGo) || VN_IS(nodep, CReturn) || VN_IS(nodep, CAwait)
+                || VN_IS(nodep, CExpr)) {
+                movable = false;
+            } else if (VN_IS(nodep, CStmt) && !m_pgoStmtps.count(nodep)) {
+                movable = false;
+            } else if (const AstNodeVarRef* const refp = VN_CAST(nodep, NodeVarRef)) {
+                if (refp->varp()->isFuncLocal() && !declared.count(refp->varp())) {
+                    movable = false;
+                }
+            }
+        });
+        return movable;
+    }
+    void coldOutline(AstNodeIf* nodep, bool thenCold) {
+        AstNode* const stmtsp = thenCold ? nodep->thensp() : nodep->elsesp();
+        if (!stmtsp) return;
+        uint32_t instrs = 0;
+        for (AstNode* stmtp = stmtsp; stmtp; stmtp = stmtp->nextp()) {
+            instrs += V3InstrCount::count(stmtp, false);
+        }
+        if (instrs < BRANCH_COLD_MIN_INSTRS) return;
+        if (!coldMovable(stmtsp)) return;
+        UINFO(4, "  COLD: " << instrs << " " << nodep);
+        // Create sub function, slow so it is emitted with VL_ATTR_COLD away from hot code
+        FileLine* const flp = stmtsp->fileline();
+        const string name = m_cfuncp->name() + "__cold" + cvtToStr(++m_coldNum);
+        AstCFunc* const funcp = new AstCFunc{flp, name, m_cfuncp->scopep()};
+        funcp->slow(true);
+        funcp->isStatic(m_cfuncp->isStatic());
+        funcp->isLoose(m_cfuncp->isLoose());
+        funcp->addStmtsp(stmtsp->unlinkFrBackWithNext());
+        m_coldFuncps.push_back(funcp);
+        // Call sub function where the branch body was
+        AstCCall* const callp = new AstCCall{flp, funcp};
+        callp->dtypeSetVoid();
+        if (VN_IS(m_modp, Class)) {
+            funcp->argTypes(EmitCBase::symClassVar());
+            callp->argTypes("vlSymsp");
+        }
+        if (thenCold) {
+            nodep->addThensp(callp->makeStmt());
+        } else {
+            nodep->addElsesp(callp->makeStmt());
+        }
+        ++m_statColdOutlined;
+    }
+
     // VISITORS
     void visit(AstNodeIf* nodep) override {
         UINFO(4, " IF: " << nodep);
@@ -66,12 +177,12 @@ class BranchVisitor final : public VNVisitorConst {
         {
             // Do if
             reset();
-            iterateAndNextConstNull(nodep->thensp());
+            iterateAndNextNull(nodep->thensp());
             const int ifLikely = m_likely;
             const int ifUnlikely = m_unlikely;
             // Do else
             reset();
-            iterateAndNextConstNull(nodep->elsesp());
+            iterateAndNextNull(nodep->elsesp());
             const int elseLikely = m_likely;
             const int elseUnlikely = m_unlikely;
             // Compute
@@ -82,20 +193,61 @@ class BranchVisitor final : public VNVisitorConst {
                 nodep->branchPred(VBranchPred::BP_UNLIKELY);
             }  // else leave unknown
         }
+        if (VN_IS(nodep, If) && pgoBranchable()) {
+            const string name = pgoBranchName(nodep);
+            // Measured behavior overrides the static guess, when it is clearly biased
+            const std::pair<uint64_t, uint64_t> counts
+                = V3Control::getProfileBranchData(v3Global.opt.prefix(), name);
+            const uint64_t taken = counts.first;
+            const uint64_t count = counts.second;
+            if (count >= BRANCH_PGO_MIN_COUNT) {
+                if (taken * 10 >= count * 9) {
+                    nodep->branchPred(VBranchPred::BP_LIKELY);
+                    ++m_statPgoPredicted;
+                } else if (taken * 10 <= count) {
+                    nodep->branchPred(VBranchPred::BP_UNLIKELY);
+                    ++m_statPgoPredicted;
+                } else {
+                    nodep->branchPred(VBranchPred::BP_UNKNOWN);
+                }
+            }
+        }
+        if (VN_IS(nodep, If) && coldOutlinable()) {
+            if (nodep->branchPred() == VBranchPred::BP_UNLIKELY) {
+                coldOutline(nodep, true);
+            } else if (nodep->branchPred() == VBranchPred::BP_LIKELY) {
+                coldOutline(nodep, false);
+            }
+        }
+        if (VN_IS(nodep, If) && pgoBranchable() && v3Global.opt.profPgo()) {
+            pgoInstrument(nodep, pgoBranchName(nodep));
+        }
     }
     void visit(AstNodeCCall* nodep) override {
         checkUnlikely(nodep);
         nodep->funcp()->user1Inc();
-        iterateChildrenConst(nodep);
+        iterateChildren(nodep);
     }
     void visit(AstCFunc* nodep) override {
         checkUnlikely(nodep);
         m_cfuncsp.push_back(nodep);
-        iterateChildrenConst(nodep);
+        VL_RESTORER(m_cfuncp);
+        m_cfuncp = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstNodeModule* nodep) override {
+        VL_RESTORER(m_modp);
+        VL_RESTORER(m_coldFuncps);
+        VL_RESTORER(m_coldNum);
+        m_modp = nodep;
+        m_coldFuncps.clear();
+        m_coldNum = 0;
+        iterateChildren(nodep);
+        for (AstCFunc* const funcp : m_coldFuncps) nodep->addStmtsp(funcp);
     }
     void visit(AstNode* nodep) override {
         checkUnlikely(nodep);
-        iterateChildrenConst(nodep);
+        iterateChildren(nodep);
     }
 
     // METHODS
@@ -109,10 +261,14 @@ public:
     // CONSTRUCTORS
     explicit BranchVisitor(AstNetlist* nodep) {
         reset();
-        iterateChildrenConst(nodep);
+        iterateChildren(nodep);
         calc_tasks();
     }
-    ~BranchVisitor() override = default;
+    ~BranchVisitor() override {
+        V3Stats::addStat("Optimizations, Branch PGO instrumented", m_statPgoInstrumented);
+        V3Stats::addStat("Optimizations, Branch PGO predicted", m_statPgoPredicted);
+        V3Stats::addStat("Optimizations, Branch cold outlined", m_statColdOutlined);
+    }
 };
 
 //######################################################################
@@ -19,6 +19,8 @@
 //      Mark all nodes
 //      Check all links point to marked nodes
 //      Check local variables in CFuncs appear before they are referenced
+//      With --debug-check-incremental, check links only of nodes edited since
+//      the previous check, with a full check every BROKEN_FULL_EVERY calls
 //
 //*************************************************************************
 
@@ -56,6 +58,11 @@ public:
 
 static bool s_brokenAllowMidvisitorCheck = false;
 
+// Incremental checking state
+static constexpr unsigned BROKEN_FULL_EVERY = 16;  // Calls between full checks
+static unsigned s_brokenCalls = 0;  // Calls to brokenAll
+static uint64_t s_brokenEditCntLast = 0;  // Global edit count at the previous check
+
 //######################################################################
 // Table of allocated AstNode pointers
 
@@ -149,6 +156,11 @@ class BrokenCheckVisitor final : public VNVisitorConst {
     // Local variables declared in the scope of the current statement
     std::vector<std::unordered_set<const AstVar*>> m_localsStack;
 
+    // Nodes not edited after this edit count are assumed still correct
+    const uint64_t m_editCntSince;
+    size_t m_checked = 0;  // Nodes checked
+    size_t m_skipped = 0;  // Nodes skipped as not edited
+
     // STATE - for current visit position (use VL_RESTORER)
     const AstCFunc* m_cfuncp = nullptr;  // Current CFunc, if any
     bool m_inScope = false;  // Under AstScope
@@ -162,8 +174,23 @@ private:
                     nodep, "Width != WidthMin");
     }
 
+    bool needsCheck(const AstNode* nodep) const {
+#ifdef VL_DEBUG
+        return !m_editCntSince || nodep->editCount() > m_editCntSince;
+#else
+        // Release builds do not track per node edits
+        (void)nodep;
+        return true;
+#endif
+    }
+
     void processEnter(AstNode* nodep) {
         nodep->brokenState(m_brokenCntCurrentUnder);
+        if (!needsCheck(nodep)) {
+            ++m_skipped;
+            return;
+        }
+        ++m_checked;
         const char* const whyp = nodep->brokenGen();
         UASSERT_OBJ(!whyp, nodep,
                     "Broken link in node (or something without maybePointedTo): " << whyp);
@@ -324,7 +351,11 @@ private:
 
 public:
     // CONSTRUCTORS
-    explicit BrokenCheckVisitor(AstNetlist* nodep) { iterateConstNull(nodep); }
+    BrokenCheckVisitor(AstNetlist* nodep, uint64_t editCntSince)
+        : m_editCntSince{editCntSince} {
+        iterateConstNull(nodep);
+        UINFO(9, "Broken checked " << m_checked << " nodes, skipped " << m_skipped);
+    }
     ~BrokenCheckVisitor() override = default;
 };
 
@@ -353,8 +384,15 @@ void V3Broken::brokenAll(AstNetlist* nodep) {
             nodep->brokenState(brokenCntCurrent);
         });
 
-        // Check every node in tree
-        const BrokenCheckVisitor cvisitor{nodep};
+        // Check every node in tree, or only those edited since the last check.
+        // Edits to member pointers are not counted, so periodically check all.
+        uint64_t editCntSince = 0;
+        if (v3Global.opt.debugCheckIncremental() && (s_brokenCalls % BROKEN_FULL_EVERY) != 0) {
+            editCntSince = s_brokenEditCntLast;
+        }
+        ++s_brokenCalls;
+        s_brokenEditCntLast = AstNode::editCountGbl();
+        const BrokenCheckVisitor cvisitor{nodep, editCntSince};
 
         s_allocTable.checkForLeaks();
         s_linkableTable.clear();
@@ -24,9 +24,9 @@
 //                                                  (other items))
 //                                              body
 //              Or, converts to a if/else tree.
-//      FUTURES:
 //          Large 16+ bit tables with constants and no masking (address muxes)
-//              Enter all into std::multimap, sort by value and use a tree of < and == compares.
+//              Sort by value and use a binary search tree of < and == compares.
+//      FUTURES:
 //          "Diagonal" find of {rightmost,leftmost} bit {set,clear}
 //              Ignoring mask, check each value is unique (using std::multimap as above?)
 //              Each branch is then mask-and-compare operation (IE
@@ -45,6 +45,9 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 #define CASE_OVERLAP_WIDTH 16  // Maximum width we can check for overlaps in
 #define CASE_BARF 999999  // Magic width when non-constant
 #define CASE_ENCODER_GROUP_DEPTH 8  // Levels of priority to be ORed together in top IF tree
+#define CASE_SEARCH_MIN_ITEMS 8  // Minimum constant items to use a binary search tree
+#define CASE_SEARCH_LEAF_ITEMS 2  // Items compared in sequence at leaves of search tree
+#define CASE_SEARCH_GROWTH 2  // Maximum growth in statements from search tree duplication
 
 //######################################################################
 
@@ -122,6 +125,7 @@ class CaseVisitor final : public VNVisitor {
     // STATE
     VDouble0 m_statCaseFast;  // Statistic tracking
     VDouble0 m_statCaseSlow;  // Statistic tracking
+    VDouble0 m_statCaseSearch;  // Statistic tracking
     const AstNode* m_alwaysp = nullptr;  // Always in which case is located
 
     // Per-CASE
@@ -130,6 +134,9 @@ class CaseVisitor final : public VNVisitor {
     bool m_caseNoOverlapsAllCovered = false;  // Proven to be synopsys parallel_case compliant
     // For each possible value, the case branch we need
     std::array<AstNode*, 1 << CASE_OVERLAP_WIDTH> m_valueItem;
+    // For binary search, the first item matching each value, in value order
+    std::vector<std::pair<AstConst*, AstCaseItem*>> m_searchItems;
+    AstCaseItem* m_searchDefaultp = nullptr;  // For binary search, the default item if any
 
     // METHODS
     //! Determine whether we should check case items are complete
@@ -399,6 +406,90 @@ class CaseVisitor final : public VNVisitor {
         UINFOTREE(9, ifrootp, "", "_simp");
     }
 
+    static int stmtsNodeCount(const AstNode* stmtsp) {
+        int count = 0;
+        for (; stmtsp; stmtsp = stmtsp->nextp()) count += stmtsp->nodeCount();
+        return count;
+    }
+
+    bool isCaseTreeSearch(AstCase* nodep) {
+        // Wide case of many exact constants, e.g. an instruction decoder
+        m_searchItems.clear();
+        m_searchDefaultp = nullptr;
+        const int width = nodep->exprp()->width();
+        if (width > 64 || nodep->exprp()->isDouble() || !nodep->exprp()->isPure()) return false;
+        std::map<uint64_t, std::pair<AstConst*, AstCaseItem*>> values;
+        int origNodes = 0;
+        int searchNodes = 0;
+        for (AstCaseItem* itemp = nodep->itemsp(); itemp;
+             itemp = VN_AS(itemp->nextp(), CaseItem)) {
+            const int itemNodes = stmtsNodeCount(itemp->stmtsp());
+            origNodes += itemNodes;
+            if (itemp->isDefault()) {
+                m_searchDefaultp = itemp;
+                continue;
+            }
+            for (AstNode* icondp = itemp->condsp(); icondp; icondp = icondp->nextp()) {
+                AstConst* const iconstp = VN_CAST(icondp, Const);
+                if (!iconstp || iconstp->width() != width || iconstp->num().isFourState()) {
+                    return false;
+                }
+                // Earlier items take priority over later overlapping ones
+                if (values.emplace(iconstp->toUQuad(), std::make_pair(iconstp, itemp)).second) {
+                    searchNodes += itemNodes;
+                }
+            }
+        }
+        if (values.size() < CASE_SEARCH_MIN_ITEMS) return false;
+        // Each leaf of the tree repeats the default, and items with several
+        // values are repeated for each, so only search when this is cheap
+        if (m_searchDefaultp) {
+            searchNodes += values.size() * stmtsNodeCount(m_searchDefaultp->stmtsp());
+        }
+        if (searchNodes > CASE_SEARCH_GROWTH * origNodes + CASE_SEARCH_MIN_ITEMS) return false;
+        for (const auto& pair : values) m_searchItems.push_back(pair.second);
+        return true;
+    }
+
+    AstNode* replaceCaseSearchRecurse(AstNodeExpr* cexprp, size_t lo, size_t hi) {
+        FileLine* const flp = cexprp->fileline();
+        if (hi - lo <= CASE_SEARCH_LEAF_ITEMS) {
+            // Compare each remaining value in turn
+            AstNode* elsesp = nullptr;
+            if (m_searchDefaultp && m_searchDefaultp->stmtsp()) {
+                elsesp = m_searchDefaultp->stmtsp()->cloneTree(true);
+            }
+            for (size_t i = hi; i-- > lo;) {
+                AstConst* const iconstp = m_searchItems[i].first;
+                AstNode* const stmtsp = m_searchItems[i].second->stmtsp();
+                AstNodeExpr* const condp = AstEq::newTyped(flp, cexprp->cloneTreePure(false),
+                                                           iconstp->cloneTree(false));
+                elsesp = new AstIf{flp, condp, stmtsp ? stmtsp->cloneTree(true) : nullptr,
+                                   elsesp};
+            }
+            return elsesp;
+        }
+        const size_t mid = lo + (hi - lo) / 2;
+        AstNodeExpr* const condp = new AstLt{flp, cexprp->cloneTreePure(false),
+                                             m_searchItems[mid].first->cloneTree(false)};
+        return new AstIf{flp, condp, replaceCaseSearchRecurse(cexprp, lo, mid),
+                         replaceCaseSearchRecurse(cexprp, mid, hi)};
+    }
+
+    void replaceCaseSearch(AstCase* nodep) {
+        // CASE(cexpr, ITEM(c0, s0), ... ITEM(cN, sN), ITEM(default, sd))
+        // ->  IF(cexpr < cmid, IF(cexpr == c0, s0, ... sd), IF(cexpr == cmid, smid, ... sd))
+        AstNodeExpr* const cexprp = nodep->exprp();
+        AstNode* const ifrootp = replaceCaseSearchRecurse(cexprp, 0, m_searchItems.size());
+        m_searchItems.clear();
+        m_searchDefaultp = nullptr;
+        UINFOTREE(9, ifrootp, "", "_search");
+        // Handle any assertions
+        replaceCaseParallel(nodep, false);
+        nodep->replaceWith(ifrootp);
+        VL_DO_DANGLING(nodep->deleteTree(), nodep);
+    }
+
     void replaceCaseComplicated(AstCase* nodep) {
         // CASEx(cexpr,ITEM(icond1,istmts1),ITEM(icond2,istmts2),ITEM(default,istmts3))
         // ->  IF((cexpr==icond1),istmts1,
@@ -569,6 +660,11 @@ class CaseVisitor final : public VNVisitor {
             // we can make a tree of statements to avoid extra comparisons
             ++m_statCaseFast;
             VL_DO_DANGLING(replaceCaseFast(nodep), nodep);
+        } else if (v3Global.opt.fCase() && isCaseTreeSearch(nodep)) {
+            // Many constants too wide for a decoding tree, compare in a binary search
+            if (m_alwaysp) m_alwaysp->fileline()->warnOff(V3ErrorCode::LATCH, true);
+            ++m_statCaseSearch;
+            VL_DO_DANGLING(replaceCaseSearch(nodep), nodep);
         } else {
             // If a case statement is whole, presume signals involved aren't forming a latch
             if (m_alwaysp) m_alwaysp->fileline()->warnOff(V3ErrorCode::LATCH, true);
@@ -593,6 +689,7 @@ public:
     ~CaseVisitor() override {
         V3Stats::addStat("Optimizations, Cases parallelized", m_statCaseFast);
         V3Stats::addStat("Optimizations, Cases complex", m_statCaseSlow);
+        V3Stats::addStat("Optimizations, Cases binary searched", m_statCaseSearch);
     }
 };
 
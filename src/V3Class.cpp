@@ -18,12 +18,18 @@
 // Each class:
 //      Move to be modules under AstNetlist
 //
+// V3Class::frameAll:
+//      Mark function local class handles that only ever point to objects
+//      the function itself creates, and that are only used for member
+//      access, so the object can live in the function's frame
+//
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
 
 #include "V3Class.h"
 
+#include "V3Stats.h"
 #include "V3UniqueNames.h"
 
 #include <queue>
@@ -281,6 +287,96 @@ public:
     }
 };
 
+//######################################################################
+
+class ClassFrameVisitor final : public VNVisitorConst {
+    // NODE STATE
+    //  AstVar::user1()     -> int.  1 = assigned from new, 2 = may escape its function
+    //  AstCFunc::user2()   -> int.  1 = constructor can't leak 'this', 2 = might
+    const VNUser1InUse m_inuser1;
+    const VNUser2InUse m_inuser2;
+
+    // STATE
+    std::vector<AstVar*> m_varps;  // Class handle locals in current function
+    VDouble0 m_statFrames;  // Statistic tracking
+
+    // METHODS
+    static AstClass* refClassp(const AstNode* nodep) {
+        const AstClassRefDType* const dtypep
+            = VN_CAST(nodep->dtypep()->skipRefp(), ClassRefDType);
+        return dtypep ? dtypep->classp() : nullptr;
+    }
+    // True if constructing with this function can't make 'this' visible elsewhere
+    static bool ctorKeepsThis(AstCFunc* funcp) {
+        if (!funcp->user2()) {
+            bool leaks = false;
+            for (AstNode* stmtp = funcp->stmtsp(); stmtp && !leaks; stmtp = stmtp->nextp()) {
+                leaks = stmtp->exists([](const AstNode* np) {
+                    // Method calls get 'this' implicitly, and C text might use it
+                    return VN_IS(np, ThisRef) || (VN_IS(np, NodeCCall) && !VN_IS(np, CNew))
+                           || VN_IS(np, CStmt) || VN_IS(np, CExpr);
+                });
+            }
+            funcp->user2(leaks ? 2 : 1);
+        }
+        return funcp->user2() == 1;
+    }
+    bool allowedRef(const AstVarRef* nodep) {
+        const AstNode* const abovep = nodep->firstAbovep();
+        if (VN_IS(abovep, CReset)) return true;
+        // Member access, possibly null checked
+        if (const AstMemberSel* const selp = VN_CAST(abovep, MemberSel)) {
+            return selp->fromp() == nodep;
+        }
+        if (const AstNullCheck* const checkp = VN_CAST(abovep, NullCheck)) {
+            const AstMemberSel* const selp = VN_CAST(checkp->firstAbovep(), MemberSel);
+            return selp && selp->fromp() == checkp;
+        }
+        // Assigned a new object of exactly its own class, from a constructor that keeps 'this'
+        if (const AstNodeAssign* const assp = VN_CAST(abovep, NodeAssign)) {
+            const AstCNew* const cnewp = VN_CAST(assp->rhsp(), CNew);
+            if (assp->lhsp() != nodep || !cnewp) return false;
+            const AstClass* const classp = refClassp(cnewp);
+            if (!classp || classp != refClassp(nodep->varp()) || classp->extendsp()) return false;
+            if (!ctorKeepsThis(cnewp->funcp())) return false;
+            if (!nodep->varp()->user1()) nodep->varp()->user1(1);
+            return true;
+        }
+        return false;
+    }
+
+    // VISITORS
+    void visit(AstCFunc* nodep) override {
+        m_varps.clear();
+        iterateChildrenConst(nodep);
+        for (AstVar* const varp : m_varps) {
+            if (varp->user1() != 1) continue;
+            UINFO(5, "Class object in frame: " << varp);
+            varp->classFrame(true);
+            ++m_statFrames;
+        }
+    }
+    void visit(AstVar* nodep) override {
+        if (nodep->isFuncLocal() && !nodep->isIO() && !nodep->isFuncReturn()
+            && !nodep->lifetime().isStatic() && refClassp(nodep)) {
+            m_varps.push_back(nodep);
+        }
+    }
+    void visit(AstVarRef* nodep) override {
+        AstVar* const varp = nodep->varp();
+        if (varp->user1() == 2 || !refClassp(varp)) return;
+        if (!allowedRef(nodep)) varp->user1(2);
+    }
+    void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit ClassFrameVisitor(AstNetlist* nodep) { iterateConst(nodep); }
+    ~ClassFrameVisitor() override {
+        V3Stats::addStat("Optimizations, Class objects in frame", m_statFrames);
+    }
+};
+
 //######################################################################
 // Class class functions
 
@@ -289,3 +385,9 @@ void V3Class::classAll(AstNetlist* nodep) {
     { ClassVisitor{nodep}; }  // Destruct before checking
     V3Global::dumpCheckGlobalTree("class", 0, dumpTreeEitherLevel() >= 3);
 }
+
+void V3Class::frameAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { ClassFrameVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("class_frame", 0, dumpTreeEitherLevel() >= 6);
+}
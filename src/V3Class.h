@@ -27,6 +27,7 @@ class AstNetlist;
 class V3Class final {
 public:
     static void classAll(AstNetlist* nodep) VL_MT_DISABLED;
+    static void frameAll(AstNetlist* nodep) VL_MT_DISABLED;
 };
 
 #endif  // Guard
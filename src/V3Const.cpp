@@ -1282,6 +1282,10 @@ class ConstVisitor final : public VNVisitor {
         if (!operandIsTwostate(nodep)) return false;
         return (1 == VN_AS(nodep, Const)->num().countOnes());
     }
+    bool operandIsPosPowTwo(const AstNode* nodep) {  // Power of two, also when signed
+        if (!operandIsPowTwo(nodep)) return false;
+        return static_cast<int>(VN_AS(nodep, Const)->num().mostSetBitP1()) < nodep->width();
+    }
     bool operandShiftOp(const AstNodeBiop* nodep) {
         if (!VN_IS(nodep->rhsp(), Const)) return false;
         const AstNodeBiop* const lhsp = VN_CAST(nodep->lhsp(), NodeBiop);
@@ -1914,6 +1918,45 @@ class ConstVisitor final : public VNVisitor {
         nodep->replaceWithKeepDType(newp);
         VL_DO_DANGLING(pushDeletep(nodep), nodep);
     }
+    AstNodeExpr* newDivSBiased(AstNodeBiop* nodep, int amount) {
+        // b + (b < 0 ? 2^n-1 : 0), so a signed shift right rounds towards zero
+        FileLine* const fl = nodep->fileline();
+        const int width = nodep->width();
+        AstNodeExpr* const signp
+            = new AstShiftRS{fl, nodep->lhsp()->cloneTreePure(false),
+                             new AstConst(fl, static_cast<uint32_t>(width - 1)), width};
+        V3Number mask{nodep, width};
+        mask.setMask(amount);
+        AstNodeExpr* const biasp = new AstAnd{fl, new AstConst{fl, mask}, signp};
+        biasp->dtypeFrom(nodep);
+        AstNodeExpr* const sump = new AstAdd{fl, nodep->lhsp()->cloneTreePure(false), biasp};
+        sump->dtypeFrom(nodep);
+        return sump;
+    }
+    void replaceDivSShift(AstDivS* nodep) {
+        UINFO(5, "DIVS(b,2^n)->SHIFTRS(b+bias,n) " << nodep);
+        const int amount = VN_AS(nodep->rhsp(), Const)->num().mostSetBitP1() - 1;  // 2^n->n+1
+        AstNodeExpr* const sump = newDivSBiased(nodep, amount);
+        AstShiftRS* const newp
+            = new AstShiftRS{nodep->fileline(), sump, new AstConst(nodep->fileline(), amount)};
+        nodep->replaceWithKeepDType(newp);
+        VL_DO_DANGLING(pushDeletep(nodep), nodep);
+    }
+    void replaceModDivSAnd(AstModDivS* nodep) {
+        UINFO(5, "MODS(b,2^n)->SUB(b,AND(b+bias,~(2^n-1))) " << nodep);
+        FileLine* const fl = nodep->fileline();
+        const int amount = VN_AS(nodep->rhsp(), Const)->num().mostSetBitP1() - 1;  // 2^n->n+1
+        AstNodeExpr* const sump = newDivSBiased(nodep, amount);
+        V3Number mask{nodep, nodep->width()};
+        mask.setMask(amount);
+        V3Number notMask{nodep, nodep->width()};
+        notMask.opNot(mask);
+        AstAnd* const roundedp = new AstAnd{fl, new AstConst{fl, notMask}, sump};
+        roundedp->dtypeFrom(nodep);
+        AstSub* const newp = new AstSub{fl, nodep->lhsp()->unlinkFrBack(), roundedp};
+        nodep->replaceWithKeepDType(newp);
+        VL_DO_DANGLING(pushDeletep(nodep), nodep);
+    }
     void replaceShiftOp(AstNodeBiop* nodep) {
         UINFO(5, "SHIFT(AND(a,b),CONST)->AND(SHIFT(a,CONST),SHIFT(b,CONST)) " << nodep);
         const int width = nodep->width();
@@ -3652,6 +3695,8 @@ class ConstVisitor final : public VNVisitor {
     TREEOP ("AstMul   {operandIsPowTwo($lhsp), operandsSameWidth($lhsp,,$rhsp)}", "replaceMulShift(nodep)");  // a*2^n -> a<<n
     TREEOP ("AstDiv   {$lhsp, operandIsPowTwo($rhsp)}", "replaceDivShift(nodep)");  // a/2^n -> a>>n
     TREEOP ("AstModDiv{$lhsp, operandIsPowTwo($rhsp)}", "replaceModAnd(nodep)");  // a % 2^n -> a&(2^n-1)
+    TREEOP ("AstDivS  {$lhsp.castVarRef, operandIsPosPowTwo($rhsp), operandsSameWidth($lhsp,,$rhsp)}", "replaceDivSShift(nodep)");  // a/2^n -> (a+bias)>>>n
+    TREEOP ("AstModDivS{$lhsp.castVarRef, operandIsPosPowTwo($rhsp), operandsSameWidth($lhsp,,$rhsp)}", "replaceModDivSAnd(nodep)");  // a%2^n -> a-((a+bias)&~(2^n-1))
     TREEOP ("AstPow   {operandIsTwo($lhsp), !$rhsp.isZero}",    "replacePowShift(nodep)");  // 2**a == 1<<a
     TREEOP ("AstPowSU {operandIsTwo($lhsp), !$rhsp.isZero}",    "replacePowShift(nodep)");  // 2**a == 1<<a
     TREEOP ("AstSub   {$lhsp.castAdd, operandSubAdd(nodep)}", "AstAdd{AstSub{$lhsp->castAdd()->lhsp(),$rhsp}, $lhsp->castAdd()->rhsp()}");  // ((a+x)-y) -> (a+(x-y))
@@ -4056,6 +4101,9 @@ void V3Const::constifyAllLint(AstNetlist* nodep) {
 }
 
 void V3Const::constifyCpp(AstNetlist* nodep) {
+    // Although edits here are local to each function, this is not run in
+    // parallel over functions: ConstBitOpTreeVisitor claims the global user4
+    // on every call, and folding creates data types in the shared type table.
     UINFO(2, __FUNCTION__ << ":");
     {
         ConstVisitor visitor{ConstVisitor::PROC_CPP, /* globalPass: */ true};
@@ -545,12 +545,14 @@ public:
 };
 
 class V3ControlResolver final {
-    enum ProfileDataMode : uint8_t { NONE = 0, MTASK = 1, HIER_DPI = 2 };
+    enum ProfileDataMode : uint8_t { NONE = 0, MTASK = 1, HIER_DPI = 2, BRANCH = 4 };
     V3ControlModuleResolver m_modules;  // Access to module names (with wildcards)
     V3ControlFileResolver m_files;  // Access to file names (with wildcards)
     V3ControlScopeTraceResolver m_scopeTraces;  // Regexp to trace enables
     std::unordered_map<string, std::unordered_map<string, uint64_t>>
         m_profileData;  // Access to profile_data records
+    std::unordered_map<string, std::unordered_map<string, std::pair<uint64_t, uint64_t>>>
+        m_profileBranches;  // Access to profile_data -branch records, {taken, count}
     uint8_t m_mode = NONE;
     std::unordered_map<string, V3ControlResolverHierWorkerEntry> m_hierWorkers;
     FileLine* m_profileFileLine = nullptr;
@@ -578,6 +580,14 @@ public:
         m_profileData[model][key] += cost;
         m_mode |= mode;
     }
+    void addProfileBranchData(FileLine* fl, const string& model, const string& branch,
+                              uint64_t taken, uint64_t count) {
+        if (!m_profileFileLine) m_profileFileLine = fl;
+        std::pair<uint64_t, uint64_t>& counts = m_profileBranches[model][branch];
+        counts.first += taken;
+        counts.second += count;
+        m_mode |= BRANCH;
+    }
     bool containsMTaskProfileData() const { return m_mode & MTASK; }
     uint64_t getProfileData(const string& hierDpi) const {
         // Empty key for hierarchical DPI wrapper costs.
@@ -603,6 +613,14 @@ public:
         if (it == mit->second.cend()) return 0;
         return it->second;
     }
+    std::pair<uint64_t, uint64_t> getProfileBranchData(const string& model,
+                                                       const string& branch) const {
+        const auto mit = m_profileBranches.find(model);
+        if (mit == m_profileBranches.cend()) return {0, 0};
+        const auto it = mit->second.find(branch);
+        if (it == mit->second.cend()) return {0, 0};
+        return it->second;
+    }
     FileLine* getProfileDataFileLine() const { return m_profileFileLine; }  // Maybe null
 };
 
@@ -671,6 +689,11 @@ void V3Control::addProfileData(FileLine* fl, const string& model, const string&
     V3ControlResolver::s().addProfileData(fl, model, key, cost);
 }
 
+void V3Control::addProfileBranchData(FileLine* fl, const string& model, const string& branch,
+                                     uint64_t taken, uint64_t count) {
+    V3ControlResolver::s().addProfileBranchData(fl, model, branch, taken, count);
+}
+
 void V3Control::addScopeTraceOn(bool on, const string& scope, int levels) {
     V3ControlResolver::s().scopeTraces().addScopeTraceOn(on, scope, levels);
 }
@@ -784,6 +807,10 @@ uint64_t V3Control::getProfileData(const string& hierDpi) {
 uint64_t V3Control::getProfileData(const string& model, const string& key) {
     return V3ControlResolver::s().getProfileData(model, key);
 }
+std::pair<uint64_t, uint64_t> V3Control::getProfileBranchData(const string& model,
+                                                             const string& branch) {
+    return V3ControlResolver::s().getProfileBranchData(model, branch);
+}
 FileLine* V3Control::getProfileDataFileLine() {
     return V3ControlResolver::s().getProfileDataFileLine();
 }
@@ -42,6 +42,8 @@ public:
     static void addProfileData(FileLine* fl, const string& hierDpi, uint64_t cost);
     static void addProfileData(FileLine* fl, const string& model, const string& key,
                                uint64_t cost);
+    static void addProfileBranchData(FileLine* fl, const string& model, const string& branch,
+                                     uint64_t taken, uint64_t count);
     static void addScopeTraceOn(bool on, const string& scope, int levels);
     static void addVarAttr(FileLine* fl, const string& module, const string& ftask,
                            const string& signal, VAttrType type, AstSenTree* nodep);
@@ -57,6 +59,9 @@ public:
     static FileLine* getHierWorkersFileLine(const string& model);
     static uint64_t getProfileData(const string& hierDpi);
     static uint64_t getProfileData(const string& model, const string& key);
+    // Return {taken, count} execution counts of a profiled branch, {0, 0} if none
+    static std::pair<uint64_t, uint64_t> getProfileBranchData(const string& model,
+                                                              const string& branch);
     static FileLine* getProfileDataFileLine();
     static bool getScopeTraceOn(const string& scope);
 
@@ -37,6 +37,8 @@
 
 #include "V3Dead.h"
 
+#include "V3Stats.h"
+
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -69,11 +71,16 @@ class DeadVisitor final : public VNVisitor {
     std::vector<AstCell*> m_cellsp;
     std::vector<AstClass*> m_classesp;
     std::vector<AstTypedef*> m_typedefsp;
+    std::vector<AstNodeProcedure*> m_processesp;  // Timed processes that might become idle
     AssignMap m_assignMap;  // List of all simple assignments for each variable
     bool m_sideEffect = false;  // Side effects discovered in assign RHS
+    VDouble0 m_statIdleProcesses;  // Statistic tracking
 
     // STATE - for current visit position (use VL_RESTORER)
     bool m_inAssign = false;  // Currently in an assign
+    // LHS of current simple assignment; reads of it in its own RHS (e.g. 'clk = ~clk')
+    // do not keep it alive
+    AstVarScope* m_selfVscp = nullptr;
     AstNodeDType* m_curDTypep = nullptr;  // Current NodeDType
     AstNodeModule* m_modp = nullptr;  // Current module
     AstSelLoopVars* m_selloopvarsp = nullptr;  // Current loop vars
@@ -155,7 +162,7 @@ class DeadVisitor final : public VNVisitor {
         iterateChildren(nodep);
         checkAll(nodep);
         checkVarRef(nodep);
-        if (nodep->varScopep()) {
+        if (nodep->varScopep() && nodep->varScopep() != m_selfVscp) {
             nodep->varScopep()->user1Inc();
             nodep->varScopep()->varp()->user1Inc();
         }
@@ -293,25 +300,46 @@ class DeadVisitor final : public VNVisitor {
         {
             VL_RESTORER(m_inAssign);
             VL_RESTORER(m_sideEffect);
+            VL_RESTORER(m_selfVscp);
             m_inAssign = true;
             m_sideEffect = false;
-            iterateAndNextNull(nodep->rhsp());
-            checkAll(nodep);
             // Has to be direct assignment without any EXTRACTing.
             AstVarRef* const varrefp = VN_CAST(nodep->lhsp(), VarRef);
+            m_selfVscp = varrefp ? varrefp->varScopep() : nullptr;
+            iterateAndNextNull(nodep->rhsp());
+            checkAll(nodep);
             if (varrefp && !m_sideEffect && v3Global.opt.fDeadAssigns()
                 && varrefp->varScopep()) {  // For simplicity, we only remove post-scoping
                 m_assignMap.emplace(varrefp->varScopep(), nodep);
                 checkAll(varrefp);  // Must track reference to dtype()
                 checkVarRef(varrefp);
             } else {  // Track like any other statement
+                if (AstVarScope* const vscp = m_selfVscp) {  // Count reads of itself skipped above
+                    nodep->rhsp()->foreach([&](const AstNodeVarRef* refp) {
+                        if (refp->varScopep() != vscp) return;
+                        vscp->user1Inc();
+                        vscp->varp()->user1Inc();
+                    });
+                }
+                m_selfVscp = nullptr;
                 iterateAndNextNull(nodep->lhsp());
             }
+            m_selfVscp = nullptr;
             iterateNull(nodep->timingControlp());
         }
         if (assignInAssign) m_sideEffect = true;  // Parent assign shouldn't optimize
     }
 
+    void visit(AstNodeProcedure* nodep) override {
+        iterateChildren(nodep);
+        checkAll(nodep);
+        const AstAlways* const alwaysp = VN_CAST(nodep, Always);
+        if (m_elimUserVars && v3Global.opt.fDeadAssigns()
+            && (VN_IS(nodep, Initial) || (alwaysp && !alwaysp->sensesp()))) {
+            m_processesp.push_back(nodep);
+        }
+    }
+
     //-----
     void visit(AstClockingItem* nodep) override {
         // Prevent V3Dead from deleting clockvars that are seemingly dead before V3AssertPre. Later
@@ -418,6 +446,50 @@ class DeadVisitor final : public VNVisitor {
         }
     }
 
+    // Return true if the process only waits periodically, forever, e.g. a clock generator
+    // whose clock is never read, once its assignment was removed. Each wakeup would cost a
+    // scheduler round trip. Only loops that are provably infinite ('always', 'forever', or
+    // 'while' with a constant true condition) are idle, as a finite wait in an initial, e.g.
+    // 'repeat (100) #10', may still set the end of simulation.
+    static bool isIdleProcess(AstNodeProcedure* nodep) {
+        if (!nodep->stmtsp()) return false;
+        bool delays = false;
+        bool loops = VN_IS(nodep, Always);
+        for (AstNode* stmtp = nodep->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            const bool idle = stmtp->forall([&](const AstNode* np) {
+                if (VN_IS(np, Delay)) {
+                    delays = true;
+                    return true;
+                }
+                if (const AstWhile* const whilep = VN_CAST(np, While)) {
+                    const AstConst* const condp = VN_CAST(whilep->condp(), Const);
+                    if (!condp || condp->isZero()) return false;
+                    loops = true;
+                    return true;
+                }
+                if (VN_IS(np, Begin) || VN_IS(np, NodeDType)) return true;
+                if (const AstNodeVarRef* const refp = VN_CAST(np, NodeVarRef)) {
+                    return refp->access().isReadOnly();
+                }
+                if (const AstNodeExpr* const exprp = VN_CAST(np, NodeExpr)) {
+                    return const_cast<AstNodeExpr*>(exprp)->isPure();
+                }
+                return false;
+            });
+            if (!idle) return false;
+        }
+        return delays && loops;
+    }
+    void deadCheckProcesses() {
+        for (AstNodeProcedure* const nodep : m_processesp) {
+            if (isIdleProcess(nodep)) {
+                UINFO(4, "  Dead idle process " << nodep);
+                ++m_statIdleProcesses;
+                deleting(nodep);
+            }
+        }
+    }
+
     void deadCheckVar() {
         // Delete any unused varscopes
         for (AstVarScope* vscp : m_vscsp) {
@@ -533,6 +605,7 @@ public:
 
         deadCheckTypedefs();
         deadCheckVar();
+        deadCheckProcesses();
         // We only eliminate scopes when in a flattened structure
         // Otherwise we have no easy way to know if a scope is used
         if (elimScopes) deadCheckScope();
@@ -546,7 +619,9 @@ public:
         nodep->typeTablep()->repairCache();
         VIsCached::clearCacheTree();  // Removing assignments may affect isPure
     }
-    ~DeadVisitor() override = default;
+    ~DeadVisitor() override {
+        V3Stats::addStatSum("Optimizations, Dead idle processes", m_statIdleProcesses);
+    }
 };
 
 //######################################################################
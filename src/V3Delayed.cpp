@@ -57,7 +57,8 @@
 //      LHS = __Vdly__LHS;
 //
 // "Shared flag" scheme. Used for unpacked array target variables
-// in synthesizeable code. E.g.:
+// in synthesizeable code, where the NBAs update whole or bit-selected
+// elements (not e.g. members of unpacked struct elements). E.g.:
 //   LHS[idxa][idxb] <= RHS
 // is converted to:
 //  - Add new "Pre-scheduled" logic:
@@ -153,6 +154,7 @@ class DelayedVisitor final : public VNVisitor {
         bool m_partial = false;  // Used on LHS of NBA under a Sel
         bool m_inLoop = false;  // Used on LHS of NBA in a loop
         bool m_inSuspOrFork = false;  // Used on LHS of NBA in suspendable process or fork
+        bool m_elementLhs = true;  // All NBA LHSs are (bit selects of) array elements
         Scheme m_scheme = Scheme::Undecided;  // Conversion scheme to use for this variable
         uint32_t m_nTmp = 0;  // Temporary number for unique names
 
@@ -425,8 +427,11 @@ class DelayedVisitor final : public VNVisitor {
             if (vscpInfo.m_inSuspOrFork) return Scheme::FlagUnique;
             // Otherwise if an array of packed/basic elements, use the shared flag scheme
             if (basicp) return Scheme::FlagShared;
+            // Likewise for other elements, e.g. unpacked structs, if only whole
+            // elements are updated. This avoids copying the whole array twice.
+            if (vscpInfo.m_elementLhs) return Scheme::FlagShared;
             // Finally fall back on the shadow variable scheme, e.g. for
-            // arrays of unpacked structs. This will be slow.
+            // updating members of unpacked struct elements. This will be slow.
             // TODO: generic LHS scheme as discussed in #5092
             return Scheme::ShadowVar;
         }
@@ -456,6 +461,16 @@ class DelayedVisitor final : public VNVisitor {
         return Scheme::ShadowVar;
     }
 
+    // Return if NBA LHS 'lhsp' is a possibly bit-selected element of an array, or a whole
+    // variable, so 'captureLhs' captures all of its indices
+    static bool isElementLhs(const AstNodeExpr* lhsp) {
+        if (const AstSel* const selp = VN_CAST(lhsp, Sel)) lhsp = selp->fromp();
+        while (const AstArraySel* const arrSelp = VN_CAST(lhsp, ArraySel)) {
+            lhsp = arrSelp->fromp();
+        }
+        return VN_IS(lhsp, VarRef);
+    }
+
     // Create new AstVarScope in the given 'scopep', with the given 'name' and 'dtypep'
     AstVarScope* createTemp(FileLine* flp, AstScope* scopep, const std::string& name,
                             AstNodeDType* dtypep) {
@@ -1209,6 +1224,7 @@ class DelayedVisitor final : public VNVisitor {
         }
         // Note usage context
         vscpInfo.m_partial |= VN_IS(nodep->lhsp(), Sel);
+        vscpInfo.m_elementLhs &= isElementLhs(nodep->lhsp());
         vscpInfo.m_inLoop |= m_inLoop;
         vscpInfo.m_inSuspOrFork |= m_inSuspendableOrFork;
         // Sensitivity might be non-clocked, in a suspendable process, which are handled elsewhere
@@ -147,6 +147,10 @@ protected:
 
 public:
     virtual ~DfgVertex() VL_MT_DISABLED;
+#ifndef VL_LEAK_CHECKS
+    static void* operator new(size_t size) { return V3Allocator::allocate(size); }
+    static void operator delete(void* objp, size_t size) { V3Allocator::deallocate(objp, size); }
+#endif
 
 private:
     V3ListLinks<DfgVertex>& links() { return m_links; }
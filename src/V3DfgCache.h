@@ -335,6 +335,8 @@ template <typename Vertex> using CacheType = typename CacheTypeImpl<Vertex>::typ
     macro(DfgRedAnd) \
     macro(DfgRedOr) \
     macro(DfgRedXor) \
+    macro(DfgLeastSetBitP1) \
+    macro(DfgMostSetBitP1) \
     macro(DfgCond)
 
 // clang-format on
@@ -210,6 +210,19 @@ private:
     V3DfgPeepholeContext(V3DfgContext& ctx, const std::string& label) VL_MT_DISABLED;
     ~V3DfgPeepholeContext() VL_MT_DISABLED;
 };
+class V3DfgParityMatrixContext final : public V3DfgSubContext {
+    // Only V3DfgContext can create an instance
+    friend class V3DfgContext;
+
+public:
+    // STATE
+    VDouble0 m_networksConverted;  // Number of XOR networks converted to parity matrices
+
+private:
+    V3DfgParityMatrixContext(V3DfgContext& ctx, const std::string& label)
+        : V3DfgSubContext{ctx, label, "ParityMatrix"} {}
+    ~V3DfgParityMatrixContext() { addStat("networks converted", m_networksConverted); }
+};
 class V3DfgRegularizeContext final : public V3DfgSubContext {
     // Only V3DfgContext can create an instance
     friend class V3DfgContext;
@@ -246,6 +259,7 @@ public:
     V3DfgCseContext m_cseContext1{*this, m_label + " 2nd"};
     V3DfgDfgToAstContext m_dfg2AstContext{*this, m_label};
     V3DfgEliminateVarsContext m_eliminateVarsContext{*this, m_label};
+    V3DfgParityMatrixContext m_parityMatrixContext{*this, m_label};
     V3DfgPeepholeContext m_peepholeContext{*this, m_label};
     V3DfgRegularizeContext m_regularizeContext{*this, m_label};
 
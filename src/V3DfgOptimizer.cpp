@@ -289,7 +289,9 @@ class DataflowOptimize final {
         // Quick sanity check
         UASSERT(dfg.size() == 0, "DfgGraph should have become empty");
 
-        // For each acyclic component
+        // For each acyclic component. These are not optimized in parallel, as the passes
+        // find data types in the shared type table, and binToOneHot adds variables and
+        // logic to the module/netlist.
         for (const std::unique_ptr<DfgGraph>& component : acyclicComponents) {
             // Optimize the component
             V3DfgPasses::optimize(*component, m_ctx);
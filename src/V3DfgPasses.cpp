@@ -23,6 +23,8 @@
 #include "V3Global.h"
 #include "V3String.h"
 
+#include <bitset>
+
 VL_DEFINE_DEBUG_FUNCTIONS;
 
 // Common sub-expression elimination
@@ -394,6 +396,229 @@ void V3DfgPasses::binToOneHot(DfgGraph& dfg, V3DfgBinToOneHotContext& ctx) {
     }
 }
 
+void V3DfgPasses::parityMatrix(DfgGraph& dfg, V3DfgParityMatrixContext& ctx) {
+    // Each bit of an XOR network, as found in CRC, ECC and scrambler logic, is
+    // the parity of some bits of its inputs, plus a constant. Represent each
+    // result bit as a mask over the input bits (a row of a matrix over GF(2)),
+    // and if cheaper, compute it as 'redxor(inputs & mask)', which is a single
+    // parity instruction for inputs up to 64 bits wide, instead of a tree of
+    // selects and XORs.
+
+    // Maximum width of inputs, so each row fits in a single word
+    constexpr uint32_t WIDTH_MAX = 64;
+
+    // Vertices that compute a GF(2)-linear function of their non-constant operands
+    const auto isLinear = [&](const DfgVertex& vtx) -> bool {
+        if (!VN_IS(vtx.dtypep(), BasicDType) || vtx.width() > WIDTH_MAX) return false;
+        if (vtx.is<DfgXor>() || vtx.is<DfgNot>() || vtx.is<DfgConcat>() || vtx.is<DfgSel>()
+            || vtx.is<DfgExtend>()) {
+            return true;
+        }
+        if (const DfgAnd* const andp = vtx.cast<DfgAnd>()) return andp->lhsp()->is<DfgConst>();
+        if (const DfgOr* const orp = vtx.cast<DfgOr>()) return orp->lhsp()->is<DfgConst>();
+        if (const DfgShiftL* const shiftp = vtx.cast<DfgShiftL>()) {
+            return shiftp->rhsp()->is<DfgConst>();
+        }
+        if (const DfgShiftR* const shiftp = vtx.cast<DfgShiftR>()) {
+            return shiftp->rhsp()->is<DfgConst>();
+        }
+        return false;
+    };
+
+    // The roots of networks are the linear vertices used by anything else
+    std::vector<DfgVertex*> rootps;
+    std::unordered_set<const DfgVertex*> rootSet;
+    for (DfgVertex& vtx : dfg.opVertices()) {
+        if (!isLinear(vtx)) continue;
+        if (!vtx.findSink<DfgVertex>([&](const DfgVertex& sink) { return !isLinear(sink); })) {
+            continue;
+        }
+        rootps.push_back(&vtx);
+        rootSet.insert(&vtx);
+    }
+
+    // One result bit: parity of the input bits in 'm_mask', inverted if 'm_inv'
+    struct Row final {
+        uint64_t m_mask = 0;
+        bool m_inv = false;
+    };
+    using Rows = std::vector<Row>;
+    const auto countOnes = [](uint64_t mask) { return std::bitset<64>{mask}.count(); };
+
+    for (DfgVertex* const rootp : rootps) {
+        std::unordered_map<const DfgVertex*, Rows> vtx2Rows;
+        std::unordered_set<const DfgVertex*> pending;  // Vertices being evaluated
+        std::vector<DfgVertex*> inputps;  // Inputs, from LSB of the input vector
+        uint32_t inputWidth = 0;
+        size_t nOps = 0;  // Operations in the network, to be replaced
+        size_t nXors = 0;  // XOR operations in the network
+
+        // Rows of an input, allocating its bits in the input vector
+        const auto inputRows = [&](DfgVertex* vtxp) -> const Rows* {
+            const uint32_t width = vtxp->width();
+            if (inputWidth + width > WIDTH_MAX) return nullptr;
+            Rows& rows = vtx2Rows[vtxp];
+            rows.resize(width);
+            for (uint32_t i = 0; i < width; ++i) rows[i].m_mask = 1ULL << (inputWidth + i);
+            inputps.push_back(vtxp);
+            inputWidth += width;
+            return &rows;
+        };
+
+        // Compute rows of vertex, or return nullptr if not representable
+        const std::function<const Rows*(DfgVertex*)> evalRows
+            = [&](DfgVertex* vtxp) -> const Rows* {
+            const auto it = vtx2Rows.find(vtxp);
+            if (it != vtx2Rows.end()) return &it->second;
+            if (!VN_IS(vtxp->dtypep(), BasicDType)) return nullptr;
+            if (!pending.insert(vtxp).second) return nullptr;  // Cyclic
+            if (const DfgConst* const constp = vtxp->cast<DfgConst>()) {
+                if (constp->num().isFourState()) return nullptr;
+                Rows rows(constp->width());
+                for (uint32_t i = 0; i < rows.size(); ++i) rows[i].m_inv = constp->num().bitIs1(i);
+                return &(vtx2Rows[vtxp] = std::move(rows));
+            }
+            // Other networks, and non-linear logic, are inputs to this network
+            if ((vtxp != rootp && rootSet.count(vtxp)) || !isLinear(*vtxp)) {
+                if (vtxp->width() > WIDTH_MAX) return nullptr;
+                return inputRows(vtxp);
+            }
+            ++nOps;
+            const uint32_t width = vtxp->width();
+            Rows rows(width);
+            if (const DfgSel* const selp = vtxp->cast<DfgSel>()) {
+                DfgVertex* const fromp = selp->fromp();
+                // Prefer the whole source as input, unless it is too wide
+                const Rows* const fromRowsp
+                    = VN_IS(fromp->dtypep(), BasicDType) && fromp->width() <= WIDTH_MAX
+                          ? evalRows(fromp)
+                          : nullptr;
+                if (!fromRowsp) {
+                    --nOps;
+                    return inputRows(vtxp);
+                }
+                for (uint32_t i = 0; i < width; ++i) rows[i] = (*fromRowsp)[selp->lsb() + i];
+            } else if (const DfgVertexUnary* const unaryp = vtxp->cast<DfgVertexUnary>()) {
+                // DfgNot and DfgExtend
+                const Rows* const srcRowsp = evalRows(unaryp->srcp());
+                if (!srcRowsp) return nullptr;
+                for (uint32_t i = 0; i < srcRowsp->size(); ++i) rows[i] = (*srcRowsp)[i];
+                if (vtxp->is<DfgNot>()) {
+                    for (Row& row : rows) row.m_inv = !row.m_inv;
+                }
+            } else {
+                const DfgVertexBinary* const binaryp = vtxp->as<DfgVertexBinary>();
+                const Rows* const lRowsp = evalRows(binaryp->lhsp());
+                if (!lRowsp) return nullptr;
+                if (vtxp->is<DfgShiftL>() || vtxp->is<DfgShiftR>()) {
+                    const size_t shift = binaryp->rhsp()->as<DfgConst>()->toSizeT();
+                    for (uint32_t i = 0; i < width; ++i) {
+                        const size_t j = vtxp->is<DfgShiftL>() ? i - shift : i + shift;
+                        if (j < width) rows[i] = (*lRowsp)[j];  // Unsigned, so also if i < shift
+                    }
+                    return &(vtx2Rows[vtxp] = std::move(rows));
+                }
+                const Rows* const rRowsp = evalRows(binaryp->rhsp());
+                if (!rRowsp) return nullptr;
+                if (vtxp->is<DfgConcat>()) {
+                    const size_t rWidth = rRowsp->size();
+                    for (uint32_t i = 0; i < width; ++i) {
+                        rows[i] = i < rWidth ? (*rRowsp)[i] : (*lRowsp)[i - rWidth];
+                    }
+                } else if (vtxp->is<DfgXor>()) {
+                    ++nXors;
+                    for (uint32_t i = 0; i < width; ++i) {
+                        rows[i].m_mask = (*lRowsp)[i].m_mask ^ (*rRowsp)[i].m_mask;
+                        rows[i].m_inv = (*lRowsp)[i].m_inv != (*rRowsp)[i].m_inv;
+                    }
+                } else {
+                    // DfgAnd/DfgOr with constant 'lhsp', which selects a constant or 'rhsp'
+                    const bool isAnd = vtxp->is<DfgAnd>();
+                    for (uint32_t i = 0; i < width; ++i) {
+                        if ((*lRowsp)[i].m_inv == isAnd) {
+                            rows[i] = (*rRowsp)[i];
+                        } else {
+                            rows[i].m_inv = !isAnd;
+                        }
+                    }
+                }
+            }
+            return &(vtx2Rows[vtxp] = std::move(rows));
+        };
+
+        const Rows* const rowsp = evalRows(rootp);
+        if (!rowsp || !nXors || inputps.empty()) continue;
+
+        // Estimate the cost of the matrix form: the input vector concatenation,
+        // one AND and parity for each row with several inputs, and the result
+        // concatenation. Apply only if cheaper than the original network.
+        size_t cost = inputps.size() - 1 + rowsp->size() - 1;
+        for (const Row& row : *rowsp) {
+            const size_t nInputs = countOnes(row.m_mask);
+            cost += (nInputs > 1 ? 3 : nInputs) + (nInputs && row.m_inv);
+        }
+        if (cost >= nOps) continue;
+
+        UINFO(5, "Parity matrix for " << rootp << " inputs=" << inputWidth << " ops=" << nOps
+                                      << " cost=" << cost);
+        ++ctx.m_networksConverted;
+        FileLine* const flp = rootp->fileline();
+
+        // The input vector
+        DfgVertex* vecp = inputps.front();
+        for (size_t i = 1; i < inputps.size(); ++i) {
+            const uint32_t width = vecp->width() + inputps[i]->width();
+            DfgConcat* const catp = new DfgConcat{dfg, flp, DfgVertex::dtypeForWidth(width)};
+            catp->lhsp(inputps[i]);
+            catp->rhsp(vecp);
+            vecp = catp;
+        }
+
+        // The result bits, from the LSB
+        DfgVertex* resultp = nullptr;
+        for (const Row& row : *rowsp) {
+            DfgVertex* bitp = nullptr;
+            if (!row.m_mask) {
+                bitp = new DfgConst{dfg, flp, 1, row.m_inv};
+            } else {
+                if (countOnes(row.m_mask) == 1) {
+                    DfgSel* const selp = new DfgSel{dfg, flp, DfgVertex::dtypeForWidth(1)};
+                    selp->fromp(vecp);
+                    selp->lsb(countOnes(row.m_mask - 1));  // Index of the single bit
+                    bitp = selp;
+                } else {
+                    V3Number maskNum{flp, static_cast<int>(inputWidth), 0};
+                    maskNum.setQuad(row.m_mask);
+                    DfgAnd* const andp = new DfgAnd{dfg, flp, vecp->dtypep()};
+                    andp->lhsp(new DfgConst{dfg, flp, maskNum});
+                    andp->rhsp(vecp);
+                    DfgRedXor* const redXorp
+                        = new DfgRedXor{dfg, flp, DfgVertex::dtypeForWidth(1)};
+                    redXorp->srcp(andp);
+                    bitp = redXorp;
+                }
+                if (row.m_inv) {
+                    DfgNot* const notp = new DfgNot{dfg, flp, DfgVertex::dtypeForWidth(1)};
+                    notp->srcp(bitp);
+                    bitp = notp;
+                }
+            }
+            if (resultp) {
+                const uint32_t width = resultp->width() + 1;
+                DfgConcat* const catp = new DfgConcat{dfg, flp, DfgVertex::dtypeForWidth(width)};
+                catp->lhsp(bitp);
+                catp->rhsp(resultp);
+                bitp = catp;
+            }
+            resultp = bitp;
+        }
+        rootp->replaceWith(resultp);
+    }
+
+    // Remove the replaced networks
+    if (ctx.m_networksConverted) removeUnused(dfg);
+}
+
 void V3DfgPasses::eliminateVars(DfgGraph& dfg, V3DfgEliminateVarsContext& ctx) {
     const auto userDataInUse = dfg.userDataInUse();
 
@@ -541,6 +766,9 @@ void V3DfgPasses::optimize(DfgGraph& dfg, V3DfgContext& ctx) {
         // We just did CSE above, so without peephole there is no need to run it again these
         apply(4, "cse1            ", [&]() { cse(dfg, ctx.m_cseContext1); });
     }
+    if (v3Global.opt.fDfgParityMatrix()) {
+        apply(4, "parityMatrix    ", [&]() { parityMatrix(dfg, ctx.m_parityMatrixContext); });
+    }
     // Accumulate patterns for reporting
     if (v3Global.opt.stats()) ctx.m_patternStats.accumulate(dfg);
     apply(4, "regularize", [&]() { regularize(dfg, ctx.m_regularizeContext); });
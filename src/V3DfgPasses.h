@@ -74,6 +74,8 @@ void cse(DfgGraph&, V3DfgCseContext&) VL_MT_DISABLED;
 void inlineVars(DfgGraph&) VL_MT_DISABLED;
 // Peephole optimizations
 void peephole(DfgGraph&, V3DfgPeepholeContext&) VL_MT_DISABLED;
+// Convert XOR networks into parity of masked input vectors
+void parityMatrix(DfgGraph&, V3DfgParityMatrixContext&) VL_MT_DISABLED;
 // Regularize graph. This must be run before converting back to Ast.
 void regularize(DfgGraph&, V3DfgRegularizeContext&) VL_MT_DISABLED;
 // Remove unused nodes
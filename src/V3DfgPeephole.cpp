@@ -83,7 +83,9 @@ template <> void foldOp<DfgCLog2>      (V3Number& out, const V3Number& src) { ou
 template <> void foldOp<DfgCountOnes>  (V3Number& out, const V3Number& src) { out.opCountOnes(src); }
 template <> void foldOp<DfgExtend>     (V3Number& out, const V3Number& src) { out.opAssign(src); }
 template <> void foldOp<DfgExtendS>    (V3Number& out, const V3Number& src) { out.opExtendS(src, src.width()); }
+template <> void foldOp<DfgLeastSetBitP1>(V3Number& out, const V3Number& src) { out.opLeastSetBitP1(src); }
 template <> void foldOp<DfgLogNot>     (V3Number& out, const V3Number& src) { out.opLogNot(src); }
+template <> void foldOp<DfgMostSetBitP1>(V3Number& out, const V3Number& src) { out.opMostSetBitP1(src); }
 template <> void foldOp<DfgNegate>     (V3Number& out, const V3Number& src) { out.opNegate(src); }
 template <> void foldOp<DfgNot>        (V3Number& out, const V3Number& src) { out.opNot(src); }
 template <> void foldOp<DfgOneHot>     (V3Number& out, const V3Number& src) { out.opOneHot(src); }
@@ -254,6 +256,74 @@ class V3DfgPeephole final : public DfgVisitor {
     // caller must not do any further changes, so the caller must check the return value, otherwise
     // there will be hard to debug issues.
 
+    // Replace a priority encoder 'x[n] ? n : x[n-1] ? n-1 : ... : d', or the same with
+    // ascending bit indices, with a find first set bit operation. Return true if replaced.
+    VL_ATTR_WARN_UNUSED_RESULT bool replacePriorityEncoder(DfgCond* vtxp) {
+        // Below this many terms, the chain of conditions is no slower
+        constexpr size_t MIN_TERMS = 4;
+        if (vtxp->width() > 32) return false;
+        const DfgSel* const headSelp = vtxp->condp()->cast<DfgSel>();
+        if (!headSelp) return false;
+        DfgVertex* const fromp = headSelp->fromp();
+        const auto isTerm = [fromp](const DfgCond& cond) {
+            const DfgSel* const selp = cond.condp()->cast<DfgSel>();
+            return selp && selp->fromp() == fromp && cond.thenp()->is<DfgConst>();
+        };
+        // Only replace whole chains, starting from the head
+        if (vtxp->findSink<DfgCond>([&](const DfgCond& sink) {  //
+                return sink.elsep() == vtxp && isTerm(sink);
+            })) {
+            return false;
+        }
+        // Gather the terms, in priority order
+        std::vector<const DfgCond*> terms;
+        DfgVertex* defaultp = vtxp;
+        while (const DfgCond* const condp = defaultp->cast<DfgCond>()) {
+            if (!isTerm(*condp)) break;
+            terms.push_back(condp);
+            defaultp = condp->elsep();
+        }
+        if (terms.size() < MIN_TERMS) return false;
+        // The bit indices and values must both step by one in the same direction
+        const auto lsbOf
+            = [](const DfgCond* condp) { return condp->condp()->as<DfgSel>()->lsb(); };
+        const auto valOf
+            = [](const DfgCond* condp) { return condp->thenp()->as<DfgConst>()->toU32(); };
+        const bool lsbFirst = lsbOf(terms[1]) == lsbOf(terms[0]) + 1;
+        const uint32_t step = lsbFirst ? 1 : -1;
+        for (size_t i = 1; i < terms.size(); ++i) {
+            if (lsbOf(terms[i]) != lsbOf(terms[i - 1]) + step) return false;
+            if (valOf(terms[i]) != valOf(terms[i - 1]) + step) return false;
+        }
+
+        APPLYING(REPLACE_COND_PRIORITY_ENCODER) {
+            FileLine* const flp = vtxp->fileline();
+            const DfgCond* const lowestp = lsbFirst ? terms.front() : terms.back();
+            const uint32_t width = terms.size();
+            const uint32_t lsb = lsbOf(lowestp);
+            DfgVertex* vecp = fromp;
+            if (lsb != 0 || width != fromp->width()) {
+                vecp = make<DfgSel>(flp, dtypeForWidth(width), fromp, lsb);
+            }
+            // Index of the winning bit, plus one
+            DfgVertex* indexp = nullptr;
+            if (lsbFirst) {
+                indexp = make<DfgLeastSetBitP1>(flp, dtypeForWidth(32), vecp);
+            } else {
+                indexp = make<DfgMostSetBitP1>(flp, dtypeForWidth(32), vecp);
+            }
+            // Offset to the value of the winning term
+            DfgVertex* valuep
+                = make<DfgAdd>(flp, dtypeForWidth(32), makeI32(flp, valOf(lowestp) - 1), indexp);
+            if (vtxp->width() < 32) valuep = make<DfgSel>(vtxp, valuep, 0U);
+            DfgRedOr* const anyp = make<DfgRedOr>(flp, m_bitDType, vecp);
+            DfgCond* const replacementp = make<DfgCond>(vtxp, anyp, valuep, defaultp);
+            replace(vtxp, replacementp);
+            return true;
+        }
+        return false;
+    }
+
     // Constant fold unary vertex, return true if folded
     template <typename Vertex>
     VL_ATTR_WARN_UNUSED_RESULT bool foldUnary(Vertex* vtxp) {
@@ -673,6 +743,14 @@ class V3DfgPeephole final : public DfgVisitor {
         if (foldUnary(vtxp)) return;
     }
 
+    void visit(DfgLeastSetBitP1* vtxp) override {
+        if (foldUnary(vtxp)) return;
+    }
+
+    void visit(DfgMostSetBitP1* vtxp) override {
+        if (foldUnary(vtxp)) return;
+    }
+
     void visit(DfgExtend* vtxp) override {
         UASSERT_OBJ(vtxp->width() > vtxp->srcp()->width(), vtxp, "Invalid zero extend");
 
@@ -1550,6 +1628,8 @@ class V3DfgPeephole final : public DfgVisitor {
             }
         }
 
+        if (replacePriorityEncoder(vtxp)) return;
+
         if (DfgNot* const condNotp = condp->cast<DfgNot>()) {
             if (!condp->hasMultipleSinks() || condNotp->hasMultipleSinks()) {
                 APPLYING(SWAP_COND_WITH_NOT_CONDITION) {
@@ -87,6 +87,7 @@ public:
     V3OutCFile* m_ofp = nullptr;
     AstCFile* m_outFileNodep = nullptr;
     int m_splitSize = 0;  // # of cfunc nodes placed into output file
+    uint64_t m_compileCost = 0;  // Estimated compile cost beyond m_splitSize
     bool m_trackText = false;  // Always track AstText nodes
     // METHODS
 
@@ -113,7 +114,7 @@ public:
     // Closes current output file. Sets ofp() and outFileNodep() to nullptr.
     void closeOutputFile() {
         VL_DO_CLEAR(delete m_ofp, m_ofp = nullptr);
-        m_outFileNodep->complexityScore(m_splitSize);
+        m_outFileNodep->complexityScore(m_splitSize + m_compileCost);
         m_outFileNodep = nullptr;
     }
 
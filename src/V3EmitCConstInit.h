@@ -71,6 +71,10 @@ protected:
             ofp()->putsNoTracking("}");
         } else if (const AstUnpackArrayDType* const dtypep
                    = VN_CAST(nodep->dtypep()->skipRefp(), UnpackArrayDType)) {
+            if (dtypep->isSparse()) {
+                nodep->v3warn(E_UNSUPPORTED, "Unsupported: Constant initializer of array with"
+                                             " sparse storage (see --sparse-array-depth)");
+            }
             const uint64_t size = dtypep->elementsConst();
             const uint32_t tabMod = tabModulus(dtypep->subDTypep());
             // Note the double {{ initializer. The first { starts the initializer of the
@@ -107,7 +111,7 @@ protected:
         } else if (num.isString()) {
             // Note: putsQuoted does not track indentation, so we use this instead
             putns(nodep, "\"");
-            puts(num.toString());
+            puts(V3OutFormatter::quoteNameControls(num.toString()));
             puts("\"");
         } else if (dtypep->isWide()) {
             const uint32_t size = dtypep->widthWords();
@@ -47,6 +47,7 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
     //   %nq      emitIQW on the [node]
     //   %nw      width in bits
     //   %nW      width in words
+    //   %nT      width in words as a template argument, e.g. <4>
     //   %ni      iterate
     //  %l*     lhsp - if appropriate, then second char as above
     //  %r*     rhsp - if appropriate, then second char as above
@@ -133,6 +134,9 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
                         needComma = true;
                     }
                     break;
+                case 'T':
+                    if (lhsp->isWide()) puts("<" + cvtToStr(lhsp->widthWords()) + ">");
+                    break;
                 case 'i':
                     COMMA;
                     UASSERT_OBJ(detailp, nodep, "emitOperator() references undef node");
@@ -648,7 +652,13 @@ void EmitCFunc::emitVarReset(AstVar* varp, bool constructing) {
                                    VN_AS(valuep, Const));
             }
         } else if (AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
-            if (initarp->defaultp()) {
+            if (adtypep->isSparse()) {
+                if (!constructing) puts(varNameProtected + ".clear();\n");
+                if (initarp->defaultp()) {
+                    emitSetVarConstant(varNameProtected + ".atDefault()",
+                                       VN_AS(initarp->defaultp(), Const));
+                }
+            } else if (initarp->defaultp()) {
                 puts("for (int __Vi = 0; __Vi < " + cvtToStr(adtypep->elementsConst()));
                 puts("; ++__Vi) {\n");
                 emitSetVarConstant(varNameProtected + "[__Vi]", VN_AS(initarp->defaultp(), Const));
@@ -663,6 +673,22 @@ void EmitCFunc::emitVarReset(AstVar* varp, bool constructing) {
         } else {
             varp->v3fatalSrc("InitArray under non-arrayed var");
         }
+    } else if (constructing && v3Global.opt.allocZeroed() && !VN_IS(m_modp, Class)
+               && !varp->isFuncLocal()) {
+        // Already zeroed by the Syms allocation, so only need non-zero initial values,
+        // and random resets when they are enabled at run time
+        VL_RESTORER(m_resetZeroed);
+        VL_RESTORER(m_resetRandOnly);
+        m_resetZeroed = true;
+        m_resetRandOnly = true;
+        const string out
+            = emitVarResetRecurse(varp, constructing, varNameProtected, dtypep, 0, "");
+        if (out.empty()) return;
+        if (m_resetRandOnly) {
+            putns(varp, "if (Verilated::threadContextp()->randReset()) {\n" + out + "}\n");
+        } else {
+            putns(varp, out);
+        }
     } else {
         putns(varp, emitVarResetRecurse(varp, constructing, varNameProtected, dtypep, 0, ""));
     }
@@ -693,6 +719,7 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
     } else if (VN_IS(dtypep, ClassRefDType)) {
         return "";  // Constructor does it
     } else if (VN_IS(dtypep, IfaceRefDType)) {
+        m_resetRandOnly = false;
         return varNameProtected + suffix + " = nullptr;\n";
     } else if (const AstDynArrayDType* const adtypep = VN_CAST(dtypep, DynArrayDType)) {
         // Access std::array as C array
@@ -710,6 +737,14 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
                                      depth + 1, suffix + ".atDefault()" + cvtarray);
     } else if (VN_IS(dtypep, SampleQueueDType)) {
         return "";
+    } else if (VN_IS(dtypep, UnpackArrayDType) && VN_AS(dtypep, UnpackArrayDType)->isSparse()) {
+        // Reset the value elements not yet allocated read as, rather than each element
+        const AstUnpackArrayDType* const adtypep = VN_AS(dtypep, UnpackArrayDType);
+        const string cvtarray = (adtypep->subDTypep()->isWide() ? ".data()" : "");
+        const string pre = constructing ? "" : varNameProtected + suffix + ".clear();\n";
+        return pre
+               + emitVarResetRecurse(varp, constructing, varNameProtected, adtypep->subDTypep(),
+                                     depth + 1, suffix + ".atDefault()" + cvtarray);
     } else if (const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
         UASSERT_OBJ(adtypep->hi() >= adtypep->lo(), varp,
                     "Should have swapped msb & lsb earlier.");
@@ -757,6 +792,15 @@ string EmitCFunc::emitVarResetRecurse(const AstVar* varp, bool constructing,
                        ? (v3Global.opt.xAssign() != "unique")
                        : (v3Global.opt.xInitial() == "fast" || v3Global.opt.xInitial() == "0")));
         const bool slow = !varp->isFuncLocal() && !varp->isClassMember();
+        if (m_resetZeroed) {
+            if (!varp->valuep()
+                && (zeroit
+                    || (!dtypep->isWide() && v3Global.opt.xInitialEdge() && varp->isUsedClock()))) {
+                return "";
+            }
+            // VL_SCOPED_RAND_RESET_* returns zero when rand reset is off, others always set
+            if (varp->valuep() || varp->isXTemp()) m_resetRandOnly = false;
+        }
         splitSizeInc(1);
         if (dtypep->isWide()) {  // Handle unpacked; not basicp->isWide
             string out;
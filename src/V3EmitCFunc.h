@@ -116,12 +116,19 @@ public:
 //  Emit statements and expressions
 
 class EmitCFunc VL_NOT_FINAL : public EmitCConstInit {
+    // Function size in nodes at which the compile cost estimate doubles
+    static constexpr uint64_t COMPILE_COST_KNEE = 20000;
+    // Estimated compile cost of a wide operation beyond its node
+    static constexpr uint64_t COMPILE_COST_WIDE = 4;
+
     VMemberMap m_memberMap;
     AstVarRef* m_wideTempRefp = nullptr;  // Variable that _WW macros should be setting
     std::unordered_map<AstJumpBlock*, size_t> m_labelNumbers;  // Label numbers for JumpBlocks
     bool m_inUC = false;  // Inside an AstUCStmt or AstUCExpr
     bool m_emitConstInit = false;  // Emitting constant initializer
     bool m_createdScopeHash = false;  // Already created a scope hash
+    bool m_resetZeroed = false;  // Resetting state zeroed at allocation (--alloc-zeroed)
+    bool m_resetRandOnly = false;  // Reset being emitted only does random resets
 
     // State associated with processing $display style string formatting
     struct EmitDispState final {
@@ -176,7 +183,24 @@ public:
     // ACCESSORS
     void splitSizeInc(int count) { m_splitSize += count; }
     void splitSizeInc(AstNode* nodep) { splitSizeInc(nodep->nodeCount()); }
-    void splitSizeReset() { m_splitSize = 0; }
+    void splitSizeInc(const AstCFunc* nodep) {
+        // The C++ compiler's optimizer takes time superlinear in the size of a
+        // function, and each wide operation expands into a loop over its words,
+        // so the compile cost estimate adds both to the node count
+        int nodes = 0;
+        uint64_t wides = 0;
+        nodep->foreach([&](const AstNode* itemp) {
+            ++nodes;
+            if (VN_IS(itemp, NodeExpr) && itemp->isWide()) ++wides;
+        });
+        splitSizeInc(nodes);
+        m_compileCost += static_cast<uint64_t>(nodes) * nodes / COMPILE_COST_KNEE
+                         + wides * COMPILE_COST_WIDE;
+    }
+    void splitSizeReset() {
+        m_splitSize = 0;
+        m_compileCost = 0;
+    }
     bool splitNeeded() const {
         return v3Global.opt.outputSplit() && m_splitSize >= v3Global.opt.outputSplit();
     }
@@ -423,6 +447,11 @@ public:
 
     void visit(AstVar* nodep) override {
         UASSERT_OBJ(m_cfuncp, nodep, "Cannot emit non-local variable");
+        if (nodep->classFrame()) {
+            // Declared first so the object is destroyed after its last handle
+            putns(nodep, "VlClassFrame<" + prefixNameProtect(nodep->dtypep()) + "> __Vframe_"
+                             + nodep->nameProtect() + ";\n");
+        }
         emitVarDecl(nodep);
     }
 
@@ -459,6 +488,17 @@ public:
     }
 
     void visit(AstNodeAssign* nodep) override {
+        if (AstCNew* const cnewp = VN_CAST(nodep->rhsp(), CNew)) {
+            AstVarRef* const refp = VN_CAST(nodep->lhsp(), VarRef);
+            if (refp && refp->varp()->classFrame()) {
+                putns(nodep, "__Vframe_" + refp->varp()->nameProtect() + ".construct(");
+                iterateConst(refp);
+                puts(", " + optionalProcArg(cnewp->dtypep()) + "vlSymsp");
+                putCommaIterateNext(cnewp->argsp(), true);
+                puts(");\n");
+                return;
+            }
+        }
         bool paren = true;
         bool decind = false;
         bool rhs = true;
@@ -759,7 +799,11 @@ public:
     }
     void visit(AstCoverInc* nodep) override {
         if (nodep->declp()->size() == 1) {
-            if (v3Global.opt.threads() > 1) {
+            if (v3Global.opt.coveragePerThread()) {
+                putns(nodep, "++(vlSymsp->__Vcoverage_shadow.countsp()[");
+                puts(cvtToStr(nodep->declp()->dataDeclThisp()->binNum()));
+                puts("]);\n");
+            } else if (v3Global.opt.coverageAtomic()) {
                 putns(nodep, "vlSymsp->__Vcoverage[");
                 puts(cvtToStr(nodep->declp()->dataDeclThisp()->binNum()));
                 puts("].fetch_add(1, std::memory_order_relaxed);\n");
@@ -770,7 +814,7 @@ public:
             }
         } else {
             puts("VL_COV_TOGGLE_CHG_");
-            if (v3Global.opt.threads() > 1) {
+            if (v3Global.opt.coverageAtomic()) {
                 puts("MT_");
             } else {
                 puts("ST_");
@@ -779,7 +823,11 @@ public:
             puts("(");
             puts(cvtToStr(nodep->declp()->size()));
             puts(", ");
-            puts("vlSymsp->__Vcoverage + ");
+            if (v3Global.opt.coveragePerThread()) {
+                puts("vlSymsp->__Vcoverage_shadow.countsp() + ");
+            } else {
+                puts("vlSymsp->__Vcoverage + ");
+            }
             puts(cvtToStr(nodep->declp()->dataDeclThisp()->binNum()));
             puts(", ");
             iterateConst(nodep->toggleExprp());
@@ -946,7 +994,11 @@ public:
         emitCvtPackStr(nodep->filenamep());
         putbs(", ");
         {
-            const bool need_ptr = !VN_IS(nodep->memp()->dtypep(), AssocArrayDType);
+            // Containers are passed by reference to a template, plain arrays as void*
+            const AstUnpackArrayDType* const adtypep
+                = VN_CAST(nodep->memp()->dtypep()->skipRefp(), UnpackArrayDType);
+            const bool need_ptr = !VN_IS(nodep->memp()->dtypep(), AssocArrayDType)
+                                  && !(adtypep && adtypep->isSparse());
             if (need_ptr) puts(" &(");
             iterateAndNextConstNull(nodep->memp());
             if (need_ptr) puts(")");
@@ -1011,6 +1063,10 @@ public:
             } else if (VN_CAST(varrefp->varp()->dtypeSkipRefp(), BasicDType)) {
             } else if (const AstUnpackArrayDType* const adtypep
                        = VN_CAST(varrefp->varp()->dtypeSkipRefp(), UnpackArrayDType)) {
+                if (adtypep->isSparse()) {
+                    nodep->v3warn(E_UNSUPPORTED,
+                                  "Unsupported: $fread into array with sparse storage");
+                }
                 array_lo = adtypep->lo();
                 array_size = adtypep->elementsConst();
             } else {
@@ -1312,6 +1368,29 @@ public:
             emitOpName(nodep, nodep->emitC(), nodep->lhsp(), nodep->rhsp(), nullptr);
         }
     }
+    static void concatNOperands(AstNodeExpr* nodep, std::vector<AstNodeExpr*>& opps) {
+        if (AstConcatN* const concatp = VN_CAST(nodep, ConcatN)) {
+            concatNOperands(concatp->lhsp(), opps);
+            concatNOperands(concatp->rhsp(), opps);
+        } else {
+            opps.push_back(nodep);
+        }
+    }
+    void visit(AstConcatN* nodep) override {
+        // Emit nested string concatenations as one call, so the result is allocated once
+        std::vector<AstNodeExpr*> opps;
+        concatNOperands(nodep, opps);
+        if (opps.size() <= 2) {
+            visit(static_cast<AstNodeBiop*>(nodep));
+            return;
+        }
+        putnbs(nodep, "VL_CONCATN_MULTI(");
+        for (size_t i = 0; i < opps.size(); ++i) {
+            if (i) puts(", ");
+            iterateConst(opps[i]);
+        }
+        puts(")");
+    }
     void visit(AstNodeTriop* nodep) override {
         UASSERT_OBJ(!emitSimpleOk(nodep), nodep, "Triop cannot be described in a simple way");
         emitOpName(nodep, nodep->emitC(), nodep->lhsp(), nodep->rhsp(), nodep->thsp());
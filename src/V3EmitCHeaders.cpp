@@ -19,6 +19,7 @@
 #include "V3EmitC.h"
 #include "V3EmitCConstInit.h"
 #include "V3File.h"
+#include "V3ThreadPool.h"
 #include "V3UniqueNames.h"
 
 #include <algorithm>
@@ -52,6 +53,11 @@ class EmitCHeader final : public EmitCConstInit {
             }
         }
     }
+    void emitMemberVarDecl(const AstVar* varp) {
+        // Region boundaries chosen by V3VariableOrder
+        if (varp->alignCacheLine() && !varp->isStatic()) puts("alignas(VL_CACHE_LINE_BYTES) ");
+        emitVarDecl(varp);
+    }
     void emitDesignVarDecls(const AstNodeModule* modp) {
         bool first = true;
         std::vector<const AstVar*> varList;
@@ -88,7 +94,7 @@ class EmitCHeader final : public EmitCConstInit {
                         for (int l1 = 0; l1 < anonL1s && it != varList.cend(); ++l1) {
                             if (anonL1s != 1) puts("struct {\n");
                             for (int l0 = 0; l0 < lim && it != varList.cend(); ++l0) {
-                                emitVarDecl(*it);
+                                emitMemberVarDecl(*it);
                                 ++it;
                             }
                             if (anonL1s != 1) puts("};\n");
@@ -98,9 +104,9 @@ class EmitCHeader final : public EmitCConstInit {
                     if (anonL3s != 1) puts("};\n");
                 }
                 // Leftovers, just in case off by one error somewhere above
-                for (; it != varList.cend(); ++it) emitVarDecl(*it);
+                for (; it != varList.cend(); ++it) emitMemberVarDecl(*it);
             } else {  // Output as nonanons
-                for (const auto& pair : varList) emitVarDecl(pair);
+                for (const auto& pair : varList) emitMemberVarDecl(pair);
             }
 
             varList.clear();
@@ -175,7 +181,7 @@ class EmitCHeader final : public EmitCConstInit {
         if (v3Global.opt.coverage() && !VN_IS(modp, Class)) {
             decorateFirst(first, section);
             puts("void __vlCoverInsert(");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+            puts(v3Global.opt.coverageAtomic() ? "std::atomic<uint32_t>" : "uint32_t");
             puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp, const char* "
                  "linescovp);\n");
@@ -184,7 +190,7 @@ class EmitCHeader final : public EmitCConstInit {
         if (v3Global.opt.coverageToggle() && !VN_IS(modp, Class)) {
             decorateFirst(first, section);
             puts("void __vlCoverToggleInsert(int begin, int end, bool ranged, ");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+            puts(v3Global.opt.coverageAtomic() ? "std::atomic<uint32_t>" : "uint32_t");
             puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp);\n");
         }
@@ -584,8 +590,11 @@ class EmitCHeader final : public EmitCConstInit {
                     putns(extp, prefixNameProtect(extp->classp()));
                     needComma = true;
                 }
-            } else {
+            } else if (v3Global.opt.mtasks()) {
                 puts("public virtual VlClass");
+            } else {
+                // Single threaded, so reference counts need not be atomic
+                puts("public virtual VlClassLocal");
             }
         } else {
             puts(" final : public VerilatedModule");
@@ -617,12 +626,14 @@ class EmitCHeader final : public EmitCConstInit {
         emitTextSection(modp, VNType::atScHdrPost);
     }
 
-    explicit EmitCHeader(const AstNodeModule* modp) {
+    EmitCHeader(const AstNodeModule* modp, AstCFile*& cfilepr) {
         UINFO(5, "  Emitting header for " << prefixNameProtect(modp));
 
-        // Open output file
+        // Open output file. The AstCFile is added to the netlist by the caller,
+        // as headers of different modules are emitted in parallel.
         const string filename = v3Global.opt.makeDir() + "/" + prefixNameProtect(modp) + ".h";
-        AstCFile* const cfilep = newCFile(filename, /* slow: */ false, /* source: */ false);
+        AstCFile* const cfilep = createCFile(filename, /* slow: */ false, /* source: */ false);
+        cfilepr = cfilep;
         V3OutCFile* const ofilep
             = v3Global.opt.systemC() ? new V3OutScFile{filename} : new V3OutCFile{filename};
 
@@ -671,7 +682,9 @@ class EmitCHeader final : public EmitCConstInit {
     ~EmitCHeader() override = default;
 
 public:
-    static void main(const AstNodeModule* modp) { EmitCHeader emitCHeader{modp}; }
+    static void main(const AstNodeModule* modp, AstCFile*& cfilepr) {
+        EmitCHeader emitCHeader{modp, cfilepr};
+    }
 };
 
 //######################################################################
@@ -680,9 +693,23 @@ public:
 void V3EmitC::emitcHeaders() {
     UINFO(2, __FUNCTION__ << ":");
 
-    // Process each module in turn
+    std::vector<const AstNodeModule*> modps;
     for (const AstNode* nodep = v3Global.rootp()->modulesp(); nodep; nodep = nodep->nextp()) {
         if (VN_IS(nodep, Class)) continue;  // Declared with the ClassPackage
-        EmitCHeader::main(VN_AS(nodep, NodeModule));
+        modps.push_back(VN_AS(nodep, NodeModule));
     }
+
+    // Process each module in parallel
+    std::vector<AstCFile*> cfileps(modps.size(), nullptr);
+    {
+        V3ThreadScope threadScope;
+        for (size_t i = 0; i < modps.size(); ++i) {
+            const AstNodeModule* const modp = modps[i];
+            AstCFile*& cfilepr = cfileps[i];
+            threadScope.enqueue([modp, &cfilepr] { EmitCHeader::main(modp, cfilepr); });
+        }
+    }
+
+    // Add files in module order, so the file list is stable
+    for (AstCFile* const cfilep : cfileps) v3Global.rootp()->addFilesp(cfilep);
 }
@@ -18,9 +18,11 @@
 
 #include "V3EmitC.h"
 #include "V3EmitCFunc.h"
+#include "V3Stats.h"
 #include "V3ThreadPool.h"
 #include "V3UniqueNames.h"
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <vector>
@@ -313,11 +315,11 @@ class EmitCImp final : EmitCFunc {
         if (v3Global.opt.coverage()) {
             puts("\n// Coverage\n");
             puts("void " + prefixNameProtect(m_modp) + "::__vlCoverInsert(");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+            puts(v3Global.opt.coverageAtomic() ? "std::atomic<uint32_t>" : "uint32_t");
             puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp, const char* "
                  "linescovp) {\n");
-            if (v3Global.opt.threads() > 1) {
+            if (v3Global.opt.coverageAtomic()) {
                 puts("assert(sizeof(uint32_t) == sizeof(std::atomic<uint32_t>));\n");
                 puts("uint32_t* count32p = reinterpret_cast<uint32_t*>(countp);\n");
             } else {
@@ -346,16 +348,16 @@ class EmitCImp final : EmitCFunc {
             puts("\n// Toggle Coverage\n");
             puts("void " + prefixNameProtect(m_modp) + "::__vlCoverToggleInsert(");
             puts("int begin, int end, bool ranged, ");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+            puts(v3Global.opt.coverageAtomic() ? "std::atomic<uint32_t>" : "uint32_t");
             puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp) {\n");
-            if (v3Global.opt.threads() > 1) {
+            if (v3Global.opt.coverageAtomic()) {
                 puts("assert(sizeof(uint32_t) == sizeof(std::atomic<uint32_t>));\n");
             }
             puts("int step = (end >= begin) ? 1 : -1;\n");
             // range is inclusive
             puts("for (int i = begin; i != end + step; i += step) {\n");
-            if (v3Global.opt.threads() > 1) {
+            if (v3Global.opt.coverageAtomic()) {
                 puts("uint32_t* count32p = reinterpret_cast<uint32_t*>(countp);\n");
             } else {
                 puts("uint32_t* count32p = countp;\n");
@@ -392,6 +394,17 @@ class EmitCImp final : EmitCFunc {
         puts("}\n");
         splitSizeInc(10);
     }
+    static bool isBulkSavable(const AstVar* varp) {
+        // Unpacked array of integral elements, which has no padding
+        const AstNodeDType* elementp = varp->dtypeSkipRefp();
+        if (!VN_IS(elementp, UnpackArrayDType)) return false;
+        while (const AstUnpackArrayDType* const arrayp = VN_CAST(elementp, UnpackArrayDType)) {
+            if (arrayp->isSparse()) return false;
+            elementp = arrayp->subDTypep()->skipRefp();
+        }
+        const AstBasicDType* const basicp = elementp->basicp();
+        return basicp && !basicp->isOpaque() && elementp->isIntegralOrPacked();
+    }
     void emitSavableImp(const AstNodeModule* modp) {
         if (v3Global.opt.savable()) {
             puts("\n// Savable\n");
@@ -436,11 +449,23 @@ class EmitCImp final : EmitCFunc {
                         } else if (varp->isStatic() && varp->isConst()) {
                         } else if (varp->basicp() && varp->basicp()->isTriggerVec()) {
                         } else if (VN_IS(varp->dtypep(), NBACommitQueueDType)) {
+                        } else if (isBulkSavable(varp)) {
+                            // Elements are contiguous, so copy in one block,
+                            // making the same bytes as saving each element
+                            const string name = varp->nameProtect();
+                            putns(varp, "os."s + (de ? "read" : "write") + "(&" + name
+                                            + ", sizeof(" + name + "));\n");
                         } else {
                             int vects = 0;
+                            bool sparse = false;
                             AstNodeDType* elementp = varp->dtypeSkipRefp();
                             for (AstUnpackArrayDType* arrayp = VN_CAST(elementp, UnpackArrayDType);
                                  arrayp; arrayp = VN_CAST(elementp, UnpackArrayDType)) {
+                                // Sparse arrays save their allocated pages as a whole
+                                if (arrayp->isSparse()) {
+                                    sparse = true;
+                                    break;
+                                }
                                 const int vecnum = vects++;
                                 UASSERT_OBJ(arrayp->hi() >= arrayp->lo(), varp,
                                             "Should have swapped msb & lsb earlier.");
@@ -455,7 +480,7 @@ class EmitCImp final : EmitCFunc {
                             if (basicp && basicp->keyword().isMTaskState()) continue;
                             // Want to detect types that are represented as arrays
                             // (i.e. packed types of more than 64 bits).
-                            if (elementp->isWide()
+                            if (!sparse && elementp->isWide()
                                 && !(basicp && basicp->keyword() == VBasicDTypeKwd::STRING)) {
                                 const int vecnum = vects++;
                                 const string ivar = "__Vi"s + cvtToStr(vecnum);
@@ -561,6 +586,10 @@ class EmitCImp final : EmitCFunc {
             V3Hash hash;
             for (const string& name : *m_requiredHeadersp) hash += name;
             m_subFileName = "DepSet_" + hash.toString();
+            if (v3Global.opt.outputSplitStable()) {
+                emitCFuncsStable(pair.second);
+                continue;
+            }
             // Open output file
             openNextOutputFile(*m_requiredHeadersp, m_subFileName);
             // Emit functions in this dependency set
@@ -574,9 +603,43 @@ class EmitCImp final : EmitCFunc {
         }
     }
 
+    void emitCFuncsStable(std::vector<AstCFunc*> funcps) {
+        // Split the functions sorted by name into files, ending a file only before a function
+        // whose name hashes to a boundary, once the file is large enough. This way an edit to
+        // a function moves at most the boundaries next to it, and the other files, named by
+        // their first function, are unchanged.
+        std::stable_sort(funcps.begin(), funcps.end(), [](const AstCFunc* ap, const AstCFunc* bp) {
+            return ap->name() < bp->name();
+        });
+        const int splitSize = v3Global.opt.outputSplit();
+        auto it = funcps.begin();
+        while (it != funcps.end()) {
+            auto endIt = it + 1;
+            if (splitSize) {
+                int size = (*it)->nodeCount();
+                for (; endIt != funcps.end(); ++endIt) {
+                    if (size >= splitSize * 2) break;
+                    if (size >= splitSize / 2 && V3Hash{(*endIt)->name()}.value() % 4 == 0) break;
+                    size += (*endIt)->nodeCount();
+                }
+            } else {
+                endIt = funcps.end();
+            }
+            if (endIt != funcps.end()) v3Global.useParallelBuild(true);
+            openNextOutputFile(*m_requiredHeadersp,
+                               m_subFileName + "__" + V3Hash{(*it)->name()}.toString());
+            for (; it != endIt; ++it) {
+                VL_RESTORER(m_modp);
+                m_modp = EmitCParentModule::get(*it);
+                iterateConst(*it);
+            }
+            closeOutputFile();
+        }
+    }
+
     // VISITORS
     void visit(AstCFunc* nodep) override {
-        if (splitNeeded()) {
+        if (!v3Global.opt.outputSplitStable() && splitNeeded()) {
             // Splitting file, so using parallel build.
             v3Global.useParallelBuild(true);
             // Close old file
@@ -1056,9 +1119,17 @@ void V3EmitC::emitcImp() {
     }
     // Wait for futures
     threadScope.wait();
+    uint64_t totalCost = 0;
+    uint64_t maxCost = 0;
     for (const auto& collr : cfiles) {
-        for (const auto cfilep : collr) v3Global.rootp()->addFilesp(cfilep);
+        for (const auto cfilep : collr) {
+            totalCost += cfilep->complexityScore();
+            maxCost = std::max(maxCost, cfilep->complexityScore());
+            v3Global.rootp()->addFilesp(cfilep);
+        }
     }
+    V3Stats::addStat("Compile cost, predicted total", totalCost);
+    V3Stats::addStat("Compile cost, predicted largest file", maxCost);
 }
 
 void V3EmitC::emitcFiles() {
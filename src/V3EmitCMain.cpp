@@ -22,6 +22,8 @@
 #include "V3EmitCBase.h"
 
 #include <map>
+#include <utility>
+#include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -36,7 +38,13 @@ class EmitCMain final : EmitCBaseVisitorConst {
 
 public:
     // CONSTRUCTORS
-    EmitCMain() { emitInt(); }
+    EmitCMain() {
+        if (v3Global.opt.mainFuzz()) {
+            emitFuzz();
+        } else {
+            emitInt();
+        }
+    }
 
 private:
     // MAIN METHOD
@@ -117,6 +125,175 @@ private:
 
         setOutputFile(nullptr);
     }
+
+    void emitFuzz() {
+        const string filename = v3Global.opt.makeDir() + "/" + topClassName() + "__main.cpp";
+        AstCFile* const cfilep = newCFile(filename, false /*slow*/, true /*source*/);
+        V3OutCFile cf{filename};
+        setOutputFile(&cf, cfilep);
+
+        v3Global.opt.addCFlags("-DVL_TIME_CONTEXT");
+
+        string topName = v3Global.opt.mainTopName();
+        if (topName == "-") topName = "";
+        const bool savable = v3Global.opt.savable();
+        const bool coverage = v3Global.opt.coverage();
+
+        // Inputs driven from the fuzz data, and their byte offset in each cycle
+        std::vector<std::pair<const AstVar*, int>> inputs;
+        int cycleBytes = 0;
+        for (const AstNode* nodep = v3Global.rootp()->topModulep()->stmtsp(); nodep;
+             nodep = nodep->nextp()) {
+            const AstVar* const varp = VN_CAST(nodep, Var);
+            if (!varp || !varp->isPrimaryIO() || !varp->isNonOutput()) continue;
+            if (varp->isSc() || !varp->dtypeSkipRefp()->isIntegralOrPacked()) continue;
+            inputs.emplace_back(varp, cycleBytes);
+            cycleBytes += (varp->width() + 7) / 8;
+        }
+
+        // Heavily commented output, as users are likely to look at or copy this code
+        ofp()->putsHeader();
+        puts("// DESCRIPTION: libFuzzer entry point, created with Verilator --main-fuzz\n");
+        puts("//\n");
+        puts("// Each fuzz input is split into cycles of vlFuzzCycleBytes bytes, which\n");
+        puts("// set the top-level inputs before each eval().  Build with\n");
+        puts("// -CFLAGS -fsanitize=fuzzer -LDFLAGS -fsanitize=fuzzer using clang.\n");
+        puts("\n");
+
+        puts("#include \"verilated.h\"\n");
+        if (savable) puts("#include \"verilated_save.h\"\n");
+        puts("#include \"" + topClassName() + ".h\"\n");
+        puts("\n");
+        puts("#include <cstdint>\n");
+        puts("#include <memory>\n");
+        if (coverage) puts("#include <vector>\n");
+
+        puts("\n//======================\n\n");
+
+        puts("// Bytes of fuzz data consumed by each cycle\n");
+        puts("static constexpr size_t vlFuzzCycleBytes = " + cvtToStr(std::max(cycleBytes, 1))
+             + ";\n");
+        puts("\n");
+        if (coverage) {
+            puts("// Verilator coverage points hit by the last input, folded by point\n");
+            puts("// number, which libFuzzer reads as extra edge coverage\n");
+            puts("#ifdef __linux__\n");
+            puts("__attribute__((section(\"__libfuzzer_extra_counters\")))\n");
+            puts("#endif\n");
+            puts("static uint8_t vlFuzzCoverage[65536];\n");
+            puts("\n");
+        }
+        puts("// Return 'bytes' bytes of fuzz data as an integer\n");
+        puts("static inline QData vlFuzzValue(const uint8_t* datap, int bytes) {\n");
+        puts("QData value = 0;\n");
+        puts("for (int i = 0; i < bytes; ++i) {\n");
+        puts("value |= static_cast<QData>(datap[i]) << (i * 8);\n");
+        puts("}\n");
+        puts("return value;\n");
+        puts("}\n");
+        puts("\n");
+
+        puts("namespace {\n");
+        puts("struct VlFuzzState final {\n");
+        puts("std::unique_ptr<VerilatedContext> contextp;\n");
+        puts("std::unique_ptr<" + topClassName() + "> topp;\n");
+        if (savable) puts("VerilatedSaveMem resetState;  // Model state after construction\n");
+        if (coverage) puts("std::vector<uint64_t> counts;  // Coverage point counts\n");
+        puts("void construct() {\n");
+        puts("topp.reset();\n");
+        puts("contextp.reset(new VerilatedContext);\n");
+        puts("topp.reset(new " + topClassName() + "{contextp.get(), \"" + topName + "\"});\n");
+        puts("}\n");
+        puts("VlFuzzState() {\n");
+        puts("Verilated::debug(0);\n");
+        puts("construct();\n");
+        if (savable) {
+            puts("resetState.open();\n");
+            puts("resetState << *topp;\n");
+            puts("resetState.close();\n");
+        }
+        puts("}\n");
+        puts("};\n");
+        puts("}  // namespace\n");
+        puts("\n");
+
+        puts("extern \"C\" int LLVMFuzzerTestOneInput(const uint8_t* datap, size_t size) {\n");
+        puts("static VlFuzzState s;\n");
+        if (savable) {
+            puts("// Rewind the model to its state after construction\n");
+            puts("{\n");
+            puts("VerilatedRestoreMem is;\n");
+            puts("is.open(s.resetState.data());\n");
+            puts("is >> *s.topp;\n");
+            puts("is.close();\n");
+            puts("}\n");
+        } else {
+            puts("// Rebuild the model; Verilate with --savable to rewind it instead\n");
+            puts("static bool first = true;\n");
+            puts("if (!first) s.construct();\n");
+            puts("first = false;\n");
+        }
+        puts("VerilatedContext* const contextp = s.contextp.get();\n");
+        puts(topClassName() + "* const topp = s.topp.get();\n");
+        puts("\n");
+
+        puts("// Simulate one cycle for each vlFuzzCycleBytes of data, until $finish\n");
+        puts("for (; size >= vlFuzzCycleBytes && VL_LIKELY(!contextp->gotFinish());\n");
+        puts("datap += vlFuzzCycleBytes, size -= vlFuzzCycleBytes) {\n");
+        puts(/**/ "// Set inputs\n");
+        for (const auto& pair : inputs) {
+            const AstVar* const varp = pair.first;
+            const int offset = pair.second;
+            const string name = "topp->" + varp->nameProtect();
+            if (varp->isWide()) {
+                for (int word = 0; word < varp->widthWords(); ++word) {
+                    const int bytes = std::min(VL_EDATASIZE / 8, (varp->width() + 7) / 8
+                                                                     - word * (VL_EDATASIZE / 8));
+                    string value = "static_cast<EData>(vlFuzzValue(datap + "
+                                   + cvtToStr(offset + word * (VL_EDATASIZE / 8)) + ", "
+                                   + cvtToStr(bytes) + "))";
+                    if (word == varp->widthWords() - 1) {
+                        value += " & VL_MASK_E(" + cvtToStr(varp->width()) + ")";
+                    }
+                    putns(varp, name + "[" + cvtToStr(word) + "] = " + value + ";\n");
+                }
+            } else {
+                putns(varp, name + " = vlFuzzValue(datap + " + cvtToStr(offset) + ", "
+                                + cvtToStr((varp->width() + 7) / 8) + ") & VL_MASK_Q("
+                                + cvtToStr(varp->width()) + ");\n");
+            }
+        }
+        puts(/**/ "// Evaluate model\n");
+        puts(/**/ "topp->eval();\n");
+        puts(/**/ "// Advance time\n");
+        if (v3Global.rootp()->delaySchedulerp()) {
+            puts("if (topp->eventsPending()) {\n");
+            puts("contextp->time(topp->nextTimeSlot());\n");
+            puts("} else {\n");
+            puts("contextp->timeInc(1);\n");
+            puts("}\n");
+        } else {
+            puts("contextp->timeInc(1);\n");
+        }
+        puts("}\n");
+        puts("\n");
+
+        if (coverage) {
+            puts("// Report coverage points hit to libFuzzer\n");
+            puts("contextp->coveragep()->counts(s.counts);\n");
+            puts("for (size_t i = 0; i < s.counts.size(); ++i) {\n");
+            puts("const uint8_t hits = s.counts[i] > 255 ? 255 : s.counts[i];\n");
+            puts("uint8_t& hitr = vlFuzzCoverage[i % sizeof(vlFuzzCoverage)];\n");
+            puts("if (hitr < hits) hitr = hits;\n");
+            puts("}\n");
+            puts("\n");
+        }
+
+        puts("return 0;\n");
+        puts("}\n");
+
+        setOutputFile(nullptr);
+    }
 };
 
 //######################################################################
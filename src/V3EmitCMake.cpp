@@ -114,6 +114,8 @@ class CMakeEmitter final {
 
         *of << "# SystemC output mode?  0/1 (from --sc)\n";
         cmake_set_raw(*of, name + "_SC", v3Global.opt.systemC() ? "1" : "0");
+        *of << "# C++ compiler profile-guided optimization  generate/use (from --compiler-pgo)\n";
+        cmake_set(*of, name + "_PGO", v3Global.opt.compilerPgo());
         *of << "# Coverage output mode?  0/1 (from --coverage)\n";
         cmake_set_raw(*of, name + "_COVERAGE", v3Global.opt.coverage() ? "1" : "0");
         *of << "# Timing mode?  0/1\n";
@@ -126,6 +128,8 @@ class CMakeEmitter final {
         cmake_set_raw(*of, name + "_TRACE_SAIF", (v3Global.opt.traceEnabledSaif()) ? "1" : "0");
         *of << "# VCD Tracing output mode?  0/1 (from --trace-vcd)\n";
         cmake_set_raw(*of, name + "_TRACE_VCD", (v3Global.opt.traceEnabledVcd()) ? "1" : "0");
+        *of << "# VTC Tracing output mode?  0/1 (from --trace-vtc)\n";
+        cmake_set_raw(*of, name + "_TRACE_VTC", (v3Global.opt.traceEnabledVtc()) ? "1" : "0");
 
         *of << "\n### Sources...\n";
         std::vector<string> classes_fast;
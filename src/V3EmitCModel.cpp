@@ -75,6 +75,7 @@ class EmitCModel final : public EmitCFunc {
         puts("#include \"verilated.h\"\n");
         if (v3Global.opt.mtasks()) puts("#include \"verilated_threads.h\"\n");
         if (v3Global.opt.savable()) puts("#include \"verilated_save.h\"\n");
+        if (v3Global.opt.inputLog()) puts("#include \"verilated_input_log.h\"\n");
         if (v3Global.opt.coverage()) puts("#include \"verilated_cov.h\"\n");
         if (v3Global.dpi()) puts("#include \"svdpi.h\"\n");
 
@@ -99,6 +100,10 @@ class EmitCModel final : public EmitCFunc {
 
         puts("// Symbol table holding complete model state (owned by this class)\n");
         puts(symClassName() + "* const vlSymsp;\n");
+        if (v3Global.opt.inputLog()) {
+            puts("// Input record or replay log, if any (owned by this class)\n");
+            puts("VerilatedInputLog* __Vm_inputLogp = nullptr;\n");
+        }
 
         puts("\n");
         ofp()->putsPrivate(false);  // public:
@@ -130,7 +135,10 @@ class EmitCModel final : public EmitCFunc {
                 }
             }
         }
-        if (optSystemC() && v3Global.usesTiming()) puts("sc_core::sc_event trigger_eval;\n");
+        if (optSystemC() && v3Global.usesTiming()) {
+            puts("sc_core::sc_event trigger_eval;\n");
+            puts("sc_dt::uint64 last_eval_delta = ~0ULL;  ///< Delta count of last eval_step\n");
+        }
 
         // Cells instantiated by the top level (for access to /* verilator public */)
         puts("\n// CELLS\n"
@@ -199,6 +207,10 @@ class EmitCModel final : public EmitCFunc {
             } else {
                 puts(";\n");
             }
+            puts("/// Run with the free-running clock 'clk', toggled every 'halfPeriod' time\n");
+            puts("/// units, for 'cycles' cycles or until $finish. Timed events between\n");
+            puts("/// edges are evaluated in order. Returns the number of cycles run.\n");
+            puts("uint64_t evalClock(CData& clk, uint64_t halfPeriod, uint64_t cycles);\n");
         }
         if (!optSystemC()) {
             puts("/// Simulation complete, run final blocks.  Application "
@@ -239,6 +251,20 @@ class EmitCModel final : public EmitCFunc {
             }
         }
 
+        if (v3Global.opt.inputLog()) {
+            puts("\n");
+            puts("/// Record the inputs of each eval() to the given log file.\n");
+            puts("/// Returns false if the file could not be opened.\n");
+            puts("bool inputLogRecord(const char* filenamep);\n");
+            puts("/// Open a log from inputLogRecord() to replay with inputLogStep().\n");
+            puts("/// Records before the current time, e.g. of a restored checkpoint,\n");
+            puts("/// only set the inputs.  Returns false if the file could not be opened.\n");
+            puts("bool inputLogReplay(const char* filenamep);\n");
+            puts("/// Set time and inputs from the next replayed record, and evaluate.\n");
+            puts("/// Returns false at the end of the log.\n");
+            puts("bool inputLogStep();\n");
+        }
+
         if (v3Global.opt.savable()) {
             puts("\n");
             puts("// Serialization functions\n");
@@ -246,6 +272,9 @@ class EmitCModel final : public EmitCFunc {
                  + topClassName() + "& rhs);\n");
             puts("friend VerilatedDeserialize& operator>>(VerilatedDeserialize& os, "
                  + topClassName() + "& rhs);\n");
+            puts("/// Copy the state of another instance of this model, such as one that\n");
+            puts("/// is already initialized, without evaluating initial logic again\n");
+            puts("void copyStateFrom(" + topClassName() + "& fromr);\n");
         }
 
         puts("\n// Abstract methods from VerilatedModel\n");
@@ -281,11 +310,13 @@ class EmitCModel final : public EmitCFunc {
         if (optSystemC()) {
             puts("(sc_core::sc_module_name /* unused */)\n");
             puts("    : VerilatedModel{*Verilated::threadContextp()}\n");
-            puts("    , vlSymsp{new " + symClassName() + "(contextp(), name(), this)}\n");
+            puts("    , vlSymsp{new (contextp()) " + symClassName()
+                 + "(contextp(), name(), this)}\n");
         } else {
             puts(+"(VerilatedContext* _vcontextp__, const char* _vcname__)\n");
             puts("    : VerilatedModel{*_vcontextp__}\n");
-            puts("    , vlSymsp{new " + symClassName() + "(contextp(), _vcname__, this)}\n");
+            puts("    , vlSymsp{new (contextp()) " + symClassName()
+                 + "(contextp(), _vcname__, this)}\n");
         }
 
         // Set up IO references
@@ -366,10 +397,44 @@ class EmitCModel final : public EmitCFunc {
 
         puts("\n");
         puts(topClassName() + "::~" + topClassName() + "() {\n");
+        if (v3Global.opt.inputLog()) puts("delete __Vm_inputLogp;\n");
         puts("delete vlSymsp;\n");
         puts("}\n");
     }
 
+    void emitInputLogImplementation(AstNodeModule* modp) {
+        putSectionDelimiter("Input record and replay");
+
+        for (const bool replay : {false, true}) {
+            puts("\n");
+            putns(modp, "bool " + topClassName() + "::"
+                            + (replay ? "inputLogReplay" : "inputLogRecord")
+                            + "(const char* filenamep) {\n");
+            puts("delete __Vm_inputLogp;\n");
+            puts("__Vm_inputLogp = new VerilatedInputLog{filenamep, "s
+                 + (replay ? "true" : "false") + "};\n");
+            for (const AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
+                const AstVar* const varp = VN_CAST(nodep, Var);
+                if (!varp || !varp->isPrimaryIO() || !varp->isNonOutput()) continue;
+                const string protName = varp->nameProtect();
+                putns(varp, "__Vm_inputLogp->addInput(&" + protName + ", sizeof(" + protName
+                                + "));\n");
+            }
+            if (replay) puts("__Vm_inputLogp->replaySkip(contextp()->time());\n");
+            puts("return __Vm_inputLogp->isOpen();\n");
+            puts("}\n");
+        }
+
+        puts("\n");
+        putns(modp, "bool " + topClassName() + "::inputLogStep() {\n");
+        puts("uint64_t time;\n");
+        puts("if (!__Vm_inputLogp || !__Vm_inputLogp->replay(time)) return false;\n");
+        puts("contextp()->time(time);\n");
+        puts("eval();\n");
+        puts("return true;\n");
+        puts("}\n");
+    }
+
     void emitStandardMethods1(AstNodeModule* modp) {
         UASSERT_OBJ(modp->isTop(), modp, "Attempting to emitWrapEval for non-top class");
 
@@ -392,7 +457,12 @@ class EmitCModel final : public EmitCFunc {
         if (optSystemC() && v3Global.usesTiming()) {
             // ::eval
             puts("\nvoid " + topClassName() + "::eval() {\n");
+            putsDecoration(nullptr,
+                           "// Inputs only change between deltas; evaluate at most once per delta\n");
+            puts("if (last_eval_delta != sc_core::sc_delta_count()) {\n");
+            puts("last_eval_delta = sc_core::sc_delta_count();\n");
             puts("eval_step();\n");
+            puts("}\n");
             puts("if (eventsPending()) {\n");
             puts("sc_core::sc_time dt = sc_core::sc_time::from_value(nextTimeSlot() - "
                  "contextp()->time());\n");
@@ -421,6 +491,12 @@ class EmitCModel final : public EmitCFunc {
 
         if (v3Global.opt.trace()) puts("vlSymsp->__Vm_activity = true;\n");
 
+        if (v3Global.opt.inputLog()) {
+            puts("if (VL_UNLIKELY(__Vm_inputLogp && !__Vm_inputLogp->replaying())) {\n");
+            puts("__Vm_inputLogp->record(contextp()->time());\n");
+            puts("}\n");
+        }
+
         if (v3Global.hasEvents()) puts("vlSymsp->clearTriggeredEvents();\n");
         if (v3Global.hasClasses()) puts("vlSymsp->__Vm_deleter.deleteAll();\n");
 
@@ -462,6 +538,33 @@ class EmitCModel final : public EmitCFunc {
             puts("}\n");
         }
 
+        // ::evalClock
+        if (!optSystemC()) {
+            puts("\n");
+            putns(modp, "uint64_t " + topClassName()
+                            + "::evalClock(CData& clk, uint64_t halfPeriod, uint64_t cycles) {\n");
+            puts("VerilatedContext* const contextp = this->contextp();\n");
+            puts("uint64_t cycle = 0;\n");
+            puts("for (; cycle < cycles && !contextp->gotFinish(); ++cycle) {\n");
+            puts("for (int edge = 0; edge < 2; ++edge) {\n");
+            puts("const uint64_t edgeTime = contextp->time() + halfPeriod;\n");
+            putsDecoration(nullptr, "// Timed events before the edge\n");
+            puts("while (eventsPending() && nextTimeSlot() < edgeTime) {\n");
+            puts("contextp->time(nextTimeSlot());\n");
+            puts("eval_step();\n");
+            puts("eval_end_step();\n");
+            puts("if (VL_UNLIKELY(contextp->gotFinish())) return cycle;\n");
+            puts("}\n");
+            puts("contextp->time(edgeTime);\n");
+            puts("clk = !clk;\n");
+            puts("eval_step();\n");
+            puts("eval_end_step();\n");
+            puts("}\n");
+            puts("}\n");
+            puts("return cycle;\n");
+            puts("}\n");
+        }
+
         putSectionDelimiter("Events and timing");
         if (auto* const delaySchedp = v3Global.rootp()->delaySchedulerp()) {
             putns(modp, "bool " + topClassName() + "::eventsPending() { return !vlSymsp->TOP.");
@@ -503,9 +606,13 @@ class EmitCModel final : public EmitCFunc {
                         + "::hierName() const { return vlSymsp->name(); }\n");
         putns(modp, "const char* " + topClassName() + "::modelName() const { return \""
                         + topClassName() + "\"; }\n");
-        const int threads = v3Global.opt.hierChild()
-                                ? v3Global.opt.threads()
-                                : std::max(v3Global.opt.threads(), v3Global.opt.hierThreads());
+        int threads = v3Global.opt.hierChild()
+                          ? v3Global.opt.threads()
+                          : std::max(v3Global.opt.threads(), v3Global.opt.hierThreads());
+        // Parallel VCD tracing runs on the context thread pool, so might need more threads
+        if (v3Global.opt.useTraceParallel()) {
+            threads = std::max(threads, static_cast<int>(v3Global.opt.vmTraceThreads()));
+        }
         putns(modp, "unsigned " + topClassName() + "::threads() const { return "
                         + cvtToStr(threads) + "; }\n");
         putns(modp, "void " + topClassName()
@@ -613,6 +720,16 @@ class EmitCModel final : public EmitCFunc {
         puts(/**/ "rhs.vlSymsp->" + protect("__Vdeserialize") + "(os);\n");
         puts(/**/ "return os;\n");
         puts("}\n");
+
+        puts("\nvoid " + topClassName() + "::copyStateFrom(" + topClassName() + "& fromr) {\n");
+        puts(/**/ "VerilatedSaveMem snapshot;\n");
+        puts(/**/ "snapshot.open();\n");
+        puts(/**/ "snapshot << fromr;\n");
+        puts(/**/ "snapshot.close();\n");
+        puts(/**/ "VerilatedRestoreMem os;\n");
+        puts(/**/ "os.open(snapshot.data());\n");
+        puts(/**/ "os >> *this;\n");
+        puts("}\n");
     }
 
     void emitImplementation(AstNodeModule* modp) {
@@ -638,6 +755,7 @@ class EmitCModel final : public EmitCFunc {
         emitStandardMethods1(modp);
         emitStandardMethods2(modp);
         if (v3Global.opt.trace()) emitTraceMethods(modp);
+        if (v3Global.opt.inputLog()) emitInputLogImplementation(modp);
         if (v3Global.opt.savable()) emitSerializationFunctions();
 
         closeOutputFile();
@@ -366,10 +366,20 @@ class EmitCSyms final : EmitCBaseVisitorConst {
             }
         }
     }
+    static bool hasSparse(const AstVar* varp) {
+        const AstNodeDType* dtypep = varp->dtypeSkipRefp();
+        while (const AstUnpackArrayDType* const adtypep = VN_CAST(dtypep, UnpackArrayDType)) {
+            if (adtypep->isSparse()) return true;
+            dtypep = adtypep->subDTypep()->skipRefp();
+        }
+        return false;
+    }
     void visit(AstVar* nodep) override {
         nameCheck(nodep);
         iterateChildrenConst(nodep);
-        if ((nodep->isSigUserRdPublic() || nodep->isSigUserRWPublic()) && !m_cfuncp)
+        // Sparse arrays have no flat storage the VPI could address
+        if ((nodep->isSigUserRdPublic() || nodep->isSigUserRWPublic()) && !m_cfuncp
+            && !hasSparse(nodep))
             m_modVars.emplace_back(m_modp, nodep);
     }
     void visit(AstVarScope* nodep) override {
@@ -489,6 +499,7 @@ void EmitCSyms::emitSymHdr() {
         puts("bool __Vm_even_cycle__ico = false;\n");
         puts("bool __Vm_even_cycle__act = false;\n");
         puts("bool __Vm_even_cycle__nba = false;\n");
+        if (v3Global.opt.threadsRebalance()) puts("VlDynamicScheduler __Vm_dynamicScheduler;\n");
     }
 
     if (v3Global.opt.profExec()) {
@@ -508,15 +519,23 @@ void EmitCSyms::emitSymHdr() {
 
     if (m_coverBins) {
         puts("\n// COVERAGE\n");
-        puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+        puts(v3Global.opt.coverageAtomic() ? "std::atomic<uint32_t>" : "uint32_t");
         puts(" __Vcoverage[");
         puts(cvtToStr(m_coverBins));
         puts("];\n");
+        if (v3Global.opt.coveragePerThread()) puts("VlCoverShadow __Vcoverage_shadow;\n");
     }
 
     if (v3Global.opt.profPgo()) {
         puts("\n// PGO PROFILING\n");
-        puts("VlPgoProfiler<" + std::to_string(ExecMTask::numUsedIds()) + "> _vm_pgoProfiler;\n");
+        puts("VlPgoProfiler<" + std::to_string(ExecMTask::numUsedIds()) + ", "
+             + std::to_string(v3Global.pgoBranchNames().size()) + "> _vm_pgoProfiler;\n");
+    }
+
+    if (v3Global.opt.profBlocks()) {
+        puts("\n// BLOCK PROFILING\n");
+        puts("VlBlockProfiler<" + std::to_string(v3Global.profBlockNames().size())
+             + "> __Vm_blockProfiler;\n");
     }
 
     if (!m_scopeNames.empty()) {  // Scope names
@@ -536,6 +555,13 @@ void EmitCSyms::emitSymHdr() {
     puts(symClassName() + "(VerilatedContext* contextp, const char* namep, " + topClassName()
          + "* modelp);\n");
     puts("~"s + symClassName() + "();\n");
+    // Always zeroed so --alloc-zeroed constructors need only reset state that
+    // isn't zero, see EmitCFunc::emitVarReset; context selects huge pages
+    puts("static void* operator new(size_t size, VerilatedContext* contextp) {\n");
+    puts("return allocZeroed(size, contextp);\n");
+    puts("}\n");
+    puts("static void operator delete(void* ptr) { freeZeroed(ptr); }\n");
+    puts("static void operator delete(void* ptr, VerilatedContext*) { freeZeroed(ptr); }\n");
 
     for (const auto& i : m_usesVfinal) {
         puts("void " + symClassName() + "_" + cvtToStr(i.first) + "(");
@@ -738,6 +764,13 @@ void EmitCSyms::emitSymImp() {
         puts("_vm_pgoProfiler.write(\"" + topClassName()
              + "\", _vm_contextp__->profVltFilename(), " + firstHierCall + ");\n");
     }
+    if (v3Global.opt.profBlocks()) {
+        // Do not overwrite data during the last hierarchical stage.
+        const string firstHierCall
+            = (v3Global.opt.hierBlocks().empty() || v3Global.opt.hierChild()) ? "true" : "false";
+        puts("__Vm_blockProfiler.write(\"" + topClassName()
+             + "\", _vm_contextp__->profBlocksFilename(), " + firstHierCall + ");\n");
+    }
     puts("}\n");
 
     if (v3Global.needTraceDumper()) {
@@ -824,6 +857,12 @@ void EmitCSyms::emitSymImp() {
         puts("}\n");
         ++m_numStmts;
     }
+    if (m_coverBins && v3Global.opt.coveragePerThread()) {
+        // One copy for each pool worker, plus one for the thread calling eval()
+        puts("    , __Vcoverage_shadow{contextp->coveragep(), __Vcoverage, ");
+        puts(cvtToStr(m_coverBins));
+        puts(", static_cast<size_t>(__Vm_threadPoolp->numThreads()) + 1}\n");
+    }
     puts("{\n");
 
     {
@@ -847,6 +886,20 @@ void EmitCSyms::emitSymImp() {
                 }
             });
         }
+        const std::vector<std::string>& names = v3Global.pgoBranchNames();
+        for (size_t i = 0; i < names.size(); ++i) {
+            puts("_vm_pgoProfiler.addBranch(" + cvtToStr(i) + ", \""
+                 + V3OutFormatter::quoteNameControls(names[i]) + "\");\n");
+        }
+    }
+
+    if (v3Global.opt.profBlocks()) {
+        puts("// Configure profiling of source blocks\n");
+        const std::vector<std::string>& names = v3Global.profBlockNames();
+        for (size_t i = 0; i < names.size(); ++i) {
+            puts("__Vm_blockProfiler.addCounter(" + cvtToStr(i) + ", \""
+                 + V3OutFormatter::quoteNameControls(names[i]) + "\");\n");
+        }
     }
 
     puts("// Configure time unit / time precision\n");
@@ -940,78 +993,98 @@ void EmitCSyms::emitSymImp() {
         }
         // It would be less code if each module inserted its own variables.
         // Someday.  For now public isn't common.
-        for (auto it = m_scopeVars.begin(); it != m_scopeVars.end(); ++it) {
+        // Each scope's variables are inserted from a constant table sorted by name
+        std::map<std::string, std::vector<const ScopeVarData*>> varsByScope;
+        for (const auto& itr : m_scopeVars) {
+            varsByScope[itr.second.m_scopeName].push_back(&itr.second);
+        }
+        for (auto& itr : varsByScope) {
+            std::vector<const ScopeVarData*>& vars = itr.second;
+            std::stable_sort(vars.begin(), vars.end(),
+                             [this](const ScopeVarData* ap, const ScopeVarData* bp) {
+                                 return protect(ap->m_varBasePretty)
+                                        < protect(bp->m_varBasePretty);
+                             });
             checkSplit(true);
-            AstScope* const scopep = it->second.m_scopep;
-            AstVar* const varp = it->second.m_varp;
-            int pdim = 0;
-            int udim = 0;
-            string bounds;
-            if (AstBasicDType* const basicp = varp->basicp()) {
-                // Range is always first, it's not in "C" order
-                for (AstNodeDType* dtypep = varp->dtypep(); dtypep;) {
-                    dtypep
-                        = dtypep->skipRefp();  // Skip AstRefDType/AstTypedef, or return same node
-                    if (const AstNodeArrayDType* const adtypep = VN_CAST(dtypep, NodeArrayDType)) {
-                        bounds += " ,";
-                        bounds += cvtToStr(adtypep->left());
-                        bounds += ",";
-                        bounds += cvtToStr(adtypep->right());
-                        if (VN_IS(dtypep, PackArrayDType))
-                            pdim++;
-                        else
-                            udim++;
-                        dtypep = adtypep->subDTypep();
-                    } else {
-                        if (basicp->isRanged()) {
-                            bounds += " ,";
-                            bounds += cvtToStr(basicp->left());
-                            bounds += ",";
-                            bounds += cvtToStr(basicp->right());
-                            pdim++;
+            puts("{\n");
+            std::vector<int> ranges;
+            std::string decls;
+            for (const ScopeVarData* const datap : vars) {
+                AstVar* const varp = datap->m_varp;
+                const size_t rangeStart = ranges.size();
+                int pdim = 0;
+                int udim = 0;
+                if (AstBasicDType* const basicp = varp->basicp()) {
+                    // Range is always first, it's not in "C" order
+                    for (AstNodeDType* dtypep = varp->dtypep(); dtypep;) {
+                        // Skip AstRefDType/AstTypedef, or return same node
+                        dtypep = dtypep->skipRefp();
+                        if (const AstNodeArrayDType* const adtypep
+                            = VN_CAST(dtypep, NodeArrayDType)) {
+                            ranges.push_back(adtypep->left());
+                            ranges.push_back(adtypep->right());
+                            if (VN_IS(dtypep, PackArrayDType))
+                                pdim++;
+                            else
+                                udim++;
+                            dtypep = adtypep->subDTypep();
+                        } else {
+                            if (basicp->isRanged()) {
+                                ranges.push_back(basicp->left());
+                                ranges.push_back(basicp->right());
+                                pdim++;
+                            }
+                            break;  // AstBasicDType - nothing below, 1
                         }
-                        break;  // AstBasicDType - nothing below, 1
                     }
                 }
+                decls += "{\"" + V3OutFormatter::quoteNameControls(
+                             protect(datap->m_varBasePretty))
+                         + "\", ";
+                decls += varp->vlEnumType() + ", ";  // VLVT_UINT32 etc
+                decls += varp->vlEnumDir() + ", ";  // VLVD_IN etc
+                decls += std::string{varp->isParam() ? "true" : "false"} + ", ";
+                decls += cvtToStr(udim) + ", " + cvtToStr(pdim) + ", ";
+                decls += (ranges.size() > rangeStart ? "__Vranges + " + cvtToStr(rangeStart)
+                                                     : "nullptr"s);
+                decls += "},\n";
             }
-
-            putns(scopep, protect("__Vscope_" + it->second.m_scopeName));
-            putns(varp, ".varInsert(__Vfinal,");
-            putsQuoted(protect(it->second.m_varBasePretty));
-
-            std::string varName;
-            varName += protectIf(scopep->nameDotless(), scopep->protect()) + ".";
-            varName += protect(varp->name());
-
-            if (varp->isParam()) {
-                if (varp->vlEnumType() == "VLVT_STRING"
-                    && !VN_IS(varp->subDTypep(), UnpackArrayDType)) {
-                    puts(", const_cast<void*>(static_cast<const void*>(");
-                    puts(varName);
-                    puts(".c_str())), ");
+            if (!ranges.empty()) {
+                puts("static const int __Vranges[] = {");
+                for (size_t i = 0; i < ranges.size(); ++i) {
+                    if (i) puts(", ");
+                    puts(cvtToStr(ranges[i]));
+                }
+                puts("};\n");
+            }
+            puts("static const VerilatedVarDecl __Vdecls[] = {\n");
+            puts(decls);
+            puts("};\n");
+            puts("void* const __Vdatas[] = {\n");
+            for (const ScopeVarData* const datap : vars) {
+                AstScope* const scopep = datap->m_scopep;
+                AstVar* const varp = datap->m_varp;
+                std::string varName;
+                varName += protectIf(scopep->nameDotless(), scopep->protect()) + ".";
+                varName += protect(varp->name());
+                if (varp->isParam()) {
+                    if (varp->vlEnumType() == "VLVT_STRING"
+                        && !VN_IS(varp->subDTypep(), UnpackArrayDType)) {
+                        putns(varp, "const_cast<void*>(static_cast<const void*>(" + varName
+                                        + ".c_str())),\n");
+                    } else {
+                        putns(varp, "const_cast<void*>(static_cast<const void*>(&(" + varName
+                                        + "))),\n");
+                    }
                 } else {
-                    puts(", const_cast<void*>(static_cast<const void*>(&(");
-                    puts(varName);
-                    puts("))), ");
+                    putns(varp, "&(" + varName + "),\n");
                 }
-            } else {
-                puts(", &(");
-                puts(varName);
-                puts("), ");
             }
-
-            puts(varp->isParam() ? "true" : "false");
-            puts(", ");
-            puts(varp->vlEnumType());  // VLVT_UINT32 etc
-            puts(",");
-            puts(varp->vlEnumDir());  // VLVD_IN etc
-            puts(",");
-            puts(cvtToStr(udim));
-            puts(",");
-            puts(cvtToStr(pdim));
-            puts(bounds);
-            puts(");\n");
-            ++m_numStmts;
+            puts("};\n");
+            puts(protect("__Vscope_" + itr.first) + ".varsInsert(__Vfinal, __Vdecls, __Vdatas, "
+                 + cvtToStr(vars.size()) + ");\n");
+            puts("}\n");
+            m_numStmts += vars.size();
         }
         m_ofpBase->puts("}\n");
     }
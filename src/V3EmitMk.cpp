@@ -367,6 +367,44 @@ private:
         }
     }
 
+    void buildStableOutputList() {
+        // Assign each small enough file to a bucket by the hash of its name, so adding,
+        // removing or resizing a file changes only its own bucket. Buckets are placed at their
+        // first file, so output order still follows input order.
+        const int totalBucketsNum = v3Global.opt.outputGroups();
+        const uint64_t concatenableFileMaxScore = m_totalScore / totalBucketsNum / 2;
+        V3Stats::addStat("Concatenation max score", concatenableFileMaxScore);
+
+        std::vector<std::vector<std::string>> buckets(totalBucketsNum);
+        std::vector<int> fileBuckets;  // Bucket of each input file, or -1 if not concatenable
+        fileBuckets.reserve(m_inputFiles.size());
+        for (const FilenameWithScore& inputFile : m_inputFiles) {
+            const bool fileIsConcatenable = (inputFile.m_score <= concatenableFileMaxScore);
+            V3Stats::addStatSum(fileIsConcatenable ? "Concatenation total grouped score"
+                                                   : "Concatenation total non-grouped score",
+                                inputFile.m_score);
+            if (!fileIsConcatenable) {
+                fileBuckets.push_back(-1);
+                continue;
+            }
+            const int bucket = V3Hash{inputFile.m_filename}.value() % totalBucketsNum;
+            fileBuckets.push_back(bucket);
+            buckets[bucket].push_back(inputFile.m_filename);
+        }
+
+        for (size_t i = 0; i < m_inputFiles.size(); ++i) {
+            const int bucket = fileBuckets[i];
+            if (bucket < 0 || buckets[bucket].size() == 1) {
+                m_outputFiles.push_back({m_inputFiles[i].m_filename, {}});
+            } else if (!buckets[bucket].empty()) {  // First file of the bucket
+                m_outputFiles.push_back({v3Global.opt.prefix() + "_" + m_groupFilePrefix
+                                             + std::to_string(bucket),
+                                         std::move(buckets[bucket])});
+                buckets[bucket].clear();
+            }
+        }
+    }
+
     void assertFilesSame() const {
         auto ifIt = m_inputFiles.begin();
         auto ofIt = m_outputFiles.begin();
@@ -413,6 +451,12 @@ private:
 
         if (m_logp) dumpLogScoreHistogram(*m_logp);
 
+        if (v3Global.opt.outputSplitStable()) {
+            buildStableOutputList();
+            if (m_logp) dumpOutputList(*m_logp);
+            return;
+        }
+
         createWorkLists();
 
         // Collect stats and mark lists with only one file as non-concatenable
@@ -498,33 +542,37 @@ public:
         ++m_putClassCount;
     }
 
+    // Group the model classes into the files requested by --output-groups
+    static void groupClasses(std::vector<FileOrConcatenatedFilesList>& slowList,
+                             std::vector<FileOrConcatenatedFilesList>& fastList) {
+        std::vector<FilenameWithScore> slowFiles;
+        std::vector<FilenameWithScore> fastFiles;
+        uint64_t slowTotalScore = 0;
+        uint64_t fastTotalScore = 0;
+
+        for (AstNodeFile* nodep = v3Global.rootp()->filesp(); nodep;
+             nodep = VN_AS(nodep->nextp(), NodeFile)) {
+            const AstCFile* const cfilep = VN_CAST(nodep, CFile);
+            if (cfilep && cfilep->source() && cfilep->support() == false) {
+                std::vector<FilenameWithScore>& files = cfilep->slow() ? slowFiles : fastFiles;
+                uint64_t& totalScore = cfilep->slow() ? slowTotalScore : fastTotalScore;
+
+                totalScore += cfilep->complexityScore();
+                files.push_back(
+                    {V3Os::filenameNonDirExt(cfilep->name()), cfilep->complexityScore()});
+            }
+        }
+
+        slowList = EmitGroup::singleConcatenatedFilesList(std::move(slowFiles), slowTotalScore,
+                                                          "vm_classes_Slow_");
+        fastList = EmitGroup::singleConcatenatedFilesList(std::move(fastFiles), fastTotalScore,
+                                                          "vm_classes_");
+    }
+
     void emitClassMake() {
         std::vector<FileOrConcatenatedFilesList> vmClassesSlowList;
         std::vector<FileOrConcatenatedFilesList> vmClassesFastList;
-        if (v3Global.opt.outputGroups() > 0) {
-            std::vector<FilenameWithScore> slowFiles;
-            std::vector<FilenameWithScore> fastFiles;
-            uint64_t slowTotalScore = 0;
-            uint64_t fastTotalScore = 0;
-
-            for (AstNodeFile* nodep = v3Global.rootp()->filesp(); nodep;
-                 nodep = VN_AS(nodep->nextp(), NodeFile)) {
-                const AstCFile* const cfilep = VN_CAST(nodep, CFile);
-                if (cfilep && cfilep->source() && cfilep->support() == false) {
-                    std::vector<FilenameWithScore>& files = cfilep->slow() ? slowFiles : fastFiles;
-                    uint64_t& totalScore = cfilep->slow() ? slowTotalScore : fastTotalScore;
-
-                    totalScore += cfilep->complexityScore();
-                    files.push_back(
-                        {V3Os::filenameNonDirExt(cfilep->name()), cfilep->complexityScore()});
-                }
-            }
-
-            vmClassesSlowList = EmitGroup::singleConcatenatedFilesList(
-                std::move(slowFiles), slowTotalScore, "vm_classes_Slow_");
-            vmClassesFastList = EmitGroup::singleConcatenatedFilesList(
-                std::move(fastFiles), fastTotalScore, "vm_classes_");
-        }
+        if (v3Global.opt.outputGroups() > 0) groupClasses(vmClassesSlowList, vmClassesFastList);
 
         // Generate the makefile
         V3OutMkFile of{v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + "_classes.mk"};
@@ -551,7 +599,8 @@ public:
         of.puts("VM_PARALLEL_BUILDS = ");
         of.puts(v3Global.useParallelBuild() ? "1" : "0");
         of.puts("\n");
-        of.puts("# Tracing output mode?  0/1 (from --trace-fst/--trace-saif/--trace-vcd)\n");
+        of.puts("# Tracing output mode?  0/1 (from --trace-fst/--trace-saif/--trace-vcd/"
+                "--trace-vtc)\n");
         of.puts("VM_TRACE = ");
         of.puts(v3Global.opt.trace() ? "1" : "0");
         of.puts("\n");
@@ -567,6 +616,10 @@ public:
         of.puts("VM_TRACE_VCD = ");
         of.puts(v3Global.opt.traceEnabledVcd() ? "1" : "0");
         of.puts("\n");
+        of.puts("# Tracing output mode in VTC format?  0/1 (from --trace-vtc)\n");
+        of.puts("VM_TRACE_VTC = ");
+        of.puts(v3Global.opt.traceEnabledVtc() ? "1" : "0");
+        of.puts("\n");
 
         of.puts("\n### Object file lists...\n");
         for (int support = 0; support < 3; ++support) {
@@ -663,6 +716,8 @@ public:
         of.puts("\n### Switches...\n");
         of.puts("# C++ code coverage  0/1 (from --prof-c)\n");
         of.putSet("VM_PROFC", ((v3Global.opt.profC()) ? "1" : "0"));
+        of.puts("# C++ compiler profile-guided optimization  generate/use (from --compiler-pgo)\n");
+        of.putSet("VM_PGO", v3Global.opt.compilerPgo());
         of.puts("# SystemC output mode?  0/1 (from --sc)\n");
         of.putSet("VM_SC", ((v3Global.opt.systemC()) ? "1" : "0"));
         of.puts("# Legacy or SystemC output mode?  0/1 (from --sc)\n");
@@ -732,7 +787,7 @@ public:
         }
 
         const string compilerIncludePch
-            = v3Global.opt.compilerIncludes().empty() ? "" : "$(VK_PCH_H).fast.gch";
+            = v3Global.opt.compilerIncludes().empty() ? "" : "$(VK_PCH_GCH_FAST)";
         const string compilerIncludeFlag
             = v3Global.opt.compilerIncludes().empty() ? "" : "$(VK_PCH_I_FAST)";
         for (const string& cppfile : cppFiles) {
@@ -759,7 +814,23 @@ public:
             // The rule to create .a is defined in verilated.mk, so just define dependency here.
             of.puts(v3Global.opt.libCreateName(false) + ": " + libCreateDeps + "\n");
             of.puts("\n");
-            if (v3Global.opt.hierChild()) {
+            if (v3Global.opt.hierChild() && v3Global.opt.hierShared()) {
+                // Global objects are left for the final executable to provide, so that each
+                // block shares the one copy of Verilated's state
+                const string soname = v3Global.opt.libCreateName(true);
+                of.puts(soname + ": $(VK_OBJS) $(VK_USER_OBJS) " + v3Global.opt.libCreate()
+                        + ".o $(VM_HIER_LIBS)\n");
+                of.puts("ifeq ($(shell uname -s),Darwin)\n");
+                of.puts("\t$(OBJCACHE) $(CXX) $(CXXFLAGS) $(CPPFLAGS) $(OPT_FAST) -undefined "
+                        "dynamic_lookup -shared -flat_namespace -Wl,-install_name,@rpath/"
+                        + soname + " -o $@ $^\n");
+                of.puts("else\n");
+                of.puts("\t$(OBJCACHE) $(CXX) $(CXXFLAGS) $(CPPFLAGS) $(OPT_FAST) -shared "
+                        "-Wl,-soname," + soname + " -o $@ $^\n");
+                of.puts("endif\n");
+                of.puts("\n");
+                of.puts("lib" + v3Global.opt.libCreate() + ": " + soname + "\n");
+            } else if (v3Global.opt.hierChild()) {
                 // Hierarchical child does not need .so because hierTop() will create .so from .a
                 of.puts("lib" + v3Global.opt.libCreate() + ": " + v3Global.opt.libCreateName(false)
                         + "\n");
@@ -800,6 +871,189 @@ public:
     virtual ~EmitMk() = default;
 };
 
+//######################################################################
+// Emit build.ninja, building the same objects as EmitMk
+
+class EmitNinja final {
+    using FileOrConcatenatedFilesList = EmitGroup::FileOrConcatenatedFilesList;
+
+    // MEMBERS
+    V3OutMkFile m_of{v3Global.opt.makeDir() + "/build.ninja"};  // Output file
+    std::vector<string> m_modelObjs;  // Objects of the model classes
+    std::vector<string> m_userObjs;  // Objects of user .cpp files
+    std::vector<string> m_globalObjs;  // Objects of the Verilated runtime
+
+    // METHODS
+    // Escape a path for a ninja build statement
+    static string escapePath(const string& path) {
+        string out;
+        for (const char c : path) {
+            if (c == '$' || c == ' ' || c == ':') out += '$';
+            out += c;
+        }
+        return out;
+    }
+    // Escape a value for a ninja variable
+    static string escapeValue(const string& value) {
+        string out;
+        for (const char c : value) {
+            if (c == '$') out += '$';
+            out += c;
+        }
+        return out;
+    }
+    static string pathList(const std::vector<string>& paths) {
+        string out;
+        for (const string& path : paths) out += " " + escapePath(path);
+        return out;
+    }
+
+    void putCompile(std::vector<string>& objs, const string& cppFile, const string& opt) {
+        const string obj = V3Os::filenameNonDirExt(cppFile) + ".o";
+        m_of.puts("build " + escapePath(obj) + ": cxx " + escapePath(cppFile) + "\n");
+        m_of.puts("  opt = " + opt + "\n");
+        objs.push_back(obj);
+    }
+
+    void emitFlags() {
+        const string root = V3Options::getenvVERILATOR_ROOT();
+        m_of.puts("\n### Compiler flags...\n");
+        string cppflags = "-I. -I" + root + "/include -I" + root + "/include/vltstd";
+        cppflags += " -DVERILATOR=1";
+        cppflags += " -DVM_COVERAGE="s + (v3Global.opt.coverage() ? "1" : "0");
+        cppflags += " -DVM_SC="s + (v3Global.opt.systemC() ? "1" : "0");
+        cppflags += " -DVM_TIMING="s + (v3Global.usesTiming() ? "1" : "0");
+        cppflags += " -DVM_TRACE="s + (v3Global.opt.trace() ? "1" : "0");
+        cppflags += " -DVM_TRACE_FST="s + (v3Global.opt.traceEnabledFst() ? "1" : "0");
+        cppflags += " -DVM_TRACE_VCD="s + (v3Global.opt.traceEnabledVcd() ? "1" : "0");
+        cppflags += " -DVM_TRACE_SAIF="s + (v3Global.opt.traceEnabledSaif() ? "1" : "0");
+        cppflags += " -DVM_TRACE_VTC="s + (v3Global.opt.traceEnabledVtc() ? "1" : "0");
+        cppflags = escapeValue(cppflags);
+        cppflags += " $cfg_cxxflags_no_unused $cfg_cxxflags_std";
+        if (v3Global.usesTiming()) cppflags += " $cfg_cxxflags_coroutines";
+        string ldflags = "$cfg_ldflags_verilated";
+        string ldlibs;
+        if (v3Global.opt.profC()) {
+            cppflags += " $cfg_cxxflags_profile";
+            ldflags += " $cfg_cxxflags_profile";
+        }
+        if (v3Global.opt.compilerPgo() == "generate") {
+            cppflags += " -fprofile-generate=pgo";
+            ldflags += " -fprofile-generate=pgo";
+        } else if (v3Global.opt.compilerPgo() == "use") {
+            cppflags += " -fprofile-use=pgo $cfg_cxxflags_pgo_use";
+            ldflags += " -fprofile-use=pgo";
+        }
+        if (v3Global.opt.systemC()) {
+            cppflags += " -I" + escapeValue(V3Options::getenvSYSTEMC_INCLUDE());
+            ldflags += " -L" + escapeValue(V3Options::getenvSYSTEMC_LIBDIR());
+            ldlibs += " -lsystemc";
+        }
+        const std::string solver = V3Options::getenvVERILATOR_SOLVER();
+        if (v3Global.useRandomizeMethods() && solver != "") {
+            cppflags += " -DVM_SOLVER_DEFAULT='\""
+                        + escapeValue(V3OutFormatter::quoteNameControls(solver)) + "\"'";
+        }
+        if (!v3Global.opt.libCreate().empty()) cppflags += " -fPIC";
+        // User CFLAGS and LDLIBS (from -CFLAGS and -LDFLAGS on Verilator command line)
+        for (const string& i : v3Global.opt.cFlags()) cppflags += " " + escapeValue(i);
+        for (const string& i : v3Global.opt.ldLibs()) ldlibs += " " + escapeValue(i);
+        ldlibs += " $cfg_ldlibs_threads";
+        m_of.puts("cppflags = " + cppflags + "\n");
+        m_of.puts("ldflags = " + ldflags + "\n");
+        m_of.puts("ldlibs =" + ldlibs + "\n");
+    }
+
+    void emitCompiles() {
+        std::vector<FileOrConcatenatedFilesList> slowList;
+        std::vector<FileOrConcatenatedFilesList> fastList;
+        if (v3Global.opt.outputGroups() > 0) EmitMk::groupClasses(slowList, fastList);
+
+        m_of.puts("\n### Model classes...\n");
+        for (const bool support : {false, true}) {
+            for (const bool slow : {false, true}) {
+                const string opt = slow ? "$opt_slow" : "$opt_fast";
+                if (!support && v3Global.opt.outputGroups() > 0) {
+                    for (const FileOrConcatenatedFilesList& entry : slow ? slowList : fastList) {
+                        if (entry.isConcatenatingFile()) EmitMk::emitConcatenatingFile(entry);
+                        putCompile(m_modelObjs, entry.m_filename + ".cpp", opt);
+                    }
+                    continue;
+                }
+                for (AstNodeFile* nodep = v3Global.rootp()->filesp(); nodep;
+                     nodep = VN_AS(nodep->nextp(), NodeFile)) {
+                    const AstCFile* const cfilep = VN_CAST(nodep, CFile);
+                    if (cfilep && cfilep->source() && cfilep->slow() == slow
+                        && cfilep->support() == support) {
+                        putCompile(m_modelObjs, V3Os::filenameNonDir(cfilep->name()), opt);
+                    }
+                }
+            }
+        }
+
+        m_of.puts("\n### User classes (from .cpp's on Verilator command line)...\n");
+        for (const string& cppFile : v3Global.opt.cppFiles()) {
+            putCompile(m_userObjs, V3Os::filenameRealPath(cppFile), "$opt_fast");
+        }
+        if (!v3Global.opt.libCreate().empty()) {
+            putCompile(m_userObjs, v3Global.opt.libCreate() + ".cpp", "$opt_fast");
+        }
+
+        m_of.puts("\n### Global classes, need linked once per executable...\n");
+        for (const string& cpp : v3Global.verilatedCppFiles()) {
+            putCompile(m_globalObjs, V3Options::getenvVERILATOR_ROOT() + "/include/" + cpp,
+                       "$opt_global");
+        }
+    }
+
+    void emitTargets() {
+        m_of.puts("\n### Targets...\n");
+        const string modelObjs = pathList(m_modelObjs) + pathList(m_userObjs);
+        const string globalObjs = pathList(m_globalObjs);
+        string target;
+        if (v3Global.opt.exe()) {
+            target = v3Global.opt.exeName();
+            m_of.puts("build " + escapePath(target) + ": link" + modelObjs + globalObjs + "\n");
+        } else if (!v3Global.opt.libCreate().empty()) {
+            const string archive = v3Global.opt.libCreateName(false);
+            const string shared = v3Global.opt.libCreateName(true);
+            m_of.puts("build " + escapePath(archive) + ": ar" + modelObjs + globalObjs + "\n");
+            m_of.puts("build " + escapePath(shared) + ": link_shared" + modelObjs + globalObjs
+                      + "\n");
+            target = "lib" + v3Global.opt.libCreate();
+            m_of.puts("build " + escapePath(target) + ": phony " + escapePath(archive) + " "
+                      + escapePath(shared) + "\n");
+        } else {
+            const string libname = "lib" + v3Global.opt.prefix() + ".a";
+            m_of.puts("build " + escapePath(libname) + ": ar" + modelObjs + "\n");
+            m_of.puts("build libverilated.a: ar" + globalObjs + "\n");
+            target = "lib" + v3Global.opt.prefix();
+            m_of.puts("build " + escapePath(target) + ": phony " + escapePath(libname)
+                      + " libverilated.a\n");
+        }
+        m_of.puts("\ndefault " + escapePath(target) + "\n");
+    }
+
+public:
+    explicit EmitNinja() {
+        m_of.puts("# Verilated -*- Ninja -*-\n");
+        m_of.puts("# DESCR"
+                  "IPTION: Verilator output: Ninja file for building Verilated archive or "
+                  "executable\n");
+        m_of.puts("#\n");
+        m_of.puts("# Execute this file from the object directory:\n");
+        m_of.puts("#    ninja -C " + v3Global.opt.makeDir() + "\n");
+        m_of.puts("\nninja_required_version = 1.3\n");
+        m_of.puts("\n# Include global rules\n");
+        m_of.puts("include " + escapePath(V3Options::getenvVERILATOR_ROOT())
+                  + "/include/verilated.ninja\n");
+        emitFlags();
+        emitCompiles();
+        emitTargets();
+    }
+    ~EmitNinja() = default;
+};
+
 //######################################################################
 
 class EmitMkHierVerilation final {
@@ -851,8 +1105,29 @@ class EmitMkHierVerilation final {
         }
         of.puts("\n");
 
+        // Start blocks on the longest path first, as make starts prerequisites in order
+        of.puts("# Libraries of hierarchical blocks in scheduling order\n");
+        of.puts("VM_HIER_SCHEDULE := \\\n");
+        const V3HierBlockPlan::HierVector scheduled = m_planp->hierBlocksScheduled();
+        std::unordered_map<const V3HierBlock*, size_t> rank;
+        for (const V3HierBlock* const blockp : scheduled) {
+            rank.emplace(blockp, rank.size());
+            of.puts("  " + blockp->hierLibFilename(true) + " \\\n");
+        }
+        of.puts("\n");
+
+        if (v3Global.opt.hierShared()) {
+            // The final executable finds each block's shared library where it was built
+            of.puts("# Search paths for shared libraries of hierarchical blocks\n");
+            for (const V3HierBlock* const blockp : scheduled) {
+                of.puts("LDFLAGS += -Wl,-rpath," + V3Os::filenameRealPath(v3Global.opt.makeDir())
+                        + "/" + blockp->hierPrefix() + "\n");
+            }
+            of.puts("\n");
+        }
+
         // Build hierarchical libraries as soon as possible to get maximum parallelism
-        of.puts("hier_build: $(VM_HIER_LIBS) " + v3Global.opt.prefix() + ".mk\n");
+        of.puts("hier_build: $(VM_HIER_SCHEDULE) " + v3Global.opt.prefix() + ".mk\n");
         of.puts("\t$(MAKE) -f " + v3Global.opt.prefix() + ".mk\n");
         of.puts("hier_verilation: " + v3Global.opt.prefix() + ".mk\n");
         emitCommonOpts(of);
@@ -871,7 +1146,9 @@ class EmitMkHierVerilation final {
             of.puts(v3Global.opt.prefix()
                     + ".mk: $(VM_HIER_INPUT_FILES) $(VM_HIER_VERILOG_LIBS) ");
             of.puts(V3Os::filenameNonDir(argsFile) + " ");
-            for (const auto& itr : *m_planp) of.puts(itr.second->hierWrapperFilename(true) + " ");
+            for (const V3HierBlock* const blockp : scheduled) {
+                of.puts(blockp->hierWrapperFilename(true) + " ");
+            }
             of.puts("\n");
             emitLaunchVerilator(of, argsFile);
         }
@@ -884,10 +1161,14 @@ class EmitMkHierVerilation final {
             of.puts(blockp->hierGeneratedFilenames(true));
             of.puts(": $(VM_HIER_INPUT_FILES) $(VM_HIER_VERILOG_LIBS) ");
             of.puts(V3Os::filenameNonDir(argsFilename) + " ");
-            const V3HierBlock::HierBlockSet& children = blockp->children();
-            for (V3HierBlock::HierBlockSet::const_iterator child = children.begin();
-                 child != children.end(); ++child) {
-                of.puts((*child)->hierWrapperFilename(true) + " ");
+            V3HierBlockPlan::HierVector children{blockp->children().begin(),
+                                                 blockp->children().end()};
+            std::sort(children.begin(), children.end(),
+                      [&](const V3HierBlock* ap, const V3HierBlock* bp) {
+                          return rank.at(ap) < rank.at(bp);
+                      });
+            for (const V3HierBlock* const childp : children) {
+                of.puts(childp->hierWrapperFilename(true) + " ");
             }
             of.puts("\n");
             emitLaunchVerilator(of, argsFilename);
@@ -897,9 +1178,8 @@ class EmitMkHierVerilation final {
             of.puts(": ");
             of.puts(blockp->hierMkFilename(true));
             of.puts(" ");
-            for (V3HierBlock::HierBlockSet::const_iterator child = children.begin();
-                 child != children.end(); ++child) {
-                of.puts((*child)->hierLibFilename(true));
+            for (const V3HierBlock* const childp : children) {
+                of.puts(childp->hierLibFilename(true));
                 of.puts(" ");
             }
             of.puts("\n\t$(MAKE) -f " + blockp->hierMkFilename(false) + " -C " + prefix);
@@ -926,6 +1206,11 @@ void V3EmitMk::emitmk() {
     const EmitMk emitter;
 }
 
+void V3EmitMk::emitNinja() {
+    UINFO(2, __FUNCTION__ << ":");
+    const EmitNinja emitter;
+}
+
 void V3EmitMk::emitHierVerilation(const V3HierBlockPlan* planp) {
     UINFO(2, __FUNCTION__ << ":");
     EmitMkHierVerilation{planp};
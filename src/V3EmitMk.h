@@ -30,6 +30,7 @@ public:
     static const size_t PARALLEL_FILE_CNT_THRESHOLD = 128;
 
     static void emitmk() VL_MT_DISABLED;
+    static void emitNinja() VL_MT_DISABLED;
     static void emitHierVerilation(const V3HierBlockPlan* planp) VL_MT_DISABLED;
 };
 
@@ -22,6 +22,7 @@
 #include "V3HierBlock.h"
 #include "V3Os.h"
 
+#include <algorithm>
 #include <memory>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -46,11 +47,13 @@ class V3EmitMkJsonEmitter final {
         std::vector<string> global;
         std::vector<string> deps;
         std::vector<string> cppFiles;
+        std::vector<const AstCFile*> jobs;
 
         for (AstNodeFile* nodep = v3Global.rootp()->filesp(); nodep;
              nodep = VN_AS(nodep->nextp(), NodeFile)) {
             const AstCFile* const cfilep = VN_CAST(nodep, CFile);
             if (cfilep && cfilep->source()) {
+                jobs.push_back(cfilep);
                 const std::string filename
                     = V3Os::filenameSlashPath(V3Os::filenameRealPath(cfilep->name()));
                 if (cfilep->support()) {
@@ -100,6 +103,7 @@ class V3EmitMkJsonEmitter final {
             .put("trace_fst", v3Global.opt.traceEnabledFst())
             .put("trace_saif", v3Global.opt.traceEnabledSaif())
             .put("trace_vcd", v3Global.opt.traceEnabledVcd())
+            .put("trace_vtc", v3Global.opt.traceEnabledVtc())
             .end()
             .begin("sources")
             .putList("global", global)
@@ -111,6 +115,23 @@ class V3EmitMkJsonEmitter final {
             .putList("user_classes", cppFiles)
             .end();
 
+        // Generated files to compile, most expensive first, so a distributed build can start
+        // the longest compiles first. The score is the emitted code size, as used to split
+        // and group output files.
+        std::stable_sort(jobs.begin(), jobs.end(), [](const AstCFile* ap, const AstCFile* bp) {
+            return ap->complexityScore() > bp->complexityScore();
+        });
+        of.begin("compile_jobs", '[');
+        for (const AstCFile* const cfilep : jobs) {
+            of.begin()
+                .put("source", V3Os::filenameSlashPath(V3Os::filenameRealPath(cfilep->name())))
+                .put("slow", cfilep->slow())
+                .put("support", cfilep->support())
+                .put("score", cfilep->complexityScore())
+                .end();
+        }
+        of.end();
+
         if (const V3HierBlockPlan* const planp = v3Global.hierPlanp()) {
             // Sorted hierarchical blocks in order of leaf-first.
             const V3HierBlockPlan::HierVector& hierBlocks = planp->hierBlocksSorted();
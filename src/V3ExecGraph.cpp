@@ -27,8 +27,10 @@
 #include "V3Os.h"
 #include "V3Stats.h"
 
+#include <map>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -314,6 +316,65 @@ uint32_t ThreadSchedule::s_nextId = 0;
 std::unordered_map<const ExecMTask*, ThreadSchedule::MTaskState> ThreadSchedule::mtaskState{};
 constexpr double V3ExecGraph::ThreadSchedule::s_threadBoxWidth;
 
+//######################################################################
+// MTaskFootprints
+
+// Variables referenced by each mtask, including via called functions, with
+// their sizes. Used to estimate the cost of moving state between NUMA nodes.
+class MTaskFootprints final {
+    // TYPES
+    // Sorted by variable pointer, for fast intersection
+    using Footprint = std::vector<std::pair<const AstVar*, uint32_t>>;
+
+    // MEMBERS
+    std::unordered_map<const ExecMTask*, Footprint> m_footprints;
+
+    // METHODS
+    static void gather(const AstNode* nodep, std::map<const AstVar*, uint32_t>& vars,
+                       std::unordered_set<const AstCFunc*>& visited) {
+        nodep->foreach([&](const AstNode* np) {
+            if (const AstNodeVarRef* const refp = VN_CAST(np, NodeVarRef)) {
+                const AstVar* const varp = refp->varp();
+                vars.emplace(varp, static_cast<uint32_t>(varp->dtypep()->widthTotalBytes()));
+            } else if (const AstNodeCCall* const callp = VN_CAST(np, NodeCCall)) {
+                if (visited.insert(callp->funcp()).second) gather(callp->funcp(), vars, visited);
+            }
+        });
+    }
+    const Footprint& footprint(const ExecMTask* mtaskp) {
+        const auto pair = m_footprints.emplace(mtaskp, Footprint{});
+        if (pair.second) {
+            std::map<const AstVar*, uint32_t> vars;
+            std::unordered_set<const AstCFunc*> visited;
+            gather(mtaskp->bodyp(), vars, visited);
+            pair.first->second.assign(vars.begin(), vars.end());
+        }
+        return pair.first->second;
+    }
+
+public:
+    // Bytes of state referenced by both mtasks
+    uint64_t sharedBytes(const ExecMTask* ap, const ExecMTask* bp) {
+        const Footprint& a = footprint(ap);
+        const Footprint& b = footprint(bp);
+        uint64_t bytes = 0;
+        auto ait = a.begin();
+        auto bit = b.begin();
+        while (ait != a.end() && bit != b.end()) {
+            if (ait->first < bit->first) {
+                ++ait;
+            } else if (bit->first < ait->first) {
+                ++bit;
+            } else {
+                bytes += ait->second;
+                ++ait;
+                ++bit;
+            }
+        }
+        return bytes;
+    }
+};
+
 //######################################################################
 // PackThreads
 
@@ -332,6 +393,11 @@ constexpr double V3ExecGraph::ThreadSchedule::s_threadBoxWidth;
 // depending on which thread is looking. Be a little bit pessimistic when
 // thread A checks the end time of an mtask running on thread B. This extra
 // "padding" avoids tight "layovers" at cross-thread dependencies.
+//
+// With --threads-numa-nodes, threads are split into contiguous groups, one
+// per NUMA node, and a dependency between mtasks on different nodes is
+// additionally penalized by the amount of state the two mtasks share, so
+// mtasks working on the same large state tend to be co-located.
 class PackThreads final {
     // TYPES
     struct MTaskCmp final {
@@ -345,15 +411,23 @@ class PackThreads final {
     const uint32_t m_nHierThreads;  // Number of threads used for hierarchical tasks
     const uint32_t m_sandbagNumerator;  // Numerator padding for est runtime
     const uint32_t m_sandbagDenom;  // Denominator padding for est runtime
+    const uint32_t m_numaNodes;  // Number of NUMA nodes threads are split across
+    MTaskFootprints m_footprints;  // State referenced by each mtask
+    std::unordered_map<const ExecMTask*, uint32_t> m_pinned;  // Thread forced by refine()
+
+    // Estimated cost of moving a cache line between NUMA nodes, in mtask cost units
+    static constexpr uint32_t CROSS_NODE_LINE_COST = 20;
 
     // CONSTRUCTORS
     explicit PackThreads(uint32_t nThreads = v3Global.opt.threads(),
                          uint32_t nHierThreads = v3Global.opt.hierThreads(),
-                         unsigned sandbagNumerator = 30, unsigned sandbagDenom = 100)
+                         unsigned sandbagNumerator = 30, unsigned sandbagDenom = 100,
+                         uint32_t numaNodes = v3Global.opt.threadsNumaNodes())
         : m_nThreads{nThreads}
         , m_nHierThreads{nHierThreads}
         , m_sandbagNumerator{sandbagNumerator}
-        , m_sandbagDenom{sandbagDenom} {}
+        , m_sandbagDenom{sandbagDenom}
+        , m_numaNodes{std::max(1U, std::min(numaNodes, nThreads))} {}
     ~PackThreads() = default;
     VL_UNCOPYABLE(PackThreads);
 
@@ -391,6 +465,24 @@ class PackThreads final {
         return sandbaggedEndTime;
     }
 
+    uint32_t numaNode(const ThreadSchedule& schedule, uint32_t threadId) const {
+        return threadId * m_numaNodes / schedule.threads.size();
+    }
+
+    // Additional delay for 'mtaskp' on 'threadId' waiting for 'priorp', due
+    // to moving the state they share between NUMA nodes
+    uint32_t numaPenalty(const ThreadSchedule& schedule, const ExecMTask* priorp,
+                         const ExecMTask* mtaskp, uint32_t threadId) {
+        if (m_numaNodes <= 1 || !schedule.contains(priorp)) return 0;
+        const uint32_t priorThreadId = schedule.mtaskState.at(priorp).threadId;
+        if (numaNode(schedule, priorThreadId) == numaNode(schedule, threadId)) return 0;
+        const uint64_t lines = (m_footprints.sharedBytes(priorp, mtaskp) + VL_CACHE_LINE_BYTES - 1)
+                               / VL_CACHE_LINE_BYTES;
+        // Never worse than running the producer's cost again, to bound the penalty
+        return static_cast<uint32_t>(
+            std::min<uint64_t>(lines * CROSS_NODE_LINE_COST, priorp->cost()));
+    }
+
     static bool isReady(ThreadSchedule& schedule, const ExecMTask* mtaskp) {
         for (const V3GraphEdge& edgeIn : mtaskp->inEdges()) {
             const ExecMTask* const prevp = edgeIn.fromp()->as<const ExecMTask>();
@@ -453,6 +545,8 @@ class PackThreads final {
                     }
                     if (mode == SchedulingMode::WIDE_TASK_SCHEDULING && mtaskp->threads() <= 1)
                         continue;
+                    const auto pinIt = m_pinned.find(mtaskp);
+                    if (pinIt != m_pinned.end() && pinIt->second != threadId) continue;
 
                     uint32_t timeBegin = busyUntil[threadId];
                     if (timeBegin > bestTime) {
@@ -463,7 +557,9 @@ class PackThreads final {
                     }
                     for (const V3GraphEdge& edge : mtaskp->inEdges()) {
                         const ExecMTask* const priorp = edge.fromp()->as<ExecMTask>();
-                        const uint32_t priorEndTime = completionTime(schedule, priorp, threadId);
+                        const uint32_t priorEndTime
+                            = completionTime(schedule, priorp, threadId)
+                              + numaPenalty(schedule, priorp, mtaskp, threadId);
                         if (priorEndTime > timeBegin) timeBegin = priorEndTime;
                     }
                     UINFO(6, "Task " << mtaskp->name() << " start at " << timeBegin
@@ -729,8 +825,127 @@ public:
         ThreadSchedule::mtaskState.clear();
     }
 
-    static std::vector<ThreadSchedule> apply(V3Graph& mtaskGraph) {
-        return PackThreads{}.pack(mtaskGraph);
+    static uint32_t endTime(const std::vector<ThreadSchedule>& schedules) {
+        uint32_t result = 0;
+        for (const ThreadSchedule& schedule : schedules) {
+            result = std::max(result, schedule.endTime());
+        }
+        return result;
+    }
+
+    // Tasks on the path that determines the end of the schedule, which start
+    // only when a task on another thread completes, with the thread of that task
+    static std::vector<std::pair<const ExecMTask*, uint32_t>>
+    criticalMoves(const std::vector<ThreadSchedule>& schedules) {
+        std::vector<std::pair<const ExecMTask*, uint32_t>> result;
+        const ThreadSchedule* lastp = nullptr;
+        const ExecMTask* mtaskp = nullptr;
+        for (const ThreadSchedule& schedule : schedules) {
+            for (const auto& thread : schedule.threads) {
+                if (!thread.empty()
+                    && (!mtaskp
+                        || ThreadSchedule::endTime(thread.back())
+                               > ThreadSchedule::endTime(mtaskp))) {
+                    lastp = &schedule;
+                    mtaskp = thread.back();
+                }
+            }
+        }
+        if (!lastp) return result;
+        std::unordered_map<const ExecMTask*, const ExecMTask*> prevOnThread;
+        for (const auto& thread : lastp->threads) {
+            for (size_t i = 1; i < thread.size(); ++i) prevOnThread[thread[i]] = thread[i - 1];
+        }
+        while (mtaskp) {
+            const uint32_t threadId = ThreadSchedule::threadId(mtaskp);
+            const ExecMTask* waitedp = nullptr;
+            for (const V3GraphEdge& edge : mtaskp->inEdges()) {
+                const ExecMTask* const priorp = edge.fromp()->as<ExecMTask>();
+                if (!lastp->contains(priorp) || ThreadSchedule::threadId(priorp) == threadId) {
+                    continue;
+                }
+                if (!waitedp
+                    || ThreadSchedule::endTime(priorp) > ThreadSchedule::endTime(waitedp)) {
+                    waitedp = priorp;
+                }
+            }
+            const auto prevIt = prevOnThread.find(mtaskp);
+            const ExecMTask* const prevp = prevIt == prevOnThread.end() ? nullptr : prevIt->second;
+            if (waitedp && mtaskp->threads() <= 1
+                && (!prevp
+                    || ThreadSchedule::endTime(prevp) < ThreadSchedule::endTime(waitedp))) {
+                // Waited for the other thread rather than this one
+                result.emplace_back(mtaskp, ThreadSchedule::threadId(waitedp));
+                mtaskp = waitedp;
+            } else {
+                mtaskp = prevp;
+            }
+        }
+        return result;
+    }
+
+    std::vector<ThreadSchedule> repack(V3Graph& mtaskGraph, uint32_t firstId) {
+        for (const V3GraphVertex& vtx : mtaskGraph.vertices()) {
+            ThreadSchedule::mtaskState.erase(vtx.as<const ExecMTask>());
+        }
+        ThreadSchedule::s_nextId = firstId;
+        return pack(mtaskGraph);
+    }
+
+    // Local search: move each task that waits on the critical path onto the
+    // thread it waits for, keeping the moves that shorten the schedule
+    std::vector<ThreadSchedule> refine(V3Graph& mtaskGraph, std::vector<ThreadSchedule> result,
+                                       uint32_t firstId, int iterations) {
+        uint32_t bestTime = endTime(result);
+        std::set<std::pair<const ExecMTask*, uint32_t>> tried;
+        bool lastIsBest = true;
+        for (int i = 0; i < iterations; ++i) {
+            std::pair<const ExecMTask*, uint32_t> move{nullptr, 0};
+            for (const auto& candidate : criticalMoves(result)) {
+                if (tried.insert(candidate).second) {
+                    move = candidate;
+                    break;
+                }
+            }
+            if (!move.first) break;
+            const auto pinIt = m_pinned.find(move.first);
+            const bool wasPinned = pinIt != m_pinned.end();
+            const uint32_t oldPin = wasPinned ? pinIt->second : 0;
+            m_pinned[move.first] = move.second;
+            std::vector<ThreadSchedule> trial = repack(mtaskGraph, firstId);
+            const uint32_t trialTime = endTime(trial);
+            UINFO(6, "Refine moving " << move.first->name() << " to th " << move.second
+                                      << " ends at " << trialTime << " vs " << bestTime);
+            if (trialTime < bestTime) {
+                bestTime = trialTime;
+                result = std::move(trial);
+                lastIsBest = true;
+            } else {
+                if (wasPinned) {
+                    m_pinned[move.first] = oldPin;
+                } else {
+                    m_pinned.erase(move.first);
+                }
+                lastIsBest = false;
+            }
+        }
+        // The per-mtask state must be of the schedule returned
+        if (!lastIsBest) result = repack(mtaskGraph, firstId);
+        return result;
+    }
+
+    static std::vector<ThreadSchedule> apply(V3Graph& mtaskGraph, uint64_t& unrefinedTimer,
+                                             uint64_t& refinedTimer) {
+        PackThreads packer;
+        const uint32_t firstId = ThreadSchedule::s_nextId;
+        std::vector<ThreadSchedule> result = packer.pack(mtaskGraph);
+        unrefinedTimer += endTime(result);
+        if (v3Global.opt.threadsRefine()) {
+            result = packer.refine(mtaskGraph, std::move(result), firstId,
+                                   v3Global.opt.threadsRefine());
+        }
+        refinedTimer += endTime(result);
+        return result;
     }
 };
 
@@ -840,6 +1055,44 @@ void fillinCosts(V3Graph* execMTaskGraphp) {
     }
 }
 
+void reportReplicatedMTasks(const V3Graph* execMTaskGraphp) {
+    // MTasks that only call the same sequence of functions (e.g. the logic of
+    // identical non-inlined instances, each called with its own instance
+    // pointer) evaluate replicated logic. Report how much of the graph that
+    // is, as a measure of what a data-parallel evaluation could gain.
+    std::map<std::vector<const AstCFunc*>, std::pair<uint32_t, uint64_t>> groups;
+    for (const V3GraphVertex& vtx : execMTaskGraphp->vertices()) {
+        const ExecMTask* const mtp = vtx.as<ExecMTask>();
+        std::vector<const AstCFunc*> calls;
+        for (const AstNode* stmtp = mtp->bodyp()->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            if (VN_IS(stmtp, Comment)) continue;
+            const AstStmtExpr* const exprp = VN_CAST(stmtp, StmtExpr);
+            const AstNodeCCall* const callp = exprp ? VN_CAST(exprp->exprp(), NodeCCall) : nullptr;
+            if (!callp) {
+                calls.clear();
+                break;
+            }
+            calls.push_back(callp->funcp());
+        }
+        if (calls.empty()) continue;
+        std::pair<uint32_t, uint64_t>& group = groups[calls];
+        ++group.first;
+        group.second += mtp->cost();
+    }
+    uint32_t replicatedGroups = 0;
+    uint32_t replicatedMTasks = 0;
+    uint64_t replicatedCost = 0;
+    for (const auto& it : groups) {
+        if (it.second.first < 2) continue;
+        ++replicatedGroups;
+        replicatedMTasks += it.second.first;
+        replicatedCost += it.second.second;
+    }
+    V3Stats::addStat("MTask graph, final, replicated mtask groups", replicatedGroups);
+    V3Stats::addStat("MTask graph, final, replicated mtask count", replicatedMTasks);
+    V3Stats::addStat("MTask graph, final, replicated mtask cost", replicatedCost);
+}
+
 void finalizeCosts(V3Graph* execMTaskGraphp) {
     GraphStreamUnordered ser(execMTaskGraphp, GraphWay::REVERSE);
     while (const V3GraphVertex* const vxp = ser.nextp()) {
@@ -894,6 +1147,7 @@ void finalizeCosts(V3Graph* execMTaskGraphp) {
     V3Stats::addStat("MTask graph, final, mtask count", report.vertexCount());
     V3Stats::addStat("MTask graph, final, edge count", report.edgeCount());
     V3Stats::addStat("MTask graph, final, parallelism factor", report.parallelismFactor());
+    reportReplicatedMTasks(execMTaskGraphp);
     if (debug() >= 3) {
         UINFO(0, "\n");
         UINFO(0, "    Final mtask parallelism report:");
@@ -929,7 +1183,8 @@ void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId,
         if (v3Global.opt.profExec()) {
             addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();\n");
         }
-        addStrStmt("vlSelf->" + name + +".waitUntilUpstreamDone(even_cycle);\n");
+        addStrStmt("vlSelf->" + name
+                   + ".waitUntilUpstreamDone(even_cycle, vlSymsp->__Vm_threadPoolp->park());\n");
         if (v3Global.opt.profExec()) {
             addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();\n");
         }
@@ -1023,6 +1278,11 @@ void addThreadStartWrapper(AstExecGraph* const execGraphp) {
         addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).execGraphBegin();\n");
     }
 
+    // Hierarchical children run within their parent's lease
+    if (!v3Global.opt.hierChild()) {
+        addStrStmt("vlSymsp->__Vm_threadPoolp->leaseAcquire(vlSymsp->_vm_contextp__);\n");
+    }
+
     addStrStmt("vlSymsp->__Vm_even_cycle__" + tag + " = !vlSymsp->__Vm_even_cycle__" + tag
                + ";\n");
 
@@ -1037,6 +1297,7 @@ void addThreadEndWrapper(AstExecGraph* const execGraphp) {
     };
 
     addStrStmt("Verilated::mtaskId(0);\n");
+    if (!v3Global.opt.hierChild()) addStrStmt("vlSymsp->__Vm_threadPoolp->leaseRelease();\n");
     if (v3Global.opt.profExec()) {
         addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).execGraphEnd();\n");
     }
@@ -1067,9 +1328,10 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
             // The first N-1 will run on the thread pool.
             if (v3Global.opt.hierChild() || !v3Global.opt.hierBlocks().empty()) {
                 addTextStmt("vlSymsp->__Vm_threadPoolp->workerp(indexes[" + cvtToStr(i)
-                            + "])->addTask(");
+                            + "])->addStealableTask(");
             } else {
-                addTextStmt("vlSymsp->__Vm_threadPoolp->workerp(" + cvtToStr(i) + ")->addTask(");
+                addTextStmt("vlSymsp->__Vm_threadPoolp->workerp(" + cvtToStr(i)
+                            + ")->addStealableTask(");
             }
             execGraphp->addStmtsp(new AstAddrOfCFunc{fl, funcp});
             addTextStmt(", vlSelf, vlSymsp->__Vm_even_cycle__" + tag + ");\n");
@@ -1088,7 +1350,8 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
         addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();\n");
     }
     addStrStmt("vlSelf->__Vm_mtaskstate_final__" + std::to_string(scheduleId) + tag
-               + ".waitUntilUpstreamDone(vlSymsp->__Vm_even_cycle__" + tag + ");\n");
+               + ".waitUntilUpstreamDone(vlSymsp->__Vm_even_cycle__" + tag
+               + ", vlSymsp->__Vm_threadPoolp->park());\n");
     if (v3Global.opt.profExec()) {
         addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();\n");
     }
@@ -1098,6 +1361,107 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
     }
 }
 
+void addDynamicScheduleToExecGraph(AstExecGraph* const execGraphp,
+                                   const ThreadSchedule& schedule) {
+    // Implement the schedule with a VlDynamicSchedule (--threads-rebalance). Each mtask gets its
+    // own entry function, and the runtime does the dependency tracking, so it can move mtasks
+    // between threads. The static schedule is the initial assignment.
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    const string& tag = execGraphp->name();
+    const string schedRef
+        = "vlSymsp->__Vm_dynamicScheduler.schedule(" + cvtToStr(schedule.id()) + ")";
+
+    const auto addStrStmt = [=](const string& stmt) -> void {  //
+        execGraphp->addStmtsp(new AstCStmt{fl, stmt});
+    };
+    const auto addTextStmt = [=](const string& text) -> void {
+        execGraphp->addStmtsp(new AstText{fl, text, /* tracking: */ true});
+    };
+
+    // Thread numbers at runtime: the thread running the last non-empty static thread is the
+    // calling thread, number 0, others are numbered in order from 1.
+    std::vector<const std::vector<const ExecMTask*>*> threads;
+    size_t nMTasks = 0;
+    for (const std::vector<const ExecMTask*>& thread : schedule.threads) {
+        if (!thread.empty()) threads.push_back(&thread);
+        nMTasks += thread.size();
+    }
+    UASSERT(!threads.empty(), "Non-empty ExecGraph yields no threads?");
+    const auto runtimeThread = [&](size_t i) { return i + 1 == threads.size() ? 0 : i + 1; };
+
+    // Merge the threads into a single topological order. Always succeeds, as the static schedule
+    // is free of deadlocks.
+    std::vector<std::pair<const ExecMTask*, size_t>> order;  // MTask and its runtime thread
+    std::unordered_map<const ExecMTask*, uint32_t> indices;  // Position in 'order'
+    std::vector<size_t> heads(threads.size(), 0);
+    while (order.size() < nMTasks) {
+        const size_t prevSize = order.size();
+        for (size_t i = 0; i < threads.size(); ++i) {
+            while (heads[i] < threads[i]->size()) {
+                const ExecMTask* const mtaskp = (*threads[i])[heads[i]];
+                bool ready = true;
+                for (const V3GraphEdge& edge : mtaskp->inEdges()) {
+                    const ExecMTask* const prevp = edge.fromp()->as<ExecMTask>();
+                    if (schedule.contains(prevp) && !indices.count(prevp)) ready = false;
+                }
+                if (!ready) break;
+                indices.emplace(mtaskp, static_cast<uint32_t>(order.size()));
+                order.emplace_back(mtaskp, runtimeThread(i));
+                ++heads[i];
+            }
+        }
+        UASSERT(order.size() != prevSize, "Thread schedule is not acyclic");
+    }
+
+    // Create an entry function for each mtask
+    addStrStmt("if (VL_UNLIKELY(" + schedRef + ".empty())) {\n");
+    addStrStmt(schedRef + ".threads(" + cvtToStr(schedule.threads.size()) + ");\n");
+    for (const auto& pair : order) {
+        const ExecMTask* const mtaskp = pair.first;
+        const string name{"__Vmtask__" + tag + "__s" + cvtToStr(schedule.id()) + "__m"
+                          + cvtToStr(mtaskp->id())};
+        AstCFunc* const funcp = new AstCFunc{fl, name, nullptr, "void"};
+        modp->addStmtsp(funcp);
+        funcp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+        funcp->isLoose(true);
+        funcp->entryPoint(true);
+        funcp->argTypes("void* voidSelf, bool even_cycle");
+        funcp->addStmtsp(new AstCStmt{fl, EmitCBase::voidSelfAssign(modp)});
+        funcp->addStmtsp(new AstCStmt{fl, EmitCBase::symClassAssign()});
+        if (v3Global.opt.profPgo()) {
+            funcp->addStmtsp(new AstCStmt{fl, "vlSymsp->_vm_pgoProfiler.startCounter("
+                                                  + std::to_string(mtaskp->id()) + ");\n"});
+        }
+        funcp->addStmtsp(mtaskp->bodyp()->unlinkFrBack());
+        if (v3Global.opt.profPgo()) {
+            funcp->addStmtsp(new AstCStmt{fl, "vlSymsp->_vm_pgoProfiler.stopCounter("
+                                                  + std::to_string(mtaskp->id()) + ");\n"});
+        }
+
+        // Register with its initial thread and upstream mtasks
+        std::vector<uint32_t> preds;
+        for (const V3GraphEdge& edge : mtaskp->inEdges()) {
+            const ExecMTask* const prevp = edge.fromp()->as<ExecMTask>();
+            if (schedule.contains(prevp)) preds.push_back(indices.at(prevp));
+        }
+        std::sort(preds.begin(), preds.end());
+        string predList;
+        for (const uint32_t pred : preds) {
+            if (!predList.empty()) predList += ", ";
+            predList += cvtToStr(pred);
+        }
+        addTextStmt(schedRef + ".addMTask(");
+        execGraphp->addStmtsp(new AstAddrOfCFunc{fl, funcp});
+        addTextStmt(", " + cvtToStr(pair.second) + ", {" + predList + "});\n");
+    }
+    addStrStmt("}\n");
+    V3Stats::addStatSum("Optimizations, Thread schedule total tasks", order.size());
+
+    addStrStmt(schedRef + ".execute(vlSymsp->__Vm_threadPoolp, vlSelf, vlSymsp->__Vm_even_cycle__"
+               + tag + ", vlSymsp->_vm_contextp__->threadsRebalance());\n");
+}
+
 void wrapMTaskBodies(AstExecGraph* const execGraphp) {
     FileLine* const flp = execGraphp->fileline();
     const string& tag = execGraphp->name();
@@ -1155,6 +1519,13 @@ void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& sc
     // Nothing to be done if there are no MTasks in the graph at all.
     if (execGraphp->depGraphp()->empty()) return;
 
+    // Hierarchical blocks share the thread pool by worker index, so always use static schedules
+    if (v3Global.opt.threadsRebalance() && v3Global.opt.hierBlocks().empty()
+        && !v3Global.opt.hierChild()) {
+        addDynamicScheduleToExecGraph(execGraphp, schedule);
+        return;
+    }
+
     // Create a function to be run by each thread. Note this moves all AstMTaskBody nodes form the
     // AstExecGraph into the AstCFunc created
     const std::vector<AstCFunc*>& funcps = createThreadFunctions(schedule, execGraphp->name());
@@ -1166,6 +1537,8 @@ void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& sc
 
 void implement(AstNetlist* netlistp) {
     // Called by Verilator top stage
+    uint64_t unrefinedTime = 0;  // Predicted time of all schedules before refinement
+    uint64_t refinedTime = 0;  // Predicted time of all schedules after refinement
     netlistp->topModulep()->foreach([&](AstExecGraph* execGraphp) {
         // Back in V3Order, we partitioned mtasks using provisional cost
         // estimates. However, V3Order precedes some optimizations (notably
@@ -1181,7 +1554,8 @@ void implement(AstNetlist* netlistp) {
 
         // Schedule the mtasks: statically associate each mtask with a thread,
         // and determine the order in which each thread will run its mtasks.
-        const std::vector<ThreadSchedule> packed = PackThreads::apply(*execGraphp->depGraphp());
+        const std::vector<ThreadSchedule> packed
+            = PackThreads::apply(*execGraphp->depGraphp(), unrefinedTime, refinedTime);
         V3Stats::addStatSum("Optimizations, Thread schedule count",
                             static_cast<double>(packed.size()));
 
@@ -1195,6 +1569,11 @@ void implement(AstNetlist* netlistp) {
 
         addThreadEndWrapper(execGraphp);
     });
+    if (v3Global.opt.threadsRefine() && refinedTime) {
+        V3Stats::addStat("Optimizations, Thread schedule refined time", refinedTime);
+        V3Stats::addStat("Optimizations, Thread schedule refined speedup",
+                         static_cast<double>(unrefinedTime) / refinedTime, 3);
+    }
 }
 
 void selfTest() {
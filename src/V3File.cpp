@@ -20,6 +20,7 @@
 
 #include "V3Os.h"
 #include "V3String.h"
+#include "V3ThreadPool.h"
 
 #include <cerrno>
 #include <cstdarg>
@@ -27,6 +28,7 @@
 #include <iomanip>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -147,7 +149,7 @@ public:
     void writeDepend(const string& filename);
     std::vector<string> getAllDeps() const;
     void writeTimes(const string& filename, const string& cmdlineIn);
-    bool checkTimes(const string& filename, const string& cmdlineIn);
+    bool checkTimes(const string& filename, const string& cmdlineIn, bool targetsOnly);
 };
 
 V3FileDependImp dependImp;  // Depend implementation class
@@ -223,7 +225,9 @@ void V3FileDependImp::writeTimes(const string& filename, const string& cmdlineIn
     }
 }
 
-bool V3FileDependImp::checkTimes(const string& filename, const string& cmdlineIn) {
+bool V3FileDependImp::checkTimes(const string& filename, const string& cmdlineIn,
+                                 bool targetsOnly) {
+    // If targetsOnly, ignore sources, and on success add targets as dependencies again
     const std::unique_ptr<std::ifstream> ifp{V3File::new_ifstream_nodepend(filename)};
     if (ifp->fail()) {
         UINFO(2, "   --check-times failed: no input " << filename);
@@ -248,6 +252,7 @@ bool V3FileDependImp::checkTimes(const string& filename, const string& cmdlineIn
     }
 
     const bool skipHashing = !V3Os::getenvStr("VERILATOR_DEBUG_SKIP_HASH", "").empty();
+    std::vector<string> targets;  // If targetsOnly, targets to depend on
 
     while (!ifp->eof()) {
         char chkDir;
@@ -271,6 +276,11 @@ bool V3FileDependImp::checkTimes(const string& filename, const string& cmdlineIn
         *ifp >> quote;
         const string chkFilename = V3Os::getline(*ifp, '"');
 
+        if (targetsOnly) {
+            if (chkDir != 'T') continue;
+            targets.push_back(chkFilename);
+        }
+
         V3Os::filesystemFlush(chkFilename);
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
         struct stat curStat;
@@ -320,6 +330,7 @@ bool V3FileDependImp::checkTimes(const string& filename, const string& cmdlineIn
             }
         }
     }
+    for (const string& target : targets) addTgtDepend(target);
     return true;
 }
 
@@ -333,8 +344,8 @@ std::vector<string> V3File::getAllDeps() { return dependImp.getAllDeps(); }
 void V3File::writeTimes(const string& filename, const string& cmdlineIn) {
     dependImp.writeTimes(filename, cmdlineIn);
 }
-bool V3File::checkTimes(const string& filename, const string& cmdlineIn) {
-    return dependImp.checkTimes(filename, cmdlineIn);
+bool V3File::checkTimes(const string& filename, const string& cmdlineIn, bool targetsOnly) {
+    return dependImp.checkTimes(filename, cmdlineIn, targetsOnly);
 }
 void V3File::createMakeDirFor(const string& filename) {
     if (filename != VL_DEV_NULL
@@ -360,6 +371,7 @@ class VInFilterImp final {
     using StrList = VInFilter::StrList;
 
     std::map<const std::string, std::string> m_contentsMap;  // Cache of file contents
+    std::unordered_map<std::string, std::string> m_prefetchMap;  // Read ahead contents, until used
     bool m_readEof = false;  // Received EOF on read
 #ifdef INFILTER_PIPE
     pid_t m_pid = 0;  // fork() process id
@@ -378,9 +390,33 @@ private:
         if (m_pid) {
             return readContentsFilter(filename, outl);
         } else {
+            const auto it = m_prefetchMap.find(filename);
+            if (it != m_prefetchMap.end()) {
+                outl.push_back(std::move(it->second));
+                m_prefetchMap.erase(it);
+                return true;
+            }
             return readContentsFile(filename, outl);
         }
     }
+    // Read a whole file without a filter, may be called from any thread
+    static bool readFileString(const string& filename, string& out) VL_MT_SAFE {
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        char buf[INFILTER_IPC_BUFSIZ];
+        while (true) {
+            const ssize_t got = read(fd, buf, INFILTER_IPC_BUFSIZ);
+            if (got > 0) {
+                out.append(buf, got);
+            } else if (got < 0 && errno == EINTR) {
+                continue;
+            } else {
+                break;
+            }
+        }
+        close(fd);
+        return true;
+    }
     bool readContentsFile(const string& filename, StrList& outl) {
         const int fd = open(filename.c_str(), O_RDONLY);
         if (fd < 0) return false;
@@ -610,6 +646,22 @@ protected:
         }
         return true;
     }
+    void prefetch(const std::vector<string>& filenames) {
+        if (m_pid) return;  // Pipe filter reads must be made in order
+        std::vector<string> contents(filenames.size());
+        std::vector<uint8_t> oks(filenames.size(), 0);
+        {
+            V3ThreadScope threadScope;
+            for (size_t i = 0; i < filenames.size(); ++i) {
+                threadScope.enqueue([&filenames, &contents, &oks, i]() {
+                    oks[i] = readFileString(filenames[i], contents[i]);
+                });
+            }
+        }
+        for (size_t i = 0; i < filenames.size(); ++i) {
+            if (oks[i]) m_prefetchMap.emplace(filenames[i], std::move(contents[i]));
+        }
+    }
     static size_t listSize(const StrList& sl) {
         size_t result = 0;
         for (const string& i : sl) result += i.length();
@@ -638,6 +690,10 @@ bool VInFilter::readWholefile(const string& filename, VInFilter::StrList& outl)
     UASSERT(m_impp, "readWholefile on invalid filter");
     return m_impp->readWholefile(filename, outl);
 }
+void VInFilter::prefetch(const std::vector<string>& filenames) {
+    UASSERT(m_impp, "prefetch on invalid filter");
+    m_impp->prefetch(filenames);
+}
 
 //######################################################################
 // V3OutFormatter: A class for printing code with automatic indentation.
@@ -69,7 +69,8 @@ public:
     static void writeDepend(const string& filename);
     static std::vector<string> getAllDeps();
     static void writeTimes(const string& filename, const string& cmdlineIn);
-    static bool checkTimes(const string& filename, const string& cmdlineIn);
+    static bool checkTimes(const string& filename, const string& cmdlineIn,
+                           bool targetsOnly = false);
 
     // Directory utilities
     static void createMakeDirFor(const string& filename);
@@ -99,6 +100,8 @@ public:
     // METHODS
     // Read file contents and return it.  Return true on success.
     bool readWholefile(const string& filename, StrList& outl);
+    // Read the given files ahead, in parallel, for later readWholefile calls
+    void prefetch(const std::vector<string>& filenames);
 };
 
 //============================================================================
@@ -334,6 +337,12 @@ public:
     V3OutJsonFile& put(const std::string& name, int value) {
         return putNamed(name, std::to_string(value), false);
     }
+    V3OutJsonFile& put(const std::string& name, uint64_t value) {
+        return putNamed(name, std::to_string(value), false);
+    }
+    V3OutJsonFile& put(const std::string& name, double value) {
+        return putNamed(name, std::to_string(value), false);
+    }
 
     // Put unnamed value
     V3OutJsonFile& put(const std::string& value) { return putNamed("", value, true); }
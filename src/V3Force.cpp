@@ -26,7 +26,13 @@
 //          assign <name>__VforceRd = <name>__VforceEn ? <name>__VforceVal : <name>;
 //      replace all READ references to <name> with a read reference to <name>_VforceRd
 //
-//  Replace each AstAssignForce with 3 assignments:
+//  Add a global flag __VforceAny, set by any force statement. The override of
+//  a vector signal not forceable externally is guarded by this flag, so
+//  until something is forced the override is a plain copy:
+//      <name>__VforceRd = __VforceAny ? <override> : <name>;
+//
+//  Replace each AstAssignForce with 4 assignments:
+//      - __VforceAny = 1
 //      - <lhs>__VforceEn = 1
 //      - <lhs>__VforceVal = <rhs>
 //      - <lhs>__VforceRd = <rhs>
@@ -78,10 +84,13 @@ public:
         AstVarScope* const m_rdVscp;  // New variable to replace read references with
         AstVarScope* const m_valVscp;  // Forced value
         AstVarScope* const m_enVscp;  // Force enabled signal
-        explicit ForceComponentsVarScope(AstVarScope* vscp, ForceComponentsVar& fcv)
+        AstVarScope* const m_anyVscp;  // Any force statement executed, nullptr if not guarded
+        explicit ForceComponentsVarScope(AstVarScope* vscp, ForceComponentsVar& fcv,
+                                         AstVarScope* anyVscp)
             : m_rdVscp{new AstVarScope{vscp->fileline(), vscp->scopep(), fcv.m_rdVarp}}
             , m_valVscp{new AstVarScope{vscp->fileline(), vscp->scopep(), fcv.m_valVarp}}
-            , m_enVscp{new AstVarScope{vscp->fileline(), vscp->scopep(), fcv.m_enVarp}} {
+            , m_enVscp{new AstVarScope{vscp->fileline(), vscp->scopep(), fcv.m_enVarp}}
+            , m_anyVscp{anyVscp} {
             m_rdVscp->addNext(m_enVscp);
             m_rdVscp->addNext(m_valVscp);
             vscp->addNextHere(m_rdVscp);
@@ -131,12 +140,18 @@ public:
             AstVarRef* const origp = new AstVarRef{flp, vscp, VAccess::READ};
             ForceState::markNonReplaceable(origp);
             if (ForceState::isRangedDType(vscp)) {
-                return new AstOr{
+                AstNodeExpr* const overridep = new AstOr{
                     flp,
                     new AstAnd{flp, new AstVarRef{flp, m_enVscp, VAccess::READ},
                                new AstVarRef{flp, m_valVscp, VAccess::READ}},
                     new AstAnd{flp, new AstNot{flp, new AstVarRef{flp, m_enVscp, VAccess::READ}},
                                origp}};
+                if (!m_anyVscp) return overridep;
+                // Skip the bitwise override until something was forced
+                AstVarRef* const copyp = origp->cloneTree(false);
+                ForceState::markNonReplaceable(copyp);
+                return new AstCond{flp, new AstVarRef{flp, m_anyVscp, VAccess::READ}, overridep,
+                                   copyp};
             }
             return new AstCond{flp, new AstVarRef{flp, m_enVscp, VAccess::READ},
                                new AstVarRef{flp, m_valVscp, VAccess::READ}, origp};
@@ -154,6 +169,7 @@ private:
     const VNUser3InUse m_user3InUse;
     AstUser1Allocator<AstVar, ForceComponentsVar> m_forceComponentsVar;
     AstUser1Allocator<AstVarScope, ForceComponentsVarScope> m_forceComponentsVarScope;
+    AstVarScope* m_anyVscp = nullptr;  // Flag set by any force statement
     std::unordered_map<const AstVarScope*,
                        std::pair<std::unordered_set<AstVarScope*>, std::vector<AstVarScope*>>>
         m_valVscps;
@@ -191,9 +207,28 @@ public:
     }
 
     // METHODS
+    AstVarScope* getAnyVscp() {
+        if (!m_anyVscp) {
+            AstScope* const scopeTopp = v3Global.rootp()->topScopep()->scopep();
+            FileLine* const flp = scopeTopp->fileline();
+            m_anyVscp = scopeTopp->createTemp("__VforceAny", 1);
+            AstAssign* const assignp
+                = new AstAssign{flp, new AstVarRef{flp, m_anyVscp, VAccess::WRITE},
+                                new AstConst{flp, AstConst::BitFalse{}}};
+            AstActive* const activep = new AstActive{
+                flp, "force-init", new AstSenTree{flp, new AstSenItem{flp, AstSenItem::Static{}}}};
+            activep->sensesStorep(activep->sensesp());
+            activep->addStmtsp(new AstInitial{flp, assignp});
+            scopeTopp->addBlocksp(activep);
+        }
+        return m_anyVscp;
+    }
     const ForceComponentsVarScope& getForceComponents(AstVarScope* vscp) {
         AstVar* const varp = vscp->varp();
-        return m_forceComponentsVarScope(vscp, vscp, m_forceComponentsVar(varp, varp));
+        // Signals forceable from outside can have their enable written directly by the user,
+        // without executing a force statement, so their override can't be guarded
+        AstVarScope* const anyVscp = varp->isForceable() ? nullptr : getAnyVscp();
+        return m_forceComponentsVarScope(vscp, vscp, m_forceComponentsVar(varp, varp), anyVscp);
     }
     ForceComponentsVarScope* tryGetForceComponents(AstVarRef* nodep) const {
         return m_forceComponentsVarScope.tryGet(nodep->varScopep());
@@ -264,9 +299,15 @@ class ForceConvertVisitor final : public VNVisitor {
             return m_state.getForceComponents(vscp).m_rdVscp;
         });
 
-        setEnp->addNext(setValp);
-        setEnp->addNext(setRdp);
-        relinker.relink(setEnp);
+        // Note a force happened, enabling the override of guarded signals
+        AstAssign* const setAnyp
+            = new AstAssign{flp, new AstVarRef{flp, m_state.getAnyVscp(), VAccess::WRITE},
+                            new AstConst{flp, AstConst::BitTrue{}}};
+
+        setAnyp->addNext(setEnp);
+        setAnyp->addNext(setValp);
+        setAnyp->addNext(setRdp);
+        relinker.relink(setAnyp);
     }
 
     void visit(AstRelease* nodep) override {
@@ -0,0 +1,247 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Specialize functions on constant arguments
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3FuncSpec's Transformations:
+//
+// For each AstCFunc with input arguments, called only via AstCCall:
+//      Group the call sites by the constants they pass to the arguments
+//      that the function only reads.
+//      For the most common groups, within a code size budget:
+//          Clone the function, replacing references to those arguments
+//          with the constants, and removing the arguments.
+//          Retarget the calls in the group to the clone, dropping the
+//          constant arguments.
+//      Remove the original function if no calls remain.
+//
+// The clones are then simplified by the following V3Const pass.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3FuncSpec.h"
+
+#include "V3InstrCount.h"
+#include "V3Stats.h"
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class FuncSpecialize final {
+    // TYPES
+    // Constant arguments of a call, as (argument index, constant) pairs
+    using Pattern = std::vector<std::pair<size_t, AstConst*>>;
+    struct Group final {
+        Pattern m_pattern;  // Constant arguments shared by the calls
+        std::vector<AstCCall*> m_callps;  // Calls passing these constants
+    };
+
+    // CONSTANTS
+    static constexpr size_t MAX_CLONES = 4;  // Maximum specializations of each function
+    static constexpr uint32_t MAX_CLONED_COST = 2000;  // Maximum cost of clones of each function
+
+    // STATE
+    std::vector<AstCFunc*> m_funcps;  // Called functions, in order of first call
+    std::unordered_map<const AstCFunc*, std::vector<AstCCall*>> m_calls;  // Calls of function
+    std::unordered_set<const AstCFunc*> m_unsafe;  // Functions referenced other than by AstCCall
+    std::vector<AstCFunc*> m_specializedps;  // Functions that got clones
+    size_t m_cloneNum = 0;  // Unique number for clone names
+    VDouble0 m_statClones;  // Statistic tracking
+    VDouble0 m_statCalls;  // Statistic tracking
+    VDouble0 m_statRemoved;  // Statistic tracking
+
+    // METHODS
+    static bool isCandidate(const AstCFunc* funcp) {
+        return funcp->argsp() && !funcp->entryPoint() && !funcp->funcPublic()
+               && !funcp->isVirtual() && !funcp->isConstructor() && !funcp->isDestructor()
+               && !funcp->isCoroutine() && !funcp->recursive() && !funcp->needProcess()
+               && !funcp->isTrace() && !funcp->dpiExportImpl() && !funcp->dpiImportWrapper()
+               && !funcp->dpiImportPrototype() && !funcp->dpiExportDispatcher();
+    }
+
+    // Return whether the argument can be replaced by a constant: a simple
+    // input that the function never writes, nor names in raw C++ text
+    static bool isSpecializable(AstCFunc* funcp, const AstVar* argp) {
+        if (argp->direction() != VDirection::INPUT) return false;
+        if (!VN_IS(argp->dtypeSkipRefp(), BasicDType)) return false;
+        return !funcp->exists([&](const AstNode* nodep) {
+            if (const AstNodeVarRef* const refp = VN_CAST(nodep, NodeVarRef)) {
+                return refp->varp() == argp && refp->access().isWriteOrRW();
+            }
+            if (const AstNodeText* const textp = VN_CAST(nodep, NodeText)) {
+                return textp->text().find(argp->name()) != string::npos;
+            }
+            return false;
+        });
+    }
+
+    static std::vector<AstNode*> listOf(AstNode* headp) {
+        std::vector<AstNode*> nodeps;
+        for (AstNode* nodep = headp; nodep; nodep = nodep->nextp()) nodeps.push_back(nodep);
+        return nodeps;
+    }
+
+    void addCall(AstCCall* callp) {
+        std::vector<AstCCall*>& callps = m_calls[callp->funcp()];
+        if (callps.empty()) m_funcps.push_back(callp->funcp());
+        callps.push_back(callp);
+    }
+
+    void specialize(AstCFunc* funcp, const Group& group) {
+        AstCFunc* const clonep = funcp->cloneTree(false);
+        clonep->name(funcp->name() + "__Vspec" + cvtToStr(m_cloneNum++));
+        funcp->addNextHere(clonep);
+        ++m_statClones;
+        UINFO(6, "Specialize " << funcp << " as " << clonep->name());
+        // Calls made by the clone may themselves be specialized, if their
+        // callee is processed later
+        clonep->foreach([&](AstCCall* callp) { addCall(callp); });
+
+        // Replace the constant arguments in the clone
+        const std::vector<AstNode*> argps = listOf(clonep->argsp());
+        for (const auto& pair : group.m_pattern) {
+            AstVar* const argp = VN_AS(argps[pair.first], Var);
+            std::vector<AstNodeVarRef*> refps;
+            clonep->foreach([&](AstNodeVarRef* refp) {
+                if (refp->varp() == argp) refps.push_back(refp);
+            });
+            for (AstNodeVarRef* const refp : refps) {
+                AstConst* const newp = pair.second->cloneTree(false);
+                newp->dtypeFrom(argp);
+                refp->replaceWith(newp);
+                VL_DO_DANGLING(refp->deleteTree(), refp);
+            }
+            VL_DO_DANGLING(argp->unlinkFrBack()->deleteTree(), argp);
+        }
+
+        // Retarget the calls, last so the pattern constants stay valid until here
+        for (AstCCall* const callp : group.m_callps) {
+            const std::vector<AstNode*> callArgps = listOf(callp->argsp());
+            for (const auto& pair : group.m_pattern) {
+                AstNode* const argp = callArgps[pair.first];
+                VL_DO_DANGLING(argp->unlinkFrBack()->deleteTree(), argp);
+            }
+            callp->funcp(clonep);
+            ++m_statCalls;
+        }
+    }
+
+    void specializeFunc(AstCFunc* funcp) {
+        if (!isCandidate(funcp) || m_unsafe.count(funcp)) return;
+        const std::vector<AstNode*> argps = listOf(funcp->argsp());
+        std::vector<bool> specializable;
+        bool anySpecializable = false;
+        for (AstNode* const nodep : argps) {
+            const AstVar* const argp = VN_CAST(nodep, Var);
+            if (!argp) return;
+            specializable.push_back(isSpecializable(funcp, argp));
+            anySpecializable |= specializable.back();
+        }
+        if (!anySpecializable) return;
+
+        // Group the calls by their constant arguments
+        const std::vector<AstCCall*> callps = m_calls[funcp];
+        std::map<string, size_t> groupIndex;  // Pattern key -> index in groups
+        std::vector<Group> groups;
+        for (AstCCall* const callp : callps) {
+            const std::vector<AstNode*> callArgps = listOf(callp->argsp());
+            if (callArgps.size() != argps.size()) return;  // Unusual call, leave function
+            Pattern pattern;
+            string key;
+            for (size_t i = 0; i < argps.size(); ++i) {
+                if (!specializable[i]) continue;
+                AstConst* const constp = VN_CAST(callArgps[i], Const);
+                if (!constp || constp->width() != argps[i]->width()) continue;
+                pattern.emplace_back(i, constp);
+                key += cvtToStr(i) + "=" + constp->num().ascii() + ";";
+            }
+            if (pattern.empty()) continue;
+            const auto pair = groupIndex.emplace(key, groups.size());
+            if (pair.second) groups.push_back(Group{pattern, {}});
+            groups[pair.first->second].m_callps.push_back(callp);
+        }
+        if (groups.empty()) return;
+
+        // Specialize the most called patterns first, within the budget
+        std::stable_sort(groups.begin(), groups.end(), [](const Group& a, const Group& b) {
+            return a.m_callps.size() > b.m_callps.size();
+        });
+        const uint32_t cost = std::max<uint32_t>(1, V3InstrCount::count(funcp, false));
+        uint32_t clonedCost = 0;
+        size_t nCloned = 0;
+        for (const Group& group : groups) {
+            if (nCloned >= MAX_CLONES || clonedCost + cost > MAX_CLONED_COST) break;
+            specialize(funcp, group);
+            clonedCost += cost;
+            ++nCloned;
+        }
+        if (nCloned) m_specializedps.push_back(funcp);
+    }
+
+    // Remove general versions that have no calls left
+    void removeUnused(AstNetlist* netlistp) {
+        std::unordered_set<const AstCFunc*> used;
+        netlistp->foreach([&](const AstNode* nodep) {
+            if (const AstNodeCCall* const callp = VN_CAST(nodep, NodeCCall)) {
+                used.emplace(callp->funcp());
+            } else if (const AstAddrOfCFunc* const addrp = VN_CAST(nodep, AddrOfCFunc)) {
+                used.emplace(addrp->funcp());
+            }
+        });
+        for (AstCFunc* funcp : m_specializedps) {
+            if (used.count(funcp)) continue;
+            UINFO(6, "Remove unused " << funcp);
+            VL_DO_DANGLING(funcp->unlinkFrBack()->deleteTree(), funcp);
+            ++m_statRemoved;
+        }
+    }
+
+public:
+    // CONSTRUCTORS
+    explicit FuncSpecialize(AstNetlist* netlistp) {
+        netlistp->foreach([&](AstNode* nodep) {
+            if (AstCCall* const callp = VN_CAST(nodep, CCall)) {
+                addCall(callp);
+            } else if (const AstNodeCCall* const ccallp = VN_CAST(nodep, NodeCCall)) {
+                m_unsafe.emplace(ccallp->funcp());  // AstCMethodCall, AstCNew
+            } else if (const AstAddrOfCFunc* const addrp = VN_CAST(nodep, AddrOfCFunc)) {
+                m_unsafe.emplace(addrp->funcp());
+            }
+        });
+        // Index loop, as clones may add newly called functions
+        for (size_t i = 0; i < m_funcps.size(); ++i) specializeFunc(m_funcps[i]);
+        removeUnused(netlistp);
+    }
+    ~FuncSpecialize() {
+        V3Stats::addStat("Optimizations, FuncSpec specialized functions", m_statClones);
+        V3Stats::addStat("Optimizations, FuncSpec specialized calls", m_statCalls);
+        V3Stats::addStat("Optimizations, FuncSpec removed general functions", m_statRemoved);
+    }
+};
+
+//######################################################################
+
+void V3FuncSpec::funcSpecAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { FuncSpecialize{nodep}; }
+    V3Global::dumpCheckGlobalTree("funcspec", 0, dumpTreeEitherLevel() >= 3);
+}
@@ -84,6 +84,7 @@ class GateVarVertex final : public GateEitherVertex {
     bool m_isClock = false;
     AstNode* m_rstSyncNodep = nullptr;  // Used as reset and not in SenItem, in clocked always
     AstNode* m_rstAsyncNodep = nullptr;  // Used as reset and in SenItem, in clocked always
+    int64_t m_rejectedAt = -1;  // Driver substitution count when inlining was last rejected
 public:
     GateVarVertex(V3Graph* graphp, AstVarScope* varScp)
         : GateEitherVertex{graphp}
@@ -103,6 +104,8 @@ public:
     void rstSyncNodep(AstNode* nodep) { m_rstSyncNodep = nodep; }
     AstNode* rstAsyncNodep() const { return m_rstAsyncNodep; }
     void rstAsyncNodep(AstNode* nodep) { m_rstAsyncNodep = nodep; }
+    int64_t rejectedAt() const { return m_rejectedAt; }
+    void rejectedAt(int64_t value) { m_rejectedAt = value; }
 
     // METHODS
     void propagateAttrClocksFrom(GateVarVertex* fromp) {
@@ -124,6 +127,7 @@ class GateLogicVertex final : public GateEitherVertex {
     AstNode* const m_nodep;
     AstActive* const m_activep;  // Under what active; nullptr is ok (under cfunc or such)
     const bool m_slow;  // In slow block
+    uint32_t m_substitutions = 0;  // Number of substitutions recorded into this logic
 public:
     GateLogicVertex(V3Graph* graphp, AstNode* nodep, AstActive* activep, bool slow)
         : GateEitherVertex{graphp}
@@ -137,6 +141,8 @@ public:
     AstNode* nodep() const { return m_nodep; }
     AstActive* activep() const { return m_activep; }
     bool slow() const { return m_slow; }
+    uint32_t substitutions() const { return m_substitutions; }
+    void addSubstitution() { ++m_substitutions; }
 
     // DOT debug
     std::string name() const override { return m_nodep->fileline()->ascii(); }
@@ -168,7 +174,12 @@ public:
                 vVtxp->clearReducibleAndDedupable("VirtIface");
                 vVtxp->setConsumed("VirtIface");
             }
-            if (vscp->varp()->isSigPublic()) {
+            if (vscp->varp()->isSigUserRdSampled()) {
+                // Only read between evaluations, so readers may use its logic directly,
+                // but the signal itself must still be computed
+                vVtxp->clearDedupable("SigPublicSampled");
+                vVtxp->setConsumed("SigPublicSampled");
+            } else if (vscp->varp()->isSigPublic()) {
                 // Public signals shouldn't be changed, pli code might be messing with them
                 vVtxp->clearReducibleAndDedupable("SigPublic");
                 vVtxp->setConsumed("SigPublic");
@@ -682,6 +693,7 @@ class GateInline final {
     size_t m_statInlined = 0;  // Statistic tracking - signals inlined
     size_t m_statRefs = 0;  // Statistic tracking
     size_t m_statExcluded = 0;  // Statistic tracking
+    size_t m_statRechecksSkipped = 0;  // Statistic tracking
 
     // METHODS
     static bool isCheapWide(const AstNodeExpr* exprp) {
@@ -803,16 +815,24 @@ class GateInline final {
             if (!lVtxp->reducible()) continue;
             AstNode* const logicp = lVtxp->nodep();
 
+            // If rejected by an earlier pass, only look again if the driving logic changed
+            if (vVtxp->rejectedAt() == lVtxp->substitutions()) {
+                ++m_statRechecksSkipped;
+                continue;
+            }
+
             // Commit pending optimizations to driving logic, as we will re-analyze
             commitSubstitutions(logicp);
 
             // Can we eliminate?
             const GateOkVisitor okVisitor{logicp, vVtxp->isClock(), false};
 
-            // Was it ok?
-            if (!okVisitor.isSimple()) continue;
-            // If the varScope is already removed from logicp, no need to try substitution.
-            if (!okVisitor.varAssigned(vVtxp->varScp())) continue;
+            // Was it ok? If the varScope is already removed from logicp, no need to try
+            // substitution.
+            if (!okVisitor.isSimple() || !okVisitor.varAssigned(vVtxp->varScp())) {
+                vVtxp->rejectedAt(lVtxp->substitutions());
+                continue;
+            }
             if (excludedWide(vVtxp, okVisitor.substitutionp())) {
                 ++m_statExcluded;
                 UINFO(9, "Gate inline exclude '" << vVtxp->name() << "'");
@@ -884,6 +904,7 @@ class GateInline final {
                 }
 
                 recordSubstitution(vscp, substp, dstVtxp->nodep());
+                dstVtxp->addSubstitution();
 
                 // If the new replacement referred to a signal,
                 // Correct the graph to point to this new generating variable
@@ -899,8 +920,8 @@ class GateInline final {
                 ++m_statRefs;
             }
 
-            // If removed all usage
-            if (vVtxp->outEmpty()) {
+            // If removed all usage, and the user can't read it
+            if (vVtxp->outEmpty() && !vscp->varp()->isSigPublic()) {
                 // Remove Variable vertex
                 VL_DO_DANGLING(vVtxp->unlinkDelete(&m_graph), vVtxp);
                 // Remove driving logic and vertex
@@ -931,6 +952,7 @@ class GateInline final {
         V3Stats::addStat("Optimizations, Gate sigs deleted", m_statInlined);
         V3Stats::addStat("Optimizations, Gate inputs replaced", m_statRefs);
         V3Stats::addStat("Optimizations, Gate excluded wide expressions", m_statExcluded);
+        V3Stats::addStat("Optimizations, Gate inline rechecks skipped", m_statRechecksSkipped);
     }
 
 public:
@@ -1410,9 +1432,19 @@ void V3Gate::gateAll(AstNetlist* netlistp) {
     UINFO(2, __FUNCTION__ << ":");
 
     {
+        // Time each sub-phase for --stats
+        VlOs::DeltaWallTime phaseTime{v3Global.opt.stats()};
+        const auto phaseDone = [&phaseTime](const char* namep) {
+            if (!v3Global.opt.stats()) return;
+            V3Stats::addStatPerf(std::string{"Optimizations, Gate time (sec), "} + namep,
+                                 phaseTime.deltaTime());
+            phaseTime.start();
+        };
+
         // Build the graph
         std::unique_ptr<GateGraph> graphp = GateBuildVisitor::apply(netlistp);
         if (dumpGraphLevel() >= 3) graphp->dumpDotFilePrefixed("gate_graph");
+        phaseDone("build");
 
         // Warn, before loss of sync/async pointers
         v3GateWarnSyncAsync(*graphp);
@@ -1425,26 +1457,31 @@ void V3Gate::gateAll(AstNetlist* netlistp) {
         // the same logic block will have and edge to the logic block with weight 2
         graphp->removeRedundantEdgesSum(&V3GraphEdge::followAlwaysTrue);
         if (dumpGraphLevel() >= 6) graphp->dumpDotFilePrefixed("gate_simp");
+        phaseDone("simplify");
 
         // Inline variables
         GateInline::apply(*graphp);
         if (dumpGraphLevel() >= 6) graphp->dumpDotFilePrefixed("gate_inline");
+        phaseDone("inline");
 
         // Remove redundant logic
         if (v3Global.opt.fDedupe()) {
             GateDedupe::apply(*graphp);
             if (dumpGraphLevel() >= 6) graphp->dumpDotFilePrefixed("gate_dedup");
+            phaseDone("dedupe");
         }
 
         // Merge assignments
         if (v3Global.opt.fAssemble()) {
             GateMergeAssignments::apply(*graphp);
             if (dumpGraphLevel() >= 6) graphp->dumpDotFilePrefixed("gate_merge");
+            phaseDone("merge");
         }
 
         // Remove unused logic
         GateUnused::apply(*graphp);
         if (dumpGraphLevel() >= 3) graphp->dumpDotFilePrefixed("gate_final");
+        phaseDone("unused");
     }
 
     V3Global::dumpCheckGlobalTree("gate", 0, dumpTreeEitherLevel() >= 3);
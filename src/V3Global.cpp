@@ -23,6 +23,7 @@
 #include "V3File.h"
 #include "V3HierBlock.h"
 #include "V3LinkCells.h"
+#include "V3Os.h"
 #include "V3Parse.h"
 #include "V3Stats.h"
 #include "V3ThreadPool.h"
@@ -56,6 +57,23 @@ void V3Global::readFiles() {
 
     V3Parse parser{v3Global.rootp(), &filter};
 
+    // Read the top and library files ahead in parallel, as reading them is
+    // independent, although preprocessing and parsing must be in order
+    {
+        FileLine* const cmdfl = new FileLine{FileLine::commandLineFilename()};
+        std::vector<string> filenames;
+        for (const auto& filelib : v3Global.opt.vFiles()) {
+            const string filename = v3Global.opt.filePath(cmdfl, filelib.filename(), "", "");
+            if (!filename.empty()) filenames.push_back(filename);
+        }
+        for (const auto& filelib : v3Global.opt.libraryFiles()) {
+            const string filename = v3Global.opt.filePath(cmdfl, filelib.filename(), "", "");
+            if (!filename.empty()) filenames.push_back(filename);
+        }
+        if (filenames.size() > 1) filter.prefetch(filenames);
+        VL_DO_DANGLING(delete cmdfl, cmdfl);
+    }
+
     // Parse the std waivers
     if (v3Global.opt.stdWaiver()) {
         parser.parseFile(
@@ -129,6 +147,22 @@ string V3Global::digitsFilename(int number) {
     return ss.str();
 }
 
+// With --max-memory, release freed memory when over the limit, and if that
+// is not enough, report the stage responsible
+static void checkMaxMemory(const string& stagename) {
+    static bool s_reported = false;
+    const uint64_t limit = static_cast<uint64_t>(v3Global.opt.maxMemory()) << 20;
+    uint64_t memPeak, memCurrent;
+    VlOs::memUsageBytes(memPeak /*ref*/, memCurrent /*ref*/);
+    if (memCurrent < limit) return;
+    V3Os::releaseMemory();
+    VlOs::memUsageBytes(memPeak /*ref*/, memCurrent /*ref*/);
+    if (memCurrent < limit || s_reported) return;
+    s_reported = true;
+    v3info("Memory usage of " << (memCurrent >> 20) << " MB exceeds --max-memory of "
+                              << (limit >> 20) << " MB after stage '" << stagename << "'");
+}
+
 void V3Global::dumpCheckGlobalTree(const string& stagename, int newNumber, bool doDump) {
     const string treeFilename = v3Global.debugFilename(stagename + ".tree", newNumber);
     if (dumpTreeLevel()) v3Global.rootp()->dumpTreeFile(treeFilename, doDump);
@@ -139,6 +173,7 @@ void V3Global::dumpCheckGlobalTree(const string& stagename, int newNumber, bool
         v3Global.rootp()->dumpTreeDotFile(treeFilename + ".dot", doDump);
     }
     if (v3Global.opt.stats()) V3Stats::statsStage(stagename);
+    if (v3Global.opt.maxMemory()) checkMaxMemory(stagename);
 
     if (doDump && v3Global.opt.debugEmitV()) V3EmitV::debugEmitV(treeFilename + ".v");
     if (v3Global.opt.debugCheck() || dumpTreeEitherLevel()) {
@@ -161,10 +196,12 @@ void V3Global::idPtrMapDumpJson(std::ostream& os) {
 }
 
 void V3Global::saveJsonPtrFieldName(const std::string& fieldName) {
+    const V3LockGuard lock{m_jsonPtrNamesMutex};
     m_jsonPtrNames.insert(fieldName);
 }
 
 void V3Global::ptrNamesDumpJson(std::ostream& os) {
+    const V3LockGuard lock{m_jsonPtrNamesMutex};
     std::string sep = "\n  ";
     os << "\"ptrFieldNames\": [";
     for (const auto& itr : m_jsonPtrNames) {
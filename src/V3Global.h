@@ -132,8 +132,17 @@ class V3Global final {
     std::unordered_map<const void*, std::string>
         m_ptrToId;  // The actual 'address' <=> 'short string' bijection
 
-    // Names of fields that were dumped by dumpJsonPtr()
-    std::unordered_set<std::string> m_jsonPtrNames;
+    // Source blocks instrumented by --prof-blocks, indexed by their counter number
+    std::vector<std::string> m_profBlockNames;
+    std::unordered_map<std::string, uint32_t> m_profBlockIds;  // Name -> counter number
+
+    // Branches instrumented by --prof-pgo, indexed by their counter number
+    std::vector<std::string> m_pgoBranchNames;
+    std::unordered_map<std::string, uint32_t> m_pgoBranchIds;  // Name -> counter number
+
+    // Names of fields that were dumped by dumpJsonPtr(), which may run in parallel
+    V3Mutex m_jsonPtrNamesMutex;  // Protects m_jsonPtrNames
+    std::unordered_set<std::string> m_jsonPtrNames VL_GUARDED_BY(m_jsonPtrNamesMutex);
 
     // Id of the main thread
     const std::thread::id m_mainThreadId = std::this_thread::get_id();
@@ -206,6 +215,20 @@ public:
     void useParallelBuild(bool flag) { m_useParallelBuild = flag; }
     bool useRandomizeMethods() const { return m_useRandomizeMethods; }
     void useRandomizeMethods(bool flag) { m_useRandomizeMethods = flag; }
+    // Counter number of the given source block, shared by all its instances
+    uint32_t profBlockId(const std::string& name) {
+        const auto pair = m_profBlockIds.emplace(name, m_profBlockNames.size());
+        if (pair.second) m_profBlockNames.push_back(name);
+        return pair.first->second;
+    }
+    const std::vector<std::string>& profBlockNames() const { return m_profBlockNames; }
+    // Counter number of the given source branch, shared by all its instances
+    uint32_t pgoBranchId(const std::string& name) {
+        const auto pair = m_pgoBranchIds.emplace(name, m_pgoBranchNames.size());
+        if (pair.second) m_pgoBranchNames.push_back(name);
+        return pair.first->second;
+    }
+    const std::vector<std::string>& pgoBranchNames() const { return m_pgoBranchNames; }
     void saveJsonPtrFieldName(const std::string& fieldName);
     void ptrNamesDumpJson(std::ostream& os);
     void idPtrMapDumpJson(std::ostream& os);
@@ -227,6 +227,42 @@ void V3Graph::clearColors() {
     for (V3GraphVertex& vertex : vertices()) vertex.color(0);
 }
 
+//######################################################################
+//######################################################################
+// Graph compressed sparse row view
+
+V3GraphCsr::V3GraphCsr(V3Graph* graphp, V3EdgeFuncP edgeFuncp, bool withIns) {
+    // Number the vertices
+    for (V3GraphVertex& vertex : graphp->vertices()) {
+        vertex.user(static_cast<uint32_t>(m_vertexps.size()));
+        m_vertexps.push_back(&vertex);
+    }
+    const auto follow
+        = [edgeFuncp](const V3GraphEdge& edge) { return edge.weight() && edgeFuncp(&edge); };
+    m_outStart.reserve(m_vertexps.size() + 1);
+    for (V3GraphVertex* const vertexp : m_vertexps) {
+        m_outStart.push_back(static_cast<uint32_t>(m_outs.size()));
+        for (const V3GraphEdge& edge : vertexp->outEdges()) {
+            if (follow(edge)) m_outs.push_back(edge.top()->user());
+        }
+    }
+    m_outStart.push_back(static_cast<uint32_t>(m_outs.size()));
+    m_outs.shrink_to_fit();
+    if (!withIns) {
+        m_inStart.assign(m_vertexps.size() + 1, 0);
+        return;
+    }
+    m_inStart.reserve(m_vertexps.size() + 1);
+    m_ins.reserve(m_outs.size());
+    for (V3GraphVertex* const vertexp : m_vertexps) {
+        m_inStart.push_back(static_cast<uint32_t>(m_ins.size()));
+        for (const V3GraphEdge& edge : vertexp->inEdges()) {
+            if (follow(edge)) m_ins.push_back(edge.fromp()->user());
+        }
+    }
+    m_inStart.push_back(static_cast<uint32_t>(m_ins.size()));
+}
+
 //======================================================================
 // Dumping
 
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <vector>
 
 class FileLine;
 class V3Graph;
@@ -380,6 +381,7 @@ public:
 
     /// Assign same color to all vertices in the same weakly connected component
     /// Thus different color if there's no edges between the two subgraphs
+    /// Side-effect: changes user()
     void weaklyConnected(V3EdgeFuncP edgeFuncp) VL_MT_DISABLED;
 
     /// Assign same color to all vertices that are strongly connected
@@ -488,6 +490,39 @@ public:
     virtual string loopsVertexCb(V3GraphVertex* vertexp) VL_MT_DISABLED;
 };
 
+//============================================================================
+// Frozen compressed sparse row view of the followed edges of a V3Graph.
+// Vertices are numbered in graph order, and the neighbours of each vertex
+// are a contiguous run of vertex numbers, so read-only algorithms on large
+// graphs walk arrays instead of chasing edge and vertex pointers, and keep
+// their per-vertex state in parallel arrays indexed by vertex number.
+// The view must not be used after the graph is edited.
+
+class V3GraphCsr final {
+    // MEMBERS
+    std::vector<V3GraphVertex*> m_vertexps;  // Vertex of each number
+    std::vector<uint32_t> m_outStart;  // First m_outs index of each vertex, then end
+    std::vector<uint32_t> m_outs;  // Vertex numbers of followed out edges
+    std::vector<uint32_t> m_inStart;  // First m_ins index of each vertex, then end
+    std::vector<uint32_t> m_ins;  // Vertex numbers of followed in edges, if built
+
+public:
+    // CONSTRUCTORS
+    /// Build from edges with non-zero weight that edgeFuncp follows, and
+    /// also the in edges if withIns.  Side-effect: changes user()
+    V3GraphCsr(V3Graph* graphp, V3EdgeFuncP edgeFuncp, bool withIns = false) VL_MT_DISABLED;
+    ~V3GraphCsr() = default;
+    VL_UNCOPYABLE(V3GraphCsr);
+
+    // ACCESSORS
+    uint32_t size() const { return static_cast<uint32_t>(m_vertexps.size()); }
+    V3GraphVertex* vertexp(uint32_t v) const { return m_vertexps[v]; }
+    const uint32_t* outBegin(uint32_t v) const { return m_outs.data() + m_outStart[v]; }
+    const uint32_t* outEnd(uint32_t v) const { return m_outs.data() + m_outStart[v + 1]; }
+    const uint32_t* inBegin(uint32_t v) const { return m_ins.data() + m_inStart[v]; }
+    const uint32_t* inEnd(uint32_t v) const { return m_ins.data() + m_inStart[v + 1]; }
+};
+
 //============================================================================
 
 #endif  // Guard
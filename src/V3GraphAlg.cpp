@@ -132,36 +132,41 @@ void V3Graph::removeTransitiveEdges() { GraphAlgRemoveTransitiveEdges{this}.go()
 //######################################################################
 //######################################################################
 // Algorithms - weakly connected components
-// Changes color()
+// Changes user() and color()
 
 class GraphAlgWeakly final : GraphAlg<> {
+    const V3GraphCsr m_csr;  // Followed edges, both ways
+    std::vector<uint32_t> m_colors;  // Color of each vertex number
+
     void main() {
         // Initialize state
-        m_graphp->clearColors();
+        m_colors.assign(m_csr.size(), 0);
         // Color graph
         uint32_t currentColor = 0;
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
+        for (uint32_t v = 0; v < m_csr.size(); ++v) {
             currentColor++;
-            vertexIterate(&vertex, currentColor);
+            vertexIterate(v, currentColor);
         }
+        for (uint32_t v = 0; v < m_csr.size(); ++v) m_csr.vertexp(v)->color(m_colors[v]);
     }
 
-    void vertexIterate(V3GraphVertex* vertexp, uint32_t currentColor) {
+    void vertexIterate(uint32_t v, uint32_t currentColor) {
         // Assign new color to each unvisited node
         // then visit each of its edges, giving them the same color
-        if (vertexp->color()) return;  // Already colored it
-        vertexp->color(currentColor);
-        for (V3GraphEdge& edge : vertexp->outEdges()) {
-            if (followEdge(&edge)) vertexIterate(edge.top(), currentColor);
+        if (m_colors[v]) return;  // Already colored it
+        m_colors[v] = currentColor;
+        for (const uint32_t* itp = m_csr.outBegin(v); itp != m_csr.outEnd(v); ++itp) {
+            vertexIterate(*itp, currentColor);
         }
-        for (V3GraphEdge& edge : vertexp->inEdges()) {
-            if (followEdge(&edge)) vertexIterate(edge.fromp(), currentColor);
+        for (const uint32_t* itp = m_csr.inBegin(v); itp != m_csr.inEnd(v); ++itp) {
+            vertexIterate(*itp, currentColor);
         }
     }
 
 public:
     GraphAlgWeakly(V3Graph* graphp, V3EdgeFuncP edgeFuncp)
-        : GraphAlg<>(graphp, edgeFuncp) {
+        : GraphAlg<>(graphp, edgeFuncp)
+        , m_csr{graphp, edgeFuncp, true} {
         main();
     }
     ~GraphAlgWeakly() = default;
@@ -175,80 +180,77 @@ void V3Graph::weaklyConnected(V3EdgeFuncP edgeFuncp) { GraphAlgWeakly{this, edge
 // Changes user() and color()
 
 class GraphAlgStrongly final : GraphAlg<> {
+    const V3GraphCsr m_csr;  // Followed edges
+    std::vector<uint32_t> m_dfs;  // Vertex DFS numbers, see main()
+    std::vector<uint32_t> m_colors;  // Vertex colors, see main()
     uint32_t m_currentDfs = 0;  // DFS count
-    std::vector<V3GraphVertex*> m_callTrace;  // List of everything we hit processing so far
+    std::vector<uint32_t> m_callTrace;  // List of everything we hit processing so far
 
     void main() {
         // Use Pearce's algorithm to color the strongly connected components. For reference see
         // "An Improved Algorithm for Finding the Strongly Connected Components of a Directed
         // Graph", David J.Pearce, 2005
         //
-        // Node State:
-        //     Vertex::user     // DFS number indicating possible root of subtree, 0=not iterated
-        //     Vertex::color    // Output subtree number (fully processed)
+        // Node State, by vertex number:
+        //     m_dfs     // DFS number indicating possible root of subtree, 0=not iterated
+        //     m_colors  // Output subtree number (fully processed)
 
         // Clear info
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            vertex.color(0);
-            vertex.user(0);
-        }
+        m_dfs.assign(m_csr.size(), 0);
+        m_colors.assign(m_csr.size(), 0);
         // Color graph
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            if (!vertex.user()) {
+        for (uint32_t v = 0; v < m_csr.size(); ++v) {
+            if (!m_dfs[v]) {
                 m_currentDfs++;
-                vertexIterate(&vertex);
+                vertexIterate(v);
             }
         }
         // If there's a single vertex of a color, it doesn't need a subgraph
         // This simplifies the consumer's code, and reduces graph debugging clutter
-        for (V3GraphVertex& vertex : m_graphp->vertices()) {
-            bool onecolor = true;
-            for (V3GraphEdge& edge : vertex.outEdges()) {
-                if (followEdge(&edge)) {
-                    if (vertex.color() == edge.top()->color()) {
-                        onecolor = false;
-                        break;
-                    }
-                }
-            }
-            if (onecolor) vertex.color(0);
+        for (uint32_t v = 0; v < m_csr.size(); ++v) {
+            const uint32_t* const endp = m_csr.outEnd(v);
+            const bool onecolor = std::find_if(m_csr.outBegin(v), endp,
+                                               [&](uint32_t top) {
+                                                   return m_colors[v] == m_colors[top];
+                                               })
+                                  == endp;
+            m_csr.vertexp(v)->color(onecolor ? 0 : m_colors[v]);
         }
     }
 
-    void vertexIterate(V3GraphVertex* vertexp) {
+    void vertexIterate(uint32_t v) {
         const uint32_t thisDfsNum = m_currentDfs++;
-        vertexp->user(thisDfsNum);
-        vertexp->color(0);
-        for (V3GraphEdge& edge : vertexp->outEdges()) {
-            if (followEdge(&edge)) {
-                V3GraphVertex* top = edge.top();
-                if (!top->user()) {  // Dest not computed yet
-                    vertexIterate(top);
-                }
-                if (!top->color()) {  // Dest not in a component
-                    if (vertexp->user() > top->user()) vertexp->user(top->user());
-                }
+        m_dfs[v] = thisDfsNum;
+        m_colors[v] = 0;
+        for (const uint32_t* itp = m_csr.outBegin(v); itp != m_csr.outEnd(v); ++itp) {
+            const uint32_t top = *itp;
+            if (!m_dfs[top]) {  // Dest not computed yet
+                vertexIterate(top);
+            }
+            if (!m_colors[top]) {  // Dest not in a component
+                if (m_dfs[v] > m_dfs[top]) m_dfs[v] = m_dfs[top];
             }
         }
-        if (vertexp->user() == thisDfsNum) {  // New head of subtree
-            vertexp->color(thisDfsNum);  // Mark as component
+        if (m_dfs[v] == thisDfsNum) {  // New head of subtree
+            m_colors[v] = thisDfsNum;  // Mark as component
             while (!m_callTrace.empty()) {
-                V3GraphVertex* popVertexp = m_callTrace.back();
-                if (popVertexp->user() >= thisDfsNum) {  // Lower node is part of this subtree
+                const uint32_t pop = m_callTrace.back();
+                if (m_dfs[pop] >= thisDfsNum) {  // Lower node is part of this subtree
                     m_callTrace.pop_back();
-                    popVertexp->color(thisDfsNum);
+                    m_colors[pop] = thisDfsNum;
                 } else {
                     break;
                 }
             }
         } else {  // In another subtree (maybe...)
-            m_callTrace.push_back(vertexp);
+            m_callTrace.push_back(v);
         }
     }
 
 public:
     GraphAlgStrongly(V3Graph* graphp, V3EdgeFuncP edgeFuncp)
-        : GraphAlg<>{graphp, edgeFuncp} {
+        : GraphAlg<>{graphp, edgeFuncp}
+        , m_csr{graphp, edgeFuncp} {
         main();
     }
     ~GraphAlgStrongly() = default;
@@ -19,6 +19,7 @@
 #include "V3Hasher.h"
 
 #include <functional>
+#include <unordered_map>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -552,17 +553,59 @@ public:
     ~HasherVisitor() override = default;
 };
 
+//######################################################################
+// Hashes of root nodes, kept across V3Hasher instances (and so across user4
+// clears) for as long as the tree is not edited
+
+class HasherCache final {
+    std::unordered_map<const AstNode*, V3Hash> m_hashes;  // Hash of each hashed root
+    uint64_t m_editCount = 0;  // AstNode::editCountGbl() when m_hashes was filled
+
+    void validate() {
+        // Any edit may change a hash, or free a node and reuse its address
+        if (m_editCount == AstNode::editCountGbl()) return;
+        m_hashes.clear();
+        m_editCount = AstNode::editCountGbl();
+    }
+
+public:
+    static HasherCache& s() {
+        static HasherCache s_cache;
+        return s_cache;
+    }
+    bool find(const AstNode* nodep, V3Hash& hashr) {
+        validate();
+        const auto it = m_hashes.find(nodep);
+        if (it == m_hashes.end()) return false;
+        hashr = it->second;
+        return true;
+    }
+    void insert(const AstNode* nodep, V3Hash hash) {
+        validate();
+        m_hashes[nodep] = hash;
+    }
+};
+
 //######################################################################
 // V3Hasher methods
 
 V3Hash V3Hasher::operator()(AstNode* nodep) const {
-    if (!nodep->user4()) HasherVisitor{nodep};
+    if (!nodep->user4()) {
+        V3Hash hash;
+        if (HasherCache::s().find(nodep, hash /*ref*/)) {
+            nodep->user4(hash.value());
+        } else {
+            { HasherVisitor{nodep}; }
+            HasherCache::s().insert(nodep, V3Hash{nodep->user4()});
+        }
+    }
     return V3Hash{nodep->user4()};
 }
 
 V3Hash V3Hasher::rehash(AstNode* nodep) const {
     nodep->user4(0);
     { HasherVisitor{nodep}; }
+    HasherCache::s().insert(nodep, V3Hash{nodep->user4()});
     return V3Hash{nodep->user4()};
 }
 
@@ -95,6 +95,8 @@
 #include "V3Stats.h"
 #include "V3String.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -241,13 +243,45 @@ string V3HierBlock::hierMkFilename(bool withDir) const {
 }
 
 string V3HierBlock::hierLibFilename(bool withDir) const {
-    return hierSomeFilename(withDir, "lib", ".a");
+    return hierSomeFilename(withDir, "lib", v3Global.opt.hierShared() ? ".so" : ".a");
 }
 
 string V3HierBlock::hierGeneratedFilenames(bool withDir) const {
     return hierWrapperFilename(withDir) + ' ' + hierMkFilename(withDir);
 }
 
+string V3HierBlock::hierRunTimeFilename(bool withDir) const {
+    return hierSomeFilename(withDir, "V", "__hierTime.dat");
+}
+
+double V3HierBlock::previousRunTime() const {
+    const std::unique_ptr<std::ifstream> ifp{V3File::new_ifstream_nodepend(
+        v3Global.opt.makeDir() + "/" + hierRunTimeFilename(true))};
+    if (ifp->fail()) return 0;
+    V3Os::getline(*ifp);  // Description comment
+    return std::atof(V3Os::getline(*ifp).c_str());
+}
+
+uint64_t V3HierBlock::nodeCount() const {
+    // Count the modules that this block's Verilation inlines, but not other
+    // hierarchical blocks, which are Verilated separately
+    uint64_t count = 0;
+    std::unordered_set<const AstNodeModule*> reached{m_modp};
+    std::vector<const AstNodeModule*> todo{m_modp};
+    while (!todo.empty()) {
+        const AstNodeModule* const modp = todo.back();
+        todo.pop_back();
+        count += modp->nodeCount();
+        modp->foreach([&](const AstCell* cellp) {
+            const AstModule* const submodp = VN_CAST(cellp->modp(), Module);
+            if (submodp && !submodp->hierBlock() && reached.insert(submodp).second) {
+                todo.push_back(submodp);
+            }
+        });
+    }
+    return count;
+}
+
 string V3HierBlock::vFileIfNecessary() const {
     string filename = V3Os::filenameRealPath(m_modp->fileline()->filename());
     for (const auto& v : v3Global.opt.vFiles()) {
@@ -461,6 +495,57 @@ V3HierBlockPlan::HierVector V3HierBlockPlan::hierBlocksSorted() const {
     return sorted;
 }
 
+V3HierBlockPlan::HierVector V3HierBlockPlan::hierBlocksScheduled() const {
+    // Estimate the time for each block from its previous run. Blocks not run
+    // before are estimated from their size, at the rate of those that were.
+    std::unordered_map<const V3HierBlock*, double> cost;
+    std::unordered_map<const V3HierBlock*, uint64_t> nodes;
+    double timedSecs = 0;
+    uint64_t timedNodes = 0;
+    for (const auto& itr : *this) {
+        const V3HierBlock* const blockp = itr.second;
+        nodes[blockp] = blockp->nodeCount();
+        const double secs = blockp->previousRunTime();
+        if (secs > 0) {
+            cost[blockp] = secs;
+            timedSecs += secs;
+            timedNodes += nodes[blockp];
+        }
+    }
+    const double secsPerNode = timedNodes ? timedSecs / timedNodes : 1.0;
+    for (const auto& itr : nodes) {
+        if (!cost.count(itr.first)) cost[itr.first] = itr.second * secsPerNode;
+    }
+
+    // Parents come before their children in reverse leaf-first order
+    HierVector sorted = hierBlocksSorted();
+    std::unordered_map<const V3HierBlock*, double> path;
+    for (const V3HierBlock* const blockp : vlstd::reverse_view(sorted)) {
+        double longest = 0;
+        for (const V3HierBlock* const parentp : blockp->parents()) {
+            longest = std::max(longest, path[parentp]);
+        }
+        path[blockp] = cost[blockp] + longest;
+        UINFO(3, "Critical path " << blockp->modp()->prettyNameQ() << " cost " << cost[blockp]
+                                  << " path " << path[blockp]);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [&](const V3HierBlock* ap, const V3HierBlock* bp) {
+                         return path.at(ap) > path.at(bp);
+                     });
+    return sorted;
+}
+
+void V3HierBlockPlan::writeRunTimeFile(double seconds) {
+    const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream_nodepend(
+        v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + "__hierTime.dat")};
+    if (ofp->fail()) return;
+    *ofp << "# DESCR"
+            "IPTION: Verilator output: Hierarchical block run time for scheduling.  "
+            "Delete at will.\n";
+    *ofp << seconds << "\n";
+}
+
 void V3HierBlockPlan::writeCommandArgsFiles(bool forCMake) const {
     for (const_iterator it = begin(); it != end(); ++it) {
         it->second->writeCommandArgsFile(forCMake);
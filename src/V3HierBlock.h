@@ -110,6 +110,11 @@ public:
     string hierMkFilename(bool withDir) const VL_MT_DISABLED;
     string hierLibFilename(bool withDir) const VL_MT_DISABLED;
     string hierGeneratedFilenames(bool withDir) const VL_MT_DISABLED;
+    string hierRunTimeFilename(bool withDir) const VL_MT_DISABLED;
+    // Seconds taken by the previous Verilation of this block, or 0 if unknown
+    double previousRunTime() const VL_MT_DISABLED;
+    // Estimated size of this block, in nodes of the modules it contains
+    uint64_t nodeCount() const VL_MT_DISABLED;
     // Returns the original HDL file if it is not included in v3Global.opt.vFiles().
     string vFileIfNecessary() const VL_MT_DISABLED;
     // Write command line arguments to .f file for this hierarchical block
@@ -144,11 +149,16 @@ public:
     // Returns all hierarchical blocks that sorted in leaf-first order.
     // Latter block refers only already appeared hierarchical blocks.
     HierVector hierBlocksSorted() const VL_MT_DISABLED;
+    // Returns all hierarchical blocks sorted by decreasing length of the
+    // critical path from starting the block to finishing the blocks using it.
+    HierVector hierBlocksScheduled() const VL_MT_DISABLED;
 
     // Write command line arguments to .f files for child Verilation run
     void writeCommandArgsFiles(bool forCMake) const VL_MT_DISABLED;
     void writeParametersFiles() const VL_MT_DISABLED;
     static string topCommandArgsFilename(bool forCMake) VL_MT_DISABLED;
+    // Record the time taken by this --hierarchical-child run, for scheduling later runs
+    static void writeRunTimeFile(double seconds) VL_MT_DISABLED;
 
     static void createPlan(AstNetlist* nodep) VL_MT_DISABLED;
 };
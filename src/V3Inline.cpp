@@ -29,9 +29,12 @@
 #include "V3Inline.h"
 
 #include "V3AstUserAllocator.h"
+#include "V3File.h"
 #include "V3Inst.h"
+#include "V3InstrCount.h"
 #include "V3Stats.h"
 
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -39,6 +42,10 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 // CONFIG
 static const int INLINE_MODS_SMALLER = 100;  // If a mod is < this # nodes, can always inline it
+// If a mod is < this # nodes, inline it even if replicated more than --inline-max-refs
+static const int INLINE_MODS_TINY = 10;
+// With --inline-cost, instructions saved per evaluation of an inlined instance
+static const uint64_t INLINE_CALL_INSTRS = 20;
 
 //######################################################################
 // Inlining state. Kept as AstNodeModule::user1p via AstUser1Allocator
@@ -48,6 +55,7 @@ namespace {
 struct ModuleState final {
     bool m_inlined = false;  // Whether to inline this module
     unsigned m_cellRefs = 0;  // Number of AstCells instantiating this module
+    uint64_t m_instrs = 0;  // Estimated instructions to evaluate, with --inline-cost
     std::vector<AstCell*> m_childCells;  // AstCells under this module (to speed up traversal)
 };
 
@@ -55,6 +63,157 @@ using ModuleStateUser1Allocator = AstUser1Allocator<AstNodeModule, ModuleState>;
 
 }  // namespace
 
+//######################################################################
+// Replace instances of combinational library cells with their expressions
+
+class InlineCellExprVisitor final : public VNVisitor {
+    // NODE STATE
+    //  AstNodeModule::user2()  // bool. True if checked with isExprCell
+    //  AstNodeModule::user3()  // bool. True if is a combinational library cell
+    //  AstVar::user2p()  // AstNodeExpr*. Port connection in current cell
+    const VNUser2InUse m_inuser2;
+    const VNUser3InUse m_inuser3;
+
+    // STATE
+    AstNodeModule* m_modp = nullptr;  // Current module
+    std::unordered_map<AstNodeModule*, unsigned> m_cellRefs;  // Instances of each module
+    std::unordered_set<std::string> m_dottedNames;  // Names used by hierarchical references
+    VDouble0 m_statCells;  // Statistic tracking
+
+    // METHODS
+    // Library cell whose only statements are its ports, and one continuous
+    // assignment to each output from the inputs, e.g. from a gate primitive
+    static bool isExprCell(AstNodeModule* modp) {
+        if (!VN_IS(modp, Module) || !modp->inLibrary() || modp->isTop() || modp->modPublic()) {
+            return false;
+        }
+        std::unordered_set<const AstVar*> assigned;
+        size_t outputs = 0;
+        for (AstNode* stmtp = modp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            if (const AstVar* const varp = VN_CAST(stmtp, Var)) {
+                if (varp->isSigPublic() || !varp->dtypep()->isIntegralOrPacked()) return false;
+                if (varp->direction() == VDirection::INPUT) continue;
+                if (varp->direction() != VDirection::OUTPUT) return false;
+                ++outputs;
+            } else if (AstAssignW* const assp = VN_CAST(stmtp, AssignW)) {
+                const AstVarRef* const lhsp = VN_CAST(assp->lhsp(), VarRef);
+                if (!lhsp || lhsp->varp()->direction() != VDirection::OUTPUT) return false;
+                if (!assigned.insert(lhsp->varp()).second) return false;
+                if (assp->timingControlp() || !assp->rhsp()->isPure()) return false;
+                const bool onlyInputs = assp->rhsp()->forall([](const AstNode* nodep) {
+                    if (const AstVarRef* const refp = VN_CAST(nodep, VarRef)) {
+                        return refp->varp()->direction() == VDirection::INPUT;
+                    }
+                    return !VN_IS(nodep, NodeVarRef) && !VN_IS(nodep, NodeFTaskRef);
+                });
+                if (!onlyInputs) return false;
+            } else {
+                return false;
+            }
+        }
+        return outputs && assigned.size() == outputs;
+    }
+
+    void replaceCell(AstCell* nodep) {
+        AstNodeModule* const cellModp = nodep->modp();
+        if (m_dottedNames.count(nodep->name())) return;  // Cell might be referenced
+        if (nodep->paramsp() || nodep->rangep()) return;
+        for (AstPin* pinp = nodep->pinsp(); pinp; pinp = VN_AS(pinp->nextp(), Pin)) {
+            V3Inst::pinReconnectSimple(pinp, nodep, false);
+            AstVar* const portp = pinp->modVarp();
+            AstNode* const exprp = pinp->exprp();
+            if (!portp) return;
+            if (portp->direction() == VDirection::OUTPUT ? exprp && !VN_IS(exprp, VarRef)
+                                                          : !exprp) {
+                return;
+            }
+            if (exprp) V3Inst::checkOutputShort(pinp);
+        }
+        UINFO(6, "  Inline cell expressions " << nodep);
+        ++m_statCells;
+        for (AstPin* pinp = nodep->pinsp(); pinp; pinp = VN_AS(pinp->nextp(), Pin)) {
+            pinp->modVarp()->user2p(pinp->exprp());
+        }
+        for (AstNode* stmtp = cellModp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            const AstAssignW* const assp = VN_CAST(stmtp, AssignW);
+            if (!assp) continue;
+            AstNode* const outp = VN_AS(assp->lhsp(), VarRef)->varp()->user2p();
+            if (!outp) continue;  // Unconnected output
+            AstVarRef* const lhsp = VN_AS(outp, VarRef)->cloneTree(false);
+            lhsp->access(VAccess::WRITE);
+            AstNodeExpr* rhsp = assp->rhsp()->cloneTree(false);
+            // Substitute the input connections, collected first as replacing
+            // the root would invalidate the traversal
+            std::vector<AstVarRef*> refps;
+            rhsp->foreach([&](AstVarRef* refp) { refps.push_back(refp); });
+            for (AstVarRef* const refp : refps) {
+                AstNodeExpr* const connp
+                    = VN_AS(refp->varp()->user2p(), NodeExpr)->cloneTree(false);
+                if (AstVarRef* const crefp = VN_CAST(connp, VarRef)) {
+                    crefp->access(VAccess::READ);
+                }
+                if (refp == rhsp) {
+                    rhsp = connp;
+                } else {
+                    refp->replaceWith(connp);
+                }
+                VL_DO_DANGLING(refp->deleteTree(), refp);
+            }
+            m_modp->addStmtsp(new AstAssignW{nodep->fileline(), lhsp, rhsp});
+        }
+        for (AstPin* pinp = nodep->pinsp(); pinp; pinp = VN_AS(pinp->nextp(), Pin)) {
+            pinp->modVarp()->user2p(nullptr);
+        }
+        VL_DO_DANGLING(pushDeletep(nodep->unlinkFrBack()), nodep);
+        // Once the last instance is gone, nothing else may inline the module
+        if (--m_cellRefs[cellModp] == 0) {
+            VL_DO_DANGLING(pushDeletep(cellModp->unlinkFrBack()), cellModp);
+        }
+    }
+
+    // VISITORS
+    void visit(AstNetlist* nodep) override {
+        nodep->foreach([&](AstNode* np) {
+            if (const AstCell* const cellp = VN_CAST(np, Cell)) {
+                ++m_cellRefs[cellp->modp()];
+            } else if (const AstVarXRef* const refp = VN_CAST(np, VarXRef)) {
+                string dotted = refp->dotted();
+                for (string::size_type pos; (pos = dotted.find('.')) != string::npos;) {
+                    m_dottedNames.insert(dotted.substr(0, pos));
+                    dotted.erase(0, pos + 1);
+                }
+                m_dottedNames.insert(dotted);
+            }
+        });
+        iterateChildren(nodep);
+    }
+    void visit(AstNodeModule* nodep) override {
+        UASSERT_OBJ(!m_modp, nodep, "Unsupported: Nested modules");
+        VL_RESTORER(m_modp);
+        m_modp = nodep;
+        std::vector<AstCell*> cellps;
+        for (AstNode* stmtp = nodep->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            AstCell* const cellp = VN_CAST(stmtp, Cell);
+            if (!cellp) continue;
+            AstNodeModule* const cellModp = cellp->modp();
+            if (!cellModp->user2()) {
+                cellModp->user2(true);
+                cellModp->user3(isExprCell(cellModp));
+            }
+            if (cellModp->user3()) cellps.push_back(cellp);
+        }
+        for (AstCell* const cellp : cellps) replaceCell(cellp);
+    }
+    void visit(AstNode*) override {}  // Accelerate
+
+public:
+    // CONSTRUCTORS
+    explicit InlineCellExprVisitor(AstNetlist* nodep) { iterate(nodep); }
+    ~InlineCellExprVisitor() override {
+        V3Stats::addStat("Optimizations, Inlined cell expressions", m_statCells);
+    }
+};
+
 //######################################################################
 // Visitor that determines which modules will be inlined
 
@@ -81,7 +240,9 @@ class InlineMarkVisitor final : public VNVisitor {
     // STATE
     AstNodeModule* m_modp = nullptr;  // Current module
     VDouble0 m_statUnsup;  // Statistic tracking
+    VDouble0 m_statReplicated;  // Statistic tracking
     std::vector<AstNodeModule*> m_allMods;  // All modules, in top-down order.
+    std::ostringstream m_report;  // Decisions for --inline-cost
 
     // Within the context of a given module, LocalInstanceMap maps
     // from child modules to the count of each child's local instantiations.
@@ -106,6 +267,17 @@ class InlineMarkVisitor final : public VNVisitor {
         }
     }
 
+    void writeReport() {
+        const string filename
+            = v3Global.opt.makeDir() + "/" + v3Global.opt.prefix() + "__inline.txt";
+        const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
+        if (ofp->fail()) v3fatal("Can't write file: " << filename);
+        *ofp << "// Verilator inlining decisions, from --inline-cost\n";
+        *ofp << "// Decision, instances, operations and estimated instructions including\n";
+        *ofp << "// inlined children, reason, then module\n";
+        *ofp << m_report.str();
+    }
+
     // VISITORS
     void visit(AstNodeModule* nodep) override {
         UASSERT_OBJ(!m_modp, nodep, "Unsupported: Nested modules");
@@ -193,10 +365,12 @@ class InlineMarkVisitor final : public VNVisitor {
             // If we're going to inline some modules into this one,
             // update user4 (statement count) to reflect that:
             int statements = modp->user4();
+            uint64_t& instrs = m_moduleState(modp).m_instrs;
             for (const auto& pair : m_instances[modp]) {
                 const AstNodeModule* const childp = pair.first;
                 if (m_moduleState(childp).m_inlined) {  // inlining child
                     statements += childp->user4() * pair.second;
+                    instrs += m_moduleState(childp).m_instrs * pair.second;
                 }
             }
             modp->user4(statements);
@@ -209,16 +383,48 @@ class InlineMarkVisitor final : public VNVisitor {
             // inlineMult = 2000 by default.
             // If a mod*#refs is < this # nodes, can inline it
             // Packages aren't really "under" anything so they confuse this algorithm
+            // Modules replicated more than --inline-max-refs are kept, so their
+            // per-instance functions can be shared by V3Combine instead of copied.
+            const bool replicated = v3Global.opt.inlineMaxRefs() > 0  //
+                                    && refs > v3Global.opt.inlineMaxRefs()  //
+                                    && statements >= INLINE_MODS_TINY;
+            // With --inline-cost, each instance after the first adds a copy to
+            // compile, weighted by how little of the module's evaluation the
+            // saved overhead is, and --inline-mult is the exchange rate.
+            bool costOk = refs * statements < v3Global.opt.inlineMult();
+            if (v3Global.opt.inlineCost()) {
+                const uint64_t copies = refs > 1 ? refs - 1 : 0;
+                const uint64_t compileCost = copies * statements * std::max<uint64_t>(instrs, 1);
+                const uint64_t savedCost
+                    = static_cast<uint64_t>(std::max(v3Global.opt.inlineMult(), 0))
+                      * INLINE_CALL_INSTRS * refs;
+                costOk = compileCost <= savedCost;
+            }
             const bool doit = !VN_IS(modp, Package)  //
                               && allowed != CIL_NOTHARD  //
                               && allowed != CIL_NOTSOFT  //
                               && (allowed == CIL_USER  //
                                   || v3Global.opt.flatten()  //
-                                  || refs == 1  //
-                                  || statements < INLINE_MODS_SMALLER  //
-                                  || v3Global.opt.inlineMult() < 1  //
-                                  || refs * statements < v3Global.opt.inlineMult());
+                                  || (!replicated  //
+                                      && (refs == 1  //
+                                          || statements < INLINE_MODS_SMALLER  //
+                                          || v3Global.opt.inlineMult() < 1  //
+                                          || costOk)));
+            if (replicated && !doit) ++m_statReplicated;
             m_moduleState(modp).m_inlined = doit;
+            if (v3Global.opt.inlineCost() && !VN_IS(modp, Package) && !modp->isTop()) {
+                m_report << (doit ? "inline " : "keep   ") << std::setw(7) << refs << ' '
+                         << std::setw(9) << statements << ' ' << std::setw(9) << instrs << ' '
+                         << (allowed == CIL_NOTHARD   ? "unsupported"
+                             : allowed == CIL_NOTSOFT ? "not-allowed"
+                             : allowed == CIL_USER    ? "pragma"
+                             : v3Global.opt.flatten() ? "flatten"
+                             : replicated             ? "max-refs"
+                             : refs == 1              ? "single"
+                             : statements < INLINE_MODS_SMALLER ? "small"
+                                                                : "cost")
+                         << ' ' << modp->prettyName() << '\n';
+            }
             UINFO(4, " Inline=" << doit << " Possible=" << allowed << " Refs=" << refs
                                 << " Stmts=" << statements << "  " << modp);
         }
@@ -234,9 +440,11 @@ public:
     explicit InlineMarkVisitor(AstNode* nodep, ModuleStateUser1Allocator& moduleState)
         : m_moduleState{moduleState} {
         iterate(nodep);
+        if (v3Global.opt.inlineCost()) writeReport();
     }
     ~InlineMarkVisitor() override {
         V3Stats::addStat("Optimizations, Inline unsupported", m_statUnsup);
+        V3Stats::addStat("Optimizations, Inline replicated kept", m_statReplicated);
     }
 };
 
@@ -654,6 +862,20 @@ void V3Inline::inlineAll(AstNetlist* nodep) {
         ModuleStateUser1Allocator moduleState;  // AstUser1Allocator
 
         // Scoped to clean up temp userN's
+        if (v3Global.opt.fInlineCells()) InlineCellExprVisitor{nodep};
+
+        // Estimate the instructions to evaluate each module, before the mark
+        // visitor claims the user fields V3InstrCount uses
+        if (v3Global.opt.inlineCost()) {
+            for (AstNodeModule* modp = nodep->modulesp(); modp;
+                 modp = VN_AS(modp->nextp(), NodeModule)) {
+                uint64_t& instrs = moduleState(modp).m_instrs;
+                for (AstNode* stmtp = modp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+                    instrs += V3InstrCount::count(stmtp, false);
+                }
+            }
+        }
+
         { InlineMarkVisitor{nodep, moduleState}; }
 
         { InlineVisitor{nodep, moduleState}; }
@@ -143,9 +143,10 @@ public:
     void checkRemoveAssign(const LifeMap::iterator& it) {
         const AstVar* const varp = it->first->varp();
         LifeVarEntry* const entp = &(it->second);
-        if (!varp->isSigPublic() && !varp->sensIfacep()) {
+        if ((!varp->isSigPublic() || varp->isSigUserRdSampled()) && !varp->sensIfacep()) {
             // Rather than track what sigs AstUCFunc/AstUCStmt may change,
-            // we just don't optimize any public sigs
+            // we just don't optimize any public sigs, other than those only read
+            // between evaluations, which can't see values overwritten within one
             // Check the var entry, and remove if appropriate
             if (AstNodeStmt* const oldassp = entp->assignp()) {
                 UINFO(7, "       PREV: " << oldassp);
@@ -202,7 +203,8 @@ public:
         const auto pair = m_map.emplace(nodep, LifeVarEntry::CONSUMED{});
         if (!pair.second) {
             if (AstConst* const constp = pair.first->second.constNodep()) {
-                if (!varrefp->varp()->isSigPublic() && !varrefp->varp()->sensIfacep()) {
+                if ((!varrefp->varp()->isSigPublic() || varrefp->varp()->isSigUserRdSampled())
+                    && !varrefp->varp()->sensIfacep()) {
                     // Aha, variable is constant; substitute in.
                     // We'll later constant propagate
                     UINFO(4, "     replaceconst: " << varrefp);
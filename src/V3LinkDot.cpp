@@ -2609,8 +2609,8 @@ class LinkDotResolveVisitor final : public VNVisitor {
     void importDerivedClass(AstClass* derivedClassp, VSymEnt* baseSymp, AstClass* baseClassp) {
         // Also used for standard 'extends' from a base class
         UINFO(8, indent() << "importDerivedClass to " << derivedClassp << " from " << baseClassp);
-        for (VSymEnt::const_iterator it = baseSymp->begin(); it != baseSymp->end(); ++it) {
-            if (AstNode* baseSubp = it->second->nodep()) {
+        for (const auto* const itp : baseSymp->sortedEntries()) {
+            if (AstNode* baseSubp = itp->second->nodep()) {
                 UINFO(8, indent() << "  SymFunc " << baseSubp);
                 const string impOrExtends
                     = baseClassp->isInterfaceClass() ? " implements " : " extends ";
@@ -4523,14 +4523,14 @@ class LinkDotResolveVisitor final : public VNVisitor {
         // so add members pointing to appropriate enum values
         {
             VMemberMap memberMap;
-            for (VSymEnt::const_iterator it = m_curSymp->begin(); it != m_curSymp->end(); ++it) {
-                AstNode* const itemp = it->second->nodep();
-                if (!memberMap.findMember(nodep, it->first)) {
+            for (const auto* const itp : m_curSymp->sortedEntries()) {
+                AstNode* const itemp = itp->second->nodep();
+                if (!memberMap.findMember(nodep, itp->first)) {
                     if (AstEnumItem* const aitemp = VN_CAST(itemp, EnumItem)) {
                         AstEnumItemRef* const newp = new AstEnumItemRef{
-                            aitemp->fileline(), aitemp, it->second->classOrPackagep()};
+                            aitemp->fileline(), aitemp, itp->second->classOrPackagep()};
                         UINFO(8, indent()
-                                     << "Class import noderef '" << it->first << "' " << newp);
+                                     << "Class import noderef '" << itp->first << "' " << newp);
                         nodep->addMembersp(newp);
                         memberMap.insert(nodep, newp);
                     }
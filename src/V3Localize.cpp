@@ -19,6 +19,10 @@
 //             if only referenced in one CFUNC, make it local
 //          VARSCOPE
 //             if non-public, always written before used, make it local
+//          VARSCOPE
+//             if as above, but too large to make local, share the member
+//             with other such variables of the same type used in other
+//             functions, as none of them need to keep their value between calls
 //
 //*************************************************************************
 
@@ -29,6 +33,7 @@
 #include "V3AstUserAllocator.h"
 #include "V3Stats.h"
 
+#include <algorithm>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -56,6 +61,7 @@ class LocalizeVisitor final : public VNVisitor {
     // STATE - across all visitors
     std::vector<AstVarScope*> m_varScopeps;  // List of variables to consider for localization
     VDouble0 m_statLocVars;  // Statistic tracking
+    VDouble0 m_statSharedVars;  // Statistic tracking
 
     // STATE - for current visit position (use VL_RESTORER)
     AstCFunc* m_cfuncp = nullptr;  // Current active function
@@ -80,9 +86,66 @@ class LocalizeVisitor final : public VNVisitor {
         return false;
     }
 
+    bool isShareable(AstVarScope* nodep) {
+        // Like isOptimizable, but too large to localize. All referencing functions must
+        // be leaf functions, so one can't clobber the storage while another is using it.
+        const std::unordered_set<AstCFunc*>& funcps = m_accessors(nodep);
+        return !nodep->user1() && !funcps.empty() && !existsNonLeaf(funcps)
+               && !VN_IS(nodep->dtypep(), NBACommitQueueDType)
+               && nodep->varp()->dtypep()->widthTotalBytes() > v3Global.opt.localizeMaxSize();
+    }
+
+    void shareVarScopes(const std::vector<AstVarScope*>& vscps) {
+        // Sets of variables that share storage, the first of each owns it
+        struct Share final {
+            AstVarScope* m_ownerp;  // Variable providing the storage
+            std::unordered_set<AstCFunc*> m_funcps;  // Functions using the storage
+        };
+        std::vector<Share> shares;
+        for (AstVarScope* const nodep : vscps) {
+            const std::unordered_set<AstCFunc*>& funcps = m_accessors(nodep);
+            // Find storage of same type in same scope, not used by any of our functions
+            Share* sharep = nullptr;
+            for (Share& share : shares) {
+                if (share.m_ownerp->scopep() != nodep->scopep()) continue;
+                if (!share.m_ownerp->dtypep()->similarDType(nodep->dtypep())) continue;
+                const bool disjoint
+                    = std::none_of(funcps.begin(), funcps.end(), [&](AstCFunc* funcp) {
+                          return share.m_funcps.count(funcp);
+                      });
+                if (!disjoint) continue;
+                sharep = &share;
+                break;
+            }
+            if (!sharep) {
+                shares.push_back(Share{nodep, funcps});
+                continue;
+            }
+            UINFO(4, "Sharing " << nodep << " with " << sharep->m_ownerp);
+            ++m_statSharedVars;
+            sharep->m_funcps.insert(funcps.begin(), funcps.end());
+            // Yank the VarScope, and point all references at the owner
+            pushDeletep(nodep->unlinkFrBack());
+            for (AstCFunc* const funcp : funcps) {
+                const auto er = m_references(funcp).equal_range(nodep);
+                for (auto it = er.first; it != er.second; ++it) {
+                    AstVarRef* const refp = it->second;
+                    refp->varScopep(sharep->m_ownerp);
+                    refp->varp(sharep->m_ownerp->varp());
+                }
+            }
+        }
+    }
+
     void moveVarScopes() {
+        // Variables too large to localize, but which may share storage
+        std::vector<AstVarScope*> shareps;
         for (AstVarScope* const nodep : m_varScopeps) {
-            if (!isOptimizable(nodep)) continue;  // Not optimizable
+            if (!isOptimizable(nodep)) {
+                // With threads, functions of different variables might run concurrently
+                if (!v3Global.opt.mtasks() && isShareable(nodep)) shareps.push_back(nodep);
+                continue;  // Not optimizable
+            }
 
             const std::unordered_set<AstCFunc*>& funcps = m_accessors(nodep);
             if (funcps.empty()) continue;  // No referencing functions at all
@@ -124,6 +187,7 @@ class LocalizeVisitor final : public VNVisitor {
             }
         }
         m_varScopeps.clear();
+        shareVarScopes(shareps);
     }
 
     // VISITORS
@@ -220,6 +284,7 @@ public:
     explicit LocalizeVisitor(AstNetlist* nodep) { iterate(nodep); }
     ~LocalizeVisitor() override {
         V3Stats::addStat("Optimizations, Vars localized", m_statLocVars);
+        V3Stats::addStat("Optimizations, Vars sharing storage", m_statSharedVars);
     }
 };
 
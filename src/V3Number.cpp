@@ -1337,6 +1337,21 @@ V3Number& V3Number::opCLog2(const V3Number& lhs) {
     setZero();
     return *this;
 }
+V3Number& V3Number::opLeastSetBitP1(const V3Number& lhs) {
+    NUM_ASSERT_OP_ARGS1(lhs);
+    NUM_ASSERT_LOGIC_ARGS1(lhs);
+    if (lhs.isFourState()) return setAllBitsX();
+    for (int bit = 0; bit < lhs.width(); bit++) {
+        if (lhs.bitIs1(bit)) return setLong(bit + 1);
+    }
+    return setZero();
+}
+V3Number& V3Number::opMostSetBitP1(const V3Number& lhs) {
+    NUM_ASSERT_OP_ARGS1(lhs);
+    NUM_ASSERT_LOGIC_ARGS1(lhs);
+    if (lhs.isFourState()) return setAllBitsX();
+    return setLong(lhs.mostSetBitP1());
+}
 
 V3Number& V3Number::opLogNot(const V3Number& lhs) {
     NUM_ASSERT_OP_ARGS1(lhs);
@@ -1818,18 +1833,40 @@ V3Number& V3Number::opLte(const V3Number& lhs, const V3Number& rhs) { return opG
 V3Number& V3Number::opLtS(const V3Number& lhs, const V3Number& rhs) { return opGtS(rhs, lhs); }
 V3Number& V3Number::opLteS(const V3Number& lhs, const V3Number& rhs) { return opGteS(rhs, lhs); }
 
+V3Number::ValueAndX V3Number::bitsAt32(int64_t lsb) const {
+    if (lsb >= width() || lsb <= -32) return {0, 0};
+    const int64_t word = lsb < 0 ? -1 : lsb / 32;
+    const int shift = static_cast<int>(lsb - word * 32);
+    const auto wordAt = [this](int64_t w) -> ValueAndX {
+        if (w < 0 || w >= words()) return {0, 0};
+        ValueAndX v = m_data.num()[w];
+        if (w == words() - 1) {
+            v.m_value &= hiWordMask();
+            v.m_valueX &= hiWordMask();
+        }
+        return v;
+    };
+    const ValueAndX lo = wordAt(word);
+    if (shift == 0) return lo;
+    const ValueAndX hi = wordAt(word + 1);
+    return {(lo.m_value >> shift) | (hi.m_value << (32 - shift)),
+            (lo.m_valueX >> shift) | (hi.m_valueX << (32 - shift))};
+}
+
 V3Number& V3Number::opShiftR(const V3Number& lhs, const V3Number& rhs) {
     // L(lhs) bit return
     NUM_ASSERT_OP_ARGS2(lhs, rhs);
     NUM_ASSERT_LOGIC_ARGS2(lhs, rhs);
     if (rhs.isFourState()) return setAllBitsX();
     setZero();
-    for (int bit = 32; bit < rhs.width(); ++bit) {
-        if (rhs.bitIs1(bit)) return *this;  // shift of over 2^32 must be zero
-    }
+    // Shift of over 2^32 must be zero
+    if (rhs.width() > 32 && !rhs.isBitsZero(rhs.width() - 1, 32)) return *this;
     const uint32_t rhsval = rhs.toUInt();
     if (rhsval < static_cast<uint32_t>(lhs.width())) {
-        for (int bit = 0; bit < width(); ++bit) setBit(bit, lhs.bitIs(bit + rhsval));
+        for (int word = 0; word < words(); ++word) {
+            m_data.num()[word] = lhs.bitsAt32(static_cast<int64_t>(word) * 32 + rhsval);
+        }
+        opCleanThis();
     }
     return *this;
 }
@@ -1863,12 +1900,14 @@ V3Number& V3Number::opShiftL(const V3Number& lhs, const V3Number& rhs) {
     NUM_ASSERT_LOGIC_ARGS2(lhs, rhs);
     if (rhs.isFourState()) return setAllBitsX();
     setZero();
-    for (int bit = 32; bit < rhs.width(); ++bit) {
-        if (rhs.bitIs1(bit)) return *this;  // shift of over 2^32 must be zero
-    }
+    // Shift of over 2^32 must be zero
+    if (rhs.width() > 32 && !rhs.isBitsZero(rhs.width() - 1, 32)) return *this;
     const uint32_t rhsval = rhs.toUInt();
-    for (uint32_t bit = 0; bit < static_cast<uint32_t>(width()); ++bit) {
-        if (bit >= rhsval) setBit(bit, lhs.bitIs(bit - rhsval));
+    if (rhsval < static_cast<uint32_t>(width())) {
+        for (int word = rhsval / 32; word < words(); ++word) {
+            m_data.num()[word] = lhs.bitsAt32(static_cast<int64_t>(word) * 32 - rhsval);
+        }
+        opCleanThis();
     }
     return *this;
 }
@@ -464,6 +464,8 @@ private:
     }
 
     V3Number& opModDivGuts(const V3Number& lhs, const V3Number& rhs, bool is_modulus);
+    // Return 32 bits starting at lsb, bits outside [0, width) read as zero
+    ValueAndX bitsAt32(int64_t lsb) const VL_MT_SAFE;
 
 public:
     // CONSTRUCTORS
@@ -699,6 +701,8 @@ public:
     V3Number& opOneHot(const V3Number& lhs);
     V3Number& opOneHot0(const V3Number& lhs);
     V3Number& opCLog2(const V3Number& lhs);
+    V3Number& opLeastSetBitP1(const V3Number& lhs);
+    V3Number& opMostSetBitP1(const V3Number& lhs);
     V3Number& opClean(const V3Number& lhs, uint32_t bits);
     V3Number& opConcat(const V3Number& lhs, const V3Number& rhs);
     V3Number& opLenN(const V3Number& lhs);
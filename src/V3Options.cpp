@@ -689,6 +689,10 @@ string V3Options::getenvMAKEFLAGS() {  //
     return V3Os::getenvStr("MAKEFLAGS", "");
 }
 
+string V3Options::getenvNINJA() {  //
+    return V3Os::getenvStr("NINJA", "ninja");
+}
+
 string V3Options::getenvPERL() {  //
     return V3Os::filenameCleanup(V3Os::getenvStr("PERL", "perl"));
 }
@@ -886,7 +890,11 @@ void V3Options::notify() VL_MT_DISABLED {
     }
 
     // Make sure at least one make system is enabled
-    if (!m_gmake && !m_cmake && !m_makeJson) m_gmake = true;
+    if (!m_gmake && !m_cmake && !m_makeJson && !m_makeNinja) m_gmake = true;
+
+    if (m_makeNinja && (m_hierarchical || !m_hierBlocks.empty())) {
+        cmdfl->v3error("--make ninja cannot be used together with --hierarchical");
+    }
 
     if (m_hierarchical && (m_hierChild || !m_hierBlocks.empty())) {
         cmdfl->v3error(
@@ -934,11 +942,6 @@ void V3Options::notify() VL_MT_DISABLED {
             && !v3Global.opt.serializeOnly());
     }
 
-    if (trace()) {
-        // With --trace-vcd, --trace-threads is ignored
-        if (traceFormat().vcd()) m_traceThreads = 1;
-    }
-
     UASSERT(!(useTraceParallel() && useTraceOffload()),
             "Cannot use both parallel and offloaded tracing");
 
@@ -951,6 +954,11 @@ void V3Options::notify() VL_MT_DISABLED {
                       "--main not usable with SystemC. Suggest see examples for sc_main().");
     }
 
+    if (inputLog() && systemC()) {
+        cmdfl->v3warn(E_UNSUPPORTED, "Unsupported: --input-log with SystemC");
+        m_inputLog = false;
+    }
+
     if (coverage() && savable()) {
         cmdfl->v3error("Unsupported: --coverage and --savable not supported together");
     }
@@ -963,6 +971,9 @@ void V3Options::notify() VL_MT_DISABLED {
         m_dumpLevel["tree"] = m_dumpLevel["tree-dot"];
     }
 
+    // --perf-stats also needs the counters compiled into the runtime library
+    if (perfStats()) addCFlags("-DVL_PERF_STATS=1");
+
     // Sanity check of expected configuration
     UASSERT(threads() >= 1, "'threads()' must return a value >= 1");
     if (m_outputGroups == -1) m_outputGroups = (m_buildJobs != -1) ? m_buildJobs : 0;
@@ -1180,6 +1191,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
                 [this](const char* optp) { addLangExt(optp, V3LangCode::L1800_2023); });
 
     // Minus options
+    DECL_OPTION("-alloc-zeroed", OnOff, &m_allocZeroed);
     DECL_OPTION("-assert", CbOnOff, [this](bool flag) {
         m_assert = flag;
         m_assertCase = flag;
@@ -1243,12 +1255,22 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         }
     });
     DECL_OPTION("-compiler-include", CbVal, callStrSetter(&V3Options::addCompilerIncludes));
+    DECL_OPTION("-compiler-pgo", CbVal, [this, fl](const char* valp) {
+        if (!std::strcmp(valp, "generate") || !std::strcmp(valp, "use")) {
+            m_compilerPgo = valp;
+        } else {
+            fl->v3error("Unknown setting for --compiler-pgo: '"
+                        << valp << "'\n"
+                        << fl->warnMore() << "... Suggest 'generate' or 'use'");
+        }
+    });
     DECL_OPTION("-converge-limit", Set, &m_convergeLimit);
     DECL_OPTION("-coverage", CbOnOff, [this](bool flag) { coverage(flag); });
     DECL_OPTION("-coverage-expr", OnOff, &m_coverageExpr);
     DECL_OPTION("-coverage-expr-max", Set, &m_coverageExprMax);
     DECL_OPTION("-coverage-line", OnOff, &m_coverageLine);
     DECL_OPTION("-coverage-max-width", Set, &m_coverageMaxWidth);
+    DECL_OPTION("-coverage-per-thread", OnOff, &m_coveragePerThread);
     DECL_OPTION("-coverage-toggle", OnOff, &m_coverageToggle);
     DECL_OPTION("-coverage-underscore", OnOff, &m_coverageUnderscore);
     DECL_OPTION("-coverage-user", OnOff, &m_coverageUser);
@@ -1264,6 +1286,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
                 V3Error::vlAbort)
         .undocumented();  // See also --debug-sigsegv
     DECL_OPTION("-debug-check", OnOff, &m_debugCheck);
+    DECL_OPTION("-debug-check-incremental", CbOnOff, [this](bool flag) {
+        m_debugCheckIncremental = flag;
+        if (flag) m_debugCheck = true;
+    });
     DECL_OPTION("-debug-collision", OnOff, &m_debugCollision).undocumented();
     DECL_OPTION("-debug-emitv", OnOff, &m_debugEmitV).undocumented();
     DECL_OPTION("-debug-exit-parse", OnOff, &m_debugExitParse).undocumented();
@@ -1322,7 +1348,9 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
 
     DECL_OPTION("-facyc-simp", FOnOff, &m_fAcycSimp);
     DECL_OPTION("-fassemble", FOnOff, &m_fAssemble);
+    DECL_OPTION("-fassoc-unordered", FOnOff, &m_fAssocUnordered);
     DECL_OPTION("-fcase", FOnOff, &m_fCase);
+    DECL_OPTION("-fclass-frame", FOnOff, &m_fClassFrame);
     DECL_OPTION("-fcombine", FOnOff, &m_fCombine);
     DECL_OPTION("-fconst", FOnOff, &m_fConst);
     DECL_OPTION("-fconst-before-dfg", FOnOff, &m_fConstBeforeDfg);
@@ -1337,6 +1365,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_fDfgScoped = flag;
     });
     DECL_OPTION("-fdfg-break-cycles", FOnOff, &m_fDfgBreakCycles);
+    DECL_OPTION("-fdfg-parity-matrix", FOnOff, &m_fDfgParityMatrix);
     DECL_OPTION("-fdfg-peephole", FOnOff, &m_fDfgPeephole);
     DECL_OPTION("-fdfg-peephole-", CbPartialMatch, [this](const char* optp) {  //
         m_fDfgPeepholeDisabled.erase(optp);
@@ -1347,6 +1376,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-fdfg-pre-inline", FOnOff, &m_fDfgPreInline);
     DECL_OPTION("-fdfg-post-inline", FOnOff, &m_fDfgPostInline);
     DECL_OPTION("-fdfg-scoped", FOnOff, &m_fDfgScoped);
+    DECL_OPTION("-fdyn-trigger-deps", FOnOff, &m_fDynTriggerDeps);
     DECL_OPTION("-fexpand", FOnOff, &m_fExpand);
     DECL_OPTION("-ffunc-opt", CbFOnOff, [this](bool flag) {  //
         m_fFuncSplitCat = flag;
@@ -1354,8 +1384,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     });
     DECL_OPTION("-ffunc-opt-balance-cat", FOnOff, &m_fFuncBalanceCat);
     DECL_OPTION("-ffunc-opt-split-cat", FOnOff, &m_fFuncSplitCat);
+    DECL_OPTION("-ffunc-spec", FOnOff, &m_fFuncSpec);
     DECL_OPTION("-fgate", FOnOff, &m_fGate);
     DECL_OPTION("-finline", FOnOff, &m_fInline);
+    DECL_OPTION("-finline-cells", FOnOff, &m_fInlineCells);
     DECL_OPTION("-finline-funcs", FOnOff, &m_fInlineFuncs);
     DECL_OPTION("-flife", FOnOff, &m_fLife);
     DECL_OPTION("-flife-post", FOnOff, &m_fLifePost);
@@ -1363,6 +1395,8 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-fmerge-cond", FOnOff, &m_fMergeCond);
     DECL_OPTION("-fmerge-cond-motion", FOnOff, &m_fMergeCondMotion);
     DECL_OPTION("-fmerge-const-pool", FOnOff, &m_fMergeConstPool);
+    DECL_OPTION("-forder-gates", FOnOff, &m_fOrderGates);
+    DECL_OPTION("-foutline-cold", FOnOff, &m_fOutlineCold);
     DECL_OPTION("-freloop", FOnOff, &m_fReloop);
     DECL_OPTION("-freorder", FOnOff, &m_fReorder);
     DECL_OPTION("-fslice", FOnOff, &m_fSlice);
@@ -1399,12 +1433,19 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-hierarchical-params-file", CbVal, [this](const char* optp) {
         m_hierParamsFile.push_back({optp, work()});
     });
+    DECL_OPTION("-hierarchical-shared", OnOff, &m_hierShared);
 
     DECL_OPTION("-I", CbPartialMatch,
                 [this, &optdir](const char* optp) { addIncDirUser(parseFileArg(optdir, optp)); });
     DECL_OPTION("-if-depth", Set, &m_ifDepth);
     DECL_OPTION("-ignc", OnOff, &m_ignc);
+    DECL_OPTION("-inline-cost", OnOff, &m_inlineCost);
+    DECL_OPTION("-inline-max-refs", CbVal, [this, fl](int val) {
+        m_inlineMaxRefs = val;
+        if (m_inlineMaxRefs < 0) fl->v3error("--inline-max-refs must be >= 0: " << val);
+    });
     DECL_OPTION("-inline-mult", Set, &m_inlineMult);
+    DECL_OPTION("-input-log", OnOff, &m_inputLog);
     DECL_OPTION("-instr-count-dpi", CbVal, [this, fl](int val) {
         m_instrCountDpi = val;
         if (m_instrCountDpi < 0) fl->v3fatal("--instr-count-dpi must be non-negative: " << val);
@@ -1445,6 +1486,19 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_libCreate = valp;
     });
     DECL_OPTION("-lint-only", OnOff, &m_lintOnly);
+    DECL_OPTION("-lint-tier", CbVal, [this, fl](const char* valp) {
+        if (!std::strcmp(valp, "parse")) {
+            m_lintTier = "parse";
+        } else if (!std::strcmp(valp, "elab")) {
+            m_lintTier = "elab";
+        } else if (!std::strcmp(valp, "full")) {
+            m_lintTier = "full";
+        } else {
+            fl->v3error("Unknown setting for --lint-tier: '"
+                        << valp << "'\n"
+                        << fl->warnMore() << "... Suggest 'parse', 'elab', or 'full'");
+        }
+    });
     DECL_OPTION("-localize-max-size", Set, &m_localizeMaxSize);
 
     DECL_OPTION("-MAKEFLAGS", CbVal, callStrSetter(&V3Options::addMakeFlags));
@@ -1455,6 +1509,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         addIncDirFallback(m_makeDir);  // Need to find generated files there too
     });
     DECL_OPTION("-main", OnOff, &m_main);
+    DECL_OPTION("-main-fuzz", CbCall, [this]() {
+        m_main = true;
+        m_mainFuzz = true;
+    });
     DECL_OPTION("-main-top-name", Set, &m_mainTopName);
     DECL_OPTION("-make", CbVal, [this, fl](const char* valp) {
         if (!std::strcmp(valp, "cmake")) {
@@ -1463,10 +1521,13 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
             m_gmake = true;
         } else if (!std::strcmp(valp, "json")) {
             m_makeJson = true;
+        } else if (!std::strcmp(valp, "ninja")) {
+            m_makeNinja = true;
         } else {
             fl->v3error("Unknown --make system specified: '" << valp << "'");
         }
     });
+    DECL_OPTION("-max-memory", Set, &m_maxMemory);
     DECL_OPTION("-max-num-width", Set, &m_maxNumWidth);
     DECL_OPTION("-mod-prefix", CbVal, [this, fl](const char* valp) {
         validateIdentifier(fl, valp, "--mod-prefix");
@@ -1499,8 +1560,10 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
             fl->v3error("--output-split-ctrace must be >= 0: " << valp);
         }
     });
+    DECL_OPTION("-output-split-stable", OnOff, &m_outputSplitStable);
 
     DECL_OPTION("-P", Set, &m_preprocNoLine);
+    DECL_OPTION("-perf-stats", OnOff, &m_perfStats);
     DECL_OPTION("-pins64", CbCall, [this]() { m_pinsBv = 65; });
     DECL_OPTION("-no-pins64", CbCall, [this]() { m_pinsBv = 33; });
     DECL_OPTION("-pins-bv", CbVal, [this, fl](const char* valp) {
@@ -1524,12 +1587,14 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         validateIdentifier(fl, valp, "--prefix");
         m_prefix = valp;
     });
+    DECL_OPTION("-preproc-cache", Set, &m_preprocCache);
     DECL_OPTION("-preproc-resolve", OnOff, &m_preprocResolve);
     DECL_OPTION("-preproc-token-limit", CbVal, [this, fl](const char* valp) {
         m_preprocTokenLimit = std::atoi(valp);
         if (m_preprocTokenLimit <= 0) fl->v3error("--preproc-token-limit must be > 0: " << valp);
     });
     DECL_OPTION("-private", CbCall, [this]() { m_public = false; });
+    DECL_OPTION("-prof-blocks", OnOff, &m_profBlocks);
     DECL_OPTION("-prof-c", OnOff, &m_profC);
     DECL_OPTION("-prof-cfuncs", CbCall, [this]() { m_profC = m_profCFuncs = true; });
     DECL_OPTION("-prof-exec", OnOff, &m_profExec);
@@ -1587,6 +1652,11 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_systemC = true;
     });
     DECL_OPTION("-skip-identical", OnOff, &m_skipIdentical);
+    DECL_OPTION("-skip-identical-content", OnOff, &m_skipIdenticalContent);
+    DECL_OPTION("-sparse-array-depth", CbVal, [this, fl](const char* valp) {
+        m_sparseArrayDepth = std::atoi(valp);
+        if (m_sparseArrayDepth < 0) fl->v3error("--sparse-array-depth must be >= 0: " << valp);
+    });
     DECL_OPTION("-stats", OnOff, &m_stats);
     DECL_OPTION("-stats-vars", CbOnOff, [this](bool flag) {
         m_statsVars = flag;
@@ -1602,6 +1672,11 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-structs-packed", OnOff, &m_structsPacked);
     DECL_OPTION("-sv", CbCall, [this]() { m_defaultLanguage = V3LangCode::L1800_2023; });
 
+    DECL_OPTION("-table-max-bytes", CbVal, [this, fl](const char* valp) {
+        m_tableMaxBytes = std::atoi(valp);
+        if (m_tableMaxBytes < 0) fl->v3error("--table-max-bytes must be >= 0: " << valp);
+    });
+
     DECL_OPTION("-no-threads", CbCall, [this, fl]() {
         fl->v3warn(DEPRECATED, "Option --no-threads is deprecated, use '--threads 1' instead");
         m_threads = 1;
@@ -1639,6 +1714,25 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_threadsMaxMTasks = std::atoi(valp);
         if (m_threadsMaxMTasks < 1) fl->v3fatal("--threads-max-mtasks must be >= 1: " << valp);
     });
+    DECL_OPTION("-threads-multilevel", CbVal, [this, fl](const char* valp) {
+        m_threadsMultilevel = std::atoi(valp);
+        if (m_threadsMultilevel < 0) fl->v3fatal("--threads-multilevel must be >= 0: " << valp);
+    });
+    DECL_OPTION("-threads-numa-nodes", CbVal, [this, fl](const char* valp) {
+        m_threadsNumaNodes = std::atoi(valp);
+        if (m_threadsNumaNodes < 1) fl->v3fatal("--threads-numa-nodes must be >= 1: " << valp);
+    });
+    DECL_OPTION("-threads-rebalance", OnOff, &m_threadsRebalance);
+    DECL_OPTION("-threads-refine", CbVal, [this, fl](const char* valp) {
+        m_threadsRefine = std::atoi(valp);
+        if (m_threadsRefine < 0) fl->v3fatal("--threads-refine must be >= 0: " << valp);
+    });
+    DECL_OPTION("-threads-region-min-cost", CbVal, [this, fl](const char* valp) {
+        m_threadsRegionMinCost = std::atoi(valp);
+        if (m_threadsRegionMinCost < 0) {
+            fl->v3fatal("--threads-region-min-cost must be >= 0: " << valp);
+        }
+    });
     DECL_OPTION("-timescale", CbVal, [this, fl](const char* valp) {
         VTimescale unit;
         VTimescale prec;
@@ -1684,6 +1778,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     });
     DECL_OPTION("-trace-max-array", Set, &m_traceMaxArray);
     DECL_OPTION("-trace-max-width", Set, &m_traceMaxWidth);
+    DECL_OPTION("-trace-packed-activity", OnOff, &m_tracePackedActivity);
     DECL_OPTION("-trace-params", OnOff, &m_traceParams);
     DECL_OPTION("-trace-structs", OnOff, &m_traceStructs);
     DECL_OPTION("-trace-threads", CbVal, [this, fl](const char* valp) {
@@ -1697,6 +1792,11 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_trace = true;
         m_traceFormat = TraceFormat::VCD;
     });
+    DECL_OPTION("-trace-vtc", CbCall, [this]() {
+        m_trace = true;
+        m_traceFormat = TraceFormat::VTC;
+        addLdLibs("-lz");
+    });
 
     DECL_OPTION("-U", CbPartialMatch, &V3PreShell::undef);
     DECL_OPTION("-underline-zero", OnOff, &m_underlineZero);  // Deprecated
@@ -2119,6 +2219,7 @@ V3Options::V3Options() {
     m_traceFormat = TraceFormat::VCD;
 
     m_makeDir = "obj_dir";
+    m_lintTier = "full";
     m_unusedRegexp = "*unused*";
     m_xAssign = "fast";
     m_xInitial = "unique";
@@ -2183,7 +2284,9 @@ void V3Options::optimize(int level) {
     const bool flag = level > 0;
     m_fAcycSimp = flag;
     m_fAssemble = flag;
+    m_fAssocUnordered = flag;
     m_fCase = flag;
+    m_fClassFrame = flag;
     m_fCombine = flag;
     m_fConst = flag;
     m_fConstBitOpTree = flag;
@@ -2194,12 +2297,15 @@ void V3Options::optimize(int level) {
     m_fDeadAssigns = flag;
     m_fDeadCells = flag;
     m_fExpand = flag;
+    m_fFuncSpec = flag;
     m_fGate = flag;
     m_fInline = flag;
     m_fLife = flag;
     m_fLifePost = flag;
     m_fLocalize = flag;
     m_fMergeCond = flag;
+    m_fOrderGates = flag;
+    m_fOutlineCold = flag;
     m_fReloop = flag;
     m_fReorder = flag;
     m_fSplit = flag;
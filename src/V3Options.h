@@ -161,7 +161,7 @@ inline std::ostream& operator<<(std::ostream& os, const VTimescale& rhs) {
 
 class TraceFormat final {
 public:
-    enum en : uint8_t { VCD = 0, FST, SAIF } m_e;
+    enum en : uint8_t { VCD = 0, FST, SAIF, VTC } m_e;
     // cppcheck-suppress noExplicitConstructor
     constexpr TraceFormat(en _e = VCD)
         : m_e{_e} {}
@@ -171,12 +171,15 @@ public:
     bool fst() const { return m_e == FST; }
     bool saif() const { return m_e == SAIF; }
     bool vcd() const { return m_e == VCD; }
+    bool vtc() const { return m_e == VTC; }
     string classBase() const VL_MT_SAFE {
-        static const char* const names[] = {"VerilatedVcd", "VerilatedFst", "VerilatedSaif"};
+        static const char* const names[]
+            = {"VerilatedVcd", "VerilatedFst", "VerilatedSaif", "VerilatedVtc"};
         return names[m_e];
     }
     string sourceName() const VL_MT_SAFE {
-        static const char* const names[] = {"verilated_vcd", "verilated_fst", "verilated_saif"};
+        static const char* const names[]
+            = {"verilated_vcd", "verilated_fst", "verilated_saif", "verilated_vtc"};
         return names[m_e];
     }
 };
@@ -251,6 +254,7 @@ private:
     bool m_preprocResolve = false;  // main switch: --preproc-resolve
     bool m_makePhony = false;       // main switch: -MP
     bool m_preprocNoLine = false;   // main switch: -P
+    bool m_allocZeroed = false;     // main switch: --alloc-zeroed
     bool m_assert = true;           // main switch: --assert
     bool m_assertCase = true;       // main switch: --assert-case
     bool m_autoflush = false;       // main switch: --autoflush
@@ -262,10 +266,12 @@ private:
     bool m_context = true;          // main switch: --Wcontext
     bool m_coverageExpr = false;    // main switch: --coverage-expr
     bool m_coverageLine = false;    // main switch: --coverage-block
+    bool m_coveragePerThread = false;  // main switch: --coverage-per-thread
     bool m_coverageToggle = false;  // main switch: --coverage-toggle
     bool m_coverageUnderscore = false;  // main switch: --coverage-underscore
     bool m_coverageUser = false;    // main switch: --coverage-func
     bool m_debugCheck = false;      // main switch: --debug-check
+    bool m_debugCheckIncremental = false;  // main switch: --debug-check-incremental
     bool m_debugCollision = false;  // main switch: --debug-collision
     bool m_debugEmitV = false;      // main switch: --debug-emitv
     bool m_debugExitParse = false;  // main switch: --debug-exit-parse
@@ -286,14 +292,21 @@ private:
     bool m_exe = false;             // main switch: --exe
     bool m_flatten = false;         // main switch: --flatten
     bool m_hierarchical = false;    // main switch: --hierarchical
+    bool m_hierShared = false;      // main switch: --hierarchical-shared
     bool m_ignc = false;            // main switch: --ignc
+    bool m_inlineCost = false;      // main switch: --inline-cost
+    bool m_inputLog = false;        // main switch: --input-log
     bool m_jsonOnly = false;        // main switch: --json-only
     bool m_lintOnly = false;        // main switch: --lint-only
     bool m_gmake = false;           // main switch: --make gmake
     bool m_makeJson = false;        // main switch: --make json
+    bool m_makeNinja = false;       // main switch: --make ninja
     bool m_main = false;            // main switch: --main
+    bool m_mainFuzz = false;        // main switch: --main-fuzz
     bool m_outFormatOk = false;     // main switch: --cc, --sc or --sp was specified
+    bool m_outputSplitStable = false;  // main switch: --output-split-stable
     bool m_pedantic = false;        // main switch: --Wpedantic
+    bool m_perfStats = false;       // main switch: --perf-stats
     bool m_pinsInoutEnables = false;// main switch: --pins-inout-enables
     bool m_pinsScUint = false;      // main switch: --pins-sc-uint
     bool m_pinsScUintBool = false;  // main switch: --pins-sc-uint-bool
@@ -302,6 +315,7 @@ private:
     bool m_ppComments = false;      // main switch: --pp-comments
     bool m_profC = false;           // main switch: --prof-c
     bool m_profCFuncs = false;      // main switch: --prof-cfuncs
+    bool m_profBlocks = false;      // main switch: --prof-blocks
     bool m_profExec = false;        // main switch: --prof-exec
     bool m_profPgo = false;         // main switch: --prof-pgo
     bool m_protectIds = false;      // main switch: --protect-ids
@@ -314,6 +328,7 @@ private:
     bool m_relativeIncludes = false;  // main switch: --relative-includes
     bool m_reportUnoptflat = false;  // main switch: --report-unoptflat
     bool m_savable = false;         // main switch: --savable
+    bool m_skipIdenticalContent = false;  // main switch: --skip-identical-content
     bool m_stdPackage = true;       // main switch: --std-package
     bool m_stdWaiver = true;        // main switch: --std-waiver
     bool m_structsPacked = false;   // main switch: --structs-packed
@@ -323,9 +338,11 @@ private:
     bool m_threadsCoarsen = true;   // main switch: --threads-coarsen
     bool m_threadsDpiPure = true;   // main switch: --threads-dpi all/pure
     bool m_threadsDpiUnpure = false;  // main switch: --threads-dpi all
+    bool m_threadsRebalance = false;  // main switch: --threads-rebalance
     VOptionBool m_timing;           // main switch: --timing
     bool m_trace = false;           // main switch: --trace
     bool m_traceCoverage = false;   // main switch: --trace-coverage
+    bool m_tracePackedActivity = false;  // main switch: --trace-packed-activity
     bool m_traceParams = true;      // main switch: --trace-params
     bool m_traceStructs = false;    // main switch: --trace-structs
     bool m_noTraceTop = false;      // main switch: --no-trace-top
@@ -346,12 +363,14 @@ private:
     int         m_hierChild = 0;      // main switch: --hierarchical-child
     int         m_hierThreads = 0;      // main switch: --hierarchical-threads
     int         m_ifDepth = 0;      // main switch: --if-depth
+    int         m_inlineMaxRefs = 0;   // main switch: --inline-max-refs
     int         m_inlineMult = 2000;   // main switch: --inline-mult
     int         m_instrCountDpi = 200;   // main switch: --instr-count-dpi
     bool        m_jsonEditNums = true; // main switch: --no-json-edit-nums
     bool        m_jsonIds = true; // main switch: --no-json-ids
     int         m_localizeMaxSize = 1024;  // main switch: --localize-max-size
     VOptionBool m_makeDepend;  // main switch: -MMD
+    int         m_maxMemory = 0;  // main switch: --max-memory
     int         m_maxNumWidth = 65536;  // main switch: --max-num-width
     int         m_moduleRecursion = 100;  // main switch: --module-recursion-depth
     int         m_outputGroups = -1;  // main switch: --output-groups
@@ -363,9 +382,15 @@ private:
     int         m_publicDepth = 0;   // main switch: --public-depth
     int         m_reloopLimit = 40; // main switch: --reloop-limit
     VOptionBool m_skipIdentical;  // main switch: --skip-identical
+    int         m_sparseArrayDepth = 0;  // main switch: --sparse-array-depth
     bool        m_stopFail = true;  // main switch: --stop-fail
+    int         m_tableMaxBytes = 1024 * 1024;  // main switch: --table-max-bytes
     int         m_threads = 1;      // main switch: --threads
     int         m_threadsMaxMTasks = 0;  // main switch: --threads-max-mtasks
+    int         m_threadsMultilevel = 100000;  // main switch: --threads-multilevel
+    int         m_threadsNumaNodes = 1;  // main switch: --threads-numa-nodes
+    int         m_threadsRefine = 0;  // main switch: --threads-refine
+    int         m_threadsRegionMinCost = 10000;  // main switch: --threads-region-min-cost
     VTimescale  m_timeDefaultPrec;  // main switch: --timescale
     VTimescale  m_timeDefaultUnit;  // main switch: --timescale
     VTimescale  m_timeOverridePrec;  // main switch: --timescale-override
@@ -384,6 +409,7 @@ private:
     int         m_compLimitParens = 240;  // compiler selection; number of nested parens
 
     string      m_buildDepBin;  // main switch: --build-dep-bin {filename}
+    string      m_compilerPgo;  // main switch: --compiler-pgo {generate/use}
     string      m_diagnosticsSarifOutput;  // main switch: --diagnostics-sarif-output
     string      m_exeName;      // main switch: -o {name}
     string      m_flags;        // main switch: -f {name}
@@ -392,11 +418,13 @@ private:
     string      m_jsonOnlyMetaOutput;    // main switch: --json-only-meta-output
     string      m_l2Name;       // main switch: --l2name; "" for top-module's name
     string      m_libCreate;    // main switch: --lib-create {lib_name}
+    string      m_lintTier;     // main switch: --lint-tier
     string      m_mainTopName;  // main switch: --main-top-name
     string      m_makeDir;      // main switch: -Mdir
     string      m_modPrefix;    // main switch: --mod-prefix
     string      m_pipeFilter;   // main switch: --pipe-filter
     string      m_prefix;       // main switch: --prefix
+    string      m_preprocCache;  // main switch: --preproc-cache
     string      m_protectKey;   // main switch: --protect-key
     string      m_topModule;    // main switch: --top-module
     string      m_unusedRegexp; // main switch: --unused-regexp
@@ -413,7 +441,9 @@ private:
     // MEMBERS (optimizations)
     bool m_fAcycSimp;    // main switch: -fno-acyc-simp: acyclic pre-optimizations
     bool m_fAssemble;    // main switch: -fno-assemble: assign assemble
+    bool m_fAssocUnordered;  // main switch: -fno-assoc-unordered: hashed associative arrays
     bool m_fCase;        // main switch: -fno-case: case tree conversion
+    bool m_fClassFrame;  // main switch: -fno-class-frame: class objects in function frames
     bool m_fCombine;     // main switch: -fno-combine: common icode packing
     bool m_fConst;       // main switch: -fno-const: constant folding
     bool m_fConstBeforeDfg = true;  // main switch: -fno-const-before-dfg for testing only!
@@ -421,17 +451,21 @@ private:
     bool m_fConstEager = true;  // main switch: -fno-const-eagerly run V3Const during passes
     bool m_fDedupe;      // main switch: -fno-dedupe: logic deduplication
     bool m_fDfgBreakCycles = true; // main switch: -fno-dfg-break-cycles
+    bool m_fDfgParityMatrix = true;  // main switch: -fno-dfg-parity-matrix
     bool m_fDfgPeephole = true; // main switch: -fno-dfg-peephole
     bool m_fDfgPreInline;    // main switch: -fno-dfg-pre-inline and -fno-dfg
     bool m_fDfgPostInline;   // main switch: -fno-dfg-post-inline and -fno-dfg
     bool m_fDfgScoped;       // main switch: -fno-dfg-scoped and -fno-dfg
     bool m_fDeadAssigns;     // main switch: -fno-dead-assigns: remove dead assigns
     bool m_fDeadCells;   // main switch: -fno-dead-cells: remove dead cells
+    bool m_fDynTriggerDeps = true;  // main switch: -fno-dyn-trigger-deps
     bool m_fExpand;      // main switch: -fno-expand: expansion of C macros
     bool m_fFuncBalanceCat = true;  // main switch: -fno-func-balance-cat: expansion of C macros
     bool m_fFuncSplitCat = true;  // main switch: -fno-func-split-cat: expansion of C macros
+    bool m_fFuncSpec;    // main switch: -fno-func-spec: specialize functions on constants
     bool m_fGate;        // main switch: -fno-gate: gate wire elimination
     bool m_fInline;      // main switch: -fno-inline: module inlining
+    bool m_fInlineCells = true;  // main switch: -fno-inline-cells: library cell expressions
     bool m_fInlineFuncs = true;  // main switch: -fno-inline-funcs: function inlining
     bool m_fLife;        // main switch: -fno-life: variable lifetime
     bool m_fLifePost;    // main switch: -fno-life-post: delayed assignment elimination
@@ -439,6 +473,8 @@ private:
     bool m_fMergeCond;   // main switch: -fno-merge-cond: merge conditionals
     bool m_fMergeCondMotion = true; // main switch: -fno-merge-cond-motion: perform code motion
     bool m_fMergeConstPool = true;  // main switch: -fno-merge-const-pool
+    bool m_fOrderGates = true;  // main switch: -fno-order-gates: group logic by enable
+    bool m_fOutlineCold; // main switch: -fno-outline-cold: move unlikely branches to functions
     bool m_fReloop;      // main switch: -fno-reloop: reform loops
     bool m_fReorder;     // main switch: -fno-reorder: reorder assignments in blocks
     bool m_fSlice = true;  // main switch: -fno-slice: array assignment slicing
@@ -515,11 +551,13 @@ public:
     string flags() const { return m_flags; }
     bool systemC() const VL_MT_SAFE { return m_systemC; }
     bool savable() const VL_MT_SAFE { return m_savable; }
+    bool skipIdenticalContent() const { return m_skipIdenticalContent; }
     bool stats() const { return m_stats; }
     bool statsVars() const { return m_statsVars; }
     bool stdPackage() const { return m_stdPackage; }
     bool stdWaiver() const { return m_stdWaiver; }
     bool structsPacked() const { return m_structsPacked; }
+    bool allocZeroed() const { return m_allocZeroed; }
     bool assertOn() const { return m_assert; }  // assertOn as __FILE__ may be defined
     bool assertCase() const { return m_assertCase; }
     bool autoflush() const { return m_autoflush; }
@@ -528,6 +566,7 @@ public:
     bool binary() const { return m_binary; }
     bool build() const { return m_build; }
     string buildDepBin() const { return m_buildDepBin; }
+    string compilerPgo() const { return m_compilerPgo; }
     void buildDepBin(const string& flag) { m_buildDepBin = flag; }
     bool cmake() const { return m_cmake; }
     bool context() const VL_MT_SAFE { return m_context; }
@@ -536,10 +575,15 @@ public:
     }
     bool coverageExpr() const { return m_coverageExpr; }
     bool coverageLine() const { return m_coverageLine; }
+    // Per-thread counter copies, only used when there are multiple threads
+    bool coveragePerThread() const { return m_coveragePerThread && m_threads > 1; }
+    // Counters need atomic increments
+    bool coverageAtomic() const { return !m_coveragePerThread && m_threads > 1; }
     bool coverageToggle() const { return m_coverageToggle; }
     bool coverageUnderscore() const { return m_coverageUnderscore; }
     bool coverageUser() const { return m_coverageUser; }
     bool debugCheck() const VL_MT_SAFE { return m_debugCheck; }
+    bool debugCheckIncremental() const { return m_debugCheckIncremental; }
     bool debugCollision() const { return m_debugCollision; }
     bool debugEmitV() const VL_MT_SAFE { return m_debugEmitV; }
     bool debugExitParse() const { return m_debugExitParse; }
@@ -565,20 +609,25 @@ public:
     bool flatten() const { return m_flatten; }
     bool gmake() const { return m_gmake; }
     bool makeJson() const { return m_makeJson; }
+    bool makeNinja() const { return m_makeNinja; }
     bool threadsDpiPure() const { return m_threadsDpiPure; }
     bool threadsDpiUnpure() const { return m_threadsDpiUnpure; }
     bool threadsCoarsen() const { return m_threadsCoarsen; }
+    bool threadsRebalance() const { return m_threadsRebalance; }
     VOptionBool timing() const { return m_timing; }
     bool trace() const { return m_trace; }
     bool traceCoverage() const { return m_traceCoverage; }
+    bool tracePackedActivity() const { return m_tracePackedActivity; }
     bool traceParams() const { return m_traceParams; }
     bool traceStructs() const { return m_traceStructs; }
     bool traceUnderscore() const { return m_traceUnderscore; }
     bool main() const { return m_main; }
+    bool mainFuzz() const { return m_mainFuzz; }
     bool outFormatOk() const { return m_outFormatOk; }
     bool jsonOnly() const { return m_jsonOnly; }
     bool keepTempFiles() const { return (V3Error::debugDefault() != 0); }
     bool pedantic() const { return m_pedantic; }
+    bool perfStats() const { return m_perfStats; }
     bool pinsInoutEnables() const { return m_pinsInoutEnables; }
     bool pinsScUint() const { return m_pinsScUint; }
     bool pinsScUintBool() const { return m_pinsScUintBool; }
@@ -587,9 +636,10 @@ public:
     bool ppComments() const { return m_ppComments; }
     bool profC() const { return m_profC; }
     bool profCFuncs() const { return m_profCFuncs; }
+    bool profBlocks() const { return m_profBlocks; }
     bool profExec() const { return m_profExec; }
     bool profPgo() const { return m_profPgo; }
-    bool usesProfiler() const { return profExec() || profPgo(); }
+    bool usesProfiler() const { return profExec() || profPgo() || profBlocks(); }
     bool protectIds() const VL_MT_SAFE { return m_protectIds; }
     bool allPublic() const { return m_public; }
     bool publicParams() const { return m_publicParams; }
@@ -599,6 +649,8 @@ public:
     bool anyPublicFlat() const { return m_publicParams || m_publicFlatRW || m_publicDepth; }
     bool lintOnly() const VL_MT_SAFE { return m_lintOnly; }
     bool ignc() const { return m_ignc; }
+    bool inlineCost() const { return m_inlineCost; }
+    bool inputLog() const { return m_inputLog; }
     bool quietExit() const VL_MT_SAFE { return m_quietExit; }
     bool quietStats() const VL_MT_SAFE { return m_quietStats; }
     bool reportUnoptflat() const { return m_reportUnoptflat; }
@@ -618,24 +670,33 @@ public:
     int expandLimit() const { return m_expandLimit; }
     int gateStmts() const { return m_gateStmts; }
     int ifDepth() const { return m_ifDepth; }
+    int inlineMaxRefs() const { return m_inlineMaxRefs; }
     int inlineMult() const { return m_inlineMult; }
     int instrCountDpi() const { return m_instrCountDpi; }
     int localizeMaxSize() const { return m_localizeMaxSize; }
     bool jsonEditNums() const { return m_jsonEditNums; }
     bool jsonIds() const { return m_jsonIds; }
     VOptionBool makeDepend() const { return m_makeDepend; }
+    int maxMemory() const { return m_maxMemory; }
     int maxNumWidth() const { return m_maxNumWidth; }
     int moduleRecursionDepth() const { return m_moduleRecursion; }
     int outputSplit() const { return m_outputSplit; }
+    bool outputSplitStable() const { return m_outputSplitStable; }
     int outputSplitCFuncs() const { return m_outputSplitCFuncs; }
     int outputSplitCTrace() const { return m_outputSplitCTrace; }
     int outputGroups() const { return m_outputGroups; }
     int pinsBv() const VL_MT_SAFE { return m_pinsBv; }
     int reloopLimit() const { return m_reloopLimit; }
     VOptionBool skipIdentical() const { return m_skipIdentical; }
+    int sparseArrayDepth() const VL_MT_SAFE { return m_sparseArrayDepth; }
     bool stopFail() const { return m_stopFail; }
+    int tableMaxBytes() const { return m_tableMaxBytes; }
     int threads() const VL_MT_SAFE { return m_threads; }
     int threadsMaxMTasks() const { return m_threadsMaxMTasks; }
+    int threadsMultilevel() const { return m_threadsMultilevel; }
+    int threadsNumaNodes() const { return m_threadsNumaNodes; }
+    int threadsRefine() const { return m_threadsRefine; }
+    int threadsRegionMinCost() const { return m_threadsRegionMinCost; }
     bool mtasks() const VL_MT_SAFE { return (m_threads > 1); }
     VTimescale timeDefaultPrec() const { return m_timeDefaultPrec; }
     VTimescale timeDefaultUnit() const { return m_timeDefaultUnit; }
@@ -648,16 +709,20 @@ public:
     bool traceEnabledFst() const { return trace() && traceFormat().fst(); }
     bool traceEnabledSaif() const { return trace() && traceFormat().saif(); }
     bool traceEnabledVcd() const { return trace() && traceFormat().vcd(); }
+    bool traceEnabledVtc() const { return trace() && traceFormat().vtc(); }
     int traceMaxArray() const { return m_traceMaxArray; }
     int traceMaxWidth() const { return m_traceMaxWidth; }
     int traceThreads() const { return m_traceThreads; }
     bool useTraceOffload() const { return trace() && traceFormat().fst() && traceThreads() > 1; }
     bool useTraceParallel() const {
-        return trace() && traceFormat().vcd() && (threads() > 1 || hierChild() > 1);
+        return trace() && traceFormat().vcd()
+               && (threads() > 1 || hierChild() > 1 || traceThreads() > 1);
     }
     bool useFstWriterThread() const { return traceThreads() && traceFormat().fst(); }
     unsigned vmTraceThreads() const {
-        return useTraceParallel() ? threads() : useTraceOffload() ? 1 : 0;
+        return useTraceParallel() ? std::max(threads(), traceThreads())
+               : useTraceOffload() ? 1
+                                   : 0;
     }
     int unrollCount() const { return m_unrollCount; }
     int unrollCountAdjusted(const VOptionBool& full, bool generate, bool simulate);
@@ -678,6 +743,7 @@ public:
     string jsonOnlyMetaOutput() const { return m_jsonOnlyMetaOutput; }
     string l2Name() const { return m_l2Name; }
     string libCreate() const { return m_libCreate; }
+    string lintTier() const { return m_lintTier; }
     string libCreateName(bool shared) {
         string libName = "lib" + libCreate();
         if (shared) {
@@ -692,6 +758,7 @@ public:
     string modPrefix() const VL_MT_SAFE { return m_modPrefix; }
     string pipeFilter() const { return m_pipeFilter; }
     string prefix() const VL_MT_SAFE { return m_prefix; }
+    string preprocCache() const { return m_preprocCache; }
     // Not just called protectKey() to avoid bugs of not using protectKeyDefaulted()
     bool protectKeyProvided() const { return !m_protectKey.empty(); }
     string protectKeyDefaulted() VL_MT_SAFE;  // Set default key if not set by user
@@ -729,7 +796,9 @@ public:
     // ACCESSORS (optimization options)
     bool fAcycSimp() const { return m_fAcycSimp; }
     bool fAssemble() const { return m_fAssemble; }
+    bool fAssocUnordered() const { return m_fAssocUnordered; }
     bool fCase() const { return m_fCase; }
+    bool fClassFrame() const { return m_fClassFrame; }
     bool fCombine() const { return m_fCombine; }
     bool fConst() const { return m_fConst; }
     bool fConstBeforeDfg() const { return m_fConstBeforeDfg; }
@@ -737,10 +806,12 @@ public:
     bool fConstEager() const { return m_fConstEager; }
     bool fDedupe() const { return m_fDedupe; }
     bool fDfgBreakCycles() const { return m_fDfgBreakCycles; }
+    bool fDfgParityMatrix() const { return m_fDfgParityMatrix; }
     bool fDfgPeephole() const { return m_fDfgPeephole; }
     bool fDfgPreInline() const { return m_fDfgPreInline; }
     bool fDfgPostInline() const { return m_fDfgPostInline; }
     bool fDfgScoped() const { return m_fDfgScoped; }
+    bool fDynTriggerDeps() const { return m_fDynTriggerDeps; }
     bool fDfgPeepholeEnabled(const std::string& name) const {
         return !m_fDfgPeepholeDisabled.count(name);
     }
@@ -750,8 +821,10 @@ public:
     bool fFuncBalanceCat() const { return m_fFuncBalanceCat; }
     bool fFuncSplitCat() const { return m_fFuncSplitCat; }
     bool fFunc() const { return fFuncSplitCat() || fFuncBalanceCat(); }
+    bool fFuncSpec() const { return m_fFuncSpec; }
     bool fGate() const { return m_fGate; }
     bool fInline() const { return m_fInline; }
+    bool fInlineCells() const { return m_fInlineCells; }
     bool fInlineFuncs() const { return m_fInlineFuncs; }
     bool fLife() const { return m_fLife; }
     bool fLifePost() const { return m_fLifePost; }
@@ -759,6 +832,8 @@ public:
     bool fMergeCond() const { return m_fMergeCond; }
     bool fMergeCondMotion() const { return m_fMergeCondMotion; }
     bool fMergeConstPool() const { return m_fMergeConstPool; }
+    bool fOrderGates() const { return m_fOrderGates; }
+    bool fOutlineCold() const { return m_fOutlineCold; }
     bool fReloop() const { return m_fReloop; }
     bool fReorder() const { return m_fReorder; }
     bool fSlice() const { return m_fSlice; }
@@ -777,6 +852,7 @@ public:
     }
 
     bool hierarchical() const { return m_hierarchical; }
+    bool hierShared() const VL_MT_SAFE { return m_hierShared; }
     int hierChild() const VL_MT_SAFE { return m_hierChild; }
     int hierThreads() const VL_MT_SAFE { return m_hierThreads == 0 ? m_threads : m_hierThreads; }
     bool hierTop() const VL_MT_SAFE { return !m_hierChild && !m_hierBlocks.empty(); }
@@ -805,6 +881,7 @@ public:
     static string getenvBuiltins(const string& var);
     static string getenvMAKE();
     static string getenvMAKEFLAGS();
+    static string getenvNINJA();
     static string getenvPERL();
     static string getenvPYTHON3();
     static string getenvSYSTEMC();
@@ -25,6 +25,7 @@
 #include "verilatedos.h"
 
 #include "V3Ast.h"
+#include "V3File.h"
 #include "V3Graph.h"
 #include "V3OrderGraph.h"
 
@@ -99,6 +100,7 @@ public:
         // Some properties to consider
         const bool suspendable = procp && procp->isSuspendable();
         const bool needProcess = procp && procp->needProcess();
+        const bool ownFunction = procp && procp->isOwnFunction();
         // TODO: This is a bit muddy: 'initial forever @(posedge clk) begin ... end' is a fancy
         //       way of saying always @(posedge clk), so it might be quite hot...
         //       Also, if m_funcp is slow, but this one isn't we should force a new function
@@ -106,6 +108,8 @@ public:
 
         // Put suspendable processes into individual functions on their own
         if (suspendable) forceNewFunction();
+        // Large replicated logic goes into functions on its own, so V3Combine can merge replicas
+        if (ownFunction) forceNewFunction();
         // When profCFuncs, create a new function for each logic vertex
         if (v3Global.opt.profCFuncs()) forceNewFunction();
         // If the new domain is different, force a new function as it needs to be called separately
@@ -113,7 +117,7 @@ public:
 
         // Process procedures per statement, so we can split CFuncs within procedures.
         // Everything else is handled as a unit.
-        AstNode* const headp = [&]() -> AstNode* {
+        AstNode* headp = [&]() -> AstNode* {
             if (!procp) return logicp;  // Not a procedure, handle as a unit
             AstNode* const stmtsp = procp->stmtsp();
             UASSERT_OBJ(stmtsp, procp, "Empty process should have been deleted earlier");
@@ -122,6 +126,26 @@ public:
             VL_DO_DANGLING(procp->deleteTree(), procp);
             return stmtsp;
         }();
+        // Attribute time to the source block for --prof-blocks. Not for suspendable processes,
+        // as the time they are suspended would be counted too.
+        if (v3Global.opt.profBlocks() && !suspendable) {
+            FileLine* const flp = logicp->fileline();
+            const std::string name = flp->filename() + ":" + std::to_string(flp->lineno());
+            const std::string id = std::to_string(v3Global.profBlockId(name));
+            AstNode* stmtsp = new AstCStmt{
+                flp, "vlSymsp->__Vm_blockProfiler.startCounter(" + id + ");\n"};
+            AstNode* endp = nullptr;
+            if (v3Global.opt.profExec()) {
+                const std::string quoted = V3OutFormatter::quoteNameControls("block " + name);
+                stmtsp->addNext(new AstCStmt{
+                    flp, "VL_EXEC_TRACE_ADD_RECORD(vlSymsp).sectionPush(\"" + quoted + "\");\n"});
+                endp = new AstCStmt{flp, "VL_EXEC_TRACE_ADD_RECORD(vlSymsp).sectionPop();\n"};
+            }
+            endp = AstNode::addNext(
+                endp, new AstCStmt{flp, "vlSymsp->__Vm_blockProfiler.stopCounter(" + id + ");\n"});
+            headp = AstNode::addNext(stmtsp, headp);
+            headp->addNext(endp);
+        }
         // Process each statement in the list starting at headp
         for (AstNode *currp = headp, *nextp; currp; currp = nextp) {
             nextp = currp->nextp();
@@ -157,7 +181,7 @@ public:
             if (m_split) m_size += currp->nodeCount();
         }
         // Put suspendable processes into individual functions on their own
-        if (suspendable) forceNewFunction();
+        if (suspendable || ownFunction) forceNewFunction();
     }
 };
 
@@ -23,6 +23,7 @@
 #include "V3OrderMoveGraph.h"
 
 #include "V3Graph.h"
+#include "V3Stats.h"
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -227,3 +228,21 @@ std::unique_ptr<OrderMoveGraph> OrderMoveGraph::build(OrderGraph& orderGraph,
                                                       const V3Order::TrigToSenMap& trigToSen) {
     return OrderMoveGraphBuilder::apply(orderGraph, trigToSen);
 }
+
+//======================================================================
+// OrderMoveGraphSerializer implementation
+
+const AstNodeExpr* OrderMoveGraphSerializer::gateCondp(const OrderMoveVertex* vtxp) {
+    const OrderLogicVertex* const lVtxp = vtxp->logicp();
+    if (!lVtxp) return nullptr;
+    const AstNodeProcedure* const procp = VN_CAST(lVtxp->nodep(), NodeProcedure);
+    if (!procp) return nullptr;
+    const AstIf* const ifp = VN_CAST(procp->stmtsp(), If);
+    if (!ifp || ifp->nextp() || ifp->elsesp()) return nullptr;
+    return ifp->condp();
+}
+
+void OrderMoveGraphSerializer::addStats() const {
+    V3Stats::addStatSum("Optimizations, Order gated logic", m_statGatedLogic);
+    V3Stats::addStatSum("Optimizations, Order gated groups", m_statGatedGroups);
+}
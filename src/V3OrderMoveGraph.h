@@ -169,9 +169,46 @@ class OrderMoveGraphSerializer final {
     // STATE
     OrderMoveDomScope::List m_readyDomScopeps;  // List of DomScopes which have ready vertices
     OrderMoveDomScope* m_nextDomScopep = nullptr;  // Next DomScope to yield from
+    const bool m_groupGates;  // Prefer logic under the same enable condition as the previous
+    const AstNodeExpr* m_prevGatep = nullptr;  // Enable condition of previously yielded vertex
+    size_t m_statGatedLogic = 0;  // Number of logic vertices under an enable condition
+    size_t m_statGatedGroups = 0;  // Number of runs of logic under the same enable condition
+
+    // Maximum number of ready vertices to search for one under the same enable condition
+    static constexpr size_t GATE_LOOKAHEAD = 64;
 
     // METHODS
 
+    // The enable condition the whole logic under this vertex is gated by, or nullptr.
+    // This is the condition of an 'always' whose only statement is an 'if' without 'else'.
+    static const AstNodeExpr* gateCondp(const OrderMoveVertex* vtxp);
+
+    // Unlink and return the next vertex from the given ready list. Prefer the first vertex
+    // under the same enable condition as the previously yielded one, so V3MergeCond can later
+    // put both behind a single branch, and idle logic costs only that branch.
+    OrderMoveVertex* unlinkNext(OrderMoveVertex::List& readyList) {
+        OrderMoveVertex* selectedp = readyList.frontp();
+        if (m_groupGates && m_prevGatep) {
+            size_t n = 0;
+            for (OrderMoveVertex& vtx : readyList) {
+                if (++n > GATE_LOOKAHEAD) break;
+                const AstNodeExpr* const gatep = gateCondp(&vtx);
+                if (gatep && gatep->sameTree(m_prevGatep)) {
+                    selectedp = &vtx;
+                    break;
+                }
+            }
+        }
+        readyList.unlink(selectedp);
+        const AstNodeExpr* const gatep = gateCondp(selectedp);
+        if (gatep) {
+            ++m_statGatedLogic;
+            if (!m_prevGatep || !gatep->sameTree(m_prevGatep)) ++m_statGatedGroups;
+        }
+        m_prevGatep = gatep;
+        return selectedp;
+    }
+
     void ready(OrderMoveVertex* vtxp) {
         UASSERT_OBJ(!vtxp->user(), vtxp, "'ready' called on vertex with pending dependencies");
         if (vtxp->logicp()) {
@@ -200,7 +237,8 @@ class OrderMoveGraphSerializer final {
 
 public:
     // CONSTRUCTOR
-    explicit OrderMoveGraphSerializer(OrderMoveGraph& moveGraph) {
+    explicit OrderMoveGraphSerializer(OrderMoveGraph& moveGraph)
+        : m_groupGates{v3Global.opt.fOrderGates()} {
         // Set V3GraphVertex::user() to the number of incoming edges (upstream dependencies)
         for (V3GraphVertex& vtx : moveGraph.vertices()) {
             const uint32_t nDeps = vtx.inEdges().size();
@@ -223,7 +261,7 @@ public:
         UASSERT(!currReadyList.empty(), "DomScope on ready list, but has no ready vertices");
 
         // Remove vertex from ready list under the DomScope. This is the vertex we are returning.
-        OrderMoveVertex* mVtxp = currReadyList.unlinkFront();
+        OrderMoveVertex* mVtxp = unlinkNext(currReadyList);
 
         // Nonsesne, but what we used to do
         if (currReadyList.empty()) {
@@ -257,6 +295,9 @@ public:
         // Finally yield the selected vertex
         return mVtxp;
     }
+
+    // Add statistics about grouping of logic under enable conditions
+    void addStats() const;
 };
 
 #endif  // Guard
@@ -550,13 +550,8 @@ public:
         return pathExistsFromInternal(fromp, top, excludedEdgep, incGeneration());
     }
 
-    static void dumpCpFilePrefixed(const V3Graph& graph, const string& nameComment) {
-        const string filename = v3Global.debugFilename(nameComment) + ".txt";
-        UINFO(1, "Writing " << filename);
-        const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
-        std::ostream* const osp = &(*ofp);  // &* needed to deref unique_ptr
-        if (osp->fail()) v3fatalStatic("Can't write file: " << filename);
-
+    // Return the mtasks on the longest critical path, in order
+    static std::vector<const LogicMTask*> criticalPath(const V3Graph& graph) {
         // Find start vertex with longest CP
         const LogicMTask* startp = nullptr;
         for (const V3GraphVertex& vtx : graph.vertices()) {
@@ -573,17 +568,27 @@ public:
 
         // Follow the entire critical path
         std::vector<const LogicMTask*> path;
-        uint64_t totalCost = 0;
         for (const LogicMTask* nextp = startp; nextp;) {
             path.push_back(nextp);
-            totalCost += nextp->cost();
-
             if (EdgeHeap::Node* const maxp = nextp->m_edgeHeap[GraphWay::FORWARD].max()) {
                 nextp = MTaskEdge::toMTaskEdge(GraphWay::FORWARD, maxp)->toMTaskp();
             } else {
                 nextp = nullptr;
             }
         }
+        return path;
+    }
+
+    static void dumpCpFilePrefixed(const V3Graph& graph, const string& nameComment) {
+        const string filename = v3Global.debugFilename(nameComment) + ".txt";
+        UINFO(1, "Writing " << filename);
+        const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
+        std::ostream* const osp = &(*ofp);  // &* needed to deref unique_ptr
+        if (osp->fail()) v3fatalStatic("Can't write file: " << filename);
+
+        const std::vector<const LogicMTask*> path = criticalPath(graph);
+        uint64_t totalCost = 0;
+        for (const LogicMTask* mtaskp : path) totalCost += mtaskp->cost();
 
         *osp << "totalCost = " << totalCost
              << " (should match the computed critical path cost (CP) for the graph)\n";
@@ -1713,7 +1718,7 @@ class DpiImportCallVisitor final : public VNVisitor {
     void visit(AstCFunc* nodep) override {
         if (!m_tracingCall) return;
         m_tracingCall = false;
-        if (nodep->dpiImportWrapper()) {
+        if (nodep->dpiImportWrapper() && !nodep->dpiThreadSafe()) {
             if (nodep->dpiPure() ? !v3Global.opt.threadsDpiPure()
                                  : !v3Global.opt.threadsDpiUnpure()) {
                 // If hierarchical DPI wrapper cost is not found or is of a 0 cost,
@@ -2053,6 +2058,110 @@ public:
     }
 };
 
+//######################################################################
+// MultilevelCoarsen
+
+// Contraction keeps every edge and sibling pair of the graph in its scoreboard,
+// which dominates runtime and memory on very large graphs. In the spirit of
+// multilevel (METIS-like) partitioners, first shrink such graphs with a few
+// linear-time levels of matching, then let Contraction partition and refine the
+// coarse graph as usual.
+//
+// Each level visits every mtask once and merges it into at most one neighbour
+// that has not yet been merged into during this level. An mtask is only merged
+// into its sole predecessor, or into its sole successor. Neither merge can
+// create a cycle, and neither grows the critical path by more than the cost of
+// the merged mtask, which is bounded by the cost limit.
+class MultilevelCoarsen final {
+    // MEMBERS
+    V3Graph& m_mTaskGraph;  // The Mtask graph
+    LogicMTask* const m_entryMTaskp;  // Singular source vertex of the dependency graph
+    LogicMTask* const m_exitMTaskp;  // Singular sink vertex of the dependency graph
+    const uint64_t m_costLimit;  // Don't create mtasks costlier than this
+    uint64_t m_merges = 0;  // Number of merges done
+
+    // CONSTRUCTORS
+    MultilevelCoarsen(V3Graph& mTaskGraph, size_t threshold, uint64_t costLimit,
+                      LogicMTask* entryMTaskp, LogicMTask* exitMTaskp)
+        : m_mTaskGraph{mTaskGraph}
+        , m_entryMTaskp{entryMTaskp}
+        , m_exitMTaskp{exitMTaskp}
+        , m_costLimit{costLimit} {
+        size_t count = 0;
+        for (V3GraphVertex& vtx : m_mTaskGraph.vertices()) {
+            vtx.user(0);
+            ++count;
+        }
+        // Levels are numbered from 1, as 0 in user() means not yet merged into
+        for (uint32_t level = 1; count > threshold; ++level) {
+            const size_t newCount = count - coarsenLevel(level);
+            UINFO(4, "Multilevel coarsening level " << level << " " << count << " -> "
+                                                    << newCount << " mtasks");
+            // Stop once a level no longer reduces the graph by at least 10%
+            const bool converged = newCount * 10 > count * 9;
+            count = newCount;
+            if (converged) break;
+        }
+        V3Stats::addStatSum("Optimizations, MTask multilevel coarsening merges", m_merges);
+    }
+    ~MultilevelCoarsen() = default;
+    VL_UNCOPYABLE(MultilevelCoarsen);
+    VL_UNMOVABLE(MultilevelCoarsen);
+
+    // METHODS
+    bool mergeableInto(const LogicMTask* donorp, const LogicMTask* recipientp,
+                       uint32_t level) const {
+        if (recipientp == m_entryMTaskp || recipientp == m_exitMTaskp) return false;
+        if (recipientp->user() == level) return false;
+        return donorp->cost() + recipientp->cost() <= m_costLimit;
+    }
+
+    // Returns the number of merges done at this level
+    size_t coarsenLevel(uint32_t level) {
+        size_t merges = 0;
+        for (V3GraphVertex* const vtxp : m_mTaskGraph.vertices().unlinkable()) {
+            LogicMTask* const donorp = vtxp->as<LogicMTask>();
+            if (donorp == m_entryMTaskp || donorp == m_exitMTaskp) continue;
+            // Already absorbed another mtask at this level
+            if (donorp->user() == level) continue;
+
+            MTaskEdge* edgep = nullptr;
+            LogicMTask* recipientp = nullptr;
+            if (donorp->inSize1()) {
+                edgep = static_cast<MTaskEdge*>(donorp->inEdges().frontp());
+                recipientp = edgep->fromMTaskp();
+            }
+            if (!recipientp || !mergeableInto(donorp, recipientp, level)) {
+                recipientp = nullptr;
+                if (donorp->outSize1()) {
+                    edgep = static_cast<MTaskEdge*>(donorp->outEdges().frontp());
+                    recipientp = edgep->toMTaskp();
+                }
+            }
+            if (!recipientp || !mergeableInto(donorp, recipientp, level)) continue;
+
+            // Remove and free the connecting edge
+            edgep->fromMTaskp()->removeRelativeMTask(edgep->toMTaskp());
+            edgep->fromMTaskp()->removeRelativeEdge<GraphWay::FORWARD>(edgep);
+            edgep->toMTaskp()->removeRelativeEdge<GraphWay::REVERSE>(edgep);
+            VL_DO_DANGLING(edgep->unlinkDelete(), edgep);
+            // Merge, deleting the donor, which is the current element of the iteration
+            recipientp->moveAllVerticesFrom(donorp);
+            partRedirectEdgesFrom(m_mTaskGraph, recipientp, donorp, nullptr);
+            recipientp->user(level);
+            ++merges;
+        }
+        m_merges += merges;
+        return merges;
+    }
+
+public:
+    static void apply(V3Graph& mTaskGraph, size_t threshold, uint64_t costLimit,
+                      LogicMTask* entryMTaskp, LogicMTask* exitMTaskp) {
+        MultilevelCoarsen{mTaskGraph, threshold, costLimit, entryMTaskp, exitMTaskp};
+    }
+};
+
 //######################################################################
 // Partitioner implementation
 
@@ -2152,6 +2261,35 @@ class Partitioner final {
 
     // METHODS
 
+    // Report the logic costing the most on the critical path of the
+    // fine-grained graph. No partitioning can run faster than this path, so
+    // splitting these blocks is what would expose more parallelism.
+    void statsCriticalLogic() const {
+        std::vector<std::pair<uint64_t, const AstNode*>> costs;
+        uint64_t totalCost = 0;
+        for (const LogicMTask* const mtaskp : LogicMTask::criticalPath(*m_mTaskGraphp)) {
+            totalCost += mtaskp->cost();
+            for (const OrderMoveVertex& mVtx : mtaskp->vertexList()) {
+                if (const OrderLogicVertex* const logicp = mVtx.logicp()) {
+                    costs.emplace_back(mtaskp->cost(), logicp->nodep());
+                    break;
+                }
+            }
+        }
+        std::stable_sort(costs.begin(), costs.end(), [](const auto& a, const auto& b) {
+            return a.first > b.first;  //
+        });
+        V3Stats::addStat("MTask graph, initial, critical path logic count", costs.size());
+        // Only blocks of at least 5% of the path, as smaller ones cannot shorten it much
+        constexpr size_t maxReported = 10;
+        for (size_t i = 0; i < std::min(costs.size(), maxReported); ++i) {
+            if (costs[i].first * 20 < totalCost) break;
+            V3Stats::addStat("MTask graph, initial, critical path logic cost at "
+                                 + costs[i].second->fileline()->ascii(),
+                             costs[i].first);
+        }
+    }
+
     // Predicate function to determine what OrderMoveVertex to bypass when constructing the MTask
     // graph. The fine-grained dependency graph of OrderMoveVertex vertices is a bipartite graph
     // of:
@@ -2191,6 +2329,21 @@ class Partitioner final {
         return fanIn + fanOut == 4;
     }
 
+    // Critical path budget for Contraction
+    static uint64_t contractionCpLimit(uint64_t totalGraphCost) {
+        const int targetParFactor = v3Global.opt.threads();
+        UASSERT(targetParFactor >= 2, "Should not reach Partitioner when --threads <= 1");
+
+        // Set cpLimit to roughly totalGraphCost / nThreads
+        //
+        // Actually set it a bit lower, by a hardcoded fudge factor. This
+        // results in more smaller mTaskGraphp, which helps reduce fragmentation
+        // when scheduling them.
+        const unsigned fudgeNumerator = 3;
+        const unsigned fudgeDenominator = 5;
+        return (totalGraphCost * fudgeNumerator) / (targetParFactor * fudgeDenominator);
+    }
+
     uint64_t setupMTaskDeps() VL_MT_DISABLED {
         uint64_t totalGraphCost = 0;
 
@@ -2294,12 +2447,23 @@ class Partitioner final {
         // verify that the costs look reasonable, that we aren't combining
         // nodes that should probably be split, etc.
         if (dumpLevel() >= 3) LogicMTask::dumpCpFilePrefixed(*m_mTaskGraphp, "cp");
+        if (v3Global.opt.stats()) statsCriticalLogic();
 
         // Merge nodes that could present data hazards; see comment within.
         FixDataHazards::apply(orderGraph, *m_mTaskGraphp);
         debugMTaskGraphStats(*m_mTaskGraphp, "hazards");
         hashGraphDebug(*m_mTaskGraphp, "mTaskGraphpp after fixDataHazards()");
 
+        // On very large graphs, cheaply coarsen before the costlier Contraction below.
+        // This keeps the ranks from fixDataHazards() valid.
+        const size_t multilevelThreshold = v3Global.opt.threadsMultilevel();
+        if (v3Global.opt.threadsCoarsen() && multilevelThreshold) {
+            MultilevelCoarsen::apply(*m_mTaskGraphp, multilevelThreshold,
+                                     contractionCpLimit(totalGraphCost) / 16, m_entryMTaskp,
+                                     m_exitMTaskp);
+            debugMTaskGraphStats(*m_mTaskGraphp, "multilevel");
+        }
+
         // Setup the critical path into and out of each node.
         partInitCriticalPaths(*m_mTaskGraphp);
         hashGraphDebug(*m_mTaskGraphp, "after partInitCriticalPaths()");
@@ -2324,18 +2488,7 @@ class Partitioner final {
         // Some tests disable this, hence the test on threadsCoarsen().
         // Coarsening is always enabled in production.
         if (v3Global.opt.threadsCoarsen()) {
-            const int targetParFactor = v3Global.opt.threads();
-            UASSERT(targetParFactor >= 2, "Should not reach Partitioner when --threads <= 1");
-
-            // Set cpLimit to roughly totalGraphCost / nThreads
-            //
-            // Actually set it a bit lower, by a hardcoded fudge factor. This
-            // results in more smaller mTaskGraphp, which helps reduce fragmentation
-            // when scheduling them.
-            const unsigned fudgeNumerator = 3;
-            const unsigned fudgeDenominator = 5;
-            const uint64_t cpLimit
-                = ((totalGraphCost * fudgeNumerator) / (targetParFactor * fudgeDenominator));
+            const uint64_t cpLimit = contractionCpLimit(totalGraphCost);
             UINFO(4, "Partitioner set cpLimit = " << cpLimit);
 
             Contraction::apply(*m_mTaskGraphp, cpLimit, m_entryMTaskp, m_exitMTaskp,
@@ -2496,6 +2649,7 @@ AstExecGraph* V3Order::createParallel(OrderGraph& orderGraph, const std::string&
             new V3GraphEdge{depGraphp, logicMTaskToExecMTask.at(fromp), execMTaskp, 1};
         }
     }
+    serializer.addStats();
 
     // Delete the remaining variable vertices
     for (V3GraphVertex* const vtxp : moveGraphp->vertices().unlinkable()) {
@@ -65,6 +65,7 @@ std::vector<AstActive*> V3Order::createSerial(OrderGraph& graph, const std::stri
         // Can delete the vertex now
         VL_DO_DANGLING(mVtxp->unlinkDelete(moveGraphp.get()), mVtxp);
     }
+    serializer.addStats();
 
     // Delete the remaining variable vertices
     for (V3GraphVertex* const vtxp : moveGraphp->vertices().unlinkable()) {
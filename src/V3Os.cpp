@@ -56,6 +56,8 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 #ifdef HAVE_TCMALLOC
 #include <gperftools/malloc_extension.h>
+#elif defined(__GLIBC__)
+#include <malloc.h>
 #endif
 
 // clang-format off
@@ -412,6 +414,8 @@ void V3Os::unlinkRegexp(const string& dir, const string& regexp) {
 void V3Os::releaseMemory() {
 #ifdef HAVE_TCMALLOC
     MallocExtension::instance()->ReleaseFreeMemory();
+#elif defined(__GLIBC__)
+    malloc_trim(0);
 #endif
 }
 
@@ -55,12 +55,15 @@
 #include "V3Hasher.h"
 #include "V3Os.h"
 #include "V3Parse.h"
+#include "V3Stats.h"
 #include "V3Unroll.h"
 #include "V3Width.h"
 
+#include <algorithm>
 #include <cctype>
 #include <deque>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -260,6 +263,9 @@ class ParamProcessor final {
     std::map<const std::string, std::string>
         m_longMap;  // Hash of very long names to unique identity number
     int m_longId = 0;
+    // Flavor name for each parameter signature, independent of the order overrides are given
+    std::unordered_map<std::string, std::string> m_signatureMap;
+    VDouble0 m_statSignatureReused;  // Statistic tracking
 
     // All module names that are loaded from source code
     // Generated modules by this visitor is not included
@@ -896,14 +902,20 @@ class ParamProcessor final {
         string longname = srcModpr->name() + "_";
         if (debug() >= 9 && paramsp) paramsp->dumpTreeAndNext(cout, "-  cellparams: ");
 
+        std::vector<string> pinNames;  // Name part from each overriding pin
         if (srcModpr->hierBlock()) {
             longname = parameterizedHierBlockName(srcModpr, paramsp);
             any_overrides = longname != srcModpr->name();
         } else {
             for (AstPin* pinp = paramsp; pinp; pinp = VN_AS(pinp->nextp(), Pin)) {
+                const size_t prevLength = longname.length();
                 cellPinCleanup(nodep, pinp, srcModpr, longname /*ref*/, any_overrides /*ref*/);
+                if (longname.length() != prevLength) {
+                    pinNames.push_back(longname.substr(prevLength));
+                }
             }
         }
+        const size_t ifaceStart = longname.length();
         IfaceRefRefs ifaceRefRefs;
         cellInterfaceCleanup(pinsp, srcModpr, longname /*ref*/, any_overrides /*ref*/,
                              ifaceRefRefs /*ref*/);
@@ -930,8 +942,24 @@ class ParamProcessor final {
                 storeOriginalParams(nodeCopyp);
             }
         } else {
-            const string newname
+            string newname
                 = srcModpr->hierBlock() ? longname : moduleCalcName(srcModpr, longname);
+            if (!srcModpr->hierBlock() && m_modNameMap.find(newname) == m_modNameMap.end()) {
+                // Each pin's name part starts with the parameter's unique small name, so
+                // sorting them gives the same signature for overrides listed in any order.
+                // Reuse a flavor made under another order rather than cloning again.
+                std::sort(pinNames.begin(), pinNames.end());
+                string signature = srcModpr->name() + "_";
+                for (const string& pinName : pinNames) signature += pinName;
+                signature += longname.substr(ifaceStart);
+                const auto pair = m_signatureMap.emplace(signature, newname);
+                if (!pair.second) {
+                    UINFO(4, "     De-parameterize reordered " << newname << " to "
+                                                              << pair.first->second);
+                    newname = pair.first->second;
+                    ++m_statSignatureReused;
+                }
+            }
             const ModInfo* const modInfop
                 = moduleFindOrClone(srcModpr, nodep, paramsp, newname, ifaceRefRefs);
             // We need to relink the pins to the new module
@@ -1034,7 +1062,9 @@ public:
             m_allModuleNames.insert(modp->name());
         }
     }
-    ~ParamProcessor() = default;
+    ~ParamProcessor() {
+        V3Stats::addStat("Param, Reordered overrides reused", m_statSignatureReused);
+    }
     VL_UNCOPYABLE(ParamProcessor);
 };
 
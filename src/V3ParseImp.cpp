@@ -37,6 +37,7 @@
 #include "V3Os.h"
 #include "V3ParseBison.h"  // Generated by bison
 #include "V3PreShell.h"
+#include "V3SourceHash.h"
 #include "V3Stats.h"
 
 #include <sstream>
@@ -347,6 +348,10 @@ void V3ParseImp::parseFile(FileLine* fileline, const string& modfilename, bool i
         && modfilename != V3Options::getStdWaiverPath())
         dumpInputsFile();
 
+    if (v3Global.opt.skipIdenticalContent()) {
+        V3SourceHash::addFile(m_lexFileline->contentp(), modfilename, m_ppBuffers);
+    }
+
     // Parse it
     if (!v3Global.opt.preprocOnly() || v3Global.opt.preprocResolve()) {
         lexFile(modfilename);
@@ -0,0 +1,298 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Preprocessed output cache for --preproc-cache
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3PreCache's Transformations:
+//
+// Each file given to the parser is preprocessed as a unit, including the
+// files it `includes.  The key of a unit is the hash of its filename and
+// text, of the defines in effect when it starts, and of the options that
+// change the preprocessor's output.  The cache entry holds the output, the
+// defines in effect when it ends, and each `include with the hash of the
+// file it found.
+//
+// A hit requires each `include to still find the same file with the same
+// text.  A unit that reports any warning or error is not cached, so that
+// later runs report it again.
+//
+//*************************************************************************
+
+#define VL_MT_DISABLED_CODE_UNIT 1
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include "V3PreCache.h"
+
+#include "V3Error.h"
+#include "V3File.h"
+#include "V3FileLine.h"
+#include "V3Global.h"
+#include "V3Os.h"
+#include "V3PreProc.h"
+#include "V3Stats.h"
+#include "V3String.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <sys/stat.h>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class V3PreCacheImp final {
+    using StrList = VInFilter::StrList;
+
+    struct IncludeEnt final {
+        string m_name;  // Name as found by `include
+        string m_lastpath;  // Directory of the including file
+        string m_filename;  // Filename found
+        string m_digest;  // Hash of file text
+    };
+
+    // MEMBERS
+    string m_key;  // Key of the unit being recorded, or empty if not recording
+    int m_msgCount = 0;  // Warnings and errors when recording started
+    std::vector<IncludeEnt> m_includes;  // `includes of the unit being recorded
+
+    // METHODS
+    static int msgCount() { return V3Error::warnCount() + V3Error::errorCount(); }
+
+    static string digest(const StrList& wholefile) {
+        VHashSha256 hash;
+        for (const string& i : wholefile) hash.insert(i);
+        return hash.digestSymbol();
+    }
+
+    static string keyOf(const string& filename, const StrList& wholefile,
+                        const V3PreProc::DefineList& defs) {
+        VHashSha256 hash{"V3PreCache 1\n"};
+        hash.insert(V3Options::version() + "\n");
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+        struct stat binStat;
+        if (stat(v3Global.opt.buildDepBin().c_str(), &binStat) == 0) {
+            hash.insert(static_cast<uint64_t>(binStat.st_size));
+            hash.insert(" ");
+            hash.insert(static_cast<uint64_t>(binStat.st_mtime));
+        }
+        hash.insert("\n");
+        // Options that change the output
+        hash.insert(v3Global.opt.fileLanguage(filename).ascii());
+        hash.insert(v3Global.opt.assertOn() ? " assert" : " noassert");
+        hash.insert(v3Global.opt.publicOff() ? " publicoff" : " publicon");
+        hash.insert(v3Global.opt.pedantic() ? " pedantic" : " nopedantic");
+        hash.insert(" " + cvtToStr(v3Global.opt.preprocTokenLimit()));
+        hash.insert(" " + v3Global.opt.pipeFilter() + "\n");
+        // Warnings the preprocessor might report
+        const FileLine defaultFl{filename};
+        string warnOff;
+        for (int code = V3ErrorCode::EC_MIN; code < V3ErrorCode::_ENUM_MAX; ++code) {
+            warnOff += defaultFl.warnIsOff(V3ErrorCode{code}) ? '1' : '0';
+        }
+        hash.insert(warnOff + "\n");
+        for (const V3PreProc::DefineEnt& def : defs) {
+            hash.insert(def.m_name + (def.m_cmdline ? " C " : " D ") + def.m_params + " ");
+            hash.insert(def.m_value + "\n");
+        }
+        hash.insert(filename + "\n");
+        hash.insert(digest(wholefile));
+        return hash.digestSymbol();
+    }
+
+    static string cacheFilename(const string& key) {
+        return v3Global.opt.preprocCache() + "/" + key + ".vppc";
+    }
+
+    // Entries are written as a list of length-prefixed strings
+    static void writeStr(std::ostream& os, const string& str) {
+        os << str.size() << ':' << str << '\n';
+    }
+    static bool readStr(std::istream& is, string& strr) {
+        size_t size = 0;
+        if (!(is >> size) || is.get() != ':') return false;
+        strr.resize(size);
+        is.read(&strr[0], size);
+        return is.get() == '\n';
+    }
+    static bool readNum(std::istream& is, size_t& numr) {
+        string str;
+        if (!readStr(is, str)) return false;
+        numr = std::strtoul(str.c_str(), nullptr, 10);
+        return true;
+    }
+
+    bool fetchEntry(FileLine* fl, V3PreProc* preprocp, VInFilter* filterp,
+                    const string& filename, std::vector<string>& textr) {
+        m_key.clear();
+        m_includes.clear();
+        std::vector<StrList> wholefiles(1);
+        if (!filterp->readWholefile(filename, wholefiles[0] /*ref*/)) return false;
+        const string key = keyOf(filename, wholefiles[0], preprocp->defines());
+        // Cannot be found until a hit below, so a miss records from here
+        m_key = key;
+        m_msgCount = msgCount();
+
+        const std::unique_ptr<std::ifstream> ifp{
+            V3File::new_ifstream_nodepend(cacheFilename(key))};
+        if (ifp->fail()) {
+            UINFO(4, "Preprocessor cache miss " << filename);
+            return false;
+        }
+        V3Os::getline(*ifp);  // Description comment
+        // Each `include must find the same file with the same text
+        size_t count = 0;
+        std::vector<string> filenames{filename};
+        if (!readNum(*ifp, count)) return false;
+        for (size_t i = 0; i < count; ++i) {
+            IncludeEnt ent;
+            if (!readStr(*ifp, ent.m_name) || !readStr(*ifp, ent.m_lastpath)
+                || !readStr(*ifp, ent.m_filename) || !readStr(*ifp, ent.m_digest)) {
+                return false;
+            }
+            if (v3Global.opt.filePath(fl, ent.m_name, ent.m_lastpath, "") != ent.m_filename) {
+                UINFO(4, "Preprocessor cache stale include " << ent.m_filename);
+                return false;
+            }
+            wholefiles.emplace_back();
+            if (!filterp->readWholefile(ent.m_filename, wholefiles.back() /*ref*/)
+                || digest(wholefiles.back()) != ent.m_digest) {
+                UINFO(4, "Preprocessor cache stale include " << ent.m_filename);
+                return false;
+            }
+            filenames.push_back(ent.m_filename);
+        }
+        V3PreProc::DefineList defs;
+        if (!readNum(*ifp, count)) return false;
+        for (size_t i = 0; i < count; ++i) {
+            V3PreProc::DefineEnt def;
+            string cmdline;
+            string defFilename;
+            size_t lineno = 0;
+            if (!readStr(*ifp, def.m_name) || !readStr(*ifp, def.m_value)
+                || !readStr(*ifp, def.m_params) || !readStr(*ifp, cmdline)
+                || !readStr(*ifp, defFilename) || !readNum(*ifp, lineno)) {
+                return false;
+            }
+            def.m_cmdline = cmdline == "1";
+            def.m_fileline = new FileLine{defFilename};
+            def.m_fileline->lineno(static_cast<int>(lineno));
+            defs.push_back(def);
+        }
+        std::vector<string> text;
+        if (!readNum(*ifp, count)) return false;
+        text.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            if (!readStr(*ifp, text[i])) return false;
+        }
+
+        // Hit, so do what opening each file would have done
+        UINFO(4, "Preprocessor cache hit " << filename);
+        m_key.clear();
+        for (size_t i = 0; i < filenames.size(); ++i) {
+            V3File::addSrcDepend(filenames[i]);
+            V3PreProc::contentsPushText(filenames[i], wholefiles[i]);
+        }
+        preprocp->defines(defs);
+        textr = std::move(text);
+        return true;
+    }
+
+public:
+    bool fetch(FileLine* fl, V3PreProc* preprocp, VInFilter* filterp, const string& filename,
+               std::vector<string>& textr) {
+        const bool hit = fetchEntry(fl, preprocp, filterp, filename, textr /*ref*/);
+        V3Stats::addStatSum(hit ? "Preprocessor cache, hits" : "Preprocessor cache, misses", 1);
+        return hit;
+    }
+
+    void addInclude(const string& name, const string& lastpath, const string& filename) {
+        if (m_key.empty()) return;
+        m_includes.push_back(IncludeEnt{name, lastpath, filename, ""});
+    }
+
+    void store(V3PreProc* preprocp, VInFilter* filterp, const std::vector<string>& text) {
+        if (m_key.empty()) return;
+        const string key = m_key;
+        m_key.clear();
+        if (msgCount() != m_msgCount) {
+            UINFO(4, "Preprocessor cache not written as messages were reported");
+            return;
+        }
+        for (IncludeEnt& ent : m_includes) {
+            StrList wholefile;
+            if (!filterp->readWholefile(ent.m_filename, wholefile /*ref*/)) return;
+            ent.m_digest = digest(wholefile);
+        }
+
+        // Write to a unique name then rename, as other runs may share the cache
+        V3Os::createDir(v3Global.opt.preprocCache());
+        const string filename = cacheFilename(key);
+        const string tmpFilename
+            = filename + "." + VHashSha256{V3Os::trueRandom(16)}.digestSymbol() + ".tmp";
+        {
+            const std::unique_ptr<std::ofstream> ofp{
+                V3File::new_ofstream_nodepend(tmpFilename)};
+            if (ofp->fail()) {
+                UINFO(4, "Preprocessor cache can't write " << tmpFilename);
+                return;
+            }
+            *ofp << "# DESCR"
+                    "IPTION: Verilator output: Preprocessor cache for --preproc-cache.  "
+                    "Delete at will.\n";
+            writeStr(*ofp, cvtToStr(m_includes.size()));
+            for (const IncludeEnt& ent : m_includes) {
+                writeStr(*ofp, ent.m_name);
+                writeStr(*ofp, ent.m_lastpath);
+                writeStr(*ofp, ent.m_filename);
+                writeStr(*ofp, ent.m_digest);
+            }
+            const V3PreProc::DefineList defs = preprocp->defines();
+            writeStr(*ofp, cvtToStr(defs.size()));
+            for (const V3PreProc::DefineEnt& def : defs) {
+                writeStr(*ofp, def.m_name);
+                writeStr(*ofp, def.m_value);
+                writeStr(*ofp, def.m_params);
+                writeStr(*ofp, def.m_cmdline ? "1" : "0");
+                writeStr(*ofp, def.m_fileline ? def.m_fileline->filename() : "");
+                writeStr(*ofp, cvtToStr(def.m_fileline ? def.m_fileline->lineno() : 0));
+            }
+            writeStr(*ofp, cvtToStr(text.size()));
+            for (const string& i : text) writeStr(*ofp, i);
+        }
+        if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0) {
+            std::remove(tmpFilename.c_str());
+        }
+    }
+};
+
+static V3PreCacheImp s_preCacheImp;
+
+//######################################################################
+// V3PreCache
+
+bool V3PreCache::enabled() {
+    return !v3Global.opt.preprocCache().empty() && !v3Global.opt.preprocOnly();
+}
+bool V3PreCache::fetch(FileLine* fl, V3PreProc* preprocp, VInFilter* filterp,
+                       const string& filename, std::vector<string>& textr) {
+    return s_preCacheImp.fetch(fl, preprocp, filterp, filename, textr);
+}
+void V3PreCache::addInclude(const string& name, const string& lastpath, const string& filename) {
+    s_preCacheImp.addInclude(name, lastpath, filename);
+}
+void V3PreCache::store(V3PreProc* preprocp, VInFilter* filterp, const std::vector<string>& text) {
+    s_preCacheImp.store(preprocp, filterp, text);
+}
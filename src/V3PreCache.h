@@ -0,0 +1,50 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Preprocessed output cache for --preproc-cache
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3PRECACHE_H_
+#define VERILATOR_V3PRECACHE_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include <string>
+#include <vector>
+
+class FileLine;
+class V3PreProc;
+class VInFilter;
+
+//============================================================================
+
+class V3PreCache final {
+public:
+    // Return true if --preproc-cache is in effect
+    static bool enabled() VL_MT_DISABLED;
+    // If the preprocessed output of the given file is cached, restore the
+    // defines it leaves, and return true with the output in textr.
+    // Otherwise start recording the file, and return false.
+    static bool fetch(FileLine* fl, V3PreProc* preprocp, VInFilter* filterp,
+                      const std::string& filename,
+                      std::vector<std::string>& textr) VL_MT_DISABLED;
+    // Record an `include of the file being recorded, found as the given name
+    static void addInclude(const std::string& name, const std::string& lastpath,
+                           const std::string& filename) VL_MT_DISABLED;
+    // Write the recorded file with its output, unless it reported any message
+    static void store(V3PreProc* preprocp, VInFilter* filterp,
+                      const std::vector<std::string>& text) VL_MT_DISABLED;
+};
+
+#endif  // Guard
@@ -263,6 +263,8 @@ public:
     void addLineComment(int enterExit);
     void dumpDefines(std::ostream& os) override;
     void candidateDefines(VSpellCheck* spellerp) override;
+    DefineList defines() override;
+    void defines(const DefineList& defs) override;
 
     // METHODS, callbacks
     void comment(const string& text) override;  // Comment detected (if keepComments==2)
@@ -302,6 +304,15 @@ V3PreProc* V3PreProc::createPreProc(FileLine* fl) {
 
 void V3PreProc::selfTest() VL_MT_DISABLED { V3PreExpr::selfTest(); }
 
+void V3PreProc::contentsPushText(const string& filename, const std::list<string>& wholefile) {
+    if (filename == V3Options::getStdPackagePath()) return;
+    for (const string& i : wholefile) {
+        // TODO this is overly sensitive, might be in a comment
+        if (i.find("`verilator_config") != string::npos) return;
+    }
+    for (const string& i : wholefile) V3Control::contentsPushText(i);
+}
+
 //*************************************************************************
 // Defines
 
@@ -847,19 +858,7 @@ void V3PreProcImp::openFile(FileLine*, VInFilter* filterp, const string& filenam
     for (const string& i : wholefile) flsp->contentp()->pushText(i);
 
     // Save contents for V3Control --contents
-    if (filename != V3Options::getStdPackagePath()) {
-        bool containsVlt = false;
-        for (const string& i : wholefile) {
-            // TODO this is overly sensitive, might be in a comment
-            if (i.find("`verilator_config") != string::npos) {
-                containsVlt = true;
-                break;
-            }
-        }
-        if (!containsVlt) {
-            for (const string& i : wholefile) V3Control::contentsPushText(i);
-        }
-    }
+    contentsPushText(filename, wholefile);
 
     // Create new stream structure
     m_lexp->scanNewFile(flsp);
@@ -945,6 +944,24 @@ void V3PreProcImp::candidateDefines(VSpellCheck* spellerp) {
     }
 }
 
+V3PreProc::DefineList V3PreProcImp::defines() {
+    DefineList defs;
+    defs.reserve(m_defines.size());
+    for (const auto& it : m_defines) {
+        defs.push_back(DefineEnt{it.first, it.second.value(), it.second.params(),
+                                 it.second.cmdline(), it.second.fileline()});
+    }
+    return defs;
+}
+
+void V3PreProcImp::defines(const DefineList& defs) {
+    m_defines.clear();
+    for (const DefineEnt& def : defs) {
+        m_defines.emplace(def.m_name,
+                          VDefine{def.m_fileline, def.m_value, def.m_params, def.m_cmdline});
+    }
+}
+
 int V3PreProcImp::getRawToken() {
     // Get a token from the file, whatever it may be.
     while (true) {
@@ -27,6 +27,7 @@
 #include <iostream>
 #include <list>
 #include <map>
+#include <vector>
 
 class VInFilter;
 class VSpellCheck;
@@ -87,6 +88,21 @@ public:
     virtual void dumpDefines(std::ostream& os) = 0;  ///< Print list of `defines
     virtual void candidateDefines(VSpellCheck* spellerp) = 0;  ///< Spell check candidate defines
 
+    // Defines as saved and restored by V3PreCache
+    struct DefineEnt final {
+        string m_name;  // Name of the define
+        string m_value;  // Value of define
+        string m_params;  // Parameters
+        bool m_cmdline;  // Set on command line
+        FileLine* m_fileline;  // Where it was declared
+    };
+    using DefineList = std::vector<DefineEnt>;
+    virtual DefineList defines() = 0;  ///< Return all defines, in name order
+    virtual void defines(const DefineList& defs) = 0;  ///< Replace all defines
+    // Save a file's contents for V3Control, as done when opened
+    static void contentsPushText(const string& filename,
+                                 const std::list<string>& wholefile) VL_MT_DISABLED;
+
 protected:
     // CONSTRUCTORS
     V3PreProc() {}
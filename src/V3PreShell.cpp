@@ -25,10 +25,12 @@
 #include "V3Global.h"
 #include "V3Os.h"
 #include "V3Parse.h"
+#include "V3PreCache.h"
 #include "V3PreProc.h"
 
 #include <algorithm>
 #include <iostream>
+#include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -91,8 +93,13 @@ protected:
 
         // Preprocess
         s_filterp = filterp;
-        const string modfilename = preprocOpen(fl, s_filterp, modname, "", errmsg);
+        const string modfilename = preprocFind(fl, modname, "", errmsg);
         if (modfilename.empty()) return false;
+        std::vector<string> cached;
+        const bool cacheHit
+            = V3PreCache::enabled()
+              && V3PreCache::fetch(fl, s_preprocp, s_filterp, modfilename, cached /*ref*/);
+        if (!cacheHit) preprocOpen(fl, s_filterp, modfilename);
 
         // Set language standard up front
         if (!v3Global.opt.preprocOnly() || v3Global.opt.preprocResolve()) {
@@ -107,10 +114,16 @@ protected:
             // FileLine tracks and frees modfileline
         }
 
+        if (cacheHit) {
+            for (const string& text : cached) V3Parse::ppPushText(parsep, text);
+            return true;
+        }
         while (!s_preprocp->isEof()) {
             const string line = s_preprocp->getline();
             V3Parse::ppPushText(parsep, line);
+            if (V3PreCache::enabled()) cached.push_back(line);
         }
+        if (V3PreCache::enabled()) V3PreCache::store(s_preprocp, s_filterp, cached);
         return true;
     }
 
@@ -120,29 +133,37 @@ protected:
                        "Suggest `include with absolute path be made relative, and use +include: "
                            << modname);
         }
-        preprocOpen(fl, s_filterp, modname, V3Os::filenameDir(fl->filename()),
-                    "Cannot find include file: ");
+        const string lastpath = V3Os::filenameDir(fl->filename());
+        string foundname;
+        const string filename
+            = preprocFind(fl, modname, lastpath, "Cannot find include file: ", &foundname);
+        if (filename.empty()) return;
+        if (V3PreCache::enabled()) V3PreCache::addInclude(foundname, lastpath, filename);
+        preprocOpen(fl, s_filterp, filename);
     }
 
 private:
-    string preprocOpen(FileLine* fl, VInFilter* filterp, const string& modname,
-                       const string& lastpath,
-                       const string& errmsg) {  // Error message or "" to suppress
+    string preprocFind(FileLine* fl, const string& modname, const string& lastpath,
+                       const string& errmsg,  // Error message or "" to suppress
+                       string* foundnamep = nullptr) {  // Name that was found, if non-null
         // Returns filename if successful
         // Try a pure name in case user has a bogus `filename they don't expect
+        string foundname = modname;
         string filename = v3Global.opt.filePath(fl, modname, lastpath, errmsg);
         if (filename == "") {
             // Allow user to put `defined names on the command line instead of filenames,
             // then convert them properly.
-            const string ppmodname = s_preprocp->removeDefines(modname);
+            foundname = s_preprocp->removeDefines(modname);
 
-            filename = v3Global.opt.filePath(fl, ppmodname, lastpath, errmsg);
+            filename = v3Global.opt.filePath(fl, foundname, lastpath, errmsg);
         }
-        if (filename == "") return "";  // Not found
+        if (foundnamep) *foundnamep = foundname;
+        return filename;  // "" if not found
+    }
 
+    void preprocOpen(FileLine* fl, VInFilter* filterp, const string& filename) {
         UINFO(2, "    Reading " << filename);
         s_preprocp->openFile(fl, filterp, filename);
-        return filename;
     }
 
 public:
@@ -47,6 +47,7 @@ class PremitVisitor final : public VNVisitor {
     // STATE - across all visitors
     VDouble0 m_extractedToConstPool;  // Statistic tracking
     VDouble0 m_temporaryVarsCreated;  // Statistic tracking
+    VDouble0 m_narrowedDivisors;  // Statistic tracking
 
     // STATE - for current visit position (use VL_RESTORER)
     AstCFunc* m_cfuncp = nullptr;  // Current block
@@ -113,6 +114,20 @@ class PremitVisitor final : public VNVisitor {
         return varp;
     }
 
+    void checkStringConst(AstConst* nodep) {
+        // Read string literal operands of string operators from the constant pool,
+        // rather than constructing a std::string on every evaluation
+        const AstNodeBiop* const biopp = VN_CAST(nodep->backp(), NodeBiop);
+        if (!biopp || !biopp->stringFlavor()) return;
+        const string str = nodep->num().toString();
+        if (str.empty() || str.find('\0') != string::npos) return;
+        FileLine* const flp = nodep->fileline();
+        AstVar* const varp = v3Global.rootp()->constPoolp()->findConst(nodep, true)->varp();
+        nodep->replaceWith(new AstVarRef{flp, varp, VAccess::READ});
+        VL_DO_DANGLING(pushDeletep(nodep), nodep);
+        ++m_extractedToConstPool;
+    }
+
     void visitShift(AstNodeBiop* nodep) {
         // Shifts of > 32/64 bits in C++ will wrap-around and generate non-0s
         UINFO(4, "  ShiftFix  " << nodep);
@@ -146,6 +161,23 @@ class PremitVisitor final : public VNVisitor {
         checkNode(nodep);
     }
 
+    void visitDiv(AstNodeBiop* nodep) {
+        // Wide division by a single word constant uses VL_DIV_WWI, where the C++ compiler
+        // can strength reduce the division by the literal, so narrow rather than extract it
+        AstConst* const constp = VN_CAST(nodep->rhsp(), Const);
+        if (nodep->isWide() && constp && !constp->num().isFourState()
+            && !constp->num().isEqZero() && constp->num().mostSetBitP1() <= VL_EDATASIZE) {
+            UINFO(4, "  DivNarrow  " << nodep);
+            AstConst* const newp = new AstConst{constp->fileline(), AstConst::SizedEData{},
+                                                constp->num().edataWord(0)};
+            constp->replaceWith(newp);
+            VL_DO_DANGLING(pushDeletep(constp), constp);
+            ++m_narrowedDivisors;
+        }
+        iterateChildren(nodep);
+        checkNode(nodep);
+    }
+
     static bool rhsReadsLhs(AstNodeAssign* nodep) {
         const VNUser3InUse user3InUse;
         nodep->lhsp()->foreach([](const AstVarRef* refp) {
@@ -256,8 +288,16 @@ class PremitVisitor final : public VNVisitor {
     void visit(AstShiftL* nodep) override { visitShift(nodep); }
     void visit(AstShiftR* nodep) override { visitShift(nodep); }
     void visit(AstShiftRS* nodep) override { visitShift(nodep); }
+    void visit(AstDiv* nodep) override { visitDiv(nodep); }
+    void visit(AstModDiv* nodep) override { visitDiv(nodep); }
 
-    void visit(AstConst* nodep) override { checkNode(nodep); }
+    void visit(AstConst* nodep) override {
+        if (nodep->num().isString()) {
+            checkStringConst(nodep);
+        } else {
+            checkNode(nodep);
+        }
+    }
     // Operators
     void visit(AstNodeTermop* nodep) override { checkNode(nodep); }
     void visit(AstNodeUniop* nodep) override {
@@ -359,6 +399,7 @@ public:
                          m_extractedToConstPool);
         V3Stats::addStat("Optimizations, Prelim temporary variables created",
                          m_temporaryVarsCreated);
+        V3Stats::addStat("Optimizations, Prelim narrowed constant divisors", m_narrowedDivisors);
     }
 };
 
@@ -349,6 +349,7 @@ class ProtectVisitor final : public VNVisitor {
         txtp->addText(fl, "class " + m_topName + "_container: public " + m_topName + " {\n");
         txtp->addText(fl, "public:\n");
         txtp->addText(fl, "long long m_seqnum;\n");
+        txtp->addText(fl, "bool m_evaled = false;  // Evaluated since construction\n");
         txtp->addText(fl, m_topName + "_container(const char* scopep__V):\n");
         txtp->addText(fl, m_topName + "(scopep__V) {}\n");
         txtp->addText(fl, "};\n\n");
@@ -389,8 +390,13 @@ class ProtectVisitor final : public VNVisitor {
         txtp->addText(fl, ")\n");
         m_cComboInsp = new AstTextBlock{fl, "{\n"};
         castPtr(fl, m_cComboInsp);
+        // Only evaluate if an input changed, as the outputs are otherwise up to date
+        m_cComboInsp->addText(fl, "bool changed__V = !handlep__V->m_evaled;\n");
         txtp->addNodesp(m_cComboInsp);
-        m_cComboOutsp = new AstTextBlock{fl, "handlep__V->eval();\n"};
+        m_cComboOutsp = new AstTextBlock{fl, "if (changed__V) {\n"
+                                             "handlep__V->eval();\n"
+                                             "handlep__V->m_evaled = true;\n"
+                                             "}\n"};
         txtp->addNodesp(m_cComboOutsp);
         txtp->addText(fl, "return handlep__V->m_seqnum++;\n");
         txtp->addText(fl, "}\n\n");
@@ -405,7 +411,8 @@ class ProtectVisitor final : public VNVisitor {
             m_cSeqClksp = new AstTextBlock{fl, "{\n"};
             castPtr(fl, m_cSeqClksp);
             txtp->addNodesp(m_cSeqClksp);
-            m_cSeqOutsp = new AstTextBlock{fl, "handlep__V->eval();\n"};
+            m_cSeqOutsp = new AstTextBlock{fl, "handlep__V->eval();\n"
+                                               "handlep__V->m_evaled = true;\n"};
             txtp->addNodesp(m_cSeqOutsp);
             txtp->addText(fl, "return handlep__V->m_seqnum++;\n");
             txtp->addText(fl, "}\n\n");
@@ -454,6 +461,13 @@ class ProtectVisitor final : public VNVisitor {
         return V3Task::assignDpiToInternal("handlep__V->" + varp->name(), varp);
     }
 
+    string cChangedInputConnection(AstVar* varp) {
+        const string prevName = varp->name() + "_prev__V";
+        return "const auto " + prevName + " = handlep__V->" + varp->name() + ";\n"
+               + cInputConnection(varp) + "changed__V |= handlep__V->" + varp->name()
+               + " != " + prevName + ";\n";
+    }
+
     void handleClock(AstVar* varp) {
         FileLine* const fl = varp->fileline();
         handleInput(varp);
@@ -475,7 +489,7 @@ class ProtectVisitor final : public VNVisitor {
         m_comboIgnorePortsp->addNodesp(varp->cloneTree(false));
         if (m_hasClk) m_comboIgnoreParamsp->addText(fl, varp->prettyName() + "\n");
         m_cComboParamsp->addText(fl, varp->dpiArgType(true, false) + "\n");
-        m_cComboInsp->addText(fl, cInputConnection(varp));
+        m_cComboInsp->addText(fl, cChangedInputConnection(varp));
         m_cIgnoreParamsp->addText(fl, varp->dpiArgType(true, false) + "\n");
     }
 
@@ -1315,6 +1315,138 @@ public:
     }
 };
 
+//######################################################################
+// Determines if the constraints of a class only bound rand variables by constants, e.g.
+// 'x inside {[0:15]}' or 'y < 10'.  If so, randomize() picks each variable from its range
+// directly, without calling the solver.
+
+class ConstraintRangeClassifier final {
+    // TYPES
+    struct Bound final {
+        int64_t m_lo;  // Lowest legal value
+        int64_t m_hi;  // Highest legal value
+    };
+
+    // STATE
+    std::vector<AstVar*> m_varps;  // Bounded variables, in order of first reference
+    std::unordered_map<AstVar*, Bound> m_bounds;  // Bound of each variable
+    bool m_simple = true;  // All constraints are constant bounds
+
+    // METHODS
+    Bound* boundp(AstNodeExpr* exprp, bool& isSigned) {
+        // Bound of the variable referenced by a compare operand, if a simple variable
+        const bool extended = VN_IS(exprp, Extend) || VN_IS(exprp, ExtendS);
+        AstNodeExpr* const refExprp = extended ? VN_AS(exprp, NodeUniop)->lhsp() : exprp;
+        AstVarRef* const refp = VN_CAST(refExprp, VarRef);
+        if (!refp) return nullptr;
+        AstVar* const varp = refp->varp();
+        const AstBasicDType* const basicp = VN_CAST(varp->dtypep()->skipRefp(), BasicDType);
+        if (!varp->rand().isRand() || varp->isRandC() || !basicp || !basicp->isIntegralOrPacked()
+            || varp->width() > 32 || (extended && VN_IS(exprp, ExtendS) != varp->isSigned())) {
+            return nullptr;
+        }
+        isSigned = varp->isSigned();
+        const auto pair = m_bounds.emplace(varp, Bound{0, 0});
+        if (pair.second) {
+            m_varps.push_back(varp);
+            const int width = varp->width();
+            pair.first->second.m_lo = isSigned ? -(1LL << (width - 1)) : 0;
+            pair.first->second.m_hi = isSigned ? (1LL << (width - 1)) - 1 : (1LL << width) - 1;
+        }
+        return &pair.first->second;
+    }
+    bool addCompare(AstNodeBiop* cmpp) {
+        const bool cmpSigned = VN_IS(cmpp, LtS) || VN_IS(cmpp, LteS) || VN_IS(cmpp, GtS)
+                               || VN_IS(cmpp, GteS);
+        const bool lt = VN_IS(cmpp, Lt) || VN_IS(cmpp, LtS);
+        const bool lte = VN_IS(cmpp, Lte) || VN_IS(cmpp, LteS);
+        const bool gt = VN_IS(cmpp, Gt) || VN_IS(cmpp, GtS);
+        const bool gte = VN_IS(cmpp, Gte) || VN_IS(cmpp, GteS);
+        const bool eq = VN_IS(cmpp, Eq);
+        if (!lt && !lte && !gt && !gte && !eq) return false;
+        // Constant on the right, or mirror the compare
+        const bool mirrored = VN_IS(cmpp->lhsp(), Const);
+        const AstConst* const constp = VN_CAST(mirrored ? cmpp->lhsp() : cmpp->rhsp(), Const);
+        if (!constp || constp->isWide()) return false;
+        bool isSigned = false;
+        Bound* const bp = boundp(mirrored ? cmpp->rhsp() : cmpp->lhsp(), isSigned);
+        if (!bp || (!eq && cmpSigned != isSigned)) return false;
+        int64_t value;
+        if (isSigned) {
+            value = constp->num().toSQuad();
+        } else {
+            const uint64_t uvalue = constp->num().toUQuad();
+            value = uvalue > static_cast<uint64_t>(INT64_MAX) ? INT64_MAX
+                                                               : static_cast<int64_t>(uvalue);
+        }
+        const bool upper = mirrored ? (gt || gte) : (lt || lte);
+        const bool strict = lt || gt;
+        if (eq || upper) {
+            if (strict && value == INT64_MIN) return false;
+            bp->m_hi = std::min(bp->m_hi, strict ? value - 1 : value);
+        }
+        if (eq || !upper) {
+            if (strict && value == INT64_MAX) return false;
+            bp->m_lo = std::max(bp->m_lo, strict ? value + 1 : value);
+        }
+        return true;
+    }
+    bool addExpr(AstNodeExpr* exprp) {
+        if (VN_IS(exprp, LogAnd) || (VN_IS(exprp, And) && exprp->width() == 1)) {
+            AstNodeBiop* const andp = VN_AS(exprp, NodeBiop);
+            return addExpr(andp->lhsp()) && addExpr(andp->rhsp());
+        }
+        if (AstNodeBiop* const cmpp = VN_CAST(exprp, NodeBiop)) return addCompare(cmpp);
+        return false;
+    }
+    void addItems(AstNode* itemsp) {
+        for (AstNode* itemp = itemsp; itemp && m_simple; itemp = itemp->nextp()) {
+            if (VN_IS(itemp, ConstraintBefore)) continue;  // Bounds are independent
+            const AstConstraintExpr* const exprp = VN_CAST(itemp, ConstraintExpr);
+            m_simple = exprp && !exprp->isSoft() && !exprp->isDisableSoft()
+                       && addExpr(exprp->exprp());
+        }
+    }
+
+public:
+    // CONSTRUCTORS
+    explicit ConstraintRangeClassifier(AstClass* classp) {
+        classp->foreachMember([&](AstClass*, AstConstraint* constrp) {
+            const RandomizeMode rmode = {.asInt = constrp->user1()};
+            if (rmode.usesMode) m_simple = false;
+            if (m_simple) addItems(constrp->itemsp());
+        });
+        for (const auto& pair : m_bounds) {
+            if (pair.second.m_lo > pair.second.m_hi) m_simple = false;  // Leave to the solver
+        }
+    }
+
+    // METHODS
+    // Return statements picking each bounded variable, or nullptr if the solver is needed
+    AstNode* newPickStmtsp(FileLine* fl) const {
+        if (!m_simple || m_varps.empty()) return nullptr;
+        AstNode* stmtsp = nullptr;
+        for (AstVar* const varp : m_varps) {
+            const Bound& bound = m_bounds.at(varp);
+            AstVarRef* const refp = new AstVarRef{fl, VN_AS(varp->user2p(), NodeModule), varp,
+                                                  VAccess::WRITE};
+            // lo + rand % (hi - lo + 1), in 64 bits then truncated
+            AstRandRNG* const randp = new AstRandRNG{fl, refp->findUInt64DType()};
+            AstNodeExpr* const spanp = new AstConst{
+                fl, AstConst::Unsized64{}, static_cast<uint64_t>(bound.m_hi - bound.m_lo) + 1};
+            AstNodeExpr* const modp = new AstModDiv{fl, randp, spanp};
+            modp->dtypeSetUInt64();
+            AstNodeExpr* const addp = new AstAdd{
+                fl, new AstConst{fl, AstConst::Unsized64{}, static_cast<uint64_t>(bound.m_lo)},
+                modp};
+            addp->dtypeSetUInt64();
+            AstNodeExpr* const valp = new AstSel{fl, addp, 0, varp->width()};
+            stmtsp = AstNode::addNext(stmtsp, new AstAssign{fl, refp, valp});
+        }
+        return stmtsp;
+    }
+};
+
 //######################################################################
 // Visitor that defines a randomize method where needed
 
@@ -2108,6 +2240,9 @@ class RandomizeVisitor final : public VNVisitor {
         AstNodeExpr* beginValp = nullptr;
         AstVar* genp = getRandomGenerator(nodep);
         if (genp) {
+            // Classify before the constraints are converted to solver calls
+            AstNode* const pickStmtsp
+                = randModeVarp ? nullptr : ConstraintRangeClassifier{nodep}.newPickStmtsp(fl);
             nodep->foreachMember([&](AstClass* const classp, AstConstraint* const constrp) {
                 AstTask* taskp = VN_AS(constrp->user2p(), Task);
                 if (!taskp) {
@@ -2136,19 +2271,26 @@ class RandomizeVisitor final : public VNVisitor {
                         nodep, constrp, constrp->itemsp()->unlinkFrBackWithNext()));
                 }
             });
-            randomizep->addStmtsp(implementConstraintsClear(fl, genp));
-            AstTask* setupAllTaskp = getCreateConstraintSetupFunc(nodep);
-            AstTaskRef* const setupTaskRefp = new AstTaskRef{fl, setupAllTaskp, nullptr};
-            randomizep->addStmtsp(setupTaskRefp->makeStmt());
-
-            AstNodeModule* const genModp = VN_AS(genp->user2p(), NodeModule);
-            AstVarRef* const genRefp = new AstVarRef{fl, genModp, genp, VAccess::READWRITE};
-            AstNode* const argsp = genRefp;
-            argsp->addNext(new AstText{fl, ".next(__Vm_rng)"});
-
-            AstNodeExpr* const solverCallp = new AstCExpr{fl, argsp};
-            solverCallp->dtypeSetBit();
-            beginValp = solverCallp;
+            if (pickStmtsp) {
+                // The setup tasks are still used by randomize() with inline constraints
+                UINFO(9, "Constraints of " << nodep << " solved without the solver");
+                randomizep->addStmtsp(pickStmtsp);
+                beginValp = new AstConst{fl, AstConst::WidthedValue{}, 32, 1};
+            } else {
+                randomizep->addStmtsp(implementConstraintsClear(fl, genp));
+                AstTask* setupAllTaskp = getCreateConstraintSetupFunc(nodep);
+                AstTaskRef* const setupTaskRefp = new AstTaskRef{fl, setupAllTaskp, nullptr};
+                randomizep->addStmtsp(setupTaskRefp->makeStmt());
+
+                AstNodeModule* const genModp = VN_AS(genp->user2p(), NodeModule);
+                AstVarRef* const genRefp = new AstVarRef{fl, genModp, genp, VAccess::READWRITE};
+                AstNode* const argsp = genRefp;
+                argsp->addNext(new AstText{fl, ".next(__Vm_rng)"});
+
+                AstNodeExpr* const solverCallp = new AstCExpr{fl, argsp};
+                solverCallp->dtypeSetBit();
+                beginValp = solverCallp;
+            }
 
             if (randModeVarp) {
                 AstNodeModule* const randModeClassp = VN_AS(randModeVarp->user2p(), Class);
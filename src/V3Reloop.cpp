@@ -27,6 +27,16 @@
 //
 //   Likewise vector assign to the same constant converted to a loop.
 //
+//   Likewise a series of assignments of identical expressions, where each
+//   constant array index either is the same in every assignment, or moves
+//   with the left hand side index (a lane index):
+//
+//      ASSIGN(ARRAYREF(var, #), AND(ARRAYREF(a, #+C), ARRAYREF(b, K)))
+//      ASSIGN(ARRAYREF(var, #+1), AND(ARRAYREF(a, #+1+C), ARRAYREF(b, K)))
+//      ->
+//      FOR(__Vilp = low; __Vilp <= high; ++__Vlip)
+//         ASSIGN(ARRAYREF(var, __Vilp), AND(ARRAYREF(a, __Vilp + C), ARRAYREF(b, K)))
+//
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
@@ -47,6 +57,8 @@ class ReloopVisitor final : public VNVisitor {
     // STATE
     VDouble0 m_statReloops;  // Statistic tracking
     VDouble0 m_statReItems;  // Statistic tracking
+    VDouble0 m_statReLanes;  // Statistic tracking
+    VDouble0 m_statReLaneItems;  // Statistic tracking
     AstCFunc* m_cfuncp = nullptr;  // Current block
 
     std::vector<AstNodeAssign*> m_mgAssignps;  // List of assignments merging
@@ -60,6 +72,9 @@ class ReloopVisitor final : public VNVisitor {
     const AstConst* m_mgConstRp = nullptr;  // Parent RHS constant, nullptr = sel
     uint32_t m_mgIndexLo = 0;  // Merge range
     uint32_t m_mgIndexHi = 0;  // Merge range
+    bool m_mgLane = false;  // Merging lane expressions, not constant or select
+    uint32_t m_mgLaneIndex = 0;  // Left index of first lane assignment
+    std::vector<bool> m_mgLaneSites;  // Per index site of first assignment, true = lane index
 
     // METHODS
 
@@ -70,8 +85,140 @@ class ReloopVisitor final : public VNVisitor {
             = new AstVar{fl, VVarType::STMTTEMP, newvarname, VFlagLogicPacked{}, 32};
         return varp;
     }
+    static AstVar* createLoop(AstNodeAssign* bodyp, AstCFunc* cfuncp, uint32_t indexLo,
+                              uint32_t indexHi) {
+        // Replace bodyp with a loop over indexLo..indexHi around bodyp
+        FileLine* const fl = bodyp->fileline();
+        AstVar* const itp = createVarTemp(fl, cfuncp);
+        AstNode* const initp = new AstAssign{fl, new AstVarRef{fl, itp, VAccess::WRITE},
+                                             new AstConst{fl, indexLo}};
+        AstNodeExpr* const condp = new AstLte{fl, new AstVarRef{fl, itp, VAccess::READ},
+                                              new AstConst{fl, indexHi}};
+        AstNode* const incp = new AstAssign{
+            fl, new AstVarRef{fl, itp, VAccess::WRITE},
+            new AstAdd{fl, new AstConst{fl, 1}, new AstVarRef{fl, itp, VAccess::READ}}};
+        AstWhile* const whilep = new AstWhile{fl, condp, nullptr, incp};
+        initp->addNext(whilep);
+        itp->AstNode::addNext(initp);
+        bodyp->replaceWith(itp);
+        whilep->addStmtsp(bodyp);
+        UINFOTREE(9, initp, "", "new");
+        return itp;
+    }
+    static bool isLaneSite(const AstNode* nodep) {
+        // Constant index select of a variable, that may move with the lane
+        if (!VN_IS(nodep, ArraySel) && !VN_IS(nodep, WordSel)) return false;
+        const AstNodeSel* const selp = VN_AS(nodep, NodeSel);
+        const AstConst* const bitp = VN_CAST(selp->bitp(), Const);
+        return bitp && bitp->width() <= 32 && VN_IS(selp->fromp(), NodeVarRef);
+    }
+    static uint32_t laneSiteIndex(const AstNode* nodep) {
+        return VN_AS(VN_AS(nodep, NodeSel)->bitp(), Const)->toUInt();
+    }
+    static bool laneExprOk(AstNode* nodep, const AstVar* lvarp) {
+        // Expression may be evaluated for lanes in any order
+        for (; nodep; nodep = nodep->nextp()) {
+            if (!nodep->isPure()) return false;
+            const AstNodeVarRef* const refp = VN_CAST(nodep, NodeVarRef);
+            if (refp && refp->varp() == lvarp) return false;
+            if (!laneExprOk(nodep->op1p(), lvarp) || !laneExprOk(nodep->op2p(), lvarp)
+                || !laneExprOk(nodep->op3p(), lvarp) || !laneExprOk(nodep->op4p(), lvarp)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    static bool laneSame(const AstNode* ap, const AstNode* bp, int64_t delta,
+                         std::vector<bool>& sites) {
+        // Return if ap and bp are identical except for lane indices, which in
+        // bp are delta from ap.  Sites records each lane site found in order.
+        for (; ap || bp; ap = ap->nextp(), bp = bp->nextp()) {
+            if (!ap || !bp) return false;
+            if (!ap->isSame(bp)) return false;
+            if (ap->dtypep() && (!bp->dtypep() || !ap->dtypep()->similarDType(bp->dtypep()))) {
+                return false;
+            }
+            if (isLaneSite(ap)) {
+                if (!isLaneSite(bp)) return false;
+                if (!VN_AS(ap, NodeSel)->fromp()->isSame(VN_AS(bp, NodeSel)->fromp())) {
+                    return false;
+                }
+                const int64_t diff = static_cast<int64_t>(laneSiteIndex(bp))
+                                     - static_cast<int64_t>(laneSiteIndex(ap));
+                if (diff != 0 && diff != delta) return false;
+                sites.push_back(diff != 0);
+                continue;
+            }
+            if (!laneSame(ap->op1p(), bp->op1p(), delta, sites)
+                || !laneSame(ap->op2p(), bp->op2p(), delta, sites)
+                || !laneSame(ap->op3p(), bp->op3p(), delta, sites)
+                || !laneSame(ap->op4p(), bp->op4p(), delta, sites)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    static void laneSites(AstNode* nodep, std::vector<AstNodeSel*>& selps) {
+        // Collect lane sites in same order as laneSame
+        for (; nodep; nodep = nodep->nextp()) {
+            if (isLaneSite(nodep)) {
+                selps.push_back(VN_AS(nodep, NodeSel));
+                continue;
+            }
+            laneSites(nodep->op1p(), selps);
+            laneSites(nodep->op2p(), selps);
+            laneSites(nodep->op3p(), selps);
+            laneSites(nodep->op4p(), selps);
+        }
+    }
+    void mergeEndLane() {
+        const uint32_t items = m_mgIndexHi - m_mgIndexLo + 1;
+        if (m_mgAssignps.size() >= 2
+            && items >= static_cast<uint32_t>(v3Global.opt.reloopLimit())) {
+            UINFO(6, "Reloop merging lanes items=" << items << " " << m_mgIndexHi << ":"
+                                                   << m_mgIndexLo << " " << m_mgAssignps[0]);
+            ++m_statReLanes;
+            m_statReLaneItems += items;
+
+            // Transform first assign into for loop body
+            AstNodeAssign* const bodyp = m_mgAssignps.front();
+            UASSERT_OBJ(bodyp->lhsp() == m_mgSelLp, bodyp, "Corrupt queue/state");
+            FileLine* const fl = bodyp->fileline();
+            AstVar* const itp = createLoop(bodyp, m_mgCfuncp, m_mgIndexLo, m_mgIndexHi);
+
+            // Replace left index and lane indices with loop index plus offset
+            std::vector<AstNodeSel*> selps;
+            laneSites(bodyp->rhsp(), selps);
+            UASSERT_OBJ(selps.size() == m_mgLaneSites.size(), bodyp, "Lane sites mismatch");
+            selps.push_back(VN_AS(bodyp->lhsp(), NodeSel));
+            m_mgLaneSites.push_back(true);
+            for (size_t i = 0; i < selps.size(); ++i) {
+                if (!m_mgLaneSites[i]) continue;
+                AstNodeExpr* const bitp = selps[i]->bitp();
+                const int64_t offset = static_cast<int64_t>(laneSiteIndex(selps[i]))
+                                       - static_cast<int64_t>(m_mgLaneIndex);
+                AstNodeExpr* const vrefp = new AstVarRef{fl, itp, VAccess::READ};
+                AstNodeExpr* newp = vrefp;
+                if (offset > 0) {
+                    newp = new AstAdd{fl, vrefp, new AstConst{fl, static_cast<uint32_t>(offset)}};
+                } else if (offset < 0) {
+                    newp
+                        = new AstSub{fl, vrefp, new AstConst{fl, static_cast<uint32_t>(-offset)}};
+                }
+                bitp->replaceWith(newp);
+                VL_DO_DANGLING(bitp->deleteTree(), bitp);
+            }
+
+            // Remove remaining assigns
+            for (AstNodeAssign* assp : m_mgAssignps) {
+                if (assp != bodyp) VL_DO_DANGLING(assp->unlinkFrBack()->deleteTree(), assp);
+            }
+        }
+    }
     void mergeEnd() {
-        if (!m_mgAssignps.empty()) {
+        if (!m_mgAssignps.empty() && m_mgLane) {
+            mergeEndLane();
+        } else if (!m_mgAssignps.empty()) {
             const uint32_t items = m_mgIndexHi - m_mgIndexLo + 1;
             UINFO(9, "End merge iter=" << items << " " << m_mgIndexHi << ":" << m_mgIndexLo << " "
                                        << m_mgOffset << " " << m_mgAssignps[0]);
@@ -86,7 +233,6 @@ class ReloopVisitor final : public VNVisitor {
                 AstNodeAssign* const bodyp = m_mgAssignps.front();
                 UASSERT_OBJ(bodyp->lhsp() == m_mgSelLp, bodyp, "Corrupt queue/state");
                 FileLine* const fl = bodyp->fileline();
-                AstVar* const itp = createVarTemp(fl, m_mgCfuncp);
 
                 if (m_mgOffset > 0) {
                     UASSERT_OBJ(m_mgIndexLo >= m_mgOffset, bodyp,
@@ -95,18 +241,7 @@ class ReloopVisitor final : public VNVisitor {
                     m_mgIndexHi -= m_mgOffset;
                 }
 
-                AstNode* const initp = new AstAssign{fl, new AstVarRef{fl, itp, VAccess::WRITE},
-                                                     new AstConst{fl, m_mgIndexLo}};
-                AstNodeExpr* const condp = new AstLte{fl, new AstVarRef{fl, itp, VAccess::READ},
-                                                      new AstConst{fl, m_mgIndexHi}};
-                AstNode* const incp = new AstAssign{
-                    fl, new AstVarRef{fl, itp, VAccess::WRITE},
-                    new AstAdd{fl, new AstConst{fl, 1}, new AstVarRef{fl, itp, VAccess::READ}}};
-                AstWhile* const whilep = new AstWhile{fl, condp, nullptr, incp};
-                initp->addNext(whilep);
-                itp->AstNode::addNext(initp);
-                bodyp->replaceWith(itp);
-                whilep->addStmtsp(bodyp);
+                AstVar* const itp = createLoop(bodyp, m_mgCfuncp, m_mgIndexLo, m_mgIndexHi);
 
                 // Replace constant index with new loop index
                 AstNodeExpr* const offsetp
@@ -121,8 +256,6 @@ class ReloopVisitor final : public VNVisitor {
                     rbitp->replaceWith(m_mgOffset < 0 ? new AstAdd{fl, rvrefp, offsetp} : rvrefp);
                     VL_DO_DANGLING(rbitp->deleteTree(), lbitp);
                 }
-                UINFOTREE(9, initp, "", "new");
-                UINFOTREE(9, whilep, "", "new");
 
                 // Remove remaining assigns
                 for (AstNodeAssign* assp : m_mgAssignps) {
@@ -131,6 +264,8 @@ class ReloopVisitor final : public VNVisitor {
                     }
                 }
             }
+        }
+        if (!m_mgAssignps.empty()) {
             // Setup for next merge
             m_mgAssignps.clear();
             m_mgSelLp = nullptr;
@@ -139,8 +274,50 @@ class ReloopVisitor final : public VNVisitor {
             m_mgVarrefRp = nullptr;
             m_mgOffset = 0;
             m_mgConstRp = nullptr;
+            m_mgLane = false;
+            m_mgLaneSites.clear();
         }
     }
+    void visitLane(AstNodeAssign* nodep, AstNodeSel* lselp, const AstNodeVarRef* lvarrefp,
+                   uint32_t lindex) {
+        // Assignment of an expression which may differ only in lane indices
+        if (m_mgSelLp && m_mgLane  // Old lane merge
+            && m_mgCfuncp == m_cfuncp  // In same function
+            && m_mgNextp == nodep  // Consecutive node
+            && m_mgVarrefLp->isSame(lvarrefp)  // Same array on left hand side
+            && (lindex == m_mgIndexLo - 1 || lindex == m_mgIndexHi + 1)) {  // Left index +/- 1
+            std::vector<bool> sites;
+            const int64_t delta = static_cast<int64_t>(lindex) - m_mgLaneIndex;
+            if (laneSame(m_mgAssignps.front()->rhsp(), nodep->rhsp(), delta, sites)
+                && (m_mgAssignps.size() == 1 || sites == m_mgLaneSites)) {
+                if (lindex == m_mgIndexLo - 1) {
+                    m_mgIndexLo = lindex;
+                } else {
+                    m_mgIndexHi = lindex;
+                }
+                UINFO(9, "Continue lane merge i=" << lindex << " " << m_mgIndexHi << ":"
+                                                  << m_mgIndexLo << " " << nodep);
+                if (m_mgAssignps.size() == 1) m_mgLaneSites = sites;
+                m_mgAssignps.push_back(nodep);
+                m_mgNextp = nodep->nextp();
+                return;
+            }
+        }
+        mergeEnd();
+        if (!laneExprOk(nodep->rhsp(), lvarrefp->varp())) return;
+
+        // Lane merge start
+        m_mgAssignps.push_back(nodep);
+        m_mgCfuncp = m_cfuncp;
+        m_mgNextp = nodep->nextp();
+        m_mgSelLp = lselp;
+        m_mgVarrefLp = lvarrefp;
+        m_mgLane = true;
+        m_mgLaneIndex = lindex;
+        m_mgIndexLo = lindex;
+        m_mgIndexHi = lindex;
+        UINFO(9, "Start lane merge i=" << lindex << " " << nodep);
+    }
 
     // VISITORS
     void visit(AstCFunc* nodep) override {
@@ -186,17 +363,18 @@ class ReloopVisitor final : public VNVisitor {
             const AstConst* const rbitp = VN_CAST(rselp->bitp(), Const);
             rvarrefp = VN_CAST(rselp->fromp(), NodeVarRef);
             if (!rbitp || !rvarrefp || lvarrefp->varp() == rvarrefp->varp()) {
-                mergeEnd();
+                visitLane(nodep, lselp, lvarrefp, lindex);
                 return;
             }
             rindex = rbitp->toUInt();
         } else {
-            mergeEnd();
+            visitLane(nodep, lselp, lvarrefp, lindex);
             return;
         }
 
         if (m_mgSelLp) {  // Old merge
-            if (m_mgCfuncp == m_cfuncp  // In same function
+            if (!m_mgLane  // Not a lane merge
+                && m_mgCfuncp == m_cfuncp  // In same function
                 && m_mgNextp == nodep  // Consecutive node
                 && m_mgVarrefLp->isSame(lvarrefp)  // Same array on left hand side
                 && (m_mgConstRp  // On the right hand side either ...
@@ -251,6 +429,8 @@ public:
     ~ReloopVisitor() override {
         V3Stats::addStat("Optimizations, Reloops", m_statReloops);
         V3Stats::addStat("Optimizations, Reloop iterations", m_statReItems);
+        V3Stats::addStat("Optimizations, Reloop lanes", m_statReLanes);
+        V3Stats::addStat("Optimizations, Reloop lane iterations", m_statReLaneItems);
     }
 };
 
@@ -41,6 +41,7 @@
 
 #include "V3EmitCBase.h"
 #include "V3EmitV.h"
+#include "V3InstrCount.h"
 #include "V3Order.h"
 #include "V3SenExprBuilder.h"
 #include "V3Stats.h"
@@ -109,9 +110,9 @@ AstSenTree* findTriggeredIface(const AstVarScope* vscp,
                                const VirtIfaceTriggers::IfaceMemberSensMap& vifMemberTriggered) {
     const auto ifaceIt = vifTrigged.find(vscp->varp()->sensIfacep());
     if (ifaceIt != vifTrigged.end()) return ifaceIt->second;
-    for (const auto& memberIt : vifMemberTriggered) {
-        if (memberIt.first.m_ifacep == vscp->varp()->sensIfacep()) { return memberIt.second; }
-    }
+    // Only the trigger of this member, so writes to other members don't wake this logic
+    const auto memberIt = vifMemberTriggered.find({vscp->varp()->sensIfacep(), vscp->varp()});
+    if (memberIt != vifMemberTriggered.end()) return memberIt->second;
     return nullptr;
 }
 
@@ -178,6 +179,30 @@ AstNodeStmt* profExecSectionPop(FileLine* flp) {
     return new AstCStmt{flp, "VL_EXEC_TRACE_ADD_RECORD(vlSymsp).sectionPop();\n"};
 }
 
+// Return the VerilatedPerfStats region counting the eval loop with the given tag for
+// --perf-stats, or empty if not counted
+string perfStatsRegion(const string& tag) {
+    if (!v3Global.opt.perfStats()) return "";
+    if (tag == "ico") return "VerilatedPerfStats::REGION_ICO";
+    if (tag == "act") return "VerilatedPerfStats::REGION_ACT";
+    if (tag == "nba") return "VerilatedPerfStats::REGION_NBA";
+    if (tag == "obs") return "VerilatedPerfStats::REGION_OBS";
+    if (tag == "react") return "VerilatedPerfStats::REGION_REACT";
+    return "";  // 'stl' runs once, during initialization
+}
+
+// Create a variable holding the --perf-stats start time, and the statement setting it
+AstVarScope* perfStatsStartVar(AstScope* scopep, const string& name, AstNodeStmt*& stmtsp) {
+    FileLine* const flp = scopep->fileline();
+    AstVarScope* const vscp = scopep->createTemp(name, 64);
+    vscp->varp()->noReset(true);
+    AstCExpr* const nowp = new AstCExpr{flp, "VerilatedPerfCounters::nowNs()", 64};
+    nowp->pure(false);
+    stmtsp = AstNode::addNext(
+        stmtsp, new AstAssign{flp, new AstVarRef{flp, vscp, VAccess::WRITE}, nowp});
+    return vscp;
+}
+
 struct EvalLoop final {
     // Flag set to true during the first iteration of the loop
     AstVarScope* firstIterp;
@@ -249,6 +274,12 @@ EvalLoop createEvalLoop(
         return vscp;
     };
 
+    // The --perf-stats loop start time
+    const string perfRegion = perfStatsRegion(tag);
+    AstVarScope* const perfStartp
+        = perfRegion.empty() ? nullptr
+                             : perfStatsStartVar(scopeTopp, "__V" + tag + "PerfStart", stmtps);
+
     // The iteration counter
     AstVarScope* const counterp = addVar("IterCount", 32, 0);
     // The first iteration flag
@@ -278,6 +309,10 @@ EvalLoop createEvalLoop(
         callp->dtypeSetBit();
         AstIf* const ifp = new AstIf{flp, callp};
         ifp->addThensp(setVar(continueFlagp, 1));
+        if (perfStartp) {
+            const string callText = "vlSymsp->_vm_contextp__->perfCounters().regionTriggered(";
+            ifp->addThensp(new AstCStmt{flp, callText + perfRegion + ");\n"});
+        }
         loopp->addStmtsp(ifp);
 
         // Clear the first iteration flag
@@ -286,6 +321,18 @@ EvalLoop createEvalLoop(
         stmtps->addNext(loopp);
     }
 
+    // Count the loop in the --perf-stats counters
+    if (perfStartp) {
+        AstTextBlock* const blockp = new AstTextBlock{flp};
+        blockp->addText(flp, "vlSymsp->_vm_contextp__->perfCounters().regionDone(", true);
+        blockp->addText(flp, perfRegion + ", ", true);
+        blockp->addNodesp(new AstVarRef{flp, counterp, VAccess::READ});
+        blockp->addText(flp, ", ", true);
+        blockp->addNodesp(new AstVarRef{flp, perfStartp, VAccess::READ});
+        blockp->addText(flp, ");\n", true);
+        stmtps->addNext(new AstCStmt{flp, blockp});
+    }
+
     // Prof-exec section pop
     if (v3Global.opt.profExec()) stmtps->addNext(profExecSectionPop(flp));
 
@@ -405,6 +452,108 @@ LogicClasses gatherLogicClasses(AstNetlist* netlistp) {
     return result;
 }
 
+//============================================================================
+// Decide if the ico or act region should be ordered in parallel, which is only worth it if
+// there is enough logic in the region to amortize dispatching the threads
+
+bool isParallelRegion(const std::vector<V3Sched::LogicByScope*>& logic) {
+    if (!v3Global.opt.mtasks()) return false;
+    const uint64_t minCost = v3Global.opt.threadsRegionMinCost();
+    uint64_t cost = 0;
+    for (const LogicByScope* const lbsp : logic) {
+        for (const auto& pair : *lbsp) {
+            if (cost >= minCost) return true;
+            cost += V3InstrCount::count(pair.second, false);
+        }
+    }
+    return cost >= minCost;
+}
+
+//============================================================================
+// Clock domain analysis for --stats. Counts the clock domains of the design, and the clusters
+// of domains that communicate only through registered crossings (e.g. CDC synchronizers), which
+// are the domains that could be evaluated independently between crossings.
+
+void reportClockDomains(const std::vector<const LogicByScope*>& regions) {
+    // Union-find forest over logic, with one node per clock domain and per combinational block
+    std::vector<size_t> parents;
+    const auto newNode = [&]() {
+        parents.push_back(parents.size());
+        return parents.size() - 1;
+    };
+    const auto findRoot = [&](size_t i) {
+        while (parents[i] != i) i = parents[i] = parents[parents[i]];
+        return i;
+    };
+    const auto merge = [&](size_t a, size_t b) { parents[findRoot(a)] = findRoot(b); };
+
+    // Logic writing and reading each variable, as (node, isClocked) pairs
+    struct Accesses final {
+        std::vector<std::pair<size_t, bool>> m_writers;
+        std::vector<std::pair<size_t, bool>> m_readers;
+    };
+    std::unordered_map<const AstVarScope*, Accesses> accesses;
+    std::unordered_map<const AstSenTree*, size_t> domains;  // Clocked sensitivity -> node
+    for (const LogicByScope* const lbsp : regions) {
+        for (const auto& pair : *lbsp) {
+            AstActive* const activep = pair.second;
+            const bool clocked = activep->sensesp()->hasClocked();
+            size_t domain = 0;
+            if (clocked) {
+                const auto it = domains.emplace(activep->sensesp(), 0);
+                if (it.second) it.first->second = newNode();
+                domain = it.first->second;
+            }
+            for (AstNode* nodep = activep->stmtsp(); nodep; nodep = nodep->nextp()) {
+                const size_t node = clocked ? domain : newNode();
+                nodep->foreach([&](const AstVarRef* refp) {
+                    Accesses& varAccesses = accesses[refp->varScopep()];
+                    if (refp->access().isWriteOrRW()) {
+                        varAccesses.m_writers.emplace_back(node, clocked);
+                    }
+                    if (refp->access().isReadOrRW()) {
+                        varAccesses.m_readers.emplace_back(node, clocked);
+                    }
+                });
+            }
+        }
+    }
+
+    // Combinational logic joins the domains it connects, registered crossings do not
+    for (const auto& it : accesses) {
+        const Accesses& varAccesses = it.second;
+        if (varAccesses.m_writers.empty()) continue;
+        const size_t writer = varAccesses.m_writers.front().first;
+        bool combWritten = false;
+        for (const auto& pair : varAccesses.m_writers) {
+            merge(pair.first, writer);
+            combWritten |= !pair.second;
+        }
+        for (const auto& pair : varAccesses.m_readers) {
+            if (combWritten || !pair.second) merge(pair.first, writer);
+        }
+    }
+
+    std::unordered_set<size_t> clusters;
+    for (const auto& it : domains) clusters.emplace(findRoot(it.second));
+    size_t crossings = 0;
+    for (const auto& it : accesses) {
+        const Accesses& varAccesses = it.second;
+        if (varAccesses.m_writers.empty()) continue;
+        const size_t cluster = findRoot(varAccesses.m_writers.front().first);
+        for (const auto& pair : varAccesses.m_readers) {
+            if (findRoot(pair.first) != cluster) {
+                ++crossings;
+                break;
+            }
+        }
+    }
+
+    V3Stats::addStat("Scheduling, clock domains", domains.size());
+    V3Stats::addStat("Scheduling, clock domain clusters", clusters.size());
+    V3Stats::addStat("Scheduling, clock domain crossing variables", crossings);
+}
+
 //============================================================================
 // Simple ordering in source order
 
@@ -973,7 +1122,7 @@ AstNode* createInputCombLoop(AstNetlist* netlistp, AstCFunc* const initFuncp,
 
     // Create and Order the body function
     AstCFunc* const icoFuncp
-        = V3Order::order(netlistp, {&logic}, trigToSen, "ico", false, false,
+        = V3Order::order(netlistp, {&logic}, trigToSen, "ico", isParallelRegion({&logic}), false,
                          [=](const AstVarScope* vscp, std::vector<AstSenTree*>& out) {
                              AstVar* const varp = vscp->varp();
                              if (varp->isPrimaryInish() || varp->isSigUserRWPublic()) {
@@ -983,7 +1132,7 @@ AstNode* createInputCombLoop(AstNetlist* netlistp, AstCFunc* const initFuncp,
                              if (vscp->varp()->sensIfacep()) {
                                  AstSenTree* ifaceTriggered = findTriggeredIface(
                                      vscp, vifTriggeredIco, vifMemberTriggeredIco);
-                                 out.push_back(ifaceTriggered);
+                                 if (ifaceTriggered) out.push_back(ifaceTriggered);
                              }
                          });
     splitCheck(icoFuncp);
@@ -1174,6 +1323,15 @@ void createEval(AstNetlist* netlistp,  //
 
     if (v3Global.opt.profExec()) funcp->addStmtsp(profExecSectionPush(flp, "eval"));
 
+    // The --perf-stats eval start time
+    AstVarScope* perfStartp = nullptr;
+    if (v3Global.opt.perfStats()) {
+        AstNodeStmt* stmtsp = nullptr;
+        perfStartp = perfStatsStartVar(netlistp->topScopep()->scopep(), "__VevalPerfStart",
+                                       stmtsp);
+        funcp->addStmtsp(stmtsp);
+    }
+
     // Start with the ico loop, if any
     if (icoLoop) funcp->addStmtsp(icoLoop);
 
@@ -1183,6 +1341,15 @@ void createEval(AstNetlist* netlistp,  //
     // Add the Postponed eval call
     if (postponedFuncp) funcp->addStmtsp(callVoidFunc(postponedFuncp));
 
+    // Count the evaluation in the --perf-stats counters
+    if (perfStartp) {
+        AstTextBlock* const blockp = new AstTextBlock{flp};
+        blockp->addText(flp, "vlSymsp->_vm_contextp__->perfCounters().evalDone(", true);
+        blockp->addNodesp(new AstVarRef{flp, perfStartp, VAccess::READ});
+        blockp->addText(flp, ");\n", true);
+        funcp->addStmtsp(new AstCStmt{flp, blockp});
+    }
+
     if (v3Global.opt.profExec()) funcp->addStmtsp(profExecSectionPop(flp));
 }
 
@@ -1224,6 +1391,11 @@ void schedule(AstNetlist* netlistp) {
         lbs.foreachLogic([&](AstNode* nodep) { size += nodep->nodeCount(); });
         V3Stats::addStat("Scheduling, " + name, size);
     };
+    const auto addInstrStat = [](const string& name, const LogicByScope& lbs) {
+        uint64_t instrs = 0;
+        lbs.foreachLogic([&](AstNode* nodep) { instrs += V3InstrCount::count(nodep, false); });
+        V3Stats::addStat("Scheduling, " + name, instrs);
+    };
 
     // Step 0. Prepare external domains for timing and virtual interfaces
     // Create extra triggers for virtual interfaces
@@ -1284,6 +1456,7 @@ void schedule(AstNetlist* netlistp) {
         addSizeStat("size of region: NBA", logicRegions.m_nba);
         addSizeStat("size of region: Observed", logicRegions.m_obs);
         addSizeStat("size of region: Reactive", logicRegions.m_react);
+        reportClockDomains({&logicRegions.m_pre, &logicRegions.m_act, &logicRegions.m_nba});
         V3Stats::statsStage("sched-partition");
     }
 
@@ -1295,6 +1468,11 @@ void schedule(AstNetlist* netlistp) {
         addSizeStat("size of replicated logic: NBA", logicReplicas.m_nba);
         addSizeStat("size of replicated logic: Observed", logicReplicas.m_obs);
         addSizeStat("size of replicated logic: Reactive", logicReplicas.m_react);
+        addInstrStat("instrs of replicated logic: Input", logicReplicas.m_ico);
+        addInstrStat("instrs of replicated logic: Active", logicReplicas.m_act);
+        addInstrStat("instrs of replicated logic: NBA", logicReplicas.m_nba);
+        addInstrStat("instrs of replicated logic: Observed", logicReplicas.m_obs);
+        addInstrStat("instrs of replicated logic: Reactive", logicReplicas.m_react);
         V3Stats::statsStage("sched-replicate");
     }
 
@@ -1388,16 +1566,18 @@ void schedule(AstNetlist* netlistp) {
     const auto& vifMemberTriggeredAct
         = virtIfaceTriggers.makeMemberToSensMap(netlistp, firstVifTriggerIndex, actTrig.m_vscp);
 
+    const std::vector<V3Sched::LogicByScope*> actLogic{
+        &logicRegions.m_pre, &logicRegions.m_act, &logicReplicas.m_act};
     AstCFunc* const actFuncp = V3Order::order(
-        netlistp, {&logicRegions.m_pre, &logicRegions.m_act, &logicReplicas.m_act}, trigToSenAct,
-        "act", false, false, [&](const AstVarScope* vscp, std::vector<AstSenTree*>& out) {
+        netlistp, actLogic, trigToSenAct, "act", isParallelRegion(actLogic), false,
+        [&](const AstVarScope* vscp, std::vector<AstSenTree*>& out) {
             auto it = actTimingDomains.find(vscp);
             if (it != actTimingDomains.end()) out = it->second;
             if (vscp->varp()->isWrittenByDpi()) out.push_back(dpiExportTriggeredAct);
             if (vscp->varp()->sensIfacep()) {
                 AstSenTree* ifaceTriggered
                     = findTriggeredIface(vscp, vifTriggeredAct, vifMemberTriggeredAct);
-                out.push_back(ifaceTriggered);
+                if (ifaceTriggered) out.push_back(ifaceTriggered);
             }
         });
     splitCheck(actFuncp);
@@ -1438,7 +1618,7 @@ void schedule(AstNetlist* netlistp) {
                 if (vscp->varp()->sensIfacep()) {
                     AstSenTree* ifaceTriggered
                         = findTriggeredIface(vscp, vifTriggered, vifMemberTriggered);
-                    out.push_back(ifaceTriggered);
+                    if (ifaceTriggered) out.push_back(ifaceTriggered);
                 }
             });
 
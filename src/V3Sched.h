@@ -23,6 +23,7 @@
 #include "V3Ast.h"
 
 #include <functional>
+#include <map>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -178,19 +179,18 @@ public:
     using IfaceSensMap = std::map<const AstIface*, AstSenTree*>;
 
     IfaceMemberTriggerVec m_memberTriggers;
+    std::map<IfaceMember, AstVarScope*> m_memberTriggerIndex;  // Lookup into m_memberTriggers
     IfaceTriggerVec m_ifaceTriggers;
 
     void addMemberTrigger(const AstIface* ifacep, const AstVar* memberVarp,
                           AstVarScope* triggerVscp) {
         m_memberTriggers.emplace_back(IfaceMember(ifacep, memberVarp), triggerVscp);
+        m_memberTriggerIndex.emplace(IfaceMember(ifacep, memberVarp), triggerVscp);
     }
 
     AstVarScope* findMemberTrigger(const AstIface* ifacep, const AstVar* memberVarp) const {
-        IfaceMember target{ifacep, memberVarp};
-        for (const auto& pair : m_memberTriggers) {
-            if (!(pair.first < target) && !(target < pair.first)) return pair.second;
-        }
-        return nullptr;
+        const auto it = m_memberTriggerIndex.find({ifacep, memberVarp});
+        return it == m_memberTriggerIndex.end() ? nullptr : it->second;
     }
 
     IfaceMemberSensMap makeMemberToSensMap(AstNetlist* netlistp, size_t vifTriggerIndex,
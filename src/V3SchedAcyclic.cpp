@@ -43,6 +43,7 @@
 
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -227,6 +228,71 @@ std::vector<SchedAcyclicVarVertex*> findCutVertices(Graph* graphp) {
     return result;
 }
 
+// The cuts made by V3Graph::acyclic form a feedback arc set, which is often not minimal in
+// terms of variables. Each cut variable makes all logic reading it hybrid logic, which is
+// re-evaluated when the variable changes, costing extra iterations of the combinational
+// loop. Remove cut variables not needed to break all cycles given the remaining cuts.
+// Widest variables are tried first, as they are the most expensive to trigger on.
+std::vector<SchedAcyclicVarVertex*>
+removeRedundantCuts(Graph* graphp, const std::vector<SchedAcyclicVarVertex*>& cutVertices) {
+    // Only remove cuts while the total work is bounded by this multiple of the graph size
+    constexpr size_t WORK_FACTOR = 64;
+    size_t edges = 0;
+    for (const V3GraphVertex& vtx : graphp->vertices()) edges += vtx.outEdges().size();
+    size_t budget = WORK_FACTOR * (edges + 1);
+
+    std::vector<SchedAcyclicVarVertex*> candidates{cutVertices};
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const SchedAcyclicVarVertex* ap, const SchedAcyclicVarVertex* bp) {
+                         return ap->vscp()->width() > bp->vscp()->width();
+                     });
+
+    // V3GraphVertex::user() -> generation number of last visit
+    graphp->userClearVertices();
+    std::unordered_set<const V3GraphVertex*> cuts{cutVertices.begin(), cutVertices.end()};
+    std::vector<V3GraphVertex*> stack;
+    uint64_t generation = 0;
+
+    // Is there a cycle through 'vvtxp', assuming it is not cut?
+    const auto onCycle = [&](SchedAcyclicVarVertex* vvtxp) {
+        ++generation;
+        stack.clear();
+        stack.push_back(vvtxp);
+        while (!stack.empty()) {
+            V3GraphVertex* const vtxp = stack.back();
+            stack.pop_back();
+            // Logic reading a cut variable does not depend on it after fixCuts
+            if (vtxp != vvtxp && cuts.count(vtxp)) continue;
+            for (V3GraphEdge& edge : vtxp->outEdges()) {
+                --budget;
+                V3GraphVertex* const top = edge.top();
+                if (top == vvtxp) return true;
+                if (top->user() == generation) continue;
+                top->user(generation);
+                stack.push_back(top);
+            }
+        }
+        return false;
+    };
+
+    size_t removed = 0;
+    for (SchedAcyclicVarVertex* const vvtxp : candidates) {
+        if (budget < edges) break;
+        if (onCycle(vvtxp)) continue;
+        cuts.erase(vvtxp);
+        ++removed;
+    }
+    graphp->userClearVertices();
+
+    std::vector<SchedAcyclicVarVertex*> result;
+    for (SchedAcyclicVarVertex* const vvtxp : cutVertices) {
+        if (cuts.count(vvtxp)) result.push_back(vvtxp);
+    }
+    V3Stats::addStat("Scheduling, acyclic, redundant cuts removed", removed);
+    V3Stats::addStat("Scheduling, acyclic, cut variables", result.size());
+    return result;
+}
+
 void resetEdgeWeights(const std::vector<SchedAcyclicVarVertex*>& cutVertices) {
     for (SchedAcyclicVarVertex* const vvtxp : cutVertices) {
         for (V3GraphEdge& e : vvtxp->inEdges()) e.weight(1);
@@ -434,8 +500,9 @@ LogicByScope breakCycles(AstNetlist* netlistp, const LogicByScope& combinational
     // Report warnings/diagnostics
     reportCycles(graphp.get(), cutVertices);
 
-    // Fix cuts by converting dependent logic to use hybrid sensitivities
-    return fixCuts(netlistp, cutVertices);
+    // Fix cuts by converting dependent logic to use hybrid sensitivities, but only for the
+    // cuts needed to break all cycles
+    return fixCuts(netlistp, removeRedundantCuts(graphp.get(), cutVertices));
 }
 
 }  // namespace V3Sched
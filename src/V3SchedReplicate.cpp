@@ -30,6 +30,10 @@
 // information through it. We then replicate any logic into its additional
 // driving regions.
 //
+// Large replicated procedures are marked to be emitted into functions on
+// their own by V3Order. The replicas then yield identical functions, which
+// V3Combine merges, so the code of each such procedure is only kept once.
+//
 // For more details, please see the internals documentation.
 //
 //*************************************************************************
@@ -38,6 +42,7 @@
 
 #include "V3Graph.h"
 #include "V3Sched.h"
+#include "V3Stats.h"
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -55,6 +60,9 @@ enum RegionFlags : uint8_t {
     REACTIVE = 0x10,  // Variable/logic is driven from 're' region logic
 };
 
+// Replicated procedures at least this big (in nodes) are emitted into functions on their own
+constexpr int SHARE_MIN_NODES = 100;
+
 //##############################################################################
 // Data structures (graph types)
 
@@ -271,6 +279,7 @@ void propagateDrivingRegions(SchedReplicateVertex* vtxp) {
 
 LogicReplicas replicate(Graph* graphp) {
     LogicReplicas result;
+    size_t shared = 0;
     for (V3GraphVertex& vtx : graphp->vertices()) {
         if (SchedReplicateLogicVertex* const lvtxp = vtx.cast<SchedReplicateLogicVertex>()) {
             const auto replicateTo = [&](LogicByScope& lbs) {
@@ -279,6 +288,13 @@ LogicReplicas replicate(Graph* graphp) {
             const uint8_t targetRegions = lvtxp->drivingRegions() & ~lvtxp->assignedRegion();
             UASSERT(!lvtxp->senTreep()->hasClocked() || targetRegions == 0,
                     "replicating clocked logic");
+            // Mark before cloning, so the original and all replicas are marked
+            AstNodeProcedure* const procp = VN_CAST(lvtxp->logicp(), NodeProcedure);
+            if (targetRegions && procp && !procp->isSuspendable()
+                && procp->nodeCount() >= SHARE_MIN_NODES) {
+                procp->setOwnFunction();
+                ++shared;
+            }
             if (targetRegions & INPUT) replicateTo(result.m_ico);
             if (targetRegions & ACTIVE) replicateTo(result.m_act);
             if (targetRegions & NBA) replicateTo(result.m_nba);
@@ -286,6 +302,7 @@ LogicReplicas replicate(Graph* graphp) {
             if (targetRegions & REACTIVE) replicateTo(result.m_react);
         }
     }
+    V3Stats::addStat("Scheduling, replicated procedures in own functions", shared);
     return result;
 }
 
@@ -284,6 +284,7 @@ void transformForks(AstNetlist* const netlistp) {
         bool m_inClass = false;  // Are we in a class?
         bool m_beginHasAwaits = false;  // Does the current begin have awaits?
         bool m_awaitMoved = false;  // Has the current function lost awaits?
+        bool m_forkSpawns = false;  // Does the current fork spawn any processes?
         AstFork* m_forkp = nullptr;  // Current fork
         AstCFunc* m_funcp = nullptr;  // Current function
 
@@ -331,6 +332,50 @@ void transformForks(AstNetlist* const netlistp) {
             });
         }
 
+        // If no branch of a fork..join became a process, all branches finish before the join,
+        // so the fork sync only costs an allocation each time the fork is executed. Remove it.
+        void removeForkSync(AstFork* const forkp) {
+            // V3Timing put the join right after the fork
+            AstStmtExpr* const joinStmtp = VN_CAST(forkp->nextp(), StmtExpr);
+            if (!joinStmtp) return;
+            const AstCAwait* const awaitp = VN_CAST(joinStmtp->exprp(), CAwait);
+            if (!awaitp) return;
+            const AstCMethodHard* const joinp = VN_CAST(awaitp->exprp(), CMethodHard);
+            if (!joinp || joinp->name() != "join") return;
+            const AstVarRef* const joinRefp = VN_CAST(joinp->fromp(), VarRef);
+            if (!joinRefp || !joinRefp->varp()->isFuncLocal()) return;
+            AstVarScope* const syncVscp = joinRefp->varScopep();
+            // A jump out of a branch would skip its done(), so leave the join as is
+            if (forkp->exists([](const AstJumpGo*) { return true; })) return;
+            const auto syncStmtp = [&](const AstCMethodHard* methodp,
+                                       const char* name) -> AstStmtExpr* {
+                const AstVarRef* const refp = VN_CAST(methodp->fromp(), VarRef);
+                if (methodp->name() != name || !refp || refp->varScopep() != syncVscp) {
+                    return nullptr;
+                }
+                return VN_CAST(methodp->backp(), StmtExpr);
+            };
+            std::vector<AstStmtExpr*> stmtps{joinStmtp};
+            forkp->foreach([&](const AstCMethodHard* methodp) {
+                if (AstStmtExpr* const stmtp = syncStmtp(methodp, "done")) stmtps.push_back(stmtp);
+            });
+            m_funcp->foreach([&](const AstCMethodHard* methodp) {
+                if (AstStmtExpr* const stmtp = syncStmtp(methodp, "init")) stmtps.push_back(stmtp);
+            });
+            // Every reference must be one of the above, else the sync has other users
+            size_t refs = 0;
+            m_funcp->foreach([&](const AstVarRef* refp) {
+                if (refp->varScopep() == syncVscp) ++refs;
+            });
+            if (refs != stmtps.size() || stmtps.size() < 2) return;
+            UINFO(4, "Removing fork sync of " << forkp);
+            for (AstStmtExpr* const stmtp : stmtps) pushDeletep(stmtp->unlinkFrBack());
+            AstVar* const syncVarp = syncVscp->varp();
+            pushDeletep(syncVscp->unlinkFrBack());
+            pushDeletep(syncVarp->unlinkFrBack());
+            m_awaitMoved = true;
+        }
+
         // VISITORS
         void visit(AstNodeModule* nodep) override {
             VL_RESTORER(m_inClass);
@@ -355,8 +400,11 @@ void transformForks(AstNetlist* const netlistp) {
         void visit(AstFork* nodep) override {
             if (m_forkp) return;  // Handle forks in forks after moving them to new functions
             VL_RESTORER(m_forkp);
+            VL_RESTORER(m_forkSpawns);
             m_forkp = nodep;
+            m_forkSpawns = false;
             iterateChildrenConst(nodep);  // Const, so we don't iterate the calls twice
+            if (!m_forkSpawns && !nodep->joinType().joinNone()) removeForkSync(nodep);
             // Replace self with the function calls (no co_await, as we don't want the main
             // process to suspend whenever any of the children do)
             // V3Dead could have removed all statements from the fork, so guard against it
@@ -373,6 +421,7 @@ void transformForks(AstNetlist* const netlistp) {
                 nodep->unlinkFrBack();
             } else if (m_beginHasAwaits || nodep->needProcess()) {
                 UASSERT_OBJ(!nodep->name().empty(), nodep, "Begin needs a name");
+                m_forkSpawns = true;
                 // Create a function to put this begin's statements in
                 FileLine* const flp = nodep->fileline();
                 AstCFunc* const newfuncp = new AstCFunc{
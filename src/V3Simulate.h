@@ -42,6 +42,7 @@
 #include "V3Width.h"
 
 #include <deque>
+#include <map>
 #include <sstream>
 #include <stack>
 #include <string>
@@ -142,6 +143,9 @@ private:
     std::unordered_map<const AstNodeDType*, ConstAllocator> m_constps;
     size_t m_constGeneration = 0;
     std::vector<SimStackNode*> m_callStack;  ///< Call stack for verbose error messages
+    // Constant function results, by argument values, for pure functions
+    std::unordered_map<const AstNodeFTask*, std::map<std::string, V3Number>> m_funcMemo;
+    std::unordered_map<const AstNodeFTask*, bool> m_funcPure;  ///< Cached isPureFunc result
 
     // Cleanup
     // V3Numbers that represents strings are a bit special and the API for
@@ -351,6 +355,37 @@ private:
         m_varAux(nodep).outValuep = valuep;
     }
 
+    bool isPureFunc(const AstNodeFTask* funcp) {
+        // True if the function's result depends only on its arguments and parameters,
+        // so calls with the same argument values may share one evaluation
+        const auto pair = m_funcPure.emplace(funcp, true);
+        if (!pair.second) return pair.first->second;
+        const bool pure = funcp->forall([this](const AstNode* nodep) {
+            if (VN_IS(nodep, Display) || VN_IS(nodep, Stop) || VN_IS(nodep, Finish)) return false;
+            if (const AstNodeFTaskRef* const refp = VN_CAST(nodep, NodeFTaskRef)) {
+                return refp->taskp() && isPureFunc(refp->taskp());
+            }
+            return true;
+        });
+        m_funcPure[funcp] = pure;
+        return pure;
+    }
+    // Memoization key of the call's argument values, empty if not memoizable
+    string funcMemoKey(const V3TaskConnects& tconnects) {
+        string key;
+        for (const auto& it : tconnects) {
+            AstNode* const pinp = it.second->exprp();
+            if (!pinp) {
+                key += ";";
+                continue;
+            }
+            const AstConst* const constp = fetchConstNull(pinp);
+            if (!constp) return "";
+            key += constp->num().ascii() + ";";
+        }
+        return key;
+    }
+
     void checkNodeInfo(AstNode* nodep, bool ignorePredict = false) {
         if (m_checkOnly) {
             m_instrCount += nodep->instrCount();
@@ -1136,6 +1171,19 @@ private:
                 iterateConst(pinp);
             }
         }
+        // Reuse the result of an earlier call with the same arguments
+        string memoKey;
+        if (!m_checkOnly && optimizable() && VN_IS(funcp, Func) && isPureFunc(funcp)) {
+            memoKey = funcMemoKey(tconnects);
+            if (!memoKey.empty()) {
+                const auto& memo = m_funcMemo[funcp];
+                const auto it = memo.find(memoKey);
+                if (it != memo.end()) {
+                    newConst(nodep)->num().opAssign(it->second);
+                    return;
+                }
+            }
+        }
         for (V3TaskConnects::iterator it = tconnects.begin(); it != tconnects.end(); ++it) {
             AstVar* const portp = it->first;
             AstNode* const pinp = it->second->exprp();
@@ -1165,6 +1213,11 @@ private:
             // Grab return value from output variable (if it's a function)
             UASSERT_OBJ(funcp->fvarp(), nodep, "Function reference points at non-function");
             newValue(nodep, fetchValue(funcp->fvarp()));
+            if (!memoKey.empty()) {
+                if (const AstConst* const constp = fetchConstNull(nodep)) {
+                    m_funcMemo[funcp].emplace(memoKey, constp->num());
+                }
+            }
         }
     }
 
@@ -1322,6 +1375,8 @@ public:
         AstNode::user1ClearTree();
         m_varAux.clear();
         ++m_constGeneration;
+        m_funcMemo.clear();
+        m_funcPure.clear();
     }
     void mainTableCheck(AstNode* nodep) {
         setMode(true /*scoped*/, true /*checking*/, false /*params*/);
@@ -0,0 +1,192 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Content hashing for --skip-identical-content
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3SourceHash's Transformations:
+//
+// Each parsed file is hashed after preprocessing, so comments, disabled
+// `ifdefs, and macro definitions that do not change the expanded text do
+// not change the hash.  Compiler directives such as `timescale carry into
+// later files, so each file's hash also covers the directives of all
+// earlier files.
+//
+// After V3LinkCells, the key of the design is the hash of the command line
+// and of each file that is needed.  A file is not needed only if each
+// module it defines is a plain module not instantiated under the top
+// module, and it adds nothing to $unit.  Under --hierarchical, each
+// hierarchical block is a separate run with its own key, so editing a
+// module in one block does not invalidate the other blocks.
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3SourceHash.h"
+
+#include "V3File.h"
+#include "V3Os.h"
+#include "V3String.h"
+
+#include <memory>
+#include <sys/stat.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class V3SourceHashImp final {
+    struct FileEnt final {
+        string m_filename;  // Filename as parsed
+        string m_digest;  // Hash of preceding directives and preprocessed text
+        bool m_hasModule = false;  // Defines any module
+        bool m_needed = false;  // Defines a module that is used, or adds to $unit
+    };
+
+    // MEMBERS
+    std::vector<FileEnt> m_files;  // Files in parse order
+    std::unordered_map<const VFileContent*, size_t> m_contentIndex;  // Index into m_files
+    string m_directives;  // Hash of compiler directives in all files parsed so far
+    string m_key;  // Key of the design, or empty if not computed
+
+    FileEnt* fileEntp(const FileLine* flp) {
+        if (!flp->contentp()) return nullptr;  // Command line or internal node
+        const auto it = m_contentIndex.find(flp->contentp());
+        return it == m_contentIndex.end() ? nullptr : &m_files[it->second];
+    }
+
+    static string directives(const std::deque<string>& ppBuffers) {
+        // Text of each directive left after preprocessing, other than `line.
+        // Backquotes in strings are included, which is only conservative.
+        string out;
+        for (const string& buf : ppBuffers) {
+            for (size_t pos = buf.find('`'); pos != string::npos; pos = buf.find('`', pos + 1)) {
+                if (buf.compare(pos, 6, "`line ") == 0) continue;
+                const size_t eol = buf.find('\n', pos);
+                out += buf.substr(pos, eol == string::npos ? string::npos : eol - pos);
+                out += '\n';
+            }
+        }
+        return out;
+    }
+
+public:
+    void addFile(const VFileContent* contentp, const string& filename,
+                 const std::deque<string>& ppBuffers) {
+        VHashSha256 hash;
+        hash.insert(m_directives);  // State carried in from earlier files
+        for (const string& buf : ppBuffers) hash.insert(buf);
+        const string fileDirectives = directives(ppBuffers);
+        if (!fileDirectives.empty()) {
+            m_directives = VHashSha256{m_directives + fileDirectives}.digestSymbol();
+        }
+        m_contentIndex[contentp] = m_files.size();
+        m_files.emplace_back();
+        m_files.back().m_filename = filename;
+        m_files.back().m_digest = hash.digestSymbol();
+    }
+
+    void computeKey(AstNetlist* rootp, const string& cmdline) {
+        // Roots are the top modules, and all non-plain modules, as packages,
+        // interfaces and classes may be referenced other than by cells
+        std::vector<AstNodeModule*> todo;
+        for (AstNodeModule* modp = rootp->modulesp(); modp;
+             modp = VN_AS(modp->nextp(), NodeModule)) {
+            if (FileEnt* const entp = fileEntp(modp->fileline())) entp->m_hasModule = true;
+            if (!VN_IS(modp, Module) || modp->level() <= 2) todo.push_back(modp);
+        }
+        if (const AstPackage* const unitp = rootp->dollarUnitPkgp()) {
+            for (const AstNode* stmtp = unitp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+                if (FileEnt* const entp = fileEntp(stmtp->fileline())) entp->m_needed = true;
+            }
+        }
+        std::unordered_set<const AstNodeModule*> reached{todo.begin(), todo.end()};
+        while (!todo.empty()) {
+            AstNodeModule* const modp = todo.back();
+            todo.pop_back();
+            if (FileEnt* const entp = fileEntp(modp->fileline())) entp->m_needed = true;
+            modp->foreach([&](const AstCell* cellp) {
+                if (cellp->modp() && reached.insert(cellp->modp()).second) {
+                    todo.push_back(cellp->modp());
+                }
+            });
+        }
+
+        VHashSha256 hash{cmdline};
+        hash.insert("\n");
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+        struct stat binStat;
+        if (stat(v3Global.opt.buildDepBin().c_str(), &binStat) == 0) {
+            hash.insert(static_cast<uint64_t>(binStat.st_size));
+            hash.insert(" ");
+            hash.insert(static_cast<uint64_t>(binStat.st_mtime));
+        }
+        hash.insert("\n");
+        for (const FileEnt& ent : m_files) {
+            // Files without modules may hold configuration, so are always needed
+            if (ent.m_hasModule && !ent.m_needed) {
+                UINFO(4, "Source hash skips unused " << ent.m_filename);
+                continue;
+            }
+            hash.insert(ent.m_filename + " " + ent.m_digest + "\n");
+        }
+        m_key = hash.digestSymbol();
+        UINFO(2, "Source hash key " << m_key);
+    }
+
+    bool checkKey(const string& filename) {
+        if (m_key.empty()) return false;
+        const std::unique_ptr<std::ifstream> ifp{V3File::new_ifstream_nodepend(filename)};
+        if (ifp->fail()) {
+            UINFO(2, "   --skip-identical-content failed: no input " << filename);
+            return false;
+        }
+        V3Os::getline(*ifp);  // Description comment
+        const string chkKey = V3Os::getline(*ifp);
+        if (chkKey != m_key) {
+            UINFO(2, "   --skip-identical-content failed: key differs " << chkKey);
+            return false;
+        }
+        return true;
+    }
+
+    void writeKey(const string& filename) {
+        UASSERT(!m_key.empty(), "writeKey before computeKey");
+        const std::unique_ptr<std::ofstream> ofp{V3File::new_ofstream(filename)};
+        if (ofp->fail()) v3fatal("Can't write file: " << filename);
+        *ofp << "# DESCR"
+             << "IPTION: Verilator output: Source hash for --skip-identical-content.  Delete at "
+                "will.\n";
+        *ofp << m_key << "\n";
+    }
+};
+
+static V3SourceHashImp s_sourceHashImp;
+
+//######################################################################
+// V3SourceHash
+
+void V3SourceHash::addFile(const VFileContent* contentp, const string& filename,
+                           const std::deque<string>& ppBuffers) {
+    s_sourceHashImp.addFile(contentp, filename, ppBuffers);
+}
+void V3SourceHash::computeKey(AstNetlist* rootp, const string& cmdline) {
+    s_sourceHashImp.computeKey(rootp, cmdline);
+}
+bool V3SourceHash::checkKey(const string& filename) {
+    return s_sourceHashImp.checkKey(filename);
+}
+void V3SourceHash::writeKey(const string& filename) { s_sourceHashImp.writeKey(filename); }
@@ -0,0 +1,45 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Content hashing for --skip-identical-content
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3SOURCEHASH_H_
+#define VERILATOR_V3SOURCEHASH_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include <deque>
+#include <string>
+
+class AstNetlist;
+class VFileContent;
+
+//============================================================================
+
+class V3SourceHash final {
+public:
+    // Record the preprocessed text of a parsed file, before it is lexed
+    static void addFile(const VFileContent* contentp, const std::string& filename,
+                        const std::deque<std::string>& ppBuffers);
+    // Compute the key of the design from the files defining the modules it
+    // uses, must be called after V3LinkCells
+    static void computeKey(AstNetlist* rootp, const std::string& cmdline);
+    // Return true if the key matches the key written to the given file
+    static bool checkKey(const std::string& filename);
+    // Write the key to the given file
+    static void writeKey(const std::string& filename);
+};
+
+#endif  // Guard
@@ -137,6 +137,7 @@ public:
             }
         }
         addStat("Node memory TOTAL (MiB)", totalNodeMemoryUsage >> 20);
+        addStat("Node memory, AstNode base size (bytes)", sizeof(AstNode));
 
         // Node Memory usage
         for (int t = 0; t < VNType::_ENUM_END; ++t) {
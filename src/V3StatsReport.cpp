@@ -32,10 +32,20 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 class StatsReport final {
     // TYPES
     using StatColl = std::vector<V3Statistic>;
+    struct StageTiming final {
+        std::string m_name;  // Stage name, with sequence number
+        double m_startSec;  // Wall time at start, relative to first stage
+        double m_wallSec;  // Wall time spent in stage
+        double m_cpuSec;  // CPU time spent in stage, all threads
+        double m_memCurrentMB;  // Memory in use at end of stage
+        double m_memPeakMB;  // Peak memory at end of stage
+        double m_memNodePoolMB;  // Node pool memory at end of stage
+    };
 
     // STATE
     std::ofstream& os;  ///< Output stream
     static StatColl s_allStats;  ///< All statistics
+    static std::vector<StageTiming> s_stages;  ///< Timing of each stage, in order
 
     static void sumit() {
         // If sumit is set on a statistic, combine with others of same name
@@ -173,6 +183,48 @@ public:
 
     static void calculate() { sumit(); }
 
+    static void addStage(const string& name, double startSec, double wallSec, double cpuSec,
+                         double memCurrentMB, double memPeakMB, double memNodePoolMB) {
+        s_stages.push_back(
+            {name, startSec, wallSec, cpuSec, memCurrentMB, memPeakMB, memNodePoolMB});
+    }
+
+    // Write stage timing in Chrome trace event format, which is also simple
+    // to aggregate across runs
+    static void stagesJson(const string& filename) {
+        V3OutJsonFile of{filename};
+        of.put("displayTimeUnit", "ms");
+        of.begin("otherData")
+            .put("version", V3Options::version())
+            .put("arguments", v3Global.opt.allArgsString())
+            .put("verilateJobs", v3Global.opt.verilateJobs())
+            .end();
+        of.begin("traceEvents", '[');
+        const double jobs = std::max(v3Global.opt.verilateJobs(), 1);
+        for (const StageTiming& stage : s_stages) {
+            of.begin()
+                .put("name", stage.m_name)
+                .put("cat", "stage")
+                .put("ph", "X")
+                .put("pid", 1)
+                .put("tid", 1)
+                .put("ts", static_cast<uint64_t>(stage.m_startSec * 1.0e6))
+                .put("dur", static_cast<uint64_t>(stage.m_wallSec * 1.0e6));
+            of.begin("args")
+                .put("wallSec", stage.m_wallSec)
+                .put("cpuSec", stage.m_cpuSec)
+                // Fraction of the verilation threads kept busy
+                .put("utilization",
+                     stage.m_wallSec > 0.0 ? stage.m_cpuSec / (stage.m_wallSec * jobs) : 0.0)
+                .put("memCurrentMB", stage.m_memCurrentMB)
+                .put("memPeakMB", stage.m_memPeakMB)
+                .put("memNodePoolMB", stage.m_memNodePoolMB)
+                .end()
+                .end();
+        }
+        of.end();
+    }
+
     // CONSTRUCTORS
     explicit StatsReport(std::ofstream* aofp)
         : os(*aofp) {  // Need () or GCC 4.8 false warning
@@ -186,6 +238,7 @@ public:
 };
 
 StatsReport::StatColl StatsReport::s_allStats;
+std::vector<StatsReport::StageTiming> StatsReport::s_stages;
 
 //######################################################################
 // V3Statstic class
@@ -203,15 +256,22 @@ void V3Stats::addStat(const V3Statistic& stat) { StatsReport::addStat(stat); }
 double V3Stats::getStatSum(const string& name) { return StatsReport::getStatSum(name); }
 
 void V3Stats::statsStage(const string& name) {
+    static double firstWallTime = -1;
     static double lastWallTime = -1;
+    static VlOs::DeltaCpuTime cpuTime{true};
+    static double lastCpuTime = 0;
     static int fileNumber = 0;
 
     const string digitName = V3Global::digitsFilename(++fileNumber) + "_" + name;
 
     const double wallTime = V3Os::timeUsecs() / 1.0e6;
-    if (lastWallTime < 0) lastWallTime = wallTime;
+    if (lastWallTime < 0) firstWallTime = lastWallTime = wallTime;
     const double wallTimeDelta = wallTime - lastWallTime;
+    const double wallTimeStart = lastWallTime - firstWallTime;
     lastWallTime = wallTime;
+    const double cpuTimeNow = cpuTime.deltaTime();
+    const double cpuTimeDelta = cpuTimeNow - lastCpuTime;
+    lastCpuTime = cpuTimeNow;
     V3Stats::addStatPerf("Stage, Elapsed time (sec), " + digitName, wallTimeDelta);
     V3Stats::addStatPerf("Stage, Elapsed time (sec), TOTAL", wallTimeDelta);
 
@@ -219,6 +279,11 @@ void V3Stats::statsStage(const string& name) {
     VlOs::memUsageBytes(memPeak /*ref*/, memCurrent /*ref*/);
     V3Stats::addStatPerf("Stage, Memory current (MB), " + digitName, memCurrent / 1024.0 / 1024.0);
     V3Stats::addStatPerf("Stage, Memory peak (MB), " + digitName, memPeak / 1024.0 / 1024.0);
+    V3Stats::addStatPerf("Stage, Memory node pool (MB), " + digitName,
+                         V3Allocator::chunkBytes() / 1024.0 / 1024.0);
+    StatsReport::addStage(digitName, wallTimeStart, wallTimeDelta, cpuTimeDelta,
+                          memCurrent / 1024.0 / 1024.0, memPeak / 1024.0 / 1024.0,
+                          V3Allocator::chunkBytes() / 1024.0 / 1024.0);
 }
 
 void V3Stats::infoHeader(std::ofstream& os, const string& prefix) {
@@ -243,6 +308,9 @@ void V3Stats::statsReport() {
     // Cleanup
     ofp->close();
     VL_DO_DANGLING(delete ofp, ofp);
+
+    StatsReport::stagesJson(v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix()
+                            + "__stats_stages.json");
 }
 
 void V3Stats::summaryReport() {
@@ -32,6 +32,7 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 
 #include <algorithm>
 #include <fcntl.h>
+#include <unordered_set>
 
 size_t VName::s_minLength = 32;
 size_t VName::s_maxLength = 0;  // Disabled
@@ -708,6 +709,29 @@ string VName::hashedName() {
     }
 }
 
+//######################################################################
+// VNameInterned
+
+// Node based, so interned strings never move as the set grows
+static std::unordered_set<string>& internedNames() VL_MT_SAFE {
+    static std::unordered_set<string> s_names;
+    return s_names;
+}
+static V3Mutex& internedNamesMutex() VL_MT_SAFE {
+    static V3Mutex s_mutex;
+    return s_mutex;
+}
+
+const string* VNameInterned::intern(const string& str) VL_MT_SAFE {
+    const V3LockGuard lock{internedNamesMutex()};
+    return &*internedNames().insert(str).first;
+}
+
+size_t VNameInterned::internedCount() VL_MT_SAFE {
+    const V3LockGuard lock{internedNamesMutex()};
+    return internedNames().size();
+}
+
 //######################################################################
 // VSpellCheck - Algorithm same as GCC's spellcheck.c
 
@@ -231,6 +231,50 @@ public:
     static string dehash(const string& in);
 };
 
+//######################################################################
+// VNameInterned - immutable string shared by all equal names, process wide
+// Equal names hold the same pointer, so copies are free and comparing is a
+// pointer compare.  Migrate a "string m_name" member by changing its type;
+// name() accessors returning string keep working through the conversion.
+
+class VNameInterned final {
+    const string* m_strp;  // Interned text, never freed
+
+    static const string* intern(const string& str) VL_MT_SAFE;
+    static const string* emptyp() VL_MT_SAFE {
+        static const string* const s_emptyp = intern("");
+        return s_emptyp;
+    }
+
+public:
+    // CONSTRUCTORS
+    VNameInterned()
+        : m_strp{emptyp()} {}
+    VNameInterned(const string& str)  // NOLINT(google-explicit-constructor)
+        : m_strp{intern(str)} {}
+    VNameInterned(const char* strp)  // NOLINT(google-explicit-constructor)
+        : m_strp{intern(strp)} {}
+    // METHODS
+    const string& str() const VL_MT_SAFE { return *m_strp; }
+    operator const string&() const VL_MT_SAFE { return *m_strp; }  // NOLINT
+    bool empty() const { return m_strp == emptyp(); }
+    bool operator==(const VNameInterned& rhs) const { return m_strp == rhs.m_strp; }
+    bool operator!=(const VNameInterned& rhs) const { return m_strp != rhs.m_strp; }
+    bool operator==(const string& rhs) const { return *m_strp == rhs; }
+    bool operator!=(const string& rhs) const { return *m_strp != rhs; }
+    bool operator==(const char* rhsp) const { return *m_strp == rhsp; }
+    bool operator!=(const char* rhsp) const { return *m_strp != rhsp; }
+    // Number of unique names interned, for statistics
+    static size_t internedCount() VL_MT_SAFE;
+};
+inline string operator+(const VNameInterned& lhs, const string& rhs) { return lhs.str() + rhs; }
+inline string operator+(const string& lhs, const VNameInterned& rhs) { return lhs + rhs.str(); }
+inline string operator+(const VNameInterned& lhs, const char* rhsp) { return lhs.str() + rhsp; }
+inline string operator+(const char* lhsp, const VNameInterned& rhs) { return lhsp + rhs.str(); }
+inline std::ostream& operator<<(std::ostream& os, const VNameInterned& rhs) {
+    return os << rhs.str();
+}
+
 //######################################################################
 // VSpellCheck - Find near-match spelling suggestions given list of possibilities
 
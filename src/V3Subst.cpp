@@ -20,6 +20,10 @@
 //      Later usages of that word may then be replaced as long as
 //      the RHS hasn't changed value.
 //
+// Each function:
+//      For each small wide temporary only accessed by WORDSEL(VARREF, CONST)
+//          Replace it with one scalar temporary per word
+//
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
@@ -385,11 +389,109 @@ public:
     }
 };
 
+//######################################################################
+// Replace small wide temporaries with per word scalar temporaries, so the
+// C++ compiler may keep the words in registers rather than in an array
+
+class SubstScalarVisitor final : public VNVisitor {
+    // NODE STATE
+    // AstVar::user1p           -> SubstScalarEntry* for candidate var. Only under CFunc.
+
+    // TYPES
+    struct SubstScalarEntry final {
+        AstVar* const m_varp;  // Wide temporary variable
+        bool m_ok = true;  // All references are constant word selects
+        std::vector<AstWordSel*> m_selps;  // Word selects referencing this var
+        explicit SubstScalarEntry(AstVar* varp)
+            : m_varp{varp} {}
+    };
+
+    // STATE
+    std::deque<SubstScalarEntry> m_entries;  // Candidate vars under current function
+    const AstCFunc* m_funcp = nullptr;  // Current function we are under
+    VDouble0 m_statScalarized;  // Statistic tracking
+
+    static constexpr int SUBST_SCALAR_MAX_WORDS = 8;  // Maximum words to scalarize
+
+    // METHODS
+    static bool isScalarVar(const AstVar* nodep) {
+        return nodep->isStatementTemp() && nodep->isWide()
+               && nodep->widthWords() <= SUBST_SCALAR_MAX_WORDS
+               && VN_IS(nodep->dtypeSkipRefp(), BasicDType);
+    }
+    void scalarize(SubstScalarEntry& entry) {
+        AstVar* const varp = entry.m_varp;
+        UINFO(8, " SCALARIZE " << varp);
+        std::vector<AstVar*> wordVarps(varp->widthWords(), nullptr);
+        for (AstWordSel* const selp : entry.m_selps) {
+            const int word = VN_AS(selp->bitp(), Const)->toUInt();
+            AstVar*& wordVarp = wordVarps[word];
+            if (!wordVarp) {
+                wordVarp = new AstVar{varp->fileline(), VVarType::STMTTEMP,
+                                      varp->name() + "__" + std::to_string(word),
+                                      varp->findBitDType(VL_EDATASIZE, VL_EDATASIZE,
+                                                         VSigning::UNSIGNED)};
+                wordVarp->funcLocal(varp->isFuncLocal());
+                varp->addNextHere(wordVarp);
+            }
+            const AstVarRef* const refp = VN_AS(selp->fromp(), VarRef);
+            selp->replaceWith(new AstVarRef{selp->fileline(), wordVarp, refp->access()});
+            VL_DO_DANGLING(pushDeletep(selp), selp);
+        }
+        VL_DO_DANGLING(pushDeletep(varp->unlinkFrBack()), varp);
+        ++m_statScalarized;
+    }
+
+    // VISITORS
+    void visit(AstVarRef* nodep) override {
+        if (!m_funcp) return;
+        AstVar* const varp = nodep->varp();
+        if (!isScalarVar(varp)) return;
+        if (!varp->user1p()) {
+            m_entries.emplace_back(varp);
+            varp->user1p(&m_entries.back());
+        }
+        SubstScalarEntry* const entryp = varp->user1u().to<SubstScalarEntry*>();
+        AstWordSel* const selp = VN_CAST(nodep->backp(), WordSel);
+        const AstConst* const constp = selp ? VN_CAST(selp->bitp(), Const) : nullptr;
+        if (selp && selp->fromp() == nodep && constp
+            && constp->toUInt() < static_cast<uint32_t>(varp->widthWords())) {
+            entryp->m_selps.push_back(selp);
+        } else {
+            UINFO(9, " SCALARnotWord " << nodep);
+            entryp->m_ok = false;
+        }
+    }
+    void visit(AstCFunc* nodep) override {
+        UASSERT_OBJ(!m_funcp, nodep, "Should not nest");
+        VL_RESTORER(m_funcp);
+        m_funcp = nodep;
+
+        const VNUser1InUse m_inuser1;
+        iterateChildren(nodep);
+        for (SubstScalarEntry& entry : m_entries) {
+            if (entry.m_ok) scalarize(entry);
+        }
+        m_entries.clear();
+    }
+    void visit(AstVar*) override {}
+    void visit(AstConst*) override {}
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit SubstScalarVisitor(AstNode* nodep) { iterate(nodep); }
+    ~SubstScalarVisitor() override {
+        V3Stats::addStat("Optimizations, Scalarized wide temps", m_statScalarized);
+    }
+};
+
 //######################################################################
 // Subst class functions
 
 void V3Subst::substituteAll(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
     { SubstVisitor{nodep}; }  // Destruct before checking
+    { SubstScalarVisitor{nodep}; }  // Destruct before checking
     V3Global::dumpCheckGlobalTree("subst", 0, dumpTreeEitherLevel() >= 3);
 }
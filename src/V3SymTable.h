@@ -25,10 +25,11 @@
 #include "V3Global.h"
 #include "V3String.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <iomanip>
-#include <map>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -43,7 +44,7 @@ using VSymConstMap = std::unordered_set<const VSymEnt*>;
 class VSymEnt final {
     // Symbol table that can have a "superior" table for resolving upper references
     // MEMBERS
-    using IdNameMap = std::multimap<std::string, VSymEnt*>;
+    using IdNameMap = std::unordered_multimap<std::string, VSymEnt*>;
     IdNameMap m_idNameMap;  // Hash of variables by name
     AstNode* m_nodep;  // Node that entry belongs to
     VSymEnt* m_fallbackp = nullptr;  // Table "above" this in name scope, for fallback resolution
@@ -58,9 +59,18 @@ class VSymEnt final {
     static constexpr int debug() { return 0; }  // NOT runtime, too hot of a function
 #endif
 public:
-    using const_iterator = IdNameMap::const_iterator;
-    const_iterator begin() const { return m_idNameMap.begin(); }
-    const_iterator end() const { return m_idNameMap.end(); }
+    using SortedEntries = std::vector<const IdNameMap::value_type*>;
+    // Return entries sorted by name, for when iteration order is visible in the output
+    SortedEntries sortedEntries() const {
+        SortedEntries entries;
+        entries.reserve(m_idNameMap.size());
+        for (const auto& pair : m_idNameMap) entries.push_back(&pair);
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const IdNameMap::value_type* ap, const IdNameMap::value_type* bp) {
+                             return ap->first < bp->first;
+                         });
+        return entries;
+    }
 
     void dumpIterate(std::ostream& os, VSymConstMap& doneSymsr, const string& indent,
                      int numLevels, const string& searchName) const {
@@ -79,10 +89,10 @@ public:
         if (VL_UNCOVERABLE(!doneSymsr.insert(this).second)) {
             os << indent << "| ^ duplicate, so no children printed\n";  // LCOV_EXCL_LINE
         } else {
-            for (auto it = m_idNameMap.begin(); it != m_idNameMap.end(); ++it) {
-                if (numLevels >= 1) {
-                    it->second->dumpIterate(os, doneSymsr, indent + "| ", numLevels - 1,
-                                            it->first);
+            if (numLevels >= 1) {
+                for (const IdNameMap::value_type* const itp : sortedEntries()) {
+                    itp->second->dumpIterate(os, doneSymsr, indent + "| ", numLevels - 1,
+                                             itp->first);
                 }
             }
         }
@@ -169,8 +179,8 @@ public:
     }
     void candidateIdFlat(VSpellCheck* spellerp, const VNodeMatcher* matcherp) const {
         // Suggest alternative symbol candidates without looking upward through symbol hierarchy
-        for (IdNameMap::const_iterator it = m_idNameMap.begin(); it != m_idNameMap.end(); ++it) {
-            const AstNode* const itemp = it->second->nodep();
+        for (const IdNameMap::value_type* const itp : sortedEntries()) {
+            const AstNode* const itemp = itp->second->nodep();
             if (itemp && (!matcherp || matcherp->nodeMatch(itemp))) {
                 spellerp->pushCandidate(itemp->prettyName());
             }
@@ -264,11 +274,11 @@ public:
     string cellErrorScopes(AstNode* lookp, string prettyName = "") {
         if (prettyName == "") prettyName = lookp->prettyName();
         string scopes;
-        for (IdNameMap::iterator it = m_idNameMap.begin(); it != m_idNameMap.end(); ++it) {
-            AstNode* const itemp = it->second->nodep();
+        for (const IdNameMap::value_type* const itp : sortedEntries()) {
+            AstNode* const itemp = itp->second->nodep();
             if (VN_IS(itemp, Cell) || (VN_IS(itemp, Module) && VN_AS(itemp, Module)->isTop())) {
                 if (scopes != "") scopes += ", ";
-                scopes += AstNode::prettyName(it->first);
+                scopes += AstNode::prettyName(itp->first);
             }
         }
         if (scopes == "") scopes = "<no instances found>";
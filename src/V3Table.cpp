@@ -37,8 +37,8 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 // Table class functions
 
 // CONFIG
-// 1MB is max table size (better be lots of instructs to be worth it!)
-static constexpr int TABLE_MAX_BYTES = 1 * 1024 * 1024;
+// Max table size is --table-max-bytes, 1MB by default (better be lots of instructs to be
+// worth it!)
 // 64MB is close to max memory of some systems (256MB or so), so don't get out of control
 static constexpr int TABLE_TOTAL_BYTES = 64 * 1024 * 1024;
 // Worth no more than 8 bytes of data to replace an instruction
@@ -152,6 +152,8 @@ class TableVisitor final : public VNVisitor {
     // STATE
     double m_totalBytes = 0;  // Total bytes in tables created
     VDouble0 m_statTablesCre;  // Statistic tracking
+    VDouble0 m_statTableBytes;  // Statistic tracking - bytes of tables created
+    VDouble0 m_statTableInstrs;  // Statistic tracking - instructions replaced by tables
 
     //  State cleared on each module
     AstNodeModule* m_modp = nullptr;  // Current MODULE
@@ -219,7 +221,7 @@ private:
         if (chkvis.instrCount() < TABLE_MIN_NODE_COUNT) {
             chkvis.clearOptimizable(nodep, "Table has too few nodes involved");
         }
-        if (space > TABLE_MAX_BYTES) {
+        if (space > v3Global.opt.tableMaxBytes()) {
             chkvis.clearOptimizable(nodep, "Table takes too much space");
         }
         if (space > time * TABLE_SPACE_TIME_MULT) {
@@ -237,6 +239,8 @@ private:
         if (chkvis.optimizable()) {
             UINFO(3, " Table Optimize spacetime=" << (space / time) << " " << nodep);
             m_totalBytes += space;
+            m_statTableBytes += space;
+            m_statTableInstrs += chkvis.instrCount();
         }
         return chkvis.optimizable();
     }
@@ -411,6 +415,8 @@ public:
     explicit TableVisitor(AstNetlist* nodep) { iterate(nodep); }
     ~TableVisitor() override {  //
         V3Stats::addStat("Optimizations, Tables created", m_statTablesCre);
+        V3Stats::addStat("Optimizations, Tables bytes", m_statTableBytes);
+        V3Stats::addStat("Optimizations, Tables instructions replaced", m_statTableInstrs);
     }
 };
 
@@ -34,6 +34,7 @@
 #include "V3Stats.h"
 
 #include <tuple>
+#include <unordered_set>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -308,6 +309,10 @@ public:
 // DPI related utility functions
 
 struct TaskDpiUtils final {
+    static bool isDpiPrimitive(const AstVar* portp) {
+        // DPI passes as a primitive type, including dpi_direct packed arguments
+        return portp->isDpiDirect() || portp->basicp()->isDpiPrimitive();
+    }
     static std::vector<std::pair<AstUnpackArrayDType*, int>>
     unpackDimsAndStrides(AstNodeDType* dtypep) {
         std::vector<std::pair<AstUnpackArrayDType*, int>> dimStrides;
@@ -331,7 +336,7 @@ struct TaskDpiUtils final {
         } else if (portp->basicp() && portp->basicp()->keyword() == VBasicDTypeKwd::STRING) {
             frstmt = "VL_CVT_N_CSTR(" + frName;
             ket = ")";
-        } else if ((portp->basicp() && portp->basicp()->isDpiPrimitive())) {
+        } else if ((portp->basicp() && isDpiPrimitive(portp))) {
             frstmt = frName;
         } else {
             const string frSvType = portp->basicp()->isDpiBitVec() ? "SVBV" : "SVLV";
@@ -380,6 +385,7 @@ class TaskVisitor final : public VNVisitor {
     DpiCFuncs m_dpiNames;  // Map of all created DPI functions
     VDouble0 m_statInlines;  // Statistic tracking
     VDouble0 m_statHierDpisWithCosts;  // Statistic tracking
+    VDouble0 m_statConstRefArgs;  // Statistic tracking
 
     // METHODS
 
@@ -1047,6 +1053,78 @@ class TaskVisitor final : public VNVisitor {
         }
     }
 
+    void markArgsConstRef(AstCFunc* cfuncp) {
+        // Pass large inputs of a user function by const reference instead of by copy. This
+        // is only safe if the input cannot change during the call, so require the function to
+        // write only its own locals, not to call anything, and not to suspend.
+        bool hasRef = false;
+        for (AstNode* argp = cfuncp->argsp(); argp; argp = argp->nextp()) {
+            if (const AstVar* const portp = VN_CAST(argp, Var)) {
+                if (portp->isRef() || portp->isConstRef()) hasRef = true;
+            }
+        }
+        // A ref argument may alias an input of the same call
+        if (hasRef) return;
+        std::unordered_set<const AstVar*> writtenVars;
+        const bool selfContained = !cfuncp->exists([&](const AstNode* nodep) {
+            if (const AstVarRef* const refp = VN_CAST(nodep, VarRef)) {
+                if (refp->access().isReadOnly()) return false;
+                writtenVars.insert(refp->varp());
+                return !refp->varp()->isFuncLocal();
+            }
+            return VN_IS(nodep, NodeFTaskRef) || VN_IS(nodep, NodeCCall) || VN_IS(nodep, CExpr)
+                   || VN_IS(nodep, CStmt) || VN_IS(nodep, UCFunc) || VN_IS(nodep, UCStmt)
+                   || VN_IS(nodep, Delay) || VN_IS(nodep, EventControl) || VN_IS(nodep, Wait)
+                   || VN_IS(nodep, Fork);
+        });
+        if (!selfContained) return;
+        for (AstNode* argp = cfuncp->argsp(); argp; argp = argp->nextp()) {
+            AstVar* const portp = VN_CAST(argp, Var);
+            if (!portp || portp->isWritable() || !portp->isNonOutput()) continue;
+            if (writtenVars.count(portp)) continue;
+            const AstNodeDType* const dtypep = portp->dtypep()->skipRefp();
+            const AstBasicDType* const basicp = dtypep->basicp();
+            if (portp->isWide() || (basicp && basicp->isString())
+                || VN_IS(dtypep, UnpackArrayDType) || VN_IS(dtypep, QueueDType)
+                || VN_IS(dtypep, DynArrayDType) || VN_IS(dtypep, AssocArrayDType)
+                || (VN_IS(dtypep, NodeUOrStructDType)
+                    && !VN_AS(dtypep, NodeUOrStructDType)->packed())) {
+                portp->argConstRef(true);
+                ++m_statConstRefArgs;
+            }
+        }
+    }
+
+    static void markDpiDirect(AstNodeFTask* nodep) {
+        // Check a dpi_direct import may pass by value, and mark its packed ports to do so
+        if (nodep->dpiContext() || nodep->dpiTask()) {
+            nodep->v3error("dpi_direct DPI import may not be a context import or a task: "
+                           << nodep->prettyNameQ());
+            return;
+        }
+        const auto markPort = [](AstVar* portp) {
+            const AstBasicDType* const basicp = portp->basicp();
+            if (portp->isWritable() && !portp->isFuncReturn()) {
+                portp->v3error("dpi_direct DPI import arguments must be inputs: "
+                               << portp->prettyNameQ());
+            } else if (!basicp || portp->isDpiOpenArray()
+                       || VN_IS(portp->dtypep()->skipRefp(), UnpackArrayDType)
+                       || basicp->isFourstate() || portp->width() > VL_QUADSIZE) {
+                portp->v3error("dpi_direct DPI import arguments must be 2-state and at most "
+                               "64 bits wide: "
+                               << portp->prettyNameQ());
+            } else if (basicp->isDpiBitVec()) {
+                portp->isDpiDirect(true);
+            }
+        };
+        if (AstVar* const portp = VN_CAST(nodep->fvarp(), Var)) markPort(portp);
+        for (AstNode* stmtp = nodep->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
+            if (AstVar* const portp = VN_CAST(stmtp, Var)) {
+                if (portp->isIO()) markPort(portp);
+            }
+        }
+    }
+
     static void makePortList(AstNodeFTask* nodep, AstCFunc* dpip) {
         // Copy nodep's list of function I/O to the new dpip c function
         for (AstNode* stmtp = nodep->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
@@ -1088,10 +1166,14 @@ class TaskVisitor final : public VNVisitor {
 
                     if (portp->isDpiOpenArray()) {
                         AstNodeDType* const dtypep = portp->dtypep()->skipRefp();
-                        UASSERT_OBJ(!VN_IS(dtypep, DynArrayDType) && !VN_IS(dtypep, QueueDType),
+                        const bool dynamic = portp->isDpiOpenDynamic();
+                        UASSERT_OBJ(!dynamic || (!VN_IS(dtypep->subDTypep()->skipRefp(),
+                                                        DynArrayDType)
+                                                 && !VN_IS(dtypep->subDTypep()->skipRefp(),
+                                                           QueueDType)),
                                     portp,
-                                    "Passing dynamic array or queue as actual argument to DPI "
-                                    "open array is not yet supported");
+                                    "Passing nested dynamic array or queue as actual argument "
+                                    "to DPI open array is not yet supported");
                         // Ideally we'd make a table of variable
                         // characteristics, and reuse it wherever we can
                         // At least put them into the module's CTOR as static?
@@ -1103,10 +1185,26 @@ class TaskVisitor final : public VNVisitor {
                         // point to this task & thread's data, in addition
                         // to static info about the variable
                         const string name = portp->name() + "__Vopenarray";
+                        string datap = "&" + portp->name();
+                        if (dynamic) {
+                            // Elements of a deque are not contiguous, so the callee
+                            // sees a contiguous copy, only copied back if writable
+                            const string dataName = portp->name() + "__Vopendata";
+                            const string elemType
+                                = dtypep->subDTypep()->cType("", false, false);
+                            string dataCode = "std::vector<" + elemType + "> " + dataName + ";\n";
+                            if (portp->isNonOutput()) {
+                                dataCode += portp->name() + ".copyToVector(" + dataName + ");\n";
+                            } else {
+                                dataCode += dataName + ".resize(" + portp->name() + ".size());\n";
+                            }
+                            cfuncp->addStmtsp(new AstCStmt{portp->fileline(), dataCode});
+                            datap = dataName + ".empty() ? nullptr : " + dataName + ".data()";
+                        }
                         const string varCode
                             = ("VerilatedDpiOpenVar "
                                // NOLINTNEXTLINE(performance-inefficient-string-concatenation)
-                               + name + " (&" + propName + ", &" + portp->name() + ");\n");
+                               + name + " (&" + propName + ", " + datap + ");\n");
                         cfuncp->addStmtsp(new AstCStmt{portp->fileline(), varCode});
                         args += "&" + name;
                     } else {
@@ -1137,7 +1235,7 @@ class TaskVisitor final : public VNVisitor {
                 cfuncp->addStmtsp(createDpiTemp(rtnvscp->varp(), tmpSuffixp));
                 string stmt = rtnvscp->varp()->name();
                 stmt += tmpSuffixp;
-                stmt += rtnvscp->varp()->basicp()->isDpiPrimitive() ? " = " : "[0] = ";
+                stmt += TaskDpiUtils::isDpiPrimitive(rtnvscp->varp()) ? " = " : "[0] = ";
                 cfuncp->addStmtsp(new AstText{nodep->fileline(), stmt, /* tracking: */ true});
             }
             AstCCall* const callp = new AstCCall{nodep->fileline(), dpiFuncp};
@@ -1157,6 +1255,11 @@ class TaskVisitor final : public VNVisitor {
                     cfuncp->addStmtsp(
                         createAssignDpiToInternal(portvscp, portp->name() + tmpSuffixp));
                 }
+                if (portp->isIO() && portp->isWritable() && portp->isDpiOpenDynamic()) {
+                    const string stmt = portp->name() + ".copyFromVector(" + portp->name()
+                                        + "__Vopendata);\n";
+                    cfuncp->addStmtsp(new AstCStmt{portp->fileline(), stmt});
+                }
             }
         }
     }
@@ -1183,6 +1286,7 @@ class TaskVisitor final : public VNVisitor {
         // Probably some of this work should be done later, but...
         // should the type of the function be bool/uint32/64 etc (based on lookup) or IData?
         AstNode::user2ClearTree();
+        if (nodep->dpiImport() && nodep->dpiDirect()) markDpiDirect(nodep);
         AstVar* rtnvarp = nullptr;
         if (nodep->isFunction()) {
             AstVar* const portp = VN_AS(nodep->fvarp(), Var);
@@ -1190,7 +1294,7 @@ class TaskVisitor final : public VNVisitor {
             UASSERT_OBJ(portp->isFuncReturn(), nodep, "Not marked as function return var");
             if (nodep->dpiImport() || nodep->dpiExport()) {
                 AstBasicDType* const bdtypep = portp->dtypep()->basicp();
-                if (!bdtypep->isDpiPrimitive()) {
+                if (!TaskDpiUtils::isDpiPrimitive(portp)) {
                     if (bdtypep->isDpiBitVec() && portp->width() > 32) {
                         portp->v3error("DPI function may not return a > 32 bits wide type "
                                        "other than basic types.\n"
@@ -1277,6 +1381,7 @@ class TaskVisitor final : public VNVisitor {
         }
         cfuncp->isVirtual(nodep->isVirtual());
         cfuncp->dpiPure(nodep->dpiPure());
+        cfuncp->dpiThreadSafe(nodep->dpiThreadSafe());
         if (nodep->name() == "new") cfuncp->isConstructor(true);
         if (cfuncp->dpiExportImpl()) cfuncp->cname(nodep->cname());
 
@@ -1368,6 +1473,11 @@ class TaskVisitor final : public VNVisitor {
         // Replace variable refs
         relink(cfuncp);
 
+        if (!nodep->dpiImport() && !nodep->dpiExport() && !nodep->taskPublic()
+            && !nodep->classMethod() && !nodep->isVirtual()) {
+            markArgsConstRef(cfuncp);
+        }
+
         if (cfuncp->dpiExportImpl()) {
             // Mark all non-local variables written by the DPI exported function as being updated
             // by DPI exports. This ensures correct ordering and change detection later.
@@ -1638,6 +1748,8 @@ public:
     }
     ~TaskVisitor() {
         V3Stats::addStat("Optimizations, Functions inlined", m_statInlines);
+        V3Stats::addStat("Optimizations, Function arguments by const reference",
+                         m_statConstRefArgs);
         V3Stats::addStat("Optimizations, Hierarchical DPI wrappers with costs",
                          m_statHierDpisWithCosts);
     }
@@ -1953,7 +2065,7 @@ string V3Task::assignInternalToDpi(AstVar* portp, bool isPtr, const string& frSu
         unpackDim = unpackp->dimensions(false).second;
         if (unpackDim > 0) UASSERT_OBJ(unpackSize > 0, portp, "size must be greater than 0");
     }
-    if (portp->basicp()->isDpiBitVec() || portp->basicp()->isDpiLogicVec()) {
+    if (!TaskDpiUtils::isDpiPrimitive(portp)) {
         const bool isBit = portp->basicp()->isDpiBitVec();
         const bool needsFor = unpackSize > 1;
         if (needsFor) {
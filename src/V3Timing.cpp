@@ -50,6 +50,9 @@
 //     - replace with a CAwait statement waiting on the corresponding trigger scheduler
 // - for each wait(cond) statement:
 //     - replace it with a loop like: while (!cond) @(<vars from cond>)
+// - for each dynamic trigger that only reads variables whose every write can be followed by a
+//   call to the dynamic trigger scheduler (found by TimingDynTriggerDepsVisitor):
+//     - await evaluation only after one of these variables was written
 // - for each fork:
 //     - put each statement in a begin if it isn't in one already
 //     - if it's not a fork..join_none:
@@ -70,8 +73,10 @@
 #include "V3MemberMap.h"
 #include "V3SenExprBuilder.h"
 #include "V3SenTree.h"
+#include "V3Stats.h"
 #include "V3UniqueNames.h"
 
+#include <map>
 #include <queue>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -104,6 +109,17 @@ static void addFlags(AstNode* const nodep, uint8_t flags) { nodep->user2(nodep->
 // Check if a node has ALL of the expected flags set
 static bool hasFlags(AstNode* const nodep, uint8_t flags) { return !(~nodep->user2() & flags); }
 
+// Returns true if the given trigger expression needs to be evaluated at runtime by the
+// dynamic trigger scheduler
+static bool needDynamicTrigger(const AstClass* classp, AstNode* const nodep) {
+    return classp || nodep->exists([](AstNode* const nodep) {
+        if (AstNodeVarRef* varp = VN_CAST(nodep, NodeVarRef)) {
+            return varp->varp()->isFuncLocal();
+        }
+        return !nodep->isPure();
+    });
+}
+
 // ######################################################################
 //  Detect nodes affected by timing and/or requiring a process
 
@@ -438,6 +454,169 @@ public:
     ~TimingSuspendableVisitor() override = default;
 };
 
+// ######################################################################
+//  Find dynamic triggers that need evaluating only after a variable they read was written
+
+class TimingDynTriggerDepsVisitor final : public VNVisitorConst {
+    // TYPES
+    using VarList = std::vector<const AstVar*>;  // Unique, in order of first read
+
+    // STATE
+    AstClass* m_classp = nullptr;  // Current class
+    AstNodeStmt* m_stmtp = nullptr;  // Current statement
+    bool m_inCall = false;  // Under a call, that may write arguments later via a reference
+    bool m_inCText = false;  // Under $c, that may write any variable it references
+    std::vector<std::pair<AstNode*, VarList>> m_triggers;  // Dynamic triggers and what they read
+    std::unordered_map<const AstVar*, std::vector<AstNodeStmt*>> m_writeStmts;  // Write sites
+    std::unordered_set<const AstVar*> m_untracked;  // Written where a call can't follow
+    std::unordered_map<const AstNode*, uint32_t> m_groups;  // Dependency group of trigger
+    std::vector<std::pair<AstNodeStmt*, uint32_t>> m_hooks;  // Statement, group it writes
+
+    // METHODS
+    static bool isTrackable(const AstVar* varp) {
+        if (varp->isSigPublic() || varp->isRand()) return false;  // Written outside the AST
+        const AstNodeDType* const dtypep = varp->dtypep()->skipRefp();
+        const AstBasicDType* const basicp = VN_CAST(dtypep, BasicDType);
+        if (basicp && basicp->isEvent()) return false;  // Triggered in the runtime
+        if (varp->isClassMember()) return true;
+        if (!varp->isFuncLocal()) return false;  // May be driven by scheduled logic
+        // Other arguments may be references to a variable of the caller
+        return !varp->isIO()
+               || (varp->direction() == VDirection::INPUT && basicp && !basicp->isWide()
+                   && !basicp->isString());
+    }
+    void addTrigger(AstNode* nodep, AstNode* exprp) {
+        VarList deps;
+        bool trackable = true;
+        exprp->foreach([&](AstNode* const subp) {
+            const AstVar* varp = nullptr;
+            if (const AstNodeVarRef* const refp = VN_CAST(subp, NodeVarRef)) {
+                varp = refp->varp();
+            } else if (const AstMemberSel* const selp = VN_CAST(subp, MemberSel)) {
+                varp = selp->varp();
+                if (!varp) trackable = false;
+            } else if (VN_IS(subp, NodeFTaskRef) || VN_IS(subp, NodeCCall) || VN_IS(subp, CExpr)
+                       || !subp->isPure()) {
+                trackable = false;
+            }
+            if (!varp) return;
+            if (!isTrackable(varp)) trackable = false;
+            if (std::find(deps.begin(), deps.end(), varp) == deps.end()) deps.push_back(varp);
+        });
+        if (trackable && !deps.empty()) m_triggers.emplace_back(nodep, std::move(deps));
+    }
+    void addWrite(const AstVar* varp) {
+        if (!varp) return;
+        // The call must directly follow the write, so only allow plain statements
+        if (m_inCall || !m_stmtp || !(VN_IS(m_stmtp, Assign) || VN_IS(m_stmtp, StmtExpr))) {
+            m_untracked.emplace(varp);
+            return;
+        }
+        std::vector<AstNodeStmt*>& stmtps = m_writeStmts[varp];
+        if (stmtps.empty() || stmtps.back() != m_stmtp) stmtps.push_back(m_stmtp);
+    }
+    void addRef(const AstVar* varp, VAccess access) {
+        if (m_inCText) {
+            if (varp) m_untracked.emplace(varp);
+        } else if (access.isWriteOrRW()) {
+            addWrite(varp);
+        }
+    }
+    void assignGroups() {
+        std::map<VarList, uint32_t> groupIds;
+        std::unordered_map<AstNodeStmt*, std::vector<uint32_t>> stmtGroups;
+        for (const auto& pair : m_triggers) {
+            const VarList& deps = pair.second;
+            if (std::any_of(deps.begin(), deps.end(),
+                            [this](const AstVar* varp) { return m_untracked.count(varp); })) {
+                continue;
+            }
+            const auto it = groupIds.emplace(deps, groupIds.size());
+            const uint32_t group = it.first->second;
+            m_groups.emplace(pair.first, group);
+            if (!it.second) continue;  // Hooks already added
+            for (const AstVar* const varp : deps) {
+                const auto wit = m_writeStmts.find(varp);
+                if (wit == m_writeStmts.end()) continue;
+                for (AstNodeStmt* const stmtp : wit->second) {
+                    std::vector<uint32_t>& groups = stmtGroups[stmtp];
+                    if (std::find(groups.begin(), groups.end(), group) != groups.end()) continue;
+                    groups.push_back(group);
+                    m_hooks.emplace_back(stmtp, group);
+                }
+            }
+        }
+    }
+
+    // VISITORS
+    void visit(AstClass* nodep) override {
+        VL_RESTORER(m_classp);
+        m_classp = nodep;
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNodeStmt* nodep) override {
+        VL_RESTORER(m_stmtp);
+        VL_RESTORER(m_inCall);
+        VL_RESTORER(m_inCText);
+        m_stmtp = nodep;
+        m_inCall = false;
+        m_inCText = VN_IS(nodep, CStmt);
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstEventControl* nodep) override {
+        AstSenTree* const sensesp = nodep->sensesp();
+        if (sensesp && needDynamicTrigger(m_classp, sensesp)) addTrigger(nodep, sensesp);
+        visit(static_cast<AstNodeStmt*>(nodep));
+    }
+    void visit(AstWait* nodep) override {
+        AstNodeExpr* const condp = nodep->condp();
+        if (!VN_IS(condp, Const) && needDynamicTrigger(m_classp, condp)) addTrigger(nodep, condp);
+        visit(static_cast<AstNodeStmt*>(nodep));
+    }
+    void visit(AstNodeCCall* nodep) override {
+        VL_RESTORER(m_inCall);
+        m_inCall = true;
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNodeFTaskRef* nodep) override {
+        VL_RESTORER(m_inCall);
+        m_inCall = true;
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstCMethodHard* nodep) override {
+        iterateConst(nodep->fromp());
+        // Arguments may be kept by reference and written later, e.g. by write_var
+        VL_RESTORER(m_inCall);
+        m_inCall = true;
+        iterateAndNextConstNull(nodep->pinsp());
+    }
+    void visit(AstCExpr* nodep) override {
+        VL_RESTORER(m_inCText);
+        m_inCText = true;
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNodeVarRef* nodep) override { addRef(nodep->varp(), nodep->access()); }
+    void visit(AstMemberSel* nodep) override {
+        addRef(nodep->varp(), nodep->access());
+        iterateChildrenConst(nodep);
+    }
+    void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit TimingDynTriggerDepsVisitor(AstNetlist* nodep) {
+        iterateConst(nodep);
+        assignGroups();
+    }
+    ~TimingDynTriggerDepsVisitor() override = default;
+
+    // METHODS
+    // Dependency group of each dynamic AstEventControl and AstWait that has one
+    std::unordered_map<const AstNode*, uint32_t>& groups() { return m_groups; }
+    // Statements to follow with a call to written(<group>)
+    const std::vector<std::pair<AstNodeStmt*, uint32_t>>& hooks() const { return m_hooks; }
+};
+
 // ######################################################################
 //  Transform nodes affected by timing
 
@@ -495,6 +674,8 @@ class TimingControlVisitor final : public VNVisitor {
     // Other
     SenTreeFinder m_finder{m_netlistp};  // Sentree finder and uniquifier
     SenExprBuilder* m_senExprBuilderp = nullptr;  // Sens expression builder for current m_scope
+    // Dependency group of dynamic AstEventControl/AstWait, see TimingDynTriggerDepsVisitor
+    std::unordered_map<const AstNode*, uint32_t> m_dynTriggerGroups;
 
     // METHODS
     // Transform an assignment with an intra timing control into a timing control with the
@@ -575,6 +756,23 @@ class TimingControlVisitor final : public VNVisitor {
         m_netlistp->topScopep()->addSenTreesp(m_dynamicSensesp);
         return m_dynamicSensesp;
     }
+    // Find dynamic triggers with known dependencies, and follow each write of these with a
+    // call notifying the dynamic trigger scheduler
+    void addDynTriggerDeps() {
+        TimingDynTriggerDepsVisitor depsVisitor{m_netlistp};
+        m_dynTriggerGroups = std::move(depsVisitor.groups());
+        for (const auto& pair : depsVisitor.hooks()) {
+            AstNodeStmt* const stmtp = pair.first;
+            FileLine* const flp = stmtp->fileline();
+            AstCMethodHard* const writtenp = new AstCMethodHard{
+                flp, new AstVarRef{flp, getCreateDynamicTriggerScheduler(), VAccess::WRITE},
+                "written", new AstConst{flp, AstConst::Unsized32{}, pair.second}};
+            writtenp->dtypeSetVoid();
+            stmtp->addNextHere(writtenp->makeStmt());
+        }
+        V3Stats::addStat("Timing, dynamic triggers with dependencies", m_dynTriggerGroups.size());
+        V3Stats::addStat("Timing, dynamic trigger dependency writes", depsVisitor.hooks().size());
+    }
     // Creates the event variable to trigger in NBA region
     AstEventControl* createNbaEventControl(FileLine* flp) {
         if (!m_netlistp->nbaEventp()) {
@@ -603,12 +801,7 @@ class TimingControlVisitor final : public VNVisitor {
     // Returns true if we are under a class or the given tree has any references to locals. These
     // are cases where static, globally-evaluated triggers are not suitable.
     bool needDynamicTrigger(AstNode* const nodep) const {
-        return m_classp || nodep->exists([](AstNode* const nodep) {
-            if (AstNodeVarRef* varp = VN_CAST(nodep, NodeVarRef)) {
-                return varp->varp()->isFuncLocal();
-            }
-            return !nodep->isPure();
-        });
+        return ::needDynamicTrigger(m_classp, nodep);
     }
     // Returns true if the given trigger expression needs a destructive post update after trigger
     // evaluation. Currently this only applies to named events.
@@ -968,6 +1161,15 @@ class TimingControlVisitor final : public VNVisitor {
             AstCAwait* const awaitResumep = awaitEvalp->cloneTree(false);
             VN_AS(awaitResumep->exprp(), CMethodHard)->name("resumption");
             AstNode::addNext<AstNodeStmt, AstNodeStmt>(loopp, awaitResumep->makeStmt());
+            // If all writes of what the trigger reads notify the scheduler, await one of them
+            const auto it = m_dynTriggerGroups.find(nodep);
+            if (it != m_dynTriggerGroups.end()) {
+                evalMethodp->name("evaluationDeps");
+                AstNodeExpr* const pinsp = evalMethodp->pinsp()->unlinkFrBackWithNext();
+                evalMethodp->addPinsp(new AstConst{flp, AstConst::Unsized32{}, it->second});
+                evalMethodp->addPinsp(pinsp);
+                m_dynTriggerGroups.erase(it);
+            }
             // Replace the event control with the loop
             nodep->replaceWith(loopp);
         } else {
@@ -1182,12 +1384,17 @@ class TimingControlVisitor final : public VNVisitor {
         } else if (needDynamicTrigger(condp)) {
             // No point in making a sentree, just use the expression as sensitivity
             // Put the event control in an if so we only wait if the condition isn't met already
-            auto* const ifp = new AstIf{
-                flp, new AstLogNot{flp, condp},
-                new AstEventControl{flp,
-                                    new AstSenTree{flp, new AstSenItem{flp, VEdgeType::ET_TRUE,
-                                                                       condp->cloneTree(false)}},
-                                    nullptr}};
+            AstEventControl* const controlp = new AstEventControl{
+                flp,
+                new AstSenTree{flp,
+                               new AstSenItem{flp, VEdgeType::ET_TRUE, condp->cloneTree(false)}},
+                nullptr};
+            const auto it = m_dynTriggerGroups.find(nodep);
+            if (it != m_dynTriggerGroups.end()) {
+                m_dynTriggerGroups.emplace(controlp, it->second);
+                m_dynTriggerGroups.erase(it);
+            }
+            auto* const ifp = new AstIf{flp, new AstLogNot{flp, condp}, controlp};
             if (stmtsp) AstNode::addNext<AstNode, AstNode>(ifp, stmtsp);
             nodep->replaceWith(ifp);
         } else {
@@ -1204,6 +1411,7 @@ class TimingControlVisitor final : public VNVisitor {
             if (stmtsp) AstNode::addNext<AstNode, AstNode>(loopp, stmtsp);
             nodep->replaceWith(loopp);
         }
+        m_dynTriggerGroups.erase(nodep);
         VL_DO_DANGLING(nodep->deleteTree(), nodep);
     }
     void visit(AstBegin* nodep) override {
@@ -1247,6 +1455,8 @@ public:
     // CONSTRUCTORS
     explicit TimingControlVisitor(AstNetlist* nodep)
         : m_netlistp{nodep} {
+        // Not with threads, as written() may then be called concurrently
+        if (v3Global.opt.fDynTriggerDeps() && !v3Global.opt.mtasks()) addDynTriggerDeps();
         iterate(nodep);
     }
     ~TimingControlVisitor() override = default;
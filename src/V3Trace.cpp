@@ -179,6 +179,8 @@ class TraceVisitor final : public VNVisitor {
     AstTraceDecl* m_tracep = nullptr;  // Trace function adding to graph
     AstVarScope* m_activityVscp = nullptr;  // Activity variable
     uint32_t m_activityNumber = 0;  // Count of fields in activity variable
+    // Activity flags packed into 64-bit words, instead of a byte each
+    const bool m_packedActivity = v3Global.opt.tracePackedActivity();
     uint32_t m_code = 0;  // Trace ident code# being assigned
     V3Graph m_graph;  // Var/CFunc tracking
     TraceActivityVertex* const m_alwaysVtxp;  // "Always trace" vertex
@@ -186,7 +188,7 @@ class TraceVisitor final : public VNVisitor {
 
     // Trace parallelism. Only VCD tracing can be parallelized at this time.
     const uint32_t m_parallelism
-        = v3Global.opt.useTraceParallel() ? static_cast<uint32_t>(v3Global.opt.threads()) : 1;
+        = v3Global.opt.useTraceParallel() ? v3Global.opt.vmTraceThreads() : 1;
 
     VDouble0 m_statSetters;  // Statistic tracking
     VDouble0 m_statSettersSlow;  // Statistic tracking
@@ -394,16 +396,59 @@ class TraceVisitor final : public VNVisitor {
         graphSimplify(false);
     }
 
-    AstNodeExpr* selectActivity(FileLine* flp, uint32_t acode, const VAccess& access) {
-        return new AstArraySel(flp, new AstVarRef{flp, m_activityVscp, access}, acode);
+    // Number of elements in the activity variable
+    uint32_t activityWords() const {
+        return m_packedActivity ? (m_activityNumber + 63) / 64 : m_activityNumber;
+    }
+
+    // Select element of activity variable; with packed activity this is a word of flags
+    AstNodeExpr* selectActivity(FileLine* flp, uint32_t index, const VAccess& access) {
+        return new AstArraySel(flp, new AstVarRef{flp, m_activityVscp, access}, index);
+    }
+
+    // Condition that any of the given activity flags are set
+    AstNodeExpr* activityCondition(FileLine* flp, const ActCodeSet& actSet) {
+        AstNodeExpr* condp = nullptr;
+        if (!m_packedActivity) {
+            for (const uint32_t actCode : actSet) {
+                AstNodeExpr* const selp = selectActivity(flp, actCode, VAccess::READ);
+                condp = condp ? new AstOr{flp, condp, selp} : selp;
+            }
+            return condp;
+        }
+        // Test each word once, with all the flags needed from it
+        std::map<uint32_t, uint64_t> wordMasks;
+        for (const uint32_t actCode : actSet) wordMasks[actCode / 64] |= 1ULL << (actCode % 64);
+        for (const auto& pair : wordMasks) {
+            AstNodeExpr* const selp = new AstNeq{
+                flp,
+                new AstAnd{flp, selectActivity(flp, pair.first, VAccess::READ),
+                           new AstConst{flp, AstConst::Unsized64{}, pair.second}},
+                new AstConst{flp, AstConst::Unsized64{}, 0}};
+            condp = condp ? new AstOr{flp, condp, selp} : selp;
+        }
+        return condp;
     }
 
     AstNode* newActivitySetter(AstNode* insertp, uint32_t code) {
         ++m_statSetters;
         FileLine* const fl = insertp->fileline();
-        AstAssign* const setterp = new AstAssign{fl, selectActivity(fl, code, VAccess::WRITE),
-                                                 new AstConst{fl, AstConst::BitTrue{}}};
-        return setterp;
+        if (!m_packedActivity) {
+            return new AstAssign{fl, selectActivity(fl, code, VAccess::WRITE),
+                                 new AstConst{fl, AstConst::BitTrue{}}};
+        }
+        AstConst* const maskp = new AstConst{fl, AstConst::Unsized64{}, 1ULL << (code % 64)};
+        if (v3Global.opt.threads() > 1) {
+            // Other mtasks might be setting flags in the same word
+            AstCStmt* const setterp = new AstCStmt{fl, "VL_ATOMIC_OR_Q("};
+            setterp->addExprsp(selectActivity(fl, code / 64, VAccess::WRITE));
+            setterp->addExprsp(new AstText{fl, ", ", true});
+            setterp->addExprsp(maskp);
+            setterp->addExprsp(new AstText{fl, ");\n", true});
+            return setterp;
+        }
+        return new AstAssign{fl, selectActivity(fl, code / 64, VAccess::WRITE),
+                             new AstOr{fl, selectActivity(fl, code / 64, VAccess::READ), maskp}};
     }
 
     AstNode* newActivityAll(AstNode* insertp) {
@@ -415,9 +460,19 @@ class TraceVisitor final : public VNVisitor {
             funcp->isStatic(false);
             funcp->isLoose(true);
             m_topScopep->addBlocksp(funcp);
-            for (uint32_t code = 0; code < m_activityNumber; ++code) {
-                AstNode* const setterp = newActivitySetter(insertp, code);
-                funcp->addStmtsp(setterp);
+            if (m_packedActivity) {
+                FileLine* const fl = insertp->fileline();
+                for (uint32_t i = 0; i < activityWords(); ++i) {
+                    ++m_statSetters;
+                    funcp->addStmtsp(
+                        new AstAssign{fl, selectActivity(fl, i, VAccess::WRITE),
+                                      new AstConst{fl, AstConst::Unsized64{}, ~0ULL}});
+                }
+            } else {
+                for (uint32_t code = 0; code < m_activityNumber; ++code) {
+                    AstNode* const setterp = newActivitySetter(insertp, code);
+                    funcp->addStmtsp(setterp);
+                }
             }
             m_actAllFuncp = funcp;
         }
@@ -433,12 +488,14 @@ class TraceVisitor final : public VNVisitor {
         // Create an array of bytes, not a bit vector, as they can be set
         // atomically by mtasks, and are cheaper to set (no need for
         // read-modify-write on the C type), and the speed of the tracing code
-        // is the same on largish designs.
+        // is the same on largish designs. With --trace-packed-activity, use
+        // 64-bit words instead, so the change dump can skip whole words.
         FileLine* const flp = m_topScopep->fileline();
-        AstNodeDType* const newScalarDtp = new AstBasicDType{flp, VFlagBitPacked{}, 1};
+        AstNodeDType* const newScalarDtp
+            = new AstBasicDType{flp, VFlagBitPacked{}, m_packedActivity ? 64 : 1};
         v3Global.rootp()->typeTablep()->addTypesp(newScalarDtp);
         AstRange* const newArange
-            = new AstRange{flp, VNumRange{static_cast<int>(m_activityNumber) - 1, 0}};
+            = new AstRange{flp, VNumRange{static_cast<int>(activityWords()) - 1, 0}};
         AstNodeDType* const newArrDtp = new AstUnpackArrayDType{flp, newScalarDtp, newArange};
         v3Global.rootp()->typeTablep()->addTypesp(newArrDtp);
         AstVar* const newvarp
@@ -625,6 +682,9 @@ class TraceVisitor final : public VNVisitor {
                                       uint32_t parallelism) {
         const int splitLimit = v3Global.opt.outputSplitCTrace() ? v3Global.opt.outputSplitCTrace()
                                                                 : std::numeric_limits<int>::max();
+        // Functions may exceed their size by this much to end where the activity
+        // set changes, so signals computed by the same logic are dumped together
+        const int64_t splitLimitSlack = static_cast<int64_t>(splitLimit) * 5 / 4;
 
         // pre-incremented, so starts at 0
         uint32_t topFuncNum = std::numeric_limits<uint32_t>::max();
@@ -637,12 +697,32 @@ class TraceVisitor final : public VNVisitor {
             uint32_t subFuncNum = 0;
             int subStmts = 0;
             const uint32_t maxCodes = std::max((nAllCodes + parallelism - 1) / parallelism, 1U);
+            const uint32_t maxCodesSlack = maxCodes + maxCodes / 4;
             uint32_t nCodes = 0;
+            const ActCodeSet* lastActSetp = nullptr;  // Activity of last trace in top function
             const ActCodeSet* prevActSet = nullptr;
             AstIf* ifp = nullptr;
+            AstIf* wordIfp = nullptr;  // Check of whole activity word, with packed activity
+            uint32_t wordIfpWord = 0;  // Activity word checked by wordIfp
             uint32_t baseCode = 0;
-            for (; nCodes < maxCodes && it != traces.end(); ++it) {
+            uint32_t endCode = 0;
+            // Let the change sub function skip its codes wholesale when their
+            // scopes are disabled at run time
+            const auto addEnableCheck = [&]() {
+                if (!subChgFuncp || v3Global.opt.useTraceOffload()) return;
+                const std::string stmt = "if (VL_UNLIKELY(!bufp->anyEnabled(oldp, "
+                                         + cvtToStr(endCode - baseCode) + "))) return;\n";
+                subChgFuncp->addInitsp(new AstCStmt{m_topScopep->fileline(), stmt});
+            };
+            for (; it != traces.end(); ++it) {
                 const ActCodeSet& actSet = it->first;
+                // Partition for parallel tracing by code count, preferably where the
+                // activity set changes, so each top function dumps the signals of
+                // whole parts of the model, while they are likely still in cache
+                if (nCodes >= maxCodes
+                    && (nCodes >= maxCodesSlack || !lastActSetp || actSet != *lastActSetp)) {
+                    break;
+                }
                 // Traced value never changes, no need to add it
                 if (actSet.count(TraceActivityVertex::ACTIVITY_NEVER)) continue;
 
@@ -664,7 +744,10 @@ class TraceVisitor final : public VNVisitor {
                 }
 
                 // Create new sub function if required
-                if (!subFulFuncp || subStmts > splitLimit) {
+                if (!subFulFuncp
+                    || (subStmts > splitLimit
+                        && (subStmts > splitLimitSlack || actSet != *prevActSet))) {
+                    addEnableCheck();
                     baseCode = declp->code();
                     subStmts = 0;
                     subFulFuncp = newCFunc(VTraceType::FULL, topFulFuncp, subFuncNum, baseCode);
@@ -672,6 +755,7 @@ class TraceVisitor final : public VNVisitor {
                     ++subFuncNum;
                     prevActSet = nullptr;
                     ifp = nullptr;
+                    wordIfp = nullptr;
                 }
 
                 // If required, create the conditional node checking the activity flags
@@ -682,14 +766,27 @@ class TraceVisitor final : public VNVisitor {
                     if (always) {
                         condp = new AstConst{flp, 1};  // Always true, will be folded later
                     } else {
-                        for (const uint32_t actCode : actSet) {
-                            AstNodeExpr* const selp = selectActivity(flp, actCode, VAccess::READ);
-                            condp = condp ? new AstOr{flp, condp, selp} : selp;
-                        }
+                        condp = activityCondition(flp, actSet);
                     }
                     ifp = new AstIf{flp, condp};
                     if (!always) ifp->branchPred(VBranchPred::BP_UNLIKELY);
-                    subChgFuncp->addStmtsp(ifp);
+                    // With packed activity, nest the checks of flags from the same
+                    // word under a check of the whole word, to skip inactive words
+                    const uint32_t word = *actSet.begin() / 64;
+                    if (!m_packedActivity || always || *actSet.rbegin() / 64 != word) {
+                        wordIfp = nullptr;
+                        subChgFuncp->addStmtsp(ifp);
+                    } else {
+                        if (!wordIfp || wordIfpWord != word) {
+                            wordIfp = new AstIf{
+                                flp, new AstNeq{flp, selectActivity(flp, word, VAccess::READ),
+                                                new AstConst{flp, AstConst::Unsized64{}, 0}}};
+                            wordIfp->branchPred(VBranchPred::BP_UNLIKELY);
+                            wordIfpWord = word;
+                            subChgFuncp->addStmtsp(wordIfp);
+                        }
+                        wordIfp->addThensp(ifp);
+                    }
                     subStmts += ifp->nodeCount();
                     prevActSet = &actSet;
                 }
@@ -718,7 +815,10 @@ class TraceVisitor final : public VNVisitor {
 
                 // Track partitioning
                 nCodes += declp->codeInc();
+                lastActSetp = &actSet;
+                endCode = declp->code() + declp->codeInc();
             }
+            addEnableCheck();
         }
     }
 
@@ -745,9 +845,12 @@ class TraceVisitor final : public VNVisitor {
             new AstCStmt{m_topScopep->fileline(), "vlSymsp->__Vm_activity = false;\n"s});
 
         // Clear fine grained activity flags
-        for (uint32_t i = 0; i < m_activityNumber; ++i) {
-            AstNode* const clrp = new AstAssign{fl, selectActivity(fl, i, VAccess::WRITE),
-                                                new AstConst{fl, AstConst::BitFalse{}}};
+        for (uint32_t i = 0; i < activityWords(); ++i) {
+            AstConst* const zerop = m_packedActivity
+                                        ? new AstConst{fl, AstConst::Unsized64{}, 0}
+                                        : new AstConst{fl, AstConst::BitFalse{}};
+            AstNode* const clrp
+                = new AstAssign{fl, selectActivity(fl, i, VAccess::WRITE), zerop};
             cleanupFuncp->addStmtsp(clrp);
         }
     }
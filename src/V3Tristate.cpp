@@ -653,30 +653,31 @@ class TristateVisitor final : public TristateBaseVisitor {
         }
     }
 
-    void aggregateTriSameStrength(AstNodeModule* nodep, AstVar* const varp, AstVar* const envarp,
-                                  RefStrengthVec::iterator beginStrength,
-                                  RefStrengthVec::iterator endStrength) {
+    void aggregateTriSameStrength(AstNodeModule* nodep, AstVar* const invarp,
+                                  const string& prefix, RefStrengthVec::iterator beginStrength,
+                                  RefStrengthVec::iterator endStrength, AstNodeExpr*& orp,
+                                  AstNodeExpr*& enp) {
         // For each driver separate variables (normal and __en) are created and initialized with
         // values. In case of normal variable, the original expression is reused. Their values are
-        // aggregated using | to form one expression, which are assigned to varp end envarp.
-        AstNodeExpr* orp = nullptr;
-        AstNodeExpr* enp = nullptr;
+        // aggregated using | into whole-word expressions, returned in orp and enp.
+        orp = nullptr;
+        enp = nullptr;
 
         for (auto it = beginStrength; it != endStrength; it++) {
             AstVarRef* refp = it->m_varrefp;
 
             // create the new lhs driver for this var
-            AstVar* const newLhsp = new AstVar{varp->fileline(), VVarType::MODULETEMP,
-                                               varp->name() + "__out" + cvtToStr(m_unique),
-                                               varp};  // 2-state ok; sep enable
+            AstVar* const newLhsp = new AstVar{invarp->fileline(), VVarType::MODULETEMP,
+                                               prefix + "__out" + cvtToStr(m_unique),
+                                               invarp};  // 2-state ok; sep enable
             UINFO(9, "       newout " << newLhsp);
             nodep->addStmtsp(newLhsp);
             refp->varp(newLhsp);
 
             // create a new var for this drivers enable signal
             AstVar* const newEnLhsp
-                = new AstVar{varp->fileline(), VVarType::MODULETEMP,
-                             varp->name() + "__en" + cvtToStr(m_unique++), envarp};  // 2-state ok
+                = new AstVar{invarp->fileline(), VVarType::MODULETEMP,
+                             prefix + "__en" + cvtToStr(m_unique++), invarp};  // 2-state ok
             UINFO(9, "       newenlhsp " << newEnLhsp);
             nodep->addStmtsp(newEnLhsp);
 
@@ -697,15 +698,6 @@ class TristateVisitor final : public TristateBaseVisitor {
             AstNodeExpr* const ref3p = new AstVarRef{refp->fileline(), newEnLhsp, VAccess::READ};
             enp = (!enp) ? ref3p : new AstOr{ref3p->fileline(), enp, ref3p};
         }
-        AstNode* const assp = new AstAssignW{
-            varp->fileline(), new AstVarRef{varp->fileline(), varp, VAccess::WRITE}, orp};
-        UINFO(9, "       newassp " << assp);
-        nodep->addStmtsp(assp);
-
-        AstNode* const enAssp = new AstAssignW{
-            envarp->fileline(), new AstVarRef{envarp->fileline(), envarp, VAccess::WRITE}, enp};
-        UINFO(9, "       newenassp " << enAssp);
-        nodep->addStmtsp(enAssp);
     }
 
     void insertTristatesSignal(AstNodeModule* nodep, AstVar* const invarp, RefStrengthVec* refsp) {
@@ -763,6 +755,19 @@ class TristateVisitor final : public TristateBaseVisitor {
             FileLine* const fl = beginStrength->m_varrefp->fileline();
             const string strengthVarName = lhsp->name() + "__" + beginStrength->m_strength.ascii();
 
+            AstNodeExpr* strengthOrp;
+            AstNodeExpr* strengthEnp;
+            aggregateTriSameStrength(nodep, invarp, strengthVarName, beginStrength, endStrength,
+                                     strengthOrp, strengthEnp);
+
+            if (!enp && endStrength == refsp->end()) {
+                // All drivers have the same strength, so nothing gets overwritten by a stronger
+                // driver; resolve straight from the drivers without per-strength variables
+                orp = strengthOrp;
+                enp = strengthEnp;
+                break;
+            }
+
             // var__strength variable
             AstVar* varStrengthp = new AstVar{fl, VVarType::MODULETEMP, strengthVarName,
                                               invarp};  // 2-state ok; sep enable;
@@ -775,8 +780,15 @@ class TristateVisitor final : public TristateBaseVisitor {
             UINFO(9, "       newenstrength " << enVarStrengthp);
             nodep->addStmtsp(enVarStrengthp);
 
-            aggregateTriSameStrength(nodep, varStrengthp, enVarStrengthp, beginStrength,
-                                     endStrength);
+            AstNode* const assp = new AstAssignW{
+                fl, new AstVarRef{fl, varStrengthp, VAccess::WRITE}, strengthOrp};
+            UINFO(9, "       newassp " << assp);
+            nodep->addStmtsp(assp);
+
+            AstNode* const enAssp = new AstAssignW{
+                fl, new AstVarRef{fl, enVarStrengthp, VAccess::WRITE}, strengthEnp};
+            UINFO(9, "       newenassp " << enAssp);
+            nodep->addStmtsp(enAssp);
 
             AstNodeExpr* exprCurrentStrengthp;
             if (enp) {
@@ -20,6 +20,10 @@
 //
 // 0 1 0 on a, b, c turns into !a&b&~c
 //
+// A combinational UDP whose table gives a 0 or 1 output for every input
+// combination instead becomes a single lookup into a constant truth table,
+// indexed by the inputs.
+//
 //*************************************************************************
 
 #include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
@@ -27,12 +31,16 @@
 #include "V3Udp.h"
 
 #include "V3Error.h"
+#include "V3Stats.h"
 
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
 class UdpVisitor final : public VNVisitor {
+    // Most inputs of a combinational UDP made into a truth table, so the table is one word
+    static constexpr size_t TRUTH_TABLE_MAX_INPUTS = 6;
+
     bool m_inInitial = false;  // Is inside of an initial block
     AstVar* m_oFieldVarp = nullptr;  // Output filed var of table line
     std::vector<AstVar*> m_inputVars;  // All the input vars in the AstPrimitive
@@ -41,6 +49,7 @@ class UdpVisitor final : public VNVisitor {
     bool m_isFirstOutput = false;  // Whether the first IO port is output
     AstVarRef* m_outputInitVerfp = nullptr;  // Initial output value for sequential UDP
     AstAlways* m_alwaysBlockp = nullptr;  // Main Always block in UDP transform
+    VDouble0 m_statTruthTables;  // Statistic tracking
 
     void visit(AstInitial* nodep) override {
         VL_RESTORER(m_inInitial);
@@ -97,8 +106,58 @@ class UdpVisitor final : public VNVisitor {
         fl->warnOff(V3ErrorCode::LATCH, true);
         iterateChildren(nodep);
 
+        if (AstNodeExpr* const lookupp = makeTruthTable(nodep)) {
+            if (AstNode* const stmtsp = m_alwaysBlockp->stmtsp()) {
+                pushDeletep(stmtsp->unlinkFrBackWithNext());
+            }
+            m_alwaysBlockp->addStmtsp(new AstAssign{
+                fl, new AstVarRef{fl, m_oFieldVarp, VAccess::WRITE}, lookupp});
+            ++m_statTruthTables;
+        }
         nodep->replaceWith(m_alwaysBlockp);
     }
+    // Return lookup of the output in a truth table of a combinational UDP, or nullptr if
+    // not possible, as some input combination is unmatched or gives 'x'
+    AstNodeExpr* makeTruthTable(AstUdpTable* nodep) {
+        const size_t inputs = m_inputVars.size();
+        if (!inputs || inputs > TRUTH_TABLE_MAX_INPUTS) return nullptr;
+        const uint32_t entries = 1U << inputs;
+        std::vector<int> outputs(entries, -1);  // Output of each input combination
+        for (AstUdpTableLine* linep = nodep->linesp(); linep;
+             linep = VN_AS(linep->nextp(), UdpTableLine)) {
+            if (!linep->udpIsCombo()) return nullptr;
+            const string& oValName = linep->oFieldsp()->name();
+            if (oValName != "0" && oValName != "1") return nullptr;
+            // As with the conditions made by visit(AstUdpTableLine), 'x' matches any value
+            uint32_t careMask = 0;
+            uint32_t careValue = 0;
+            size_t i = 0;
+            for (AstNode* iNodep = linep->iFieldsp(); iNodep; iNodep = iNodep->nextp(), ++i) {
+                const string& valName = iNodep->name();
+                if (valName == "0" || valName == "1") {
+                    careMask |= 1U << i;
+                    if (valName == "1") careValue |= 1U << i;
+                }
+            }
+            if (i != inputs) return nullptr;
+            // Later lines override earlier ones, as the assignments made for them would
+            for (uint32_t index = 0; index < entries; ++index) {
+                if ((index & careMask) == careValue) outputs[index] = oValName == "1";
+            }
+        }
+        V3Number table{nodep, static_cast<int>(entries)};
+        for (uint32_t index = 0; index < entries; ++index) {
+            if (outputs[index] < 0) return nullptr;  // Would keep the previous output
+            table.setBit(index, static_cast<char>(outputs[index]));
+        }
+        FileLine* const fl = nodep->fileline();
+        AstNodeExpr* indexp = nullptr;
+        for (AstVar* const varp : m_inputVars) {  // First input is the index LSB
+            AstNodeExpr* const refp = new AstVarRef{fl, varp, VAccess::READ};
+            indexp = indexp ? new AstConcat{fl, refp, indexp} : refp;
+        }
+        return new AstSel{fl, new AstConst{fl, table}, indexp, 1};
+    }
     void visit(AstUdpTableLine* nodep) override {
         FileLine* const fl = nodep->fileline();
         if (!nodep->udpIsCombo() && !m_oFieldVarp->isBitLogic()) {
@@ -227,7 +286,9 @@ class UdpVisitor final : public VNVisitor {
 public:
     // CONSTRUCTORS
     explicit UdpVisitor(AstNetlist* nodep) { iterate(nodep); }
-    ~UdpVisitor() override = default;
+    ~UdpVisitor() override {
+        V3Stats::addStat("Optimizations, UDP truth tables", m_statTruthTables);
+    }
 };
 
 void V3Udp::udpResolve(AstNetlist* rootp) {
@@ -23,11 +23,12 @@
 //
 //*************************************************************************
 
-#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+#include "V3PchAstMT.h"
 
 #include "V3Undriven.h"
 
 #include "V3Stats.h"
+#include "V3ThreadPool.h"
 
 #include <vector>
 
@@ -53,6 +54,21 @@ class UndrivenVarEntry final {
 
     enum : uint8_t { FLAG_USED = 0, FLAG_DRIVEN = 1, FLAG_DRIVEN_ALWCOMB = 2, FLAGS_PER_BIT = 3 };
 
+    // Disposition of the bits, computed by summarize() for reportViolations()
+    struct Summary final {
+        bool unusedMatch = false;  // Name matches --unused-regexp
+        bool allU = true;  // All bits used
+        bool allD = true;  // All bits driven
+        bool anyU = false;  // Some bit used
+        bool anyD = false;  // Some bit driven
+        bool anyUnotD = false;  // Some bit used, but not driven
+        bool anyDnotU = false;  // Some bit driven, but not used
+        bool anynotDU = false;  // Some bit neither driven nor used
+        string bitsBoth;  // Bits neither driven nor used, if bits differ
+        string bitsUnused;  // Bits driven but not used, if bits differ
+        string bitsUndriven;  // Bits used but not driven, if bits differ
+    } m_summary;
+
 public:
     // CONSTRUCTORS
     explicit UndrivenVarEntry(AstVar* varp)
@@ -175,9 +191,40 @@ public:
         const string prettyName = nodep->prettyName();
         return VString::wildmatch(prettyName.c_str(), regexp.c_str());
     }
+    // Combine bits into overall state.  Only reads this entry and its variable,
+    // so can be called in parallel with other entries.
+    void summarize() {
+        Summary& s = m_summary;
+        s.unusedMatch = unusedMatch(m_varp);
+        if (m_varp->isGenVar() || m_varp->isParam()) return;
+        s.anyU = m_wholeFlags[FLAG_USED];
+        s.anyD = m_wholeFlags[FLAG_DRIVEN];
+        for (unsigned bit = 0; bit < m_bitFlags.size() / FLAGS_PER_BIT; bit++) {
+            const bool used = usedFlag(bit);
+            const bool driv = drivenFlag(bit);
+            s.allU &= used;
+            s.anyU |= used;
+            s.allD &= driv;
+            s.anyD |= driv;
+            s.anyUnotD |= used && !driv;
+            s.anyDnotU |= !used && driv;
+            s.anynotDU |= !used && !driv;
+        }
+        if (s.allU) m_wholeFlags[FLAG_USED] = true;
+        if (s.allD) m_wholeFlags[FLAG_DRIVEN] = true;
+        // Bit lists are only reported when bits have different dispositions
+        if ((s.allU && s.allD) || (!s.anyD && !s.anyU) || (s.allD && !s.anyU)
+            || (!s.anyD && s.allU)) {
+            return;
+        }
+        if (s.anynotDU) s.bitsBoth = bitNames(BN_BOTH);
+        if (s.anyDnotU) s.bitsUnused = bitNames(BN_UNUSED);
+        if (s.anyUnotD) s.bitsUndriven = bitNames(BN_UNDRIVEN);
+    }
+    // Report using the state from summarize()
     void reportViolations() {
-        // Combine bits into overall state
         AstVar* const nodep = m_varp;
+        const Summary& s = m_summary;
 
         if (initStaticp() && procWritep() && !nodep->isClassMember() && !nodep->isFuncLocal()) {
             initStaticp()->v3warn(
@@ -192,81 +239,60 @@ public:
                     << procWritep()->warnContextSecondary());
         }
         if (nodep->isGenVar()) {  // Genvar
-            if (!nodep->isIfaceRef() && !nodep->isUsedParam() && !unusedMatch(nodep)) {
+            if (!nodep->isIfaceRef() && !nodep->isUsedParam() && !s.unusedMatch) {
                 nodep->v3warn(UNUSEDGENVAR, "Genvar is not used: " << nodep->prettyNameQ());
                 nodep->fileline()->modifyWarnOff(V3ErrorCode::UNUSEDGENVAR,
                                                  true);  // Warn only once
             }
         } else if (nodep->isParam()) {  // Parameter
-            if (!nodep->isIfaceRef() && !nodep->isUsedParam() && !unusedMatch(nodep)) {
+            if (!nodep->isIfaceRef() && !nodep->isUsedParam() && !s.unusedMatch) {
                 nodep->v3warn(UNUSEDPARAM, "Parameter is not used: " << nodep->prettyNameQ());
                 nodep->fileline()->modifyWarnOff(V3ErrorCode::UNUSEDPARAM,
                                                  true);  // Warn only once
             }
         } else {  // Signal
-            bool allU = true;
-            bool allD = true;
-            bool anyU = m_wholeFlags[FLAG_USED];
-            bool anyD = m_wholeFlags[FLAG_DRIVEN];
-            bool anyUnotD = false;
-            bool anyDnotU = false;
-            bool anynotDU = false;
-            for (unsigned bit = 0; bit < m_bitFlags.size() / FLAGS_PER_BIT; bit++) {
-                const bool used = usedFlag(bit);
-                const bool driv = drivenFlag(bit);
-                allU &= used;
-                anyU |= used;
-                allD &= driv;
-                anyD |= driv;
-                anyUnotD |= used && !driv;
-                anyDnotU |= !used && driv;
-                anynotDU |= !used && !driv;
-            }
-            if (allU) m_wholeFlags[FLAG_USED] = true;
-            if (allD) m_wholeFlags[FLAG_DRIVEN] = true;
             // Test results
             if (nodep->isIfaceRef()) {
                 // For interface top level we don't do any tracking
                 // Ideally we'd report unused instance cells, but presumably a signal inside one
                 // would get reported as unused
-            } else if (allU && allD) {
+            } else if (s.allU && s.allD) {
                 // It's fine
-            } else if (!anyD && !anyU) {
+            } else if (!s.anyD && !s.anyU) {
                 // UNDRIVEN is considered more serious - as is more likely a bug,
                 // thus undriven+unused bits get UNUSED warnings, as they're not as buggy.
-                if (!unusedMatch(nodep)) {
+                if (!s.unusedMatch) {
                     nodep->v3warn(UNUSEDSIGNAL,
                                   "Signal is not driven, nor used: " << nodep->prettyNameQ());
                     nodep->fileline()->modifyWarnOff(V3ErrorCode::UNUSEDSIGNAL,
                                                      true);  // Warn only once
                 }
-            } else if (allD && !anyU) {
-                if (!unusedMatch(nodep)) {
+            } else if (s.allD && !s.anyU) {
+                if (!s.unusedMatch) {
                     nodep->v3warn(UNUSEDSIGNAL, "Signal is not used: " << nodep->prettyNameQ());
                     nodep->fileline()->modifyWarnOff(V3ErrorCode::UNUSEDSIGNAL,
                                                      true);  // Warn only once
                 }
-            } else if (!anyD && allU) {
+            } else if (!s.anyD && s.allU) {
                 nodep->v3warn(UNDRIVEN, "Signal is not driven: " << nodep->prettyNameQ());
                 nodep->fileline()->modifyWarnOff(V3ErrorCode::UNDRIVEN, true);  // Warn only once
             } else {
                 // Bits have different dispositions
                 bool setU = false;
                 bool setD = false;
-                if (anynotDU && !unusedMatch(nodep)) {
+                if (s.anynotDU && !s.unusedMatch) {
                     nodep->v3warn(UNUSEDSIGNAL, "Bits of signal are not driven, nor used: "
-                                                    << nodep->prettyNameQ() << bitNames(BN_BOTH));
+                                                    << nodep->prettyNameQ() << s.bitsBoth);
                     setU = true;
                 }
-                if (anyDnotU && !unusedMatch(nodep)) {
-                    nodep->v3warn(UNUSEDSIGNAL,
-                                  "Bits of signal are not used: " << nodep->prettyNameQ()
-                                                                  << bitNames(BN_UNUSED));
+                if (s.anyDnotU && !s.unusedMatch) {
+                    nodep->v3warn(UNUSEDSIGNAL, "Bits of signal are not used: "
+                                                    << nodep->prettyNameQ() << s.bitsUnused);
                     setU = true;
                 }
-                if (anyUnotD) {
+                if (s.anyUnotD) {
                     nodep->v3warn(UNDRIVEN, "Bits of signal are not driven: "
-                                                << nodep->prettyNameQ() << bitNames(BN_UNDRIVEN));
+                                                << nodep->prettyNameQ() << s.bitsUndriven);
                     setD = true;
                 }
                 if (setU) {  // Warn only once
@@ -555,10 +581,24 @@ class UndrivenVisitor final : public VNVisitorConst {
     void visit(AstConst* nodep) override {}
     void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
 
+    // Summarize entries in parallel.  Reporting stays serial, in order of discovery, so
+    // messages and the "warn only once" suppressions are the same for any thread count.
+    static void summarizeAll(const std::vector<UndrivenVarEntry*>& entryps) {
+        constexpr size_t CHUNK_SIZE = 1024;  // Entries per job
+        V3ThreadScope threadScope;
+        for (size_t begin = 0; begin < entryps.size(); begin += CHUNK_SIZE) {
+            const size_t end = std::min(begin + CHUNK_SIZE, entryps.size());
+            threadScope.enqueue([&entryps, begin, end]() {
+                for (size_t i = begin; i < end; ++i) entryps[i]->summarize();
+            });
+        }
+    }
+
 public:
     // CONSTRUCTORS
     explicit UndrivenVisitor(AstNetlist* nodep) { iterateConst(nodep); }
     ~UndrivenVisitor() override {
+        summarizeAll(m_entryps[1]);
         for (UndrivenVarEntry* ip : m_entryps[1]) ip->reportViolations();
         for (int usr = 1; usr < 3; ++usr) {
             for (UndrivenVarEntry* ip : m_entryps[usr]) delete ip;
@@ -17,6 +17,10 @@
 //
 // Each module:
 //   Order module variables
+//   With mtasks, separate hot written, hot read-only and cold variables
+//   into cache line aligned regions
+//   With mtasks, pad hot variables written by different mtasks into
+//   separate cache lines
 //
 //*************************************************************************
 
@@ -37,6 +41,14 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 using MTaskIdVec = std::vector<bool>;  // Used as a bit-set indexed by MTask ID
 using MTaskAffinityMap = std::unordered_map<const AstVar*, MTaskIdVec>;
 
+// How a variable is accessed from MTasks
+struct VarAccess final {
+    uint64_t heat = 0;  // Sum of costs of MTasks referencing it (measured with profile data)
+    bool written = false;  // Written by some MTask
+    MTaskIdVec writers;  // MTasks writing it, empty if not written
+};
+using VarAccessMap = std::unordered_map<const AstVar*, VarAccess>;
+
 // Trace through code reachable form an MTask and annotate referenced variabels
 class GatherMTaskAffinity final : VNVisitorConst {
     // NODE STATE
@@ -46,13 +58,18 @@ class GatherMTaskAffinity final : VNVisitorConst {
 
     // STATE
     MTaskAffinityMap& m_results;  // The result map being built;
+    VarAccessMap& m_accesses;  // The access map being built
     const uint32_t m_id;  // Id of mtask being analysed
+    const uint32_t m_cost;  // Cost of mtask being analysed
     const size_t m_usedIds = ExecMTask::numUsedIds();  // Value of max id + 1
 
     // CONSTRUCTOR
-    GatherMTaskAffinity(const ExecMTask* mTaskp, MTaskAffinityMap& results)
+    GatherMTaskAffinity(const ExecMTask* mTaskp, MTaskAffinityMap& results,
+                        VarAccessMap& accesses)
         : m_results{results}
-        , m_id{mTaskp->id()} {
+        , m_accesses{accesses}
+        , m_id{mTaskp->id()}
+        , m_cost{mTaskp->cost()} {
         iterateChildrenConst(mTaskp->bodyp());
     }
     ~GatherMTaskAffinity() = default;
@@ -72,7 +89,15 @@ class GatherMTaskAffinity final : VNVisitorConst {
                                             std::forward_as_tuple(varp),  //
                                             std::forward_as_tuple(m_usedIds))
                                    .first->second;
+        VarAccess& access = m_accesses[varp];
+        if (nodep->access().isWriteOrRW()) {
+            access.written = true;
+            if (access.writers.empty()) access.writers.resize(m_usedIds);
+            access.writers[m_id] = true;
+        }
+        if (affinity[m_id]) return;
         affinity[m_id] = true;
+        access.heat += m_cost;
     }
 
     void visit(AstCFunc* nodep) override {
@@ -88,8 +113,9 @@ class GatherMTaskAffinity final : VNVisitorConst {
     void visit(AstNode* nodep) override { iterateChildrenConst(nodep); }
 
 public:
-    static void apply(const ExecMTask* mTaskp, MTaskAffinityMap& results) {
-        GatherMTaskAffinity{mTaskp, results};
+    static void apply(const ExecMTask* mTaskp, MTaskAffinityMap& results,
+                      VarAccessMap& accesses) {
+        GatherMTaskAffinity{mTaskp, results, accesses};
     }
 };
 
@@ -133,14 +159,27 @@ struct VarAttributes final {
     bool anonOk;  // Can be emitted as part of anonymous structure
 };
 class VariableOrder final {
+    // CONSTANTS
+    // Above this many distinct MTask affinities in a module, order them by
+    // sorting instead of with the TSP heuristic, which grows super-linearly
+    static constexpr size_t TSP_MAX_SETS = 2000;
+
+    // TYPES
+    // Cache line separated regions of MTask accessed variables, in emission order
+    enum Region : uint8_t { HOT_WRITTEN, HOT_READ, COLD };
+
     std::unordered_map<const AstVar*, VarAttributes> m_attributes;
 
     const MTaskAffinityMap& m_mTaskAffinity;
+    const VarAccessMap& m_accesses;
+    const uint64_t m_hotHeat;  // Minimum heat of a hot variable
     std::vector<AstVar*>& m_varps;
 
     VariableOrder(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
-                  std::vector<AstVar*>& varps)
+                  const VarAccessMap& accesses, uint64_t hotHeat, std::vector<AstVar*>& varps)
         : m_mTaskAffinity{mTaskAffinity}
+        , m_accesses{accesses}
+        , m_hotHeat{hotHeat}
         , m_varps{varps} {
         orderModuleVars(modp);
     }
@@ -179,17 +218,25 @@ class VariableOrder final {
             m2v[key].push_back(varp);
         }
 
-        // Create a TSP sort state for each unique MTaskIdSet, except for the empty set
-        V3TSP::StateVec states;
+        // Order the unique MTaskIdSets, except for the empty set
+        std::vector<const MTaskIdVec*> sets;
         for (const auto& pair : m2v) {
             const MTaskIdVec& vec = pair.first;
             const bool empty = std::find(vec.begin(), vec.end(), true) == vec.end();
-            if (!empty) states.push_back(new VarTspSorter{vec});
+            if (!empty) sets.push_back(&vec);
         }
-
-        // Do the TSP sort
-        V3TSP::StateVec sortedStates;
-        V3TSP::tspSort(states, &sortedStates);
+        if (sets.size() > TSP_MAX_SETS) {
+            graySortSets(sets);
+        } else {
+            tspSortSets(sets);
+        }
+        uint64_t distance = 0;
+        for (size_t i = 1; i < sets.size(); ++i) {
+            const MTaskIdVec& prev = *sets[i - 1];
+            const MTaskIdVec& vec = *sets[i];
+            for (size_t j = 0; j < vec.size(); ++j) distance += vec[j] != prev[j];
+        }
+        V3Stats::addStatSum("Optimizations, Variable order affinity distance", distance);
 
         varps.clear();
 
@@ -200,14 +247,145 @@ class VariableOrder final {
         };
 
         // Enumerate by sorted MTaskIdSet, sort within the set separately
+        for (const MTaskIdVec* const setp : sets) sortAndAppend(m2v[*setp]);
+
+        // Finally add the variables with no known MTask affinity
+        sortAndAppend(m2v[emptyVec]);
+
+        // Separate the regions, keeping the order within each
+        std::stable_sort(varps.begin(), varps.end(), [this](const AstVar* ap, const AstVar* bp) {
+            return region(ap) < region(bp);
+        });
+        alignRegions(varps);
+        padSharedLines(varps);
+    }
+
+    // Order MTaskIdSets to minimize the number of MTasks differing between
+    // neighbours, using the TSP heuristic
+    static void tspSortSets(std::vector<const MTaskIdVec*>& sets) {
+        V3TSP::StateVec states;
+        for (const MTaskIdVec* const setp : sets) states.push_back(new VarTspSorter{*setp});
+        V3TSP::StateVec sortedStates;
+        V3TSP::tspSort(states, &sortedStates);
+        sets.clear();
         for (const V3TSP::TspStateBase* const stateBasep : sortedStates) {
             const VarTspSorter* const statep = dynamic_cast<const VarTspSorter*>(stateBasep);
-            sortAndAppend(m2v[statep->mTaskIds()]);
+            sets.push_back(&statep->mTaskIds());
             VL_DO_DANGLING(delete statep, statep);
         }
+    }
 
-        // Finally add the variables with no known MTask affinity
-        sortAndAppend(m2v[emptyVec]);
+    // Order MTaskIdSets by their position along a binary reflected Gray code,
+    // which visits every bitset changing one bit per step, so sets near each
+    // other share most MTasks. This is a sort, so scales to modules with too
+    // many sets for the TSP heuristic, at the cost of a longer tour.
+    static void graySortSets(std::vector<const MTaskIdVec*>& sets) {
+        // The Gray code position of a set is its prefix parity, compared as a bit string
+        std::vector<std::pair<MTaskIdVec, const MTaskIdVec*>> keyed;
+        keyed.reserve(sets.size());
+        for (const MTaskIdVec* const setp : sets) {
+            MTaskIdVec position(setp->size());
+            bool parity = false;
+            for (size_t i = 0; i < setp->size(); ++i) {
+                parity ^= (*setp)[i];
+                position[i] = parity;
+            }
+            keyed.emplace_back(std::move(position), setp);
+        }
+        std::sort(keyed.begin(), keyed.end());
+        sets.clear();
+        for (const auto& pair : keyed) sets.push_back(pair.second);
+    }
+
+    Region region(const AstVar* varp) const {
+        const auto it = m_accesses.find(varp);
+        if (it == m_accesses.end() || it->second.heat < m_hotHeat) return COLD;
+        return it->second.written ? HOT_WRITTEN : HOT_READ;
+    }
+
+    static bool inLayout(const AstVar* varp) {
+        // Static members and parameters are not part of the module struct
+        return !varp->isStatic() && !varp->isParam();
+    }
+
+    // Start each region on a new cache line, so hot written variables don't share lines with
+    // read-mostly ones.
+    void alignRegions(const std::vector<AstVar*>& varps) {
+        const AstVar* prevp = nullptr;
+        for (AstVar* const varp : varps) {
+            if (!inLayout(varp)) continue;
+            // The module struct itself is aligned, no need to align the first variable
+            if (prevp && region(varp) != region(prevp)) varp->alignCacheLine(true);
+            prevp = varp;
+        }
+    }
+
+    // Walk the estimated layout of the module struct, assuming it starts on a cache line.
+    // Where a hot variable written by some MTasks would share a line with a hot variable
+    // written by different MTasks, start it on a new line instead. Cold variables are not
+    // padded, lines still shared between MTask writers are counted for --stats.
+    void padSharedLines(const std::vector<AstVar*>& varps) {
+        const auto roundUp = [](uint64_t value, uint64_t align) {
+            return (value + align - 1) / align * align;
+        };
+        uint64_t offset = 0;  // Estimated offset of next variable
+        const VarAccess* lastp = nullptr;  // Last variable written by MTasks
+        bool lastHot = false;  // Last variable written by MTasks is hot
+        uint64_t lastLine = 0;  // Cache line holding the end of the last written variable
+        bool lastLineShared = false;  // That line is already counted as shared
+        const MTaskIdVec* lineAffinityp = nullptr;  // Affinity of first variable on line
+        uint64_t affinityLine = 0;  // Cache line lineAffinityp is for
+        bool affinityMixed = false;  // That line has variables of other affinities
+        uint64_t pads = 0;
+        uint64_t shared = 0;
+        uint64_t lines = 0;
+        uint64_t mixed = 0;
+        for (AstVar* const varp : varps) {
+            if (!inLayout(varp)) continue;
+            const AstNodeDType* const dtypep = varp->dtypeSkipRefp();
+            offset = roundUp(offset, std::max(dtypep->widthAlignBytes(), 1));
+            if (varp->alignCacheLine()) offset = roundUp(offset, VL_CACHE_LINE_BYTES);
+            const auto it = m_accesses.find(varp);
+            const VarAccess* const accessp = it == m_accesses.end() ? nullptr : &it->second;
+            const bool written = accessp && accessp->written;
+            const bool hot = region(varp) == HOT_WRITTEN;
+            if (written && lastp && offset / VL_CACHE_LINE_BYTES == lastLine
+                && accessp->writers != lastp->writers) {
+                if (hot && lastHot) {
+                    varp->alignCacheLine(true);
+                    offset = roundUp(offset, VL_CACHE_LINE_BYTES);
+                    ++pads;
+                } else if (!lastLineShared) {
+                    lastLineShared = true;
+                    ++shared;
+                }
+            }
+            const auto affIt = m_mTaskAffinity.find(varp);
+            if (affIt != m_mTaskAffinity.end()) {
+                const uint64_t line = offset / VL_CACHE_LINE_BYTES;
+                if (!lineAffinityp || line != affinityLine) {
+                    lineAffinityp = &affIt->second;
+                    affinityLine = line;
+                    affinityMixed = false;
+                    ++lines;
+                } else if (!affinityMixed && affIt->second != *lineAffinityp) {
+                    affinityMixed = true;
+                    ++mixed;
+                }
+            }
+            offset += std::max(dtypep->widthTotalBytes(), 1);
+            if (written) {
+                const uint64_t line = (offset - 1) / VL_CACHE_LINE_BYTES;
+                if (!lastp || line != lastLine) lastLineShared = false;
+                lastp = accessp;
+                lastHot = hot;
+                lastLine = line;
+            }
+        }
+        V3Stats::addStatSum("Optimizations, Variable order false sharing pads", pads);
+        V3Stats::addStatSum("Optimizations, Variable order lines shared by mtask writers", shared);
+        V3Stats::addStatSum("Optimizations, Variable order lines used by mtasks", lines);
+        V3Stats::addStatSum("Optimizations, Variable order lines of mixed mtask affinity", mixed);
     }
 
     void orderModuleVars(AstNodeModule* modp) {
@@ -245,8 +423,9 @@ class VariableOrder final {
 
 public:
     static void processModule(AstNodeModule* modp, const MTaskAffinityMap& mTaskAffinity,
+                              const VarAccessMap& accesses, uint64_t hotHeat,
                               std::vector<AstVar*>& varps) VL_MT_STABLE {
-        VariableOrder{modp, mTaskAffinity, varps};
+        VariableOrder{modp, mTaskAffinity, accesses, hotHeat, varps};
     }
 };
 
@@ -257,15 +436,20 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
     UINFO(2, __FUNCTION__ << ":");
 
     MTaskAffinityMap mTaskAffinity;
+    VarAccessMap accesses;
 
     // Gather MTask affinities
     if (v3Global.opt.mtasks()) {
         netlistp->topModulep()->foreach([&](AstExecGraph* execGraphp) {
             for (const V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
-                GatherMTaskAffinity::apply(vtx.as<const ExecMTask>(), mTaskAffinity);
+                GatherMTaskAffinity::apply(vtx.as<const ExecMTask>(), mTaskAffinity, accesses);
             }
         });
     }
+    // Variables with at least 1% of the heat of the hottest variable are hot
+    uint64_t maxHeat = 0;
+    for (const auto& pair : accesses) maxHeat = std::max(maxHeat, pair.second.heat);
+    const uint64_t hotHeat = std::max<uint64_t>(1, maxHeat / 100);
     if (v3Global.opt.stats()) V3Stats::statsStage("variableorder-gather");
 
     // Sort variables for each module
@@ -276,8 +460,8 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
         for (AstNodeModule* modp = v3Global.rootp()->modulesp(); modp;
              modp = VN_AS(modp->nextp(), NodeModule)) {
             std::vector<AstVar*>& varps = sortedVars[modp];
-            threadScope.enqueue([modp, mTaskAffinity, &varps]() {
-                VariableOrder::processModule(modp, mTaskAffinity, varps);
+            threadScope.enqueue([modp, &mTaskAffinity, &accesses, hotHeat, &varps]() {
+                VariableOrder::processModule(modp, mTaskAffinity, accesses, hotHeat, varps);
             });
         }
     }
@@ -80,10 +80,6 @@
 #include "V3Task.h"
 #include "V3WidthCommit.h"
 
-// More code; this file was getting too large; see actions there
-#define VERILATOR_V3WIDTH_CPP_
-#include "V3WidthRemove.h"
-
 VL_DEFINE_DEBUG_FUNCTIONS;
 
 //######################################################################
@@ -177,26 +173,6 @@ std::ostream& operator<<(std::ostream& str, const WidthVP* vup) {
 
 //######################################################################
 
-class WidthClearVisitor final {
-    // Rather than a VNVisitor, can just quickly touch every node
-    void clearWidthRecurse(AstNode* nodep) {
-        for (; nodep; nodep = nodep->nextp()) {
-            nodep->didWidth(false);
-            if (AstNode* const refp = nodep->op1p()) clearWidthRecurse(refp);
-            if (AstNode* const refp = nodep->op2p()) clearWidthRecurse(refp);
-            if (AstNode* const refp = nodep->op3p()) clearWidthRecurse(refp);
-            if (AstNode* const refp = nodep->op4p()) clearWidthRecurse(refp);
-        }
-    }
-
-public:
-    // CONSTRUCTORS
-    explicit WidthClearVisitor(AstNetlist* nodep) { clearWidthRecurse(nodep); }
-    virtual ~WidthClearVisitor() = default;
-};
-
-//######################################################################
-
 #define accept in_WidthVisitor_use_AstNode_iterate_instead_of_AstNode_accept
 
 //######################################################################
@@ -1445,6 +1421,27 @@ class WidthVisitor final : public VNVisitor {
         }
     }
 
+    void visit(AstSExpr* nodep) override {
+        if (m_vup->prelim()) {
+            if (nodep->preExprp()) iterateCheckBool(nodep, "LHS", nodep->preExprp(), BOTH);
+            iterateCheckBool(nodep, "RHS", nodep->exprp(), BOTH);
+            if (AstRange* const rangep = VN_CAST(nodep->delayp(), Range)) {
+                iterateCheckSizedSelf(nodep, "Delay", rangep->leftp(), SELF, BOTH);
+                iterateCheckSizedSelf(nodep, "Delay", rangep->rightp(), SELF, BOTH);
+                V3Const::constifyParamsEdit(rangep->leftp());  // May relink pointed to node
+                V3Const::constifyParamsEdit(rangep->rightp());  // May relink pointed to node
+                checkConstantOrReplace(rangep->leftp(), "## range delay isn't a constant");
+                checkConstantOrReplace(rangep->rightp(), "## range delay isn't a constant");
+            } else {
+                iterateCheckSizedSelf(nodep, "Delay", nodep->delayp(), SELF, BOTH);
+                V3Const::constifyParamsEdit(nodep->delayp());  // May relink pointed to node
+                checkConstantOrReplace(nodep->delayp(), "## delay isn't a constant");
+            }
+            userIterate(nodep->sentreep(), nullptr);
+            nodep->dtypeSetBit();
+        }
+    }
+
     void visit(AstRand* nodep) override {
         if (m_vup->prelim()) {
             if (nodep->urandom()) {
@@ -8568,11 +8565,10 @@ void V3Width::width(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
     {
         // We should do it in bottom-up module order, but it works in any order.
-        const WidthClearVisitor cvisitor{nodep};
+        V3Width::widthClearAll(nodep);
         WidthVisitor visitor{false, false};
         (void)visitor.mainAcceptEdit(nodep);
-        WidthRemoveVisitor rvisitor;
-        (void)rvisitor.mainAcceptEdit(nodep);
+        V3Width::widthRemoveAll(nodep);
     }  // Destruct before checking
     V3Global::dumpCheckGlobalTree("width", 0, dumpTreeEitherLevel() >= 3);
 }
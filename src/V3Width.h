@@ -36,6 +36,12 @@ public:
     // Replace AstSelBit, etc with AstSel/AstArraySel
     // Returns replacement node if nodep was deleted, or null if none.
     static AstNode* widthSelNoIterEdit(AstNode* nodep) VL_MT_DISABLED;
+
+    // For use only in V3Width::width, done in parallel across modules
+    // Clear didWidth on all nodes
+    static void widthClearAll(AstNetlist* nodep);
+    // Remove $signed/$unsigned now that widths are known
+    static void widthRemoveAll(AstNetlist* nodep);
 };
 
 #endif  // Guard
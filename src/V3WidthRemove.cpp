@@ -0,0 +1,85 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Width clearing and removal passes for V3Width
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// The passes before and after the main V3Width visitor only edit nodes
+// within each module, so are done in parallel across modules.
+// The main visitor resolves references into other modules and interns
+// data types in the shared type table, so remains serial.
+//*************************************************************************
+
+#include "V3PchAstMT.h"
+
+#include "V3ThreadPool.h"
+#include "V3Width.h"
+
+// WidthRemoveVisitor is internal to V3Width
+#define VERILATOR_V3WIDTH_CPP_
+#include "V3WidthRemove.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class WidthClearVisitor final {
+    // Rather than a VNVisitor, can just quickly touch every node
+    static void clearWidthRecurse(AstNode* nodep) {
+        for (; nodep; nodep = nodep->nextp()) clearWidthOne(nodep);
+    }
+    static void clearWidthOne(AstNode* nodep) {
+        nodep->didWidth(false);
+        if (AstNode* const refp = nodep->op1p()) clearWidthRecurse(refp);
+        if (AstNode* const refp = nodep->op2p()) clearWidthRecurse(refp);
+        if (AstNode* const refp = nodep->op3p()) clearWidthRecurse(refp);
+        if (AstNode* const refp = nodep->op4p()) clearWidthRecurse(refp);
+    }
+
+public:
+    // CONSTRUCTORS
+    explicit WidthClearVisitor(AstNetlist* nodep) {
+        nodep->didWidth(false);
+        clearWidthRecurse(nodep->filesp());
+        clearWidthRecurse(nodep->miscsp());
+        V3ThreadScope threadScope;
+        for (AstNode* modp = nodep->modulesp(); modp; modp = modp->nextp()) {
+            threadScope.enqueue([modp]() { clearWidthOne(modp); });
+        }
+    }
+    virtual ~WidthClearVisitor() = default;
+};
+
+//######################################################################
+// Width class functions
+
+void V3Width::widthClearAll(AstNetlist* nodep) {
+    UINFO(4, __FUNCTION__ << ":");
+    const WidthClearVisitor cvisitor{nodep};
+}
+
+void V3Width::widthRemoveAll(AstNetlist* nodep) {
+    UINFO(4, __FUNCTION__ << ":");
+    {
+        WidthRemoveVisitor rvisitor;
+        rvisitor.iterateAndNextNull(nodep->filesp());
+        rvisitor.iterateAndNextNull(nodep->miscsp());
+    }
+    // Each module has its own visitor, so deletions are made by the thread editing it
+    V3ThreadScope threadScope;
+    for (AstNode* modp = nodep->modulesp(); modp; modp = modp->nextp()) {
+        threadScope.enqueue([modp]() {
+            WidthRemoveVisitor rvisitor;
+            (void)rvisitor.mainAcceptEdit(modp);
+        });
+    }
+}
@@ -20,6 +20,7 @@
 #include "V3ActiveTop.h"
 #include "V3Assert.h"
 #include "V3AssertPre.h"
+#include "V3AssocUnordered.h"
 #include "V3Ast.h"
 #include "V3Begin.h"
 #include "V3Branch.h"
@@ -56,6 +57,7 @@
 #include "V3Force.h"
 #include "V3Fork.h"
 #include "V3FuncOpt.h"
+#include "V3FuncSpec.h"
 #include "V3Gate.h"
 #include "V3Global.h"
 #include "V3Graph.h"
@@ -88,6 +90,7 @@
 #include "V3Scope.h"
 #include "V3Scoreboard.h"
 #include "V3Slice.h"
+#include "V3SourceHash.h"
 #include "V3Split.h"
 #include "V3SplitAs.h"
 #include "V3SplitVar.h"
@@ -125,6 +128,15 @@ static void reportStatsIfEnabled() {
     }
 }
 
+static bool lintTierDone(const string& tier) {
+    // With --lint-only, return true if all passes needed by the --lint-tier have run
+    if (!v3Global.opt.lintOnly() || v3Global.opt.lintTier() != tier) return false;
+    V3Error::abortIfErrors();
+    UINFO(1, "--lint-tier " << tier << ": Skipping remaining passes");
+    reportStatsIfEnabled();
+    return true;
+}
+
 static void emitJson() VL_MT_DISABLED {
     const string filename
         = (v3Global.opt.jsonOnlyOutput().empty()
@@ -169,6 +181,7 @@ static void process() {
         V3Error::abortIfErrors();
 
         if (v3Global.opt.stats()) V3Stats::statsStageAll(v3Global.rootp(), "Link");
+        if (lintTierDone("parse")) return;
         if (v3Global.opt.debugExitUvm23()) {
             V3Error::abortIfErrors();
             if (v3Global.opt.serializeOnly()) emitXmlOrJson();
@@ -242,6 +255,9 @@ static void process() {
         //
         V3Assert::assertAll(v3Global.rootp());
 
+        // Width, unused and undriven checks are complete
+        if (lintTierDone("elab")) return;
+
         if (!(v3Global.opt.serializeOnly() && !v3Global.opt.flatten())) {
             // Add top level wrapper with instance pointing to old top
             // Move packages to under new top
@@ -511,6 +527,9 @@ static void process() {
             // Generic optimizations on a per-function basis
             if (v3Global.opt.fFunc()) V3FuncOpt::funcOptAll(v3Global.rootp());
 
+            // Specialize functions on constant arguments, folded by V3Const below
+            if (v3Global.opt.fFuncSpec()) V3FuncSpec::funcSpecAll(v3Global.rootp());
+
             // Remove unused vars
             V3Const::constifyAll(v3Global.rootp());
             V3Dead::deadifyAll(v3Global.rootp());
@@ -545,6 +564,11 @@ static void process() {
         }
 
         if (!v3Global.opt.lintOnly() && !v3Global.opt.serializeOnly()) {
+            if (v3Global.opt.fAssocUnordered()) {
+                // Hash associative arrays whose order is never observed
+                V3AssocUnordered::assocUnorderedAll(v3Global.rootp());
+            }
+
             if (v3Global.opt.fMergeCond()) {
                 // Merge conditionals
                 V3MergeCond::mergeAll(v3Global.rootp());
@@ -568,6 +592,12 @@ static void process() {
             V3Cast::castAll(v3Global.rootp());
         }
 
+        if (v3Global.opt.fClassFrame() && v3Global.hasClasses() && !v3Global.opt.lintOnly()
+            && !v3Global.opt.serializeOnly()) {
+            // Hold class objects that never leave their function in the function's frame
+            V3Class::frameAll(v3Global.rootp());
+        }
+
         V3Error::abortIfErrors();
         if (!v3Global.opt.lintOnly() && !v3Global.opt.serializeOnly()) {  //
             V3CCtors::cctorsAll();
@@ -646,6 +676,7 @@ static void process() {
         if (v3Global.opt.cmake()) V3EmitCMake::emit();
         if (v3Global.opt.makeJson()) V3EmitMkJson::emit();
         if (v3Global.opt.gmake()) V3EmitMk::emitmk();
+        if (v3Global.opt.makeNinja()) V3EmitMk::emitNinja();
     }
 
     // Final statistics
@@ -710,6 +741,22 @@ static bool verilate(const string& argString) {
     v3Global.readFiles();
     v3Global.removeStd();
 
+    // Can we skip the rest if the used source content is unchanged?
+    if (v3Global.opt.skipIdenticalContent() && v3Global.opt.skipIdentical().isTrue()) {
+        V3SourceHash::computeKey(v3Global.rootp(), argString);
+        const string datFilename
+            = v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix() + "__verFiles.dat";
+        if (!V3Error::isErrorOrWarn()
+            && V3SourceHash::checkKey(v3Global.opt.hierTopDataDir() + "/"
+                                      + v3Global.opt.prefix() + "__verHash.dat")
+            && V3File::checkTimes(datFilename, argString, true /*targetsOnly*/)) {
+            UINFO(1, "--skip-identical-content: No change to used source content, exiting");
+            // Refresh source times, so the next run can skip without parsing
+            V3File::writeTimes(datFilename, argString);
+            return false;
+        }
+    }
+
     // Link, etc, if needed
     if (!v3Global.opt.preprocOnly()) {  //
         process();
@@ -764,6 +811,10 @@ static bool verilate(const string& argString) {
 
     if ((v3Global.opt.skipIdentical().isTrue() || v3Global.opt.makeDepend().isTrue())
         && !V3Error::isErrorOrWarn()) {
+        if (v3Global.opt.skipIdenticalContent() && v3Global.opt.skipIdentical().isTrue()) {
+            V3SourceHash::writeKey(v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix()
+                                   + "__verHash.dat");
+        }
         V3File::writeTimes(v3Global.opt.hierTopDataDir() + "/" + v3Global.opt.prefix()
                                + "__verFiles.dat",
                            argString);
@@ -805,14 +856,26 @@ static string buildMakeCmd(const string& makefile, const string& target) {
     return cmd.str();
 }
 
+static string buildNinjaCmd() {
+    const int jobs = v3Global.opt.buildJobs();
+    std::ostringstream cmd;
+    cmd << v3Global.opt.getenvNINJA();
+    cmd << " -C " << v3Global.opt.makeDir();
+    if (jobs > 0) cmd << " -j " << jobs;
+    for (const string& flag : v3Global.opt.makeFlags()) cmd << ' ' << flag;
+    return cmd.str();
+}
+
 static void execBuildJob() {
     UASSERT(v3Global.opt.build(), "--build is not specified.");
-    UASSERT(v3Global.opt.gmake(), "--build requires GNU Make.");
+    UASSERT(v3Global.opt.gmake() || v3Global.opt.makeNinja(),
+            "--build requires GNU Make or Ninja.");
     UASSERT(!v3Global.opt.cmake(), "--build cannot use CMake.");
     VlOs::DeltaWallTime buildWallTime{true};
     UINFO(1, "Start Build");
 
-    const string cmdStr = buildMakeCmd(v3Global.opt.prefix() + ".mk", "");
+    const string cmdStr = v3Global.opt.gmake() ? buildMakeCmd(v3Global.opt.prefix() + ".mk", "")
+                                               : buildNinjaCmd();
     V3Os::filesystemFlushBuildDir(v3Global.opt.hierTopDataDir());
     const int exit_code = V3Os::system(cmdStr);
     V3Stats::addStatPerf(V3Stats::STAT_WALLTIME_BUILD, buildWallTime.deltaTime());
@@ -870,6 +933,9 @@ int main(int argc, char** argv) {
     bool didVerilate = false;
     if (v3Global.opt.verilate()) {
         didVerilate = verilate(argString);
+        if (didVerilate && v3Global.opt.hierChild()) {
+            V3HierBlockPlan::writeRunTimeFile(wallTimeTotal.deltaTime());
+        }
     } else {
         UINFO(1, "Option --no-verilate: Skip Verilation");
     }
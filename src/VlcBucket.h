@@ -25,6 +25,8 @@
 #endif
 #include "V3Error.h"
 
+#include <algorithm>
+
 //********************************************************************
 // VlcBuckets - Container of all coverage point hits for a given test
 // This is a bitmap array - we store a single bit to indicate a test
@@ -37,6 +39,15 @@ class VlcBuckets final {
     uint64_t m_bucketsCovered = 0;  ///< Num buckets with sufficient coverage
 
     static uint64_t covBit(uint64_t point) { return 1ULL << (point & 63); }
+    static uint64_t countOnes(uint64_t word) {
+#if defined(__GNUC__) && !defined(VL_NO_BUILTINS)
+        return __builtin_popcountll(word);
+#else
+        uint64_t pop = 0;
+        for (; word; word &= word - 1) ++pop;
+        return pop;
+#endif
+    }
     uint64_t allocSize() const { return sizeof(uint64_t) * m_dataSize / 64; }
     void allocate(uint64_t point) {
         const uint64_t oldsize = m_dataSize;
@@ -97,22 +108,19 @@ public:
     }
     uint64_t popCount() const {
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i)) ++pop;
-        }
+        for (uint64_t i = 0; i < m_dataSize / 64; ++i) pop += countOnes(m_datap[i]);
         return pop;
     }
     uint64_t dataPopCount(const VlcBuckets& remaining) {
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && remaining.hits(i)) ++pop;
-        }
+        const uint64_t words = std::min(m_dataSize, remaining.m_dataSize) / 64;
+        for (uint64_t i = 0; i < words; ++i) pop += countOnes(m_datap[i] & remaining.m_datap[i]);
         return pop;
     }
     void orData(const VlcBuckets& ordata) {
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && ordata.hits(i)) clearHits(i);
-        }
+        // Clear hits that ordata also has
+        const uint64_t words = std::min(m_dataSize, ordata.m_dataSize) / 64;
+        for (uint64_t i = 0; i < words; ++i) m_datap[i] &= ~ordata.m_datap[i];
     }
 
     void dump() const {
@@ -70,6 +70,7 @@ void VlcOptions::parseOptsList(int argc, char** argv) {
     DECL_OPTION("-debugi", CbVal, [](int v) { V3Error::debugDefault(v); });
     DECL_OPTION("-filter-type", Set, &m_filterType);
     DECL_OPTION("-rank", OnOff, &m_rank);
+    DECL_OPTION("-threads", Set, &m_threads);
     DECL_OPTION("-unlink", OnOff, &m_unlink);
     DECL_OPTION("-V", CbCall, []() {
         showVersion(true);
@@ -130,10 +131,7 @@ int main(int argc, char** argv) {
 
     if (top.opt.readFiles().empty()) top.opt.addReadFile("vlt_coverage.dat");
 
-    {
-        const VlStringSet& readFiles = top.opt.readFiles();
-        for (const auto& filename : readFiles) top.readCoverage(filename);
-    }
+    top.readCoverages(top.opt.readFiles());
 
     if (debug() >= 9) {
         top.tests().dump(true);
@@ -23,8 +23,10 @@
 #include "VlcPoint.h"
 #include "config_rev.h"
 
+#include <algorithm>
 #include <map>
 #include <set>
+#include <thread>
 #include <vector>
 
 //######################################################################
@@ -42,6 +44,7 @@ class VlcOptions final {
     string m_filterType = "*";  // main switch: --filter-type
     VlStringSet m_readFiles;    // main switch: --read
     bool m_rank = false;        // main switch: --rank
+    int m_threads = 0;          // main switch: --threads
     bool m_unlink = false;      // main switch: --unlink
     string m_writeFile;         // main switch: --write
     string m_writeInfoFile;     // main switch: --write-info
@@ -68,6 +71,10 @@ public:
     bool countOk(uint64_t count) const { return count >= static_cast<uint64_t>(m_annotateMin); }
     bool annotatePoints() const { return m_annotatePoints; }
     bool rank() const { return m_rank; }
+    unsigned threads() const {
+        if (m_threads > 0) return m_threads;
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
     bool unlink() const { return m_unlink; }
     string writeFile() const { return m_writeFile; }
     string writeInfoFile() const { return m_writeInfoFile; }
@@ -20,6 +20,7 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <map>
 #include <unordered_map>
@@ -118,19 +119,21 @@ public:
 
 class VlcPoints final {
     // MEMBERS
-    using NameMap = std::map<const std::string, uint64_t>;  // Sorted by name (ordered)
+    using NameMap = std::unordered_map<std::string, uint64_t>;
     NameMap m_nameMap;  //< Name to point-number
     std::vector<VlcPoint> m_points;  //< List of all points
     uint64_t m_numPoints = 0;  //< Total unique points
+    std::vector<uint64_t> m_byName;  //< Point-numbers sorted by name, built on demand
 
     static int debug() { return V3Error::debugDefault(); }
 
 public:
     // ITERATORS
-    using ByName = NameMap;
-    using iterator = ByName::iterator;
-    ByName::iterator begin() { return m_nameMap.begin(); }
-    ByName::iterator end() { return m_nameMap.end(); }
+    // Iterate point-numbers in name order
+    using ByName = std::vector<uint64_t>;
+    using iterator = ByName::const_iterator;
+    iterator begin() { return byName().cbegin(); }
+    iterator end() { return byName().cend(); }
 
     // CONSTRUCTORS
     VlcPoints() = default;
@@ -140,8 +143,8 @@ public:
     void dump() {
         UINFO(2, "dumpPoints...");
         VlcPoint::dumpHeader(std::cout);
-        for (const auto& i : *this) {
-            const VlcPoint& point = pointNumber(i.second);
+        for (const uint64_t pointnum : *this) {
+            const VlcPoint& point = pointNumber(pointnum);
             point.dump(std::cout);
         }
     }
@@ -153,6 +156,18 @@ public:
         m_points[pointnum].countInc(count);
         return pointnum;
     }
+
+private:
+    const ByName& byName() {
+        if (m_byName.size() != m_points.size()) {
+            m_byName.resize(m_points.size());
+            for (uint64_t i = 0; i < m_byName.size(); ++i) m_byName[i] = i;
+            std::sort(m_byName.begin(), m_byName.end(), [this](uint64_t a, uint64_t b) {
+                return m_points[a].name() < m_points[b].name();
+            });
+        }
+        return m_byName;
+    }
 };
 
 //######################################################################
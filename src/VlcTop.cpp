@@ -24,47 +24,163 @@
 #include "VlcOptions.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <limits>
 #include <string>
+#include <thread>
 #include <vector>
 
 //######################################################################
 
 void VlcTop::readCoverage(const string& filename, bool nonfatal) {
-    UINFO(2, "readCoverage " << filename);
+    ReadFile file;
+    file.m_filename = filename;
+    readCoverageParse(file);
+    readCoverageMerge(file, nonfatal);
+}
+
+void VlcTop::readCoverages(const VlStringSet& filenames) {
+    const std::vector<string> names{filenames.begin(), filenames.end()};
+    const size_t nthreads = std::max<size_t>(1, std::min<size_t>(opt.threads(), names.size()));
+    UINFO(2, "readCoverages " << names.size() << " files with " << nthreads << " threads");
+
+    // Parse a batch of files in parallel, then merge the batch in filename
+    // order, so point numbers, and so all outputs, match reading serially.
+    // Batches bound the memory holding parsed but not yet merged points.
+    const size_t batchSize = nthreads * 8;
+    std::vector<ReadFile> batch;
+    for (size_t first = 0; first < names.size(); first += batchSize) {
+        const size_t count = std::min(batchSize, names.size() - first);
+        batch.clear();
+        batch.resize(count);
+        for (size_t i = 0; i < count; ++i) batch[i].m_filename = names[first + i];
+        std::atomic<size_t> next{0};
+        const auto worker = [&]() {
+            for (size_t i = next++; i < count; i = next++) readCoverageParse(batch[i]);
+        };
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < std::min(nthreads, count); ++t) threads.emplace_back(worker);
+        worker();
+        for (std::thread& thread : threads) thread.join();
+        for (ReadFile& file : batch) readCoverageMerge(file, false);
+    }
+}
 
-    std::ifstream is{filename.c_str()};
+void VlcTop::readCoverageParse(ReadFile& file) const {
+    // Called from multiple threads, must only touch 'file', and not report errors
+    std::ifstream is{file.m_filename.c_str(), std::ios::binary};
     if (!is) {
-        if (!nonfatal) v3fatal("Can't read coverage file: " << filename);
+        file.m_missing = true;
+        file.m_error = "Can't read coverage file: " + file.m_filename;
         return;
     }
 
-    // Testrun and computrons argument unsupported as yet
-    VlcTest* const testp = tests().newTest(filename, 0, 0);
+    const string magic = VL_COV_BINARY_MAGIC;
+    string header(magic.size(), '\0');
+    is.read(&header[0], header.size());
+    if (is && header == magic) {
+        if (!readCoverageBinary(is, file)) {
+            file.m_error = "Corrupt coverage file: " + file.m_filename;
+        }
+        return;
+    }
+    is.close();
+    is.open(file.m_filename.c_str());  // Text mode
 
     while (!is.eof()) {
         const string line = V3Os::getline(is);
-        // UINFO(9, " got " << line);
         if (line[0] == 'C') {
             string::size_type secspace = 3;
             for (; secspace < line.length(); secspace++) {
                 if (line[secspace] == '\'' && line[secspace + 1] == ' ') break;
             }
-            const string point = line.substr(3, secspace - 3);
+            string point = line.substr(3, secspace - 3);
             if (!opt.isTypeMatch(point.c_str())) continue;
-
             const uint64_t hits = std::atoll(line.c_str() + secspace + 1);
-            // UINFO(9, "   point '" << point << "'" << " " << hits);
+            file.m_points.emplace_back(std::move(point), hits);
+        }
+    }
+}
 
-            const uint64_t pointnum = points().findAddPoint(point, hits);
-            if (opt.rank()) {  // Only if ranking - uses a lot of memory
-                if (hits >= VlcBuckets::sufficient()) {
-                    points().pointNumber(pointnum).testsCoveringInc();
-                    testp->buckets().addData(pointnum, hits);
-                }
+bool VlcTop::readCoverageBinary(std::istream& is, ReadFile& file) const {
+    // See VerilatedCovImp::writeBinary for the format
+    const string data{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+    const char* pos = data.data();
+    const char* const endp = pos + data.size();
+    bool ok = true;
+    const auto get = [&](void* valuep, size_t size) {
+        if (VL_UNLIKELY(static_cast<size_t>(endp - pos) < size)) {
+            ok = false;
+            std::memset(valuep, 0, size);
+            return;
+        }
+        std::memcpy(valuep, pos, size);
+        pos += size;
+    };
+    const auto get32 = [&]() {
+        uint32_t value;
+        get(&value, sizeof(value));
+        return value;
+    };
+    const auto get64 = [&]() {
+        uint64_t value;
+        get(&value, sizeof(value));
+        return value;
+    };
+
+    const uint64_t nstrings = get64();
+    // Each string takes at least its length word
+    if (nstrings > static_cast<uint64_t>(endp - pos) / sizeof(uint32_t)) return false;
+    std::vector<string> strings{static_cast<size_t>(nstrings)};
+    for (string& str : strings) {
+        const uint32_t size = get32();
+        if (!ok || size > static_cast<size_t>(endp - pos)) return false;
+        str.assign(pos, size);
+        pos += size;
+    }
+    const uint64_t npoints = get64();
+    string point;
+    for (uint64_t i = 0; ok && i < npoints; ++i) {
+        point.clear();
+        for (uint32_t n = get32(); ok && n; --n) {
+            const uint32_t index = get32();
+            if (VL_UNLIKELY(index >= strings.size())) return false;
+            point += strings[index];
+        }
+        const uint64_t hits = get64();
+        if (ok && opt.isTypeMatch(point.c_str())) file.m_points.emplace_back(point, hits);
+    }
+    return ok;
+}
+
+void VlcTop::readCoverageMerge(ReadFile& file, bool nonfatal) {
+    UINFO(2, "readCoverage " << file.m_filename);
+    if (file.m_missing) {
+        if (!nonfatal) v3fatal(file.m_error);
+        return;
+    }
+
+    // Testrun and computrons argument unsupported as yet
+    VlcTest* const testp = tests().newTest(file.m_filename, 0, 0);
+
+    for (const auto& it : file.m_points) {
+        const string& point = it.first;
+        const uint64_t hits = it.second;
+        // UINFO(9, "   point '" << point << "'" << " " << hits);
+        const uint64_t pointnum = points().findAddPoint(point, hits);
+        if (opt.rank()) {  // Only if ranking - uses a lot of memory
+            if (hits >= VlcBuckets::sufficient()) {
+                points().pointNumber(pointnum).testsCoveringInc();
+                testp->buckets().addData(pointnum, hits);
             }
         }
     }
+    file.m_points.clear();
+    file.m_points.shrink_to_fit();
+    if (!file.m_error.empty()) v3fatal(file.m_error);
 }
 
 void VlcTop::writeCoverage(const string& filename) {
@@ -77,8 +193,8 @@ void VlcTop::writeCoverage(const string& filename) {
     }
 
     os << "# SystemC::Coverage-3\n";
-    for (const auto& i : m_points) {
-        const VlcPoint& point = m_points.pointNumber(i.second);
+    for (const uint64_t pointnum : m_points) {
+        const VlcPoint& point = m_points.pointNumber(pointnum);
         os << "C '" << point.name() << "' " << point.count() << '\n';
     }
 }
@@ -169,39 +285,53 @@ void VlcTop::rank() {
     sort(bytime.begin(), bytime.end(), CmpComputrons());  // Sort the vector
 
     VlcBuckets remaining;
-    for (const auto& i : m_points) {
-        const VlcPoint* const pointp = &points().pointNumber(i.second);
+    for (const uint64_t pointnum : m_points) {
+        const VlcPoint* const pointp = &points().pointNumber(pointnum);
         // If any tests hit this point, then we'll need to cover it.
         if (pointp->testsCovering()) remaining.addData(pointp->pointNum(), 1);
     }
 
-    // Additional Greedy algorithm
-    // O(n^2) Ouch.  Probably the thing to do is randomize the order of data
-    // then hierarchically solve a small subset of tests, and take resulting
-    // solution and move up to larger subset of tests.  (Aka quick sort.)
-    while (true) {
-        if (debug() >= 9) {
+    // Greedy algorithm, picking the test covering the most remaining points.
+    // Remaining points only decrease, so a test's previous count is an upper
+    // bound of its current count; keep tests in a heap by that bound, and
+    // only recount the top test (lazy greedy).  Ties go to the earlier test
+    // in 'bytime' order, as if every test was recounted each iteration.
+    using Candidate = std::pair<uint64_t, size_t>;  // Bound on remaining points, 'bytime' index
+    const auto cmpCandidate = [](const Candidate& lhs, const Candidate& rhs) {
+        if (lhs.first != rhs.first) return lhs.first < rhs.first;
+        return lhs.second > rhs.second;
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(bytime.size());
+    for (size_t i = 0; i < bytime.size(); ++i) {
+        candidates.emplace_back(std::numeric_limits<uint64_t>::max(), i);
+    }
+    std::make_heap(candidates.begin(), candidates.end(), cmpCandidate);
+    uint64_t dumpedRank = 0;
+    while (!candidates.empty()) {
+        if (debug() >= 9 && dumpedRank != nextrank) {
+            dumpedRank = nextrank;  // LCOV_EXCL_LINE
             UINFO_PREFIX("Left on iter" << nextrank << ": ");  // LCOV_EXCL_LINE
             remaining.dump();  // LCOV_EXCL_LINE
         }
-        VlcTest* bestTestp = nullptr;
-        uint64_t bestRemain = 0;
-        for (const auto& testp : bytime) {
-            if (!testp->rank()) {
-                uint64_t remain = testp->buckets().dataPopCount(remaining);
-                if (remain > bestRemain) {
-                    bestTestp = testp;
-                    bestRemain = remain;
-                }
-            }
+        std::pop_heap(candidates.begin(), candidates.end(), cmpCandidate);
+        Candidate& top = candidates.back();
+        VlcTest* const testp = bytime[top.second];
+        const uint64_t remain = testp->buckets().dataPopCount(remaining);
+        if (!remain) {  // Test covers no more stuff
+            candidates.pop_back();
+            continue;
         }
-        if (VlcTest* const testp = bestTestp) {
-            testp->rank(nextrank++);
-            testp->rankPoints(bestRemain);
-            remaining.orData(bestTestp->buckets());
-        } else {
-            break;  // No test covering more stuff found
+        if (candidates.size() > 1 && cmpCandidate({remain, top.second}, candidates.front())) {
+            // Another test may now be better, recount it later
+            top.first = remain;
+            std::push_heap(candidates.begin(), candidates.end(), cmpCandidate);
+            continue;
         }
+        candidates.pop_back();
+        testp->rank(nextrank++);
+        testp->rankPoints(remain);
+        remaining.orData(testp->buckets());
     }
 }
 
@@ -209,8 +339,8 @@ void VlcTop::rank() {
 
 void VlcTop::annotateCalc() {
     // Calculate per-line information into filedata structure
-    for (const auto& i : m_points) {
-        const VlcPoint& point = m_points.pointNumber(i.second);
+    for (const uint64_t pointnum : m_points) {
+        const VlcPoint& point = m_points.pointNumber(pointnum);
         const string filename = point.filename();
         const int lineno = point.lineno();
         if (!filename.empty() && lineno != 0) {
@@ -25,6 +25,8 @@
 #include "VlcSource.h"
 #include "VlcTest.h"
 
+#include <iosfwd>
+
 //######################################################################
 // VlcTop - Top level options container
 
@@ -38,10 +40,22 @@ private:
     VlcPoints m_points;  //< List of all points
     VlcSources m_sources;  //< List of all source files to annotate
 
+    // TYPES
+    // Points parsed from one coverage file, before merging into m_points
+    struct ReadFile final {
+        string m_filename;  //< Filename to read
+        string m_error;  //< Error reading, reported when merged
+        bool m_missing = false;  //< Could not open
+        std::vector<std::pair<string, uint64_t>> m_points;  //< Each point name and hits
+    };
+
     // METHODS
     void annotateCalc();
     void annotateCalcNeeded();
     void annotateOutputFiles(const string& dirname);
+    void readCoverageParse(ReadFile& file) const;
+    bool readCoverageBinary(std::istream& is, ReadFile& file) const;
+    void readCoverageMerge(ReadFile& file, bool nonfatal);
 
 public:
     // CONSTRUCTORS
@@ -56,6 +70,7 @@ public:
     // METHODS
     void annotate(const string& dirname);
     void readCoverage(const string& filename, bool nonfatal = false);
+    void readCoverages(const VlStringSet& filenames);
     void writeCoverage(const string& filename);
     void writeInfo(const string& filename);
 
@@ -481,6 +481,7 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVLT_PUBLIC                 "public"
 %token<fl>              yVLT_PUBLIC_FLAT            "public_flat"
 %token<fl>              yVLT_PUBLIC_FLAT_RD         "public_flat_rd"
+%token<fl>              yVLT_PUBLIC_FLAT_RD_SAMPLED "public_flat_rd_sampled"
 %token<fl>              yVLT_PUBLIC_FLAT_RW         "public_flat_rw"
 %token<fl>              yVLT_PUBLIC_MODULE          "public_module"
 %token<fl>              yVLT_SC_BV                  "sc_bv"
@@ -492,6 +493,7 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVLT_TRACING_ON             "tracing_on"
 
 %token<fl>              yVLT_D_BLOCK    "--block"
+%token<fl>              yVLT_D_BRANCH   "--branch"
 %token<fl>              yVLT_D_CONTENTS "--contents"
 %token<fl>              yVLT_D_COST     "--cost"
 %token<fl>              yVLT_D_FILE     "--file"
@@ -505,6 +507,7 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVLT_D_MTASK    "--mtask"
 %token<fl>              yVLT_D_RULE     "--rule"
 %token<fl>              yVLT_D_SCOPE    "--scope"
+%token<fl>              yVLT_D_TAKEN    "--taken"
 %token<fl>              yVLT_D_TASK     "--task"
 %token<fl>              yVLT_D_VAR      "--var"
 %token<fl>              yVLT_D_WORKERS  "--workers"
@@ -978,6 +981,8 @@ BISONPRE_VERSION(3.7,%define api.header.include {"V3ParseBison.h"})
 %token<fl>              yVL_CLOCKER               "/*verilator clocker*/"
 %token<fl>              yVL_CLOCK_ENABLE          "/*verilator clock_enable*/"
 %token<fl>              yVL_COVERAGE_BLOCK_OFF    "/*verilator coverage_block_off*/"
+%token<fl>              yVL_DPI_DIRECT            "/*verilator dpi_direct*/"
+%token<fl>              yVL_DPI_THREAD_SAFE       "/*verilator dpi_thread_safe*/"
 %token<fl>              yVL_FORCEABLE             "/*verilator forceable*/"
 %token<fl>              yVL_FULL_CASE             "/*verilator full_case*/"
 %token<fl>              yVL_HIER_BLOCK            "/*verilator hier_block*/"
@@ -4915,20 +4920,26 @@ array_methodWith<nodeExprp>:
         ;
 
 dpi_import_export<nodep>:       // ==IEEE: dpi_import_export
-                yIMPORT yaSTRING dpi_tf_import_propertyE dpi_importLabelE function_prototype ';'
+                yIMPORT yaSTRING dpi_tf_import_propertyE dpi_importLabelE function_prototype
+        /*cont*/    dpi_importMetaE ';'
                         { $$ = $5;
                           if (*$4 != "") $5->cname(*$4);
                           $5->dpiContext($3 == iprop_CONTEXT);
                           $5->dpiPure($3 == iprop_PURE);
                           $5->dpiImport(true);
+                          $5->dpiDirect($6 & 1);
+                          $5->dpiThreadSafe($6 & 2);
                           GRAMMARP->checkDpiVer($1, *$2); v3Global.dpi(true); }
-        |       yIMPORT yaSTRING dpi_tf_import_propertyE dpi_importLabelE task_prototype ';'
+        |       yIMPORT yaSTRING dpi_tf_import_propertyE dpi_importLabelE task_prototype
+        /*cont*/    dpi_importMetaE ';'
                         { $$ = $5;
                           if (*$4 != "") $5->cname(*$4);
                           $5->dpiContext($3 == iprop_CONTEXT);
                           $5->dpiPure($3 == iprop_PURE);
                           $5->dpiImport(true);
                           $5->dpiTask(true);
+                          $5->dpiDirect($6 & 1);
+                          $5->dpiThreadSafe($6 & 2);
                           GRAMMARP->checkDpiVer($1, *$2); v3Global.dpi(true); }
         |       yEXPORT yaSTRING dpi_importLabelE yFUNCTION idAny ';'
                         { $$ = new AstDpiExport{$<fl>5, *$5, *$3};
@@ -4943,6 +4954,12 @@ dpi_importLabelE<strp>:         // IEEE: part of dpi_import_export
         |       idAny/*c_identifier*/ '='               { $$ = $1; $<fl>$ = $<fl>1; }
         ;
 
+dpi_importMetaE<cint>:          // Verilator metacomments after a DPI import prototype
+                /* empty */                             { $$ = 0; }
+        |       dpi_importMetaE yVL_DPI_DIRECT          { $$ = $1 | 1; }
+        |       dpi_importMetaE yVL_DPI_THREAD_SAFE     { $$ = $1 | 2; }
+        ;
+
 dpi_tf_import_propertyE<iprop>: // IEEE: [ dpi_function_import_property + dpi_task_import_property ]
                 /* empty */                             { $$ = iprop_NONE; }
         |       yCONTEXT                                { $$ = iprop_CONTEXT; }
@@ -6646,8 +6663,12 @@ pexpr<nodeExprp>:  // IEEE: property_expr  (The name pexpr is important as regex
         //
         //                      // IEEE: "sequence_expr yP_ORMINUSGT pexpr"
         //                      // Instead we use pexpr to prevent conflicts
-        |       ~o~pexpr yP_ORMINUSGT pexpr             { $$ = new AstLogOr{$2, new AstLogNot{$2, $1}, $3}; }
-        |       ~o~pexpr yP_OREQGT pexpr                { $$ = new AstImplication{$2, $1, $3}; }
+        |       ~o~pexpr yP_ORMINUSGT pexpr
+                        { if (AstSExpr* const sexprp = VN_CAST($1, SExpr)) sexprp->antecedent(true);
+                          $$ = new AstLogOr{$2, new AstLogNot{$2, $1}, $3}; }
+        |       ~o~pexpr yP_OREQGT pexpr
+                        { if (AstSExpr* const sexprp = VN_CAST($1, SExpr)) sexprp->antecedent(true);
+                          $$ = new AstImplication{$2, $1, $3}; }
         //
         //                      // IEEE-2009: property_statement
         //                      // IEEE-2012: yIF and yCASE
@@ -6725,9 +6746,9 @@ sexpr<nodeExprp>:  // ==IEEE: sequence_expr  (The name sexpr is important as reg
         //                      // IEEE: "sequence_expr cycle_delay_range sequence_expr { cycle_delay_range sequence_expr }"
         //                      // Both rules basically mean we can repeat sequences, so make it simpler:
                 cycle_delay_range sexpr  %prec yP_POUNDPOUND
-                        { $$ = $2; BBUNSUP($2->fileline(), "Unsupported: ## (in sequence expression)"); }
+                        { $$ = new AstSExpr{$1->fileline(), nullptr, $1, $2}; }
         |       ~p~sexpr cycle_delay_range sexpr %prec prPOUNDPOUND_MULTI
-                        { $$ = $1; BBUNSUP($2->fileline(), "Unsupported: ## (in sequence expression)"); }
+                        { $$ = new AstSExpr{$2->fileline(), $1, $2, $3}; }
         //
         //                      // IEEE: expression_or_dist [ boolean_abbrev ]
         //                      // Note expression_or_dist includes "expr"!
@@ -6779,22 +6800,19 @@ sexpr<nodeExprp>:  // ==IEEE: sequence_expr  (The name sexpr is important as reg
 cycle_delay_range<nodep>:  // IEEE: ==cycle_delay_range
         //                      // These three terms in 1800-2005 ONLY
                 yP_POUNDPOUND intnumAsConst
-                        { $$ = $2;
-                          BBUNSUP($<fl>1, "Unsupported: ## () cycle delay range expression"); }
+                        { $$ = $2; }
         |       yP_POUNDPOUND idAny
                         { $$ = new AstConst{$1, AstConst::BitFalse{}};
                           BBUNSUP($<fl>1, "Unsupported: ## id cycle delay range expression"); }
         |       yP_POUNDPOUND '(' constExpr ')'
-                        { $$ = $3;
-                          BBUNSUP($<fl>1, "Unsupported: ## () cycle delay range expression"); }
+                        { $$ = $3; }
         //                      // In 1800-2009 ONLY:
         //                      // IEEE: yP_POUNDPOUND constant_primary
         //                      // UNSUP: This causes a big grammar ambiguity
         //                      // as ()'s mismatch between primary and the following statement
         //                      // the sv-ac committee has been asked to clarify  (Mantis 1901)
         |       yP_POUNDPOUND anyrange
-                        { $$ = new AstConst{$1, AstConst::BitFalse{}};
-                          BBUNSUP($<fl>1, "Unsupported: ## range cycle delay range expression"); }
+                        { $$ = $2; }
         |       yP_POUNDPOUND yP_BRASTAR ']'
                         { $$ = new AstConst{$1, AstConst::BitFalse{}};
                           BBUNSUP($<fl>1, "Unsupported: ## [*] cycle delay range expression"); }
@@ -8076,6 +8094,9 @@ vltItem:
                         { V3Control::addProfileData($<fl>1, *$2, $3->toUQuad()); }
         |       yVLT_PROFILE_DATA vltDModel vltDMtask vltDCost
                         { V3Control::addProfileData($<fl>1, *$2, *$3, $4->toUQuad()); }
+        |       yVLT_PROFILE_DATA vltDModel vltDBranch vltDTaken vltDCost
+                        { V3Control::addProfileBranchData($<fl>1, *$2, *$3, $4->toUQuad(),
+                                                          $5->toUQuad()); }
         ;
 
 vltOffFront<errcodeen>:
@@ -8106,6 +8127,10 @@ vltDBlock<strp>:  // --block <arg>
                 yVLT_D_BLOCK str                        { $$ = $2; }
         ;
 
+vltDBranch<strp>:  // --branch <arg>
+                yVLT_D_BRANCH str                       { $$ = $2; }
+        ;
+
 vltDContents<strp>:
                 yVLT_D_CONTENTS str                     { $$ = $2; }
         ;
@@ -8153,6 +8178,10 @@ vltDScope<strp>:  // --scope <arg>
                 yVLT_D_SCOPE str                        { $$ = $2; }
         ;
 
+vltDTaken<nump>:  // --taken <arg>
+                yVLT_D_TAKEN yaINTNUM                   { $$ = $2; }
+        ;
+
 vltDFTaskE<strp>:
                 /* empty */                             { static string empty; $$ = &empty; }
         |       yVLT_D_FUNCTION str                     { $$ = $2; }
@@ -8182,6 +8211,7 @@ vltVarAttrFront<attrtypeen>:
         |       yVLT_PUBLIC                 { $$ = VAttrType::VAR_PUBLIC; v3Global.dpi(true); }
         |       yVLT_PUBLIC_FLAT            { $$ = VAttrType::VAR_PUBLIC_FLAT; v3Global.dpi(true); }
         |       yVLT_PUBLIC_FLAT_RD         { $$ = VAttrType::VAR_PUBLIC_FLAT_RD; v3Global.dpi(true); }
+        |       yVLT_PUBLIC_FLAT_RD_SAMPLED { $$ = VAttrType::VAR_PUBLIC_FLAT_RD_SAMPLED; v3Global.dpi(true); }
         |       yVLT_PUBLIC_FLAT_RW         { $$ = VAttrType::VAR_PUBLIC_FLAT_RW; v3Global.dpi(true); }
         |       yVLT_SC_BV                  { $$ = VAttrType::VAR_SC_BV; }
         |       yVLT_SFORMAT                { $$ = VAttrType::VAR_SFORMAT; }
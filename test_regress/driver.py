@@ -624,6 +624,7 @@ class VlTest:
 
         self.benchmark = Args.benchmark
         self.benchmarksim = False
+        self._benchmark_times = {}  # Seconds per compile step, for benchmark_check()
         self.clean_command = None
         self.context_threads = 0  # Number of threads to allocate in the context
         self.errors = None
@@ -685,7 +686,7 @@ class VlTest:
         if Args.verbose:
             self.v_flags += [define_opt + "TEST_VERBOSE=1"]
         if Args.benchmark:
-            self.v_flags += [define_opt + "TEST_BENCHMARK=Args.benchmark"]
+            self.v_flags += [define_opt + "TEST_BENCHMARK=" + str(Args.benchmark)]
         if Args.trace:
             self.v_flags += [define_opt + "WAVES=1"]
 
@@ -817,7 +818,7 @@ class VlTest:
             fh.write("# Verilator simulation benchmark data\n")
             fh.write("# Test name: " + self.name + "\n")
             fh.write("# Top file: " + self.top_filename + "\n")
-            fh.write("evals, time[s]\n")
+            fh.write("evals, time[s], maxrss[kB]\n")
 
     def soprint(self, message: str) -> str:
         message = message.rstrip() + "\n"
@@ -1032,6 +1033,11 @@ class VlTest:
                 self.trace_format = 'saif-sc'  # pylint: disable=attribute-defined-outside-init
             else:
                 self.trace_format = 'saif-c'  # pylint: disable=attribute-defined-outside-init
+        elif re.search(r'-trace-vtc', checkflags):
+            if self.sc:
+                self.trace_format = 'vtc-sc'  # pylint: disable=attribute-defined-outside-init
+            else:
+                self.trace_format = 'vtc-c'  # pylint: disable=attribute-defined-outside-init
         elif self.sc:
             self.trace_format = 'vcd-sc'  # pylint: disable=attribute-defined-outside-init
         else:
@@ -1284,12 +1290,14 @@ class VlTest:
                 if self.verbose:
                     self.oprint("Running Verilator (gmake)")
                 if Args.verilation:
+                    start = time.time()
                     self.run(logfile=self.obj_dir + "/vlt_compile.log",
                              fails=param['fails'],
                              tee=param['tee'],
                              expect_filename=param['expect_filename'],
                              verilator_run=True,
                              cmd=vlt_cmd)
+                    self._benchmark_times['verilate_s'] = time.time() - start
 
             if param['verilator_make_cmake']:
                 vlt_args = self._compile_vlt_flags(**param)
@@ -1327,6 +1335,7 @@ class VlTest:
             if not param['fails'] and param['verilator_make_gmake']:
                 if self.verbose:
                     self.oprint("Running make (gmake)")
+                start = time.time()
                 self.run(
                     logfile=self.obj_dir + "/vlt_gcc.log",
                     entering=self.obj_dir,
@@ -1345,6 +1354,7 @@ class VlTest:
                         self.vm_prefix,  # bypass default rule, as we don't need archive
                         *param['make_flags'],
                     ])
+                self._benchmark_times['cxx_s'] = time.time() - start
 
             if not param['fails'] and param['verilator_make_cmake']:
                 if self.verbose:
@@ -1588,6 +1598,68 @@ class VlTest:
             self._ok = False
         return self._ok
 
+    def benchmark_check(self, baseline_filename=None, tolerance=0.25) -> None:
+        """Record the benchmark results of the last compile(benchmarksim=1)
+        and execute(), and with --benchmark compare them against the baseline
+        file, by default t/<test_name>.benchmark.json.  A result more than
+        'tolerance' worse than the baseline is an error.  With
+        --benchmark-update, rewrite the baseline instead."""
+        if self.errors or self._skips:
+            return
+        if not baseline_filename:
+            baseline_filename = self.t_dir + "/" + self.name + ".benchmark.json"
+
+        results = dict(self._benchmark_times)
+        last = None
+        with open(self.benchmarksim_filename, 'r', encoding="utf8") as fh:
+            for line in fh:
+                m = re.match(r'^(\d+),(\d+\.?\d*),(\d+)', line)
+                if m:
+                    last = m
+        if not last:
+            self.error("No benchmark data in " + self.benchmarksim_filename)
+            return
+        evals = int(last.group(1))
+        exec_s = float(last.group(2))
+        if exec_s > 0.0:
+            results['evals_per_s'] = evals / exec_s
+        if int(last.group(3)):
+            results['maxrss_kb'] = int(last.group(3))
+
+        for key in sorted(results.keys()):
+            self.oprint("Benchmark %-12s %g" % (key, results[key]))
+        with open(self.obj_dir + "/" + self.name + "_benchmark.json", 'w',
+                  encoding="utf8") as fh:
+            json.dump(results, fh, indent=2, sort_keys=True)
+
+        if Args.benchmark_update:
+            if not Args.benchmark:
+                self.error("--benchmark-update requires --benchmark")
+                return
+            with open(baseline_filename, 'w', encoding="utf8") as fh:
+                json.dump(results, fh, indent=2, sort_keys=True)
+                fh.write("\n")
+            self.oprint("Updated benchmark baseline " + baseline_filename)
+            return
+        if not Args.benchmark:
+            return  # Unoptimized builds are not comparable to a baseline
+        if not os.path.exists(baseline_filename):
+            self.oprint("No benchmark baseline " + baseline_filename +
+                        ", create with --benchmark-update")
+            return
+        with open(baseline_filename, 'r', encoding="utf8") as fh:
+            baseline = json.load(fh)
+        for key in sorted(results.keys()):
+            base = baseline.get(key, None)
+            value = results[key]
+            if not base or not value:
+                continue
+            # Evaluation rate is better higher, all else better lower
+            ratio = (base / value) if key == 'evals_per_s' else (value / base)
+            if ratio > 1.0 + tolerance:
+                self.error("Benchmark %s regressed to %g from baseline %g (%+.0f%%)" %
+                           (key, value, base, (ratio - 1.0) * 100.0))
+
     def passes(self, is_ok=True):
         if not self.errors:
             self._ok = is_ok
@@ -1602,6 +1674,8 @@ class VlTest:
             return self.obj_dir + "/simx.fst"
         if re.match(r'^saif', self.trace_format):
             return self.obj_dir + "/simx.saif"
+        if re.match(r'^vtc', self.trace_format):
+            return self.obj_dir + "/simx.vtc"
         return self.obj_dir + "/simx.vcd"
 
     def skip_if_too_few_cores(self) -> None:
@@ -1909,6 +1983,9 @@ class VlTest:
                 fh.write("#include <fstream>\n")
                 fh.write("#include <chrono>\n")
                 fh.write("#include <iomanip>\n")
+                fh.write("#if defined(__linux) || defined(__APPLE__)\n")
+                fh.write("#include <sys/resource.h>\n")
+                fh.write("#endif\n")
 
             fh.write("// OS header\n")
             fh.write('#include "verilatedos.h"' + "\n")
@@ -1932,6 +2009,10 @@ class VlTest:
                 fh.write("#include \"verilated_saif_c.h\"\n")
             if self.trace and self.trace_format == 'saif-sc':
                 fh.write("#include \"verilated_saif_sc.h\"\n")
+            if self.trace and self.trace_format == 'vtc-c':
+                fh.write("#include \"verilated_vtc_c.h\"\n")
+            if self.trace and self.trace_format == 'vtc-sc':
+                fh.write("#include \"verilated_vtc_sc.h\"\n")
             if self.savable:
                 fh.write("#include \"verilated_save.h\"\n")
 
@@ -2019,6 +2100,10 @@ class VlTest:
                     fh.write("    std::unique_ptr<VerilatedSaifC> tfp{new VerilatedSaifC};\n")
                 if self.trace_format == 'saif-sc':
                     fh.write("    std::unique_ptr<VerilatedSaifSc> tfp{new VerilatedSaifSc};\n")
+                if self.trace_format == 'vtc-c':
+                    fh.write("    std::unique_ptr<VerilatedVtcC> tfp{new VerilatedVtcC};\n")
+                if self.trace_format == 'vtc-sc':
+                    fh.write("    std::unique_ptr<VerilatedVtcSc> tfp{new VerilatedVtcSc};\n")
                 if self.sc:
                     fh.write("    sc_core::sc_start(sc_core::SC_ZERO_TIME);" +
                              "  // Finish elaboration before trace and open\n")
@@ -2124,8 +2209,18 @@ class VlTest:
                          " = std::chrono::steady_clock::now() - starttime;\n")
                 fh.write("        std::ofstream benchfile(\"" + self.benchmarksim_filename +
                          "\", std::ofstream::out | std::ofstream::app);\n")
+                fh.write("        long maxrss_kb = 0;\n")
+                fh.write("#if defined(__linux) || defined(__APPLE__)\n")
+                fh.write("        struct rusage usage;\n")
+                fh.write("        if (getrusage(RUSAGE_SELF, &usage) == 0)"
+                         " maxrss_kb = usage.ru_maxrss;\n")
+                fh.write("#endif\n")
+                fh.write("#ifdef __APPLE__\n")
+                fh.write("        maxrss_kb /= 1024;  // Bytes on macOS\n")
+                fh.write("#endif\n")
                 fh.write("        benchfile << std::fixed << std::setprecision(9)"
-                         " << n_evals << \",\" << exec_s.count() << std::endl;\n")
+                         " << n_evals << \",\" << exec_s.count() << \",\" << maxrss_kb"
+                         " << std::endl;\n")
                 fh.write("        benchfile.close();\n")
                 fh.write("    }\n")
 
@@ -2834,6 +2929,9 @@ if __name__ == '__main__':
     SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0""")
 
     parser.add_argument('--benchmark', action='store', help='enable benchmarking')
+    parser.add_argument('--benchmark-update',
+                        action='store_true',
+                        help='rewrite benchmark baselines from this run')
     parser.add_argument('--debug', action='store_const', const=9, help='enable debug')
     # --debugi: see _parameter()
     parser.add_argument('--driver-clean', action='store_true', help='clean after test passes')
@@ -0,0 +1,34 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+   logic [7:0] u8;
+   logic [99:0] u100;
+   logic [31:0] mem[1024];
+   int unsigned cnt = 32'h1234;
+   logic [99:0] init100 = 100'h5_0000_0000_0000_0000_0000_00a5;
+
+   initial begin
+      if ($test$plusargs("ones")) begin
+         if (u8 !== 8'hff) $stop;
+         if (u100 !== ~100'h0) $stop;
+         if (mem[0] !== 32'hffffffff) $stop;
+         if (mem[1023] !== 32'hffffffff) $stop;
+      end
+      else begin
+         if (u8 !== 8'h0) $stop;
+         if (u100 !== 100'h0) $stop;
+         if (mem[0] !== 32'h0) $stop;
+         if (mem[1023] !== 32'h0) $stop;
+      end
+      if (cnt != 32'h1234) $stop;
+      if (init100 != 100'h5_0000_0000_0000_0000_0000_00a5) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
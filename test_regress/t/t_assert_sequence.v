@@ -0,0 +1,65 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+   int   cyc = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+
+   wire  req = crc[0];
+   wire  gnt = crc[1];
+   wire  ack = crc[2];
+   wire  done = crc[3] | crc[4];
+   wire  stop = cyc >= 90;
+
+   int   fails_fixed = 0;
+   int   fails_range = 0;
+   int   fails_lead = 0;
+   int   exp_fixed = 0;
+   int   exp_range = 0;
+   int   exp_lead = 0;
+
+   // Model of the sequences, from the history of req
+   reg [3:0] req_h = 0;  // req_h[n] is req n+1 clocks ago
+   reg       gnt_h = 0;
+   reg       range_match = 0;
+
+   assert property (@(posedge clk) req ##2 gnt |-> ack || stop)
+     else fails_fixed++;
+   assert property (@(posedge clk) req ##[1:3] gnt |=> done || stop)
+     else fails_range++;
+   assert property (@(posedge clk) ##1 req ##0 gnt ##1 ack |-> done || stop)
+     else fails_lead++;
+
+   always @(posedge clk) begin
+`ifdef TEST_VERBOSE
+      $write("[%0t] cyc==%0d req=%b gnt=%b ack=%b done=%b\n", $time, cyc, req, gnt, ack, done);
+`endif
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      req_h <= {req_h[2:0], req};
+      gnt_h <= gnt;
+      range_match <= (|req_h[2:0]) && gnt;
+      if (req_h[1] && gnt && !(ack || stop)) exp_fixed++;
+      if (range_match && !(done || stop)) exp_range++;
+      if (cyc >= 2 && req_h[0] && gnt_h && ack && !(done || stop)) exp_lead++;
+      if (cyc == 99) begin
+         `checkh(fails_fixed, exp_fixed);
+         `checkh(fails_range, exp_range);
+         `checkh(fails_lead, exp_lead);
+         if (exp_fixed == 0 || exp_range == 0 || exp_lead == 0) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
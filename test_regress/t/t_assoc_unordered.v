@@ -0,0 +1,40 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   // Order never observed, so hashed
+   longint scoreboard[int];
+   int     counts[string];
+   // Iterated, so ordered
+   int     ordered[int];
+
+   initial begin
+      for (int i = 0; i < 100; ++i) scoreboard[i * 7919] = i;
+      if (scoreboard.size() != 100) $stop;
+      if (!scoreboard.exists(7919 * 3)) $stop;
+      if (scoreboard.exists(3)) $stop;
+      if (scoreboard[7919 * 5] != 5) $stop;
+      if (scoreboard[3] != 0) $stop;
+      if (scoreboard.sum() != 4950) $stop;
+      scoreboard.delete(0);
+      if (scoreboard.size() != 99) $stop;
+
+      counts["b"] += 2;
+      counts["a"] += 1;
+      if (counts["a"] != 1 || counts["b"] != 2 || counts.num() != 2) $stop;
+      counts.delete();
+      if (counts.size() != 0) $stop;
+
+      ordered[3] = 30;
+      ordered[1] = 10;
+      ordered[2] = 20;
+      foreach (ordered[k]) $write("%0d:%0d ", k, ordered[k]);
+      $write("\n");
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
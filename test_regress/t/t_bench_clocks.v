@@ -0,0 +1,53 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Benchmark: many clock domains
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+`ifdef TEST_BENCHMARK
+   localparam int CYCLES = `TEST_BENCHMARK;
+`else
+   localparam int CYCLES = 1000;
+`endif
+   localparam int N = 16;
+
+   int cyc = 0;
+   logic [N-1:0] div = '0;
+   wire [31:0] cnt[N];
+   logic [31:0] sum;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      div <= div + 1;
+   end
+
+   // Each domain is clocked by a different combination of divider bits
+   for (genvar i = 0; i < N; ++i) begin : g_dom
+      wire dclk = div[i % 4] ^ div[4 + i / 4];
+      logic [31:0] c = i;
+      always @(posedge dclk) c <= c * 3 + cnt[(i + 1) % N];
+      assign cnt[i] = c;
+   end
+
+   always_comb begin
+      sum = 0;
+      for (int i = 0; i < N; ++i) sum = sum ^ cnt[i];
+   end
+
+   always @(posedge clk) begin
+      if (cyc == CYCLES) begin
+         if (sum == 0) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
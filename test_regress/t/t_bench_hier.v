@@ -0,0 +1,59 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Benchmark: deep hierarchy, 2**DEPTH leaf instances
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+`ifdef TEST_BENCHMARK
+   localparam int CYCLES = `TEST_BENCHMARK;
+`else
+   localparam int CYCLES = 1000;
+`endif
+
+   int cyc = 0;
+   logic [31:0] sum;
+
+   node #(.DEPTH(8), .SEED(1)) root (.clk, .in(cyc), .sum);
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == CYCLES) begin
+         if (sum == 0) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
+
+module node #(
+   parameter int DEPTH = 0,
+   parameter int SEED = 0
+   ) (
+   input clk,
+   input [31:0] in,
+   output logic [31:0] sum
+   );
+
+   if (DEPTH == 0) begin : g_leaf
+      logic [31:0] acc = SEED;
+      always @(posedge clk) acc <= (acc ^ in) + (acc << 1) + SEED;
+      assign sum = acc;
+   end
+   else begin : g_node
+      logic [31:0] suml;
+      logic [31:0] sumr;
+      node #(.DEPTH(DEPTH - 1), .SEED(SEED * 2)) l (.clk, .in(in), .sum(suml));
+      node #(.DEPTH(DEPTH - 1), .SEED(SEED * 2 + 1)) r (.clk, .in(in + 1), .sum(sumr));
+      always @(posedge clk) sum <= suml ^ sumr;
+   end
+
+endmodule
@@ -0,0 +1,53 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Benchmark: timing heavy testbench
+
+module t;
+
+`ifdef TEST_BENCHMARK
+   localparam int CYCLES = `TEST_BENCHMARK;
+`else
+   localparam int CYCLES = 1000;
+`endif
+   localparam int N = 8;
+
+   logic clk = 0;
+   logic [31:0] data[N];
+   logic [31:0] seen = 0;
+   event ev;
+
+   always #5 clk = ~clk;
+
+   // Producers wake on delays and events
+   for (genvar i = 0; i < N; ++i) begin : g_prod
+      initial begin
+         data[i] = i;
+         forever begin
+            @(posedge clk);
+            #(i + 1);
+            data[i] = data[i] + i + 1;
+            if (i == 0) -> ev;
+         end
+      end
+   end
+
+   initial begin
+      forever begin
+         @ev;
+         wait (data[N-1] != 0);
+         seen = seen + data[0];
+      end
+   end
+
+   initial begin
+      repeat (CYCLES) @(negedge clk);
+      if (seen == 0) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
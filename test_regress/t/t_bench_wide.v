@@ -0,0 +1,49 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Benchmark: wide datapath
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+`ifdef TEST_BENCHMARK
+   localparam int CYCLES = `TEST_BENCHMARK;
+`else
+   localparam int CYCLES = 1000;
+`endif
+   localparam int W = 1024;
+
+   int cyc = 0;
+   logic [W-1:0] a;
+   logic [W-1:0] b;
+   logic [W-1:0] c;
+   logic [W-1:0] d;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 0) begin
+         a <= {32{32'h9e3779b9}};
+         b <= {32{32'h7f4a7c15}};
+         c <= '0;
+         d <= '0;
+      end
+      else begin
+         a <= {a[W-2:0], a[W-1]} ^ b;
+         b <= b + (a >> 3);
+         c <= c ^ (a & ~b);
+         d <= d + {c[W-33:0], c[W-1:W-32]};
+      end
+      if (cyc == CYCLES) begin
+         if (d == '0) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
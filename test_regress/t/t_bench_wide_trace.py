@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_bench_wide.v"
+test.sim_time = 1000000000  # Design ends with $finish
+
+test.init_benchmarksim()
+
+test.compile(benchmarksim=1, verilator_flags2=["--trace-vcd"])
+
+test.execute()
+
+test.benchmark_check()
+
+test.passes()
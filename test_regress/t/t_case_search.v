@@ -0,0 +1,68 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [31:0] insn;
+   reg [7:0]  op;
+   reg [7:0]  expected;
+
+   // Too wide for a decoding tree, so compared with a binary search
+   always_comb begin
+      case (insn)
+        32'h0000_0013: op = 8'd1;
+        32'h0000_0033: op = 8'd2;
+        32'h0000_0063, 32'h0000_0067: op = 8'd3;
+        32'h0000_006f: op = 8'd4;
+        32'h0010_0073: op = 8'd5;
+        32'h0000_1073: op = 8'd6;
+        32'h0200_0033: op = 8'd7;
+        32'h4000_0033: op = 8'd8;
+        32'h8000_0000: op = 8'd9;
+        32'hffff_fffe: op = 8'd10;
+        // verilator lint_off CASEOVERLAP
+        32'h0000_0033: op = 8'd99;
+        // verilator lint_on CASEOVERLAP
+        default: op = 8'd0;
+      endcase
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      case (cyc)
+        0: begin insn <= 32'h0000_0013; expected <= 8'd1; end
+        1: begin insn <= 32'h0000_0033; expected <= 8'd2; end
+        2: begin insn <= 32'h0000_0063; expected <= 8'd3; end
+        3: begin insn <= 32'h0000_0067; expected <= 8'd3; end
+        4: begin insn <= 32'h0000_006f; expected <= 8'd4; end
+        5: begin insn <= 32'h0010_0073; expected <= 8'd5; end
+        6: begin insn <= 32'h0000_1073; expected <= 8'd6; end
+        7: begin insn <= 32'h0200_0033; expected <= 8'd7; end
+        8: begin insn <= 32'h4000_0033; expected <= 8'd8; end
+        9: begin insn <= 32'h8000_0000; expected <= 8'd9; end
+        10: begin insn <= 32'hffff_fffe; expected <= 8'd10; end
+        11: begin insn <= 32'hffff_ffff; expected <= 8'd0; end
+        12: begin insn <= 32'h0000_0014; expected <= 8'd0; end
+        13: begin insn <= 32'h0000_0000; expected <= 8'd0; end
+        default: begin insn <= 32'h0000_0001; expected <= 8'd0; end
+      endcase
+      if (cyc > 0) begin
+`ifdef TEST_VERBOSE
+         $write("[%0t] insn=%x op=%0d expected=%0d\n", $time, insn, op, expected);
+`endif
+         if (op !== expected) $stop;
+      end
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,57 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+class Txn;
+   int addr;
+   int data;
+   function new(int a);
+      addr = a;
+   endfunction
+endclass
+
+class Keeper;
+   Txn q[$];
+   function void keep(Txn t);
+      q.push_back(t);
+   endfunction
+endclass
+
+module t;
+   Keeper k = new;
+
+   // Objects never leave the function, so can be held in its frame
+   function automatic int sum_local(int n);
+      int sum = 0;
+      Txn t;
+      for (int i = 0; i < n; ++i) begin
+         t = new(i);
+         t.data = i * 2;
+         sum += t.addr + t.data;
+      end
+      return sum;
+   endfunction
+
+   // Handle passed elsewhere, so must stay on the heap
+   function automatic int sum_kept(int n);
+      int sum = 0;
+      Txn t;
+      for (int i = 0; i < n; ++i) begin
+         t = new(i);
+         k.keep(t);
+         sum += t.addr;
+      end
+      return sum;
+   endfunction
+
+   initial begin
+      if (sum_local(10) != 135) $stop;
+      if (sum_kept(10) != 45) $stop;
+      if (k.q.size() != 10) $stop;
+      if (k.q[9].addr != 9) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_class_extends.v"
+
+test.compile(verilator_flags2=["--threads 1"])
+
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.h"),
+                   r'public virtual VlClassLocal')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.pli_filename = "t/t_compiler_include.cpp"
+test.top_filename = "t/t_compiler_include.v"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=[
+                 "--exe", test.pli_filename, "--compiler-include",
+                 test.t_dir + "/t_compiler_include.h", "--output-split 1"
+             ],
+             make_flags=['VM_PCH=0'])
+
+# The header's text is included, so no precompiled header is built
+test.file_grep_not(test.obj_dir + "/vlt_gcc.log", r"\.gch")
+
+test.execute()
+
+test.passes()
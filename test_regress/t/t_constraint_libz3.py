@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_constraint.v"
+
+if not test.have_solver:
+    test.skip("No constraint solver installed")
+if not os.path.exists("/usr/include/z3.h"):
+    test.skip("No Z3 library installed")
+
+test.compile(verilator_flags2=[
+    '-Wno-CONSTRAINTIGN', '-CFLAGS -DVL_SOLVER_LIBZ3', '-LDFLAGS -lz3'
+])
+
+test.execute()
+
+test.passes()
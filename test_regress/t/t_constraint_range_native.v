@@ -0,0 +1,48 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Constraints are all constant bounds, so are solved without the solver
+class Packet;
+  rand bit [3:0] a;
+  rand int b;
+  rand byte c;
+  rand bit [7:0] d;
+  rand int unsigned e;
+  rand bit [7:0] free;
+
+  constraint c_a { a inside {[2:9]}; }
+  constraint c_b { b >= -5; b < 5; }
+  constraint c_c { c == -7; }
+  constraint c_d { 10 < d; d <= 12; solve a before d; }
+  constraint c_e { e > 32'hfffffff0; }
+endclass
+
+module t;
+  Packet p;
+  int seen_a[bit [3:0]];
+  int seen_b[int];
+  int seen_free[bit [7:0]];
+
+  initial begin
+    p = new;
+    repeat (500) begin
+      if (p.randomize() != 1) $stop;
+      if (p.a < 2 || p.a > 9) $stop;
+      if (p.b < -5 || p.b >= 5) $stop;
+      if (p.c != -7) $stop;
+      if (p.d <= 10 || p.d > 12) $stop;
+      if (p.e <= 32'hfffffff0) $stop;
+      seen_a[p.a] = 1;
+      seen_b[p.b] = 1;
+      seen_free[p.free] = 1;
+    end
+    if (seen_a.size() != 8) $stop;
+    if (seen_b.size() != 10) $stop;
+    if (seen_free.size() < 100) $stop;
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
@@ -0,0 +1,79 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_covergroup.h>
+
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    // Covergroup of the model output, crossed with the cycle parity
+    VlCoverpoint<uint8_t> outCp;
+    const uint32_t low = outCp.addBin("low", 0, 3);
+    const uint32_t mid = outCp.addBin("mid", 4, 11);
+    const uint32_t high = outCp.addBin("high", 15, 12);  // Reversed range
+    const uint32_t five = outCp.addBin("five", 5);  // Overlaps 'mid'
+    VlCoverpoint<int> parityCp;
+    const uint32_t even = parityCp.addBin("even", 0);
+    const uint32_t odd = parityCp.addBin("odd", 1);
+    VlCoverCross cross{{outCp.bins(), parityCp.bins()}};
+    outCp.insertCoverage(contextp->coveragep(), "top.t", "out_cp", "t_cover_covergroup_lib.cpp",
+                         __LINE__);
+
+    topp->clk = 0;
+    topp->eval();
+    for (int cyc = 1; cyc <= 20; ++cyc) {
+        topp->clk = 1;
+        topp->eval();
+        // Values are 1 to 15, then 0 to 4
+        const uint8_t value = topp->out;
+        TEST_CHECK_EQ(static_cast<int>(value), cyc % 16);
+        if (cyc <= 10) {
+            TEST_CHECK_EQ(outCp.sample(value), value == 5 ? 2U : 1U);
+        } else {
+            outCp.defer(value);  // Counted by flush(), as a batch
+        }
+        parityCp.sample(cyc % 2);
+        outCp.foreachBin(value, [&](uint32_t bin) { cross.sample({bin, cyc % 2 ? odd : even}); });
+        topp->clk = 0;
+        topp->eval();
+    }
+    outCp.flush();
+
+    TEST_CHECK_EQ(outCp.count(low), 7U);
+    TEST_CHECK_EQ(outCp.count(mid), 9U);
+    TEST_CHECK_EQ(outCp.count(high), 4U);
+    TEST_CHECK_EQ(outCp.count(five), 1U);
+    TEST_CHECK_EQ(outCp.binsHit(), 4U);
+    TEST_CHECK_EQ(parityCp.count(even), 10U);
+    TEST_CHECK_EQ(parityCp.count(odd), 10U);
+    TEST_CHECK_EQ(cross.count({low, odd}), 4U);
+    TEST_CHECK_EQ(cross.count({high, even}), 2U);
+    TEST_CHECK_EQ(cross.count({five, even}), 0U);
+    TEST_CHECK_EQ(cross.bins(), 8U);
+    TEST_CHECK_EQ(cross.binsHit(), 7U);
+
+    contextp->coveragep()->write(VL_STRINGIFY(TEST_OBJ_DIR) "/coverage.dat");
+
+    topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
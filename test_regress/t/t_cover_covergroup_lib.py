@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--coverage-line --exe", test.pli_filename])
+
+test.execute()
+
+
+def check_bin(name, count):
+    test.file_grep(test.obj_dir + "/coverage.dat",
+                   r"\x01o\x02out_cp\." + name + r"\x01[^\n]*' (\d+)$", count)
+
+
+test.file_grep(test.obj_dir + "/coverage.dat", r"\x01page\x02v_covergroup/out_cp\x01")
+check_bin("low", 7)
+check_bin("mid", 9)
+check_bin("high", 4)
+check_bin("five", 1)
+
+test.passes()
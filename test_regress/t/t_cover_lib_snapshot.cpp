@@ -0,0 +1,91 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_cov.h>
+
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+struct Run final {
+    std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+    uint32_t counts[16] = {};  // Times each model output value was seen
+};
+
+void value_insert(Run& run, int value) {
+    // This needs to be a function at one line number so the points of both
+    // contexts have the same keys, so merge() can match them
+    const std::string comment = "value_" + std::to_string(value);
+    VL_COVER_INSERT(run.contextp->coveragep(), "top.t", &run.counts[value], "comment",
+                    comment.c_str());
+}
+
+void init(Run& run) {
+    for (int value = 0; value < 16; ++value) value_insert(run, value);
+    run.topp->clk = 0;
+    run.topp->eval();
+}
+
+void cycles(Run& run, int n) {
+    for (int i = 0; i < n; ++i) {
+        run.topp->clk = 1;
+        run.topp->eval();
+        ++run.counts[run.topp->out];
+        run.topp->clk = 0;
+        run.topp->eval();
+    }
+}
+
+int main() {
+    Run a;
+    Run b;
+    init(a);
+    init(b);
+    VerilatedCovContext* const covp = a.contextp->coveragep();
+
+    // After the first cycle the model's own line coverage is all hit, so
+    // only the value points are new after each snapshot
+    cycles(a, 1);
+    covp->snapshot();
+    TEST_CHECK_EQ(covp->newPointsHit(), 0U);
+    cycles(a, 5);  // Values 2 to 6
+    TEST_CHECK_EQ(covp->newPointsHit(), 5U);
+    covp->snapshot();
+    cycles(a, 2);  // Values 7 and 8
+    TEST_CHECK_EQ(covp->newPointsHit(), 2U);
+
+    cycles(b, 10);  // Values 1 to 10
+    covp->merge(b.contextp->coveragep());
+    // Values 9 and 10 are newly hit by the merge
+    TEST_CHECK_EQ(covp->newPointsHit(), 4U);
+    TEST_CHECK_EQ(a.counts[0], 0U);
+    TEST_CHECK_EQ(a.counts[1], 2U);
+    TEST_CHECK_EQ(a.counts[8], 2U);
+    TEST_CHECK_EQ(a.counts[9], 1U);
+    TEST_CHECK_EQ(a.counts[10], 1U);
+    TEST_CHECK_EQ(a.counts[11], 0U);
+    // The merged-from context is unchanged
+    TEST_CHECK_EQ(b.counts[1], 1U);
+    TEST_CHECK_EQ(b.counts[11], 0U);
+
+    covp->write(VL_STRINGIFY(TEST_OBJ_DIR) "/coverage.dat");
+
+    a.topp->final();
+    b.topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--coverage-line --exe", test.pli_filename])
+
+test.execute()
+
+
+def check_value(value, count):
+    test.file_grep(test.obj_dir + "/coverage.dat",
+                   r"\x01o\x02value_" + str(value) + r"\x01[^\n]*' (\d+)$", count)
+
+
+# Merged counts from both contexts
+check_value(0, 0)
+check_value(1, 2)
+check_value(8, 2)
+check_value(9, 1)
+check_value(15, 0)
+
+test.passes()
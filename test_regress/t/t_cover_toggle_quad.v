@@ -0,0 +1,22 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   // Only bits above 31 toggle, so are lost if quad values are truncated
+   logic [39:0] q40;
+   logic [63:0] q64;
+
+   initial begin
+      q40 = '0;
+      q64 = '0;
+      #1 q40 = 40'hff_0000_0000;
+      #1 q64 = 64'h8000_0001_0000_0000;
+      #1 q40 = '0;
+      #1 q64 = '0;
+      #1 $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
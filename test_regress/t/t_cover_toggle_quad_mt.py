@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_cover_toggle_quad.v"
+
+test.compile(verilator_flags2=['--binary --coverage-toggle --threads 2'])
+
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp"),
+                   r'VL_COV_TOGGLE_CHG_MT_Q\(')
+
+test.execute()
+
+
+def check_point(comment, count):
+    test.file_grep(test.obj_dir + "/coverage.dat",
+                   r"\x01o\x02" + re.escape(comment) + r"\x01[^\n]*' (\d+)$", count)
+
+
+check_point("q40[39]", 2)
+check_point("q40[32]", 2)
+check_point("q40[31]", 0)
+check_point("q64[63]", 2)
+check_point("q64[32]", 2)
+check_point("q64[62]", 0)
+check_point("q64[0]", 0)
+
+test.passes()
@@ -0,0 +1,70 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aa5_0f0f_1234_9876;
+   reg [15:0] crc16 = 16'hffff;
+   reg [15:0] ref16 = 16'hffff;
+   wire [7:0] data = crc[7:0];
+   wire [15:0] crc_next;
+
+   // CRC-16-CCITT of a byte, as generated for parallel CRC logic
+   crc16_byte u_crc (.crc(crc16), .data(data), .crc_next(crc_next));
+
+   // Bit-serial reference
+   function automatic [15:0] crc16_serial(input [15:0] c, input [7:0] d);
+      reg fb;
+      for (int i = 7; i >= 0; --i) begin
+         fb = c[15] ^ d[i];
+         c = {c[14:0], 1'b0} ^ (fb ? 16'h1021 : 16'h0000);
+      end
+      return c;
+   endfunction
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      crc16 <= crc_next;
+      ref16 <= crc16_serial(ref16, data);
+`ifdef TEST_VERBOSE
+      $write("[%0t] data=%x crc16=%x ref16=%x\n", $time, data, crc16, ref16);
+`endif
+      if (crc16 !== ref16) $stop;
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module crc16_byte (
+   input [15:0] crc,
+   input [7:0] data,
+   output [15:0] crc_next
+   );
+   assign crc_next[15] = crc[15] ^ crc[11] ^ crc[7] ^ data[7] ^ data[3];
+   assign crc_next[14] = crc[14] ^ crc[10] ^ crc[6] ^ data[6] ^ data[2];
+   assign crc_next[13] = crc[13] ^ crc[9] ^ crc[5] ^ data[5] ^ data[1];
+   assign crc_next[12] = crc[15] ^ crc[12] ^ crc[8] ^ crc[4] ^ data[7] ^ data[4] ^ data[0];
+   assign crc_next[11] = crc[14] ^ crc[3] ^ data[6];
+   assign crc_next[10] = crc[13] ^ crc[2] ^ data[5];
+   assign crc_next[9] = crc[12] ^ crc[1] ^ data[4];
+   assign crc_next[8] = crc[15] ^ crc[11] ^ crc[0] ^ data[7] ^ data[3];
+   assign crc_next[7] = crc[15] ^ crc[14] ^ crc[10] ^ data[7] ^ data[6] ^ data[2];
+   assign crc_next[6] = crc[14] ^ crc[13] ^ crc[9] ^ data[6] ^ data[5] ^ data[1];
+   assign crc_next[5] = crc[13] ^ crc[12] ^ crc[8] ^ data[5] ^ data[4] ^ data[0];
+   assign crc_next[4] = crc[12] ^ data[4];
+   assign crc_next[3] = crc[15] ^ crc[11] ^ data[7] ^ data[3];
+   assign crc_next[2] = crc[14] ^ crc[10] ^ data[6] ^ data[2];
+   assign crc_next[1] = crc[13] ^ crc[9] ^ data[5] ^ data[1];
+   assign crc_next[0] = crc[12] ^ crc[8] ^ data[4] ^ data[0];
+endmodule
@@ -0,0 +1,64 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aa5_0f0f_1234_9876;
+
+   // Sparse request vectors, so that all priorities are exercised
+   wire [15:0] req = crc[15:0] & crc[31:16] & crc[47:32];
+   wire [11:0] req_hi = req[13:2];
+
+   // Priority encoders as written by hand or generated by tools
+   wire [3:0] msb_idx
+      = req[15] ? 4'd15 : req[14] ? 4'd14 : req[13] ? 4'd13 : req[12] ? 4'd12
+      : req[11] ? 4'd11 : req[10] ? 4'd10 : req[9] ? 4'd9 : req[8] ? 4'd8
+      : req[7] ? 4'd7 : req[6] ? 4'd6 : req[5] ? 4'd5 : req[4] ? 4'd4
+      : req[3] ? 4'd3 : req[2] ? 4'd2 : req[1] ? 4'd1 : req[0] ? 4'd0 : 4'd0;
+   wire [4:0] lsb_idx
+      = req[0] ? 5'd0 : req[1] ? 5'd1 : req[2] ? 5'd2 : req[3] ? 5'd3
+      : req[4] ? 5'd4 : req[5] ? 5'd5 : req[6] ? 5'd6 : req[7] ? 5'd7
+      : req[8] ? 5'd8 : req[9] ? 5'd9 : req[10] ? 5'd10 : req[11] ? 5'd11
+      : req[12] ? 5'd12 : req[13] ? 5'd13 : req[14] ? 5'd14 : req[15] ? 5'd15 : 5'd31;
+   // Sub-range with an offset value
+   wire [7:0] grant
+      = req_hi[2] ? 8'd102 : req_hi[3] ? 8'd103 : req_hi[4] ? 8'd104
+      : req_hi[5] ? 8'd105 : req_hi[6] ? 8'd106 : crc[63:56];
+
+   // Loop references
+   function automatic [3:0] msb_ref(input [15:0] r);
+      msb_ref = 4'd0;
+      for (int i = 0; i < 16; ++i) if (r[i]) msb_ref = i[3:0];
+   endfunction
+   function automatic [4:0] lsb_ref(input [15:0] r);
+      lsb_ref = 5'd31;
+      for (int i = 15; i >= 0; --i) if (r[i]) lsb_ref = i[4:0];
+   endfunction
+   function automatic [7:0] grant_ref(input [11:0] r, input [7:0] d);
+      grant_ref = d;
+      for (int i = 6; i >= 2; --i) if (r[i]) grant_ref = 8'd100 + i[7:0];
+   endfunction
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+`ifdef TEST_VERBOSE
+      $write("[%0t] req=%x msb=%0d lsb=%0d grant=%0d\n", $time, req, msb_idx, lsb_idx, grant);
+`endif
+      if (msb_idx !== msb_ref(req)) $stop;
+      if (lsb_idx !== lsb_ref(req)) $stop;
+      if (grant !== grant_ref(req_hi, crc[63:56])) $stop;
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
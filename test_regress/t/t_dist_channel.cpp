@@ -0,0 +1,69 @@
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+//
+
+#include "verilated.h"
+#include "verilated_dist.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <memory>
+#include <string>
+
+#include <sys/wait.h>
+
+// Boundary signals of one partition
+struct Frame final {
+    uint32_t out;
+};
+
+static const int CYCLES = 1000;
+static const size_t LOOKAHEAD = 4;
+// Each cycle adds one, and each value crosses the ring every LOOKAHEAD cycles
+static const uint32_t EXPECTED = CYCLES / LOOKAHEAD;
+
+// Simulate one partition of the ring, receiving 'in' and sending 'out' each cycle
+static uint32_t partition(const char* name, VlDistChannel<Frame>& inChan,
+                          VlDistChannel<Frame>& outChan) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), name}};
+    topp->clk = 0;
+    topp->eval();
+    // 'out' is registered, so the other partition may consume it LOOKAHEAD
+    // cycles late; its initial value covers the first cycles
+    outChan.prime(Frame{topp->out});
+    for (int cycle = 0; cycle < CYCLES; ++cycle) {
+        Frame frame;
+        inChan.receive(frame);
+        topp->in = frame.out;
+        topp->clk = 1;
+        topp->eval();
+        topp->clk = 0;
+        topp->eval();
+        outChan.send(Frame{topp->out});
+    }
+    topp->final();
+    return topp->out;
+}
+
+int main(int argc, char** argv) {
+    const std::string prefix = "/vl_t_dist_channel_" + std::to_string(getpid());
+    VlDistChannel<Frame> aToB{prefix + "_a2b", LOOKAHEAD, true};
+    VlDistChannel<Frame> bToA{prefix + "_b2a", LOOKAHEAD, true};
+
+    const pid_t pid = fork();
+    if (pid == 0) {
+        _exit(partition("b", aToB, bToA) == EXPECTED ? 0 : 1);
+    }
+    const uint32_t out = partition("a", bToA, aToB);
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    VL_PRINTF("out=%u child=%d\n", out, WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+    VL_PRINTF("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,18 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// One partition of a ring; each partition adds one to its registered boundary
+module t (
+    input clk,
+    input [31:0] in,
+    output reg [31:0] out
+);
+
+   initial out = 0;
+
+   always @(posedge clk) out <= in + 1;
+
+endmodule
@@ -0,0 +1,20 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   import "DPI-C" function bit [39:0] dpii_add40(bit [39:0] a, bit [39:0] b) /*verilator dpi_direct*/;
+   import "DPI-C" function bit [7:0] dpii_inv8(bit [7:0] a) /*verilator dpi_direct*/;
+   import "DPI-C" function int dpii_sum(int a, bit [15:0] b, longint c) /*verilator dpi_direct*/;
+
+   initial begin
+      if (dpii_add40(40'h0f_ffff_ffff, 40'h1) !== 40'h10_0000_0000) $stop;
+      // C sets bits above the width, which are dropped
+      if (dpii_inv8(8'h5a) !== 8'ha5) $stop;
+      if (dpii_sum(1, 16'hffff, 64'h1_0000_0002) !== 32'h1_0002) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,20 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   import "DPI-C" context function int dpii_ctx(int a) /*verilator dpi_direct*/;
+   import "DPI-C" function void dpii_out(output bit [7:0] o) /*verilator dpi_direct*/;
+   import "DPI-C" function void dpii_wide(bit [64:0] w) /*verilator dpi_direct*/;
+   import "DPI-C" function void dpii_four(logic [3:0] l) /*verilator dpi_direct*/;
+
+   bit [7:0] o;
+   initial begin
+      if (dpii_ctx(1) != 0) $stop;
+      dpii_out(o);
+      dpii_wide('0);
+      dpii_four('0);
+   end
+endmodule
@@ -0,0 +1,19 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include "svdpi.h"
+
+#include "Vt_dpi_direct__Dpi.h"
+
+//======================================================================
+
+// The prototypes from Vt_dpi_direct__Dpi.h pass packed values by value
+
+uint64_t dpii_add40(uint64_t a, uint64_t b) { return a + b; }
+svBitVecVal dpii_inv8(svBitVecVal a) { return ~a; }
+int dpii_sum(int a, svBitVecVal b, long long c) { return a + static_cast<int>(b + c); }
@@ -0,0 +1,44 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0)
+
+module t;
+
+   import "DPI-C" function int dpii_sum(input int i []);
+   import "DPI-C" function void dpii_double(inout int io []);
+   import "DPI-C" function void dpii_fill(output byte o []);
+
+   int dyn[];
+   int que[$];
+   byte bytes[];
+
+   initial begin
+      dyn = new[5];
+      foreach (dyn[i]) dyn[i] = i + 1;
+      `checkh(dpii_sum(dyn), 15);
+      dpii_double(dyn);
+      `checkh(dyn[0], 2);
+      `checkh(dyn[4], 10);
+
+      for (int i = 0; i < 100; ++i) que.push_front(i);
+      `checkh(dpii_sum(que), 4950);
+      dpii_double(que);
+      `checkh(que[0], 198);
+      `checkh(que[99], 0);
+      `checkh(que.size(), 100);
+
+      bytes = new[3];
+      dpii_fill(bytes);
+      `checkh(bytes[0], 8'h10);
+      `checkh(bytes[2], 8'h12);
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
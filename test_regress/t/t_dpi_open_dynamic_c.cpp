@@ -0,0 +1,33 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include "svdpi.h"
+
+#include "Vt_dpi_open_dynamic__Dpi.h"
+
+//======================================================================
+
+int dpii_sum(const svOpenArrayHandle i) {
+    // Elements are contiguous, so the array can be read directly
+    const int* const datap = static_cast<const int*>(svGetArrayPtr(i));
+    int sum = 0;
+    for (int n = 0; n < svSize(i, 1); ++n) sum += datap[n];
+    return sum;
+}
+
+void dpii_double(const svOpenArrayHandle io) {
+    for (int n = svLow(io, 1); n <= svHigh(io, 1); ++n) {
+        int* const elemp = static_cast<int*>(svGetArrElemPtr1(io, n));
+        *elemp *= 2;
+    }
+}
+
+void dpii_fill(const svOpenArrayHandle o) {
+    char* const datap = static_cast<char*>(svGetArrayPtr(o));
+    for (int n = 0; n < svSize(o, 1); ++n) datap[n] = 0x10 + n;
+}
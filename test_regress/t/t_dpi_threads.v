@@ -6,7 +6,11 @@
 // Version 2.0.
 // SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
 
+`ifdef T_DPI_THREAD_SAFE
+import "DPI-C" dpii_sys_task = function void \$dpii_sys () /*verilator dpi_thread_safe*/;
+`else
 import "DPI-C" dpii_sys_task = function void \$dpii_sys ();
+`endif
 import "DPI-C" dpii_failure = function int \$dpii_failure ();
 
 module t (clk);
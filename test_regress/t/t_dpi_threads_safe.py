@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_dpi_threads.v"
+
+test.skip_if_too_few_cores()
+
+test.compile(v_flags2=["t/t_dpi_threads_c.cpp +define+T_DPI_THREAD_SAFE --no-threads-coarsen"])
+
+# Similar to t_dpi_threads_collide, this test confirms that a DPI import
+# marked dpi_thread_safe is not serialized under the default --threads-dpi
+test.execute(fails=True)
+
+test.passes()
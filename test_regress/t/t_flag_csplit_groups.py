@@ -127,5 +127,6 @@ test.file_grep_not(test.obj_dir + "/" + test.vm_prefix + "_classes.mk", "vm_clas
 test.file_grep(test.stats, r'Node count, CFILE + (\d+)', (234 if test.vltmt else 214))
 test.file_grep(test.stats, r'Makefile targets, VM_CLASSES_FAST + (\d+)', 2)
 test.file_grep(test.stats, r'Makefile targets, VM_CLASSES_SLOW + (\d+)', 2)
+test.file_grep(test.stats, r'Compile cost, predicted total\s+\d+')
 
 test.passes()
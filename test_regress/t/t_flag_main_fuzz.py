@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+# Linking needs libFuzzer, so only check the generated harness
+test.compile(verilator_flags2=['--main-fuzz --savable'], verilator_make_gmake=False)
+
+main_filename = test.obj_dir + "/" + test.vm_prefix + "__main.cpp"
+test.file_grep(main_filename, r'LLVMFuzzerTestOneInput')
+test.file_grep(main_filename, r'vlFuzzCycleBytes = 19;')
+test.file_grep(main_filename, r'topp->wide\[2\] = .* & VL_MASK_E\(70\);')
+test.file_grep(main_filename, r'is >> \*s.topp;')
+
+test.passes()
@@ -0,0 +1,18 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk,
+    input [7:0] narrow,
+    input [69:0] wide,
+    input [63:0] quad,
+    output reg [7:0] out
+);
+   always @(posedge clk) begin
+      if (narrow == 8'h5a && wide[69:68] == 2'b10) out <= quad[7:0];
+      else out <= narrow;
+   end
+endmodule
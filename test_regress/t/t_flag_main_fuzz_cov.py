@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_main_fuzz.v"
+
+# Linking needs libFuzzer, so only check the generated harness
+test.compile(verilator_flags2=['--main-fuzz --coverage'], verilator_make_gmake=False)
+
+main_filename = test.obj_dir + "/" + test.vm_prefix + "__main.cpp"
+test.file_grep(main_filename, r'LLVMFuzzerTestOneInput')
+test.file_grep(main_filename, r'section\("__libfuzzer_extra_counters"\)')
+test.file_grep(main_filename, r'static uint8_t vlFuzzCoverage\[65536\];')
+test.file_grep(main_filename, r'contextp->coveragep\(\)->counts\(s.counts\);')
+test.file_grep(main_filename, r'if \(!first\) s.construct\(\);')
+
+test.passes()
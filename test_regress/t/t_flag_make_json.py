@@ -27,4 +27,10 @@ if not os.path.exists(json_filename):
 
 test.run(cmd=['cat "' + json_filename + '" | jq ".version"'])
 
+# Compile jobs are sorted most expensive first
+test.run(cmd=[
+    'cat "' + json_filename + '" | jq -e ".compile_jobs | length > 0 and'
+    ' (map(.score) == (map(.score) | sort | reverse))"'
+])
+
 test.passes()
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import shutil
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_make_cmake.v"
+
+if not shutil.which(os.environ.get('NINJA', 'ninja')):
+    test.skip("ninja is not installed")
+
+test.compile(  # Verilator runs ninja, so don't call gmake from driver.py
+    verilator_make_gmake=False,
+    verilator_flags2=['--exe --cc --build --make ninja', '../' + test.main_filename])
+
+test.file_grep(test.obj_dir + "/build.ninja", r'include .*/include/verilated.ninja')
+test.file_grep(test.obj_dir + "/build.ninja", r'default ' + test.vm_prefix)
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_make_cmake.v"
+
+# Any real run exceeds 1 MB, so the first stage is reported, only once
+test.compile(verilator_flags2=['--max-memory 1 --stats'])
+
+test.file_grep(test.compile_log_filename,
+               r'-Info: Memory usage of \d+ MB exceeds --max-memory of 1 MB after stage')
+test.file_grep_count(test.compile_log_filename, r'exceeds --max-memory', 1)
+test.file_grep(test.stats, r'Stage, Memory node pool \(MB\)')
+
+test.passes()
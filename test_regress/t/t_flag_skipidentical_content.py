@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import time
+
+test.scenarios('vlt')
+test.top_filename = test.obj_dir + "/t_flag_skipidentical_content.v"
+unused_filename = test.obj_dir + "/t_flag_skipidentical_content_unused.v"
+
+FileTimes = {}
+
+
+def gen(filename, comment, lines):
+    with open(filename, 'w', encoding="utf8") as fh:
+        fh.write("// Generated by t_flag_skipidentical_content.py " + comment + "\n")
+        fh.write(lines)
+
+
+def gen_top(comment, value):
+    gen(test.top_filename, comment,
+        "module t;\n  sub sub ();\nendmodule\nmodule sub;\n  localparam P = " + value +
+        ";\nendmodule\n")
+
+
+def gen_unused(value):
+    gen(unused_filename, "", "module unused;\n  localparam P = " + value + ";\nendmodule\n")
+
+
+def prep_output_file(filename):
+    FileTimes[filename] = os.path.getmtime(filename)
+
+
+def check_times(expect_same):
+    for filename, oldtime in FileTimes.items():
+        same = oldtime == os.path.getmtime(filename)
+        if same != expect_same:
+            test.error(("Regenerated " if expect_same else "Did not regenerate ") + filename)
+
+
+def compile_it():
+    test.compile(verilator_flags2=['--skip-identical-content --top-module t', unused_filename])
+
+
+print("NOTE: use --debugi, as --debug in driver turns off skip-identical")
+
+gen_top("", "1")
+gen_unused("1")
+compile_it()
+prep_output_file(test.obj_dir + "/V" + test.name + ".cpp")
+prep_output_file(test.obj_dir + "/V" + test.name + "__verHash.dat")
+
+time.sleep(2)  # Or else it might take < 1 second to compile and see no diff.
+
+print("\nTest skip after comment change")
+gen_top("changed comment", "1")
+compile_it()
+check_times(True)
+
+print("\nTest skip after change to module not used")
+gen_unused("2")
+compile_it()
+check_times(True)
+
+print("\nTest no skip after change to module used")
+gen_top("changed comment", "2")
+compile_it()
+check_times(False)
+
+test.passes()
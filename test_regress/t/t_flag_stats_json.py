@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_EXAMPLE.v"
+
+test.compile(verilator_flags2=["--stats"])
+
+filename = test.obj_dir + "/" + test.vm_prefix + "__stats_stages.json"
+with open(filename, 'r', encoding="utf8") as fh:
+    data = json.load(fh)
+
+events = data['traceEvents']
+if not events:
+    test.error("No stages in " + filename)
+lastTs = 0
+for event in events:
+    if event['ph'] != 'X':
+        test.error("Unexpected event phase: " + str(event))
+    if event['ts'] < lastTs:
+        test.error("Stages out of order: " + str(event))
+    lastTs = event['ts']
+    for key in ('wallSec', 'cpuSec', 'utilization', 'memCurrentMB', 'memPeakMB'):
+        if key not in event['args']:
+            test.error("Missing '" + key + "' in " + str(event))
+if not any(re.search(r'_emit$', event['name']) for event in events):
+    test.error("No emit stage in " + filename)
+
+test.passes()
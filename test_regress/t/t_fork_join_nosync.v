@@ -0,0 +1,30 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+  int a, b, c;
+
+  initial begin
+    #1;
+    // No branch suspends, so no fork sync is needed
+    fork
+      a = 1;
+      b = 2;
+      begin
+        c = a + b;
+      end
+    join
+    if (c != 3) $stop;
+    fork
+      a = 10;
+      b = 20;
+    join_any
+    if (a != 10 || b != 20) $stop;
+    #1;
+    $write("*-* All Finished *-*\n");
+    $finish;
+  end
+endmodule
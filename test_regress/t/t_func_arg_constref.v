@@ -0,0 +1,43 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk
+);
+
+  integer cyc = 0;
+  logic [1023:0] data = '0;
+  logic [31:0] arr[4] = '{1, 2, 3, 4};
+
+  function automatic logic [31:0] sum(input logic [1023:0] wide, input logic [31:0] arr[4]);
+    /* verilator no_inline_task */
+    sum = 0;
+    for (int i = 0; i < 32; ++i) sum += wide[i*32+:32];
+    for (int i = 0; i < 4; ++i) sum += arr[i];
+  endfunction
+
+  function automatic logic [31:0] clobbered(input logic [1023:0] wide);
+    /* verilator no_inline_task */
+    wide[31:0] = ~wide[31:0];
+    return wide[31:0];
+  endfunction
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    data <= {data[991:0], cyc};
+    if (cyc == 3) begin
+      // data = {.., 0, 1, 2}
+      if (sum(data, arr) !== 32'd13) $stop;
+      if (clobbered(data) !== ~32'd2) $stop;
+      if (data[31:0] !== 32'd2) $stop;
+    end
+    if (cyc == 9) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
@@ -0,0 +1,43 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+   // Constant functions called repeatedly with the same arguments
+   function automatic integer f_log2(input integer value);
+      integer result = 0;
+      while ((1 << result) < value) result = result + 1;
+      return result;
+   endfunction
+
+   function automatic integer f_sum_log2(input integer n);
+      integer sum = 0;
+      for (integer i = 0; i < n; ++i) sum = sum + f_log2(i % 8) + f_log2(i % 8);
+      return sum;
+   endfunction
+
+   function automatic integer f_noisy(input integer value);
+      $display("f_noisy(%0d)", value);
+      return value + 1;
+   endfunction
+
+   function automatic integer f_call_noisy(input integer n);
+      integer sum = 0;
+      for (integer i = 0; i < n; ++i) sum = sum + f_noisy(1);
+      return sum;
+   endfunction
+
+   localparam SUM = f_sum_log2(64);
+   localparam NOISY = f_call_noisy(3);
+
+   initial begin
+      // 8 * 2 * (0+0+1+2+2+3+3+3)
+      if (SUM != 224) $stop;
+      if (NOISY != 6) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -32,6 +32,8 @@ test.file_grep(test.obj_dir + "/Vsub0/sub0.sv", r'^module\s+(\S+)\s+', "sub0")
 test.file_grep(test.obj_dir + "/Vsub1/sub1.sv", r'^module\s+(\S+)\s+', "sub1")
 test.file_grep(test.obj_dir + "/Vsub2/sub2.sv", r'^module\s+(\S+)\s+', "sub2")
 test.file_grep(test.stats, r'HierBlock,\s+Hierarchical blocks\s+(\d+)', 14)
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "_hier.mk", r'^VM_HIER_SCHEDULE :=')
+test.file_grep(test.obj_dir + "/Vsub0/Vsub0__hierTime.dat", r'^[0-9.e+-]+$')
 test.file_grep(test.run_log_filename, r'MACRO:(\S+) is defined', "cplusplus")
 
 test.passes()
@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you can
+# redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_hier_block.v"
+
+# stats will be deleted but generation will be skipped if libs of hierarchical blocks exist.
+test.clean_objs()
+
+test.compile(v_flags2=['t/t_hier_block.cpp'],
+             verilator_flags2=[
+                 '--stats', '--hierarchical', '--hierarchical-shared', '--Wno-TIMESCALEMOD',
+                 '--CFLAGS', '"-pipe -DCPP_MACRO=cplusplus"'
+             ])
+
+test.execute()
+
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "_hier.mk", r'Vsub0/libsub0\.so')
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "_hier.mk", r'-Wl,-rpath,')
+test.file_grep_not(test.obj_dir + "/" + test.vm_prefix + "_hier.mk", r'Vsub0/libsub0\.a')
+test.file_grep(test.stats, r'HierBlock,\s+Hierarchical blocks\s+(\d+)', 14)
+test.file_grep(test.run_log_filename, r'MACRO:(\S+) is defined', "cplusplus")
+
+test.passes()
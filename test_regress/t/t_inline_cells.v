@@ -0,0 +1,64 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [3:0] in;
+   wire      and_y, nand_y, mux_y, ha_s, ha_c, flop_q, probe_y;
+
+   AND2 u_and (.A(in[0]), .B(in[1]), .Y(and_y));
+   NAND2 u_nand (.A(in[1]), .B(in[2]), .Y(nand_y));
+   MUX2 u_mux (.S(in[3]), .A(and_y), .B(nand_y), .Y(mux_y));
+   HA u_ha (.A(in[0]), .B(in[3]), .S(ha_s), .CO(ha_c));
+   // Referenced hierarchically, so kept as an instance
+   AND2 u_probe (.A(in[2]), .B(in[3]), .Y(probe_y));
+   // Sequential, so kept as an instance
+   DFF u_flop (.CK(clk), .D(mux_y), .Q(flop_q));
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      in <= cyc[3:0];
+      if (cyc > 1) begin
+         if (and_y !== (in[0] & in[1])) $stop;
+         if (nand_y !== ~(in[1] & in[2])) $stop;
+         if (mux_y !== (in[3] ? nand_y : and_y)) $stop;
+         if ({ha_c, ha_s} !== in[0] + in[3]) $stop;
+         if (u_probe.Y !== (in[2] & in[3])) $stop;
+      end
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+`celldefine
+module AND2 (input A, input B, output Y);
+   and (Y, A, B);
+endmodule
+
+module NAND2 (input A, input B, output Y);
+   nand (Y, A, B);
+endmodule
+
+module MUX2 (input S, input A, input B, output Y);
+   assign Y = S ? B : A;
+endmodule
+
+module HA (input A, input B, output S, output CO);
+   assign S = A ^ B;
+   assign CO = A & B;
+endmodule
+
+module DFF (input CK, input D, output reg Q);
+   always @(posedge CK) Q <= D;
+endmodule
+`endcelldefine
@@ -0,0 +1,45 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   wire [31:0] outs [7:0];
+
+   // Replicated more than --inline-max-refs, so not inlined
+   for (genvar i = 0; i < 8; ++i) begin : gen_lane
+      sub u_sub (.clk(clk), .seed(i), .out(outs[i]));
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 9) begin
+         for (int i = 0; i < 8; ++i) begin
+            if (outs[i] !== 9 * (i + 1)) begin
+               $display("%%Error: outs[%0d]=%0d", i, outs[i]);
+               $stop;
+            end
+         end
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module sub (
+   input clk,
+   input [31:0] seed,
+   output reg [31:0] out
+);
+   initial out = 0;
+   always @(posedge clk) begin
+      out <= out + seed + 1;
+   end
+endmodule
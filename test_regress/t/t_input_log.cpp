@@ -0,0 +1,56 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include VM_PREFIX_INCLUDE
+
+#include <memory>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::string filename = std::string{VL_STRINGIFY(TEST_OBJ_DIR)} + "/input.log";
+
+    // Record a run driven by the testbench
+    std::vector<uint32_t> recorded;
+    {
+        const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+        contextp->commandArgs(argc, argv);
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+        if (!topp->inputLogRecord(filename.c_str())) {
+            vl_fatal(__FILE__, __LINE__, "main", "Cannot open input log");
+        }
+        for (int cyc = 0; cyc < 40; ++cyc) {
+            topp->clk = cyc & 1;
+            if (!topp->clk) topp->in = cyc * 7;
+            topp->wide[2] = cyc * 1000;
+            topp->eval();
+            recorded.push_back(topp->sum);
+            contextp->timeInc(5);
+        }
+        topp->final();
+    }
+
+    // Replay the log without the testbench
+    std::vector<uint32_t> replayed;
+    {
+        const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+        const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+        if (!topp->inputLogReplay(filename.c_str())) {
+            vl_fatal(__FILE__, __LINE__, "main", "Cannot open input log");
+        }
+        while (topp->inputLogStep()) replayed.push_back(topp->sum);
+        topp->final();
+    }
+
+    if (recorded != replayed || recorded.size() != 40 || recorded.back() == 0) {
+        vl_fatal(__FILE__, __LINE__, "main", "Replay differs from recorded run");
+    }
+    VL_PRINTF("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,15 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk,
+    input [7:0] in,
+    input [79:0] wide,
+    output reg [31:0] sum
+);
+   initial sum = 0;
+   always @(posedge clk) sum <= sum * 3 + {24'b0, in} + wide[79:48];
+endmodule
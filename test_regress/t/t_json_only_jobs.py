@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_json_only_begin_hier.v"
+
+serial_filename = test.obj_dir + "/serial.tree.json"
+parallel_filename = test.obj_dir + "/parallel.tree.json"
+
+for (filename, jobs) in ((serial_filename, "1"), (parallel_filename, "4")):
+    test.compile(verilator_flags2=[
+        "--no-std", "--json-only", "--json-only-output", filename, "--no-json-ids",
+        "--no-json-edit-nums", "--verilate-jobs", jobs
+    ],
+                 verilator_make_gmake=False,
+                 make_top_shell=False,
+                 make_main=False)
+
+
+def normalized(filename):
+    # Without --json-ids the node addresses differ from run to run
+    with open(filename, 'r', encoding="utf8") as fh:
+        return re.sub(r'"0x[0-9a-f]+"', '"<addr>"', fh.read())
+
+
+if normalized(serial_filename) != normalized(parallel_filename):
+    test.error("--verilate-jobs changed the --json-only output")
+
+test.passes()
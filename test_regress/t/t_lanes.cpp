@@ -0,0 +1,44 @@
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+//
+
+#include "verilated.h"
+#include "verilated_lanes.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <string>
+
+int main(int argc, char** argv) {
+    VlLanes<VM_PREFIX> lanes{4, "top"};
+
+    // Each lane runs a different stimulus, so finishes at a different time
+    for (size_t lane = 0; lane < lanes.lanes(); ++lane) {
+        const std::string limit = "+limit=" + std::to_string(4 + lane);
+        const char* laneArgv[] = {argv[0], limit.c_str()};
+        lanes.context(lane).debug(0);
+        lanes.context(lane).commandArgs(2, laneArgv);
+        lanes[lane].clk = false;
+    }
+
+    lanes.eval();
+    for (int cycle = 0; !lanes.gotFinish(); ++cycle) {
+        lanes.timeInc(5);
+        for (size_t lane = 0; lane < lanes.lanes(); ++lane) lanes[lane].clk = !lanes[lane].clk;
+        lanes.eval();
+        if (cycle > 100) {
+            vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+        }
+    }
+    lanes.final();
+
+    for (size_t lane = 0; lane < lanes.lanes(); ++lane) {
+        VL_PRINTF("lane %d count=%d finish=%d\n", static_cast<int>(lane),
+                  static_cast<int>(lanes[lane].count), lanes.gotFinish(lane));
+    }
+    return 0;
+}
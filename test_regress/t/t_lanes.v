@@ -0,0 +1,29 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk,
+    output reg [31:0] count
+);
+
+   int limit;
+
+   initial begin
+      count = 0;
+      if (!$value$plusargs("limit=%d", limit)) limit = 1;
+   end
+
+   always @(posedge clk) begin
+      if (count == limit) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+      else begin
+         count <= count + 1;
+      end
+   end
+
+endmodule
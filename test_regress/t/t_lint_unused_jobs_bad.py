@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_lint_unused_bad.v"
+test.golden_filename = "t/t_lint_unused_bad.out"
+
+# Messages must be identical, and in the same order, when checked in parallel
+test.lint(verilator_flags2=[
+    "--lint-only --bbox-sys --bbox-unsup -Wall -Wno-DECLFILENAME", "--unused-regexp 'cmdln*'",
+    "--verilate-jobs 4"
+],
+          fails=True,
+          expect_filename=test.golden_filename)
+
+test.passes()
@@ -0,0 +1,64 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aa5_0f0f_1234_9876;
+
+   reg [95:0] a96;
+   reg [199:0] a200;
+   reg [299:0] a300;
+   reg signed [31:0] s32;
+   reg signed [127:0] s128;
+
+   // Wide division by single word constants
+   wire [95:0] q96 = a96 / 96'd10;
+   wire [95:0] r96 = a96 % 96'd10;
+   wire [199:0] q200 = a200 / 200'd1000003;
+   wire [199:0] r200 = a200 % 200'd1000003;
+   wire [299:0] q300 = a300 / 300'hffff_fffb;
+   wire [299:0] r300 = a300 % 300'hffff_fffb;
+   // Signed division by powers of two
+   wire signed [31:0] sq32 = s32 / 32'sd8;
+   wire signed [31:0] sr32 = s32 % 32'sd8;
+   wire signed [127:0] sq128 = s128 / 128'sd65536;
+   wire signed [127:0] sr128 = s128 % 128'sd65536;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      a96 <= {crc[31:0], crc};
+      a200 <= {crc[7:0], crc, crc, crc};
+      a300 <= {crc[43:0], crc, crc, crc, crc};
+      s32 <= crc[31:0];
+      s128 <= {crc, ~crc};
+      if (cyc > 1) begin
+`ifdef TEST_VERBOSE
+         $write("[%0t] a96=%x q96=%x r96=%x s32=%0d sq32=%0d sr32=%0d\n",
+                $time, a96, q96, r96, s32, sq32, sr32);
+`endif
+         if (q96 * 96'd10 + r96 !== a96 || r96 >= 96'd10) $stop;
+         if (q200 * 200'd1000003 + r200 !== a200 || r200 >= 200'd1000003) $stop;
+         if (q300 * 300'hffff_fffb + r300 !== a300 || r300 >= 300'hffff_fffb) $stop;
+         // Quotient rounds towards zero, remainder takes the sign of the dividend
+         if (sq32 * 32'sd8 + sr32 !== s32) $stop;
+         if (sr32 != 0 && (sr32 < 0) != (s32 < 0)) $stop;
+         if (sr32 >= 32'sd8 || sr32 <= -32'sd8) $stop;
+         if (sq128 * 128'sd65536 + sr128 !== s128) $stop;
+         if (sr128 != 0 && (sr128 < 0) != (s128 < 0)) $stop;
+         if (sr128 >= 128'sd65536 || sr128 <= -128'sd65536) $stop;
+      end
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
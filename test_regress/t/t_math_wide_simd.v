@@ -0,0 +1,62 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Check wide operations against the same computed per 32-bit word
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   localparam W = 1056;  // Not a multiple of any vector size
+   localparam N = W / 32;
+
+   integer cyc = 0;
+   reg [W-1:0] a = {N{32'h12345678}};
+   reg [W-1:0] b = {N{32'h9abcdef0}};
+
+   reg [W-1:0] exp;
+   reg [32:0] sum;
+   reg bitv;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      a <= {a[W-2:0], a[W-1] ^ a[700]} ^ {{(W-32){1'b0}}, cyc};
+      b <= (cyc % 4 == 2) ? a : ({b[0], b[W-1:1]} + a);
+
+      for (int i = 0; i < N; ++i) exp[i*32+:32] = a[i*32+:32] & b[i*32+:32];
+      if ((a & b) !== exp) $stop;
+      for (int i = 0; i < N; ++i) exp[i*32+:32] = a[i*32+:32] | b[i*32+:32];
+      if ((a | b) !== exp) $stop;
+      for (int i = 0; i < N; ++i) exp[i*32+:32] = a[i*32+:32] ^ b[i*32+:32];
+      if ((a ^ b) !== exp) $stop;
+      for (int i = 0; i < N; ++i) exp[i*32+:32] = ~a[i*32+:32];
+      if (~a !== exp) $stop;
+
+      sum = '0;
+      for (int i = 0; i < N; ++i) begin
+         sum = {1'b0, a[i*32+:32]} + {1'b0, b[i*32+:32]} + {32'b0, sum[32]};
+         exp[i*32+:32] = sum[31:0];
+      end
+      if ((a + b) !== exp) $stop;
+
+      bitv = 1'b0;
+      for (int i = 0; i < N; ++i) bitv = bitv ^ (^a[i*32+:32]);
+      if ((^a) !== bitv) $stop;
+      bitv = 1'b0;
+      for (int i = 0; i < N; ++i) bitv = bitv | (|b[i*32+:32]);
+      if ((|b) !== bitv) $stop;
+      if (|(a & ~a)) $stop;
+      bitv = 1'b1;
+      for (int i = 0; i < N; ++i) bitv = bitv & (a[i*32+:32] == b[i*32+:32]);
+      if ((a == b) !== bitv) $stop;
+
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
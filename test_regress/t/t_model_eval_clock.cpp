@@ -0,0 +1,32 @@
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+//
+
+#include "verilated.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <memory>
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    topp->clk = 0;
+    topp->eval();
+    // Run in two chunks, to check the clock phase and time carry over
+    uint64_t cycles = topp->evalClock(topp->clk, 5, 40);
+    VL_PRINTF("first cycles=%d count=%d time=%d\n", static_cast<int>(cycles),
+              static_cast<int>(topp->count), static_cast<int>(contextp->time()));
+    cycles = topp->evalClock(topp->clk, 5, 1000);
+    VL_PRINTF("second cycles=%d count=%d finish=%d\n", static_cast<int>(cycles),
+              static_cast<int>(topp->count), contextp->gotFinish());
+    topp->final();
+    return 0;
+}
@@ -0,0 +1,47 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   typedef struct {
+      logic [31:0] data;
+      logic [7:0] tag;
+   } entry_t;
+
+   integer cyc = 0;
+   // Array of unpacked structs, only whole elements are updated by NBAs
+   entry_t mem [63:0];
+   entry_t rd;
+
+   initial begin
+      for (int i = 0; i < 64; ++i) begin
+         mem[i].data = 0;
+         mem[i].tag = 0;
+      end
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      mem[cyc[5:0]] <= '{data: cyc * 3, tag: cyc[7:0]};
+      // Read of the old value in the same cycle
+      rd = mem[cyc[5:0]];
+      if (cyc >= 64) begin
+         `checkh(rd.data, (cyc - 64) * 3);
+         `checkh(rd.tag, cyc[7:0] - 8'd64);
+      end
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
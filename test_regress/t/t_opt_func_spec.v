@@ -0,0 +1,43 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   logic [31:0] a, b, c, d;
+
+   function automatic logic [31:0] step(input logic [31:0] value, input logic [2:0] mode);
+      /*verilator no_inline_task*/
+      case (mode)
+        3'd0: return value + 1;
+        3'd1: return value << 2;
+        3'd2: return value ^ 32'h5a5a_5a5a;
+        default: return ~value;
+      endcase
+   endfunction
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      a <= step(cyc, 3'd0);
+      b <= step(cyc, 3'd1);
+      c <= step(cyc, 3'd2);
+      d <= step(cyc, cyc[2:0]);
+      if (cyc > 1) begin
+         if (a != cyc) $stop;
+         if (b != (cyc - 1) << 2) $stop;
+         if (c != ((cyc - 1) ^ 32'h5a5a_5a5a)) $stop;
+      end
+      if (cyc == 3 && d != (32'd2 ^ 32'h5a5a_5a5a)) $stop;
+      if (cyc == 10) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,44 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+   reg [127:0] pos_sum = 128'h0;
+   reg [127:0] neg_sum = 128'h0;
+
+   // Intermediates too large for --localize-max-size, always written before read,
+   // and used by different functions, so they can share storage
+   reg [127:0] pos_tmp;
+   reg [127:0] neg_tmp;
+
+   always @(posedge clk) begin
+      pos_tmp = {crc, ~crc};
+      pos_sum <= pos_sum ^ pos_tmp ^ {pos_tmp[126:0], pos_tmp[127]};
+   end
+
+   always @(negedge clk) begin
+      neg_tmp = {~crc, crc};
+      neg_sum <= neg_sum + neg_tmp + {neg_tmp[63:0], neg_tmp[127:64]};
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      if (cyc == 99) begin
+         $write("[%0t] pos_sum=%x neg_sum=%x\n", $time, pos_sum, neg_sum);
+         if (pos_sum !== 128'hd4187feb279705b5d4187feb279705b5) $stop;
+         if (neg_sum !== 128'hffffffffffffffffffffffffffffff9d) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+   reg [63:0] sum = 64'h0;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      sum <= sum ^ {sum[62:0], sum[63]} ^ crc;
+      // Error path, unlikely, so moved out of line
+      if (crc == 64'h0) begin
+         $display("%%Error: crc went to zero at cyc=%0d", cyc);
+         $display("  crc=%x sum=%x", crc, sum);
+         $display("  crc[31:0]=%x crc[63:32]=%x", crc[31:0], crc[63:32]);
+         $stop;
+      end
+      if (cyc == 99) begin
+         $write("[%0t] cyc==%0d crc=%x sum=%x\n", $time, cyc, crc, sum);
+         if (sum !== 64'haa1b147a1ef4e36d) begin
+            $display("%%Error: sum=%x", sum);
+            $stop;
+         end
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
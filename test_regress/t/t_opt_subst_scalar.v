@@ -0,0 +1,32 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+
+   // Wide values built from the CRC, so the wide temporaries are not constant
+   wire [95:0] a = {crc[31:0], crc};
+   wire [95:0] b = {crc, crc[63:32]} ^ 96'h1234_5678_9abc_def0_0fed_cba9;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]};
+      if (((a + b) - b) !== a) $stop;
+      if ((~(~a & ~b)) !== (a | b)) $stop;
+      if (((a ^ b) ^ b) !== a) $stop;
+      if ((a >> 40) !== {40'h0, a[95:40]}) $stop;
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_opt_table_same.v"
+test.golden_filename = "t/t_opt_table_same.out"
+
+test.compile(verilator_flags2=["--stats", "--table-max-bytes 0"])
+
+if test.vlt_all:
+    test.file_grep(test.stats, r'Optimizations, Tables created\s+(\d+)', 0)
+    test.file_grep(test.stats, r'Optimizations, Tables bytes\s+(\d+)', 0)
+
+test.execute(expect_filename=test.golden_filename)
+
+test.passes()
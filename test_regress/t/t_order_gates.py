@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(verilator_flags2=["--stats"])
+
+test.execute()
+
+if test.vlt:
+    test.file_grep(test.stats, r'Optimizations, Order gated logic\s+[1-9]')
+    test.file_grep(test.stats, r'Optimizations, Order gated groups\s+[1-9]')
+    test.file_grep(test.stats, r'Optimizations, MergeCond merges\s+[1-9]')
+
+test.passes()
@@ -0,0 +1,47 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+// verilog_format: on
+
+module t (
+    input clk
+);
+
+   integer cyc = 0;
+
+   // Two subsystems, each mostly idle, with their blocks interleaved
+   wire en_a = cyc[2:0] == 3'd1;
+   wire en_b = cyc[3:0] == 4'd2;
+
+   reg [7:0] a0 = 0, a1 = 0, a2 = 0;
+   reg [7:0] b0 = 0, b1 = 0, b2 = 0;
+
+   always @(posedge clk) if (en_a) a0 <= a0 + 8'd1;
+   always @(posedge clk) if (en_b) b0 <= b0 + 8'd2;
+   always @(posedge clk) if (en_a) a1 <= a1 + 8'd3;
+   always @(posedge clk) if (en_b) b1 <= b1 + 8'd4;
+   always @(posedge clk) if (en_a) a2 <= a2 + 8'd5;
+   always @(posedge clk) if (en_b) b2 <= b2 + 8'd6;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 99) begin
+         // en_a was set on 13 cycles, en_b on 7 cycles
+         `checkh(a0, 8'd13);
+         `checkh(a1, 8'd39);
+         `checkh(a2, 8'd65);
+         `checkh(b0, 8'd14);
+         `checkh(b1, 8'd28);
+         `checkh(b2, 8'd42);
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
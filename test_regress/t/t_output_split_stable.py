@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_output_groups.v"
+
+flags = ["--output-split", "1", "--output-split-stable", "--output-groups", "2"]
+
+test.compile(verilator_flags2=flags)
+
+test.execute()
+
+# Files are named by the hash of their first function
+test.glob_some(test.obj_dir + "/*__DepSet_*__*.cpp")
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "_classes.mk", r'vm_classes_\d')
+
+# Rerunning gives the same files
+first = sorted(test.glob_some(test.obj_dir + "/*.cpp"))
+test.compile(verilator_flags2=flags)
+if sorted(test.glob_some(test.obj_dir + "/*.cpp")) != first:
+    test.error("Stable output split differs between runs")
+
+test.passes()
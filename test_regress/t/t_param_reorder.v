@@ -0,0 +1,34 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   // All three are the same flavor, so only one specialization is made
+   sub #(.WIDTH(8), .DEPTH(4)) u_a ();
+   sub #(.DEPTH(4), .WIDTH(8)) u_b ();
+   sub #(.DEPTH(4), .WIDTH(8)) u_c ();
+   // Different flavor
+   sub #(.DEPTH(8), .WIDTH(4)) u_d ();
+
+   initial begin
+      if (u_a.SIZE != 32) $stop;
+      if (u_b.SIZE != 32) $stop;
+      if (u_c.SIZE != 32) $stop;
+      if (u_d.SIZE != 32) $stop;
+      if ($bits(u_b.mem) != 32) $stop;
+      if ($bits(u_d.mem) != 32) $stop;
+      if ($bits(u_d.mem[0]) != 4) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
+
+module sub #(
+   parameter WIDTH = 1,
+   parameter DEPTH = 1
+);
+   localparam SIZE = WIDTH * DEPTH;
+   logic [WIDTH-1:0] mem[DEPTH];
+endmodule
@@ -0,0 +1,68 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_vcd_c.h>
+
+#include <cstring>
+#include <memory>
+
+#include "TestCheck.h"
+#include VM_PREFIX_INCLUDE
+
+int errors = 0;
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->traceEverOn(true);
+    contextp->commandArgs(argc, argv);
+    std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+    std::unique_ptr<VerilatedVcdC> tfp{new VerilatedVcdC};
+    topp->trace(tfp.get(), 99);
+    tfp->open(VL_STRINGIFY(TEST_OBJ_DIR) "/simx.vcd");
+
+    // Nothing counted before the first evaluation
+    TEST_CHECK_EQ(contextp->perfStats().m_evals, 0);
+
+    constexpr uint64_t EVALS = 100;
+    topp->clk = 0;
+    topp->in = 0;
+    for (uint64_t i = 0; i < EVALS; ++i) {
+        topp->clk = !topp->clk;
+        topp->in = i;
+        topp->eval();
+        tfp->dump(contextp->time());
+        contextp->timeInc(1);
+    }
+    tfp->close();
+
+    const VerilatedPerfStats stats = contextp->perfStats();
+    TEST_CHECK_EQ(stats.m_evals, EVALS);
+    TEST_CHECK(stats.m_evalNs, "> 0", stats.m_evalNs > 0);
+    for (size_t i = 0; i < VerilatedPerfStats::REGIONS; ++i) {
+        // Each loop ends with an iteration that found no triggers
+        const VerilatedPerfStats::RegionStats& region = stats.m_regions[i];
+        TEST_CHECK_EQ(region.m_iterations, region.m_loops + region.m_triggered);
+    }
+    const VerilatedPerfStats::RegionStats& nba = stats.m_regions[VerilatedPerfStats::REGION_NBA];
+    TEST_CHECK_EQ(nba.m_loops, EVALS);
+    // The logic runs on each rising edge, perhaps not including the first evaluation's
+    TEST_CHECK(nba.m_triggered, EVALS / 2, nba.m_triggered + 1 >= EVALS / 2);
+    TEST_CHECK(nba.m_triggered, EVALS / 2, nba.m_triggered <= EVALS / 2);
+    TEST_CHECK(nba.m_ns, "> 0", nba.m_ns > 0);
+    const VerilatedPerfStats::RegionStats& ico = stats.m_regions[VerilatedPerfStats::REGION_ICO];
+    TEST_CHECK_EQ(ico.m_loops, EVALS);
+    TEST_CHECK_CSTR(VerilatedPerfStats::regionName(VerilatedPerfStats::REGION_NBA), "nba");
+    TEST_CHECK_EQ(stats.m_delayQueueMaxDepth, 0);
+    TEST_CHECK(stats.m_traceBytes, "> 0", stats.m_traceBytes > 0);
+
+    topp->final();
+    if (errors) return 10;
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
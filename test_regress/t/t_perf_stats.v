@@ -0,0 +1,22 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Outputs
+   out,
+   // Inputs
+   clk, in
+   );
+   input clk;
+   input [7:0] in;
+   output [7:0] out;
+
+   reg [7:0] cnt = 0;
+
+   always @(posedge clk) cnt <= cnt + 1;
+
+   assign out = cnt + in;
+endmodule
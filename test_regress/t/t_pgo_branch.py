@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(v_flags2=["--prof-pgo", "--stats"])
+
+test.file_grep_not(test.stats, r'Optimizations, Branch PGO instrumented\s+0$')
+
+test.execute(all_run_flags=[" +verilator+prof+vlt+file+" + test.obj_dir + "/profile.vlt"])
+
+test.file_grep(test.obj_dir + "/profile.vlt", r'profile_data -model "\w+" -branch ')
+
+test.compile(v_flags2=["--stats", test.obj_dir + "/profile.vlt"])
+
+test.file_grep_not(test.stats, r'Optimizations, Branch PGO predicted\s+0$')
+test.file_grep(test.stats, r'Optimizations, Branch PGO instrumented\s+(\d+)', 0)
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,26 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   integer odd = 0;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      // Taken almost never
+      if (cyc[5:0] == 6'h3f) odd <= odd + 1;
+      if (cyc == 99) begin
+         if (odd != 1) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+flags = ['--stats', '--preproc-cache', test.obj_dir + '/ppcache']
+
+# First run fills the cache
+test.compile(verilator_flags2=flags)
+test.file_grep(test.stats, r'Preprocessor cache, misses\s+\d+')
+test.file_grep_not(test.stats, r'Preprocessor cache, hits')
+
+# Same sources and defines hit
+test.compile(verilator_flags2=flags)
+test.file_grep(test.stats, r'Preprocessor cache, hits\s+\d+')
+test.file_grep_not(test.stats, r'Preprocessor cache, misses')
+
+# Different defines miss
+test.compile(verilator_flags2=flags + ['+define+VALUE=2'])
+test.file_grep(test.stats, r'Preprocessor cache, misses\s+\d+')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,19 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`ifndef VALUE
+ `define VALUE 1
+`endif
+
+`include "t_preproc_cache.vh"
+
+module t (/*AUTOARG*/);
+   initial begin
+      if (`INC_VALUE != `VALUE + 1) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
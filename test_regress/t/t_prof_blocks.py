@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_gen_alw.v"  # Any, as long as runs a few cycles
+
+test.compile(v_flags2=["--prof-blocks", "--prof-exec"], threads=(2 if test.vltmt else 1))
+
+test.execute(all_run_flags=[
+    "+verilator+prof+blocks+file+" + test.obj_dir + "/profile_blocks.dat",
+    " +verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat"])  # yapf:disable
+
+test.file_grep(test.obj_dir + "/profile_blocks.dat",
+               r'VLPROFBLOCK \S+ \d+ [\d.]+ [1-9]\d* \S*t_gen_alw\.v:\d+')
+test.file_grep(test.obj_dir + "/profile_exec.dat", r'SECTION_PUSH \d+ block \S*t_gen_alw\.v:\d+')
+
+test.passes()
@@ -0,0 +1,63 @@
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+//
+
+#include "verilated.h"
+#include "verilated_profiler.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include <cstring>
+#include <memory>
+
+class Consumer final : public VlExecutionConsumer {
+public:
+    unsigned m_evals = 0;
+    unsigned m_mtasks = 0;
+    void record(uint32_t, const VlExecutionRecord& rec) override {
+        if (rec.type() == VlExecutionRecord::Type::SECTION_PUSH
+            && !std::strcmp(rec.sectionName(), "eval")) {
+            ++m_evals;
+        } else if (rec.type() == VlExecutionRecord::Type::MTASK_BEGIN) {
+            ++m_mtasks;
+        }
+    }
+};
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->threads(TEST_USE_THREADS);
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    Consumer consumer;
+    VlExecutionProfiler* const profilerp = VlExecutionProfiler::get(*contextp);
+    profilerp->consumer(&consumer);
+
+    topp->clk = false;
+    topp->eval();
+    profilerp->poll();
+
+    contextp->timeInc(10);
+    while ((contextp->time() < 1100) && !contextp->gotFinish()) {
+        topp->clk = !topp->clk;
+        topp->eval();
+        profilerp->poll();
+        contextp->timeInc(5);
+    }
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+    topp->final();
+    profilerp->consumer(nullptr);
+
+    VL_PRINTF("consumer evals=%u\n", consumer.m_evals);
+    VL_PRINTF("consumer mtasks=%u\n", consumer.m_mtasks);
+    return 0;
+}
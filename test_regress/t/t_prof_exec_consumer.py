@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_gen_alw.v"  # Any, as long as runs a few cycles
+
+threads_num = (2 if test.vltmt else 1)
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             v_flags2=["--prof-exec --exe", test.pli_filename],
+             threads=threads_num,
+             make_flags=["CPPFLAGS_ADD=\"-DTEST_USE_THREADS=" + str(threads_num) + "\""])
+
+test.execute(all_run_flags=[" +verilator+prof+exec+file+" + test.obj_dir + "/profile_exec.dat"])
+
+test.file_grep(test.run_log_filename, r'consumer evals=[1-9]')
+if test.vltmt:
+    test.file_grep(test.run_log_filename, r'consumer mtasks=[1-9]')
+
+# Records went to the consumer, not the file
+if os.path.exists(test.obj_dir + "/profile_exec.dat"):
+    test.error("Unexpected profile_exec.dat")
+
+test.passes()
@@ -0,0 +1,29 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+
+   input clk;
+   int   cyc = 0;
+
+   // Both are public for reading, but only 'observed' may be read during evaluation
+   wire [31:0] sampled = cyc * 3;
+   wire [31:0] observed = cyc * 5;
+   wire [31:0] sum = sampled + observed;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (sum != cyc * 8) $stop;
+      if (sampled != cyc * 3) $stop;
+      if (cyc == 10) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,71 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); $stop; end while(0);
+`define checks(gotv,expv) do if ((gotv) != (expv)) begin $write("%%Error: %s:%0d:  got='%s' exp='%s'\n", `__FILE__,`__LINE__, (gotv), (expv)); $stop; end while(0);
+
+module t (/*AUTOARG*/);
+
+   int q[$:3];  // Small bound, stored in a ring buffer
+   int big[$:100000];  // Large bound, stored in a deque
+   string s[$:1];
+   int u[$];
+
+   initial begin
+      // Wrap around the end of the ring many times
+      for (int i = 0; i < 100; ++i) begin
+         q.push_back(i);
+         if (q.size() > 2) void'(q.pop_front());
+      end
+      `checkh(q.size(), 2);
+      `checkh(q[0], 98);
+      `checkh(q[1], 99);
+      for (int i = 0; i < 10; ++i) q.push_front(i);
+      `checks($sformatf("%p", q), "'{'h9, 'h8, 'h7, 'h6} ");
+      `checkh(q[$], 6);
+
+      q.sort();
+      `checks($sformatf("%p", q), "'{'h6, 'h7, 'h8, 'h9} ");
+      q.rsort();
+      `checks($sformatf("%p", q), "'{'h9, 'h8, 'h7, 'h6} ");
+      q.reverse();
+      `checks($sformatf("%p", q), "'{'h6, 'h7, 'h8, 'h9} ");
+      `checkh(q.sum(), 30);
+      u = q.find(x) with (x > 7);
+      `checks($sformatf("%p", u), "'{'h8, 'h9} ");
+      `checks($sformatf("%p", q[1:2]), "'{'h7, 'h8} ");
+
+      q.delete(1);
+      `checks($sformatf("%p", q), "'{'h6, 'h8, 'h9} ");
+      q.insert(1, 7);
+      `checks($sformatf("%p", q), "'{'h6, 'h7, 'h8, 'h9} ");
+
+      // Conversion between queues of different bounds
+      big = q;
+      big.push_back(10);
+      `checkh(big.size(), 5);
+      q = big;
+      `checkh(q.size(), 3);
+      `checkh(q[0], 6);
+      u = {q, q};
+      q = u;
+      `checks($sformatf("%p", q), "'{'h6, 'h7, 'h8} ");
+
+      q.delete();
+      `checkh(q.size(), 0);
+      `checkh(q.pop_back(), 0);
+
+      s.push_back("a");
+      s.push_back("b");
+      s.push_back("c");
+      s.push_front("z");
+      `checks($sformatf("%p", s), "'{\"z\", \"a\"} ");
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
@@ -0,0 +1,35 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/);
+
+   int iarray [64:0];
+   int jarray [63:0];
+   int oarray [63:0];
+   int karray [3:0];
+
+   initial begin
+      for (int i = 0; i < 65; i = i + 1) iarray[i] = i;
+      for (int i = 0; i < 64; i = i + 1) jarray[i] = i * 3;
+      for (int i = 0; i < 4; i = i + 1) karray[i] = i + 100;
+
+      // Lane expression, with lane and invariant indices
+      for (int i = 0; i < 64; i = i + 1) begin
+         oarray[i] = (iarray[i + 1] ^ jarray[i]) + karray[2];
+      end
+
+      for (int i = 0; i < 64; i = i + 1) begin
+         if (oarray[i] !== (((i + 1) ^ (i * 3)) + 102)) begin
+            $display("%%Error: oarray[%0d] = %0d", i, oarray[i]);
+            $stop;
+         end
+      end
+
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
@@ -0,0 +1,24 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+   // Larger than a huge page
+   logic [31:0] mem[1024 * 1024];
+   int unsigned sum;
+
+   initial begin
+      if (mem[0] !== 32'h0) $stop;
+      if (mem[1024 * 1024 - 1] !== 32'h0) $stop;
+      for (int i = 0; i < 1024 * 1024; i += 4096) mem[i] = i;
+      sum = 0;
+      for (int i = 0; i < 1024 * 1024; i += 4096) sum += mem[i];
+      if (sum != 32'd133693440) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
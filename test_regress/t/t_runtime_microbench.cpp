@@ -0,0 +1,160 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Microbenchmarks of verilated runtime primitives.  Prints one line per
+// measurement, "microbench <primitive> <size> <ns/op>".  Use +iters+<n>
+// to set the number of repetitions of each measurement.
+
+#include <verilated.h>
+#include <verilated_vcd_c.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include VM_PREFIX_INCLUDE
+
+static uint64_t s_sink = 0;  // Results, so the measured work is not optimized away
+
+// Hide a value from the optimizer, so work on it is not hoisted out of loops
+template <typename T>
+static inline void opaque(T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : "+m"(value) : : "memory");
+#endif
+}
+
+template <typename T_Func>
+static void bench(const char* namep, size_t size, uint64_t iters, T_Func func) {
+    func();  // Warm up
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iters; ++i) func();
+    const std::chrono::duration<double, std::nano> delta
+        = std::chrono::steady_clock::now() - start;
+    printf("microbench %-16s %8zu %12.3f\n", namep, size, delta.count() / iters);
+}
+
+static void benchWide(int words, uint64_t iters) {
+    std::vector<EData> a(words);
+    std::vector<EData> b(words);
+    std::vector<EData> o(words);
+    for (int i = 0; i < words; ++i) {
+        a[i] = 0x9e3779b9U * (i + 1);
+        b[i] = 0x7f4a7c15U * (i + 3);
+    }
+    const int bits = words * VL_EDATASIZE;
+    bench("wide_add", bits, iters, [&]() {
+        VL_ADD_W(words, o.data(), a.data(), b.data());
+        s_sink += o[words - 1];
+    });
+    bench("wide_mul", bits, iters, [&]() {
+        VL_MUL_W(words, o.data(), a.data(), b.data());
+        s_sink += o[words - 1];
+    });
+    bench("wide_eq", bits, iters, [&]() { s_sink += VL_EQ_W(words, a.data(), b.data()); });
+    bench("wide_shiftl", bits, iters, [&]() {
+        VL_SHIFTL_WWI(bits, bits, 32, o.data(), a.data(), static_cast<IData>(s_sink % bits));
+        s_sink += o[words - 1];
+    });
+    bench("wide_redxor", bits, iters, [&]() { s_sink += VL_REDXOR_W(words, a.data()); });
+}
+
+template <size_t N_Size>
+static void benchTrigger(uint64_t iters) {
+    VlTriggerVec<N_Size> a;
+    VlTriggerVec<N_Size> b;
+    VlTriggerVec<N_Size> c;
+    // Sparse, as typical of triggers
+    for (size_t i = 0; i < 4; ++i) a.setBit((i * 997) % N_Size, true);
+    b.setBit(0, true);
+    bench("trig_any", N_Size, iters, [&]() {
+        opaque(a);
+        s_sink += a.any();
+    });
+    bench("trig_or_clear", N_Size, iters, [&]() {
+        opaque(a);
+        c.thisOr(a);
+        s_sink += c.any();
+        c.clear();
+    });
+    bench("trig_andnot", N_Size, iters, [&]() {
+        opaque(a);
+        c.andNot(a, b);
+        s_sink += c.word(0);
+    });
+}
+
+static void benchContainers(size_t size, uint64_t iters) {
+    VlQueue<IData> q;
+    VlAssocArray<IData, IData> m;
+    for (size_t i = 0; i < size; ++i) {
+        q.push_back(i);
+        m.at(i * 7) = i;
+    }
+    IData n = 0;
+    bench("queue_push_pop", size, iters, [&]() {
+        q.push_back(++n);
+        s_sink += q.pop_front();
+    });
+    bench("queue_at", size, iters, [&]() {
+        n = n * 1103515245U + 12345U;
+        s_sink += q.at(n % size);
+    });
+    bench("assoc_at", size, iters, [&]() {
+        n = n * 1103515245U + 12345U;
+        s_sink += m.at((n % size) * 7);
+    });
+    bench("assoc_exists", size, iters, [&]() {
+        n = n * 1103515245U + 12345U;
+        s_sink += m.exists(n % (size * 7));
+    });
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    contextp->traceEverOn(true);
+
+    uint64_t iters = 1000;
+    const char* const argp = contextp->commandArgsPlusMatch("iters+");
+    if (argp && argp[0]) iters = std::strtoull(argp + std::strlen("+iters+"), nullptr, 10);
+
+    for (const int words : {2, 4, 8, 16, 32}) benchWide(words, iters);
+
+    benchTrigger<64>(iters);
+    benchTrigger<512>(iters);
+    benchTrigger<4096>(iters);
+
+    for (const size_t size : {16, 1024, 65536}) benchContainers(size, iters);
+
+    // Scheduler and tracing through the model, whose processes wake on
+    // different delays.  vcd_dump includes the cost of delay_eval.
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+    const std::unique_ptr<VerilatedVcdC> tfp{new VerilatedVcdC};
+    topp->trace(tfp.get(), 99);
+    tfp->open(VL_STRINGIFY(TEST_OBJ_DIR) "/simx.vcd");
+    const auto step = [&]() {
+        topp->eval();
+        contextp->time(topp->nextTimeSlot());
+    };
+    bench("delay_eval", 16, iters, step);
+    bench("vcd_dump", 16, iters, [&]() {
+        step();
+        tfp->dump(contextp->time());
+    });
+    tfp->close();
+    topp->final();
+
+    printf("microbench checksum %" PRIu64 "\n", s_sink);
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+# With --benchmark <n>, each measurement runs n iterations
+iters = (int(test.benchmark) if test.benchmark else 100)
+
+test.compile(make_main=False,
+             verilator_flags2=["--timing --trace-vcd --exe", test.pli_filename],
+             benchmark=1)
+
+test.execute(all_run_flags=["+iters+" + str(iters)])
+
+got = set()
+with open(test.run_log_filename, 'r', encoding="utf8") as fh:
+    for line in fh:
+        m = re.match(r'^microbench (\w+) +(\d+) +(\d+\.\d+)', line)
+        if m:
+            got.add(m.group(1))
+
+for name in [
+        'wide_add', 'wide_mul', 'wide_eq', 'wide_shiftl', 'wide_redxor', 'trig_any',
+        'trig_or_clear', 'trig_andnot', 'queue_push_pop', 'queue_at', 'assoc_at',
+        'assoc_exists', 'delay_eval', 'vcd_dump'
+]:
+    if name not in got:
+        test.error("Missing microbench result for " + name)
+
+test.passes()
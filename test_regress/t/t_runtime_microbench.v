@@ -0,0 +1,27 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+   localparam int N = 16;
+
+   logic [255:0] wide[N];
+   int unsigned cnt[N];
+
+   // Processes waking on different delays, each changing traced state
+   for (genvar i = 0; i < N; ++i) begin : g_proc
+      initial begin
+         cnt[i] = 0;
+         wide[i] = {8{32'(i)}};
+         forever begin
+            #(i + 1);
+            cnt[i] = cnt[i] + 1;
+            wide[i] = {wide[i][254:0], wide[i][255]} ^ 256'(cnt[i]);
+         end
+      end
+   end
+
+endmodule
@@ -0,0 +1,49 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static void cycles(VM_PREFIX* topp, int n) {
+    for (int i = 0; i < n; ++i) {
+        topp->clk = 0;
+        topp->eval();
+        topp->clk = 1;
+        topp->eval();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    cycles(topp.get(), 10);
+
+    // Clones continue identically to the model they were copied from
+    const std::unique_ptr<VM_PREFIX> clonep{new VM_PREFIX{contextp.get(), "clone"}};
+    clonep->copyStateFrom(*topp);
+    TEST_CHECK_EQ(clonep->crc, topp->crc);
+    cycles(topp.get(), 20);
+    cycles(clonep.get(), 20);
+    TEST_CHECK_EQ(clonep->crc, topp->crc);
+
+    clonep->final();
+    topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
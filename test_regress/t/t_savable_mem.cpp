@@ -0,0 +1,65 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static void cycles(VerilatedContext* contextp, VM_PREFIX* topp, int n) {
+    for (int i = 0; i < n; ++i) {
+        topp->clk = 0;
+        topp->eval();
+        contextp->timeInc(5);
+        topp->clk = 1;
+        topp->eval();
+        contextp->timeInc(5);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+
+    cycles(contextp.get(), topp.get(), 10);
+
+    VerilatedSaveMem snapshot;
+    snapshot.open();
+    snapshot << *topp;
+    snapshot.close();
+    TEST_CHECK_EQ(snapshot.isOpen(), false);
+
+    const uint64_t savedCrc = topp->crc;
+    cycles(contextp.get(), topp.get(), 20);
+    const uint64_t expCrc = topp->crc;
+    TEST_CHECK_NE(expCrc, savedCrc);
+
+    // Each restore of the same snapshot must continue identically
+    for (int i = 0; i < 3; ++i) {
+        {
+            VerilatedRestoreMem os;
+            os.open(snapshot.data());
+            os >> *topp;
+        }
+        TEST_CHECK_EQ(topp->crc, savedCrc);
+        cycles(contextp.get(), topp.get(), 20);
+        TEST_CHECK_EQ(topp->crc, expCrc);
+    }
+
+    topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,24 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Outputs
+   crc,
+   // Inputs
+   clk
+   );
+   input clk;
+   output reg [63:0] crc = 64'h5aef0c8d_d70a4497;
+
+   reg [31:0] mem[15:0];
+   integer cyc = 0;
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      mem[cyc[3:0]] <= crc[31:0] ^ mem[cyc[3:0]];
+      crc <= {crc[62:0], crc[63] ^ crc[2] ^ crc[0]} ^ {32'h0, mem[crc[3:0]]};
+   end
+endmodule
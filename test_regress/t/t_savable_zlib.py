@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_savable.v"
+
+if not os.path.exists("/usr/include/zlib.h"):
+    test.skip("No zlib library installed")
+
+test.compile(v_flags2=["--savable", "-CFLAGS -DVL_SAVE_ZLIB", "-LDFLAGS -lz"], save_time=500)
+
+test.execute(check_finished=False, all_run_flags=['+save_time=500'])
+
+with open(test.obj_dir + "/saved.vltsv", "rb") as fh:
+    if fh.read(2) != b"\x1f\x8b":
+        test.error("saved.vltsv not gzip compressed")
+
+test.execute(all_run_flags=['+save_restore=1'])
+
+test.passes()
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(verilator_flags2=["--stats"], verilator_make_gmake=False)
+
+# The domains only cross through synchronizer flops, so stay separate clusters
+test.file_grep(test.stats, r'Scheduling, clock domains\s+(\d+)', 2)
+test.file_grep(test.stats, r'Scheduling, clock domain clusters\s+(\d+)', 2)
+test.file_grep(test.stats, r'Scheduling, clock domain crossing variables\s+[1-9]')
+
+test.passes()
@@ -0,0 +1,28 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Two clock domains communicating only through two-flop synchronizers
+module t (
+    input clk_core,
+    input clk_periph,
+    output reg [7:0] core_count,
+    output reg [7:0] periph_count
+);
+
+   reg [1:0] core_sync;
+   reg [1:0] periph_sync;
+
+   always @(posedge clk_core) begin
+      core_sync <= {core_sync[0], periph_count[0]};
+      core_count <= core_count + {7'd0, core_sync[1]} + 8'd1;
+   end
+
+   always @(posedge clk_periph) begin
+      periph_sync <= {periph_sync[0], core_count[0]};
+      periph_count <= periph_count + {7'd0, periph_sync[1]};
+   end
+
+endmodule
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(verilator_flags2=["--stats"])
+
+# The large combinational block reads 'clk', so is replicated into 'ico', and the copies merged
+test.file_grep(test.stats, r'Scheduling, replicated procedures in own functions\s+(\d+)', 1)
+test.file_grep(test.stats, r'Scheduling, instrs of replicated logic: Input\s+[1-9]')
+test.file_grep(test.stats, r'Optimizations, Combined CFuncs\s+[1-9]')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,51 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// Large combinational logic driven both by the top level input and by flops
+module t (
+    input clk
+);
+
+  integer cyc = 0;
+  logic [31:0] acc = 0;
+  logic [31:0] mix;
+
+  sub sub (
+      .clk(clk),
+      .in(cyc[7:0]),
+      .acc(acc),
+      .mix(mix)
+  );
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    acc <= acc + mix;
+    if (cyc == 99) begin
+      $display("acc=%x", acc);
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
+
+module sub (
+    input clk,
+    input [7:0] in,
+    input [31:0] acc,
+    output logic [31:0] mix
+);
+
+  always_comb begin
+    mix = {23'b0, in, clk} ^ acc;
+    for (int i = 0; i < 8; ++i) begin
+      mix = {mix[30:0], mix[31]} + (mix ^ 32'h9e3779b9);
+      mix = mix ^ (mix >> 7) ^ {in, acc[23:0]};
+      mix = mix + (acc << i) - {acc[15:0], in, in};
+    end
+  end
+
+endmodule
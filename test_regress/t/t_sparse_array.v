@@ -0,0 +1,51 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+// verilog_format: off
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+// verilog_format: on
+
+module t (
+    input clk
+);
+
+   integer cyc = 0;
+
+   // Sparse, as at least --sparse-array-depth elements
+   logic [31:0] mem[0:(1<<24)-1];
+   logic [95:0] wmem[1<<20];
+   logic [31:0] back[0:(1<<24)-1];
+   // Dense
+   logic [31:0] small[16];
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc < 16) begin
+         mem[cyc*24'h12345] <= cyc;
+         wmem[cyc*20'h1234] <= {3{cyc}};
+         small[cyc] <= ~cyc;
+      end
+      else if (cyc == 20) begin
+         `checkh(mem[5*24'h12345], 32'd5);
+         `checkh(mem[15*24'h12345], 32'd15);
+         `checkh(wmem[7*20'h1234], {3{32'd7}});
+         `checkh(small[3], ~32'd3);
+         mem[24'h123456] <= 32'hfeedbeef;
+      end
+      else if (cyc == 21) begin
+         $writememh(`OUT_TMP, mem);
+         $readmemh(`OUT_TMP, back);
+         `checkh(back[24'h123456], 32'hfeedbeef);
+         `checkh(back[2*24'h12345], 32'd2);
+      end
+      else if (cyc == 22) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule
@@ -0,0 +1,36 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define checks(gotv,expv) do if ((gotv) != (expv)) begin $write("%%Error: %s:%0d:  got='%s' exp='%s'\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t (
+    input clk
+);
+
+  int cyc = 0;
+  string name;
+  string path;
+  string msg;
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    name = $sformatf("blk%0d", cyc);
+    path = {"top.", name, ".", "inst"};
+    msg = {path, " \"quoted\" with a long literal\n"};
+    if (cyc == 3) begin
+      `checks(path, "top.blk3.inst");
+      `checks(msg, "top.blk3.inst \"quoted\" with a long literal\n");
+      `checks({name, name, name}, "blk3blk3blk3");
+      if (path == "top.blk3.inst with a long literal beyond SSO") $stop;
+    end
+    if (cyc == 5) begin
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
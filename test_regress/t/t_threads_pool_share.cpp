@@ -0,0 +1,68 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Multiple Model Test Module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+//
+
+#include <verilated.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+#include VM_PREFIX_INCLUDE
+
+double sc_time_stamp() { return 0; }
+
+int errors = 0;
+
+static constexpr int N_MODELS = 4;
+
+void sim(VM_PREFIX* topp) {
+    VerilatedContext* const contextp = topp->contextp();
+    // This test created a thread, so need to associate VerilatedContext with it
+    Verilated::threadContextp(contextp);
+    while (!topp->done_o && !contextp->gotFinish()) {
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::unique_ptr<VerilatedContext>> contexts;
+    std::vector<std::unique_ptr<VM_PREFIX>> tops;
+    for (int i = 0; i < N_MODELS; ++i) {
+        contexts.emplace_back(new VerilatedContext);
+        contexts.back()->commandArgs(argc, argv);
+        if (i == 0) {
+            contexts.back()->threads(3);
+        } else {
+            contexts.back()->threadPoolShare(*contexts.front());
+        }
+        TEST_CHECK_EQ(contexts.back()->threads(), 3);
+        tops.emplace_back(new VM_PREFIX{contexts.back().get(), "top"});
+        // All contexts use the same pool
+        TEST_CHECK_EQ(contexts.back()->threadPoolp(), contexts.front()->threadPoolp());
+    }
+
+    std::vector<std::thread> threads;
+    for (auto& topp : tops) threads.emplace_back(sim, topp.get());
+    for (auto& thread : threads) thread.join();
+
+    for (auto& topp : tops) {
+        TEST_CHECK_EQ(topp->done_o, 1);
+        topp->final();
+    }
+    tops.clear();
+    contexts.clear();
+
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,34 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk,
+    output bit done_o
+);
+
+  // Independent logic, so there is more than one mtask
+  bit [31:0] cnt_a;
+  bit [31:0] cnt_b;
+  bit [63:0] acc_a;
+  bit [63:0] acc_b;
+
+  always @(posedge clk) begin
+    cnt_a <= cnt_a + 1;
+    acc_a <= acc_a * 3 + {32'h0, cnt_a};
+  end
+  always @(posedge clk) begin
+    cnt_b <= cnt_b + 2;
+    acc_b <= acc_b * 5 + {32'h0, cnt_b};
+  end
+
+  always @(posedge clk) begin
+    if (cnt_a == 100) begin
+      if (cnt_b != 200) $stop;
+      done_o <= 1'b1;
+    end
+  end
+
+endmodule
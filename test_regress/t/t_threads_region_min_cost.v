@@ -0,0 +1,39 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Outputs
+   x, y,
+   // Inputs
+   clk
+   );
+   input clk;
+   output wire [31:0] x;
+   output wire [31:0] y;
+
+   integer cyc = 0;
+   reg [31:0] a = 0;
+   reg [31:0] b = 0;
+
+   // Combinational logic of a top level input, evaluated in the 'ico' region
+   assign x = a + {31'b0, clk};
+   assign y = b ^ {32{clk}};
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      a <= a + 3;
+      b <= b + 5;
+      if (cyc > 2) begin
+         // Sampled right after the posedge of clk
+         if (x !== a + 1) $stop;
+         if (y !== ~b) $stop;
+      end
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+test.compile(verilator_flags2=["--stats", test.wno_unopthreads_for_few_cores])
+
+test.execute()
+
+test.file_grep(test.stats, r'MTask graph, final, replicated mtask groups\s+(\d+)')
+test.file_grep(test.stats, r'MTask graph, final, replicated mtask count\s+(\d+)')
+
+test.passes()
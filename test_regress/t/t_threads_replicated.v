@@ -0,0 +1,42 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   wire [31:0] sum0, sum1, sum2, sum3;
+
+   pe pe0 (.clk, .in(cyc + 0), .sum(sum0));
+   pe pe1 (.clk, .in(cyc + 1), .sum(sum1));
+   pe pe2 (.clk, .in(cyc + 2), .sum(sum2));
+   pe pe3 (.clk, .in(cyc + 3), .sum(sum3));
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 20) begin
+         if (sum0 == sum1 || sum1 == sum2 || sum2 == sum3) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module pe (
+   input clk,
+   input [31:0] in,
+   output logic [31:0] sum
+   );
+   /*verilator no_inline_module*/
+   logic [31:0] acc = 0;
+   always @ (posedge clk) begin
+      acc <= acc * 32'd1103515245 + in;
+      sum <= acc ^ (acc >> 7) ^ (in << 3);
+   end
+endmodule
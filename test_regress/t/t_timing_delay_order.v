@@ -0,0 +1,44 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`timescale 1ns/1ns
+
+// Processes resuming at the same time must resume in the order they
+// delayed, whether the delay was short or long
+module t;
+   string order = "";
+   int    ticks = 0;
+
+   initial begin
+      #5000 order = {order, "A"};
+      #20000 order = {order, "D"};
+   end
+   initial begin
+      #1000;
+      #4000 order = {order, "B"};
+      #17000;
+      #3000 order = {order, "E"};
+   end
+   initial begin
+      #4999;
+      #1 order = {order, "C"};
+      #20000 order = {order, "F"};
+   end
+
+   // A clock spanning the whole test
+   initial forever #7 ++ticks;
+
+   initial begin
+      #30000;
+`ifdef TEST_VERBOSE
+      $display("order=%s ticks=%0d", order, ticks);
+`endif
+      if (order != "ABCDFE") $stop;
+      if (ticks != 30000 / 7) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
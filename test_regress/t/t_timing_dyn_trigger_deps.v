@@ -0,0 +1,61 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+class Flag;
+   int m_value;
+   task wait_for(int value);
+      wait (m_value == value);
+   endtask
+   function void set(int value);
+      m_value = value;
+   endfunction
+endclass
+
+module t;
+   Flag flag;
+   mailbox #(int) mbox;
+   semaphore sem;
+   int sum = 0;
+
+   initial begin
+      flag = new;
+      mbox = new(2);
+      sem = new;
+      fork
+         begin  // Consumer
+            int value;
+            for (int i = 1; i <= 4; ++i) begin
+               mbox.get(value);
+               if (value != i) $stop;
+               sum += value;
+            end
+            sem.put(2);
+         end
+         begin  // Producer
+            for (int i = 1; i <= 4; ++i) begin
+               #1 mbox.put(i);
+            end
+         end
+         begin
+            sem.get(2);
+            if (sum != 10) $stop;
+            if ($time != 4) $stop;
+            flag.set(1);
+         end
+         begin
+            flag.wait_for(1);
+            if ($time != 4) $stop;
+            #2 flag.set(2);
+         end
+         begin
+            flag.wait_for(2);
+            if ($time != 6) $stop;
+         end
+      join
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
@@ -0,0 +1,30 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+   logic clk = 0;
+   logic unused_fast_clk = 0;
+   logic unused_slow_clk = 0;
+   int count = 0;
+
+   // Used clock
+   always #5 clk = ~clk;
+
+   // Clocks nothing is sensitive to, which need not wake the scheduler
+   always #1 unused_fast_clk = ~unused_fast_clk;
+   initial forever #3 unused_slow_clk = !unused_slow_clk;
+
+   always @(posedge clk) count <= count + 1;
+
+   initial begin
+      #1000;
+      if (count != 100) $stop;
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+
+endmodule
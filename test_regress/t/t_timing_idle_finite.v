@@ -0,0 +1,29 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+   logic finite_clk = 0;
+   logic idle_clk = 0;
+   logic running = 1;
+
+   // Finite loops only wait, but are kept as they set the end of simulation
+   initial repeat (100) #10 finite_clk = ~finite_clk;
+   initial while (running) #7;
+   initial #500 running = 0;
+
+   // Infinite loop with a clock nothing reads, which is removed
+   always #1 idle_clk = ~idle_clk;
+
+   final begin
+      if ($time != 1000) begin
+         $write("%%Error: $time=%0t\n", $time);
+         $stop;
+      end
+      $write("*-* All Finished *-*\n");
+   end
+
+endmodule
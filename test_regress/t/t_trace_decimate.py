@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_trace_dumpvars_dyn.v"
+
+test.compile(make_main=False, verilator_flags2=["--trace-vcd --exe", test.pli_filename])
+
+test.execute()
+
+# Full dump at 0, then every 4th call, except that calls while the
+# trigger is false (times 10-14) are not counted
+times = []
+with open(test.trace_filename, 'r', encoding='latin-1') as fh:
+    for line in fh:
+        if line.startswith('#'):
+            times.append(int(line[1:]))
+if times != [0, 4, 8, 17]:
+    test.error("Unexpected dump times " + str(times))
+
+test.passes()
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_trace_dumpvars_dyn.v"
+
+test.compile(make_main=False, verilator_flags2=["--trace-vcd --exe", test.pli_filename])
+
+test.execute()
+
+# Change dumps skip disabled scopes wholesale
+test.file_grep_any(test.glob_some(test.obj_dir + "/*__Trace__0*.cpp"), r'anyEnabled\(oldp, ')
+
+# Map each VCD code to the scopes it appears in, and collect changes per time
+scopes = []
+code_scopes = {}
+changes = {}
+time = None
+with open(test.trace_filename, 'r', encoding='latin-1') as fh:
+    for line in fh:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == '$scope':
+            scopes.append(words[2])
+        elif words[0] == '$upscope':
+            scopes.pop()
+        elif words[0] == '$var':
+            code_scopes.setdefault(words[3], set()).add('.'.join(scopes))
+        elif words[0][0] == '#':
+            time = int(words[0][1:])
+            changes[time] = set()
+        elif time is not None:
+            changes[time].add(words[-1] if words[0][0] in 'br' else words[0][1:])
+
+
+def in_sub1b(code):
+    return all(scope.startswith('top.t.sub1b') for scope in code_scopes[code])
+
+
+for t, codes in changes.items():
+    paused = [c for c in codes if in_sub1b(c)]
+    if 6 <= t < 14 and paused:
+        test.error("Paused scope traced at time " + str(t))
+    if 6 <= t < 14 and not codes:
+        test.error("Nothing traced at time " + str(t))
+if not any(in_sub1b(c) for c in changes.get(14, set())):
+    test.error("Resumed scope not traced at time 14")
+
+test.passes()
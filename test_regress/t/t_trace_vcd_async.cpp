@@ -0,0 +1,56 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_vcd_c.h>
+
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+unsigned long long main_time = 0;
+
+int main(int argc, char** argv) {
+    // Same model traced with the default file, and with the asynchronous file
+    // using small blocks (and O_DIRECT if supported) so many blocks are written
+    const std::unique_ptr<VerilatedContext> contextap{new VerilatedContext};
+    const std::unique_ptr<VerilatedContext> contextbp{new VerilatedContext};
+    contextap->traceEverOn(true);
+    contextbp->traceEverOn(true);
+    contextap->commandArgs(argc, argv);
+    contextbp->commandArgs(argc, argv);
+    std::unique_ptr<VM_PREFIX> topap{new VM_PREFIX{contextap.get(), "top"}};
+    std::unique_ptr<VM_PREFIX> topbp{new VM_PREFIX{contextbp.get(), "top"}};
+    VerilatedVcdAsyncFile asyncFile{true, 4096};
+
+    std::unique_ptr<VerilatedVcdC> tfpap{new VerilatedVcdC};
+    std::unique_ptr<VerilatedVcdC> tfpbp{new VerilatedVcdC{&asyncFile}};
+    topap->trace(tfpap.get(), 99);
+    topbp->trace(tfpbp.get(), 99);
+    tfpap->open(VL_STRINGIFY(TEST_OBJ_DIR) "/simx_sync.vcd");
+    tfpbp->open(VL_STRINGIFY(TEST_OBJ_DIR) "/simx_async.vcd");
+
+    topap->clk = 0;
+    topbp->clk = 0;
+    while (main_time < 2000) {
+        topap->clk = !topap->clk;
+        topbp->clk = !topbp->clk;
+        topap->eval();
+        topbp->eval();
+        tfpap->dump((unsigned int)(main_time));
+        tfpbp->dump((unsigned int)(main_time));
+        if (main_time == 1000) tfpbp->flush();
+        ++main_time;
+    }
+    tfpap->close();
+    tfpbp->close();
+    topap->final();
+    topbp->final();
+    printf("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,21 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t
+  (
+   input wire clk
+   );
+
+   integer    cyc = 0;
+   logic [63:0] sum = 0;
+   logic [127:0] wide = 0;
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      sum <= sum + 64'h1234_5678_9abc_def1;
+      wide <= {wide[126:0], wide[127] ^ cyc[3]};
+   end
+endmodule
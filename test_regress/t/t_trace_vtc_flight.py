@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             v_flags2=["--trace-vtc --exe", test.pli_filename])
+
+test.execute(fails=True)
+
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_vtc2vcd",
+    test.obj_dir + "/simx.vtc",
+    "-o",
+    test.obj_dir + "/simx.vcd",
+],
+         verilator_run=True)
+
+# Only the window before the $stop is kept
+test.file_grep_not(test.obj_dir + "/simx.vcd", r'^#0$')
+test.file_grep(test.obj_dir + "/simx.vcd", r'^#17\d$')
+
+test.passes()
@@ -0,0 +1,36 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   localparam N = 400;  // Enough triggers for VlTriggerVec to keep a summary
+
+   integer cyc = 0;
+   reg [N-1:0] clks = '0;
+   wire [N-1:0] hits;
+
+   // Each of these is a separate trigger, and only one fires at a time
+   for (genvar i = 0; i < N; ++i) begin : gen
+      reg hit = 1'b0;
+      always @(posedge clks[i]) hit <= ~hit;
+      assign hits[i] = hit;
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      // Walking one
+      clks <= {clks[N-2:0], cyc == 0};
+      if (cyc == N + 5) begin
+         if (hits !== {N{1'b1}}) $stop;
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,60 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   reg [3:0] in = 0;
+   wire mux_z, aoi_z, aoi2_z;
+   int cycle = 0;
+
+   udp_mux2 mux (mux_z, in[0], in[1], in[2]);
+   udp_aoi22 aoi (aoi_z, in[0], in[1], in[2], in[3]);
+   udp_aoi22 aoi2 (aoi2_z, in[3], in[2], in[1], in[0]);
+
+   always @(posedge clk) begin
+      if (mux_z !== (in[2] ? in[1] : in[0])) $stop;
+      if (aoi_z !== !((in[0] & in[1]) | (in[2] & in[3]))) $stop;
+      if (aoi2_z !== !((in[3] & in[2]) | (in[1] & in[0]))) $stop;
+      in <= in + 1;
+      cycle <= cycle + 1;
+      if (cycle == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+primitive udp_mux2 (z, a, b, sel);
+   output z;
+   input  a, b, sel;
+   table
+      //a b  s   o
+      ?   1  1 : 1 ;
+      ?   0  1 : 0 ;
+      1   ?  0 : 1 ;
+      0   ?  0 : 0 ;
+      1   1  x : 1 ;
+      0   0  x : 0 ;
+   endtable
+endprimitive
+
+primitive udp_aoi22 (z, a, b, c, d);
+   output z;
+   input  a, b, c, d;
+   table
+      //a b c d   z
+      1   1 ? ? : 0 ;
+      ?   ? 1 1 : 0 ;
+      0   ? 0 ? : 1 ;
+      0   ? ? 0 : 1 ;
+      ?   0 0 ? : 1 ;
+      ?   0 ? 0 : 1 ;
+   endtable
+endprimitive
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_unopt_combo.v"
+
+test.compile(v_flags2=['+define+ALLOW_UNOPT', '--stats'])
+
+test.execute()
+
+test.file_grep(test.stats, r'Scheduling, acyclic, cut variables\s+[1-9]')
+test.file_grep(test.stats, r'Scheduling, acyclic, redundant cuts removed\s+\d+')
+
+test.passes()
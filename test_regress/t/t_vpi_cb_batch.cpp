@@ -0,0 +1,85 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_vpi.h>
+
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static int s_single = 0;  // Calls of the per-callback routine
+static int s_batches = 0;  // Calls of the batch routine
+static PLI_INT32 s_sum = 0;  // Sum of values seen by the batch routine
+
+static PLI_INT32 singleCb(p_cb_data) {
+    ++s_single;
+    return 0;
+}
+
+static void batchCb(size_t count, const p_cb_data* cbDatasp, void* userp) {
+    ++s_batches;
+    TEST_CHECK_EQ(userp, static_cast<void*>(&s_batches));
+    TEST_CHECK_EQ(count, 2);
+    for (size_t i = 0; i < count; ++i) s_sum += cbDatasp[i]->value->value.integer;
+}
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+    topp->clk = 0;
+    topp->eval();
+
+    s_vpi_time t;
+    t.type = vpiSuppressTime;
+    s_vpi_value values[3];
+    s_cb_data cbDatas[3];
+    const char* const names[] = {"t.a", "t.b", "t.c"};
+    for (int i = 0; i < 3; ++i) {
+        values[i].format = vpiIntVal;
+        cbDatas[i] = {};
+        cbDatas[i].reason = cbValueChange;
+        cbDatas[i].cb_rtn = singleCb;
+        cbDatas[i].obj = vpi_handle_by_name(const_cast<PLI_BYTE8*>(names[i]), nullptr);
+        TEST_CHECK_NZ(cbDatas[i].obj);
+        cbDatas[i].time = &t;
+        cbDatas[i].value = &values[i];
+        TEST_CHECK_NZ(vpi_register_cb(&cbDatas[i]));
+    }
+
+    VerilatedVpi::valueChangeBatch(batchCb, &s_batches);
+    for (int cyc = 1; cyc <= 3; ++cyc) {
+        topp->clk = 1;
+        topp->eval();
+        TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), true);
+        TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), false);
+        topp->clk = 0;
+        topp->eval();
+    }
+    TEST_CHECK_EQ(s_batches, 3);
+    TEST_CHECK_EQ(s_single, 0);
+    TEST_CHECK_EQ(s_sum, (1 + 2) + (2 + 4) + (3 + 6));
+
+    // Back to calling each routine
+    VerilatedVpi::valueChangeBatch(nullptr, nullptr);
+    topp->clk = 1;
+    topp->eval();
+    TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), true);
+    TEST_CHECK_EQ(s_batches, 3);
+    TEST_CHECK_EQ(s_single, 2);
+
+    topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,21 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   reg [7:0] a /*verilator public_flat_rd */ = 0;
+   reg [7:0] b /*verilator public_flat_rd */ = 0;
+   reg [7:0] c /*verilator public_flat_rd */ = 0;
+
+   always @(posedge clk) begin
+      a <= a + 1;
+      b <= b + 2;
+   end
+endmodule
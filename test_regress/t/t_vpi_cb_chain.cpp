@@ -0,0 +1,89 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_vpi.h>
+
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static vpiHandle s_bHandle = nullptr;
+static int s_aCalls = 0;  // Calls of the callback watching 'a'
+static int s_bCalls = 0;  // Calls of the callback watching 'b'
+static PLI_INT32 s_bValue = 0;  // Value of 'b' last seen by its callback
+
+// Copy 'a' + 100 into 'b', which another callback watches
+static PLI_INT32 aCb(p_cb_data cbDatap) {
+    ++s_aCalls;
+    s_vpi_value value;
+    value.format = vpiIntVal;
+    value.value.integer = cbDatap->value->value.integer + 100;
+    vpi_put_value(s_bHandle, &value, nullptr, vpiNoDelay);
+    return 0;
+}
+
+static PLI_INT32 bCb(p_cb_data cbDatap) {
+    ++s_bCalls;
+    s_bValue = cbDatap->value->value.integer;
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+    topp->clk = 0;
+    topp->eval();
+
+    s_bHandle = vpi_handle_by_name(const_cast<PLI_BYTE8*>("t.b"), nullptr);
+    TEST_CHECK_NZ(s_bHandle);
+
+    s_vpi_time t;
+    t.type = vpiSuppressTime;
+    s_vpi_value values[2];
+    s_cb_data cbDatas[2];
+    // Register the 'b' callback first, so it would come first in a pass
+    const char* const names[] = {"t.b", "t.a"};
+    for (int i = 0; i < 2; ++i) {
+        values[i].format = vpiIntVal;
+        cbDatas[i] = {};
+        cbDatas[i].reason = cbValueChange;
+        cbDatas[i].cb_rtn = i == 0 ? bCb : aCb;
+        cbDatas[i].obj = vpi_handle_by_name(const_cast<PLI_BYTE8*>(names[i]), nullptr);
+        TEST_CHECK_NZ(cbDatas[i].obj);
+        cbDatas[i].time = &t;
+        cbDatas[i].value = &values[i];
+        TEST_CHECK_NZ(vpi_register_cb(&cbDatas[i]));
+    }
+
+    for (int cyc = 1; cyc <= 3; ++cyc) {
+        topp->clk = 1;
+        topp->eval();
+        // A change made by a callback is reported by the next call, not the same pass
+        TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), true);
+        TEST_CHECK_EQ(s_aCalls, cyc);
+        TEST_CHECK_EQ(s_bCalls, cyc - 1);
+        TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), true);
+        TEST_CHECK_EQ(s_aCalls, cyc);
+        TEST_CHECK_EQ(s_bCalls, cyc);
+        TEST_CHECK_EQ(s_bValue, cyc + 100);
+        TEST_CHECK_EQ(VerilatedVpi::callValueCbs(), false);
+        topp->clk = 0;
+        topp->eval();
+    }
+
+    topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,79 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_vpi.h>
+
+#include <cstring>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static vpiHandle handle(const char* namep) {
+    vpiHandle h = vpi_handle_by_name(const_cast<PLI_BYTE8*>(namep), nullptr);
+    TEST_CHECK_NZ(h);
+    return h;
+}
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+    topp->clk = 0;
+    topp->eval();
+
+    const vpiHandle memh = handle("t.mem");
+    const vpiHandle handles[] = {handle("t.narrow"), handle("t.quad"), handle("t.wide"),
+                                 vpi_handle_by_index(memh, 2)};
+    TEST_CHECK_EQ(VerilatedVpi::rawSize(handles[0]), 1);
+    TEST_CHECK_EQ(VerilatedVpi::rawSize(handles[1]), 8);
+    TEST_CHECK_EQ(VerilatedVpi::rawSize(handles[2]), 12);
+    TEST_CHECK_EQ(VerilatedVpi::rawSize(handles[3]), 4);
+    TEST_CHECK_EQ(VerilatedVpi::rawSize(memh), 0);  // Whole unpacked array
+
+    uint8_t buf[25];
+    TEST_CHECK_EQ(VerilatedVpi::getRaw(4, handles, buf), true);
+    TEST_CHECK_EQ(buf[0], 5);
+    QData quad;
+    std::memcpy(&quad, buf + 1, sizeof(quad));
+    TEST_CHECK_HEX_EQ(quad, 0x123456789aULL);
+    EData wide[3];
+    std::memcpy(wide, buf + 9, sizeof(wide));
+    TEST_CHECK_HEX_EQ(wide[0], 1);
+    TEST_CHECK_HEX_EQ(wide[2], 3);
+    IData elem;
+    std::memcpy(&elem, buf + 21, sizeof(elem));
+    TEST_CHECK_EQ(elem, 12);
+
+    // Upper bits beyond each width are cleared
+    std::memset(buf, 0xff, sizeof(buf));
+    TEST_CHECK_EQ(VerilatedVpi::putRaw(4, handles, buf), true);
+    TEST_CHECK_EQ(VerilatedVpi::evalNeeded(), true);
+    TEST_CHECK_EQ(VerilatedVpi::getRaw(4, handles, buf), true);
+    TEST_CHECK_HEX_EQ(buf[0], 0x1f);
+    std::memcpy(&quad, buf + 1, sizeof(quad));
+    TEST_CHECK_HEX_EQ(quad, 0xffffffffffULL);
+    std::memcpy(wide, buf + 9, sizeof(wide));
+    TEST_CHECK_HEX_EQ(wide[2], 0x3f);
+
+    topp->clk = 1;
+    topp->eval();
+    s_vpi_value value;
+    value.format = vpiIntVal;
+    vpi_get_value(handle("t.sum"), &value);
+    TEST_CHECK_HEX_EQ(static_cast<IData>(value.value.integer), 0x1fU + 0xffffffffU * 3);
+
+    topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,22 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   reg [4:0] narrow /*verilator public_flat_rw @(posedge clk) */ = 5'h5;
+   reg [39:0] quad /*verilator public_flat_rw @(posedge clk) */ = 40'h12_3456_789a;
+   reg [69:0] wide /*verilator public_flat_rw @(posedge clk) */ = {6'h3, 32'h2, 32'h1};
+   reg [31:0] mem[3:0] /*verilator public_flat_rw @(posedge clk) */;
+   reg [31:0] sum /*verilator public_flat_rd */;
+
+   initial for (int i = 0; i < 4; ++i) mem[i] = 10 + i;
+
+   always @(posedge clk) sum <= 32'(narrow) + quad[31:0] + wide[31:0] + mem[2];
+endmodule
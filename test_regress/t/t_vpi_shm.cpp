@@ -0,0 +1,79 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_vpi.h>
+
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+    topp->clk = 0;
+    topp->eval();
+
+    const vpiHandle handles[] = {vpi_handle_by_name(const_cast<PLI_BYTE8*>("t.narrow"), nullptr),
+                                 vpi_handle_by_name(const_cast<PLI_BYTE8*>("t.quad"), nullptr)};
+    const std::string filename = std::string{VL_STRINGIFY(TEST_OBJ_DIR)} + "/mirror.shm";
+    VerilatedVpiShm shm;
+    TEST_CHECK_EQ(shm.open(filename.c_str(), 2, handles), true);
+    TEST_CHECK_EQ(shm.isOpen(), true);
+
+    // Read the file as an external process would
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    TEST_CHECK_EQ(fd >= 0, true);
+    const size_t bytes = ::lseek(fd, 0, SEEK_END);
+    const uint8_t* const basep
+        = static_cast<const uint8_t*>(::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0));
+    ::close(fd);
+    const uint64_t* const headerp = reinterpret_cast<const uint64_t*>(basep);
+    TEST_CHECK_EQ(std::memcmp(basep, "vltshm01", 8), 0);
+    TEST_CHECK_EQ(headerp[2], 2);
+    const char* const namep = reinterpret_cast<const char*>(headerp + 4 + 2 * 2);
+    TEST_CHECK_CSTR(namep, "t.narrow");
+    TEST_CHECK_CSTR(namep + std::strlen(namep) + 1, "t.quad");
+    TEST_CHECK_EQ(headerp[5], 1);
+    TEST_CHECK_EQ(headerp[7], 8);
+
+    const uint64_t sequence = headerp[1];
+    TEST_CHECK_EQ(sequence % 2, 0);
+    TEST_CHECK_EQ(basep[headerp[4]], 5);
+    const uint8_t narrow = 0x11;
+    const QData quad = 0x12345ULL;
+    uint8_t buf[9];
+    buf[0] = narrow;
+    std::memcpy(buf + 1, &quad, sizeof(quad));
+    VerilatedVpi::putRaw(2, handles, buf);
+    shm.update();
+    TEST_CHECK_EQ(headerp[1], sequence + 2);
+    TEST_CHECK_HEX_EQ(basep[headerp[4]], narrow);
+    QData got;
+    std::memcpy(&got, basep + headerp[6], sizeof(got));
+    TEST_CHECK_HEX_EQ(got, quad);
+
+    ::munmap(const_cast<uint8_t*>(basep), bytes);
+    shm.close();
+    TEST_CHECK_EQ(shm.isOpen(), false);
+
+    topp->final();
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}